@@ -6,6 +6,11 @@
  *
  * @details 文字列比較や文字列連結等の文字列処理機能も提供する
  *
+ * 短い文字列(終端文字を含めて24byte以下)は文字列コンテナ内部のバッファに格納し、文字列バッファのヒープ確保を行わない。
+ *
+ * 文字列の一部や、終端文字で終わらない文字列を参照する場合はchoco_string_view_t(先頭アドレス + 長さ)を使用する。
+ * ビューは参照先の文字列を所有しないため、生成/破棄によるメモリ確保は発生しない。
+ *
  * @note
  * choco_string_t構造体は、内部データを隠蔽している。
  * このため、choco_string_t型で変数を宣言することはできない。
@@ -29,12 +34,39 @@ extern "C" {
 #include <stddef.h>
 #include <stdbool.h>
 
+#if defined(__GNUC__) || defined(__clang__)
+  /**
+   * @brief printf形式の書式文字列を受け取る関数に付与し、書式文字列と引数の整合性をコンパイル時にチェックさせる
+   *
+   */
+  #define CHOCO_STRING_PRINTF_FORMAT(format_index_, first_arg_index_) __attribute__((format(printf, format_index_, first_arg_index_)))
+#else
+  /**
+   * @brief printf形式の書式文字列を受け取る関数に付与する修飾子(対応していないコンパイラでは何もしない)
+   *
+   */
+  #define CHOCO_STRING_PRINTF_FORMAT(format_index_, first_arg_index_)
+#endif
+
 /**
  * @brief choco_string_t前方宣言
  *
  */
 typedef struct choco_string choco_string_t;
 
+/**
+ * @brief 文字列を所有せずに参照する文字列ビュー
+ *
+ * @note
+ * - dataが指す文字列は終端文字で終わるとは限らない。このため、dataをconst char*型文字列として扱ってはいけない
+ * - 参照先文字列の寿命はビューの使用者が保証すること(参照先のchoco_string_tが変更/破棄された場合、ビューは無効となる)
+ * - length == 0の場合、dataはNULLでも良い
+ */
+typedef struct choco_string_view {
+    const char* data;   /**< 参照先文字列の先頭アドレス */
+    size_t length;      /**< 参照する文字列長さ(終端文字は含まない) */
+} choco_string_view_t;
+
 /**
  * @brief 文字列API実行結果コードリスト
  */
@@ -73,7 +105,7 @@ choco_string_result_t choco_string_default_create(choco_string_t** string_);
  * @brief const char*型文字列src_で文字列コンテナを生成する
  *
  * @note
- * - string_が管理する文字列バッファはsrc_の文字列長さ+1(終端文字)のサイズで初期化される
+ * - string_が管理する文字列バッファはsrc_の文字列長さ+1(終端文字)のサイズで初期化される(文字列コンテナ内部のバッファに収まる場合は内部バッファを使用する)
  * - 生成したインスタンスは @ref choco_string_destroy で破棄すること
  *
  * @param[in] src_ 初期化文字列
@@ -160,7 +192,7 @@ choco_string_result_t choco_string_copy_from_c_string(const char* src_, choco_st
  * @note
  * - 自己連結(dst_にdst_を連結する)ことは禁止する(内部バッファ管理を簡便にするため)
  * - string_が管理する文字列が""の場合は何もしない
- * - dst_が管理するバッファの容量が足りない場合は,新規にバッファを取得し直す
+ * - dst_が管理するバッファの容量が足りない場合は,現在のバッファサイズの2倍(不足する場合は連結後の文字列長さ+1)に拡張する(連結を繰り返した場合の再確保回数を抑えるため)
  *
  * @param[in] string_ 連結元文字列
  * @param[in,out] dst_ 連結先文字列
@@ -186,7 +218,7 @@ choco_string_result_t choco_string_concat(const choco_string_t* string_, choco_s
  *
  * @note
  * - string_が""の場合は何もしない
- * - dst_が管理するバッファの容量が足りない場合は,新規にバッファを取得し直す
+ * - dst_が管理するバッファの容量が足りない場合は,現在のバッファサイズの2倍(不足する場合は連結後の文字列長さ+1)に拡張する(連結を繰り返した場合の再確保回数を抑えるため)
  *
  * @param[in] string_ 連結元文字列
  * @param[in,out] dst_ 連結先文字列
@@ -204,6 +236,143 @@ choco_string_result_t choco_string_concat(const choco_string_t* string_, choco_s
  */
 choco_string_result_t choco_string_concat_from_c_string(const char* string_, choco_string_t* dst_);
 
+/**
+ * @brief 文字列ビューsrc_が参照する文字列をdst_にコピーする
+ *
+ * @note
+ * - dst_のバッファサイズがsrc_.length+1(終端文字)よりも小さい場合のみ、バッファサイズをsrc_.length+1に拡張する
+ * - src_はdst_自身が管理する文字列の一部を参照していても良い
+ *
+ * @param[in] src_ コピー元文字列ビュー
+ * @param[in,out] dst_ コピー先文字列コンテナ
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT 以下のいずれか
+ * - dst_ == NULL
+ * - src_.data == NULL かつ src_.length != 0
+ * @retval CHOCO_STRING_DATA_CORRUPTED dst_の内部データが破損(アドレスへの不正アクセス等により発生)
+ * @retval CHOCO_STRING_OVERFLOW src_.length+1(終端文字)がsize_tの上限を超過
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS コピーに成功し,正常終了
+ * @warning 上記以外のエラーは,テストなどで意図的に発生させない限り起こり得ないエラーで確実にバグ
+ */
+choco_string_result_t choco_string_copy_from_view(choco_string_view_t src_, choco_string_t* dst_);
+
+/**
+ * @brief 文字列ビューstring_が参照する文字列をdst_の末尾に連結する
+ *
+ * @note
+ * - string_.length == 0の場合は何もしない
+ * - dst_が管理するバッファの容量が足りない場合は,現在のバッファサイズの2倍(不足する場合は連結後の文字列長さ+1)に拡張する
+ * - string_はdst_自身が管理する文字列の一部を参照していても良い(バッファ拡張後の位置から連結する)
+ *
+ * 使用例:
+ * @code{.c}
+ * // ディレクトリ + ファイル名 + 拡張子を、一時文字列コンテナを生成せずに組み立てる
+ * ret = choco_string_copy_from_view(choco_string_view_from_c_string(dir), path);
+ * ret = choco_string_concat_from_view(choco_string_view_from_c_string(name), path);
+ * ret = choco_string_concat_from_view(choco_string_view_from_c_string(".bmp"), path);
+ * @endcode
+ *
+ * @param[in] string_ 連結元文字列ビュー
+ * @param[in,out] dst_ 連結先文字列コンテナ
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT 以下のいずれか
+ * - dst_ == NULL
+ * - string_.data == NULL かつ string_.length != 0
+ * @retval CHOCO_STRING_DATA_CORRUPTED dst_の内部データが破損(アドレスへの不正アクセス等により発生)
+ * @retval CHOCO_STRING_OVERFLOW 連結後の文字列長さがsize_tの上限を超過
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 文字列の連結に成功し,正常終了
+ */
+choco_string_result_t choco_string_concat_from_view(choco_string_view_t string_, choco_string_t* dst_);
+
+/**
+ * @brief printf形式で書式化した文字列をdst_の末尾に連結する
+ *
+ * @note
+ * - dst_の既存バッファ(内部バッファを含む)の空き領域に直接書き込むため、空き領域に収まる場合はメモリ確保も一時バッファも使用しない
+ * - 空き領域が不足する場合のみ @ref choco_string_concat と同様にバッファを拡張し、再度書式化する
+ * - 処理に失敗した場合、dst_が管理する文字列は変化しない
+ * - 書式化の引数にdst_自身が管理する文字列(@ref choco_string_c_str の戻り値等)を渡してはいけない
+ *
+ * 使用例:
+ * @code{.c}
+ * ret = choco_string_append_format(path, "%s%s%s", dir, name, ".bmp");
+ * ret = choco_string_append_format(message, "frame=%u, dt=%f", frame_count, delta_time);
+ * @endcode
+ *
+ * @param[in,out] dst_ 連結先文字列コンテナ
+ * @param[in] format_ printf形式の書式文字列
+ * @param[in] ... 書式文字列に対応する引数
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT 以下のいずれか
+ * - dst_ == NULL
+ * - format_ == NULL
+ * @retval CHOCO_STRING_DATA_CORRUPTED dst_の内部データが破損(アドレスへの不正アクセス等により発生)
+ * @retval CHOCO_STRING_RUNTIME_ERROR 書式化に失敗(不正な書式文字列、またはエンコーディングエラー)
+ * @retval CHOCO_STRING_OVERFLOW 連結後の文字列長さがsize_tの上限を超過
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 文字列の連結に成功し,正常終了
+ */
+choco_string_result_t choco_string_append_format(choco_string_t* dst_, const char* format_, ...) CHOCO_STRING_PRINTF_FORMAT(2, 3);
+
+/**
+ * @brief 文字列コンテナstring_のバッファを、文字列長さlength_(終端文字を含まない)まで再確保なしで格納できるサイズに拡張する
+ *
+ * @note
+ * - 格納済みの文字列は保持される
+ * - バッファサイズが既にlength_+1(終端文字)以上の場合は何もしない
+ * - 格納する文字列の長さが事前に分かっている場合に本関数で確保しておくことで、連結時のメモリ再確保を回避できる
+ * - 取得済みの @ref choco_string_c_str の戻り値は無効となる場合がある
+ *
+ * 使用例:
+ * @code{.c}
+ * ret = choco_string_reserve(4096, str);   // 4096文字分のバッファを確保
+ * // 以降、合計4096文字までの連結ではメモリの再確保が発生しない
+ * ret = choco_string_concat_from_c_string(line, str);
+ * @endcode
+ *
+ * @param[in] length_ 格納したい文字列長さ(終端文字を含まない)
+ * @param[in,out] string_ 拡張対象文字列コンテナ
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT string_ == NULL
+ * @retval CHOCO_STRING_DATA_CORRUPTED string_の内部データが破損(アドレスへの不正アクセス等により発生)
+ * @retval CHOCO_STRING_OVERFLOW length_+1(終端文字)がsize_tの上限を超過
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS バッファの拡張に成功(または拡張不要)し,正常終了
+ * @warning 上記以外のエラーは,テストなどで意図的に発生させない限り起こり得ないエラーで確実にバグ
+ */
+choco_string_result_t choco_string_reserve(size_t length_, choco_string_t* string_);
+
+/**
+ * @brief 文字列コンテナstring_のバッファサイズを、格納している文字列長さ+1(終端文字)まで縮小する
+ *
+ * @note
+ * - 連結によるバッファ拡張は倍々で行われるため、構築完了後に長期間保持する文字列は本関数で余剰領域を解放できる
+ * - 文字列長さが0の場合はバッファを解放する(@ref choco_string_default_create 直後と同じ状態になる)
+ * - バッファサイズが既に文字列長さ+1(終端文字)の場合は何もしない
+ * - 処理に失敗した場合、string_の状態は不変
+ * - 取得済みの @ref choco_string_c_str の戻り値は無効となる場合がある
+ *
+ * @param[in,out] string_ 縮小対象文字列コンテナ
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT string_ == NULL
+ * @retval CHOCO_STRING_DATA_CORRUPTED string_の内部データが破損(アドレスへの不正アクセス等により発生)
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS バッファの縮小に成功(または縮小不要)し,正常終了
+ */
+choco_string_result_t choco_string_shrink_to_fit(choco_string_t* string_);
+
 /**
  * @brief 文字列コンテナstring_が管理する文字列の長さを取得する
  *
@@ -230,6 +399,43 @@ size_t choco_string_length(const choco_string_t* string_);
  */
 const char* choco_string_c_str(const choco_string_t* string_);
 
+/**
+ * @brief 文字列コンテナstring_が管理する文字列全体を参照する文字列ビューを取得する
+ *
+ * @note
+ * - string_がNULLまたは内部管理バッファがNULLの場合は長さ0のビューを返す
+ * - 取得したビューはstring_が変更または破棄されるまで有効
+ *
+ * @param[in] string_ 参照対象文字列コンテナ
+ *
+ * @return choco_string_view_t string_を参照する文字列ビュー
+ */
+choco_string_view_t choco_string_view_get(const choco_string_t* string_);
+
+/**
+ * @brief const char*型文字列str_全体を参照する文字列ビューを取得する
+ *
+ * @note str_ == NULLの場合は長さ0のビューを返す
+ *
+ * @param[in] str_ 参照対象文字列
+ *
+ * @return choco_string_view_t str_を参照する文字列ビュー
+ */
+choco_string_view_t choco_string_view_from_c_string(const char* str_);
+
+/**
+ * @brief 2つの文字列ビューが参照する文字列が等しいかを判定する
+ *
+ * @note 長さ0のビュー同士は、dataの値によらず等しいと判定する
+ *
+ * @param[in] view1_ 比較文字列ビュー1
+ * @param[in] view2_ 比較文字列ビュー2
+ *
+ * @retval true 2つの文字列が等しい
+ * @retval false 2つの文字列が等しくない
+ */
+bool choco_string_view_equal(choco_string_view_t view1_, choco_string_view_t view2_);
+
 /**
  * @brief 2つの文字列が等しいかを判定する
  *
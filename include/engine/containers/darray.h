@@ -0,0 +1,273 @@
+/** @ingroup containers
+ *
+ * @file darray.h
+ * @author chocolate-pie24
+ * @brief 要素を連続したメモリ領域に格納する、容量可変のジェネリック型動的配列モジュールを提供する
+ *
+ * @details
+ * 頂点のバッチング、点群の蓄積、描画リストの構築等、要素数が実行時に決まる連続バッファを扱うための動的配列。特徴は、
+ *
+ * - 要素は生成時に指定したサイズ/アライメント要件で固定化され、連続したメモリ領域に隙間なく格納される(@ref darray_data で先頭アドレスを取得し、GPUへの転送等にそのまま使用できる)
+ * - 容量不足時は容量を2倍に拡張するため、@ref darray_push と @ref darray_append は償却O(1)で動作する
+ * - 容量の拡張はmemory_system_reallocateで行うため、割り当て元のアロケータでその場で拡張できる場合はコピーが発生しない
+ * - @ref darray_swap_remove は削除位置に末尾の要素を移動することで、要素の順序を保持しない代わりにO(1)で削除する
+ * - @ref darray_clear は要素数のみを0にし、確保済みの容量は保持する(フレームごとの再構築でメモリの再確保が発生しない)
+ *
+ * 配列本体と要素バッファのメモリは、生成時に指定したメモリタグでメモリシステムから確保する。
+ *
+ * @note
+ * darray_t構造体は、内部データを隠蔽している。
+ * このため、darray_t型で変数を宣言することはできない。
+ * 使用の際は、darray_t*型で宣言すること
+ *
+ * @note
+ * darray_tに格納できる要素には、ring_queue_tと同様に下記の制約を設ける
+ * - 格納するデータのアライメント要件は2のべき乗であること
+ * - 格納するデータのアライメント要件はmax_align_t以下であること
+ *
+ * @note
+ * 容量の拡張により要素バッファの先頭アドレスが変化するため、@ref darray_at 、@ref darray_data で取得したポインタは、
+ * 次の@ref darray_reserve 、@ref darray_push 、@ref darray_append の呼び出しで無効になる
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_DARRAY_H
+#define GLCE_ENGINE_CONTAINERS_DARRAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "engine/core/memory/choco_memory.h"
+
+/**
+ * @brief darray_t前方宣言
+ *
+ */
+typedef struct darray darray_t;
+
+/**
+ * @brief 動的配列API実行結果コードリスト
+ *
+ */
+typedef enum {
+    DARRAY_SUCCESS = 0,         /**< 処理成功 */
+    DARRAY_INVALID_ARGUMENT,    /**< 無効な引数 */
+    DARRAY_NO_MEMORY,           /**< メモリ不足 */
+    DARRAY_RUNTIME_ERROR,       /**< 実行時エラー */
+    DARRAY_UNDEFINED_ERROR,     /**< 未定義エラー */
+    DARRAY_LIMIT_EXCEEDED,      /**< システム使用可能範囲上限超過 */
+    DARRAY_BAD_OPERATION,       /**< API誤用 */
+    DARRAY_DATA_CORRUPTED,      /**< 内部データ破損 */
+    DARRAY_OVERFLOW,            /**< 計算過程のオーバーフロー */
+} darray_result_t;
+
+/**
+ * @brief darray_のメモリをメモリシステムから確保し、初期容量initial_capacity_で初期化する
+ *
+ * @note
+ * - 初期化された動的配列に格納する要素のサイズとアライメント要件はelement_size_,element_align_で固定化される
+ * - initial_capacity_ == 0の場合、要素バッファは最初の要素追加時に確保する
+ *
+ * 使用例:
+ * @code{.c}
+ * darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+ * darray_t* vertices = NULL;
+ *
+ * // ui_vertex_tを格納する動的配列初期化処理(初期容量は64)
+ * ret = darray_create(64, sizeof(ui_vertex_t), alignof(ui_vertex_t), MEMORY_TAG_RENDERER, &vertices);
+ * @endcode
+ *
+ * @param[in] initial_capacity_ 初期容量(要素数)
+ * @param[in] element_size_ 要素のサイズ
+ * @param[in] element_align_ 要素のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[in] mem_tag_ 配列本体と要素バッファのメモリタグ
+ * @param[out] darray_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval DARRAY_INVALID_ARGUMENT 以下のいずれか
+ * - darray_ == NULL
+ * - *darray_ != NULL
+ * - 0 == element_size_
+ * - element_align_が2の冪乗ではない
+ * - element_align_がmax_align_tを超過
+ * - mem_tag_ >= MEMORY_TAG_MAX
+ * @retval DARRAY_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval DARRAY_NO_MEMORY メモリ不足によりメモリ確保失敗
+ * @retval DARRAY_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval DARRAY_BAD_OPERATION メモリシステム未初期化
+ * @retval DARRAY_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see darray_destroy
+ */
+darray_result_t darray_create(size_t initial_capacity_, size_t element_size_, size_t element_align_, memory_tag_t mem_tag_, darray_t** darray_);
+
+/**
+ * @brief darray_create で確保したメモリを解放する
+ *
+ * @note
+ * - darray_ == NULLの場合はno-op
+ * - *darray_ == NULLの場合はno-op
+ * - 解放後、*darray_はNULLに設定される
+ *
+ * @param[in,out] darray_ 破棄対象構造体インスタンスへのダブルポインタ
+ */
+void darray_destroy(darray_t** darray_);
+
+/**
+ * @brief darray_の容量をcapacity_以上に拡張する
+ *
+ * @note
+ * - capacity_が現在の容量以下の場合は何もしない(容量の縮小は行わない)
+ * - 拡張後の容量はcapacity_ちょうどとなる。要素数の上限が事前に分かっている場合に、要素追加時の再確保を避けるために使用する
+ *
+ * @param[in] capacity_ 必要な容量(要素数)
+ * @param[in,out] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @retval DARRAY_INVALID_ARGUMENT darray_ == NULL
+ * @retval DARRAY_DATA_CORRUPTED 動的配列内部データ破損
+ * @retval DARRAY_OVERFLOW 要素バッファのサイズがsize_tの最大値を超過
+ * @retval DARRAY_NO_MEMORY メモリ不足によりメモリ確保失敗(darray_は変更されない)
+ * @retval DARRAY_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval DARRAY_BAD_OPERATION メモリシステム未初期化、または定常状態割り当てガードにより拡張が拒否された
+ * @retval DARRAY_SUCCESS 拡張に成功し、正常終了
+ */
+darray_result_t darray_reserve(size_t capacity_, darray_t* darray_);
+
+/**
+ * @brief element_が指す要素1つをdarray_の末尾に追加する
+ *
+ * @note
+ * - 容量不足の場合は容量を2倍(最小8)に拡張してから追加する
+ * - element_はdarray_内の要素を指していてもよい
+ *
+ * @param[in] element_ 追加する要素へのポインタ
+ * @param[in,out] darray_ 追加先動的配列構造体インスタンスへのポインタ
+ *
+ * @retval DARRAY_INVALID_ARGUMENT 以下のいずれか
+ * - element_ == NULL
+ * - darray_ == NULL
+ * @retval DARRAY_DATA_CORRUPTED 動的配列内部データ破損
+ * @retval DARRAY_OVERFLOW 要素数、または要素バッファのサイズがsize_tの最大値を超過
+ * @retval DARRAY_NO_MEMORY メモリ不足によりメモリ確保失敗(darray_は変更されない)
+ * @retval DARRAY_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval DARRAY_BAD_OPERATION メモリシステム未初期化、または定常状態割り当てガードにより拡張が拒否された
+ * @retval DARRAY_SUCCESS 追加に成功し、正常終了
+ */
+darray_result_t darray_push(const void* element_, darray_t* darray_);
+
+/**
+ * @brief elements_が指す連続したcount_個の要素をdarray_の末尾にまとめて追加する
+ *
+ * @note
+ * - 容量の拡張は追加前に1回だけ行い、要素のコピーは1回のmemcpyで行う
+ * - count_ == 0の場合は何もしない
+ * - elements_はdarray_内の要素を指していてもよい
+ *
+ * 使用例:
+ * @code{.c}
+ * ui_vertex_t quad[6];
+ * // quadに頂点を設定
+ * ret = darray_append(quad, 6, vertices);
+ * @endcode
+ *
+ * @param[in] elements_ 追加する要素配列の先頭アドレス
+ * @param[in] count_ 追加する要素数
+ * @param[in,out] darray_ 追加先動的配列構造体インスタンスへのポインタ
+ *
+ * @retval DARRAY_INVALID_ARGUMENT 以下のいずれか
+ * - elements_ == NULL
+ * - darray_ == NULL
+ * @retval DARRAY_DATA_CORRUPTED 動的配列内部データ破損
+ * @retval DARRAY_OVERFLOW 要素数、または要素バッファのサイズがsize_tの最大値を超過
+ * @retval DARRAY_NO_MEMORY メモリ不足によりメモリ確保失敗(darray_は変更されない)
+ * @retval DARRAY_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval DARRAY_BAD_OPERATION メモリシステム未初期化、または定常状態割り当てガードにより拡張が拒否された
+ * @retval DARRAY_SUCCESS 追加に成功し、正常終了
+ */
+darray_result_t darray_append(const void* elements_, size_t count_, darray_t* darray_);
+
+/**
+ * @brief darray_のindex_番目の要素を削除し、削除位置に末尾の要素を移動する
+ *
+ * @note 要素の順序は保持されない。index_が末尾の要素の場合は要素数を1減らすのみ
+ *
+ * @param[in] index_ 削除する要素のインデックス
+ * @param[in,out] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @retval DARRAY_INVALID_ARGUMENT 以下のいずれか
+ * - darray_ == NULL
+ * - index_ >= 要素数
+ * @retval DARRAY_DATA_CORRUPTED 動的配列内部データ破損
+ * @retval DARRAY_SUCCESS 削除に成功し、正常終了
+ */
+darray_result_t darray_swap_remove(size_t index_, darray_t* darray_);
+
+/**
+ * @brief darray_の全要素を削除する
+ *
+ * @note
+ * - 要素数のみを0にし、確保済みの容量は保持する
+ * - darray_ == NULLの場合はno-op
+ *
+ * @param[in,out] darray_ 対象動的配列構造体インスタンスへのポインタ
+ */
+void darray_clear(darray_t* darray_);
+
+/**
+ * @brief darray_のindex_番目の要素へのポインタを取得する
+ *
+ * @note 取得したポインタはdarray_内部の要素を直接指すため、要素の書き換えに使用できる
+ *
+ * @param[in] index_ 取得する要素のインデックス
+ * @param[in] darray_ 対象動的配列構造体インスタンスへのポインタ
+ * @param[out] out_element_ 要素へのポインタの格納先
+ *
+ * @retval DARRAY_INVALID_ARGUMENT 以下のいずれか
+ * - darray_ == NULL
+ * - out_element_ == NULL
+ * - index_ >= 要素数
+ * @retval DARRAY_DATA_CORRUPTED 動的配列内部データ破損
+ * @retval DARRAY_SUCCESS 取得に成功し、正常終了
+ */
+darray_result_t darray_at(size_t index_, const darray_t* darray_, void** out_element_);
+
+/**
+ * @brief darray_の要素バッファの先頭アドレスを取得する
+ *
+ * @param[in] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @return void* 要素バッファの先頭アドレス(darray_ == NULL、または要素バッファ未確保の場合はNULL)
+ */
+void* darray_data(const darray_t* darray_);
+
+/**
+ * @brief darray_に格納されている要素数を取得する
+ *
+ * @param[in] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @return size_t 格納されている要素数(darray_ == NULLの場合は0)
+ */
+size_t darray_count(const darray_t* darray_);
+
+/**
+ * @brief darray_の容量を取得する
+ *
+ * @param[in] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @return size_t 再確保なしで格納可能な要素数(darray_ == NULLの場合は0)
+ */
+size_t darray_capacity(const darray_t* darray_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,263 @@
+/** @ingroup containers
+ *
+ * @file handle_pool.h
+ * @author chocolate-pie24
+ * @brief 世代付きハンドルで要素を参照するジェネリック型のハンドルプールモジュールを提供する
+ *
+ * @details
+ * 要素の登録時にハンドル(スロットインデックス + 世代)を払い出し、以降はハンドルを使用して要素を参照する。特徴は、
+ *
+ * - 登録、参照、登録解除はいずれもO(1)
+ * - 登録解除時にスロットの世代を進めるため、登録解除済みのハンドル(スロットが再利用された場合を含む)をO(1)で検出できる
+ * - 要素は先頭から詰めて格納するため、登録中の要素を連続したメモリとして走査できる(@ref handle_pool_at 参照)
+ *
+ * 内部では、要素を詰めて格納する要素配列と、ハンドルのスロットから要素配列のインデックスへの対応表、空きスロットリストを管理する \n
+ * 登録解除時は要素配列の末尾の要素を空いた位置に移動するため、要素の格納位置と走査順は登録解除によって変化する
+ *
+ * @note
+ * handle_pool_t構造体は、内部データを隠蔽している。
+ * このため、handle_pool_t型で変数を宣言することはできない。
+ * 使用の際は、handle_pool_t*型で宣言すること
+ *
+ * @note
+ * handle_pool_tに格納できるデータには、ring_queue_tと同様に下記の制約を設ける
+ * - 格納するデータのアライメント要件は2のべき乗であること
+ * - 格納するデータのアライメント要件はmax_align_t以下であること
+ *
+ * @note
+ * テクスチャマネージャー、カメラマネージャーはint16_tのIDを公開APIとしているため、現状では本モジュールを使用していない 
+
+ * (マネージャーのスロット管理は@ref sparse_set.h を使用する)
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_HANDLE_POOL_H
+#define GLCE_ENGINE_CONTAINERS_HANDLE_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief handle_pool_t前方宣言
+ *
+ */
+typedef struct handle_pool handle_pool_t;
+
+/**
+ * @brief ハンドルプールに登録した要素を参照するハンドル
+ *
+ * @note generation == 0のハンドルは無効なハンドルとして扱う(ゼロ初期化したハンドルは常に無効)
+ */
+typedef struct handle_pool_handle {
+    uint32_t index;         /**< スロットインデックス */
+    uint32_t generation;    /**< 払い出し時点のスロットの世代(1以上) */
+} handle_pool_handle_t;
+
+/**
+ * @brief ハンドルプールに格納可能な要素数の上限値
+ *
+ * @note UINT32_MAXは空きスロットリストの終端を表すために使用する
+ */
+#define HANDLE_POOL_MAX_ELEMENT_COUNT ((size_t)UINT32_MAX - 1U)
+
+/**
+ * @brief ハンドルプールAPI実行結果コードリスト
+ *
+ */
+typedef enum {
+    HANDLE_POOL_SUCCESS = 0,        /**< 処理成功 */
+    HANDLE_POOL_INVALID_ARGUMENT,   /**< 無効な引数 */
+    HANDLE_POOL_NO_MEMORY,          /**< メモリ不足 */
+    HANDLE_POOL_RUNTIME_ERROR,      /**< 実行時エラー */
+    HANDLE_POOL_UNDEFINED_ERROR,    /**< 未定義エラー */
+    HANDLE_POOL_LIMIT_EXCEEDED,     /**< システム使用可能範囲上限超過 */
+    HANDLE_POOL_BAD_OPERATION,      /**< API誤用 */
+    HANDLE_POOL_DATA_CORRUPTED,     /**< 内部データ破損 */
+    HANDLE_POOL_OVERFLOW,           /**< 計算過程のオーバーフロー */
+    HANDLE_POOL_STALE_HANDLE,       /**< 登録解除済み(世代不一致)のハンドル */
+} handle_pool_result_t;
+
+/**
+ * @brief handle_pool_のメモリを確保し、容量max_element_count_で初期化する
+ *
+ * @note 初期化されたハンドルプールに格納するデータのサイズとアライメント要件はelement_size_,element_align_で固定化される
+ *
+ * 使用例:
+ * @code{.c}
+ * handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+ * handle_pool_t* handle_pool = NULL;
+ *
+ * // camera_t*型のデータを格納するハンドルプール初期化処理(格納要素数は8)
+ * ret = handle_pool_create(8, sizeof(camera_t*), alignof(camera_t*), &handle_pool);
+ * @endcode
+ *
+ * @param[in] max_element_count_ 要素を格納可能な最大個数
+ * @param[in] element_size_ 格納する要素のサイズ
+ * @param[in] element_align_ 格納する要素のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[out] handle_pool_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval HANDLE_POOL_INVALID_ARGUMENT 以下のいずれか
+ * - handle_pool_ == NULL
+ * - *handle_pool_ != NULL
+ * - 0 == max_element_count_
+ * - max_element_count_ > HANDLE_POOL_MAX_ELEMENT_COUNT
+ * - 0 == element_size_
+ * - element_align_が2の冪乗ではない
+ * - element_align_がmax_align_tを超過
+ * @retval HANDLE_POOL_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval HANDLE_POOL_NO_MEMORY メモリ不足によりメモリ確保失敗
+ * @retval HANDLE_POOL_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval HANDLE_POOL_BAD_OPERATION メモリシステム未初期化
+ * @retval HANDLE_POOL_SUCCESS 初期化に成功し、正常終了
+ */
+handle_pool_result_t handle_pool_create(size_t max_element_count_, size_t element_size_, size_t element_align_, handle_pool_t** handle_pool_);
+
+/**
+ * @brief handle_pool_が管理しているメモリと自身のメモリを解放し、*handle_pool_=NULLにする
+ *
+ * @warning 内部データが破損している場合には要素配列等の破棄は行わず、メモリリークとなる
+ *
+ * @note
+ * - 2重デストロイ許可
+ * - handle_pool_ == NULLの場合はno-op
+ * - *handle_pool_ == NULLの場合はno-op
+ * - 格納している要素が保持するリソースの破棄は行わないため、呼び出し側で事前に破棄すること
+ *
+ * @param[in,out] handle_pool_ メモリ破棄対象構造体インスタンスへのダブルポインタ
+ */
+void handle_pool_destroy(handle_pool_t** handle_pool_);
+
+/**
+ * @brief data_の内容をhandle_pool_に登録し、要素を参照するハンドルを取得する
+ *
+ * @note 空きスロットは最後に登録解除したスロットから再利用する(再利用時は登録解除時に進めた世代のハンドルを払い出す)
+ *
+ * 使用例:
+ * @code{.c}
+ * handle_pool_handle_t handle = { 0 };
+ * camera_t* camera = ...;
+ *
+ * ret = handle_pool_register(&camera, handle_pool, &handle);
+ * @endcode
+ *
+ * @param[in] data_ 登録するデータへのポインタ(create時に指定したelement_size_分をコピーする)
+ * @param[in,out] handle_pool_ 登録先ハンドルプール構造体インスタンスへのポインタ
+ * @param[out] out_handle_ 登録した要素を参照するハンドル格納先
+ *
+ * @retval HANDLE_POOL_INVALID_ARGUMENT 以下のいずれか
+ * - data_ == NULL
+ * - handle_pool_ == NULL
+ * - out_handle_ == NULL
+ * @retval HANDLE_POOL_DATA_CORRUPTED ハンドルプール内部データ破損
+ * @retval HANDLE_POOL_LIMIT_EXCEEDED 空きスロットがない
+ * @retval HANDLE_POOL_SUCCESS 登録に成功し、正常終了
+ */
+handle_pool_result_t handle_pool_register(const void* data_, handle_pool_t* handle_pool_, handle_pool_handle_t* out_handle_);
+
+/**
+ * @brief handle_が参照する要素をhandle_pool_から登録解除する
+ *
+ * @note
+ * - handle_のスロットの世代を進めるため、以降handle_(とそのコピー)は全て無効なハンドルとなる
+ * - 要素配列の末尾の要素を登録解除した要素の位置に移動する(移動した要素のハンドルは変化しない)
+ *
+ * @param[in] handle_ 登録解除対象要素のハンドル
+ * @param[in,out] handle_pool_ 処理対象ハンドルプール構造体インスタンスへのポインタ
+ *
+ * @retval HANDLE_POOL_INVALID_ARGUMENT 以下のいずれか
+ * - handle_pool_ == NULL
+ * - handle_.generation == 0
+ * - handle_.indexがハンドルプールの容量を超過
+ * @retval HANDLE_POOL_DATA_CORRUPTED ハンドルプール内部データ破損
+ * @retval HANDLE_POOL_STALE_HANDLE handle_が登録解除済み
+ * @retval HANDLE_POOL_SUCCESS 登録解除に成功し、正常終了
+ */
+handle_pool_result_t handle_pool_unregister(handle_pool_handle_t handle_, handle_pool_t* handle_pool_);
+
+/**
+ * @brief handle_が参照する要素の格納先アドレスを取得する
+ *
+ * @warning 取得したアドレスは、以降のhandle_pool_unregister呼び出しで別の要素の格納先となる場合があるため、保持せずにハンドルで参照し直すこと
+ *
+ * @param[in] handle_ 取得対象要素のハンドル
+ * @param[in] handle_pool_ 取得元ハンドルプール構造体インスタンスへのポインタ
+ * @param[out] out_element_ 要素の格納先アドレス格納先
+ *
+ * @retval HANDLE_POOL_INVALID_ARGUMENT 以下のいずれか
+ * - handle_pool_ == NULL
+ * - out_element_ == NULL
+ * - handle_.generation == 0
+ * - handle_.indexがハンドルプールの容量を超過
+ * @retval HANDLE_POOL_DATA_CORRUPTED ハンドルプール内部データ破損
+ * @retval HANDLE_POOL_STALE_HANDLE handle_が登録解除済み
+ * @retval HANDLE_POOL_SUCCESS 取得に成功し、正常終了
+ */
+handle_pool_result_t handle_pool_get(handle_pool_handle_t handle_, const handle_pool_t* handle_pool_, void** out_element_);
+
+/**
+ * @brief handle_が登録中の要素を参照しているかを判定する
+ *
+ * @note handle_pool_ == NULLの場合はfalseを返す
+ *
+ * @param[in] handle_ 判定対象ハンドル
+ * @param[in] handle_pool_ 判定対象ハンドルプール構造体インスタンスへのポインタ
+ *
+ * @retval true handle_は登録中の要素を参照している
+ * @retval false handle_は無効、または登録解除済み
+ */
+bool handle_pool_valid(handle_pool_handle_t handle_, const handle_pool_t* handle_pool_);
+
+/**
+ * @brief handle_pool_に登録中の要素数を取得する
+ *
+ * @param[in] handle_pool_ 取得対象ハンドルプール構造体インスタンスへのポインタ
+ *
+ * @return size_t 登録中の要素数(handle_pool_ == NULLの場合は0)
+ */
+size_t handle_pool_count(const handle_pool_t* handle_pool_);
+
+/**
+ * @brief 要素配列のdense_index_番目の要素の格納先アドレスとハンドルを取得する(登録中の要素の走査用)
+ *
+ * @note
+ * - 登録中の要素は要素配列の0 .. handle_pool_count() - 1に詰めて格納されている
+ * - 走査中に登録解除を行う場合は、末尾の要素が移動してくるため末尾から走査すること
+ *
+ * 使用例:
+ * @code{.c}
+ * for(size_t i = 0; i != handle_pool_count(handle_pool); ++i) {
+ *     camera_t** camera = NULL;
+ *     handle_pool_at(i, handle_pool, (void**)&camera, NULL);
+ * }
+ * @endcode
+ *
+ * @param[in] dense_index_ 要素配列のインデックス
+ * @param[in] handle_pool_ 取得元ハンドルプール構造体インスタンスへのポインタ
+ * @param[out] out_element_ 要素の格納先アドレス格納先
+ * @param[out] out_handle_ 要素のハンドル格納先(NULLの場合は取得しない)
+ *
+ * @retval HANDLE_POOL_INVALID_ARGUMENT 以下のいずれか
+ * - handle_pool_ == NULL
+ * - out_element_ == NULL
+ * - dense_index_ >= handle_pool_count(handle_pool_)
+ * @retval HANDLE_POOL_DATA_CORRUPTED ハンドルプール内部データ破損
+ * @retval HANDLE_POOL_SUCCESS 取得に成功し、正常終了
+ */
+handle_pool_result_t handle_pool_at(size_t dense_index_, const handle_pool_t* handle_pool_, void** out_element_, handle_pool_handle_t* out_handle_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
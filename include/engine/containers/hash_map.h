@@ -0,0 +1,271 @@
+/** @ingroup containers
+ *
+ * @file hash_map.h
+ * @author chocolate-pie24
+ * @brief キーと値を内部に直接格納する、容量固定のジェネリック型ハッシュマップモジュールを提供する
+ *
+ * @details
+ * テクスチャ名、カメラ名等のアトムからリソースIDへの対応付けのように、キーからの値の検索をO(1)で行うためのオープンアドレス法のハッシュマップ。特徴は、
+ *
+ * - 衝突解決にはRobin Hood hashingを採用し、挿入時に探索距離(理想位置からの距離)の短いエントリを後ろへ押し出すことで、探索距離のばらつきを抑える
+ * - 各バケットの探索距離とハッシュ値はキー/値とは別のメタデータ配列に格納し、探索中のキー比較はハッシュ値が一致した場合のみ行う
+ * - 探索中に探索距離が自身より短いエントリに到達した時点で、キーが存在しないことが確定する(全バケットを走査しない)
+ * - 削除時は後続のエントリを1つずつ前に詰める(backward shift deletion)ため、墓標(tombstone)を使用せず、削除を繰り返しても探索性能が劣化しない
+ * - 容量は生成時に固定し、再ハッシュは行わない。バケット数は最大エントリ数に対して負荷率が7/8以下となる2のべき乗とし、インデックスの折り返しはマスク演算で行う
+ *
+ * メモリは、メモリシステムから確保する方法(@ref hash_map_create)と、リニアアロケータから確保する方法(@ref hash_map_initialize)を選択できる。
+ *
+ * @note
+ * hash_map_t構造体は、内部データを隠蔽している。
+ * このため、hash_map_t型で変数を宣言することはできない。
+ * 使用の際は、hash_map_t*型で宣言すること
+ *
+ * @note
+ * hash_map_tに格納できるキー/値には、ring_queue_tと同様に下記の制約を設ける
+ * - 格納するデータのアライメント要件は2のべき乗であること
+ * - 格納するデータのアライメント要件はmax_align_t以下であること
+ *
+ * また、キーのハッシュ値計算と比較はキーのバイト列に対して行うため、キーにはパディングを含まない型(整数型、アトム等)を使用すること
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_HASH_MAP_H
+#define GLCE_ENGINE_CONTAINERS_HASH_MAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "engine/core/memory/linear_allocator.h"
+
+/**
+ * @brief hash_map_t前方宣言
+ *
+ */
+typedef struct hash_map hash_map_t;
+
+/**
+ * @brief ハッシュマップに格納可能なエントリ数の上限値
+ *
+ * @note バケット数(最大エントリ数の8/7倍以上の2のべき乗)と探索距離を32bitで管理するための制約
+ */
+#define HASH_MAP_MAX_ENTRY_COUNT ((size_t)1U << 30U)
+
+/**
+ * @brief ハッシュマップAPI実行結果コードリスト
+ *
+ */
+typedef enum {
+    HASH_MAP_SUCCESS = 0,       /**< 処理成功 */
+    HASH_MAP_INVALID_ARGUMENT,  /**< 無効な引数 */
+    HASH_MAP_NO_MEMORY,         /**< メモリ不足 */
+    HASH_MAP_RUNTIME_ERROR,     /**< 実行時エラー */
+    HASH_MAP_UNDEFINED_ERROR,   /**< 未定義エラー */
+    HASH_MAP_LIMIT_EXCEEDED,    /**< システム使用可能範囲上限超過 */
+    HASH_MAP_BAD_OPERATION,     /**< API誤用 */
+    HASH_MAP_DATA_CORRUPTED,    /**< 内部データ破損 */
+    HASH_MAP_OVERFLOW,          /**< 計算過程のオーバーフロー */
+    HASH_MAP_KEY_NOT_FOUND,     /**< キーが登録されていない */
+    HASH_MAP_KEY_EXISTS,        /**< キーが登録済み */
+} hash_map_result_t;
+
+/**
+ * @brief hash_map_のメモリをメモリシステムから確保し、最大エントリ数max_entry_count_で初期化する
+ *
+ * @note 初期化されたハッシュマップに格納するキー/値のサイズとアライメント要件はkey_size_,key_align_,value_size_,value_align_で固定化される
+ *
+ * 使用例:
+ * @code{.c}
+ * hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+ * hash_map_t* hash_map = NULL;
+ *
+ * // string_atom_tをキー、int16_tを値とするハッシュマップ初期化処理(最大エントリ数は1024)
+ * ret = hash_map_create(1024, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), &hash_map);
+ * @endcode
+ *
+ * @param[in] max_entry_count_ 格納可能な最大エントリ数
+ * @param[in] key_size_ キーのサイズ
+ * @param[in] key_align_ キーのアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[in] value_size_ 値のサイズ
+ * @param[in] value_align_ 値のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[out] hash_map_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 以下のいずれか
+ * - hash_map_ == NULL
+ * - *hash_map_ != NULL
+ * - 0 == max_entry_count_
+ * - max_entry_count_ > HASH_MAP_MAX_ENTRY_COUNT
+ * - 0 == key_size_ または 0 == value_size_
+ * - key_align_、value_align_が2の冪乗ではない
+ * - key_align_、value_align_がmax_align_tを超過
+ * @retval HASH_MAP_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval HASH_MAP_NO_MEMORY メモリ不足によりメモリ確保失敗
+ * @retval HASH_MAP_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval HASH_MAP_BAD_OPERATION メモリシステム未初期化
+ * @retval HASH_MAP_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see hash_map_destroy
+ */
+hash_map_result_t hash_map_create(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, hash_map_t** hash_map_);
+
+/**
+ * @brief hash_map_initializeでリニアアロケータから確保するメモリ量をメモリプール必要量io_pool_requirement_に加算する
+ *
+ * @note hash_map_initializeと同じ引数で呼び出し、リニアアロケータの初期化前に上位モジュールのpreinitから使用する
+ *
+ * @param[in] max_entry_count_ 格納可能な最大エントリ数
+ * @param[in] key_size_ キーのサイズ
+ * @param[in] key_align_ キーのアライメント要件
+ * @param[in] value_size_ 値のサイズ
+ * @param[in] value_align_ 値のアライメント要件
+ * @param[in,out] io_pool_requirement_ メモリプール必要量(byte)
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_requirement_ == NULL
+ * - max_entry_count_、キー/値のサイズ、アライメント要件がhash_map_createの制約を満たさない
+ * @retval HASH_MAP_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval HASH_MAP_SUCCESS 加算に成功し、正常終了
+ *
+ * @see hash_map_initialize
+ */
+hash_map_result_t hash_map_preinit(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, size_t* io_pool_requirement_);
+
+/**
+ * @brief hash_map_のメモリをリニアアロケータallocator_から確保し、最大エントリ数max_entry_count_で初期化する
+ *
+ * @note
+ * - 必要なメモリ量は事前に@ref hash_map_preinit でメモリプール必要量に加算しておくこと
+ * - リニアアロケータから確保したメモリは個別に解放できないため、処理が失敗した場合でも確保済みのメモリはリニアアロケータに残る
+ *
+ * @param[in] max_entry_count_ 格納可能な最大エントリ数
+ * @param[in] key_size_ キーのサイズ
+ * @param[in] key_align_ キーのアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[in] value_size_ 値のサイズ
+ * @param[in] value_align_ 値のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[in,out] allocator_ メモリ確保に使用するリニアアロケータ
+ * @param[out] hash_map_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - hash_map_ == NULL
+ * - *hash_map_ != NULL
+ * - max_entry_count_、キー/値のサイズ、アライメント要件がhash_map_createの制約を満たさない
+ * @retval HASH_MAP_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval HASH_MAP_NO_MEMORY リニアアロケータの容量不足
+ * @retval HASH_MAP_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see hash_map_preinit
+ */
+hash_map_result_t hash_map_initialize(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, linear_alloc_t* allocator_, hash_map_t** hash_map_);
+
+/**
+ * @brief hash_map_が管理しているメモリと自身のメモリを解放し、*hash_map_=NULLにする
+ *
+ * @warning 内部データが破損している場合にはバケット配列等の破棄は行わず、メモリリークとなる
+ *
+ * @note
+ * - 2重デストロイ許可
+ * - hash_map_ == NULLの場合はno-op
+ * - *hash_map_ == NULLの場合はno-op
+ * - @ref hash_map_initialize で初期化したハッシュマップはメモリを解放せず、*hash_map_=NULLのみを行う(メモリはリニアアロケータごと破棄される)
+ *
+ * @param[in,out] hash_map_ メモリ破棄対象構造体インスタンスへのダブルポインタ
+ */
+void hash_map_destroy(hash_map_t** hash_map_);
+
+/**
+ * @brief キーkey_と値value_の組をhash_map_に登録する
+ *
+ * @note 登録によって既存のエントリの格納位置が移動するため、@ref hash_map_find で取得した値へのポインタは無効になる
+ *
+ * @param[in] key_ 登録するキーへのポインタ(hash_map_生成時のキーサイズ分コピーされる)
+ * @param[in] value_ 登録する値へのポインタ(hash_map_生成時の値サイズ分コピーされる)
+ * @param[in,out] hash_map_ 登録先ハッシュマップ構造体インスタンスへのポインタ
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 以下のいずれか
+ * - key_ == NULL
+ * - value_ == NULL
+ * - hash_map_ == NULL
+ * @retval HASH_MAP_DATA_CORRUPTED ハッシュマップ内部データ破損
+ * @retval HASH_MAP_KEY_EXISTS key_が登録済み(ハッシュマップは変更されない)
+ * @retval HASH_MAP_LIMIT_EXCEEDED 登録済みのエントリ数が最大エントリ数に到達している
+ * @retval HASH_MAP_SUCCESS 登録に成功し、正常終了
+ */
+hash_map_result_t hash_map_insert(const void* key_, const void* value_, hash_map_t* hash_map_);
+
+/**
+ * @brief キーkey_に対応する値をhash_map_から検索する
+ *
+ * 使用例:
+ * @code{.c}
+ * int16_t* id = NULL;
+ * if(HASH_MAP_SUCCESS == hash_map_find(&atom, hash_map, (void**)&id)) {
+ *     // *idがatomに対応する値
+ * }
+ * @endcode
+ *
+ * @note
+ * - 取得したポインタはハッシュマップ内部の値を直接指すため、値の書き換えに使用できる
+ * - 取得したポインタは次の@ref hash_map_insert 、@ref hash_map_remove 、@ref hash_map_clear の呼び出しで無効になる
+ * - キーの存在確認に使用することも考慮し、キーが見つからない場合はエラーメッセージを出力しない
+ *
+ * @param[in] key_ 検索するキーへのポインタ
+ * @param[in] hash_map_ 検索対象ハッシュマップ構造体インスタンスへのポインタ
+ * @param[out] out_value_ 見つかった値へのポインタの格納先
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 以下のいずれか
+ * - key_ == NULL
+ * - hash_map_ == NULL
+ * - out_value_ == NULL
+ * @retval HASH_MAP_DATA_CORRUPTED ハッシュマップ内部データ破損
+ * @retval HASH_MAP_KEY_NOT_FOUND key_が登録されていない(*out_value_は変更されない)
+ * @retval HASH_MAP_SUCCESS 検索に成功し、正常終了
+ */
+hash_map_result_t hash_map_find(const void* key_, const hash_map_t* hash_map_, void** out_value_);
+
+/**
+ * @brief キーkey_のエントリをhash_map_から削除する
+ *
+ * @param[in] key_ 削除するキーへのポインタ
+ * @param[in,out] hash_map_ 削除対象ハッシュマップ構造体インスタンスへのポインタ
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 以下のいずれか
+ * - key_ == NULL
+ * - hash_map_ == NULL
+ * @retval HASH_MAP_DATA_CORRUPTED ハッシュマップ内部データ破損
+ * @retval HASH_MAP_KEY_NOT_FOUND key_が登録されていない
+ * @retval HASH_MAP_SUCCESS 削除に成功し、正常終了
+ */
+hash_map_result_t hash_map_remove(const void* key_, hash_map_t* hash_map_);
+
+/**
+ * @brief hash_map_の全エントリを削除する
+ *
+ * @note hash_map_ == NULLの場合はno-op
+ *
+ * @param[in,out] hash_map_ 対象ハッシュマップ構造体インスタンスへのポインタ
+ */
+void hash_map_clear(hash_map_t* hash_map_);
+
+/**
+ * @brief hash_map_に登録されているエントリ数を取得する
+ *
+ * @param[in] hash_map_ 対象ハッシュマップ構造体インスタンスへのポインタ
+ *
+ * @return size_t 登録されているエントリ数(hash_map_ == NULLの場合は0)
+ */
+size_t hash_map_count(const hash_map_t* hash_map_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,168 @@
+/** @ingroup containers
+ *
+ * @file mpmc_ring_queue.h
+ * @author chocolate-pie24
+ * @brief 複数プロデューサ/複数コンシューマ(MPMC)間でグローバルなロックを使用せずにデータを受け渡す、容量固定のジェネリック型リングキューモジュールを提供する
+ *
+ * @details
+ * ローダースレッド群からメインスレッドへの完了通知や、複数の投入元からワーカープールへのジョブ投入に使用するリングキュー。
+ * D. Vyukovのbounded MPMC queueの方式を採用しており、特徴は、
+ *
+ * - 各スロットにシーケンス番号を持たせ、シーケンス番号と投入/取り出し位置の比較でスロットの状態(書き込み可能/読み出し可能)を判定する
+ * - 投入位置(enqueue_pos)、取り出し位置(dequeue_pos)の確保はそれぞれ1回のCAS(compare-and-swap)で行い、ロックを使用しない
+ * - スロットへの書き込み完了はシーケンス番号のreleaseストアで公開し、読み出し側はacquireロードで確認してから読み出す
+ * - enqueue_pos、dequeue_posはそれぞれ別のキャッシュラインに配置し、プロデューサ/コンシューマ間のフォルスシェアリングを防ぐ
+ *
+ * 格納するデータのサイズ、アライメント要件の扱いおよび実行結果コード(ring_queue_result_t)はring_queue_tと共通とする。
+ *
+ * @note
+ * mpmc_ring_queue_t構造体は、内部データを隠蔽している。
+ * このため、mpmc_ring_queue_t型で変数を宣言することはできない。
+ * 使用の際は、mpmc_ring_queue_t*型で宣言すること
+ *
+ * @note
+ * - 格納可能な最大要素数は2以上の2のべき乗でなければならない(位置からスロットインデックスへの変換をマスク演算で行い、位置のラップアラウンド時もスロットの対応関係を保つため)
+ * - ring_queue_tと異なり、満杯時に最古のデータを上書きすることはしない。満杯時のpushはRING_QUEUE_FULLを返す
+ *
+ * @par スレッド安全性
+ * - mpmc_ring_queue_push、mpmc_ring_queue_popは任意のスレッドから並行して呼び出すことができる
+ * - mpmc_ring_queue_create/mpmc_ring_queue_destroyは、他のスレッドがキューを使用していない状態で呼び出すこと
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_MPMC_RING_QUEUE_H
+#define GLCE_ENGINE_CONTAINERS_MPMC_RING_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "engine/containers/ring_queue.h"
+
+/**
+ * @brief mpmc_ring_queue_t前方宣言
+ *
+ */
+typedef struct mpmc_ring_queue mpmc_ring_queue_t;
+
+/**
+ * @brief mpmc_ring_queue_のメモリを確保し、容量max_element_count_で初期化する
+ *
+ * @note 初期化されたリングキューに格納するデータのサイズとアライメント要件はelement_size_,element_align_で固定化される
+ *
+ * 使用例:
+ * @code{.c}
+ * ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+ * mpmc_ring_queue_t* queue = NULL;
+ *
+ * // load_result_t型のデータを格納するMPMCリングキュー初期化処理(格納要素数は256)
+ * ret = mpmc_ring_queue_create(256, sizeof(load_result_t), alignof(load_result_t), &queue);
+ * @endcode
+ *
+ * @param[in] max_element_count_ 要素を格納可能な最大個数(2以上の2のべき乗でなければいけない)
+ * @param[in] element_size_ 格納する要素のサイズ
+ * @param[in] element_align_ 格納する要素のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[out] mpmc_ring_queue_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - mpmc_ring_queue_ == NULL
+ * - *mpmc_ring_queue_ != NULL
+ * - max_element_count_ < 2(1スロットではシーケンス番号で空きスロットと格納済みスロットを区別できない)
+ * - max_element_count_が2のべき乗ではない
+ * - element_size_ == 0
+ * - element_align_ == 0
+ * - element_align_が2のべき乗ではない
+ * - element_align_がmax_align_tを超過
+ * @retval RING_QUEUE_OVERFLOW 必要メモリ量の計算過程でオーバーフローが発生
+ * @retval RING_QUEUE_NO_MEMORY メモリ確保に失敗
+ * @retval RING_QUEUE_LIMIT_EXCEEDED メモリシステムの使用可能範囲上限を超過
+ * @retval RING_QUEUE_RUNTIME_ERROR 確保したメモリのアライメントが不正
+ * @retval RING_QUEUE_UNDEFINED_ERROR 想定していない実行結果コードを処理過程で受け取った
+ * @retval RING_QUEUE_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see mpmc_ring_queue_destroy
+ */
+ring_queue_result_t mpmc_ring_queue_create(size_t max_element_count_, size_t element_size_, size_t element_align_, mpmc_ring_queue_t** mpmc_ring_queue_);
+
+/**
+ * @brief mpmc_ring_queue_が管理するメモリを解放し、*mpmc_ring_queue_をNULLにする
+ *
+ * @note
+ * - mpmc_ring_queue_ == NULLまたは*mpmc_ring_queue_ == NULLの場合は何もしない
+ * - 2重デストロイ許可
+ *
+ * @param[in,out] mpmc_ring_queue_ 破棄対象構造体インスタンスへのダブルポインタ
+ */
+void mpmc_ring_queue_destroy(mpmc_ring_queue_t** mpmc_ring_queue_);
+
+/**
+ * @brief mpmc_ring_queue_にdata_をpushする
+ *
+ * 使用例:
+ * @code{.c}
+ * // ローダースレッド
+ * load_result_t result = load_texture(path);
+ * if(RING_QUEUE_FULL == mpmc_ring_queue_push(&result, sizeof(load_result_t), alignof(load_result_t), queue)) {
+ *     // メインスレッドが取り出すまで待つ
+ * }
+ * @endcode
+ *
+ * @param[in] data_ 格納データへのポインタ
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] mpmc_ring_queue_ データをpushするリングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - mpmc_ring_queue_ == NULL
+ * - data_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がmpmc_ring_queue_createを実行した時の値と異なる
+ * - element_align_がmpmc_ring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_FULL リングキューが満杯(データは格納されない)
+ * @retval RING_QUEUE_SUCCESS データの格納に成功し、正常終了
+ */
+ring_queue_result_t mpmc_ring_queue_push(const void* data_, size_t element_size_, size_t element_align_, mpmc_ring_queue_t* mpmc_ring_queue_);
+
+/**
+ * @brief mpmc_ring_queue_から最古のデータをpopしてdata_に格納する
+ *
+ * 使用例:
+ * @code{.c}
+ * // メインスレッド
+ * load_result_t result;
+ * while(RING_QUEUE_SUCCESS == mpmc_ring_queue_pop(sizeof(load_result_t), alignof(load_result_t), queue, &result)) {
+ *     // resultを処理
+ * }
+ * @endcode
+ *
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] mpmc_ring_queue_ データをpopするリングキュー構造体インスタンスへのポインタ
+ * @param[out] data_ popしたデータの格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - mpmc_ring_queue_ == NULL
+ * - data_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がmpmc_ring_queue_createを実行した時の値と異なる
+ * - element_align_がmpmc_ring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_EMPTY リングキューが空
+ * @retval RING_QUEUE_SUCCESS データの取得に成功し、正常終了
+ */
+ring_queue_result_t mpmc_ring_queue_pop(size_t element_size_, size_t element_align_, mpmc_ring_queue_t* mpmc_ring_queue_, void* data_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -18,6 +18,11 @@
  * @note
  * ring_queue_tはジェネリック型のデータを格納可能であるが、複数のデータ型を混在して格納することはできない
  *
+ * @note
+ * 最大要素数が2のべき乗の場合、head/tailの折り返しは剰余演算ではなくマスク演算で行う。
+ * ring_queue_create_pow2を使用すると最大要素数を2のべき乗に切り上げて初期化できる。
+ * また、要素型ごとにサイズ/アライメント要件をコンパイル時に固定した型付きラッパーをring_queue_typed.hのRING_QUEUE_DEFINE_TYPEDで生成できる。
+ *
  * @version 0.1
  * @date 2025-10-14
  *
@@ -58,8 +63,32 @@ typedef enum {
     RING_QUEUE_DATA_CORRUPTED,      /**< 内部データ破損 */
     RING_QUEUE_OVERFLOW,            /**< 計算過程のオーバーフロー */
     RING_QUEUE_EMPTY,               /**< リングキューが空 */
+    RING_QUEUE_FULL,                /**< リングキューが満杯(上書きを行わないキューのみ) */
 } ring_queue_result_t;
 
+/**
+ * @brief リングキューが満杯の時にpushされた場合の動作(溢れポリシー)リスト
+ *
+ */
+typedef enum {
+    RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST = 0,    /**< 最古のデータを捨てて新しいデータを格納する(デフォルト) */
+    RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST,           /**< 新しいデータを捨て、RING_QUEUE_FULLを返す */
+    RING_QUEUE_OVERFLOW_POLICY_GROW,                    /**< 上限要素数まで最大要素数を倍々に拡張する。上限に達した後はRING_QUEUE_OVERFLOW_POLICY_REJECT_NEWESTと同じ動作となる */
+} ring_queue_overflow_policy_t;
+
+/**
+ * @brief リングキューの使用状況統計情報
+ *
+ * @note 統計情報はring_queue_create、またはring_queue_stats_resetの実行時点からの累積値
+ */
+typedef struct ring_queue_stats {
+    size_t push_count;          /**< キューに格納された要素数(コミットを含む) */
+    size_t drop_count;          /**< 溢れポリシーにより捨てられた要素数(上書きされた最古のデータ、または拒否された新しいデータ) */
+    size_t peak_len;            /**< 格納要素数の最大値 */
+    size_t grow_count;          /**< RING_QUEUE_OVERFLOW_POLICY_GROWによる拡張回数 */
+    size_t max_element_count;   /**< 現在の最大要素数(拡張後の値) */
+} ring_queue_stats_t;
+
 /**
  * @brief ring_queue_のメモリを確保し、容量max_element_count_で初期化する
  *
@@ -94,6 +123,32 @@ typedef enum {
  */
 ring_queue_result_t ring_queue_create(size_t max_element_count_, size_t element_size_, size_t element_align_, ring_queue_t** ring_queue_);
 
+/**
+ * @brief max_element_count_以上の最小の2のべき乗を最大要素数としてring_queue_を初期化する
+ *
+ * @note 最大要素数が2のべき乗となるため、push/popでのインデックス更新はマスク演算で行われる
+ *
+ * 使用例:
+ * @code{.c}
+ * ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+ * ring_queue_t* ring_queue = NULL;
+ *
+ * // 最大要素数は100を切り上げた128となる
+ * ret = ring_queue_create_pow2(100, sizeof(mouse_event_t), alignof(mouse_event_t), &ring_queue);
+ * @endcode
+ *
+ * @param[in] max_element_count_ 要素を格納可能な最大個数の下限値
+ * @param[in] element_size_ 格納する要素のサイズ
+ * @param[in] element_align_ 格納する要素のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[out] ring_queue_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval RING_QUEUE_OVERFLOW max_element_count_を2のべき乗に切り上げるとsize_tの範囲を超える
+ * @retval 上記以外 ring_queue_createの実行結果コードに準ずる
+ *
+ * @see ring_queue_create
+ */
+ring_queue_result_t ring_queue_create_pow2(size_t max_element_count_, size_t element_size_, size_t element_align_, ring_queue_t** ring_queue_);
+
 /**
  * @brief ring_queue_が管理しているメモリと自身のメモリを解放し、*ring_queue_=NULLにする
  *
@@ -123,9 +178,11 @@ void ring_queue_destroy(ring_queue_t** ring_queue_);
 /**
  * @brief ring_queue_にdata_をpushする
  *
- * @note キューが満杯だった場合は以下の動作となる、
- * - ワーニングメッセージを出力する(DEBUG_BUILD,TEST_BUILD時のみ)
- * - 最古のデータを捨てて新しいデータを格納する(返り値はRING_QUEUE_SUCCESS)
+ * @note キューが満杯だった場合は溢れポリシー(ring_queue_set_overflow_policy参照)に従う
+ * - RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST: 最古のデータを捨てて新しいデータを格納する(返り値はRING_QUEUE_SUCCESS)
+ * - RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST: data_を格納せずにRING_QUEUE_FULLを返す
+ * - RING_QUEUE_OVERFLOW_POLICY_GROW: 最大要素数を拡張して格納する。上限に達している場合はRING_QUEUE_FULLを返す
+ * - 捨てた要素はring_queue_stats_t::drop_countに計上され、メッセージは統計リセット後の最初の1回のみ出力する(DEBUG_BUILD,TEST_BUILD時のみ)
  *
  * @param[in] data_ 格納データへのポインタ
  * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
@@ -138,6 +195,14 @@ void ring_queue_destroy(ring_queue_t** ring_queue_);
  * - データ格納キューが未初期化
  * - element_size_がring_queue_createを実行した時の値と異なる
  * - element_align_がring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - ring_queue_reserveで予約したスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
+ * @retval RING_QUEUE_FULL 溢れポリシーにより新しいデータが拒否された
+ * @retval RING_QUEUE_OVERFLOW 拡張後の必要メモリ量の計算過程でオーバーフローが発生(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_NO_MEMORY 拡張のためのメモリ確保に失敗(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_LIMIT_EXCEEDED 拡張によりメモリシステムの使用可能範囲上限を超過(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
  * @retval RING_QUEUE_SUCCESS          データの格納に成功し、正常終了(キューが満杯で古いデータを捨てて新しいデータを格納した場合でも成功となる)
  */
 ring_queue_result_t ring_queue_push(const void* data_, size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_);
@@ -156,11 +221,319 @@ ring_queue_result_t ring_queue_push(const void* data_, size_t element_size_, siz
  * - データ格納キューが未初期化
  * - element_size_がring_queue_createを実行した時の値と異なる
  * - element_align_がring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - ring_queue_reserveで予約したスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
  * @retval RING_QUEUE_EMPTY            ring_queueが空
  * @retval RING_QUEUE_SUCCESS          データの取得に成功し、正常終了
  */
 ring_queue_result_t ring_queue_pop(size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, void* data_);
 
+/**
+ * @brief 引数と内部データのチェックを省略してring_queue_にdata_をpushする
+ *
+ * @note ring_queue_typed.hの型付きラッパーから呼び出すことを想定している。通常はring_queue_pushを使用すること
+ *
+ * @warning 以下は呼び出し側で保証すること(本関数ではチェックしない)
+ * - ring_queue_がring_queue_create/ring_queue_create_pow2で初期化済みであること
+ * - data_ != NULLであり、data_がcreate時に指定したサイズ/アライメント要件の型を指していること
+ *
+ * @param[in] data_ 格納データへのポインタ
+ * @param[in,out] ring_queue_ データをpushするリングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - ring_queue_reserveで予約したスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
+ * @retval RING_QUEUE_FULL 溢れポリシーにより新しいデータが拒否された
+ * @retval 上記以外 拡張時のエラーはring_queue_pushに準ずる(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_SUCCESS データの格納に成功し、正常終了
+ */
+ring_queue_result_t ring_queue_push_unchecked(const void* data_, ring_queue_t* ring_queue_);
+
+/**
+ * @brief 引数と内部データのチェックを省略してring_queue_からdata_にデータをpopする
+ *
+ * @note ring_queue_typed.hの型付きラッパーから呼び出すことを想定している。通常はring_queue_popを使用すること
+ *
+ * @warning 以下は呼び出し側で保証すること(本関数ではチェックしない)
+ * - ring_queue_がring_queue_create/ring_queue_create_pow2で初期化済みであること
+ * - data_ != NULLであり、data_がcreate時に指定したサイズ/アライメント要件の型を指していること
+ *
+ * @param[in,out] ring_queue_ データをpopするリングキュー構造体インスタンスへのポインタ
+ * @param[out] data_ popしたデータの格納先
+ *
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - ring_queue_reserveで予約したスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
+ * @retval RING_QUEUE_EMPTY リングキューが空
+ * @retval RING_QUEUE_SUCCESS データの取得に成功し、正常終了
+ */
+ring_queue_result_t ring_queue_pop_unchecked(ring_queue_t* ring_queue_, void* data_);
+
+/**
+ * @brief data_から最大count_個の要素をまとめてring_queue_にpushする
+ *
+ * @note
+ * - 引数チェック、内部データ破損チェックは1回のみ行い、要素のコピーはリングの折り返しを考慮して最大2回のmemcpyで行う(パディングが必要な要素を除く)
+ * - count_ == 0の場合はワーニングメッセージを出力し、何もしない(返り値はRING_QUEUE_SUCCESS)
+ * - キューに収まらない場合は、溢れポリシーに従う
+ *   - RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST: 最古のデータから捨てて新しいデータを格納する(count_がキューの容量を超える場合は、data_の末尾の容量分のみが格納される)
+ *   - RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST: data_の先頭から空き容量分のみを格納し、残りを捨ててRING_QUEUE_FULLを返す
+ *   - RING_QUEUE_OVERFLOW_POLICY_GROW: 上限要素数まで拡張して格納し、それでも収まらない分はRING_QUEUE_OVERFLOW_POLICY_REJECT_NEWESTと同様に扱う
+ *
+ * 使用例:
+ * @code{.c}
+ * const keyboard_event_t events[4] = { ... };
+ * ret = ring_queue_push_n(events, 4, sizeof(keyboard_event_t), alignof(keyboard_event_t), ring_queue);
+ * @endcode
+ *
+ * @param[in] data_ 格納データ配列の先頭アドレス(element_size_の要素を隙間なく並べた配列)
+ * @param[in] count_ 格納データ数
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] ring_queue_ データをpushするリングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - data_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がring_queue_createを実行した時の値と異なる
+ * - element_align_がring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - ring_queue_reserveで予約したスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
+ * @retval RING_QUEUE_FULL 溢れポリシーにより一部、または全ての新しいデータが拒否された(収まった分は格納済み)
+ * @retval RING_QUEUE_OVERFLOW 拡張後の必要メモリ量の計算過程でオーバーフローが発生(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_NO_MEMORY 拡張のためのメモリ確保に失敗(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_LIMIT_EXCEEDED 拡張によりメモリシステムの使用可能範囲上限を超過(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_SUCCESS          データの格納に成功し、正常終了(古いデータを捨てて新しいデータを格納した場合でも成功となる)
+ */
+ring_queue_result_t ring_queue_push_n(const void* data_, size_t count_, size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_);
+
+/**
+ * @brief ring_queue_から最大max_count_個の要素をまとめてdata_にpopする
+ *
+ * @note 引数チェック、内部データ破損チェックは1回のみ行い、要素のコピーはリングの折り返しを考慮して最大2回のmemcpyで行う(パディングが必要な要素を除く)
+ *
+ * 使用例:
+ * @code{.c}
+ * keyboard_event_t events[16];
+ * size_t count = 0;
+ * while(RING_QUEUE_SUCCESS == ring_queue_pop_n(16, sizeof(keyboard_event_t), alignof(keyboard_event_t), ring_queue, events, &count)) {
+ *     for(size_t i = 0; i != count; ++i) {
+ *         // events[i]を処理
+ *     }
+ * }
+ * @endcode
+ *
+ * @param[in] max_count_ popする最大要素数(data_の格納可能要素数)
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] ring_queue_ データをpopするリングキュー構造体インスタンスへのポインタ
+ * @param[out] data_ popしたデータの格納先配列の先頭アドレス(element_size_の要素を隙間なく並べる)
+ * @param[out] out_count_ popした要素数の格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - data_ == NULL
+ * - out_count_ == NULL
+ * - max_count_ == 0
+ * - データ格納キューが未初期化
+ * - element_size_がring_queue_createを実行した時の値と異なる
+ * - element_align_がring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - ring_queue_reserveで予約したスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
+ * @retval RING_QUEUE_EMPTY            ring_queueが空(*out_count_ = 0)
+ * @retval RING_QUEUE_SUCCESS          1個以上のデータの取得に成功し、正常終了
+ */
+ring_queue_result_t ring_queue_pop_n(size_t max_count_, size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, void* data_, size_t* out_count_);
+
+/**
+ * @brief ring_queue_の次の格納先スロットを予約し、スロットのアドレスを*out_slot_に格納する
+ *
+ * @note
+ * - 呼び出し側は*out_slot_に要素を直接書き込み、ring_queue_commitで格納を確定させる(ring_queue_pushと異なり、呼び出し側で組み立てた要素のコピーが発生しない)
+ * - キューが満杯だった場合は、ring_queue_pushと同様に溢れポリシーに従ってスロットを確保する(拒否された場合はRING_QUEUE_FULL)
+ * - 予約からコミットまでの間は、ring_queue_commit、ring_queue_peek、ring_queue_empty以外の操作はRING_QUEUE_BAD_OPERATIONとなる
+ * - ring_queue_peekで参照した要素のリリース前に呼び出した場合はRING_QUEUE_BAD_OPERATIONとなる
+ * - 予約したスロットの内容は不定(以前に格納されていたデータが残っている)のため、呼び出し側で全体を書き込むこと
+ *
+ * 使用例:
+ * @code{.c}
+ * void* slot = NULL;
+ * ret = ring_queue_reserve(sizeof(sensor_frame_t), alignof(sensor_frame_t), ring_queue, &slot);
+ * if(RING_QUEUE_SUCCESS == ret) {
+ *     sensor_frame_t* frame = (sensor_frame_t*)slot;
+ *     sensor_read_frame(frame);   // スロットに直接書き込む
+ *     ret = ring_queue_commit(ring_queue);
+ * }
+ * @endcode
+ *
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] ring_queue_ スロットを予約するリングキュー構造体インスタンスへのポインタ
+ * @param[out] out_slot_ 予約したスロットのアドレス格納先(element_align_でアライメントされている)
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - out_slot_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がring_queue_createを実行した時の値と異なる
+ * - element_align_がring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION 以下のいずれか
+ * - 既に予約済みのスロットがコミットされていない
+ * - ring_queue_peekで参照した要素がリリースされていない
+ * @retval RING_QUEUE_FULL 溢れポリシーによりスロットの確保が拒否された
+ * @retval 上記以外 拡張時のエラーはring_queue_pushに準ずる(RING_QUEUE_OVERFLOW_POLICY_GROWのみ)
+ * @retval RING_QUEUE_SUCCESS          スロットの予約に成功し、正常終了(キューが満杯で古いデータを捨てた場合でも成功となる)
+ *
+ * @see ring_queue_commit
+ */
+ring_queue_result_t ring_queue_reserve(size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, void** out_slot_);
+
+/**
+ * @brief ring_queue_reserveで予約したスロットへの書き込みを確定させ、キューの末尾に追加する
+ *
+ * @param[in,out] ring_queue_ 処理対象リングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - データ格納キューが未初期化
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION 予約済みのスロットが存在しない
+ * @retval RING_QUEUE_SUCCESS          コミットに成功し、正常終了
+ *
+ * @see ring_queue_reserve
+ */
+ring_queue_result_t ring_queue_commit(ring_queue_t* ring_queue_);
+
+/**
+ * @brief ring_queue_の最古のデータをコピーせずに参照し、データのアドレスを*out_element_に格納する
+ *
+ * @note
+ * - 参照後にring_queue_releaseを呼び出すことでデータをキューから取り除く(ring_queue_popと異なり、データのコピーが発生しない)
+ * - 参照からリリースまでの間は、push/pop/reserve(ring_queue_typed.hの型付きラッパーを含む)はRING_QUEUE_BAD_OPERATIONとなる(満杯時の上書き、拡張による*out_element_の無効化を防ぐため)
+ * - *out_element_はring_queue_releaseを呼び出すまで有効。リリース前に再度呼び出した場合は同じアドレスを返す
+ *
+ * 使用例:
+ * @code{.c}
+ * const void* element = NULL;
+ * while(RING_QUEUE_SUCCESS == ring_queue_peek(sizeof(sensor_frame_t), alignof(sensor_frame_t), ring_queue, &element)) {
+ *     const sensor_frame_t* frame = (const sensor_frame_t*)element;
+ *     upload_frame(frame);    // キュー内のデータを直接参照する
+ *     ring_queue_release(ring_queue);
+ * }
+ * @endcode
+ *
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] ring_queue_ 参照対象リングキュー構造体インスタンスへのポインタ
+ * @param[out] out_element_ 最古のデータのアドレス格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - out_element_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がring_queue_createを実行した時の値と異なる
+ * - element_align_がring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_EMPTY            ring_queueが空
+ * @retval RING_QUEUE_SUCCESS          データの参照に成功し、正常終了
+ *
+ * @see ring_queue_release
+ */
+ring_queue_result_t ring_queue_peek(size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, const void** out_element_);
+
+/**
+ * @brief ring_queue_の最古のデータをコピーせずにキューから取り除く
+ *
+ * @note ring_queue_peekで参照したデータの使用完了後に呼び出す(参照中の状態はリリースにより解除される)
+ *
+ * @param[in,out] ring_queue_ 処理対象リングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - データ格納キューが未初期化
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_BAD_OPERATION ring_queue_reserveで予約したスロットがコミットされていない
+ * @retval RING_QUEUE_EMPTY            ring_queueが空
+ * @retval RING_QUEUE_SUCCESS          データの取り除きに成功し、正常終了
+ *
+ * @see ring_queue_peek
+ */
+ring_queue_result_t ring_queue_release(ring_queue_t* ring_queue_);
+
+/**
+ * @brief ring_queue_の溢れポリシーを設定する
+ *
+ * @note
+ * - ring_queue_create直後の溢れポリシーはRING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST
+ * - RING_QUEUE_OVERFLOW_POLICY_GROWの場合、拡張時は最大要素数を2倍(grow_limit_で頭打ち)にしてメモリプールを再確保し、格納済みの要素を先頭から詰め直す
+ * - 拡張によりメモリプールのアドレスが変わるため、ring_queue_peekで参照中(リリース前)のpush/reserveはRING_QUEUE_BAD_OPERATIONとなる
+ *
+ * 使用例:
+ * @code{.c}
+ * // 最大要素数128で作成し、入力バースト時は1024要素まで拡張する
+ * ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, 1024, ring_queue);
+ * @endcode
+ *
+ * @param[in] policy_ 溢れポリシー
+ * @param[in] grow_limit_ 拡張後の最大要素数の上限(RING_QUEUE_OVERFLOW_POLICY_GROWの場合のみ使用し、それ以外のポリシーでは無視される)
+ * @param[in,out] ring_queue_ 設定対象リングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - データ格納キューが未初期化
+ * - policy_が範囲外
+ * - policy_ == RING_QUEUE_OVERFLOW_POLICY_GROW かつ grow_limit_が現在の最大要素数未満
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_SUCCESS 設定に成功し、正常終了
+ */
+ring_queue_result_t ring_queue_set_overflow_policy(ring_queue_overflow_policy_t policy_, size_t grow_limit_, ring_queue_t* ring_queue_);
+
+/**
+ * @brief ring_queue_の使用状況統計情報を取得する
+ *
+ * @note 処理に失敗した場合、out_stats_は不変
+ *
+ * 使用例:
+ * @code{.c}
+ * ring_queue_stats_t stats;
+ * if(RING_QUEUE_SUCCESS == ring_queue_stats_get(mouse_event_queue, &stats)) {
+ *     INFO_MESSAGE("mouse events: peak %zu / %zu, dropped %zu", stats.peak_len, stats.max_element_count, stats.drop_count);
+ * }
+ * @endcode
+ *
+ * @param[in] ring_queue_ 取得対象リングキュー構造体インスタンスへのポインタ
+ * @param[out] out_stats_ 統計情報格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - out_stats_ == NULL
+ * - データ格納キューが未初期化
+ * @retval RING_QUEUE_SUCCESS 取得に成功し、正常終了
+ */
+ring_queue_result_t ring_queue_stats_get(const ring_queue_t* ring_queue_, ring_queue_stats_t* out_stats_);
+
+/**
+ * @brief ring_queue_の使用状況統計情報をリセットする
+ *
+ * @note push_count、drop_count、grow_countは0に、peak_lenは現在の格納要素数に戻る
+ *
+ * @param[in,out] ring_queue_ リセット対象リングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - ring_queue_ == NULL
+ * - データ格納キューが未初期化
+ * @retval RING_QUEUE_SUCCESS リセットに成功し、正常終了
+ */
+ring_queue_result_t ring_queue_stats_reset(ring_queue_t* ring_queue_);
+
 /**
  * @brief リングキューが空かを判定する
  *
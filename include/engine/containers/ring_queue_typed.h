@@ -0,0 +1,112 @@
+/** @ingroup containers
+ *
+ * @file ring_queue_typed.h
+ * @author chocolate-pie24
+ * @brief ring_queue_tを特定の要素型専用として扱う型付きラッパーを生成するマクロを提供する
+ *
+ * @details
+ * ring_queue_push/ring_queue_popは呼び出しごとに要素サイズ/アライメント要件の照合と内部データ破損チェックを行う。
+ * RING_QUEUE_DEFINE_TYPEDで生成したラッパーは、要素のサイズ/アライメント要件をsizeof/alignofでコンパイル時に固定し、
+ * 型付きのラッパー構造体でキューの取り違えを防ぐことで、push/popの呼び出しごとのチェックを省略する(ring_queue_push_unchecked/ring_queue_pop_uncheckedを使用)。
+ * キューの生成はring_queue_create_pow2で行うため、最大要素数は2のべき乗に切り上げられ、インデックスの折り返しはマスク演算で行われる。
+ *
+ * 使用例:
+ * @code{.c}
+ * // keyboard_event_queue_tと、keyboard_event_queue_create/destroy/push/pop/pop_n/emptyを生成する
+ * RING_QUEUE_DEFINE_TYPED(keyboard_event_queue, keyboard_event_t)
+ *
+ * keyboard_event_queue_t queue = { NULL };
+ * keyboard_event_t event;
+ * ret = keyboard_event_queue_create(64, &queue);
+ * ret = keyboard_event_queue_push(&event, &queue);
+ * ret = keyboard_event_queue_pop(&queue, &event);
+ * keyboard_event_queue_destroy(&queue);
+ * @endcode
+ *
+ * @note
+ * 生成されるpush/pop関数はキューが初期化済みであることを前提とし、引数のNULLチェックを行わない。
+ * create/destroy以外の関数はラッパー構造体へのポインタがNULLでないことを前提とする。
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_RING_QUEUE_TYPED_H
+#define GLCE_ENGINE_CONTAINERS_RING_QUEUE_TYPED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "engine/containers/ring_queue.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+  /**
+   * @brief 型付きラッパー関数の修飾子(使用されない関数があっても警告を出さない)
+   *
+   */
+  #define RING_QUEUE_TYPED_FUNC static inline __attribute__((unused))
+#else
+  /**
+   * @brief 型付きラッパー関数の修飾子
+   *
+   */
+  #define RING_QUEUE_TYPED_FUNC static inline
+#endif
+
+/**
+ * @brief type_型専用のリングキューラッパー型name_##_tと、その操作関数群を生成する
+ *
+ * 生成される型/関数:
+ * - name_##_t: ring_queue_t*を保持するラッパー構造体
+ * - name_##_create(max_element_count_, queue_): ring_queue_create_pow2で初期化する(queue_->queueはNULLであること)
+ * - name_##_destroy(queue_): ring_queue_destroyで破棄する
+ * - name_##_push(data_, queue_): チェックを省略してpushする
+ * - name_##_pop(queue_, data_): チェックを省略してpopする
+ * - name_##_pop_n(max_count_, queue_, data_, out_count_): ring_queue_pop_nでまとめてpopする(チェックはバッチ単位で1回)
+ * - name_##_empty(queue_): ring_queue_emptyで空かを判定する
+ *
+ * @param name_ 生成する型/関数名のプレフィックス
+ * @param type_ 格納する要素型
+ */
+#define RING_QUEUE_DEFINE_TYPED(name_, type_) \
+    typedef struct name_ { \
+        ring_queue_t* queue; \
+    } name_##_t; \
+    RING_QUEUE_TYPED_FUNC ring_queue_result_t name_##_create(size_t max_element_count_, name_##_t* queue_) { \
+        if(NULL == queue_) { \
+            return RING_QUEUE_INVALID_ARGUMENT; \
+        } \
+        return ring_queue_create_pow2(max_element_count_, sizeof(type_), alignof(type_), &queue_->queue); \
+    } \
+    RING_QUEUE_TYPED_FUNC void name_##_destroy(name_##_t* queue_) { \
+        if(NULL != queue_) { \
+            ring_queue_destroy(&queue_->queue); \
+        } \
+    } \
+    RING_QUEUE_TYPED_FUNC ring_queue_result_t name_##_push(const type_* data_, name_##_t* queue_) { \
+        return ring_queue_push_unchecked(data_, queue_->queue); \
+    } \
+    RING_QUEUE_TYPED_FUNC ring_queue_result_t name_##_pop(name_##_t* queue_, type_* data_) { \
+        return ring_queue_pop_unchecked(queue_->queue, data_); \
+    } \
+    RING_QUEUE_TYPED_FUNC ring_queue_result_t name_##_pop_n(size_t max_count_, name_##_t* queue_, type_* data_, size_t* out_count_) { \
+        return ring_queue_pop_n(max_count_, sizeof(type_), alignof(type_), queue_->queue, data_, out_count_); \
+    } \
+    RING_QUEUE_TYPED_FUNC bool name_##_empty(const name_##_t* queue_) { \
+        return ring_queue_empty(queue_->queue); \
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif
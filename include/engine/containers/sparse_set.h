@@ -0,0 +1,271 @@
+/** @ingroup containers
+ *
+ * @file sparse_set.h
+ * @author chocolate-pie24
+ * @brief 容量固定の整数ID集合を、登録中のIDを密に走査できる形で管理するスパースセットモジュールを提供する
+ *
+ * @details
+ * テクスチャ管理、カメラ管理のように、リソースを固定長配列のスロット(ID)で管理するシステムが、登録中のIDの払い出し/返却と、登録中のIDのみの走査を行うためのコンテナ。特徴は、
+ *
+ * - 0からmax_id_count - 1までのIDを管理し、IDの払い出し(@ref sparse_set_acquire)、指定IDの登録(@ref sparse_set_insert)、返却(@ref sparse_set_remove)、登録判定(@ref sparse_set_contains)はいずれもO(1)
+ * - 登録中のIDは密配列(dense)の先頭から詰めて格納されるため、@ref sparse_set_dense で取得した配列の先頭@ref sparse_set_count 個を走査すれば、登録中のIDのみを連続したメモリとして走査できる
+ * - 返却時は密配列の末尾の登録中IDを空いた位置に移動する(swap-remove)ため、走査順は返却によって変化する
+ * - 密配列の登録中IDより後ろには未登録のIDが格納されており、空きIDの探索を行わずに払い出す
+ *
+ * ハンドルプール(handle_pool_t)との違いは、要素を格納せずIDのみを管理する点と、IDが呼び出し側の配列のインデックスとしてそのまま使用できる点(世代を持たない)である。
+ *
+ * メモリは、メモリシステムから確保する方法(@ref sparse_set_create)と、リニアアロケータから確保する方法(@ref sparse_set_initialize)を選択できる。
+ *
+ * @note
+ * sparse_set_t構造体は、内部データを隠蔽している。
+ * このため、sparse_set_t型で変数を宣言することはできない。
+ * 使用の際は、sparse_set_t*型で宣言すること
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_SPARSE_SET_H
+#define GLCE_ENGINE_CONTAINERS_SPARSE_SET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "engine/core/memory/linear_allocator.h"
+
+/**
+ * @brief sparse_set_t前方宣言
+ *
+ */
+typedef struct sparse_set sparse_set_t;
+
+/**
+ * @brief スパースセットで管理可能なID数の上限値
+ *
+ * @note IDと密配列内の位置をuint32_tで管理するための制約
+ */
+#define SPARSE_SET_MAX_ID_COUNT ((size_t)UINT32_MAX)
+
+/**
+ * @brief スパースセットAPI実行結果コードリスト
+ *
+ */
+typedef enum {
+    SPARSE_SET_SUCCESS = 0,         /**< 処理成功 */
+    SPARSE_SET_INVALID_ARGUMENT,    /**< 無効な引数 */
+    SPARSE_SET_NO_MEMORY,           /**< メモリ不足 */
+    SPARSE_SET_RUNTIME_ERROR,       /**< 実行時エラー */
+    SPARSE_SET_UNDEFINED_ERROR,     /**< 未定義エラー */
+    SPARSE_SET_LIMIT_EXCEEDED,      /**< システム使用可能範囲上限超過 */
+    SPARSE_SET_BAD_OPERATION,       /**< API誤用 */
+    SPARSE_SET_DATA_CORRUPTED,      /**< 内部データ破損 */
+    SPARSE_SET_OVERFLOW,            /**< 計算過程のオーバーフロー */
+    SPARSE_SET_ID_NOT_FOUND,        /**< IDが登録されていない */
+    SPARSE_SET_ID_EXISTS,           /**< IDが登録済み */
+} sparse_set_result_t;
+
+/**
+ * @brief sparse_set_のメモリをメモリシステムから確保し、管理ID数max_id_count_で初期化する
+ *
+ * @note 初期化直後は全てのIDが未登録で、@ref sparse_set_acquire は0から昇順にIDを払い出す
+ *
+ * 使用例:
+ * @code{.c}
+ * sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+ * sparse_set_t* live_ids = NULL;
+ *
+ * // 0〜63のIDを管理するスパースセット初期化処理
+ * ret = sparse_set_create(64, &live_ids);
+ * @endcode
+ *
+ * @param[in] max_id_count_ 管理するID数(IDの範囲は0〜max_id_count_ - 1)
+ * @param[out] sparse_set_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 以下のいずれか
+ * - sparse_set_ == NULL
+ * - *sparse_set_ != NULL
+ * - 0 == max_id_count_
+ * - max_id_count_ > SPARSE_SET_MAX_ID_COUNT
+ * @retval SPARSE_SET_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval SPARSE_SET_NO_MEMORY メモリ不足によりメモリ確保失敗
+ * @retval SPARSE_SET_LIMIT_EXCEEDED メモリ管理システムのリソースがシステム使用可能範囲上限を超過
+ * @retval SPARSE_SET_BAD_OPERATION メモリシステム未初期化
+ * @retval SPARSE_SET_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see sparse_set_destroy
+ */
+sparse_set_result_t sparse_set_create(size_t max_id_count_, sparse_set_t** sparse_set_);
+
+/**
+ * @brief sparse_set_initializeでリニアアロケータから確保するメモリ量をメモリプール必要量io_pool_requirement_に加算する
+ *
+ * @note sparse_set_initializeと同じ引数で呼び出し、リニアアロケータの初期化前に上位モジュールのpreinitから使用する
+ *
+ * @param[in] max_id_count_ 管理するID数
+ * @param[in,out] io_pool_requirement_ メモリプール必要量(byte)
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_requirement_ == NULL
+ * - 0 == max_id_count_
+ * - max_id_count_ > SPARSE_SET_MAX_ID_COUNT
+ * @retval SPARSE_SET_OVERFLOW 処理過程、またはメモリプール必要量の加算でオーバーフローが発生
+ * @retval SPARSE_SET_SUCCESS 加算に成功し、正常終了
+ *
+ * @see sparse_set_initialize
+ */
+sparse_set_result_t sparse_set_preinit(size_t max_id_count_, size_t* io_pool_requirement_);
+
+/**
+ * @brief sparse_set_のメモリをリニアアロケータallocator_から確保し、管理ID数max_id_count_で初期化する
+ *
+ * @note
+ * - 確保したメモリはリニアアロケータごと破棄されるため、@ref sparse_set_destroy はポインタのNULL化のみ行う
+ * - 必要なメモリ量は@ref sparse_set_preinit で算出する
+ *
+ * @param[in] max_id_count_ 管理するID数(IDの範囲は0〜max_id_count_ - 1)
+ * @param[in,out] allocator_ メモリ確保に使用するリニアアロケータ
+ * @param[out] sparse_set_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - sparse_set_ == NULL
+ * - *sparse_set_ != NULL
+ * - 0 == max_id_count_
+ * - max_id_count_ > SPARSE_SET_MAX_ID_COUNT
+ * @retval SPARSE_SET_OVERFLOW 処理過程でオーバーフローが発生
+ * @retval SPARSE_SET_NO_MEMORY リニアアロケータの容量不足によりメモリ確保失敗
+ * @retval SPARSE_SET_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see sparse_set_preinit
+ */
+sparse_set_result_t sparse_set_initialize(size_t max_id_count_, linear_alloc_t* allocator_, sparse_set_t** sparse_set_);
+
+/**
+ * @brief sparse_set_create で確保したメモリを解放する
+ *
+ * @note
+ * - sparse_set_ == NULLの場合はno-op
+ * - *sparse_set_ == NULLの場合はno-op
+ * - sparse_set_initializeで初期化したスパースセットの場合はメモリを解放せず、*sparse_set_をNULLに設定する
+ * - 解放後、*sparse_set_はNULLに設定される
+ *
+ * @param[in,out] sparse_set_ 破棄対象構造体インスタンスへのダブルポインタ
+ */
+void sparse_set_destroy(sparse_set_t** sparse_set_);
+
+/**
+ * @brief 未登録のIDを1つ登録し、登録したIDを取得する
+ *
+ * @note 払い出すIDは密配列の未登録領域の先頭のID。直前に@ref sparse_set_remove したIDが優先して再利用される
+ *
+ * @param[in,out] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ * @param[out] out_id_ 登録したIDの格納先
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 以下のいずれか
+ * - sparse_set_ == NULL
+ * - out_id_ == NULL
+ * @retval SPARSE_SET_DATA_CORRUPTED スパースセット内部データ破損
+ * @retval SPARSE_SET_LIMIT_EXCEEDED 全てのIDが登録済み
+ * @retval SPARSE_SET_SUCCESS 登録に成功し、正常終了
+ */
+sparse_set_result_t sparse_set_acquire(sparse_set_t* sparse_set_, uint32_t* out_id_);
+
+/**
+ * @brief 指定したIDid_を登録する
+ *
+ * @param[in] id_ 登録するID
+ * @param[in,out] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 以下のいずれか
+ * - sparse_set_ == NULL
+ * - id_ >= 管理ID数
+ * @retval SPARSE_SET_DATA_CORRUPTED スパースセット内部データ破損
+ * @retval SPARSE_SET_ID_EXISTS id_が登録済み
+ * @retval SPARSE_SET_SUCCESS 登録に成功し、正常終了
+ */
+sparse_set_result_t sparse_set_insert(uint32_t id_, sparse_set_t* sparse_set_);
+
+/**
+ * @brief 登録中のIDid_を返却する
+ *
+ * @note 密配列の末尾の登録中IDをid_の位置に移動するため、@ref sparse_set_dense の走査順が変化する
+ *
+ * @param[in] id_ 返却するID
+ * @param[in,out] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 以下のいずれか
+ * - sparse_set_ == NULL
+ * - id_ >= 管理ID数
+ * @retval SPARSE_SET_DATA_CORRUPTED スパースセット内部データ破損
+ * @retval SPARSE_SET_ID_NOT_FOUND id_が登録されていない
+ * @retval SPARSE_SET_SUCCESS 返却に成功し、正常終了
+ */
+sparse_set_result_t sparse_set_remove(uint32_t id_, sparse_set_t* sparse_set_);
+
+/**
+ * @brief IDid_が登録中かを判定する
+ *
+ * @param[in] id_ 判定対象ID
+ * @param[in] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ *
+ * @retval true id_が登録中
+ * @retval false 以下のいずれか
+ * - id_が登録されていない
+ * - sparse_set_ == NULL
+ * - id_ >= 管理ID数
+ */
+bool sparse_set_contains(uint32_t id_, const sparse_set_t* sparse_set_);
+
+/**
+ * @brief sparse_set_の全てのIDを返却する
+ *
+ * @note sparse_set_ == NULLの場合はno-op
+ *
+ * @param[in,out] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ */
+void sparse_set_clear(sparse_set_t* sparse_set_);
+
+/**
+ * @brief sparse_set_に登録中のID数を取得する
+ *
+ * @param[in] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ *
+ * @return size_t 登録中のID数(sparse_set_ == NULLの場合は0)
+ */
+size_t sparse_set_count(const sparse_set_t* sparse_set_);
+
+/**
+ * @brief 登録中のIDを先頭から詰めて格納した密配列を取得する
+ *
+ * @note
+ * - 先頭から@ref sparse_set_count 個の要素が登録中のID
+ * - 取得したポインタが指す内容は、次の@ref sparse_set_acquire 、@ref sparse_set_insert 、@ref sparse_set_remove 、@ref sparse_set_clear の呼び出しで変化する。走査中にIDを返却する場合は末尾から走査すること
+ *
+ * 使用例:
+ * @code{.c}
+ * const uint32_t* ids = sparse_set_dense(live_ids);
+ * for(size_t i = 0; i != sparse_set_count(live_ids); ++i) {
+ *     resource_update(resources[ids[i]]);
+ * }
+ * @endcode
+ *
+ * @param[in] sparse_set_ 対象スパースセット構造体インスタンスへのポインタ
+ *
+ * @return const uint32_t* 密配列の先頭アドレス(sparse_set_ == NULLの場合はNULL)
+ */
+const uint32_t* sparse_set_dense(const sparse_set_t* sparse_set_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,180 @@
+/** @ingroup containers
+ *
+ * @file spsc_ring_queue.h
+ * @author chocolate-pie24
+ * @brief 単一プロデューサ/単一コンシューマ(SPSC)間でロックを使用せずにデータを受け渡すジェネリック型のリングキューモジュールを提供する
+ *
+ * @details
+ * I/Oスレッドやセンサスレッド(プロデューサ)からレンダースレッド(コンシューマ)へ、ロックを使用せずにデータを受け渡すためのリングキュー。特徴は、
+ *
+ * - 先頭インデックス(head)はコンシューマのみ、末尾インデックス(tail)はプロデューサのみが更新する
+ * - head/tailはそれぞれ別のキャッシュラインに配置し、プロデューサ/コンシューマ間のフォルスシェアリングを防ぐ
+ * - 要素の書き込み後にtailをreleaseで公開し、コンシューマはacquireでtailを読み込んでから要素を読み出す(head側も同様)
+ * - 相手側インデックスの値を自スレッド側にキャッシュし、キューが満杯/空に見えた場合のみ相手側インデックスを読み直す
+ *
+ * 格納するデータのサイズ、アライメント要件の扱いおよび実行結果コード(ring_queue_result_t)はring_queue_tと共通とする。
+ *
+ * @note
+ * spsc_ring_queue_t構造体は、内部データを隠蔽している。
+ * このため、spsc_ring_queue_t型で変数を宣言することはできない。
+ * 使用の際は、spsc_ring_queue_t*型で宣言すること
+ *
+ * @note
+ * ring_queue_tと異なり、満杯時に最古のデータを上書きすることはしない(プロデューサはheadを更新できないため)。満杯時のpushはRING_QUEUE_FULLを返す。
+ *
+ * @par スレッド安全性
+ * - spsc_ring_queue_pushを呼び出すスレッド(プロデューサ)は1つ、spsc_ring_queue_popを呼び出すスレッド(コンシューマ)は1つに限定すること
+ * - spsc_ring_queue_create/spsc_ring_queue_destroyは、プロデューサ/コンシューマのいずれもキューを使用していない状態で呼び出すこと
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_SPSC_RING_QUEUE_H
+#define GLCE_ENGINE_CONTAINERS_SPSC_RING_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "engine/containers/ring_queue.h"
+
+/**
+ * @brief spsc_ring_queue_t前方宣言
+ *
+ */
+typedef struct spsc_ring_queue spsc_ring_queue_t;
+
+/**
+ * @brief spsc_ring_queue_のメモリを確保し、容量max_element_count_で初期化する
+ *
+ * @note 初期化されたリングキューに格納するデータのサイズとアライメント要件はelement_size_,element_align_で固定化される
+ *
+ * 使用例:
+ * @code{.c}
+ * ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+ * spsc_ring_queue_t* queue = NULL;
+ *
+ * // sensor_sample_t型のデータを格納するSPSCリングキュー初期化処理(格納要素数は256)
+ * ret = spsc_ring_queue_create(256, sizeof(sensor_sample_t), alignof(sensor_sample_t), &queue);
+ * @endcode
+ *
+ * @param[in] max_element_count_ 要素を格納可能な最大個数
+ * @param[in] element_size_ 格納する要素のサイズ
+ * @param[in] element_align_ 格納する要素のアライメント要件(2のべき乗 かつ max_align_t以下でなければいけない)
+ * @param[out] spsc_ring_queue_ 初期化対象構造体インスタンスへのダブルポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - spsc_ring_queue_ == NULL
+ * - *spsc_ring_queue_ != NULL
+ * - max_element_count_ == 0
+ * - element_size_ == 0
+ * - element_align_ == 0
+ * - element_align_が2のべき乗ではない
+ * - element_align_がmax_align_tを超過
+ * @retval RING_QUEUE_OVERFLOW 必要メモリ量の計算過程でオーバーフローが発生
+ * @retval RING_QUEUE_NO_MEMORY メモリ確保に失敗
+ * @retval RING_QUEUE_LIMIT_EXCEEDED メモリシステムの使用可能範囲上限を超過
+ * @retval RING_QUEUE_RUNTIME_ERROR 確保したメモリのアライメントが不正
+ * @retval RING_QUEUE_UNDEFINED_ERROR 想定していない実行結果コードを処理過程で受け取った
+ * @retval RING_QUEUE_SUCCESS 初期化に成功し、正常終了
+ *
+ * @see spsc_ring_queue_destroy
+ */
+ring_queue_result_t spsc_ring_queue_create(size_t max_element_count_, size_t element_size_, size_t element_align_, spsc_ring_queue_t** spsc_ring_queue_);
+
+/**
+ * @brief spsc_ring_queue_が管理するメモリを解放し、*spsc_ring_queue_をNULLにする
+ *
+ * @note
+ * - spsc_ring_queue_ == NULLまたは*spsc_ring_queue_ == NULLの場合は何もしない
+ * - 2重デストロイ許可
+ *
+ * @param[in,out] spsc_ring_queue_ 破棄対象構造体インスタンスへのダブルポインタ
+ */
+void spsc_ring_queue_destroy(spsc_ring_queue_t** spsc_ring_queue_);
+
+/**
+ * @brief spsc_ring_queue_にdata_をpushする(プロデューサスレッド専用)
+ *
+ * 使用例:
+ * @code{.c}
+ * // プロデューサスレッド
+ * sensor_sample_t sample = sensor_read();
+ * while(RING_QUEUE_FULL == spsc_ring_queue_push(&sample, sizeof(sensor_sample_t), alignof(sensor_sample_t), queue)) {
+ *     // コンシューマがpopするまで待つ、またはサンプルを捨てる
+ * }
+ * @endcode
+ *
+ * @param[in] data_ 格納データへのポインタ
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] spsc_ring_queue_ データをpushするリングキュー構造体インスタンスへのポインタ
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - spsc_ring_queue_ == NULL
+ * - data_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がspsc_ring_queue_createを実行した時の値と異なる
+ * - element_align_がspsc_ring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_FULL リングキューが満杯(データは格納されない)
+ * @retval RING_QUEUE_SUCCESS データの格納に成功し、正常終了
+ */
+ring_queue_result_t spsc_ring_queue_push(const void* data_, size_t element_size_, size_t element_align_, spsc_ring_queue_t* spsc_ring_queue_);
+
+/**
+ * @brief spsc_ring_queue_から最古のデータをpopしてdata_に格納する(コンシューマスレッド専用)
+ *
+ * 使用例:
+ * @code{.c}
+ * // コンシューマスレッド(レンダースレッド)
+ * sensor_sample_t sample;
+ * while(RING_QUEUE_SUCCESS == spsc_ring_queue_pop(sizeof(sensor_sample_t), alignof(sensor_sample_t), queue, &sample)) {
+ *     // sampleを処理
+ * }
+ * @endcode
+ *
+ * @param[in] element_size_ 格納データサイズ(create時と異なる型ではないかをチェックするため)
+ * @param[in] element_align_ 格納データアライメント要件(create時と異なる型ではないかをチェックするため)
+ * @param[in,out] spsc_ring_queue_ データをpopするリングキュー構造体インスタンスへのポインタ
+ * @param[out] data_ popしたデータの格納先
+ *
+ * @retval RING_QUEUE_INVALID_ARGUMENT 以下のいずれか
+ * - spsc_ring_queue_ == NULL
+ * - data_ == NULL
+ * - データ格納キューが未初期化
+ * - element_size_がspsc_ring_queue_createを実行した時の値と異なる
+ * - element_align_がspsc_ring_queue_createを実行した時の値と異なる
+ * @retval RING_QUEUE_DATA_CORRUPTED リングキュー内部データ破損
+ * @retval RING_QUEUE_EMPTY リングキューが空
+ * @retval RING_QUEUE_SUCCESS データの取得に成功し、正常終了
+ */
+ring_queue_result_t spsc_ring_queue_pop(size_t element_size_, size_t element_align_, spsc_ring_queue_t* spsc_ring_queue_, void* data_);
+
+/**
+ * @brief spsc_ring_queue_が空かを判定する
+ *
+ * @note
+ * - spsc_ring_queue_ == NULL、または未初期化の場合はtrueを返す
+ * - プロデューサ/コンシューマが並行して動作している場合、戻り値は呼び出し時点のスナップショットとなる
+ *
+ * @param[in] spsc_ring_queue_ 判定対象リングキュー構造体インスタンスへのポインタ
+ *
+ * @retval true 空
+ * @retval false 1個以上のデータが格納されている
+ */
+bool spsc_ring_queue_empty(const spsc_ring_queue_t* spsc_ring_queue_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,130 @@
+/** @ingroup containers
+ *
+ * @file string_intern.h
+ * @author chocolate-pie24
+ * @brief 文字列を一意な整数値(アトム)に対応付けて一元管理する文字列インターンテーブルモジュールAPIの定義
+ *
+ * @details
+ * テクスチャ名、カメラ名等のリソース名称を、エンジン全体で共有する1つのインターンテーブルに登録し、文字列の代わりにアトム(string_atom_t)で扱うためのモジュール。特徴は、
+ *
+ * - 同一内容の文字列はテーブル内に1つだけ格納され、登録元のリソースごとに文字列を複製しない
+ * - 登録時に文字列のハッシュ値を計算してテーブル内に保持し、以降の検索/再配置ではハッシュ値を再計算しない
+ * - 同一内容の文字列には常に同一のアトムが割り当てられるため、名称の一致判定はアトム同士の整数比較で行える
+ * - アトムは参照カウントで管理され、参照が残っている間は値とstring_intern_c_strで取得できる文字列のアドレスが変化しない
+ *
+ * 実行結果コードはchoco_string_tと共通(choco_string_result_t)とする。
+ *
+ * @note
+ * - テーブルは最初の登録時にメモリシステムから確保され、登録文字列が全て解放された時点でメモリシステムに返却される。このため、明示的な初期化/終了処理は不要
+ * - 全ての参照を解放した後のアトムは別の文字列に再利用されるため、string_intern_releaseしたアトムを使用してはいけない
+ *
+ * @par スレッド安全性
+ * テーブルは排他制御を行わないため、string_intern_*は全て同一スレッド(メインスレッド)から呼び出すこと
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CONTAINERS_STRING_INTERN_H
+#define GLCE_ENGINE_CONTAINERS_STRING_INTERN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "engine/containers/choco_string.h"
+
+/**
+ * @brief インターンテーブルに登録された文字列を識別するアトム型
+ *
+ */
+typedef uint32_t string_atom_t;
+
+#define STRING_ATOM_INVALID ((string_atom_t)0)  /**< 無効なアトム(いずれの文字列にも対応しない) */
+
+/**
+ * @brief 文字列str_をインターンテーブルに登録し、対応するアトムを取得する
+ *
+ * @note
+ * - str_と同一内容の文字列が登録済みの場合は、登録済みのアトムの参照カウントを1増やして返す
+ * - 取得したアトムが不要になった時点で @ref string_intern_release で参照を解放すること
+ *
+ * 使用例:
+ * @code{.c}
+ * string_atom_t atom = STRING_ATOM_INVALID;
+ * choco_string_result_t ret = string_intern_acquire("main_camera", &atom);
+ * // ...
+ * string_intern_release(atom);
+ * @endcode
+ *
+ * @param[in] str_ 登録する文字列
+ * @param[out] out_atom_ 取得したアトムの格納先
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT 以下のいずれか
+ * - str_ == NULL
+ * - out_atom_ == NULL
+ * @retval CHOCO_STRING_OVERFLOW str_の文字列長さ+1(終端文字)がsize_tの最大値を超過
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED 以下のいずれか
+ * - 登録可能な文字列数、または参照カウントの上限を超過
+ * - メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 登録に成功し、正常終了
+ * @warning 上記以外のエラーは,テストなどで意図的に発生させない限り起こり得ないエラーで確実にバグ
+ *
+ * @see string_intern_release
+ */
+choco_string_result_t string_intern_acquire(const char* str_, string_atom_t* out_atom_);
+
+/**
+ * @brief atom_の参照を1つ解放する
+ *
+ * @note
+ * - 参照カウントが0になった文字列はテーブルから削除され、文字列を格納していたメモリは解放される
+ * - 登録文字列が全て削除された場合は、テーブル自身のメモリも解放される
+ * - atom_ == STRING_ATOM_INVALIDの場合はno-op
+ * - 登録されていないatom_が渡された場合はワーニングを出力し、何もしない
+ *
+ * @param[in] atom_ 参照を解放するアトム
+ */
+void string_intern_release(string_atom_t atom_);
+
+/**
+ * @brief 文字列str_が登録済みかを検索し、対応するアトムを取得する
+ *
+ * @note 参照カウントは変化しない。名称からリソースを検索する際に、検索対象の文字列をテーブルに登録せずにアトムへ変換するために使用する
+ *
+ * @param[in] str_ 検索する文字列
+ *
+ * @return string_atom_t str_に対応するアトム(str_ == NULL、またはstr_が登録されていない場合はSTRING_ATOM_INVALID)
+ */
+string_atom_t string_intern_find(const char* str_);
+
+/**
+ * @brief atom_に対応する文字列を取得する
+ *
+ * @param[in] atom_ 取得対象アトム
+ *
+ * @return const char* atom_に対応する文字列(atom_が登録されていない場合はNULL)
+ */
+const char* string_intern_c_str(string_atom_t atom_);
+
+/**
+ * @brief インターンテーブルに登録されている文字列の個数を取得する
+ *
+ * @return size_t 登録されている文字列の個数(同一内容の文字列は1個として数える)
+ */
+size_t string_intern_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
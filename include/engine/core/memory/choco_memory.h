@@ -8,11 +8,20 @@
  *
  * @details
  * 不定期に発生するメモリ確保要求に対するメモリ確保と、メモリトラッキング機能を提供する \n
- * メモリ確保は現状はmallocをラップしたAPIによって行う。将来的にはFreeListを実装予定 \n
+ * メモリ確保は、メモリシステム起動時に予約したメモリプールからフリーリストアロケータ(@ref freelist_allocator.h)によって行う \n
+ * メモリプールに収まらない割り当て要求は、mallocにフォールバックする \n
+ * 256byte以下の割り当て要求は、サイズクラス(16, 32, 64, 128, 256byte)ごとのスラブアロケータ(@ref slab_allocator.h)からO(1)で割り当てる \n
  * メモリトラッキングは、メモリタグごとに確保されたメモリ量を管理する \n
  * メモリタグは @ref memory_tag_t を参照 \n
  * なお、本APIで確保されるメモリは、全てmax_align_tにアライメントされている
  *
+ * @par スレッド安全性
+ * - memory_system_create / memory_system_destroyを除く全てのAPIは、複数のスレッドから同時に呼び出してよい
+ * - memory_system_create / memory_system_destroyはメインスレッドから、他のスレッドがメモリシステムを使用していない状態で呼び出すこと
+ * - スラブアロケータのブロックはスレッドごとのキャッシュで受け渡すため、256byte以下の割り当て、解放は通常ロックを取得しない
+ * - スレッドキャッシュ中のブロックはスレッド終了時にスラブアロケータへ返却される
+ * - 使用量、統計情報のカウンタは順序保証のないアトミック変数のため、他スレッドの実行中に取得した値は概算となる
+ *
  *
  * @version 0.1
  * @date 2025-09-20
@@ -48,6 +57,7 @@ typedef enum {
     MEMORY_TAG_FILE_IO,     /**< メモリタグ: ファイルI/O */
     MEMORY_TAG_CAMERA,      /**< メモリタグ: カメラシステム */
     MEMORY_TAG_TEXTURE,     /**< メモリタグ: テクスチャ */
+    MEMORY_TAG_CONTAINER,   /**< メモリタグ: 汎用コンテナ */
     MEMORY_TAG_MAX,         /**< メモリタグカウント用max値 */
 } memory_tag_t;
 
@@ -64,6 +74,86 @@ typedef enum {
     MEMORY_SYSTEM_NO_MEMORY,        /**< メモリ不足 */
 } memory_system_result_t;
 
+/**
+ * @brief 割り当てサイズヒストグラムのビン数
+ *
+ * @details
+ * ビンiは、割り当てサイズが(16 << 2 * (i - 1), 16 << 2 * i]の範囲の割り当て回数を保持する(ビン0は16byte以下) \n
+ * すなわち、16, 64, 256, 1KiB, 4KiB, 16KiB, 64KiB以下と、64KiB超過の8つのビンとなる
+ */
+#define MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT 8
+
+/**
+ * @brief メモリタグごとの割り当て統計情報
+ *
+ * @note 統計情報はメモリシステム起動時からの累積値
+ */
+typedef struct memory_tag_stats {
+    size_t allocated;       /**< 現在のメモリ割り当て量(byte) */
+    size_t peak;            /**< メモリ割り当て量の最大値(byte) */
+    size_t alloc_count;     /**< 割り当て回数 */
+    size_t free_count;      /**< 解放回数 */
+    size_t size_histogram[MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT];  /**< 割り当てサイズヒストグラム(@ref MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT 参照) */
+} memory_tag_stats_t;
+
+/**
+ * @brief 前回サンプリング時点からのメモリタグごとの割り当て差分
+ *
+ * @note 割り当て量の増減を符号なしで表現するため、割り当て量と解放量を個別に保持する
+ */
+typedef struct memory_frame_stats {
+    size_t alloc_count[MEMORY_TAG_MAX];     /**< 各メモリタグごとの割り当て回数 */
+    size_t free_count[MEMORY_TAG_MAX];      /**< 各メモリタグごとの解放回数 */
+    size_t allocated_bytes[MEMORY_TAG_MAX]; /**< 各メモリタグごとの割り当て量(byte) */
+    size_t freed_bytes[MEMORY_TAG_MAX];     /**< 各メモリタグごとの解放量(byte) */
+} memory_frame_stats_t;
+
+/**
+ * @brief 統計情報エクスポート形式リスト
+ *
+ */
+typedef enum {
+    MEMORY_STATS_FORMAT_JSON,   /**< JSON形式 */
+    MEMORY_STATS_FORMAT_CSV,    /**< CSV形式(ヘッダ行 + メモリタグごとに1行) */
+} memory_stats_format_t;
+
+/**
+ * @brief 定常状態割り当てガードの記録数上限(これを超えた違反は回数のみカウントする)
+ *
+ */
+#define MEMORY_SYSTEM_GUARD_RECORD_MAX 32
+
+/**
+ * @brief 定常状態割り当てガードの動作モードリスト
+ *
+ */
+typedef enum {
+    MEMORY_GUARD_MODE_COUNT,    /**< 違反を記録、カウントのみ行う */
+    MEMORY_GUARD_MODE_WARN,     /**< 違反を記録、カウントし、ワーニングを出力する */
+    MEMORY_GUARD_MODE_DENY,     /**< 違反を記録、カウントし、割り当て/再割り当てをMEMORY_SYSTEM_BAD_OPERATIONで失敗させる(解放は実行する) */
+} memory_guard_mode_t;
+
+/**
+ * @brief 定常状態割り当てガードで検出したメモリ操作種別リスト
+ *
+ */
+typedef enum {
+    MEMORY_GUARD_OP_ALLOCATE,   /**< memory_system_allocate / memory_system_allocate_aligned */
+    MEMORY_GUARD_OP_REALLOCATE, /**< memory_system_reallocate / memory_system_reallocate_aligned */
+    MEMORY_GUARD_OP_FREE,       /**< memory_system_free / memory_system_free_aligned */
+} memory_guard_op_t;
+
+/**
+ * @brief 定常状態割り当てガードの違反記録
+ *
+ */
+typedef struct memory_guard_violation {
+    memory_guard_op_t op;   /**< メモリ操作種別 */
+    memory_tag_t mem_tag;   /**< メモリタグ */
+    size_t size;            /**< 要求サイズ(再割り当ては変更後のサイズ, 解放は解放サイズ) */
+    const void* caller;     /**< 呼び出し元アドレス(addr2line等でシンボル化する, 取得できないコンパイラではNULL) */
+} memory_guard_violation_t;
+
 /**
  * @brief メモリシステムを起動する
  *
@@ -139,7 +229,9 @@ void memory_system_destroy(void);
  * - 割り当てサイズを割り当てた結果、mem_tag_allocatedがSIZE_MAX超過
  * - 割り当てサイズを割り当てた結果、total_allocatedがSIZE_MAX超過
  * @retval MEMORY_SYSTEM_NO_MEMORY        メモリ割り当て失敗
- * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステム未初期化
+ * @retval MEMORY_SYSTEM_BAD_OPERATION 以下のいずれか
+ * - メモリシステム未初期化
+ * - 定常状態割り当てガードがMEMORY_GUARD_MODE_DENYで有効(@ref memory_system_guard_arm 参照)
  * @retval MEMORY_SYSTEM_SUCCESS          size_ == 0または割り当てに成功し正常終了
  *
  * @see memory_tag_t
@@ -147,6 +239,76 @@ void memory_system_destroy(void);
  */
 memory_system_result_t memory_system_allocate(size_t size_, memory_tag_t mem_tag_, void** out_ptr_);
 
+/**
+ * @brief ptr_が保持する容量old_size_の領域をnew_size_に再割り当てし、mem_tag_で指定されたメモリタグのメモリ使用量を更新する
+ *
+ * @note
+ * - 割り当て元のアロケータでその場でサイズを変更できる場合は、先頭アドレスを変えずに変更する(スラブの同一サイズクラス内、フリーリストの縮小または直後の空きブロックを取り込む拡張、mallocへのフォールバック領域)
+ * - その場で変更できない場合は新たな領域を割り当て、min(old_size_, new_size_)分をコピーしてから旧領域を解放する
+ * - 拡張した領域は0で初期化される
+ * - ptr_ == NULL(old_size_ == 0)の場合はmemory_system_allocateと同様に新規割り当てを行う
+ * - out_ptr_にはptr_を保持している変数のアドレスを渡してもよい(*out_ptr_ != NULLでもエラーとしない)
+ * - 処理に失敗した場合、ptr_の領域と*out_ptr_は不変
+ * - memory_system_allocate_alignedで確保した領域にはmemory_system_reallocate_alignedを使用すること
+ *
+ * 使用例:
+ * @code{.c}
+ * char* buffer = NULL;
+ * memory_system_result_t ret = memory_system_allocate(64, MEMORY_TAG_STRING, (void**)&buffer);
+ * // エラー処理
+ *
+ * ret = memory_system_reallocate(buffer, 64, 128, MEMORY_TAG_STRING, (void**)&buffer);   // 128バイトに拡張
+ * // エラー処理(失敗時もbufferは有効)
+ *
+ * memory_system_free(buffer, 128, MEMORY_TAG_STRING);
+ * buffer = NULL;
+ * @endcode
+ *
+ * @param[in] ptr_ 再割り当て対象メモリアドレス
+ * @param[in] old_size_ 現在の割り当てサイズ
+ * @param[in] new_size_ 変更後の割り当てサイズ
+ * @param[in] mem_tag_ メモリタグ
+ * @param[out] out_ptr_ 再割り当て後のメモリ格納先
+ *
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT 以下のいずれか
+ * - out_ptr_ == NULL
+ * - mem_tag_ >= MEMORY_TAG_MAX
+ * - new_size_ == 0
+ * - ptr_ == NULLとold_size_ == 0の一方のみが成立
+ * - old_size_がメモリタグ、または全体の使用量を超過
+ * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステム未初期化、または定常状態割り当てガードがMEMORY_GUARD_MODE_DENYで有効(ptr_の領域は不変)
+ * @retval MEMORY_SYSTEM_LIMIT_EXCEEDED 拡張によりmem_tag_allocated、またはtotal_allocatedがSIZE_MAXを超過
+ * @retval MEMORY_SYSTEM_NO_MEMORY メモリの割り当てに失敗
+ * @retval MEMORY_SYSTEM_SUCCESS 再割り当てに成功し、正常終了
+ *
+ * @see memory_system_reallocate_aligned
+ */
+memory_system_result_t memory_system_reallocate(void* ptr_, size_t old_size_, size_t new_size_, memory_tag_t mem_tag_, void** out_ptr_);
+
+/**
+ * @brief memory_system_allocate_alignedで確保した領域を、アライメントを維持したままnew_size_に再割り当てする
+ *
+ * @note
+ * - mallocへのフォールバック領域はreallocでアライメントを維持できないため、常に新規割り当て + コピーとなる
+ * - その他の動作はmemory_system_reallocateと同様
+ *
+ * @param[in] ptr_ 再割り当て対象メモリアドレス
+ * @param[in] old_size_ 現在の割り当てサイズ
+ * @param[in] new_size_ 変更後の割り当てサイズ
+ * @param[in] align_ 割り当て時に指定したアライメント要件(2の冪乗)
+ * @param[in] mem_tag_ メモリタグ
+ * @param[out] out_ptr_ 再割り当て後のメモリ格納先
+ *
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT align_が2の冪乗ではない、ptr_がalign_でアラインされていない、その他はmemory_system_reallocateと同様
+ * @retval MEMORY_SYSTEM_BAD_OPERATION memory_system_reallocateと同様
+ * @retval MEMORY_SYSTEM_LIMIT_EXCEEDED memory_system_reallocateと同様
+ * @retval MEMORY_SYSTEM_NO_MEMORY memory_system_reallocateと同様
+ * @retval MEMORY_SYSTEM_SUCCESS 再割り当てに成功し、正常終了
+ *
+ * @see memory_system_reallocate
+ */
+memory_system_result_t memory_system_reallocate_aligned(void* ptr_, size_t old_size_, size_t new_size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_);
+
 /**
  * @brief ptr_が保持する領域のメモリを解放し、mem_tag_で指定されたメモリタグのメモリ使用量を更新する
  *
@@ -183,11 +345,64 @@ memory_system_result_t memory_system_allocate(size_t size_, memory_tag_t mem_tag
  */
 void memory_system_free(void* ptr_, size_t size_, memory_tag_t mem_tag_);
 
+/**
+ * @brief 先頭アドレスがalign_の倍数となる容量size_のメモリを確保し、mem_tag_で指定されたメモリタグのメモリ使用量を更新する
+ *
+ * @note
+ * - SIMD命令でのロード/ストアやGPUへの転送用バッファなど、alignof(max_align_t)を超えるアライメントが必要な場合に使用する
+ * - align_ <= alignof(max_align_t)の場合はmemory_system_allocateと同等となる
+ * - 確保したメモリはmemory_system_free_alignedで解放すること
+ * - その他の動作はmemory_system_allocateと同様
+ *
+ * 使用例:
+ * @code{.c}
+ * void* pixels = NULL;
+ * memory_system_result_t ret = memory_system_allocate_aligned(1024, 64, MEMORY_TAG_TEXTURE, &pixels); // 64byteアラインで1024バイト割り当て
+ * // エラー処理
+ *
+ * memory_system_free_aligned(pixels, 1024, 64, MEMORY_TAG_TEXTURE);
+ * pixels = NULL;
+ * @endcode
+ *
+ * @param[in] size_ 割り当てサイズ
+ * @param[in] align_ アライメント要件(2の冪乗)
+ * @param[in] mem_tag_ メモリタグ
+ * @param[out] out_ptr_ 割り当てたメモリ格納先
+ *
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT align_が0または2の冪乗ではない、その他はmemory_system_allocateと同様
+ * @retval MEMORY_SYSTEM_BAD_OPERATION memory_system_allocateと同様
+ * @retval MEMORY_SYSTEM_LIMIT_EXCEEDED memory_system_allocateと同様
+ * @retval MEMORY_SYSTEM_NO_MEMORY memory_system_allocateと同様
+ * @retval MEMORY_SYSTEM_SUCCESS メモリの割り当てに成功し、正常終了
+ *
+ * @see memory_system_free_aligned
+ */
+memory_system_result_t memory_system_allocate_aligned(size_t size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_);
+
+/**
+ * @brief memory_system_allocate_alignedで確保したメモリを解放し、mem_tag_で指定されたメモリタグのメモリ使用量を更新する
+ *
+ * @note
+ * - align_が2の冪乗ではない場合はワーニングを出力し、何もしない
+ * - ptr_がalign_でアラインされていない場合はワーニングを出力し、何もしない
+ * - その他の動作はmemory_system_freeと同様
+ *
+ * @param[in] ptr_ 解放メモリアドレス
+ * @param[in] size_ 解放サイズ
+ * @param[in] align_ 割り当て時に指定したアライメント要件
+ * @param[in] mem_tag_ メモリタグ
+ *
+ * @see memory_system_allocate_aligned
+ */
+void memory_system_free_aligned(void* ptr_, size_t size_, size_t align_, memory_tag_t mem_tag_);
+
 /**
  * @brief メモリシステムが管理しているメモリ使用量状態を標準出力に出力する
  *
  * @note
  * - メモリシステムが未初期化の場合はワーニングを出力し、何もしない
+ * - メモリタグごとに現在の割り当て量、最大割り当て量、割り当て/解放回数を出力する
+ * - 機械可読形式での出力はmemory_system_stats_exportを使用する
  *
  * 使用例:
  * @code{.c}
@@ -204,6 +419,168 @@ void memory_system_free(void* ptr_, size_t size_, memory_tag_t mem_tag_);
  */
 void memory_system_report(void);
 
+/**
+ * @brief メモリタグごとの割り当て統計情報を取得する
+ *
+ * @note
+ * - 再割り当て(memory_system_reallocate)は、旧サイズの解放1回と新サイズの割り当て1回として計上する
+ * - 処理に失敗した場合、out_stats_は不変
+ *
+ * @param[in] mem_tag_ 取得対象メモリタグ
+ * @param[out] out_stats_ 統計情報格納先
+ *
+ * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステムが未初期化
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT 以下のいずれか
+ * - out_stats_ == NULL
+ * - mem_tag_ >= MEMORY_TAG_MAX
+ * @retval MEMORY_SYSTEM_SUCCESS 取得に成功し、正常終了
+ */
+memory_system_result_t memory_system_tag_stats_get(memory_tag_t mem_tag_, memory_tag_stats_t* out_stats_);
+
+/**
+ * @brief メモリタグの名称文字列を取得する
+ *
+ * @note メモリシステムが未初期化、またはmem_tag_ >= MEMORY_TAG_MAXの場合は"unknown"を返す
+ *
+ * @param[in] mem_tag_ 取得対象メモリタグ
+ * @return const char* メモリタグ名称文字列(NULLは返さない)
+ */
+const char* memory_system_tag_str_get(memory_tag_t mem_tag_);
+
+/**
+ * @brief 前回呼び出し時点(初回はメモリシステム起動時点)からのメモリタグごとの割り当て差分を取得し、差分をリセットする
+ *
+ * @note
+ * - フレーム先頭で毎フレーム呼び出すことで、1フレームあたりの割り当て回数、量を取得できる
+ * - 処理に失敗した場合、out_stats_は不変で、差分もリセットされない
+ *
+ * 使用例:
+ * @code{.c}
+ * memory_frame_stats_t frame_stats;
+ * while(running) {
+ *     memory_system_frame_stats_sample(&frame_stats);   // 前フレームの割り当て差分を取得
+ *     if(0 != frame_stats.alloc_count[MEMORY_TAG_STRING]) {
+ *         // 定常状態で文字列の割り当てが発生している
+ *     }
+ *     // フレーム処理
+ * }
+ * @endcode
+ *
+ * @param[out] out_stats_ 割り当て差分格納先
+ *
+ * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステムが未初期化
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT out_stats_ == NULL
+ * @retval MEMORY_SYSTEM_SUCCESS 取得に成功し、正常終了
+ */
+memory_system_result_t memory_system_frame_stats_sample(memory_frame_stats_t* out_stats_);
+
+/**
+ * @brief 全メモリタグの割り当て統計情報を機械可読形式の文字列で出力する
+ *
+ * @note
+ * - 出力文字列の長さ(終端文字を除く)はout_length_に格納する
+ * - buffer_ == NULLかつbuffer_size_ == 0の場合は、出力に必要な長さのみを取得する(out_length_ + 1のバッファを用意すること)
+ * - buffer_size_が不足している場合は、buffer_をbuffer_size_ - 1文字で切り詰めて終端し、MEMORY_SYSTEM_LIMIT_EXCEEDEDを返す(out_length_には必要な長さを格納する)
+ *
+ * 出力例(JSON):
+ * @code{.json}
+ * {"total_allocated":384,"total_peak":384,"tags":[{"tag":"system","allocated":256,"peak":256,"alloc_count":1,"free_count":0,"size_histogram":[0,0,1,0,0,0,0,0]}, ...]}
+ * @endcode
+ *
+ * 出力例(CSV):
+ * @code{.csv}
+ * tag,allocated,peak,alloc_count,free_count,hist_le_16,hist_le_64,hist_le_256,hist_le_1k,hist_le_4k,hist_le_16k,hist_le_64k,hist_gt_64k
+ * system,256,256,1,0,0,0,1,0,0,0,0,0
+ * ...
+ * @endcode
+ *
+ * @param[in] format_ 出力形式
+ * @param[out] buffer_ 出力先バッファ
+ * @param[in] buffer_size_ 出力先バッファのサイズ(byte)
+ * @param[out] out_length_ 出力文字列の長さ格納先
+ *
+ * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステムが未初期化
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT 以下のいずれか
+ * - out_length_ == NULL
+ * - buffer_ == NULLかつbuffer_size_ != 0
+ * - format_が未定義の値
+ * @retval MEMORY_SYSTEM_RUNTIME_ERROR 文字列の整形に失敗
+ * @retval MEMORY_SYSTEM_LIMIT_EXCEEDED buffer_size_が不足し、出力を切り詰めた
+ * @retval MEMORY_SYSTEM_SUCCESS 出力に成功し、正常終了
+ */
+memory_system_result_t memory_system_stats_export(memory_stats_format_t format_, char* buffer_, size_t buffer_size_, size_t* out_length_);
+
+/**
+ * @brief 定常状態割り当てガードを有効化する
+ *
+ * @details
+ * リアルタイム処理のフレームループ内でのヒープ割り当ては、レイテンシ悪化の原因となる \n
+ * ガード有効化中にメモリの割り当て、再割り当て、解放が行われた場合、違反として呼び出し元アドレスとともに記録する \n
+ * 初期化完了後、フレームループ開始直前に有効化し、ループ終了後に無効化することで、定常状態でのメモリ割り当てを検出できる
+ *
+ * @note
+ * - 有効化時に違反回数と違反記録はクリアされる
+ * - 有効化中に再度呼び出した場合はMEMORY_SYSTEM_BAD_OPERATIONを返し、モードと違反記録は変化しない(モードを変更する場合はmemory_system_guard_disarmで無効化してから呼び出す)
+ * - 違反記録はMEMORY_SYSTEM_GUARD_RECORD_MAX件まで保持し、以降は回数のみカウントする
+ *
+ * 使用例:
+ * @code{.c}
+ * memory_system_guard_arm(MEMORY_GUARD_MODE_WARN);
+ * while(running) {
+ *     // フレーム処理(ここでのmemory_system_allocate / memory_system_freeはワーニングとなる)
+ * }
+ * memory_system_guard_disarm();
+ *
+ * size_t count = 0;
+ * memory_system_guard_violation_count_get(&count);
+ * @endcode
+ *
+ * @param[in] mode_ 動作モード
+ *
+ * @retval MEMORY_SYSTEM_BAD_OPERATION 以下のいずれか
+ * - メモリシステムが未初期化
+ * - ガードが既に有効
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT mode_が未定義の値
+ * @retval MEMORY_SYSTEM_SUCCESS 有効化に成功し、正常終了
+ */
+memory_system_result_t memory_system_guard_arm(memory_guard_mode_t mode_);
+
+/**
+ * @brief 定常状態割り当てガードを無効化する
+ *
+ * @note
+ * - メモリシステムが未初期化、またはガードが無効の場合は何もしない
+ * - 違反回数と違反記録は保持され、次回のmemory_system_guard_armまで取得できる
+ */
+void memory_system_guard_disarm(void);
+
+/**
+ * @brief 定常状態割り当てガードの違反回数を取得する
+ *
+ * @param[out] out_count_ 違反回数格納先(記録上限を超えた分も含む)
+ *
+ * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステムが未初期化
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT out_count_ == NULL
+ * @retval MEMORY_SYSTEM_SUCCESS 取得に成功し、正常終了
+ */
+memory_system_result_t memory_system_guard_violation_count_get(size_t* out_count_);
+
+/**
+ * @brief 定常状態割り当てガードの違反記録を取得する
+ *
+ * @note 処理に失敗した場合、out_violation_は不変
+ *
+ * @param[in] index_ 取得する違反記録のインデックス(発生順)
+ * @param[out] out_violation_ 違反記録格納先
+ *
+ * @retval MEMORY_SYSTEM_BAD_OPERATION メモリシステムが未初期化
+ * @retval MEMORY_SYSTEM_INVALID_ARGUMENT 以下のいずれか
+ * - out_violation_ == NULL
+ * - index_が記録済みの件数以上(違反回数、MEMORY_SYSTEM_GUARD_RECORD_MAXの小さい方)
+ * @retval MEMORY_SYSTEM_SUCCESS 取得に成功し、正常終了
+ */
+memory_system_result_t memory_system_guard_violation_get(size_t index_, memory_guard_violation_t* out_violation_);
+
 #ifdef __cplusplus
 }
 #endif
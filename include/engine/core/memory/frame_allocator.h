@@ -0,0 +1,141 @@
+/** @ingroup core
+ *
+ * @file frame_allocator.h
+ * @author chocolate-pie24
+ * @brief 1フレームの間だけ有効な一時メモリの確保に対応するフレームアロケータモジュールの定義
+ *
+ * @details
+ * リニアアロケータを2つ使用したダブルバッファ方式のフレームアロケータを実装。特徴は、
+ *
+ * - frame_allocator_begin_frameでカレントのリニアアロケータを切り替え、切り替え先をリセットする
+ * - このため、あるフレームで確保したメモリは次のフレームの終了まで有効(前フレームの結果を参照可能)
+ * - 個別のメモリ解放は不要で、ヒープへのアクセスも発生しない
+ *
+ * フレームアロケータ自身と2つのリニアアロケータ、メモリプールは、初期化時に上位層のリニアアロケータから確保する
+ *
+ * @note
+ * frame_alloc_t構造体は、内部データを隠蔽している \n
+ * このため、frame_alloc_t型で変数を宣言することはできない \n
+ * 使用の際は、frame_alloc_t*型で宣言すること
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CORE_MEMORY_FRAME_ALLOCATOR_H
+#define GLCE_ENGINE_CORE_MEMORY_FRAME_ALLOCATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "engine/core/memory/linear_allocator.h"
+
+/**
+ * @brief frame_allocator構造体前方宣言
+ * @note 内部データ構造はframe_allocator.cで定義し、外部からは隠蔽する
+ */
+typedef struct frame_alloc frame_alloc_t;
+
+/**
+ * @brief フレームアロケータの初期化に必要なリニアアロケータのメモリプール容量をio_pool_requirement_に加算する
+ *
+ * @note
+ * - frame_allocator_initializeと同じ順序、アライメント要件で割り当て要求を加算する
+ * - 実行結果コードはlinear_allocator_requirement_addのものをそのまま使用する
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t pool_size = 0;
+ * linear_allocator_result_t ret = frame_allocator_preinit(64 * KIB, &pool_size);
+ * @endcode
+ *
+ * @param[in] frame_capacity_ 1フレームで使用可能なメモリ容量(byte)
+ * @param[in,out] io_pool_requirement_ メモリプール必要量(byte)
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - frame_capacity_ == 0
+ * - io_pool_requirement_ == NULL
+ * - 加算結果がオーバーフロー
+ * @retval LINEAR_ALLOC_SUCCESS 加算に成功し正常終了
+ *
+ * @see frame_allocator_initialize
+ * @see linear_allocator_requirement_add
+ */
+linear_allocator_result_t frame_allocator_preinit(size_t frame_capacity_, size_t* io_pool_requirement_);
+
+/**
+ * @brief フレームアロケータのメモリを確保し、初期化する
+ *
+ * @note
+ * - 1フレーム分の容量frame_capacity_のメモリプールを2つ確保する
+ * - 実行結果コードは内部で使用するリニアアロケータのものをそのまま使用する
+ *
+ * @warning フレームアロケータはリニアアロケータを使用したメモリ確保を行うため、本APIの失敗時を含め、リソースの破棄はリニアアロケータの破棄によって行う
+ *
+ * 使用例:
+ * @code{.c}
+ * frame_alloc_t* frame_alloc = NULL;
+ * linear_allocator_result_t ret = frame_allocator_initialize(64 * KIB, linear_alloc, &frame_alloc);
+ * @endcode
+ *
+ * @param[in] frame_capacity_ 1フレームで使用可能なメモリ容量(byte)
+ * @param[in,out] allocator_ フレームアロケータのメモリ確保に使用するリニアアロケータ
+ * @param[out] out_frame_alloc_ フレームアロケータ格納先
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - frame_capacity_ == 0
+ * - allocator_ == NULL
+ * - out_frame_alloc_ == NULL
+ * - *out_frame_alloc_ != NULL
+ * @retval LINEAR_ALLOC_NO_MEMORY allocator_の容量不足
+ * @retval LINEAR_ALLOC_SUCCESS   初期化に成功し、正常終了
+ */
+linear_allocator_result_t frame_allocator_initialize(size_t frame_capacity_, linear_alloc_t* allocator_, frame_alloc_t** out_frame_alloc_);
+
+/**
+ * @brief フレームの開始時に呼び出し、カレントのリニアアロケータを切り替えてリセットする
+ *
+ * @note
+ * - 2フレーム前に確保したメモリは無効となる
+ * - frame_alloc_ == NULLの場合はワーニングを出力し、何もしない
+ *
+ * @param[in,out] frame_alloc_ 処理対象フレームアロケータ
+ */
+void frame_allocator_begin_frame(frame_alloc_t* frame_alloc_);
+
+/**
+ * @brief カレントフレームのリニアアロケータから一時メモリを割り当てる
+ *
+ * @note 割り当てたメモリは次のフレームの終了まで有効で、個別の解放は不要
+ *
+ * 使用例:
+ * @code{.c}
+ * float* tmp = NULL;
+ * linear_allocator_result_t ret = frame_allocator_allocate(frame_alloc, sizeof(float) * 128, alignof(float), (void**)&tmp);
+ * @endcode
+ *
+ * @param[in,out] frame_alloc_ 割り当てに使用するフレームアロケータ
+ * @param[in] req_size_ 割り当て容量(byte)
+ * @param[in] req_align_ 割り当てるメモリのアライメント要件
+ * @param[out] out_ptr_ 割り当てたアドレスを格納する
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT frame_alloc_ == NULL、その他はlinear_allocator_allocateに準じる
+ * @retval LINEAR_ALLOC_NO_MEMORY        カレントフレームの容量不足
+ * @retval LINEAR_ALLOC_SUCCESS          linear_allocator_allocateに準じる
+ *
+ * @see linear_allocator_allocate
+ */
+linear_allocator_result_t frame_allocator_allocate(frame_alloc_t* frame_alloc_, size_t req_size_, size_t req_align_, void** out_ptr_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,215 @@
+/** @ingroup core
+ *
+ * @file freelist_allocator.h
+ * @author chocolate-pie24
+ * @brief 個別のメモリ確保、解放に対応するフリーリストアロケータモジュールの定義
+ *
+ * @details
+ * メモリアロケータの一つであるFreeListAllocatorを実装。特徴は、
+ *
+ * - 上位層から渡されたメモリプール内で個別のメモリ確保、解放が可能
+ * - 空きブロックはアドレス順の単方向リストで管理し、first-fitで割り当てる
+ * - 解放時に隣接する空きブロックと結合(coalescing)し、断片化を抑える
+ *
+ * gl_choco_engineでは、メモリシステム(choco_memory)の内部アロケータとして使用する
+ *
+ * @note
+ * freelist_alloc_t構造体は、内部データを隠蔽している \n
+ * このため、freelist_alloc_t型で変数を宣言することはできない \n
+ * 使用の際は、freelist_alloc_t*型で宣言すること
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CORE_MEMORY_FREELIST_ALLOCATOR_H
+#define GLCE_ENGINE_CORE_MEMORY_FREELIST_ALLOCATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief freelist_allocator構造体前方宣言
+ * @note 内部データ構造はfreelist_allocator.cで定義し、外部からは隠蔽する
+ */
+typedef struct freelist_alloc freelist_alloc_t;
+
+/**
+ * @brief freelist_allocator実行結果コードリスト
+ *
+ */
+typedef enum {
+    FREELIST_ALLOC_SUCCESS = 0,         /**< 処理成功 */
+    FREELIST_ALLOC_NO_MEMORY,           /**< メモリ不足 */
+    FREELIST_ALLOC_INVALID_ARGUMENT,    /**< 無効な引数 */
+} freelist_allocator_result_t;
+
+/**
+ * @brief freelist_alloc_t構造体インスタンスの生成に必要なメモリ使用量とメモリアライメント要件を取得する
+ *
+ * @note
+ * - memory_requirement_ == NULLまたは、align_requirement_ == NULLの場合は何もしない
+ * - 本APIを使用した後、フリーリストアロケータのメモリを確保し、freelist_allocator_initを使用して初期化する
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t memory_requirement = 0;   // メモリ使用量格納先
+ * size_t align_requirement = 0;    // メモリアライメント要件格納先
+ * freelist_allocator_preinit(&memory_requirement, &align_requirement);
+ * @endcode
+ *
+ * @param[out] memory_requirement_ メモリ使用量格納先
+ * @param[out] align_requirement_ メモリアライメント要件格納先
+ *
+ * @see freelist_allocator_init
+ */
+void freelist_allocator_preinit(size_t* memory_requirement_, size_t* align_requirement_);
+
+/**
+ * @brief freelist_alloc_t構造体インスタンスをメモリ容量capacity_、メモリプール先頭アドレスmemory_pool_で初期化する
+ *
+ * @note
+ * - メモリプール全体を1つの空きブロックとして初期化する
+ * - メモリプールの先頭はmax_align_tにアライメントされるよう内部で調整され、調整分は容量から差し引かれる
+ * - フリーリストアロケータ構造体インスタンス自体とメモリプールの破棄は上位層で行う
+ *
+ * 使用例:
+ * @code{.c}
+ * freelist_alloc_t* freelist_alloc = NULL;    // フリーリストアロケータ
+ * void* freelist_pool = NULL;                 // メモリプール先頭アドレス
+ * size_t freelist_pool_size = 1 * MIB;        // メモリプール容量(1MiB)
+ *
+ * size_t mem_req = 0;
+ * size_t align_req = 0;
+ * freelist_allocator_preinit(&mem_req, &align_req);
+ *
+ * freelist_alloc = (freelist_alloc_t*)malloc(mem_req);
+ * freelist_pool = malloc(freelist_pool_size);
+ *
+ * freelist_allocator_result_t ret = freelist_allocator_init(freelist_alloc, freelist_pool_size, freelist_pool);
+ * @endcode
+ *
+ * @param[in,out] allocator_ フリーリストアロケータ構造体インスタンスアドレス
+ * @param[in] capacity_ メモリプール容量(byte)
+ * @param[in] memory_pool_ メモリプールアドレス
+ *
+ * @retval FREELIST_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - 引数allocator_ == NULL
+ * - 引数memory_pool_ == NULL
+ * - アライメント調整後の容量が最小ブロックサイズに満たない
+ * @retval FREELIST_ALLOC_SUCCESS          フリーリストアロケータの初期化に成功し、正常終了
+ *
+ * @see freelist_allocator_preinit
+ */
+freelist_allocator_result_t freelist_allocator_init(freelist_alloc_t* allocator_, size_t capacity_, void* memory_pool_);
+
+/**
+ * @brief freelist_allocatorを使用してメモリを割り当てる
+ *
+ * @note
+ * - 空きブロックをアドレス順に探索し、最初に要求を満たしたブロックから割り当てる(first-fit)
+ * - 空きブロックの残りが最小ブロックサイズ以上であれば分割し、残りを空きブロックとしてリストに戻す
+ * - req_align_がmax_align_t未満の場合はmax_align_tが使用される
+ *
+ * 使用例:
+ * @code{.c}
+ * void* ptr = NULL;
+ * freelist_allocator_result_t ret = freelist_allocator_allocate(freelist_alloc, 128, alignof(max_align_t), &ptr);
+ * @endcode
+ *
+ * @param[in,out] allocator_ freelist_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] req_size_ 割り当て容量(byte)
+ * @param[in] req_align_ 割り当てるメモリのアライメント要件(2の冪乗)
+ * @param[out] out_ptr_ 割り当てたアドレスを格納する
+ *
+ * @retval FREELIST_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - out_ptr_ == NULL
+ * - *out_ptr_ != NULL
+ * - req_size_ == 0
+ * - req_align_が2の冪乗ではない
+ * @retval FREELIST_ALLOC_NO_MEMORY 要求を満たす空きブロックが存在しない
+ * @retval FREELIST_ALLOC_SUCCESS   メモリ割り当てに成功し正常終了
+ *
+ * @see freelist_allocator_free
+ */
+freelist_allocator_result_t freelist_allocator_allocate(freelist_alloc_t* allocator_, size_t req_size_, size_t req_align_, void** out_ptr_);
+
+/**
+ * @brief freelist_allocator_allocateで割り当てたメモリを解放し、空きブロックとしてリストに戻す
+ *
+ * @note
+ * - 解放したブロックが前後の空きブロックと隣接している場合は結合する
+ * - 下記の場合はワーニングを出力し、何もしない
+ *   - allocator_ == NULL または ptr_ == NULL
+ *   - ptr_がメモリプール外のアドレス
+ *   - ptr_のブロックヘッダが破損している、または既に解放済み(2重解放)
+ *
+ * @param[in,out] allocator_ freelist_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] ptr_ 解放するメモリアドレス
+ *
+ * @see freelist_allocator_allocate
+ */
+void freelist_allocator_free(freelist_alloc_t* allocator_, void* ptr_);
+
+/**
+ * @brief freelist_allocator_allocateで割り当てたメモリのサイズを、先頭アドレスを変えずにnew_size_へ変更する
+ *
+ * @note
+ * - 縮小時、余った末尾領域が空きブロックとして成立する場合は空きリストに戻す(後方の空きブロックとは結合する)
+ * - 拡張時、ブロックの直後に隣接する空きブロックを取り込める場合のみ成功する
+ * - 失敗した場合、ブロックの内容とアロケータの状態は不変
+ *
+ * @param[in,out] allocator_ freelist_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] ptr_ サイズ変更対象のメモリアドレス
+ * @param[in] new_size_ 変更後のサイズ(byte)
+ *
+ * @retval FREELIST_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - ptr_ == NULL
+ * - new_size_ == 0
+ * - ptr_がメモリプール外のアドレス、またはブロックヘッダが破損している
+ * @retval FREELIST_ALLOC_NO_MEMORY その場でのサイズ拡張ができない
+ * @retval FREELIST_ALLOC_SUCCESS   サイズ変更に成功し正常終了
+ */
+freelist_allocator_result_t freelist_allocator_resize(freelist_alloc_t* allocator_, void* ptr_, size_t new_size_);
+
+/**
+ * @brief ptr_がallocator_の管理するメモリプール内のアドレスかを判定する
+ *
+ * @param[in] allocator_ 判定に使用するfreelist_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] ptr_ 判定対象アドレス
+ *
+ * @retval true  ptr_はメモリプール内のアドレス
+ * @retval false 以下のいずれか
+ * - allocator_ == NULL または ptr_ == NULL
+ * - ptr_はメモリプール外のアドレス
+ */
+bool freelist_allocator_owns(const freelist_alloc_t* allocator_, const void* ptr_);
+
+/**
+ * @brief allocator_が管理するメモリプールの空き容量の合計を取得する
+ *
+ * @note
+ * - ブロックヘッダ分を含んだ空きブロックサイズの総和であり、連続して確保可能なサイズではない
+ * - allocator_ == NULLの場合は0を返す
+ *
+ * @param[in] allocator_ 取得対象freelist_alloc_t型構造体インスタンスへのポインタ
+ *
+ * @return size_t 空き容量(byte)
+ */
+size_t freelist_allocator_free_space(const freelist_alloc_t* allocator_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
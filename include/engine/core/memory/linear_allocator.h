@@ -37,6 +37,8 @@ extern "C" {
 
 #include <stddef.h>
 
+#include "engine/core/memory/virtual_arena.h"
+
 /**
  * @brief linear_allocator構造体前方宣言
  * @note 内部データ構造はlinear_allocator.cで定義し、外部からは隠蔽する
@@ -129,6 +131,34 @@ void linear_allocator_preinit(size_t* memory_requirement_, size_t* align_require
  */
 linear_allocator_result_t linear_allocator_init(linear_alloc_t* allocator_, size_t capacity_, void* memory_pool_);
 
+/**
+ * @brief linear_alloc_t構造体インスタンスを、仮想メモリアリーナarena_の予約範囲をメモリプールとして初期化する
+ *
+ * @note
+ * - メモリ容量はarena_の予約容量となり、割り当てに合わせてarena_の物理メモリを順次コミットする
+ * - 拡張時もメモリプール先頭アドレスは変化しないため、割り当て済みのポインタは有効なまま
+ * - 未使用の予約範囲は物理メモリを消費しないため、最悪ケースに合わせた大きな容量を予約できる
+ * - arena_の破棄(virtual_arena_deinit)は上位層で行う
+ *
+ * 使用例:
+ * @code{.c}
+ * // arena: virtual_arena_initで初期化済み
+ * ret_linear = linear_allocator_init_virtual(linear_alloc, arena);
+ * @endcode
+ *
+ * @param[in,out] allocator_ リニアアロケータ構造体インスタンスアドレス
+ * @param[in] arena_ メモリプールとして使用する仮想メモリアリーナ
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - 引数allocator_ == NULL
+ * - 引数arena_ == NULL
+ * - arena_が仮想アドレス空間を予約していない
+ * @retval LINEAR_ALLOC_SUCCESS          リニアアロケータの初期化に成功し、正常終了
+ *
+ * @see virtual_arena_init
+ */
+linear_allocator_result_t linear_allocator_init_virtual(linear_alloc_t* allocator_, virtual_arena_t* arena_);
+
 /**
  * @brief linear_allocatorを使用してメモリを割り当てる
  *
@@ -178,7 +208,9 @@ linear_allocator_result_t linear_allocator_init(linear_alloc_t* allocator_, size
  * - req_align_が2の冪乗ではない
  * - メモリを割り当てた場合、割り当て開始アドレスの値がオーバーフロー
  * - メモリ割り当て先頭アドレス+割り当てサイズの値がオーバーフロー
- * @retval LINEAR_ALLOC_NO_MEMORY        メモリを割り当てた場合、メモリプール内に収まらない
+ * @retval LINEAR_ALLOC_NO_MEMORY        以下のいずれか
+ * - メモリを割り当てた場合、メモリプール内に収まらない
+ * - 仮想メモリアリーナ使用時に、物理メモリのコミットに失敗
  * @retval LINEAR_ALLOC_SUCCESS 以下のいずれか
  * - req_align_ == 0 または req_size_ == 0でワーニング出力し何もしない
  * - メモリ割り当てに成功し正常終了
@@ -186,6 +218,105 @@ linear_allocator_result_t linear_allocator_init(linear_alloc_t* allocator_, size
  */
 linear_allocator_result_t linear_allocator_allocate(linear_alloc_t* allocator_, size_t req_size_, size_t req_align_, void** out_ptr_);
 
+/**
+ * @brief 割り当て要求(req_size_, req_align_)をメモリプール必要量io_pool_size_に加算する
+ *
+ * @note
+ * - リニアアロケータのメモリプールを確保する前に、各サブシステムの割り当て要求を初期化と同じ順序で加算することで、必要なメモリプール容量を事前に算出する
+ * - メモリプール先頭アドレスはmax_align_tでアラインされている前提で、linear_allocator_allocateと同じ規則でアライメント調整分を加算する
+ * - req_align_がalignof(max_align_t)より大きい場合は、メモリプール先頭アドレスに依存するため最悪ケースの調整分を加算する
+ * - req_size_ == 0 または req_align_ == 0の場合は、linear_allocator_allocateと同様に何も加算しない
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t pool_size = 0;
+ * ret_linear = linear_allocator_requirement_add(sizeof(foo_t), alignof(foo_t), &pool_size);
+ * ret_linear = linear_allocator_requirement_add(sizeof(bar_t) * 16, alignof(bar_t), &pool_size);
+ * // pool_sizeの容量でメモリプールを確保し、foo_t, bar_t[16]の順に割り当てると過不足なく割り当てられる
+ * @endcode
+ *
+ * @param[in] req_size_ 割り当て容量(byte)
+ * @param[in] req_align_ 割り当てる構造体インスタンスのアライメント要件
+ * @param[in,out] io_pool_size_ メモリプール必要量(byte)
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_size_ == NULL
+ * - req_align_が2の冪乗ではない
+ * - 加算結果がオーバーフロー
+ * @retval LINEAR_ALLOC_SUCCESS 加算に成功し正常終了
+ *
+ * @see linear_allocator_allocate
+ */
+linear_allocator_result_t linear_allocator_requirement_add(size_t req_size_, size_t req_align_, size_t* io_pool_size_);
+
+/**
+ * @brief linear_allocatorの割り当て状態を破棄し、メモリプール全体を再び割り当て可能な状態に戻す
+ *
+ * @note
+ * - それまでに割り当てたメモリは全て無効となる(内容のクリアは行わない)
+ * - allocator_ == NULLの場合はワーニングを出力し、何もしない
+ *
+ * 使用例:
+ * @code{.c}
+ * void* ptr = NULL;
+ * ret_linear = linear_allocator_allocate(linear_alloc, 128, 8, &ptr);
+ * linear_allocator_reset(linear_alloc);    // ptrは無効となり、以降はメモリプール先頭から割り当てられる
+ * @endcode
+ *
+ * @param[in,out] allocator_ linear_alloc_t型構造体インスタンスへのポインタ
+ */
+void linear_allocator_reset(linear_alloc_t* allocator_);
+
+/**
+ * @brief linear_allocatorの現在の割り当て位置(マーカー)を取得する
+ *
+ * @note
+ * - マーカーはメモリプール先頭からのオフセット(byte)
+ * - 取得したマーカーをlinear_allocator_rewindに渡すことで、マーカー取得以降に割り当てたメモリをまとめて解放できる(LIFOスコープ)
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t marker = 0;
+ * ret_linear = linear_allocator_marker_get(linear_alloc, &marker);
+ *
+ * void* scratch = NULL;
+ * ret_linear = linear_allocator_allocate(linear_alloc, 4 * KIB, 8, &scratch);  // 一時領域として使用
+ * // scratchを使った処理
+ *
+ * ret_linear = linear_allocator_rewind(linear_alloc, marker);  // scratchを解放
+ * @endcode
+ *
+ * @param[in] allocator_ linear_alloc_t型構造体インスタンスへのポインタ
+ * @param[out] out_marker_ マーカー格納先
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - out_marker_ == NULL
+ * @retval LINEAR_ALLOC_SUCCESS 取得に成功し正常終了
+ *
+ * @see linear_allocator_rewind
+ */
+linear_allocator_result_t linear_allocator_marker_get(const linear_alloc_t* allocator_, size_t* out_marker_);
+
+/**
+ * @brief linear_allocatorの割り当て位置をlinear_allocator_marker_getで取得したマーカーの位置まで巻き戻す
+ *
+ * @note
+ * - マーカー取得以降に割り当てたメモリは全て無効となる(内容のクリアは行わない)
+ * - マーカーは取得した順と逆順(LIFO)で使用すること。現在の割り当て位置より先のマーカーへは戻せない
+ *
+ * @param[in,out] allocator_ linear_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] marker_ 巻き戻し先マーカー
+ *
+ * @retval LINEAR_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - marker_が現在の割り当て位置より先(既に巻き戻し済みのスコープのマーカー等)
+ * @retval LINEAR_ALLOC_SUCCESS 巻き戻しに成功し正常終了
+ *
+ * @see linear_allocator_marker_get
+ */
+linear_allocator_result_t linear_allocator_rewind(linear_alloc_t* allocator_, size_t marker_);
+
 #ifdef __cplusplus
 }
 #endif
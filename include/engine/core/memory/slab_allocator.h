@@ -0,0 +1,199 @@
+/** @ingroup core
+ *
+ * @file slab_allocator.h
+ * @author chocolate-pie24
+ * @brief 固定サイズブロックの確保、解放に対応するスラブアロケータモジュールの定義
+ *
+ * @details
+ * メモリアロケータの一つであるSlabAllocator(プールアロケータ)を実装。特徴は、
+ *
+ * - 上位層から渡されたメモリプールを同一サイズのブロックに分割して管理する
+ * - 解放済みブロックは単方向リスト(ブロック自身に埋め込み)で管理し、確保、解放ともにO(1)で動作する
+ * - 未使用ブロックは先頭から順に払い出すため、初期化時にメモリプール全体を走査しない
+ *
+ * gl_choco_engineでは、メモリシステム(choco_memory)の内部で、サイズクラスごとに1インスタンスを使用する
+ *
+ * @note
+ * slab_alloc_t構造体は、内部データを隠蔽している \n
+ * このため、slab_alloc_t型で変数を宣言することはできない \n
+ * 使用の際は、slab_alloc_t*型で宣言すること
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CORE_MEMORY_SLAB_ALLOCATOR_H
+#define GLCE_ENGINE_CORE_MEMORY_SLAB_ALLOCATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief slab_allocator構造体前方宣言
+ * @note 内部データ構造はslab_allocator.cで定義し、外部からは隠蔽する
+ */
+typedef struct slab_alloc slab_alloc_t;
+
+/**
+ * @brief slab_allocator実行結果コードリスト
+ *
+ */
+typedef enum {
+    SLAB_ALLOC_SUCCESS = 0,         /**< 処理成功 */
+    SLAB_ALLOC_NO_MEMORY,           /**< メモリ不足 */
+    SLAB_ALLOC_INVALID_ARGUMENT,    /**< 無効な引数 */
+} slab_allocator_result_t;
+
+/**
+ * @brief slab_alloc_t構造体インスタンスの生成に必要なメモリ使用量とメモリアライメント要件を取得する
+ *
+ * @note
+ * - memory_requirement_ == NULLまたは、align_requirement_ == NULLの場合は何もしない
+ * - 本APIを使用した後、スラブアロケータのメモリを確保し、slab_allocator_initを使用して初期化する
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t memory_requirement = 0;   // メモリ使用量格納先
+ * size_t align_requirement = 0;    // メモリアライメント要件格納先
+ * slab_allocator_preinit(&memory_requirement, &align_requirement);
+ * @endcode
+ *
+ * @param[out] memory_requirement_ メモリ使用量格納先
+ * @param[out] align_requirement_ メモリアライメント要件格納先
+ *
+ * @see slab_allocator_init
+ */
+void slab_allocator_preinit(size_t* memory_requirement_, size_t* align_requirement_);
+
+/**
+ * @brief slab_alloc_t構造体インスタンスをブロックサイズblock_size_、メモリ容量capacity_、メモリプール先頭アドレスmemory_pool_で初期化する
+ *
+ * @note
+ * - ブロックサイズはmax_align_tのアライメントの倍数に切り上げられる
+ * - メモリプールの先頭はmax_align_tにアライメントされるよう内部で調整され、調整分は容量から差し引かれる
+ * - スラブアロケータ構造体インスタンス自体とメモリプールの破棄は上位層で行う
+ *
+ * 使用例:
+ * @code{.c}
+ * slab_alloc_t* slab_alloc = NULL;    // スラブアロケータ
+ * void* slab_pool = NULL;             // メモリプール先頭アドレス
+ * size_t slab_pool_size = 64 * KIB;   // メモリプール容量(64KiB)
+ *
+ * size_t mem_req = 0;
+ * size_t align_req = 0;
+ * slab_allocator_preinit(&mem_req, &align_req);
+ *
+ * slab_alloc = (slab_alloc_t*)malloc(mem_req);
+ * slab_pool = malloc(slab_pool_size);
+ *
+ * slab_allocator_result_t ret = slab_allocator_init(slab_alloc, 64, slab_pool_size, slab_pool);   // 64byteブロック
+ * @endcode
+ *
+ * @param[in,out] allocator_ スラブアロケータ構造体インスタンスアドレス
+ * @param[in] block_size_ 1ブロックのサイズ(byte)
+ * @param[in] capacity_ メモリプール容量(byte)
+ * @param[in] memory_pool_ メモリプールアドレス
+ *
+ * @retval SLAB_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - 引数allocator_ == NULL
+ * - 引数memory_pool_ == NULL
+ * - 引数block_size_ == 0
+ * - アライメント調整後の容量が1ブロックに満たない
+ * @retval SLAB_ALLOC_SUCCESS          スラブアロケータの初期化に成功し、正常終了
+ *
+ * @see slab_allocator_preinit
+ */
+slab_allocator_result_t slab_allocator_init(slab_alloc_t* allocator_, size_t block_size_, size_t capacity_, void* memory_pool_);
+
+/**
+ * @brief slab_allocatorを使用して1ブロックを割り当てる
+ *
+ * @note
+ * - 解放済みブロックがあればそれを優先して再利用し、なければ未使用ブロックを払い出す
+ * - 割り当てたメモリはmax_align_tでアラインされている
+ *
+ * 使用例:
+ * @code{.c}
+ * void* ptr = NULL;
+ * slab_allocator_result_t ret = slab_allocator_allocate(slab_alloc, &ptr);
+ * @endcode
+ *
+ * @param[in,out] allocator_ slab_alloc_t型構造体インスタンスへのポインタ
+ * @param[out] out_ptr_ 割り当てたアドレスを格納する
+ *
+ * @retval SLAB_ALLOC_INVALID_ARGUMENT 以下のいずれか
+ * - allocator_ == NULL
+ * - out_ptr_ == NULL
+ * - *out_ptr_ != NULL
+ * @retval SLAB_ALLOC_NO_MEMORY 空きブロックが存在しない
+ * @retval SLAB_ALLOC_SUCCESS   メモリ割り当てに成功し正常終了
+ *
+ * @see slab_allocator_free
+ */
+slab_allocator_result_t slab_allocator_allocate(slab_alloc_t* allocator_, void** out_ptr_);
+
+/**
+ * @brief slab_allocator_allocateで割り当てたブロックを解放し、空きブロックリストに戻す
+ *
+ * @note
+ * - 下記の場合はワーニングを出力し、何もしない
+ *   - allocator_ == NULL または ptr_ == NULL
+ *   - ptr_がメモリプール外のアドレス、またはブロック先頭アドレスではない
+ *   - 割り当て中のブロックが存在しない
+ * - 2重解放は検出しないため、呼び出し側で防止すること
+ *
+ * @param[in,out] allocator_ slab_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] ptr_ 解放するブロックアドレス
+ *
+ * @see slab_allocator_allocate
+ */
+void slab_allocator_free(slab_alloc_t* allocator_, void* ptr_);
+
+/**
+ * @brief ptr_がallocator_の管理するメモリプール内のアドレスかを判定する
+ *
+ * @param[in] allocator_ 判定に使用するslab_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] ptr_ 判定対象アドレス
+ *
+ * @retval true  ptr_はメモリプール内のアドレス
+ * @retval false 以下のいずれか
+ * - allocator_ == NULL または ptr_ == NULL
+ * - ptr_はメモリプール外のアドレス
+ */
+bool slab_allocator_owns(const slab_alloc_t* allocator_, const void* ptr_);
+
+/**
+ * @brief allocator_の1ブロックのサイズを取得する
+ *
+ * @note allocator_ == NULLの場合は0を返す
+ *
+ * @param[in] allocator_ 取得対象slab_alloc_t型構造体インスタンスへのポインタ
+ *
+ * @return size_t アライメント調整後のブロックサイズ(byte)
+ */
+size_t slab_allocator_block_size(const slab_alloc_t* allocator_);
+
+/**
+ * @brief allocator_で現在割り当て中のブロック数を取得する
+ *
+ * @note allocator_ == NULLの場合は0を返す
+ *
+ * @param[in] allocator_ 取得対象slab_alloc_t型構造体インスタンスへのポインタ
+ *
+ * @return size_t 割り当て中ブロック数
+ */
+size_t slab_allocator_used_count(const slab_alloc_t* allocator_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,160 @@
+/** @ingroup core
+ *
+ * @file virtual_arena.h
+ * @author chocolate-pie24
+ * @brief 仮想アドレス空間を予約し、使用量に応じて物理メモリをコミットする仮想メモリアリーナモジュールの定義
+ *
+ * @details
+ * 初期化時に大きな仮想アドレス範囲をアクセス不可(PROT_NONE)で予約し、使用範囲の拡大に合わせてページ単位でコミット(読み書き可能化)する。特徴は、
+ *
+ * - 予約した範囲の先頭アドレスは変化しないため、拡張時もポインタの再配置が発生しない
+ * - コミットしていない範囲は物理メモリを消費しない
+ * - コミットはページサイズの倍数かつVIRTUAL_ARENA_COMMIT_GRANULARITY単位で行い、システムコールの回数を抑える
+ *
+ * gl_choco_engineでは、linear_allocator_init_virtualによりリニアアロケータのメモリプールとして使用する
+ *
+ * @note
+ * virtual_arena_t構造体は、内部データを隠蔽している \n
+ * このため、virtual_arena_t型で変数を宣言することはできない \n
+ * 使用の際は、virtual_arena_t*型で宣言すること
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_ENGINE_CORE_MEMORY_VIRTUAL_ARENA_H
+#define GLCE_ENGINE_CORE_MEMORY_VIRTUAL_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/**
+ * @brief virtual_arena構造体前方宣言
+ * @note 内部データ構造はvirtual_arena.cで定義し、外部からは隠蔽する
+ */
+typedef struct virtual_arena virtual_arena_t;
+
+/**
+ * @brief virtual_arena実行結果コードリスト
+ *
+ */
+typedef enum {
+    VIRTUAL_ARENA_SUCCESS = 0,          /**< 処理成功 */
+    VIRTUAL_ARENA_NO_MEMORY,            /**< 仮想アドレス空間の予約(mmap)、またはコミット(mprotect)失敗 */
+    VIRTUAL_ARENA_INVALID_ARGUMENT,     /**< 無効な引数 */
+    VIRTUAL_ARENA_LIMIT_EXCEEDED,       /**< 予約範囲を超えるコミット要求 */
+} virtual_arena_result_t;
+
+/**
+ * @brief virtual_arena_t構造体インスタンスの生成に必要なメモリ使用量とメモリアライメント要件を取得する
+ *
+ * @note memory_requirement_ == NULLまたは、align_requirement_ == NULLの場合は何もしない
+ *
+ * @param[out] memory_requirement_ メモリ使用量格納先
+ * @param[out] align_requirement_ メモリアライメント要件格納先
+ *
+ * @see virtual_arena_init
+ */
+void virtual_arena_preinit(size_t* memory_requirement_, size_t* align_requirement_);
+
+/**
+ * @brief 仮想アドレス空間をreserve_size_分予約し、virtual_arena_t構造体インスタンスを初期化する
+ *
+ * @note
+ * - 予約容量はページサイズの倍数に切り上げられる
+ * - 初期化直後は何もコミットされておらず、物理メモリを消費しない
+ * - 予約した仮想アドレス空間はvirtual_arena_deinitで解放する
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t mem_req = 0;
+ * size_t align_req = 0;
+ * virtual_arena_preinit(&mem_req, &align_req);
+ *
+ * virtual_arena_t* arena = NULL;
+ * memory_system_allocate(mem_req, MEMORY_TAG_SYSTEM, (void**)&arena);
+ *
+ * virtual_arena_result_t ret = virtual_arena_init(arena, 1 * GIB); // 1GiBを予約(物理メモリは消費しない)
+ * @endcode
+ *
+ * @param[in,out] arena_ 初期化対象virtual_arena_t構造体インスタンスへのポインタ
+ * @param[in] reserve_size_ 予約する仮想アドレス空間の容量(byte)
+ *
+ * @retval VIRTUAL_ARENA_INVALID_ARGUMENT 以下のいずれか
+ * - arena_ == NULL
+ * - reserve_size_ == 0
+ * - ページサイズへの切り上げでオーバーフロー
+ * @retval VIRTUAL_ARENA_NO_MEMORY 仮想アドレス空間の予約に失敗
+ * @retval VIRTUAL_ARENA_SUCCESS 予約に成功し、正常終了
+ *
+ * @see virtual_arena_deinit
+ */
+virtual_arena_result_t virtual_arena_init(virtual_arena_t* arena_, size_t reserve_size_);
+
+/**
+ * @brief virtual_arena_initで予約した仮想アドレス空間を解放する
+ *
+ * @note
+ * - arena_ == NULL、または予約していない場合は何もしない
+ * - virtual_arena_t構造体インスタンス自体のメモリは解放しない
+ *
+ * @param[in,out] arena_ 処理対象virtual_arena_t構造体インスタンスへのポインタ
+ */
+void virtual_arena_deinit(virtual_arena_t* arena_);
+
+/**
+ * @brief 予約範囲の先頭からcommit_size_までの範囲を読み書き可能な状態にする
+ *
+ * @note
+ * - 既にコミット済みの範囲に収まる場合は何もしない
+ * - コミットはページサイズの倍数かつVIRTUAL_ARENA_COMMIT_GRANULARITY単位で切り上げて行う(予約範囲を上限とする)
+ *
+ * @param[in,out] arena_ 処理対象virtual_arena_t構造体インスタンスへのポインタ
+ * @param[in] commit_size_ 予約範囲先頭からのコミット要求サイズ(byte)
+ *
+ * @retval VIRTUAL_ARENA_INVALID_ARGUMENT arena_ == NULL、または未予約
+ * @retval VIRTUAL_ARENA_LIMIT_EXCEEDED commit_size_が予約容量を超過
+ * @retval VIRTUAL_ARENA_NO_MEMORY コミット(mprotect)に失敗
+ * @retval VIRTUAL_ARENA_SUCCESS コミットに成功し、正常終了
+ */
+virtual_arena_result_t virtual_arena_commit(virtual_arena_t* arena_, size_t commit_size_);
+
+/**
+ * @brief 予約した仮想アドレス空間の先頭アドレスを取得する
+ *
+ * @param[in] arena_ 取得対象virtual_arena_t構造体インスタンスへのポインタ
+ *
+ * @return void* 先頭アドレス(arena_ == NULL、または未予約の場合はNULL)
+ */
+void* virtual_arena_base_get(const virtual_arena_t* arena_);
+
+/**
+ * @brief 予約容量を取得する
+ *
+ * @param[in] arena_ 取得対象virtual_arena_t構造体インスタンスへのポインタ
+ *
+ * @return size_t ページサイズに切り上げ後の予約容量(byte)(arena_ == NULLの場合は0)
+ */
+size_t virtual_arena_reserved_size_get(const virtual_arena_t* arena_);
+
+/**
+ * @brief コミット済み容量を取得する
+ *
+ * @param[in] arena_ 取得対象virtual_arena_t構造体インスタンスへのポインタ
+ *
+ * @return size_t コミット済み容量(byte)(arena_ == NULLの場合は0)
+ */
+size_t virtual_arena_committed_size_get(const virtual_arena_t* arena_);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
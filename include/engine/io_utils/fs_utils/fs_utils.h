@@ -54,7 +54,9 @@ typedef enum {
  * - filepath_の末尾には必ず'/'をつける
  * - extensionは必ず'.'から始めること
  *
- * @note filepath/filename.extentionのファイルがopen_mode_でopenされる
+ * @note
+ * - filepath/filename.extentionのファイルがopen_mode_でopenされる
+ * - フルパスは1つの文字列コンテナに組み立てて保持する(ファイルパス/ファイル名/拡張子ごとの文字列コンテナは生成しない)
  *
  * @code{.c}
  * fs_utils_t* fs_utils = NULL;
@@ -133,9 +135,11 @@ void fs_utils_destroy(fs_utils_t** fs_utils_);
 fs_utils_result_t fs_utils_text_file_read(fs_utils_t* fs_utils_, choco_string_t* out_string_);
 
 /**
- * @brief fs_utils_が保持するファイルパス,ファイル名,拡張子の文字列からフルパス文字列を生成する
+ * @brief fs_utils_が保持するフルパス(ファイルパス + ファイル名 + 拡張子)文字列をout_fullpath_にコピーする
  *
- * @note 処理に失敗した場合,out_fullpath_の内部データは変更される可能性がある
+ * @note
+ * - 処理に失敗した場合,out_fullpath_の内部データは変更される可能性がある
+ * - フルパスを読み取るだけの場合は、文字列コンテナを必要としない @ref fs_utils_fullpath_c_str を使用すること
  * @warning out_fullpath_は @ref choco_string_default_create @ref choco_string_create_from_c_string によって初期化されたインスタンスを渡すこと
  *
  * @param fs_utils_ fs_utils_t構造体インスタンスへのポインタ
@@ -144,32 +148,32 @@ fs_utils_result_t fs_utils_text_file_read(fs_utils_t* fs_utils_, choco_string_t*
  * @retval FS_UTILS_INVALID_ARGUMENT 以下のいずれか
  * - fs_utils_がNULL
  * - out_fullpath_がNULL
- * - filepathの文字列をコピーする際にchoco_string_copyがCHOCO_STRING_INVALID_ARGUMENTを返した
- * - filenameの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_INVALID_ARGUMENTを返した
- * - extensionの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_INVALID_ARGUMENTを返した
+ * - choco_string_copyがCHOCO_STRING_INVALID_ARGUMENTを返した
  * @retval FS_UTILS_DATA_CORRUPTED 以下のいずれか
  * - fs_utils_の内部状態が無効もしくは未初期化
- * - filepathの文字列をコピーする際にchoco_string_copyがCHOCO_STRING_DATA_CORRUPTEDを返した
- * - filenameの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_DATA_CORRUPTEDを返した
- * - extensionの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_DATA_CORRUPTEDを返した
- * @retval FS_UTILS_OVERFLOW 以下のいずれか
- * - filepathの文字列をコピーする際にchoco_string_copyがCHOCO_STRING_OVERFLOWを返した
- * - filenameの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_OVERFLOWを返した
- * - extensionの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_OVERFLOWを返した
- * @retval FS_UTILS_NO_MEMORY 以下のいずれか
- * - filepathの文字列をコピーする際にchoco_string_copyがCHOCO_STRING_NO_MEMORYを返した
- * - filenameの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_NO_MEMORYを返した
- * - extensionの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_NO_MEMORYを返した
- * @retval FS_UTILS_LIMIT_EXCEEDED 以下のいずれか
- * - filepathの文字列をコピーする際にchoco_string_copyがCHOCO_STRING_LIMIT_EXCEEDEDを返した
- * - filenameの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_LIMIT_EXCEEDEDを返した
- * - extensionの文字列をコピーする際にchoco_string_concatがCHOCO_STRING_LIMIT_EXCEEDEDを返した
+ * - choco_string_copyがCHOCO_STRING_DATA_CORRUPTEDを返した
+ * @retval FS_UTILS_OVERFLOW choco_string_copyがCHOCO_STRING_OVERFLOWを返した
+ * @retval FS_UTILS_NO_MEMORY choco_string_copyがCHOCO_STRING_NO_MEMORYを返した
+ * @retval FS_UTILS_LIMIT_EXCEEDED choco_string_copyがCHOCO_STRING_LIMIT_EXCEEDEDを返した
  * @retval FS_UTILS_UNDEFINED_ERROR 処理過程において想定外のエラーコードを受け取った
  * @retval FS_UTILS_BAD_OPERATION メモリシステム未初期化
- * @retval FS_UTILS_SUCCESS フルパス文字列の生成に成功し,正常終了
+ * @retval FS_UTILS_SUCCESS フルパス文字列のコピーに成功し,正常終了
  */
 fs_utils_result_t fs_utils_fullpath_get(fs_utils_t* fs_utils_, choco_string_t* out_fullpath_);
 
+/**
+ * @brief fs_utils_が保持するフルパス(ファイルパス + ファイル名 + 拡張子)文字列の先頭アドレスを取得する
+ *
+ * @note
+ * - 取得した文字列は @ref fs_utils_destroy でfs_utils_が破棄されるまで有効
+ * - 文字列のコピーを行わないため、メモリ確保は発生しない
+ *
+ * @param fs_utils_ fs_utils_t構造体インスタンスへのポインタ
+ *
+ * @return const char* フルパス文字列(fs_utils_ == NULL、またはfs_utils_の内部状態が無効もしくは未初期化の場合はNULL)
+ */
+const char* fs_utils_fullpath_c_str(const fs_utils_t* fs_utils_);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,15 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
+
+/**
+ * @brief ピクセルデータバッファの先頭アドレスのアライメント(byte)
+ *
+ * @note SIMD命令(AVX-512の64byteロード)やGPU転送用ステージングでの使用を想定し、キャッシュライン境界に揃える
+ */
+#define RESOURCE_PIXEL_ALIGNMENT ((size_t)64)
+
 /**
  * @brief Resourceレイヤー実行結果コード定義
  *
@@ -25,6 +25,8 @@ extern "C" {
 
 #include "engine/resource/resource_core/resource_types.h"
 
+#include "engine/containers/string_intern.h"
+
 typedef struct texture texture_t; /**< テクスチャCPU側リソース内部状態管理構造体前方宣言 */
 
 /**
@@ -73,7 +75,7 @@ void texture_destroy(texture_t** texture_);
  *
  * @retval RESOURCE_INVALID_ARGUMENT texture_ == NULL
  * @retval RESOURCE_DATA_CORRUPTED 以下のいずれか
- * - texture_->name == NULL
+ * - texture_->nameが未登録(内部データ破損)
  * - 計算過程でのデータ破損
  * @retval RESOURCE_BAD_OPERATION 以下のいずれか
  * - texture_->pixels != NULL
@@ -100,7 +102,7 @@ resource_result_t texture_pixel_load(texture_t* texture_, const char* filepath_,
  * @param[in,out] texture_ メモリ解放、初期化対象構造体インスタンスへのポインタ
  *
  * @retval RESOURCE_INVALID_ARGUMENT texture_ == NULL
- * @retval RESOURCE_DATA_CORRUPTED texture_->name == NULL
+ * @retval RESOURCE_DATA_CORRUPTED texture_->nameが未登録(内部データ破損)
  * @retval RESOURCE_BAD_OPERATION 以下のいずれか
  * - texture_->channel_count == 0
  * - texture_->height == 0
@@ -127,7 +129,7 @@ resource_result_t texture_pixel_unload(texture_t* texture_);
  * - texture_->pixels == NULL
  * - texture_->width == 0
  * - texture_->height == 0
- * @retval RESOURCE_DATA_CORRUPTED texture_->name == NULL
+ * @retval RESOURCE_DATA_CORRUPTED texture_->nameが未登録(内部データ破損)
  * @retval RESOURCE_SUCCESS 処理に成功し、正常終了
  */
 resource_result_t texture_pixel_get(const texture_t* texture_, uint8_t** out_pixels_);
@@ -152,7 +154,7 @@ resource_result_t texture_pixel_get(const texture_t* texture_, uint8_t** out_pix
  * - texture_->pixels == NULL
  * - texture_->width == 0
  * - texture_->height == 0
- * @retval RESOURCE_DATA_CORRUPTED texture_->name == NULL
+ * @retval RESOURCE_DATA_CORRUPTED texture_->nameが未登録(内部データ破損)
  * @retval RESOURCE_SUCCESS 処理に成功し、正常終了
  */
 resource_result_t texture_pixel_size_get(const texture_t* texture_, uint16_t* width_, uint16_t* height_, uint8_t* channel_count_);
@@ -160,8 +162,8 @@ resource_result_t texture_pixel_size_get(const texture_t* texture_, uint16_t* wi
 /**
  * @brief texture_が保持するテクスチャ名称をchar*型文字列で取得する
  *
- * @note texture_ == NULLまたはtexture_->name == NULLの場合はNULLが返される
- * @note texture_->nameがNULLの場合は、データ破損(createで必ず初期化されるため)のため、ワーニングメッセージを出力する
+ * @note texture_ == NULLまたはtexture_->nameが未登録の場合はNULLが返される
+ * @note texture_->nameが未登録の場合は、データ破損(createで必ず登録されるため)のため、ワーニングメッセージを出力する
  *
  * @param[in] texture_ テクスチャ名称取得元構造体インスタンスへのポインタ
  *
@@ -169,6 +171,18 @@ resource_result_t texture_pixel_size_get(const texture_t* texture_, uint16_t* wi
  */
 const char* texture_name_get(const texture_t* texture_);
 
+/**
+ * @brief texture_が保持するテクスチャ名称のアトムを取得する
+ *
+ * @note テクスチャ名称は文字列インターンテーブルに登録されており、同一名称のアトムは常に等しい。名称の一致判定はアトムの比較で行える
+ * @note texture_ == NULLまたはtexture_->nameが未登録の場合はSTRING_ATOM_INVALIDが返される(未登録の場合はワーニングメッセージを出力する)
+ *
+ * @param[in] texture_ テクスチャ名称取得元構造体インスタンスへのポインタ
+ *
+ * @return string_atom_t テクスチャ名称のアトム
+ */
+string_atom_t texture_name_atom_get(const texture_t* texture_);
+
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,8 @@ extern "C" {
 
 #include "engine/base/choco_math/math_types.h"
 
+#include "engine/containers/string_intern.h"
+
 typedef struct camera camera_t; /**< カメラ内部状態管理構造体前方宣言 */
 
 /**
@@ -62,7 +64,7 @@ void camera_destroy(camera_t** camera_);
  *
  * @note 以下の場合はエラーメッセージを出力し、NULLを返す
  * - camera_ == NULL
- * - camera_->name == NULL
+ * - カメラ名称が未登録(内部データ破損)
  *
  * @param[in] camera_ カメラ構造体インスタンスへのポインタ
  *
@@ -70,6 +72,21 @@ void camera_destroy(camera_t** camera_);
  */
 const char* camera_name_get(const camera_t* camera_);
 
+/**
+ * @brief カメラ構造体が保持するカメラ名称のアトムを取得する
+ *
+ * @note
+ * - カメラ名称は文字列インターンテーブルに登録されており、同一名称のアトムは常に等しい。名称の一致判定はアトムの比較で行える
+ * - 以下の場合はエラーメッセージを出力し、STRING_ATOM_INVALIDを返す
+ *   - camera_ == NULL
+ *   - カメラ名称が未登録(内部データ破損)
+ *
+ * @param[in] camera_ カメラ構造体インスタンスへのポインタ
+ *
+ * @return string_atom_t カメラ名称のアトム
+ */
+string_atom_t camera_name_atom_get(const camera_t* camera_);
+
 /**
  * @brief カメラ構造体が管理する視錐台パラメータを更新(または初期化)する
  *
@@ -23,6 +23,8 @@ extern "C" {
 #include "engine/systems/camera_system/camera_core/camera_types.h"
 
 #include "engine/containers/choco_string.h"
+#include "engine/containers/hash_map.h"
+#include "engine/containers/sparse_set.h"
 
 #include "engine/core/memory/choco_memory.h"
 #include "engine/core/memory/linear_allocator.h"
@@ -63,6 +65,28 @@ camera_result_t camera_rslt_convert_choco_string(choco_string_result_t rslt_);
  */
 camera_result_t camera_rslt_convert_linear_alloc(linear_allocator_result_t rslt_);
 
+/**
+ * @brief hash_mapモジュールの実行結果コードをカメラシステムレイヤー実行結果コードに変換する
+ *
+ * @note キー未登録(HASH_MAP_KEY_NOT_FOUND)、キー登録済み(HASH_MAP_KEY_EXISTS)はAPI誤用(CAMERA_BAD_OPERATION)として扱う
+ *
+ * @param[in] rslt_ hash_mapモジュール実行結果コード
+ *
+ * @return camera_result_t 変換されたカメラシステムレイヤー実行結果コード
+ */
+camera_result_t camera_rslt_convert_hash_map(hash_map_result_t rslt_);
+
+/**
+ * @brief sparse_setモジュールの実行結果コードをカメラシステムレイヤー実行結果コードに変換する
+ *
+ * @note ID未登録(SPARSE_SET_ID_NOT_FOUND)、ID登録済み(SPARSE_SET_ID_EXISTS)はAPI誤用(CAMERA_BAD_OPERATION)として扱う
+ *
+ * @param[in] rslt_ sparse_setモジュール実行結果コード
+ *
+ * @return camera_result_t 変換されたカメラシステムレイヤー実行結果コード
+ */
+camera_result_t camera_rslt_convert_sparse_set(sparse_set_result_t rslt_);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,26 @@ typedef struct camera camera_t;                 /**< カメラ構造体前方宣
 
 #define INVALID_CAMERA_ID (-1)  /**< 無効なカメラ識別子定義 */
 
+/**
+ * @brief カメラ管理システムの初期化に必要なリニアアロケータのメモリプール容量をio_pool_requirement_に加算する
+ *
+ * @note camera_manager_initializeと同じ順序、アライメント要件で割り当て要求(管理構造体、カメラ格納配列、名称インデックス、登録中IDの集合)を加算する
+ *
+ * @param[in] max_camera_count_ カメラ管理システムに登録可能なカメラ数上限値
+ * @param[in,out] io_pool_requirement_ メモリプール必要量(byte)
+ *
+ * @retval CAMERA_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_requirement_ == NULL
+ * - max_camera_count_ <= 0
+ * - 加算結果がオーバーフロー
+ * @retval CAMERA_RUNTIME_ERROR 名称インデックス、または登録中IDの集合の必要量の計算過程でオーバーフローが発生
+ * @retval CAMERA_SUCCESS 処理に成功し、正常終了
+ *
+ * @see camera_manager_initialize
+ * @see linear_allocator_requirement_add
+ */
+camera_result_t camera_manager_preinit(int16_t max_camera_count_, size_t* io_pool_requirement_);
+
 /**
  * @brief カメラ管理システムのメモリを確保し、初期化する
  *
@@ -55,6 +75,8 @@ camera_result_t camera_manager_initialize(int16_t max_camera_count_, linear_allo
 /**
  * @brief カメラ管理システムが管理するカメラ構造体インスタンスを全て削除する
  *
+ * @note 全スロットではなく、登録中のカメラIDのみを走査する
+ *
  * @warning カメラ管理システム自身はリニアアロケータによるメモリ確保であるため、自身のリソース破棄は行わない
  *
  * @param[in,out] camera_manager_ 処理対象カメラ管理システム構造体インスタンスへのポインタ
@@ -75,6 +97,8 @@ void camera_manager_deinitialize(camera_manager_t* camera_manager_);
  * @retval CAMERA_BAD_OPERATION 以下のいずれか
  * - camera_manager_->max_camera_count <= 0
  * - camera_manager_->camera_array == NULL
+ * - camera_manager_->name_index == NULL
+ * - camera_manager_->live_ids == NULL
  * - 追加するカメラ名称が既にカメラ管理システムに登録されている
  * @retval CAMERA_LIMIT_EXCEEDED 以下のいずれか
  * - カメラ管理システムに空き領域がない
@@ -97,7 +121,10 @@ camera_result_t camera_manager_register(const char* camera_name_, camera_manager
  * @retval CAMERA_BAD_OPERATION 以下のいずれか
  * - camera_manager_->max_camera_count <= 0
  * - camera_manager_->camera_array == NULL
+ * - camera_manager_->name_index == NULL
+ * - camera_manager_->live_ids == NULL
  * - カメラIDに対応するカメラが管理システム内に見つからない
+ * @retval CAMERA_DATA_CORRUPTED カメラが名称インデックス、または登録中IDの集合に登録されていない(カメラ管理システム内部データ破損)
  * @retval CAMERA_SUCCESS 処理に成功し、正常終了
  */
 camera_result_t camera_manager_unregister(int16_t camera_id_, camera_manager_t* camera_manager_);
@@ -114,6 +141,8 @@ camera_result_t camera_manager_unregister(int16_t camera_id_, camera_manager_t*
  * @retval CAMERA_BAD_OPERATION 以下のいずれか
  * - camera_manager_->max_camera_count <= 0
  * - camera_manager_->camera_array == NULL
+ * - camera_manager_->name_index == NULL
+ * - camera_manager_->live_ids == NULL
  * - カメラ名称に対応するカメラが管理システム内に見つからない
  * @retval CAMERA_DATA_CORRUPTED カメラ管理システム内部データ破損
  * @retval CAMERA_SUCCESS 処理に成功し、正常終了
@@ -123,6 +152,8 @@ camera_result_t camera_manager_unregister_by_name(const char* name_, camera_mana
 /**
  * @brief カメラ名称に対応するカメラ識別子をカメラ管理システムから取得する
  *
+ * @note 名称インデックス(ハッシュマップ)から検索するため、登録済みカメラ数によらず一定時間で処理する
+ *
  * @param[in] name_ 識別子を取得するカメラの名称
  * @param[in] camera_manager_ 取得元カメラ管理システム構造体インスタンスへのポインタ
  * @param[out] out_camera_id_ カメラ識別子格納先
@@ -38,6 +38,35 @@ extern "C" {
  */
 typedef struct platform_context platform_context_t;
 
+/**
+ * @brief プラットフォームStrategyパターンの初期化に必要なリニアアロケータのメモリプール容量をio_pool_requirement_に加算する
+ *
+ * @note
+ * - platform_initializeと同じ順序、アライメント要件で割り当て要求(コンテキスト、プラットフォームバックエンド)を加算する
+ * - リニアアロケータのメモリプール確保前に呼び出し、メモリプール容量の算出に使用する
+ *
+ * 使用例:
+ * @code{.c}
+ * size_t pool_size = 0;
+ * platform_result_t ret = platform_preinit(PLATFORM_USE_GLFW, &pool_size);
+ * // エラー処理
+ * @endcode
+ *
+ * @param[in] platform_type_ プラットフォーム種別
+ * @param[in,out] io_pool_requirement_ メモリプール必要量(byte)
+ *
+ * @retval PLATFORM_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_requirement_ == NULL
+ * - platform_type_が無効値
+ * - 加算結果がオーバーフロー
+ * @retval PLATFORM_RUNTIME_ERROR vtable取得失敗
+ * @retval PLATFORM_SUCCESS 加算に成功し、正常終了
+ *
+ * @see platform_initialize
+ * @see linear_allocator_requirement_add
+ */
+platform_result_t platform_preinit(platform_type_t platform_type_, size_t* io_pool_requirement_);
+
 /**
  * @brief プラットフォームStrategyパターンを初期化する
  *
@@ -27,6 +27,21 @@ extern "C" {
 
 typedef struct renderer_backend_context renderer_backend_context_t; /**< renderer_backend_context内部情報管理構造体前方宣言 */
 
+/**
+ * @brief レンダラーバックエンドの初期化に必要なリニアアロケータのメモリプール容量をio_pool_requirement_に加算する
+ *
+ * @note renderer_backend_initializeと同じ順序、アライメント要件で割り当て要求を加算する
+ *
+ * @param target_api_ 使用するグラフィックスAPI
+ * @param io_pool_requirement_ メモリプール必要量(byte)
+ * @retval RENDERER_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_requirement_ == NULL
+ * - target_api_が既定値外
+ * - 加算結果がオーバーフロー
+ * @retval RENDERER_SUCCESS 処理に成功し、正常終了
+ */
+renderer_result_t renderer_backend_preinit(target_graphics_api_t target_api_, size_t* io_pool_requirement_);
+
 /**
  * @brief レンダラーバックエンドのメモリを確保し、初期化を行う
  *
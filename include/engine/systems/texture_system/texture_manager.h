@@ -20,6 +20,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct texture_manager texture_manager_t;   /**< texture_manager_t構造体前方宣言 */
@@ -50,6 +51,26 @@ typedef enum {
     TEXTURE_SYSTEM_UNDEFINED_ERROR,    /**< 未定義エラー */
 } texture_system_result_t;
 
+/**
+ * @brief テクスチャ管理システムの初期化に必要なリニアアロケータのメモリプール容量をio_pool_requirement_に加算する
+ *
+ * @note texture_manager_initializeと同じ順序、アライメント要件で割り当て要求(管理構造体、CPU / GPUリソース配列、名称インデックス、登録中IDの集合)を加算する
+ *
+ * @param[in] max_texture_count_ システムで使用するテクスチャ最大数
+ * @param[in,out] io_pool_requirement_ メモリプール必要量(byte)
+ *
+ * @retval TEXTURE_SYSTEM_INVALID_ARGUMENT 以下のいずれか
+ * - io_pool_requirement_ == NULL
+ * - max_texture_count_ <= 0
+ * - 加算結果がオーバーフロー
+ * @retval TEXTURE_SYSTEM_OVERFLOW 名称インデックス、または登録中IDの集合の必要量の計算過程でオーバーフローが発生
+ * @retval TEXTURE_SYSTEM_SUCCESS 処理に成功し、正常終了
+ *
+ * @see texture_manager_initialize
+ * @see linear_allocator_requirement_add
+ */
+texture_system_result_t texture_manager_preinit(int16_t max_texture_count_, size_t* io_pool_requirement_);
+
 /**
  * @brief テクスチャ管理システムのメモリを確保し、テクスチャリソース(CPU / GPU)配列の要素を全てNULLで初期化する
  *
@@ -73,6 +94,7 @@ texture_system_result_t texture_manager_initialize(int16_t max_texture_count_, l
  * @brief テクスチャリソース(CPU / GPU)管理システムが管理するすべてのリソースを解放し、リソース配列の要素をすべてNULLで初期化する
  *
  * @note texture_manager_自身のメモリは解放しない
+ * @note 全スロットではなく、登録中のテクスチャIDのみを走査する
  * @note 以下の場合はワーニングメッセージを出力する
  * - backend_context_ == NULL
  * - texture_manager_ == NULL
@@ -165,6 +187,8 @@ texture_system_result_t texture_manager_unregister_by_name(renderer_backend_cont
 /**
  * @brief テクスチャリソース管理システムからテクスチャ名称に対応するテクスチャ識別子を取得する
  *
+ * @note 名称インデックス(ハッシュマップ)から検索するため、登録済みテクスチャ数によらず一定時間で処理する
+ *
  * @param[in] name_ 識別子取得対象テクスチャ名称
  * @param[in] texture_manager_ テクスチャリソース管理システム構造体インスタンスへのポインタ
  * @param[out] out_texture_id_ テクスチャ識別子格納先
@@ -53,6 +53,8 @@ COMPILER_FLAGS += -Wno-documentation
 COMPILER_FLAGS += -Wno-reserved-identifier
 # flockfile / funlockfileを使用するために必要(非標準CのPOSIX関数)
 COMPILER_FLAGS += -D_POSIX_C_SOURCE=200809L
+# メモリシステムのスレッド対応(pthread)
+COMPILER_FLAGS += -pthread
 
 ifeq ($(BUILD_MODE), RELEASE_BUILD)
 	COMPILER_FLAGS += -O3 -DRELEASE_BUILD -DPLATFORM_LINUX
@@ -76,6 +78,7 @@ COMPILER_FLAGS += $(SAN_CFLAGS)
 LINKER_FLAGS   += $(SAN_LDFLAGS)
 
 LINKER_FLAGS += -L/usr/lib/x86_64-linux-gnu/
+LINKER_FLAGS += -pthread
 LINKER_FLAGS += -lm
 LINKER_FLAGS += -lGL
 LINKER_FLAGS += -lglfw
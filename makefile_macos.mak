@@ -57,6 +57,8 @@ COMPILER_FLAGS += -Wno-covered-switch-default
 COMPILER_FLAGS += -Wno-documentation-unknown-command
 COMPILER_FLAGS += -Wno-documentation
 COMPILER_FLAGS += -Wno-reserved-identifier
+# メモリシステムのスレッド対応(pthread)
+COMPILER_FLAGS += -pthread
 
 ifeq ($(BUILD_MODE), RELEASE_BUILD)
 	COMPILER_FLAGS += -O3 -DRELEASE_BUILD -DPLATFORM_MACOS
@@ -79,6 +81,7 @@ OBJ_FILES = $(SRC_FILES:%=$(OBJ_DIR)/%.o)
 COMPILER_FLAGS += $(SAN_CFLAGS)
 LINKER_FLAGS += $(SAN_LDFLAGS)
 
+LINKER_FLAGS += -pthread
 LINKER_FLAGS += -L$(GLEW_PREFIX)/lib
 LINKER_FLAGS += -L$(GLFW_PREFIX)/lib
 LINKER_FLAGS += -lglfw
@@ -39,12 +39,14 @@
 
 #include "engine/core/memory/choco_memory.h"
 #include "engine/core/memory/linear_allocator.h"
+#include "engine/core/memory/frame_allocator.h"
 
 #include "engine/core/event/keyboard_event.h"
 #include "engine/core/event/mouse_event.h"
 #include "engine/core/event/window_event.h"
 
 #include "engine/containers/ring_queue.h"
+#include "engine/containers/ring_queue_typed.h"
 #include "engine/containers/choco_string.h"
 
 #include "engine/systems/platform/platform_core/platform_types.h"
@@ -71,6 +73,11 @@
 
 #include "engine/resource/texture/texture.h"
 
+// イベントコールバック(push)/app_state_update(pop)で使用するイベント型専用リングキュー
+RING_QUEUE_DEFINE_TYPED(app_window_event_queue, window_event_t)
+RING_QUEUE_DEFINE_TYPED(app_keyboard_event_queue, keyboard_event_t)
+RING_QUEUE_DEFINE_TYPED(app_mouse_event_queue, mouse_event_t)
+
 /**
  * @brief アプリケーション内部状態とエンジン各サブシステム状態管理構造体インスタンスを保持する
  *
@@ -93,10 +100,14 @@ typedef struct app_state {
     void* linear_alloc_pool;        /**< リニアアロケータ構造体インスタンスが使用するメモリプールのアドレス */
     linear_alloc_t* linear_alloc;   /**< リニアアロケータ構造体インスタンス */
 
+    // core/memory/frame_allocator
+    frame_alloc_t* frame_alloc;     /**< 1フレームの間だけ有効な一時メモリ用フレームアロケータ(application_runの各フレーム先頭でリセット) */
+    memory_frame_stats_t frame_mem_stats;   /**< 直前のフレームでのメモリタグごとの割り当て差分(application_runの各フレーム先頭でサンプリング) */
+
     // event message queues
-    ring_queue_t* window_event_queue;   /**< ウィンドウイベント格納用リングキュー */
-    ring_queue_t* keyboard_event_queue; /**< キーボードイベント格納用リングキュー */
-    ring_queue_t* mouse_event_queue;    /**< マウスイベント格納用リングキュー */
+    app_window_event_queue_t window_event_queue;       /**< ウィンドウイベント格納用リングキュー */
+    app_keyboard_event_queue_t keyboard_event_queue;   /**< キーボードイベント格納用リングキュー */
+    app_mouse_event_queue_t mouse_event_queue;         /**< マウスイベント格納用リングキュー */
 
     // platform/platform_context
     platform_context_t* platform_context; /**< プラットフォームStrategyパターンへの窓口としてのコンテキスト構造体インスタンス */
@@ -121,6 +132,17 @@ typedef struct app_state {
     // end temporary
 } app_state_t;
 
+/**
+ * @brief フレームアロケータの1フレームあたりの容量
+ *
+ * @note フレームアロケータはダブルバッファのため、リニアアロケータからはこの2倍の容量を確保する
+ */
+#define APP_FRAME_ALLOC_CAPACITY (32 * KIB)
+
+#define APP_MAX_CAMERA_COUNT 8      /**< カメラ管理システムに登録可能なカメラ数上限値 */
+#define APP_MAX_TEXTURE_COUNT 128   /**< テクスチャ管理システムで使用するテクスチャ最大数 */
+#define APP_EVENT_DRAIN_BATCH 16    /**< app_state_updateでイベントキューから1回のring_queue_pop_nで取り出すイベント数 */
+
 static app_state_t* s_app_state = NULL; /**< アプリケーション内部状態およびエンジン各サブシステム内部状態 */
 
 static void on_window(const window_event_t* event_);
@@ -130,6 +152,8 @@ static void on_mouse(const mouse_event_t* event_);
 static void app_state_update(void);
 static void app_state_dispatch(void);
 static void app_state_clean(void);
+static void app_frame_mem_stats_report(void);
+static void app_event_queue_stats_report(void);
 
 application_result_t application_create(void) {
     app_state_t* tmp = NULL;
@@ -173,10 +197,41 @@ application_result_t application_create(void) {
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Simulation -> launch all systems -> create linear allocator.(Don't use s_app_state here.)
     // [NOTE] linear_allocatorのプールサイズについて
-    //   全サブシステムのpreinitを先に実行し、リニアアロケータで必要な容量を計算可能だが、
-    //   各サブシステムのアライメント要件を考慮すると単純に総和を取れば良いと言うものではなく、ちょっと複雑
-    //   当面は実施せず、多めにメモリを確保する方針にする
+    //   全サブシステムのpreinitで、各サブシステムの割り当て要求をアライメント調整分を含めて加算し、過不足のない容量を算出する
+    //   アライメント調整分は割り当て順に依存するため、preinitは下記の各サブシステムの初期化と同じ順序で呼び出すこと
     INFO_MESSAGE("Initializing linear allocator...");
+    tmp->linear_alloc_pool_size = 0;
+    ret_linear_alloc = frame_allocator_preinit(APP_FRAME_ALLOC_CAPACITY, &tmp->linear_alloc_pool_size);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = app_rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("application_create(%s) - Failed to get frame allocator pool requirement.", app_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_platform = platform_preinit(PLATFORM_USE_GLFW, &tmp->linear_alloc_pool_size);
+    if(PLATFORM_SUCCESS != ret_platform) {
+        ret = app_rslt_convert_platform(ret_platform);
+        ERROR_MESSAGE("application_create(%s) - Failed to get platform pool requirement.", app_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_camera = camera_manager_preinit(APP_MAX_CAMERA_COUNT, &tmp->linear_alloc_pool_size);
+    if(CAMERA_SUCCESS != ret_camera) {
+        ret = app_rslt_convert_camera(ret_camera);
+        ERROR_MESSAGE("application_create(%s) - Failed to get camera manager pool requirement.", app_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_tex_sys = texture_manager_preinit(APP_MAX_TEXTURE_COUNT, &tmp->linear_alloc_pool_size);
+    if(TEXTURE_SYSTEM_SUCCESS != ret_tex_sys) {
+        ret = app_rslt_convert_texture_system(ret_tex_sys);
+        ERROR_MESSAGE("application_create(%s) - Failed to get texture manager pool requirement.", app_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_renderer = renderer_backend_preinit(GRAPHICS_API_GL33, &tmp->linear_alloc_pool_size);
+    if(RENDERER_SUCCESS != ret_renderer) {
+        ret = app_rslt_convert_renderer(ret_renderer);
+        ERROR_MESSAGE("application_create(%s) - Failed to get renderer backend pool requirement.", app_rslt_to_str(ret));
+        goto cleanup;
+    }
+
     tmp->linear_alloc = NULL;
     linear_allocator_preinit(&tmp->linear_alloc_mem_req, &tmp->linear_alloc_align_req);
     ret_mem_sys = memory_system_allocate(tmp->linear_alloc_mem_req, MEMORY_TAG_SYSTEM, (void**)&tmp->linear_alloc);
@@ -186,7 +241,6 @@ application_result_t application_create(void) {
         goto cleanup;
     }
 
-    tmp->linear_alloc_pool_size = 128 * KIB;
     ret_mem_sys = memory_system_allocate(tmp->linear_alloc_pool_size, MEMORY_TAG_SYSTEM, &tmp->linear_alloc_pool);
     if(MEMORY_SYSTEM_SUCCESS != ret_mem_sys) {
         ret = app_rslt_convert_mem_sys(ret_mem_sys);
@@ -202,6 +256,17 @@ application_result_t application_create(void) {
     }
     INFO_MESSAGE("linear_allocator initialized successfully.");
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Simulation -> launch all systems -> create frame allocator.(Don't use s_app_state here.)
+    INFO_MESSAGE("Initializing frame allocator...");
+    ret_linear_alloc = frame_allocator_initialize(APP_FRAME_ALLOC_CAPACITY, tmp->linear_alloc, &tmp->frame_alloc);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = app_rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("application_create(%s) - Failed to initialize frame allocator.", app_rslt_to_str(ret));
+        goto cleanup;
+    }
+    INFO_MESSAGE("frame_allocator initialized successfully.");
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Simulation -> launch all systems -> create platform.(Don't use s_app_state here.)
     INFO_MESSAGE("Initializing platform state...");
@@ -217,7 +282,7 @@ application_result_t application_create(void) {
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Simulation -> launch all systems -> create event message queue(window event).(Don't use s_app_state here.)
     INFO_MESSAGE("Starting window event queue initialize...");
-    ret_ring_queue = ring_queue_create(8, sizeof(window_event_t), alignof(window_event_t), &tmp->window_event_queue);
+    ret_ring_queue = app_window_event_queue_create(8, &tmp->window_event_queue);
     if(RING_QUEUE_SUCCESS != ret_ring_queue) {
         ret = app_rslt_convert_ring_queue(ret_ring_queue);
         ERROR_MESSAGE("application_create(%s) - Failed to initialize window event queue.", app_rslt_to_str(ret));
@@ -228,7 +293,7 @@ application_result_t application_create(void) {
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Simulation -> launch all systems -> create event message queue(keyboard event).(Don't use s_app_state here.)
     INFO_MESSAGE("Starting keyboard event queue initialize...");
-    ret_ring_queue = ring_queue_create(KEY_CODE_MAX, sizeof(keyboard_event_t), alignof(keyboard_event_t), &tmp->keyboard_event_queue);
+    ret_ring_queue = app_keyboard_event_queue_create(KEY_CODE_MAX, &tmp->keyboard_event_queue);
     if(RING_QUEUE_SUCCESS != ret_ring_queue) {
         ret = app_rslt_convert_ring_queue(ret_ring_queue);
         ERROR_MESSAGE("application_create(%s) - Failed to initialize keyboard event queue.", app_rslt_to_str(ret));
@@ -239,7 +304,7 @@ application_result_t application_create(void) {
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Simulation -> launch all systems -> create event message queue(mouse event).(Don't use s_app_state here.)
     INFO_MESSAGE("Starting mouse event queue initialize...");
-    ret_ring_queue = ring_queue_create(128, sizeof(mouse_event_t), alignof(mouse_event_t), &tmp->mouse_event_queue);
+    ret_ring_queue = app_mouse_event_queue_create(128, &tmp->mouse_event_queue);
     if(RING_QUEUE_SUCCESS != ret_ring_queue) {
         ret = app_rslt_convert_ring_queue(ret_ring_queue);
         ERROR_MESSAGE("application_create(%s) - Failed to initialize mouse event queue.", app_rslt_to_str(ret));
@@ -247,7 +312,7 @@ application_result_t application_create(void) {
     }
     INFO_MESSAGE("mouse event queue initialized successfully.");
 
-    ret_camera = camera_manager_initialize(8, tmp->linear_alloc, &tmp->camera_manager);
+    ret_camera = camera_manager_initialize(APP_MAX_CAMERA_COUNT, tmp->linear_alloc, &tmp->camera_manager);
     if(CAMERA_SUCCESS != ret_camera) {
         ret = app_rslt_convert_camera(ret_camera);
         ERROR_MESSAGE("application_create(%s) - Failed to create camera manager.", app_rslt_to_str(ret));
@@ -256,7 +321,7 @@ application_result_t application_create(void) {
     INFO_MESSAGE("camera manager initialized successfully.");
 
     // texture system.
-    ret_tex_sys = texture_manager_initialize(128, tmp->linear_alloc, &tmp->texture_manager);
+    ret_tex_sys = texture_manager_initialize(APP_MAX_TEXTURE_COUNT, tmp->linear_alloc, &tmp->texture_manager);
     if(TEXTURE_SYSTEM_SUCCESS != ret_tex_sys) {
         ret = app_rslt_convert_texture_system(ret_tex_sys);
         ERROR_MESSAGE("application_create(%s) - Failed to create texture system.", app_rslt_to_str(ret));
@@ -285,6 +350,17 @@ application_result_t application_create(void) {
         ERROR_MESSAGE("application_create(%s) - Failed to initialize renderer backend.", app_rslt_to_str(ret));
         goto cleanup;
     }
+    {
+        // 全サブシステムのリニアアロケータ使用量と事前算出した容量との差分(スラック)を報告
+        size_t linear_alloc_used = 0;
+        ret_linear_alloc = linear_allocator_marker_get(tmp->linear_alloc, &linear_alloc_used);
+        if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+            ret = app_rslt_convert_linear_alloc(ret_linear_alloc);
+            ERROR_MESSAGE("application_create(%s) - Failed to get linear allocator usage.", app_rslt_to_str(ret));
+            goto cleanup;
+        }
+        INFO_MESSAGE("linear_allocator usage: %zu / %zu bytes (slack: %zu bytes)", linear_alloc_used, tmp->linear_alloc_pool_size, tmp->linear_alloc_pool_size - linear_alloc_used);
+    }
     ret_renderer = ui_shader_create("assets/shaders/test_shader/", "ui_shader", tmp->renderer_backend_context, &tmp->ui_shader);
     if(RENDERER_SUCCESS != ret_renderer) {
         ret = app_rslt_convert_renderer(ret_renderer);
@@ -342,18 +418,9 @@ cleanup:
                 }
             }
 
-            if(NULL != tmp->mouse_event_queue) {
-                ring_queue_destroy(&tmp->mouse_event_queue);
-                tmp->mouse_event_queue = NULL;
-            }
-            if(NULL != tmp->keyboard_event_queue) {
-                ring_queue_destroy(&tmp->keyboard_event_queue);
-                tmp->keyboard_event_queue = NULL;
-            }
-            if(NULL != tmp->window_event_queue) {
-                ring_queue_destroy(&tmp->window_event_queue);
-                tmp->window_event_queue = NULL;
-            }
+            app_mouse_event_queue_destroy(&tmp->mouse_event_queue);
+            app_keyboard_event_queue_destroy(&tmp->keyboard_event_queue);
+            app_window_event_queue_destroy(&tmp->window_event_queue);
             if(NULL != tmp->platform_context) {
                 platform_destroy(tmp->platform_context);
             }
@@ -392,18 +459,9 @@ void application_destroy(void) {
         }
     }
     renderer_backend_destroy(s_app_state->renderer_backend_context);
-    if(NULL != s_app_state->mouse_event_queue) {
-        ring_queue_destroy(&s_app_state->mouse_event_queue);
-        s_app_state->mouse_event_queue = NULL;
-    }
-    if(NULL != s_app_state->keyboard_event_queue) {
-        ring_queue_destroy(&s_app_state->keyboard_event_queue);
-        s_app_state->keyboard_event_queue = NULL;
-    }
-    if(NULL != s_app_state->window_event_queue) {
-        ring_queue_destroy(&s_app_state->window_event_queue);
-        s_app_state->window_event_queue = NULL;
-    }
+    app_mouse_event_queue_destroy(&s_app_state->mouse_event_queue);
+    app_keyboard_event_queue_destroy(&s_app_state->keyboard_event_queue);
+    app_window_event_queue_destroy(&s_app_state->window_event_queue);
     if(NULL != s_app_state->platform_context) {
         platform_destroy(s_app_state->platform_context);
     }
@@ -503,7 +561,15 @@ application_result_t application_run(void) {
     INFO_MESSAGE("current camera: %s.", camera_name_get(s_app_state->active_camera));
     // end temporary
 
+#ifdef DEBUG_BUILD
+    // フレームループ内でのヒープ割り当てはレイテンシ悪化の原因となるため、ループ中の割り当て/解放を検出する
+    memory_system_guard_arm(MEMORY_GUARD_MODE_WARN);
+#endif
     while(!s_app_state->window_should_close) {
+        // 2フレーム前に確保した一時メモリはここで無効になる
+        frame_allocator_begin_frame(s_app_state->frame_alloc);
+        memory_system_frame_stats_sample(&s_app_state->frame_mem_stats);
+
         platform_result_t ret_event = platform_pump_messages(s_app_state->platform_context, on_window, on_key, on_mouse);
         if(PLATFORM_WINDOW_CLOSE == ret_event) {
             s_app_state->window_should_close = true;
@@ -543,6 +609,9 @@ application_result_t application_run(void) {
 
         nanosleep(&req, NULL);
     }
+#ifdef DEBUG_BUILD
+    memory_system_guard_disarm();
+#endif
 cleanup:
     return ret;
 }
@@ -564,8 +633,12 @@ static void on_window(const window_event_t* event_) {
         WARN_MESSAGE("on_window - Application state is not initialized.");
         goto cleanup;
     }
+    if(NULL == s_app_state->window_event_queue.queue) {    // 型付きラッパーのpushはキューのチェックを行わないため、ここで確認する
+        WARN_MESSAGE("on_window - Window event queue is not initialized.");
+        goto cleanup;
+    }
 
-    ret_push = ring_queue_push(event_, sizeof(window_event_t), alignof(window_event_t), s_app_state->window_event_queue);
+    ret_push = app_window_event_queue_push(event_, &s_app_state->window_event_queue);
     if(RING_QUEUE_SUCCESS != ret_push) {
         application_result_t ret = app_rslt_convert_ring_queue(ret_push);
         WARN_MESSAGE("on_window(%s) - Failed to push window event.", app_rslt_to_str(ret));
@@ -592,8 +665,12 @@ static void on_key(const keyboard_event_t* event_) {
         WARN_MESSAGE("on_key - Application state is uninitialized.");
         goto cleanup;
     }
+    if(NULL == s_app_state->keyboard_event_queue.queue) {    // 型付きラッパーのpushはキューのチェックを行わないため、ここで確認する
+        WARN_MESSAGE("on_key - Keyboard event queue is not initialized.");
+        goto cleanup;
+    }
 
-    ret_push = ring_queue_push(event_, sizeof(keyboard_event_t), alignof(keyboard_event_t), s_app_state->keyboard_event_queue);
+    ret_push = app_keyboard_event_queue_push(event_, &s_app_state->keyboard_event_queue);
     if(RING_QUEUE_SUCCESS != ret_push) {
         application_result_t ret = app_rslt_convert_ring_queue(ret_push);
         WARN_MESSAGE("on_key(%s) - Failed to push keyboard event.", app_rslt_to_str(ret));
@@ -620,8 +697,12 @@ static void on_mouse(const mouse_event_t* event_) {
         WARN_MESSAGE("on_mouse - Application state is not initialized.");
         goto cleanup;
     }
+    if(NULL == s_app_state->mouse_event_queue.queue) {    // 型付きラッパーのpushはキューのチェックを行わないため、ここで確認する
+        WARN_MESSAGE("on_mouse - Mouse event queue is not initialized.");
+        goto cleanup;
+    }
 
-    ret_push = ring_queue_push(event_, sizeof(mouse_event_t), alignof(mouse_event_t), s_app_state->mouse_event_queue);
+    ret_push = app_mouse_event_queue_push(event_, &s_app_state->mouse_event_queue);
     if(RING_QUEUE_SUCCESS != ret_push) {
         application_result_t ret = app_rslt_convert_ring_queue(ret_push);
         WARN_MESSAGE("on_mouse(%s) - Failed to push mouse event.", app_rslt_to_str(ret));
@@ -643,58 +724,70 @@ static void app_state_update(void) {
         ERROR_MESSAGE("app_state_update(%s) - Application state is not initialized.", app_rslt_to_str(ret));
         goto cleanup;
     }
-    if(NULL == s_app_state->window_event_queue) {
+    if(NULL == s_app_state->window_event_queue.queue) {
         ret = APPLICATION_RUNTIME_ERROR;
         ERROR_MESSAGE("app_state_update(%s) - window event queue is not initialized.", app_rslt_to_str(ret));
         goto cleanup;
     }
-    if(NULL == s_app_state->keyboard_event_queue) {
+    if(NULL == s_app_state->keyboard_event_queue.queue) {
         ret = APPLICATION_RUNTIME_ERROR;
         ERROR_MESSAGE("app_state_update(%s) - keyboard event queue is not initialized.", app_rslt_to_str(ret));
         goto cleanup;
     }
-    if(NULL == s_app_state->mouse_event_queue) {
+    if(NULL == s_app_state->mouse_event_queue.queue) {
         ret = APPLICATION_RUNTIME_ERROR;
         ERROR_MESSAGE("app_state_update(%s) - mouse event queue is not initialized.", app_rslt_to_str(ret));
         goto cleanup;
     }
 
     // window events.
-    while(!ring_queue_empty(s_app_state->window_event_queue)) {
-        window_event_t event;
-        ring_queue_result_t ret_ring = ring_queue_pop(sizeof(window_event_t), alignof(window_event_t), s_app_state->window_event_queue, &event);
-        if(RING_QUEUE_SUCCESS != ret_ring) {
+    while(true) {
+        window_event_t events[APP_EVENT_DRAIN_BATCH];
+        size_t event_count = 0;
+        ring_queue_result_t ret_ring = app_window_event_queue_pop_n(APP_EVENT_DRAIN_BATCH, &s_app_state->window_event_queue, events, &event_count);
+        if(RING_QUEUE_EMPTY == ret_ring) {
+            break;
+        } else if(RING_QUEUE_SUCCESS != ret_ring) {
             ret = app_rslt_convert_ring_queue(ret_ring);
             WARN_MESSAGE("app_state_update(%s) - Failed to pop window event.", app_rslt_to_str(ret));
             goto cleanup;
-        } else {
-            if(WINDOW_EVENT_RESIZE == event.event_code) {
+        }
+        for(size_t i = 0; i != event_count; ++i) {
+            const window_event_t* event = &events[i];
+            if(WINDOW_EVENT_RESIZE == event->event_code) {
                 INFO_MESSAGE("Window resized: window([%dx%d] -> [%dx%d]), framebuffer([%dx%d] -> [%dx%d])",
-                    s_app_state->window_width, s_app_state->window_height, event.event_args.window_width, event.event_args.window_height,
-                    s_app_state->framebuffer_width, s_app_state->framebuffer_height, event.event_args.framebuffer_width, event.event_args.framebuffer_height);
+                    s_app_state->window_width, s_app_state->window_height, event->event_args.window_width, event->event_args.window_height,
+                    s_app_state->framebuffer_width, s_app_state->framebuffer_height, event->event_args.framebuffer_width, event->event_args.framebuffer_height);
 
                 s_app_state->window_resized = true;
-                s_app_state->window_height = event.event_args.window_height;
-                s_app_state->window_width = event.event_args.window_width;
-                s_app_state->framebuffer_height = event.event_args.framebuffer_height;
-                s_app_state->framebuffer_width = event.event_args.framebuffer_width;
+                s_app_state->window_height = event->event_args.window_height;
+                s_app_state->window_width = event->event_args.window_width;
+                s_app_state->framebuffer_height = event->event_args.framebuffer_height;
+                s_app_state->framebuffer_width = event->event_args.framebuffer_width;
             }
         }
     }
 
     // keyboard events.
-    while(!ring_queue_empty(s_app_state->keyboard_event_queue)) {
-        keyboard_event_t event;
-        ring_queue_result_t ret_ring = ring_queue_pop(sizeof(keyboard_event_t), alignof(keyboard_event_t), s_app_state->keyboard_event_queue, &event);
-        if(RING_QUEUE_SUCCESS != ret_ring) {
+    while(true) {
+        keyboard_event_t events[APP_EVENT_DRAIN_BATCH];
+        size_t event_count = 0;
+        ring_queue_result_t ret_ring = app_keyboard_event_queue_pop_n(APP_EVENT_DRAIN_BATCH, &s_app_state->keyboard_event_queue, events, &event_count);
+        if(RING_QUEUE_EMPTY == ret_ring) {
+            break;
+        } else if(RING_QUEUE_SUCCESS != ret_ring) {
             ret = app_rslt_convert_ring_queue(ret_ring);
             WARN_MESSAGE("app_state_update(%s) - Failed to pop keyboard event.", app_rslt_to_str(ret));
             goto cleanup;
-        } else {
-            if(KEY_M == event.key && !event.event_args.pressed) {
+        }
+        for(size_t i = 0; i != event_count; ++i) {
+            const keyboard_event_t* event = &events[i];
+            if(KEY_M == event->key && !event->event_args.pressed) {
                 memory_system_report();
+                app_frame_mem_stats_report();
+                app_event_queue_stats_report();
             } else {
-                ret = flight_camera_command_update(&event, s_app_state->flight_camera_commands);
+                ret = flight_camera_command_update(event, s_app_state->flight_camera_commands);
                 if(APPLICATION_SUCCESS != ret) {
                     WARN_MESSAGE("app_state_update(%s) - Failed to update flight camera command.", app_rslt_to_str(ret));
                     goto cleanup;
@@ -704,18 +797,23 @@ static void app_state_update(void) {
     }
 
     // mouse events.
-    while(!ring_queue_empty(s_app_state->mouse_event_queue)) {
-        mouse_event_t event;
-        ring_queue_result_t ret_ring = ring_queue_pop(sizeof(mouse_event_t), alignof(mouse_event_t), s_app_state->mouse_event_queue, &event);
-        if(RING_QUEUE_SUCCESS != ret_ring) {
+    while(true) {
+        mouse_event_t events[APP_EVENT_DRAIN_BATCH];
+        size_t event_count = 0;
+        ring_queue_result_t ret_ring = app_mouse_event_queue_pop_n(APP_EVENT_DRAIN_BATCH, &s_app_state->mouse_event_queue, events, &event_count);
+        if(RING_QUEUE_EMPTY == ret_ring) {
+            break;
+        } else if(RING_QUEUE_SUCCESS != ret_ring) {
             ret = app_rslt_convert_ring_queue(ret_ring);
             WARN_MESSAGE("app_state_update(%s) - Failed to pop mouse event.", app_rslt_to_str(ret));
             goto cleanup;
-        } else {
-            if(MOUSE_BUTTON_LEFT == event.button) {
-                INFO_MESSAGE("Mouse left %s at (%d, %d)", (event.event_args.pressed) ? "pressed" : "released", event.event_args.x, event.event_args.y);
-            } else if(MOUSE_BUTTON_RIGHT == event.button) {
-                INFO_MESSAGE("Mouse right %s at (%d, %d)", (event.event_args.pressed) ? "pressed" : "released", event.event_args.x, event.event_args.y);
+        }
+        for(size_t i = 0; i != event_count; ++i) {
+            const mouse_event_t* event = &events[i];
+            if(MOUSE_BUTTON_LEFT == event->button) {
+                INFO_MESSAGE("Mouse left %s at (%d, %d)", (event->event_args.pressed) ? "pressed" : "released", event->event_args.x, event->event_args.y);
+            } else if(MOUSE_BUTTON_RIGHT == event->button) {
+                INFO_MESSAGE("Mouse right %s at (%d, %d)", (event->event_args.pressed) ? "pressed" : "released", event->event_args.x, event->event_args.y);
             }
         }
     }
@@ -784,3 +882,53 @@ static void app_state_clean(void) {
 cleanup:
     return;
 }
+
+/**
+ * @brief 直前のフレームでメモリの割り当て、解放が発生したメモリタグの割り当て差分を出力する
+ *
+ */
+static void app_frame_mem_stats_report(void) {
+    const memory_frame_stats_t* stats = NULL;
+
+    if(NULL == s_app_state) {
+        ERROR_MESSAGE("app_frame_mem_stats_report(%s) - Application state is not initialized.", app_rslt_to_str(APPLICATION_RUNTIME_ERROR));
+        goto cleanup;
+    }
+    stats = &s_app_state->frame_mem_stats;
+    INFO_MESSAGE("Memory allocations in the last frame:");
+    for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
+        if(0 != stats->alloc_count[i] || 0 != stats->free_count[i]) {
+            INFO_MESSAGE("\ttag(%s): alloc=%zu(%zu bytes), free=%zu(%zu bytes)", memory_system_tag_str_get((memory_tag_t)i), stats->alloc_count[i], stats->allocated_bytes[i], stats->free_count[i], stats->freed_bytes[i]);
+        }
+    }
+cleanup:
+    return;
+}
+
+/**
+ * @brief ウィンドウ/キーボード/マウスイベントキューの使用状況(push数、破棄数、最大格納数)を出力する
+ *
+ * @note 破棄数が0でない場合はイベントキューの容量不足を示すため、最大要素数の見直しの目安とする
+ *
+ */
+static void app_event_queue_stats_report(void) {
+    const ring_queue_t* queues[3] = { NULL, NULL, NULL };
+    const char* names[3] = { "window", "keyboard", "mouse" };
+    ring_queue_stats_t stats = { 0 };
+
+    if(NULL == s_app_state) {
+        ERROR_MESSAGE("app_event_queue_stats_report(%s) - Application state is not initialized.", app_rslt_to_str(APPLICATION_RUNTIME_ERROR));
+        goto cleanup;
+    }
+    queues[0] = s_app_state->window_event_queue.queue;
+    queues[1] = s_app_state->keyboard_event_queue.queue;
+    queues[2] = s_app_state->mouse_event_queue.queue;
+    INFO_MESSAGE("Event queue usage:");
+    for(size_t i = 0; i != 3; ++i) {
+        if(RING_QUEUE_SUCCESS == ring_queue_stats_get(queues[i], &stats)) {
+            INFO_MESSAGE("\t%s: pushed=%zu, dropped=%zu, peak=%zu/%zu", names[i], stats.push_count, stats.drop_count, stats.peak_len, stats.max_element_count);
+        }
+    }
+cleanup:
+    return;
+}
@@ -210,6 +210,8 @@ application_result_t app_rslt_convert_ring_queue(ring_queue_result_t rslt_) {
         return APPLICATION_UNDEFINED_ERROR;
     case RING_QUEUE_EMPTY:
         return APPLICATION_RUNTIME_ERROR;   // リングキュー空はRuntime errorに変換
+    case RING_QUEUE_FULL:
+        return APPLICATION_RUNTIME_ERROR;   // リングキュー満杯もRuntime errorに変換
     case RING_QUEUE_OVERFLOW:
         return APPLICATION_RUNTIME_ERROR;   // オーバーフローもRuntime errorに変換
     case RING_QUEUE_LIMIT_EXCEEDED:
@@ -526,6 +528,7 @@ static void NO_COVERAGE test_app_rslt_convert_ring_queue(void) {
     assert(APPLICATION_RUNTIME_ERROR == app_rslt_convert_ring_queue(RING_QUEUE_RUNTIME_ERROR));
     assert(APPLICATION_UNDEFINED_ERROR == app_rslt_convert_ring_queue(RING_QUEUE_UNDEFINED_ERROR));
     assert(APPLICATION_RUNTIME_ERROR == app_rslt_convert_ring_queue(RING_QUEUE_EMPTY));
+    assert(APPLICATION_RUNTIME_ERROR == app_rslt_convert_ring_queue(RING_QUEUE_FULL));
     assert(APPLICATION_RUNTIME_ERROR == app_rslt_convert_ring_queue(RING_QUEUE_OVERFLOW));
     assert(APPLICATION_LIMIT_EXCEEDED == app_rslt_convert_ring_queue(RING_QUEUE_LIMIT_EXCEEDED));
     assert(APPLICATION_BAD_OPERATION == app_rslt_convert_ring_queue(RING_QUEUE_BAD_OPERATION));
@@ -14,9 +14,11 @@
  *
  */
 #include <string.h>
+#include <stdarg.h>
+#include <stdio.h>  // for vsnprintf
 #include <stddef.h>
 #include <stdbool.h>
-#include <stdint.h> // for SIZE_MAX
+#include <stdint.h> // for SIZE_MAX, uintptr_t
 
 #include "engine/containers/choco_string.h"
 
@@ -43,16 +45,25 @@ static test_call_control_t s_test_config_choco_string_copy;
 static test_call_control_t s_test_config_choco_string_copy_from_c_string;       /**< choco_string_copy_from_c_string()テスト設定 */
 static test_call_control_t s_test_config_choco_string_concat;                   /**< choco_string_concat()テスト設定 */
 static test_call_control_t s_test_config_choco_string_concat_from_c_string;     /**< choco_string_concat_from_c_string()テスト設定 */
+static test_call_control_t s_test_config_choco_string_copy_from_view;           /**< choco_string_copy_from_view()テスト設定 */
+static test_call_control_t s_test_config_choco_string_concat_from_view;         /**< choco_string_concat_from_view()テスト設定 */
+static test_call_control_t s_test_config_choco_string_append_format;            /**< choco_string_append_format()テスト設定 */
+static test_call_control_t s_test_config_choco_string_reserve;                  /**< choco_string_reserve()テスト設定 */
+static test_call_control_t s_test_config_choco_string_shrink_to_fit;            /**< choco_string_shrink_to_fit()テスト設定 */
 static test_call_control_size_t_t s_test_config_choco_string_length;            /**< choco_string_length()テスト設定 */
 static test_call_control_bool_t s_test_config_choco_string_equal;               /**< choco_string_equal()テスト設定 */
 
 // プライベート関数テスト設定
 static test_call_control_t s_test_config_choco_string_mem_allocate; /**< choco_string_mem_allocate()テスト設定 */
+static test_call_control_t s_test_config_choco_string_mem_reallocate;   /**< choco_string_mem_reallocate()テスト設定 */
 static test_call_control_t s_test_config_buffer_reserve;            /**< buffer_reserve()テスト設定 */
 static test_call_control_t s_test_config_buffer_resize;             /**< buffer_resize()テスト設定 */
+static test_call_control_t s_test_config_buffer_grow;               /**< buffer_grow()テスト設定 */
+static test_call_control_t s_test_config_buffer_reallocate;         /**< buffer_reallocate()テスト設定 */
 static test_call_control_bool_t s_test_config_is_string_valid;      /**< is_string_valid()テスト設定 */
 static test_call_control_size_t_t s_test_config_mock_strlen;        /**< mock_strlen()テスト設定 */
 static test_call_control_t s_test_config_mock_strcmp;               /**< mock_strcmp()テスト設定 */
+static test_call_control_t s_test_config_mock_vsnprintf;            /**< mock_vsnprintf()テスト設定 */
 
 // 全テスト関数プロトタイプ宣言
 static void test_choco_string_default_create(void);
@@ -62,24 +73,40 @@ static void test_choco_string_copy(void);
 static void test_choco_string_copy_from_c_string(void);
 static void test_choco_string_concat(void);
 static void test_choco_string_concat_from_c_string(void);
+static void test_choco_string_copy_from_view(void);
+static void test_choco_string_concat_from_view(void);
+static void test_choco_string_append_format(void);
+static void test_choco_string_reserve(void);
+static void test_choco_string_shrink_to_fit(void);
 static void test_choco_string_length(void);
 static void test_choco_string_c_str(void);
+static void test_choco_string_view(void);
 static void test_choco_string_equal(void);
 static void test_rslt_to_str(void);
 static void test_choco_string_mem_allocate(void);
+static void test_choco_string_mem_reallocate(void);
 static void test_buffer_reserve(void);
 static void test_buffer_resize(void);
+static void test_buffer_grow(void);
+static void test_grow_capacity(void);
+static void test_buffer_reallocate(void);
 static void test_is_string_valid(void);
 #endif
 
+#define CHOCO_STRING_SMALL_BUFFER_SIZE 24    /**< 文字列コンテナ内部に保持する小容量バッファのサイズ(終端文字を含む) */
+
 /**
  * @brief 文字列コンテナ内部状態管理構造体
  *
+ * @note
+ * 終端文字を含めてCHOCO_STRING_SMALL_BUFFER_SIZE以下の文字列はsmall_bufferに格納し、バッファのヒープ確保を行わない(bufferはsmall_bufferを指す)。
+ * テクスチャ名やファイル名等の短い文字列で、文字列コンテナ1つあたりのメモリ確保を1回に抑えるため。
  */
 struct choco_string {
     size_t len;         /**< 文字列長さ(終端文字は含まない) */
     size_t capacity;    /**< バッファサイズ */
-    char* buffer;       /**< 文字列格納バッファ */
+    char* buffer;       /**< 文字列格納バッファ(small_bufferまたはヒープ領域を指す) */
+    char small_buffer[CHOCO_STRING_SMALL_BUFFER_SIZE];  /**< 短い文字列用の内部バッファ */
 };
 
 static const char* const s_rslt_str_success = "SUCCESS";                    /**< 実行結果コード(成功)文字列 */
@@ -94,11 +121,20 @@ static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**<
 
 static const char* rslt_to_str(choco_string_result_t rslt_);
 static choco_string_result_t choco_string_mem_allocate(size_t size_, void** out_ptr_);
+static choco_string_result_t choco_string_mem_reallocate(void* ptr_, size_t old_size_, size_t new_size_, void** out_ptr_);
+static choco_string_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
 static choco_string_result_t buffer_reserve(size_t size_, choco_string_t* string_);
 static choco_string_result_t buffer_resize(size_t size_, choco_string_t* string_);
+static choco_string_result_t buffer_grow(size_t required_size_, choco_string_t* string_);
+static choco_string_result_t buffer_reallocate(size_t size_, choco_string_t* string_);
+static void buffer_release(choco_string_t* string_);
+static void small_buffer_use(choco_string_t* string_);
+static bool is_small_buffer(const choco_string_t* string_);
+static size_t grow_capacity(size_t current_, size_t required_size_);
 static bool is_string_valid(const choco_string_t* string_);
 static size_t mock_strlen(const char* str_);
 static int mock_strcmp(const char *s1_, const char *s2_); 
+static int mock_vsnprintf(char* buffer_, size_t size_, const char* format_, va_list args_) CHOCO_STRING_PRINTF_FORMAT(3, 0);
 
 choco_string_result_t choco_string_default_create(choco_string_t** string_) {
 #ifdef TEST_BUILD
@@ -200,10 +236,7 @@ void choco_string_destroy(choco_string_t** string_) {
     if(NULL == *string_) {
         goto cleanup;
     }
-    if(NULL != (*string_)->buffer) {
-        memory_system_free((*string_)->buffer, (*string_)->capacity, MEMORY_TAG_STRING);
-        (*string_)->buffer = NULL;
-    }
+    buffer_release(*string_);
     memory_system_free(*string_, sizeof(choco_string_t), MEMORY_TAG_STRING);
     *string_ = NULL;
 cleanup:
@@ -338,7 +371,6 @@ choco_string_result_t choco_string_concat(const choco_string_t* string_, choco_s
 #endif
     choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
     size_t dst_len_new = 0;
-    char* tmp_buffer = NULL;
 
     // Preconditions.
     IF_ARG_NULL_GOTO_CLEANUP(dst_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_concat", "dst_")
@@ -367,23 +399,12 @@ choco_string_result_t choco_string_concat(const choco_string_t* string_, choco_s
             memcpy(dst_->buffer + dst_->len, string_->buffer, string_->len + 1);
             dst_->len = dst_len_new;
         } else {
-            ret = choco_string_mem_allocate(dst_len_new + 1, (void**)&tmp_buffer);
+            ret = buffer_grow(dst_len_new + 1, dst_);
             if(CHOCO_STRING_SUCCESS != ret) {
-                ERROR_MESSAGE("choco_string_concat(%s) - Failed to allocate memory for 'tmp_buffer'.", rslt_to_str(ret));
+                ERROR_MESSAGE("choco_string_concat(%s) - Failed to grow the buffer.", rslt_to_str(ret));
                 goto cleanup;
             }
-            memset(tmp_buffer, 0, dst_len_new + 1);
-            if(0 != dst_->len) {
-                memcpy(tmp_buffer, dst_->buffer, dst_->len);
-            }
-            memcpy(tmp_buffer + dst_->len, string_->buffer, string_->len + 1);
-            if(0 != dst_->capacity) {
-                memory_system_free(dst_->buffer, dst_->capacity, MEMORY_TAG_STRING);
-                dst_->buffer = NULL;
-            }
-
-            dst_->buffer = tmp_buffer;
-            dst_->capacity = dst_len_new + 1;
+            memcpy(dst_->buffer + dst_->len, string_->buffer, string_->len + 1);
             dst_->len = dst_len_new;
         }
     }
@@ -406,7 +427,6 @@ choco_string_result_t choco_string_concat_from_c_string(const char* string_, cho
     choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
     size_t dst_len_new = 0;
     size_t src_len = 0;
-    char* tmp_buffer = NULL;
 
     // Preconditions.
     IF_ARG_NULL_GOTO_CLEANUP(dst_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_concat_from_c_string", "dst_")
@@ -430,26 +450,296 @@ choco_string_result_t choco_string_concat_from_c_string(const char* string_, cho
             memcpy(dst_->buffer + dst_->len, string_, src_len + 1);
             dst_->len = dst_len_new;
         } else {
-            ret = choco_string_mem_allocate(dst_len_new + 1, (void**)&tmp_buffer);
+            ret = buffer_grow(dst_len_new + 1, dst_);
             if(CHOCO_STRING_SUCCESS != ret) {
-                ERROR_MESSAGE("choco_string_concat_from_c_string(%s) - Failed to allocate memory for 'tmp_buffer'.", rslt_to_str(ret));
+                ERROR_MESSAGE("choco_string_concat_from_c_string(%s) - Failed to grow the buffer.", rslt_to_str(ret));
                 goto cleanup;
             }
-            memset(tmp_buffer, 0, dst_len_new + 1);
-            if(0 != dst_->len) {
-                memcpy(tmp_buffer, dst_->buffer, dst_->len);
+            memcpy(dst_->buffer + dst_->len, string_, src_len + 1);
+            dst_->len = dst_len_new;
+        }
+    }
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+choco_string_result_t choco_string_copy_from_view(choco_string_view_t src_, choco_string_t* dst_) {
+#ifdef TEST_BUILD
+    s_test_config_choco_string_copy_from_view.call_count++;
+    if(s_test_config_choco_string_copy_from_view.fail_on_call != 0) {
+        if(s_test_config_choco_string_copy_from_view.call_count == s_test_config_choco_string_copy_from_view.fail_on_call) {
+            return (choco_string_result_t)s_test_config_choco_string_copy_from_view.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(dst_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_copy_from_view", "dst_")
+    IF_ARG_FALSE_GOTO_CLEANUP(NULL != src_.data || 0 == src_.length, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_copy_from_view", "src_")
+
+    if(!is_string_valid(dst_)) {
+        ret = CHOCO_STRING_DATA_CORRUPTED;
+        ERROR_MESSAGE("choco_string_copy_from_view(%s) - Destination string (dst_) is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    if(0 == src_.length) {
+        if(NULL != dst_->buffer) {
+            dst_->buffer[0] = '\0';
+        }
+        dst_->len = 0;
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
+    // Simulation, Commit.
+    if((SIZE_MAX - 1) < src_.length) {
+        ret = CHOCO_STRING_OVERFLOW;
+        ERROR_MESSAGE("choco_string_copy_from_view(%s) - Provided view is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(dst_->capacity < (src_.length + 1)) {
+        // src_がdst_自身の文字列を参照している場合はsrc_.length + 1 <= dst_->capacityとなるため、バッファの作り直しでsrc_が無効になることはない
+        ret = buffer_resize(src_.length + 1, dst_);
+        if(CHOCO_STRING_SUCCESS != ret) {
+            ERROR_MESSAGE("choco_string_copy_from_view(%s) - Failed to resize the buffer.", rslt_to_str(ret));
+            goto cleanup;
+        }
+    }
+    memmove(dst_->buffer, src_.data, src_.length);
+    dst_->buffer[src_.length] = '\0';
+    dst_->len = src_.length;
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+choco_string_result_t choco_string_concat_from_view(choco_string_view_t string_, choco_string_t* dst_) {
+#ifdef TEST_BUILD
+    s_test_config_choco_string_concat_from_view.call_count++;
+    if(s_test_config_choco_string_concat_from_view.fail_on_call != 0) {
+        if(s_test_config_choco_string_concat_from_view.call_count == s_test_config_choco_string_concat_from_view.fail_on_call) {
+            return (choco_string_result_t)s_test_config_choco_string_concat_from_view.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    const char* src = string_.data;
+    size_t dst_len_new = 0;
+    uintptr_t src_addr = 0;
+    uintptr_t buffer_addr = 0;
+    bool is_self_view = false;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(dst_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_concat_from_view", "dst_")
+    IF_ARG_FALSE_GOTO_CLEANUP(NULL != string_.data || 0 == string_.length, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_concat_from_view", "string_")
+
+    if(!is_string_valid(dst_)) {
+        ret = CHOCO_STRING_DATA_CORRUPTED;
+        ERROR_MESSAGE("choco_string_concat_from_view(%s) - Destination string (dst_) is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    if((SIZE_MAX - dst_->len - 1) < string_.length) {
+        ret = CHOCO_STRING_OVERFLOW;
+        ERROR_MESSAGE("choco_string_concat_from_view(%s) - Resulting string length is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(0 != string_.length) {
+        dst_len_new = string_.length + dst_->len;
+        if((dst_len_new + 1) > dst_->capacity) {
+            // string_がdst_自身のバッファを参照している場合、バッファ拡張後の位置から読み出す
+            if(NULL != dst_->buffer) {
+                src_addr = (uintptr_t)string_.data;
+                buffer_addr = (uintptr_t)dst_->buffer;
+                is_self_view = (src_addr >= buffer_addr && src_addr < (buffer_addr + dst_->capacity)) ? true : false;
+            }
+            ret = buffer_grow(dst_len_new + 1, dst_);
+            if(CHOCO_STRING_SUCCESS != ret) {
+                ERROR_MESSAGE("choco_string_concat_from_view(%s) - Failed to grow the buffer.", rslt_to_str(ret));
+                goto cleanup;
             }
-            memcpy(tmp_buffer + dst_->len, string_, src_len + 1);
-            if(0 != dst_->capacity) {
-                memory_system_free(dst_->buffer, dst_->capacity, MEMORY_TAG_STRING);
-                dst_->buffer = NULL;
+            if(is_self_view) {
+                src = dst_->buffer + (src_addr - buffer_addr);
             }
+        }
+        memmove(dst_->buffer + dst_->len, src, string_.length);
+        dst_->buffer[dst_len_new] = '\0';
+        dst_->len = dst_len_new;
+    }
 
-            dst_->buffer = tmp_buffer;
-            dst_->capacity = dst_len_new + 1;
-            dst_->len = dst_len_new;
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+choco_string_result_t choco_string_append_format(choco_string_t* dst_, const char* format_, ...) {
+#ifdef TEST_BUILD
+    s_test_config_choco_string_append_format.call_count++;
+    if(s_test_config_choco_string_append_format.fail_on_call != 0) {
+        if(s_test_config_choco_string_append_format.call_count == s_test_config_choco_string_append_format.fail_on_call) {
+            return (choco_string_result_t)s_test_config_choco_string_append_format.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    va_list args;
+    va_list args_retry;
+    bool is_args_started = false;
+    size_t available = 0;
+    size_t format_len = 0;
+    size_t dst_len_new = 0;
+    int written = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(dst_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_append_format", "dst_")
+    IF_ARG_NULL_GOTO_CLEANUP(format_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_append_format", "format_")
+
+    if(!is_string_valid(dst_)) {
+        ret = CHOCO_STRING_DATA_CORRUPTED;
+        ERROR_MESSAGE("choco_string_append_format(%s) - Destination string (dst_) is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // 既存バッファの空き領域(終端文字の位置から末尾まで)へ直接書式化する
+    va_start(args, format_);
+    va_copy(args_retry, args);
+    is_args_started = true;
+    available = (0 != dst_->capacity) ? (dst_->capacity - dst_->len) : 0;
+    written = mock_vsnprintf((0 != available) ? (dst_->buffer + dst_->len) : NULL, available, format_, args);
+    va_end(args);
+    if(0 > written) {
+        ret = CHOCO_STRING_RUNTIME_ERROR;
+        ERROR_MESSAGE("choco_string_append_format(%s) - Failed to format the string.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    format_len = (size_t)written;
+    if(format_len < available) {
+        dst_->len += format_len;
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
+    // 空き領域が不足: 途中まで書き込まれた文字列を取り消し、バッファを拡張してから再度書式化する
+    if(0 != available) {
+        dst_->buffer[dst_->len] = '\0';
+    }
+    if((SIZE_MAX - dst_->len - 1) < format_len) {
+        ret = CHOCO_STRING_OVERFLOW;
+        ERROR_MESSAGE("choco_string_append_format(%s) - Resulting string length is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    dst_len_new = dst_->len + format_len;
+    ret = buffer_grow(dst_len_new + 1, dst_);
+    if(CHOCO_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("choco_string_append_format(%s) - Failed to grow the buffer.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    written = mock_vsnprintf(dst_->buffer + dst_->len, format_len + 1, format_, args_retry);
+    if(0 > written || format_len != (size_t)written) {
+        dst_->buffer[dst_->len] = '\0';
+        ret = CHOCO_STRING_RUNTIME_ERROR;
+        ERROR_MESSAGE("choco_string_append_format(%s) - Failed to format the string.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    dst_->len = dst_len_new;
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    if(is_args_started) {
+        va_end(args_retry);
+    }
+    return ret;
+}
+
+choco_string_result_t choco_string_reserve(size_t length_, choco_string_t* string_) {
+#ifdef TEST_BUILD
+    s_test_config_choco_string_reserve.call_count++;
+    if(s_test_config_choco_string_reserve.fail_on_call != 0) {
+        if(s_test_config_choco_string_reserve.call_count == s_test_config_choco_string_reserve.fail_on_call) {
+            return (choco_string_result_t)s_test_config_choco_string_reserve.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(string_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_reserve", "string_")
+
+    if(!is_string_valid(string_)) {
+        ret = CHOCO_STRING_DATA_CORRUPTED;
+        ERROR_MESSAGE("choco_string_reserve(%s) - Provided string (string_) is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if((SIZE_MAX - 1) < length_) {
+        ret = CHOCO_STRING_OVERFLOW;
+        ERROR_MESSAGE("choco_string_reserve(%s) - Provided length is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if((length_ + 1) <= string_->capacity) {
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
+    // Simulation, Commit.
+    // 要求サイズちょうどで確保する(以降の連結で不足した場合はbuffer_growにより倍々で拡張される)
+    ret = buffer_reallocate(length_ + 1, string_);
+    if(CHOCO_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("choco_string_reserve(%s) - Failed to reallocate the buffer.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+choco_string_result_t choco_string_shrink_to_fit(choco_string_t* string_) {
+#ifdef TEST_BUILD
+    s_test_config_choco_string_shrink_to_fit.call_count++;
+    if(s_test_config_choco_string_shrink_to_fit.fail_on_call != 0) {
+        if(s_test_config_choco_string_shrink_to_fit.call_count == s_test_config_choco_string_shrink_to_fit.fail_on_call) {
+            return (choco_string_result_t)s_test_config_choco_string_shrink_to_fit.forced_result;
         }
     }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(string_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_shrink_to_fit", "string_")
+
+    if(!is_string_valid(string_)) {
+        ret = CHOCO_STRING_DATA_CORRUPTED;
+        ERROR_MESSAGE("choco_string_shrink_to_fit(%s) - Provided string (string_) is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // Commit.
+    if(0 == string_->len) {
+        // 空文字列はバッファを持たない状態(choco_string_default_create直後と同じ状態)に戻す
+        buffer_release(string_);
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+    if((string_->len + 1) == string_->capacity || is_small_buffer(string_)) {
+        // 内部バッファはこれ以上縮小できない
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+    ret = buffer_reallocate(string_->len + 1, string_);
+    if(CHOCO_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("choco_string_shrink_to_fit(%s) - Failed to reallocate the buffer.", rslt_to_str(ret));
+        goto cleanup;
+    }
 
     ret = CHOCO_STRING_SUCCESS;
 
@@ -485,6 +775,32 @@ const char* choco_string_c_str(const choco_string_t* string_) {
     }
 }
 
+choco_string_view_t choco_string_view_get(const choco_string_t* string_) {
+    choco_string_view_t view;
+
+    view.data = choco_string_c_str(string_);
+    view.length = choco_string_length(string_);
+    return view;
+}
+
+choco_string_view_t choco_string_view_from_c_string(const char* str_) {
+    choco_string_view_t view;
+
+    view.data = str_;
+    view.length = (NULL != str_) ? mock_strlen(str_) : 0;
+    return view;
+}
+
+bool choco_string_view_equal(choco_string_view_t view1_, choco_string_view_t view2_) {
+    if(view1_.length != view2_.length) {
+        return false;
+    }
+    if(0 == view1_.length) {
+        return true;
+    }
+    return (0 == memcmp(view1_.data, view2_.data, view1_.length)) ? true : false;
+}
+
 bool choco_string_equal(const char* str1_, const char* str2_) {
 #ifdef TEST_BUILD
     s_test_config_choco_string_equal.call_count++;
@@ -570,27 +886,8 @@ static choco_string_result_t choco_string_mem_allocate(size_t size_, void** out_
     IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_ptr_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_mem_allocate", "*out_ptr_")
 
     ret_mem = memory_system_allocate(size_, MEMORY_TAG_STRING, &tmp_ptr);
-    switch(ret_mem) {
-    case MEMORY_SYSTEM_INVALID_ARGUMENT:
-        ret = CHOCO_STRING_INVALID_ARGUMENT;
-        goto cleanup;
-    case MEMORY_SYSTEM_NO_MEMORY:
-        ret = CHOCO_STRING_NO_MEMORY;
-        goto cleanup;
-    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
-        ret = CHOCO_STRING_LIMIT_EXCEEDED;
-        goto cleanup;
-    case MEMORY_SYSTEM_BAD_OPERATION:
-        ret = CHOCO_STRING_BAD_OPERATION;
-        goto cleanup;
-    case MEMORY_SYSTEM_RUNTIME_ERROR:
-        ret = CHOCO_STRING_RUNTIME_ERROR;
-        goto cleanup;
-    case MEMORY_SYSTEM_SUCCESS:
-        ret = CHOCO_STRING_SUCCESS;
-        break;
-    default:
-        ret = CHOCO_STRING_UNDEFINED_ERROR;
+    ret = rslt_convert_mem_sys(ret_mem);
+    if(CHOCO_STRING_SUCCESS != ret) {
         goto cleanup;
     }
     *out_ptr_ = tmp_ptr;
@@ -601,6 +898,73 @@ cleanup:
     return ret;
 }
 
+/**
+ * @brief memory_system_reallocateのラッパ関数で、確保済みのメモリをnew_size_に再割り当てする
+ *
+ * @note
+ * - 実行結果コードをchoco_stringモジュールの実行結果コードに変換して出力する
+ * - メモリタグはMEMORY_TAG_STRING固定
+ * - 処理に失敗した場合、ptr_の領域と*out_ptr_は不変
+ *
+ * @param[in] ptr_ 再割り当て対象メモリアドレス(NULLの場合は新規割り当て)
+ * @param[in] old_size_ 現在の割り当てサイズ(ptr_ == NULLの場合は0)
+ * @param[in] new_size_ 変更後の割り当てサイズ
+ * @param[out] out_ptr_ 再割り当て後のメモリの先頭アドレス(ptr_を保持している変数のアドレスを渡してもよい)
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT out_ptr_ == NULL、またはmemory_system_reallocateの実行結果がMEMORY_SYSTEM_INVALID_ARGUMENT
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリシステムの使用可能範囲上限超過
+ * @retval CHOCO_STRING_RUNTIME_ERROR memory_system_reallocateがMEMORY_SYSTEM_RUNTIME_ERRORを返した
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 再割り当てに成功し、正常終了
+ */
+static choco_string_result_t choco_string_mem_reallocate(void* ptr_, size_t old_size_, size_t new_size_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    s_test_config_choco_string_mem_reallocate.call_count++;
+    if(s_test_config_choco_string_mem_reallocate.fail_on_call != 0) {
+        if(s_test_config_choco_string_mem_reallocate.call_count == s_test_config_choco_string_mem_reallocate.fail_on_call) {
+            return (choco_string_result_t)s_test_config_choco_string_mem_reallocate.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "choco_string_mem_reallocate", "out_ptr_")
+
+    ret_mem = memory_system_reallocate(ptr_, old_size_, new_size_, MEMORY_TAG_STRING, out_ptr_);
+    ret = rslt_convert_mem_sys(ret_mem);
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリシステムの実行結果コードをchoco_stringモジュールの実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステムの実行結果コード
+ *
+ * @return choco_string_result_t 変換後の実行結果コード(未定義の値はCHOCO_STRING_UNDEFINED_ERROR)
+ */
+static choco_string_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return CHOCO_STRING_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return CHOCO_STRING_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return CHOCO_STRING_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return CHOCO_STRING_BAD_OPERATION;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return CHOCO_STRING_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_SUCCESS:
+        return CHOCO_STRING_SUCCESS;
+    default:
+        return CHOCO_STRING_UNDEFINED_ERROR;
+    }
+}
+
 // string_のbufferのメモリを初回に確保するためのAPI。既にbufferのメモリを確保済の場合にはbuffer_resizeを使用する
 // 処理に失敗した場合(返り値がCHOCO_STRING_SUCCESS以外)には引数のstring_の状態は不変。
 static choco_string_result_t buffer_reserve(size_t size_, choco_string_t* string_) {
@@ -623,6 +987,11 @@ static choco_string_result_t buffer_reserve(size_t size_, choco_string_t* string
         goto cleanup;
     }
 
+    if(CHOCO_STRING_SMALL_BUFFER_SIZE >= size_) {
+        small_buffer_use(string_);
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
     ret = choco_string_mem_allocate(size_, (void**)&tmp_buffer);
     if(CHOCO_STRING_SUCCESS != ret) {
         goto cleanup;
@@ -671,6 +1040,13 @@ static choco_string_result_t buffer_resize(size_t size_, choco_string_t* string_
         goto cleanup;
     }
 
+    if(CHOCO_STRING_SMALL_BUFFER_SIZE >= size_) {
+        buffer_release(string_);
+        small_buffer_use(string_);
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
     // Simulation.
     ret = choco_string_mem_allocate(size_, (void**)&tmp_buffer);
     if(CHOCO_STRING_SUCCESS != ret) {
@@ -679,10 +1055,7 @@ static choco_string_result_t buffer_resize(size_t size_, choco_string_t* string_
     memset(tmp_buffer, 0, size_);
 
     // Commit.
-    if(0 != string_->capacity) {
-        memory_system_free(string_->buffer, string_->capacity, MEMORY_TAG_STRING);
-        string_->buffer = NULL;
-    }
+    buffer_release(string_);
     string_->buffer = tmp_buffer;
     string_->len = 0;
     string_->capacity = size_;
@@ -699,14 +1072,191 @@ cleanup:
     return ret;
 }
 
-// 本関数を呼び出す前に必ず引数が非NULLであることを保証すること
-// (本関数内でNULLチェックを行う場合,事前NULLチェックとの競合によりそのコードを動かすことができないため)
-static bool is_string_valid(const choco_string_t* string_) {
-#ifdef TEST_BUILD
-    s_test_config_is_string_valid.call_count++;
-    if(s_test_config_is_string_valid.fail_on_call != 0) {
-        if(s_test_config_is_string_valid.call_count == s_test_config_is_string_valid.fail_on_call) {
-            return s_test_config_is_string_valid.forced_result;
+/**
+ * @brief string_が保持する文字列を維持したまま、バッファをrequired_size_以上のサイズに拡張する
+ *
+ * @note
+ * - 拡張後のサイズはgrow_capacityで決定する(現在のサイズの2倍を基本とし、連結を繰り返した際のメモリ再確保/コピー回数を償却O(1)に抑える)
+ * - バッファ未確保(capacity == 0)の場合はrequired_size_ちょうどで確保する(CHOCO_STRING_SMALL_BUFFER_SIZE以下であれば内部バッファを使用する)
+ * - 拡張した領域は0で初期化される
+ * - 処理に失敗した場合、string_の状態は不変
+ * - 本関数を呼び出す前にstring_が非NULLかつ破損していないことを保証すること
+ *
+ * @param[in] required_size_ 必要なバッファサイズ(終端文字を含む)
+ * @param[in,out] string_ 拡張対象文字列コンテナ
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT required_size_ == 0
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 拡張に成功(または拡張不要)し、正常終了
+ */
+static choco_string_result_t buffer_grow(size_t required_size_, choco_string_t* string_) {
+#ifdef TEST_BUILD
+    s_test_config_buffer_grow.call_count++;
+    if(s_test_config_buffer_grow.fail_on_call != 0) {
+        if(s_test_config_buffer_grow.call_count == s_test_config_buffer_grow.fail_on_call) {
+            return (choco_string_result_t)s_test_config_buffer_grow.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+
+    IF_ARG_FALSE_GOTO_CLEANUP(required_size_ > 0, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "buffer_grow", "required_size_")
+    if(required_size_ <= string_->capacity) {
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
+    ret = buffer_reallocate(grow_capacity(string_->capacity, required_size_), string_);
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief string_が保持する文字列を維持したまま、バッファサイズをsize_に変更する
+ *
+ * @note
+ * - size_ <= CHOCO_STRING_SMALL_BUFFER_SIZEの場合は内部バッファ(small_buffer)に切り替え、ヒープ領域を保持していれば解放する(バッファサイズはCHOCO_STRING_SMALL_BUFFER_SIZEとなる)
+ * - 内部バッファからヒープ領域へ切り替える場合は新規に確保して文字列をコピーする
+ * - ヒープ領域のサイズを変更する場合はchoco_string_mem_reallocateを使用する(その場で変更できればコピーが発生しない)
+ * - 拡張した領域は0で初期化される
+ * - 処理に失敗した場合、string_の状態は不変
+ * - 本関数を呼び出す前にstring_が非NULLかつ破損しておらず、size_ > string_->lenであることを保証すること
+ *
+ * @param[in] size_ 変更後のバッファサイズ(終端文字を含む)
+ * @param[in,out] string_ 変更対象文字列コンテナ
+ *
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 変更に成功し、正常終了
+ */
+static choco_string_result_t buffer_reallocate(size_t size_, choco_string_t* string_) {
+#ifdef TEST_BUILD
+    s_test_config_buffer_reallocate.call_count++;
+    if(s_test_config_buffer_reallocate.fail_on_call != 0) {
+        if(s_test_config_buffer_reallocate.call_count == s_test_config_buffer_reallocate.fail_on_call) {
+            return (choco_string_result_t)s_test_config_buffer_reallocate.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    void* tmp_buffer = NULL;
+
+    if(CHOCO_STRING_SMALL_BUFFER_SIZE >= size_) {
+        if(0 == string_->capacity) {
+            small_buffer_use(string_);
+        } else if(!is_small_buffer(string_)) {
+            memcpy(string_->small_buffer, string_->buffer, string_->len + 1);
+            memory_system_free(string_->buffer, string_->capacity, MEMORY_TAG_STRING);
+            string_->buffer = string_->small_buffer;
+            string_->capacity = CHOCO_STRING_SMALL_BUFFER_SIZE;
+        }
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
+    if(is_small_buffer(string_)) {
+        ret = choco_string_mem_allocate(size_, &tmp_buffer);
+        if(CHOCO_STRING_SUCCESS != ret) {
+            goto cleanup;
+        }
+        memset(tmp_buffer, 0, size_);
+        memcpy(tmp_buffer, string_->small_buffer, string_->len + 1);
+    } else {
+        // 既存バッファはその場で拡張できればコピーが発生しない(拡張分は0で初期化される)
+        ret = choco_string_mem_reallocate(string_->buffer, string_->capacity, size_, &tmp_buffer);
+        if(CHOCO_STRING_SUCCESS != ret) {
+            goto cleanup;
+        }
+    }
+    string_->buffer = (char*)tmp_buffer;
+    string_->capacity = size_;
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief string_がヒープ領域のバッファを保持していれば解放し、バッファを持たない状態(buffer == NULL, capacity == 0)にする
+ *
+ * @note 文字列長さは変更しないため、呼び出し側で必要に応じて更新すること
+ *
+ * @param[in,out] string_ 対象文字列コンテナ(非NULLであること)
+ */
+static void buffer_release(choco_string_t* string_) {
+    if(0 != string_->capacity && !is_small_buffer(string_)) {
+        memory_system_free(string_->buffer, string_->capacity, MEMORY_TAG_STRING);
+    }
+    string_->buffer = NULL;
+    string_->capacity = 0;
+}
+
+/**
+ * @brief string_のバッファを内部バッファ(small_buffer)に切り替え、空文字列で初期化する
+ *
+ * @note ヒープ領域のバッファは解放しないため、呼び出し前にbuffer_releaseで解放しておくこと
+ *
+ * @param[in,out] string_ 対象文字列コンテナ(非NULLであること)
+ */
+static void small_buffer_use(choco_string_t* string_) {
+    memset(string_->small_buffer, 0, sizeof(string_->small_buffer));
+    string_->buffer = string_->small_buffer;
+    string_->capacity = CHOCO_STRING_SMALL_BUFFER_SIZE;
+    string_->len = 0;
+}
+
+/**
+ * @brief string_が内部バッファ(small_buffer)を使用しているかを判定する
+ *
+ * @param[in] string_ 判定対象文字列コンテナ(非NULLであること)
+ *
+ * @retval true 内部バッファを使用している
+ * @retval false バッファ未確保、またはヒープ領域を使用している
+ */
+static bool is_small_buffer(const choco_string_t* string_) {
+    return (string_->buffer == string_->small_buffer) ? true : false;
+}
+
+/**
+ * @brief 現在のバッファサイズcurrent_から、required_size_以上となる拡張後のバッファサイズを算出する
+ *
+ * @note
+ * - current_ == 0の場合はrequired_size_を返す(短い文字列で余分な領域を確保しないため)
+ * - current_の2倍がrequired_size_に満たない場合はrequired_size_を返す
+ * - current_の2倍がオーバーフローする場合はSIZE_MAXとrequired_size_の大きい方(= SIZE_MAX)を返す
+ *
+ * @param[in] current_ 現在のバッファサイズ
+ * @param[in] required_size_ 必要なバッファサイズ
+ *
+ * @return size_t 拡張後のバッファサイズ
+ */
+static size_t grow_capacity(size_t current_, size_t required_size_) {
+    size_t new_capacity = 0;
+
+    if(0 == current_) {
+        return required_size_;
+    }
+    if((SIZE_MAX / 2) < current_) {
+        new_capacity = SIZE_MAX;
+    } else {
+        new_capacity = current_ * 2;
+    }
+    return (new_capacity < required_size_) ? required_size_ : new_capacity;
+}
+
+// 本関数を呼び出す前に必ず引数が非NULLであることを保証すること
+// (本関数内でNULLチェックを行う場合,事前NULLチェックとの競合によりそのコードを動かすことができないため)
+static bool is_string_valid(const choco_string_t* string_) {
+#ifdef TEST_BUILD
+    s_test_config_is_string_valid.call_count++;
+    if(s_test_config_is_string_valid.fail_on_call != 0) {
+        if(s_test_config_is_string_valid.call_count == s_test_config_is_string_valid.fail_on_call) {
+            return s_test_config_is_string_valid.forced_result;
         }
     }
 #endif
@@ -722,6 +1272,8 @@ static bool is_string_valid(const choco_string_t* string_) {
         return false;
     } else if(0 == string_->len && 0 < string_->capacity && '\0' != string_->buffer[0]) {
         return false;
+    } else if(is_small_buffer(string_) && CHOCO_STRING_SMALL_BUFFER_SIZE != string_->capacity) {
+        return false;
     }
     return true;
 }
@@ -750,6 +1302,18 @@ static int NO_COVERAGE mock_strcmp(const char *s1_, const char *s2_) {
     return strcmp(s1_, s2_);
 }
 
+static int NO_COVERAGE mock_vsnprintf(char* buffer_, size_t size_, const char* format_, va_list args_) {
+#ifdef TEST_BUILD
+    s_test_config_mock_vsnprintf.call_count++;
+    if(s_test_config_mock_vsnprintf.fail_on_call != 0) {
+        if(s_test_config_mock_vsnprintf.call_count == s_test_config_mock_vsnprintf.fail_on_call) {
+            return s_test_config_mock_vsnprintf.forced_result;
+        }
+    }
+#endif
+    return vsnprintf(buffer_, size_, format_, args_);
+}
+
 #ifdef TEST_BUILD
 void test_choco_string_default_create_config_set(const test_call_control_t* config_) {
     s_test_config_choco_string_default_create.fail_on_call = config_->fail_on_call;
@@ -781,6 +1345,31 @@ void test_choco_string_concat_from_c_string_config_set(const test_call_control_t
     s_test_config_choco_string_concat_from_c_string.forced_result = config_->forced_result;
 }
 
+void test_choco_string_copy_from_view_config_set(const test_call_control_t* config_) {
+    s_test_config_choco_string_copy_from_view.fail_on_call = config_->fail_on_call;
+    s_test_config_choco_string_copy_from_view.forced_result = config_->forced_result;
+}
+
+void test_choco_string_concat_from_view_config_set(const test_call_control_t* config_) {
+    s_test_config_choco_string_concat_from_view.fail_on_call = config_->fail_on_call;
+    s_test_config_choco_string_concat_from_view.forced_result = config_->forced_result;
+}
+
+void test_choco_string_append_format_config_set(const test_call_control_t* config_) {
+    s_test_config_choco_string_append_format.fail_on_call = config_->fail_on_call;
+    s_test_config_choco_string_append_format.forced_result = config_->forced_result;
+}
+
+void test_choco_string_reserve_config_set(const test_call_control_t* config_) {
+    s_test_config_choco_string_reserve.fail_on_call = config_->fail_on_call;
+    s_test_config_choco_string_reserve.forced_result = config_->forced_result;
+}
+
+void test_choco_string_shrink_to_fit_config_set(const test_call_control_t* config_) {
+    s_test_config_choco_string_shrink_to_fit.fail_on_call = config_->fail_on_call;
+    s_test_config_choco_string_shrink_to_fit.forced_result = config_->forced_result;
+}
+
 void test_choco_string_length_config_set(const test_call_control_size_t_t* config_) {
     s_test_config_choco_string_length.fail_on_call = config_->fail_on_call;
     s_test_config_choco_string_length.forced_result = config_->forced_result;
@@ -798,15 +1387,24 @@ void test_choco_string_config_reset(void) {
     test_call_control_reset(&s_test_config_choco_string_copy_from_c_string);
     test_call_control_reset(&s_test_config_choco_string_concat);
     test_call_control_reset(&s_test_config_choco_string_concat_from_c_string);
+    test_call_control_reset(&s_test_config_choco_string_copy_from_view);
+    test_call_control_reset(&s_test_config_choco_string_concat_from_view);
+    test_call_control_reset(&s_test_config_choco_string_append_format);
+    test_call_control_reset(&s_test_config_choco_string_reserve);
+    test_call_control_reset(&s_test_config_choco_string_shrink_to_fit);
     test_call_control_size_t_reset(&s_test_config_choco_string_length);
     test_call_control_bool_reset(&s_test_config_choco_string_equal);
 
     test_call_control_reset(&s_test_config_choco_string_mem_allocate);
+    test_call_control_reset(&s_test_config_choco_string_mem_reallocate);
     test_call_control_reset(&s_test_config_buffer_reserve);
     test_call_control_reset(&s_test_config_buffer_resize);
+    test_call_control_reset(&s_test_config_buffer_grow);
+    test_call_control_reset(&s_test_config_buffer_reallocate);
     test_call_control_bool_reset(&s_test_config_is_string_valid);
     test_call_control_size_t_reset(&s_test_config_mock_strlen);
     test_call_control_reset(&s_test_config_mock_strcmp);
+    test_call_control_reset(&s_test_config_mock_vsnprintf);
 }
 
 void test_choco_string(void) {
@@ -819,13 +1417,23 @@ void test_choco_string(void) {
     test_choco_string_copy_from_c_string();
     test_choco_string_concat();
     test_choco_string_concat_from_c_string();
+    test_choco_string_copy_from_view();
+    test_choco_string_concat_from_view();
+    test_choco_string_append_format();
+    test_choco_string_reserve();
+    test_choco_string_shrink_to_fit();
     test_choco_string_length();
     test_choco_string_c_str();
+    test_choco_string_view();
     test_choco_string_equal();
     test_rslt_to_str();
     test_choco_string_mem_allocate();
+    test_choco_string_mem_reallocate();
     test_buffer_reserve();
     test_buffer_resize();
+    test_buffer_grow();
+    test_grow_capacity();
+    test_buffer_reallocate();
     test_is_string_valid();
 
     memory_system_destroy();
@@ -1059,14 +1667,15 @@ static void NO_COVERAGE test_choco_string_create_from_c_string(void) {
         s_test_config_choco_string_mem_allocate.fail_on_call = 2U;
         s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
-        ret = choco_string_create_from_c_string("aaa", &string);
+        // 内部バッファに収まらない長さの文字列でヒープ確保を発生させる
+        ret = choco_string_create_from_c_string("0123456789abcdefghijklmnopqrstuvwxyz", &string);
         assert(CHOCO_STRING_NO_MEMORY == ret);
         assert(NULL == string);
 
         test_choco_string_config_reset();
     }
     {
-        // 正常系（非空文字列）
+        // 正常系（非空文字列、内部バッファに収まる -> バッファのヒープ確保なし）
         choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
         choco_string_t* string = NULL;
 
@@ -1076,8 +1685,9 @@ static void NO_COVERAGE test_choco_string_create_from_c_string(void) {
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(NULL != string);
         assert(3U == string->len);
-        assert(4U == string->capacity);
-        assert(NULL != string->buffer);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == string->capacity);
+        assert(string->small_buffer == string->buffer);
+        assert(1U == s_test_config_choco_string_mem_allocate.call_count);
         assert(0 == strcmp(string->buffer, "aaa"));
 
         choco_string_destroy(&string);
@@ -1085,6 +1695,27 @@ static void NO_COVERAGE test_choco_string_create_from_c_string(void) {
 
         test_choco_string_config_reset();
     }
+    {
+        // 正常系（内部バッファに収まらない -> 文字列長さ+1でヒープ確保）
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* string = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("0123456789abcdefghijklmn", &string);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(NULL != string);
+        assert(24U == string->len);
+        assert(25U == string->capacity);
+        assert(string->small_buffer != string->buffer);
+        assert(2U == s_test_config_choco_string_mem_allocate.call_count);
+        assert(0 == strcmp(string->buffer, "0123456789abcdefghijklmn"));
+
+        choco_string_destroy(&string);
+        assert(NULL == string);
+
+        test_choco_string_config_reset();
+    }
     memory_system_destroy();
 }
 
@@ -1140,13 +1771,13 @@ static void NO_COVERAGE test_choco_string_destroy(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("abc", &string);
+        ret = choco_string_create_from_c_string("0123456789abcdefghijklmnopqrstuvwxyz", &string);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(NULL != string);
-        assert(3U == string->len);
-        assert(4U == string->capacity);
-        assert(NULL != string->buffer);
-        assert(0 == strcmp(string->buffer, "abc"));
+        assert(36U == string->len);
+        assert(37U == string->capacity);
+        assert(string->small_buffer != string->buffer);
+        assert(0 == strcmp(string->buffer, "0123456789abcdefghijklmnopqrstuvwxyz"));
 
         choco_string_destroy(&string);
         assert(NULL == string);
@@ -1365,12 +1996,12 @@ static void NO_COVERAGE test_choco_string_copy(void) {
 
         ret = choco_string_create_from_c_string("bbbbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(6U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);
 
         ret = choco_string_copy(src, dst);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(3U == dst->len);
-        assert(6U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);
         assert(0 == strcmp(dst->buffer, "aaa"));
 
         choco_string_destroy(&dst);
@@ -1388,18 +2019,18 @@ static void NO_COVERAGE test_choco_string_copy(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("aaaaa", &src);
+        ret = choco_string_create_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", &src);
         assert(CHOCO_STRING_SUCCESS == ret);
 
         ret = choco_string_create_from_c_string("bbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(4U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);
 
         ret = choco_string_copy(src, dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(5U == dst->len);
-        assert(6U == dst->capacity);
-        assert(0 == strcmp(dst->buffer, "aaaaa"));
+        assert(30U == dst->len);
+        assert(31U == dst->capacity);
+        assert(0 == strcmp(dst->buffer, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
 
         choco_string_destroy(&dst);
         choco_string_destroy(&src);
@@ -1419,7 +2050,7 @@ static void NO_COVERAGE test_choco_string_copy(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("aaaaa", &src);
+        ret = choco_string_create_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", &src);
         assert(CHOCO_STRING_SUCCESS == ret);
 
         ret = choco_string_create_from_c_string("bbb", &dst);
@@ -1457,7 +2088,7 @@ static void NO_COVERAGE test_choco_string_copy(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("aaaaa", &src);
+        ret = choco_string_create_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", &src);
         assert(CHOCO_STRING_SUCCESS == ret);
 
         ret = choco_string_create_from_c_string("bbb", &dst);
@@ -1634,12 +2265,12 @@ static void NO_COVERAGE test_choco_string_copy_from_c_string(void) {
 
         ret = choco_string_create_from_c_string("bbbbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(6U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);
 
         ret = choco_string_copy_from_c_string("aaa", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(3U == dst->len);
-        assert(6U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);
         assert(0 == strcmp(dst->buffer, "aaa"));
 
         choco_string_destroy(&dst);
@@ -1656,13 +2287,13 @@ static void NO_COVERAGE test_choco_string_copy_from_c_string(void) {
 
         ret = choco_string_create_from_c_string("bbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(4U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);
 
-        ret = choco_string_copy_from_c_string("aaaaa", dst);
+        ret = choco_string_copy_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(5U == dst->len);
-        assert(6U == dst->capacity);
-        assert(0 == strcmp(dst->buffer, "aaaaa"));
+        assert(30U == dst->len);
+        assert(31U == dst->capacity);
+        assert(0 == strcmp(dst->buffer, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
 
         choco_string_destroy(&dst);
         assert(NULL == dst);
@@ -1681,11 +2312,11 @@ static void NO_COVERAGE test_choco_string_copy_from_c_string(void) {
         assert(0U == dst->capacity);
         assert(NULL == dst->buffer);
 
-        ret = choco_string_copy_from_c_string("aaaaa", dst);
+        ret = choco_string_copy_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(5U == dst->len);
-        assert(6U == dst->capacity);
-        assert(0 == strcmp(dst->buffer, "aaaaa"));
+        assert(30U == dst->len);
+        assert(31U == dst->capacity);
+        assert(0 == strcmp(dst->buffer, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
 
         choco_string_destroy(&dst);
         assert(NULL == dst);
@@ -1712,7 +2343,7 @@ static void NO_COVERAGE test_choco_string_copy_from_c_string(void) {
         s_test_config_buffer_resize.fail_on_call = 1U;
         s_test_config_buffer_resize.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
-        ret = choco_string_copy_from_c_string("aaaaa", dst);
+        ret = choco_string_copy_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", dst);
         assert(CHOCO_STRING_NO_MEMORY == ret);
         assert(old_ptr == dst->buffer);
         assert(old_len == dst->len);
@@ -1746,7 +2377,7 @@ static void NO_COVERAGE test_choco_string_copy_from_c_string(void) {
         s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
         s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
-        ret = choco_string_copy_from_c_string("aaaaa", dst);
+        ret = choco_string_copy_from_c_string("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", dst);
         assert(CHOCO_STRING_NO_MEMORY == ret);
         assert(old_ptr == dst->buffer);
         assert(old_len == dst->len);
@@ -1988,9 +2619,9 @@ static void NO_COVERAGE test_choco_string_concat(void) {
         ret = choco_string_default_create(&dst);
         assert(CHOCO_STRING_SUCCESS == ret);
 
-        ret = buffer_resize(16U, dst);
+        ret = buffer_resize(64U, dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(16U == dst->capacity);
+        assert(64U == dst->capacity);
 
         ret = choco_string_copy_from_c_string("bbb", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
@@ -2027,18 +2658,18 @@ static void NO_COVERAGE test_choco_string_concat(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("bbb", &dst);
+        ret = choco_string_create_from_c_string("bbbbbbbbbbbbbbbbbbbbbbbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(4U == dst->capacity);
+        assert(25U == dst->capacity);   // 内部バッファに収まらない長さ
 
         ret = choco_string_create_from_c_string("aa", &src);
         assert(CHOCO_STRING_SUCCESS == ret);
 
         ret = choco_string_concat(src, dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(5U == dst->len);
-        assert(6U == dst->capacity);
-        assert(0 == strcmp(dst->buffer, "bbbaa"));
+        assert(26U == dst->len);
+        assert(50U == dst->capacity);   // 25 -> 2倍の50に拡張
+        assert(0 == strcmp(dst->buffer, "bbbbbbbbbbbbbbbbbbbbbbbbaa"));
 
         choco_string_destroy(&src);
         choco_string_destroy(&dst);
@@ -2066,7 +2697,7 @@ static void NO_COVERAGE test_choco_string_concat(void) {
         ret = choco_string_concat(src, dst);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(2U == dst->len);
-        assert(3U == dst->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);   // 内部バッファを使用
         assert(0 == strcmp(dst->buffer, "aa"));
 
         choco_string_destroy(&src);
@@ -2077,7 +2708,7 @@ static void NO_COVERAGE test_choco_string_concat(void) {
         test_choco_string_config_reset();
     }
     {
-        // 再確保側で choco_string_mem_allocate 失敗 -> CHOCO_STRING_NO_MEMORY、dst不変
+        // 再確保側で choco_string_mem_reallocate 失敗 -> CHOCO_STRING_NO_MEMORY、dst不変
         choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
         choco_string_t* src = NULL;
         choco_string_t* dst = NULL;
@@ -2087,7 +2718,7 @@ static void NO_COVERAGE test_choco_string_concat(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("bbb", &dst);
+        ret = choco_string_create_from_c_string("bbbbbbbbbbbbbbbbbbbbbbbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
 
         ret = choco_string_create_from_c_string("aa", &src);
@@ -2099,15 +2730,15 @@ static void NO_COVERAGE test_choco_string_concat(void) {
 
         test_choco_string_config_reset();
 
-        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
-        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
         ret = choco_string_concat(src, dst);
         assert(CHOCO_STRING_NO_MEMORY == ret);
         assert(old_len == dst->len);
         assert(old_cap == dst->capacity);
         assert(old_ptr == dst->buffer);
-        assert(0 == strcmp(dst->buffer, "bbb"));
+        assert(0 == strcmp(dst->buffer, "bbbbbbbbbbbbbbbbbbbbbbbb"));
 
         choco_string_destroy(&src);
         choco_string_destroy(&dst);
@@ -2230,8 +2861,8 @@ static void NO_COVERAGE test_choco_string_concat_from_c_string(void) {
         old_cap = dst->capacity;
         old_ptr = dst->buffer;
 
-        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
-        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
         ret = choco_string_concat_from_c_string("", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
@@ -2257,9 +2888,9 @@ static void NO_COVERAGE test_choco_string_concat_from_c_string(void) {
         ret = choco_string_default_create(&dst);
         assert(CHOCO_STRING_SUCCESS == ret);
 
-        ret = buffer_resize(16U, dst);
+        ret = buffer_resize(64U, dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(16U == dst->capacity);
+        assert(64U == dst->capacity);
 
         ret = choco_string_copy_from_c_string("bbb", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
@@ -2268,8 +2899,8 @@ static void NO_COVERAGE test_choco_string_concat_from_c_string(void) {
         old_cap = dst->capacity;
         old_ptr = dst->buffer;
 
-        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
-        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
         ret = choco_string_concat_from_c_string("aa", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
@@ -2290,77 +2921,882 @@ static void NO_COVERAGE test_choco_string_concat_from_c_string(void) {
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("bbb", &dst);
+        ret = choco_string_create_from_c_string("bbbbbbbbbbbbbbbbbbbbbbbb", &dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(4U == dst->capacity);
+        assert(25U == dst->capacity);   // 内部バッファに収まらない長さ
 
         ret = choco_string_concat_from_c_string("aa", dst);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(5U == dst->len);
-        assert(6U == dst->capacity);
-        assert(0 == strcmp(dst->buffer, "bbbaa"));
+        assert(26U == dst->len);
+        assert(50U == dst->capacity);   // 25 -> 2倍の50に拡張
+        assert(0 == strcmp(dst->buffer, "bbbbbbbbbbbbbbbbbbbbbbbbaa"));
+
+        choco_string_destroy(&dst);
+        assert(NULL == dst);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // capacity不足 -> 再確保経由で SUCCESS（dst_->len == 0 かつ dst_->capacity == 0）
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_default_create(&dst);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(0U == dst->capacity);
+        assert(NULL == dst->buffer);
+
+        ret = choco_string_concat_from_c_string("aa", dst);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(2U == dst->len);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == dst->capacity);   // 内部バッファを使用
+        assert(NULL != dst->buffer);
+        assert(0 == strcmp(dst->buffer, "aa"));
+
+        choco_string_destroy(&dst);
+        assert(NULL == dst);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // 再確保側で choco_string_mem_reallocate 失敗 -> CHOCO_STRING_NO_MEMORY、dst不変
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* dst = NULL;
+        size_t old_len = 0U;
+        size_t old_cap = 0U;
+        char* old_ptr = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("bbbbbbbbbbbbbbbbbbbbbbbb", &dst);
+        assert(CHOCO_STRING_SUCCESS == ret);
+
+        old_len = dst->len;
+        old_cap = dst->capacity;
+        old_ptr = dst->buffer;
+
+        test_choco_string_config_reset();
+
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        ret = choco_string_concat_from_c_string("aa", dst);
+        assert(CHOCO_STRING_NO_MEMORY == ret);
+        assert(old_len == dst->len);
+        assert(old_cap == dst->capacity);
+        assert(old_ptr == dst->buffer);
+        assert(0 == strcmp(dst->buffer, "bbbbbbbbbbbbbbbbbbbbbbbb"));
 
         choco_string_destroy(&dst);
         assert(NULL == dst);
 
         test_choco_string_config_reset();
     }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_choco_string_copy_from_view(void) {
+    memory_system_create();
+    {
+        // choco_string_copy_from_view() 冒頭で強制的に CHOCO_STRING_NO_MEMORY を返させる
+        choco_string_t* dst = NULL;
+        test_call_control_t config = {0};
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        test_choco_string_copy_from_view_config_set(&config);
+
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_copy_from_view(choco_string_view_from_c_string("abc"), dst));
+        assert(0U == dst->len);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // dst_ == NULL, data == NULL かつ length != 0 -> CHOCO_STRING_INVALID_ARGUMENT
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { NULL, 1U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_copy_from_view(choco_string_view_from_c_string("abc"), NULL));
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_copy_from_view(view, dst));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 壊れた dst_ -> CHOCO_STRING_DATA_CORRUPTED
+        struct choco_string corrupted_dst;
+
+        memset(&corrupted_dst, 0, sizeof(corrupted_dst));
+        corrupted_dst.buffer = (char*)0x1;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_DATA_CORRUPTED == choco_string_copy_from_view(choco_string_view_from_c_string("a"), (choco_string_t*)&corrupted_dst));
+        test_choco_string_config_reset();
+    }
+    {
+        // overflow -> CHOCO_STRING_OVERFLOW
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { "a", SIZE_MAX };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        assert(CHOCO_STRING_OVERFLOW == choco_string_copy_from_view(view, dst));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 長さ0のビュー(data == NULL) -> 空文字列になる
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { NULL, 0U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_copy_from_view(view, dst));
+        assert(0U == dst->len);
+        assert(0 == strcmp("", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+        assert(CHOCO_STRING_SUCCESS == choco_string_copy_from_view(view, dst));
+        assert(NULL == dst->buffer);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 文字列の一部(終端文字なし)をコピーできる、容量が足りていればメモリ確保しない
+        choco_string_t* dst = NULL;
+        const char* src = "texture_name.bmp";
+        choco_string_view_t view = { src, 12U };
+        char* old_ptr = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("0123456789012345678901234567890", &dst));
+        old_ptr = dst->buffer;
+
+        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_copy_from_view(view, dst));
+        assert(12U == dst->len);
+        assert(old_ptr == dst->buffer);
+        assert(0 == strcmp("texture_name", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 容量不足 -> buffer_resize()で拡張
+        choco_string_t* dst = NULL;
+        const char* src = "path/to/directory/texture_name.bmp";
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_copy_from_view(choco_string_view_from_c_string(src), dst));
+        assert(strlen(src) == dst->len);
+        assert(strlen(src) + 1U == dst->capacity);
+        assert(0 == strcmp(src, choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // buffer_resize() 失敗 -> エラーを返し、dst_は不変
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        s_test_config_buffer_resize.fail_on_call = 1U;
+        s_test_config_buffer_resize.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_copy_from_view(choco_string_view_from_c_string("path/to/directory/texture_name.bmp"), dst));
+        assert(0 == strcmp("abc", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // dst_自身の一部を参照するビュー -> 重なりがあっても正しくコピーされる
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { NULL, 0U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/file.txt", &dst));
+        view.data = dst->buffer + 5;
+        view.length = 7U;
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_copy_from_view(view, dst));
+        assert(0 == strcmp("to/file", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_choco_string_concat_from_view(void) {
+    memory_system_create();
+    {
+        // choco_string_concat_from_view() 冒頭で強制的に CHOCO_STRING_NO_MEMORY を返させる
+        choco_string_t* dst = NULL;
+        test_call_control_t config = {0};
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        test_choco_string_concat_from_view_config_set(&config);
+
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_concat_from_view(choco_string_view_from_c_string("def"), dst));
+        assert(0 == strcmp("abc", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // dst_ == NULL, data == NULL かつ length != 0 -> CHOCO_STRING_INVALID_ARGUMENT
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { NULL, 1U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_concat_from_view(choco_string_view_from_c_string("abc"), NULL));
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_concat_from_view(view, dst));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 壊れた dst_ -> CHOCO_STRING_DATA_CORRUPTED
+        struct choco_string corrupted_dst;
+
+        memset(&corrupted_dst, 0, sizeof(corrupted_dst));
+        corrupted_dst.buffer = (char*)0x1;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_DATA_CORRUPTED == choco_string_concat_from_view(choco_string_view_from_c_string("a"), (choco_string_t*)&corrupted_dst));
+        test_choco_string_config_reset();
+    }
+    {
+        // overflow -> CHOCO_STRING_OVERFLOW
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { "a", SIZE_MAX - 3U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        assert(CHOCO_STRING_OVERFLOW == choco_string_concat_from_view(view, dst));
+        assert(0 == strcmp("abc", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 長さ0のビュー -> no-op
+        choco_string_t* dst = NULL;
+        choco_string_view_t view = { NULL, 0U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(view, dst));
+        assert(0U == dst->len);
+        assert(NULL == dst->buffer);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // ディレクトリ + ファイル名 + 拡張子の組み立て(内部バッファに収まる場合はメモリ確保なし)
+        choco_string_t* dst = NULL;
+        const char* name = "texture_name.bmp";
+        choco_string_view_t name_view = { name, 7U };
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_from_c_string("assets/"), dst));
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(name_view, dst));
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_from_c_string(".bmp"), dst));
+        assert(0 == strcmp("assets/texture.bmp", choco_string_c_str(dst)));
+        assert(dst->buffer == dst->small_buffer);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 容量不足 -> buffer_grow()で拡張し、既存文字列は保持される
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/directory/", &dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_from_c_string("texture_name.bmp"), dst));
+        assert(0 == strcmp("path/to/directory/texture_name.bmp", choco_string_c_str(dst)));
+        assert(dst->len + 1U <= dst->capacity);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // buffer_grow() 失敗 -> エラーを返し、dst_は不変
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/directory/", &dst));
+
+        s_test_config_buffer_grow.fail_on_call = 1U;
+        s_test_config_buffer_grow.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_concat_from_view(choco_string_view_from_c_string("texture_name.bmp"), dst));
+        assert(0 == strcmp("path/to/directory/", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // dst_自身を参照するビュー(バッファ拡張あり/なし) -> 拡張後の位置から連結される
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_get(dst), dst));
+        assert(0 == strcmp("abcabc", choco_string_c_str(dst)));
+        assert(dst->buffer == dst->small_buffer);
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_get(dst), dst));
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_get(dst), dst));
+        assert(0 == strcmp("abcabcabcabcabcabcabcabc", choco_string_c_str(dst)));
+        assert(dst->buffer != dst->small_buffer);
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_concat_from_view(choco_string_view_get(dst), dst));
+        assert(48U == dst->len);
+        assert(0 == strncmp("abcabcabcabcabcabcabcabcabcabcabcabcabcabcabcabc", choco_string_c_str(dst), 48U));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_choco_string_append_format(void) {
+    memory_system_create();
+    {
+        // choco_string_append_format() 冒頭で強制的に CHOCO_STRING_NO_MEMORY を返させる
+        choco_string_t* dst = NULL;
+        test_call_control_t config = {0};
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        test_choco_string_append_format_config_set(&config);
+
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_append_format(dst, "%d", 1));
+        assert(0U == dst->len);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // dst_ == NULL, format_ == NULL -> CHOCO_STRING_INVALID_ARGUMENT
+        choco_string_t* dst = NULL;
+        const char* null_format = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_append_format(NULL, "%d", 1));
+        // format_ == NULLの事前条件テストのため、非リテラルの書式指定に対する警告を抑制する
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-security"
+#endif
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_append_format(dst, null_format));
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 壊れた dst_ -> CHOCO_STRING_DATA_CORRUPTED
+        struct choco_string corrupted_dst;
+
+        memset(&corrupted_dst, 0, sizeof(corrupted_dst));
+        corrupted_dst.buffer = (char*)0x1;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_DATA_CORRUPTED == choco_string_append_format((choco_string_t*)&corrupted_dst, "%d", 1));
+        test_choco_string_config_reset();
+    }
+    {
+        // 空き領域に収まる -> メモリ確保なしで連結される
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("tex", &dst));
+
+        s_test_config_buffer_grow.fail_on_call = 1U;
+        s_test_config_buffer_grow.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_append_format(dst, "_%02d.%s", 7, "bmp"));
+        assert(0 == strcmp("tex_07.bmp", choco_string_c_str(dst)));
+        assert(10U == dst->len);
+        assert(dst->buffer == dst->small_buffer);
+        assert(0U == s_test_config_buffer_grow.call_count);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // バッファ未確保 -> 拡張して書式化
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_append_format(dst, "%s%s%s", "path/to/", "file", ".txt"));
+        assert(0 == strcmp("path/to/file.txt", choco_string_c_str(dst)));
+        assert(16U == dst->len);
+        assert(2U == s_test_config_mock_vsnprintf.call_count);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 空き領域不足 -> 拡張して再度書式化、既存文字列は保持される
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("frame:", &dst));
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_append_format(dst, " count=%u, name=%s", 123456U, "main_camera_view"));
+        assert(0 == strcmp("frame: count=123456, name=main_camera_view", choco_string_c_str(dst)));
+        assert(strlen("frame: count=123456, name=main_camera_view") == dst->len);
+        assert(dst->buffer != dst->small_buffer);
+
+        // 空文字列の書式化 -> 変化なし
+        assert(CHOCO_STRING_SUCCESS == choco_string_append_format(dst, "%s", ""));
+        assert(0 == strcmp("frame: count=123456, name=main_camera_view", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 1回目の書式化失敗 -> CHOCO_STRING_RUNTIME_ERROR、dst_は不変
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        s_test_config_mock_vsnprintf.fail_on_call = 1U;
+        s_test_config_mock_vsnprintf.forced_result = -1;
+
+        assert(CHOCO_STRING_RUNTIME_ERROR == choco_string_append_format(dst, "%d", 1));
+        assert(0 == strcmp("abc", choco_string_c_str(dst)));
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // buffer_grow() 失敗 -> エラーを返し、途中まで書き込まれた文字列は取り消される
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        s_test_config_buffer_grow.fail_on_call = 1U;
+        s_test_config_buffer_grow.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_append_format(dst, "%s", "0123456789012345678901234567890"));
+        assert(0 == strcmp("abc", choco_string_c_str(dst)));
+        assert(3U == dst->len);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 2回目の書式化失敗 -> CHOCO_STRING_RUNTIME_ERROR、dst_の文字列は不変
+        choco_string_t* dst = NULL;
+
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("abc", &dst));
+
+        s_test_config_mock_vsnprintf.fail_on_call = 2U;
+        s_test_config_mock_vsnprintf.forced_result = -1;
+
+        assert(CHOCO_STRING_RUNTIME_ERROR == choco_string_append_format(dst, "%s", "0123456789012345678901234567890"));
+        assert(0 == strcmp("abc", choco_string_c_str(dst)));
+        assert(3U == dst->len);
+
+        choco_string_destroy(&dst);
+        test_choco_string_config_reset();
+    }
+    {
+        // 1回目の書式化で算出した長さが極端に大きい -> CHOCO_STRING_OVERFLOW
+        struct choco_string fake_dst;
+
+        memset(&fake_dst, 0, sizeof(fake_dst));
+        fake_dst.len = SIZE_MAX - 2U;
+
+        test_choco_string_config_reset();
+
+        s_test_config_is_string_valid.fail_on_call = 1U;
+        s_test_config_is_string_valid.forced_result = true;
+        s_test_config_mock_vsnprintf.fail_on_call = 1U;
+        s_test_config_mock_vsnprintf.forced_result = 2;
+
+        assert(CHOCO_STRING_OVERFLOW == choco_string_append_format((choco_string_t*)&fake_dst, "%d", 10));
+
+        test_choco_string_config_reset();
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_choco_string_reserve(void) {
+    memory_system_create();
+    {
+        // choco_string_reserve() 冒頭で強制的に CHOCO_STRING_RUNTIME_ERROR を返させる
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+
+        test_choco_string_config_reset();
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)CHOCO_STRING_RUNTIME_ERROR;
+        test_choco_string_reserve_config_set(&config);
+
+        ret = choco_string_reserve(16U, NULL);
+        assert(CHOCO_STRING_RUNTIME_ERROR == ret);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // string_ == NULL -> CHOCO_STRING_INVALID_ARGUMENT
+        choco_string_result_t ret = CHOCO_STRING_SUCCESS;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_reserve(16U, NULL);
+        assert(CHOCO_STRING_INVALID_ARGUMENT == ret);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // string_ 破損 -> CHOCO_STRING_DATA_CORRUPTED
+        choco_string_result_t ret = CHOCO_STRING_SUCCESS;
+        choco_string_t corrupted = {0};
+        char buffer[4] = "abc";
+
+        test_choco_string_config_reset();
+
+        corrupted.len = 3U;
+        corrupted.capacity = 0U;
+        corrupted.buffer = buffer;
+        ret = choco_string_reserve(16U, &corrupted);
+        assert(CHOCO_STRING_DATA_CORRUPTED == ret);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // length_ + 1 がオーバーフロー -> CHOCO_STRING_OVERFLOW、string_不変
+        choco_string_result_t ret = CHOCO_STRING_SUCCESS;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_default_create(&str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+
+        ret = choco_string_reserve(SIZE_MAX, str);
+        assert(CHOCO_STRING_OVERFLOW == ret);
+        assert(0U == str->capacity);
+        assert(NULL == str->buffer);
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // 空の文字列に reserve -> 要求サイズちょうどで確保され、空文字列のまま
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_default_create(&str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+
+        // 内部バッファに収まる -> ヒープ確保なし
+        ret = choco_string_reserve(15U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(str->small_buffer == str->buffer);
+
+        ret = choco_string_reserve(63U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(64U == str->capacity);
+        assert(0U == str->len);
+        assert(NULL != str->buffer);
+        assert(0 == strcmp(choco_string_c_str(str), ""));
+
+        // 予約範囲内の連結ではバッファの再確保が発生しない
+        {
+            const char* old_ptr = str->buffer;
+            test_choco_string_config_reset();
+            ret = choco_string_concat_from_c_string("0123456789", str);
+            assert(CHOCO_STRING_SUCCESS == ret);
+            ret = choco_string_concat_from_c_string("abcdefghijklmnopqrstuvwxyz", str);
+            assert(CHOCO_STRING_SUCCESS == ret);
+            assert(old_ptr == str->buffer);
+            assert(64U == str->capacity);
+            assert(0U == s_test_config_choco_string_mem_reallocate.call_count);
+            assert(0 == strcmp(str->buffer, "0123456789abcdefghijklmnopqrstuvwxyz"));
+        }
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // 既に十分な容量 -> 何もしない、文字列は保持
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("abcd", &str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+
+        test_choco_string_config_reset();
+        ret = choco_string_reserve(CHOCO_STRING_SMALL_BUFFER_SIZE - 1U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        ret = choco_string_reserve(0U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(0U == s_test_config_choco_string_mem_allocate.call_count);
+        assert(0U == s_test_config_choco_string_mem_reallocate.call_count);
+
+        // 拡張 -> 文字列は保持される
+        ret = choco_string_reserve(32U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(33U == str->capacity);
+        assert(4U == str->len);
+        assert(0 == strcmp(str->buffer, "abcd"));
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // choco_string_mem_reallocate 失敗 -> エラーを返し、string_不変
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+        char* old_ptr = NULL;
+        const char* long_str = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string(long_str, &str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        old_ptr = str->buffer;
+
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        ret = choco_string_reserve(64U, str);
+        assert(CHOCO_STRING_NO_MEMORY == ret);
+        assert(old_ptr == str->buffer);
+        assert(37U == str->capacity);
+        assert(36U == str->len);
+        assert(0 == strcmp(str->buffer, long_str));
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_choco_string_shrink_to_fit(void) {
+    memory_system_create();
+    {
+        // choco_string_shrink_to_fit() 冒頭で強制的に CHOCO_STRING_RUNTIME_ERROR を返させる
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+
+        test_choco_string_config_reset();
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)CHOCO_STRING_RUNTIME_ERROR;
+        test_choco_string_shrink_to_fit_config_set(&config);
+
+        ret = choco_string_shrink_to_fit(NULL);
+        assert(CHOCO_STRING_RUNTIME_ERROR == ret);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // string_ == NULL -> CHOCO_STRING_INVALID_ARGUMENT, string_ 破損 -> CHOCO_STRING_DATA_CORRUPTED
+        choco_string_result_t ret = CHOCO_STRING_SUCCESS;
+        choco_string_t corrupted = {0};
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_shrink_to_fit(NULL);
+        assert(CHOCO_STRING_INVALID_ARGUMENT == ret);
+
+        corrupted.len = 0U;
+        corrupted.capacity = 4U;
+        corrupted.buffer = NULL;
+        ret = choco_string_shrink_to_fit(&corrupted);
+        assert(CHOCO_STRING_DATA_CORRUPTED == ret);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // 倍々で拡張された余剰領域を縮小 -> 文字列長さ+1 になり、文字列は保持される
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("bbbbbbbbbbbbbbbbbbbbbbbb", &str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        ret = choco_string_concat_from_c_string("d", str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(50U == str->capacity);
+
+        ret = choco_string_shrink_to_fit(str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(26U == str->capacity);
+        assert(25U == str->len);
+        assert(0 == strcmp(str->buffer, "bbbbbbbbbbbbbbbbbbbbbbbbd"));
+
+        // 既に縮小済み -> 何もしない
+        test_choco_string_config_reset();
+        ret = choco_string_shrink_to_fit(str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(26U == str->capacity);
+        assert(0U == s_test_config_choco_string_mem_reallocate.call_count);
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // 空文字列 -> バッファを解放し、default_create直後と同じ状態に戻す
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_default_create(&str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        ret = choco_string_shrink_to_fit(str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(0U == str->capacity);
+        assert(NULL == str->buffer);
+
+        ret = choco_string_reserve(63U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(64U == str->capacity);
+
+        ret = choco_string_shrink_to_fit(str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(0U == str->capacity);
+        assert(0U == str->len);
+        assert(NULL == str->buffer);
+        assert(0 == strcmp(choco_string_c_str(str), ""));
+
+        // 解放後も連結可能
+        ret = choco_string_concat_from_c_string("xy", str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(0 == strcmp(str->buffer, "xy"));
+
+        // 内部バッファ使用中の空文字列 -> 内部バッファも手放す
+        str->buffer[0] = '\0';
+        str->len = 0U;
+        ret = choco_string_shrink_to_fit(str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(0U == str->capacity);
+        assert(NULL == str->buffer);
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
     {
-        // capacity不足 -> 再確保経由で SUCCESS（dst_->len == 0 かつ dst_->capacity == 0）
+        // ヒープ領域に内部バッファに収まる文字列 -> 内部バッファへ移し、ヒープ領域を解放する
         choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
-        choco_string_t* dst = NULL;
+        choco_string_t* str = NULL;
 
         test_choco_string_config_reset();
 
-        ret = choco_string_default_create(&dst);
+        ret = choco_string_create_from_c_string("abc", &str);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(0U == dst->capacity);
-        assert(NULL == dst->buffer);
+        ret = choco_string_reserve(63U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(str->small_buffer != str->buffer);
 
-        ret = choco_string_concat_from_c_string("aa", dst);
+        ret = choco_string_shrink_to_fit(str);
         assert(CHOCO_STRING_SUCCESS == ret);
-        assert(2U == dst->len);
-        assert(3U == dst->capacity);
-        assert(NULL != dst->buffer);
-        assert(0 == strcmp(dst->buffer, "aa"));
+        assert(str->small_buffer == str->buffer);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(0 == strcmp(str->buffer, "abc"));
 
-        choco_string_destroy(&dst);
-        assert(NULL == dst);
+        // 内部バッファ使用中 -> これ以上縮小しない
+        ret = choco_string_shrink_to_fit(str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
 
+        choco_string_destroy(&str);
         test_choco_string_config_reset();
     }
     {
-        // 再確保側で choco_string_mem_allocate 失敗 -> CHOCO_STRING_NO_MEMORY、dst不変
+        // choco_string_mem_reallocate 失敗 -> エラーを返し、string_不変
         choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
-        choco_string_t* dst = NULL;
-        size_t old_len = 0U;
-        size_t old_cap = 0U;
+        choco_string_t* str = NULL;
         char* old_ptr = NULL;
 
         test_choco_string_config_reset();
 
-        ret = choco_string_create_from_c_string("bbb", &dst);
+        ret = choco_string_create_from_c_string("bbbbbbbbbbbbbbbbbbbbbbbb", &str);
         assert(CHOCO_STRING_SUCCESS == ret);
-
-        old_len = dst->len;
-        old_cap = dst->capacity;
-        old_ptr = dst->buffer;
+        ret = choco_string_reserve(63U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        old_ptr = str->buffer;
 
         test_choco_string_config_reset();
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
-        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
-        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
-
-        ret = choco_string_concat_from_c_string("aa", dst);
+        ret = choco_string_shrink_to_fit(str);
         assert(CHOCO_STRING_NO_MEMORY == ret);
-        assert(old_len == dst->len);
-        assert(old_cap == dst->capacity);
-        assert(old_ptr == dst->buffer);
-        assert(0 == strcmp(dst->buffer, "bbb"));
-
-        choco_string_destroy(&dst);
-        assert(NULL == dst);
+        assert(old_ptr == str->buffer);
+        assert(64U == str->capacity);
+        assert(0 == strcmp(str->buffer, "bbbbbbbbbbbbbbbbbbbbbbbb"));
 
+        choco_string_destroy(&str);
         test_choco_string_config_reset();
     }
     memory_system_destroy();
@@ -2493,7 +3929,7 @@ static void NO_COVERAGE test_choco_string_c_str(void) {
         assert(NULL != string);
         assert(NULL != string->buffer);
         assert(3U == string->len);
-        assert(4U == string->capacity);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == string->capacity);
         assert(0 == strcmp(string->buffer, "aaa"));
 
         c_ptr = choco_string_c_str(string);
@@ -2509,6 +3945,62 @@ static void NO_COVERAGE test_choco_string_c_str(void) {
     memory_system_destroy();
 }
 
+static void NO_COVERAGE test_choco_string_view(void) {
+    memory_system_create();
+    {
+        // choco_string_view_get(): NULL/バッファ未確保 -> 長さ0のビュー
+        choco_string_t* str = NULL;
+        choco_string_view_t view = choco_string_view_get(NULL);
+
+        assert(0U == view.length);
+        assert(NULL != view.data);
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&str));
+        view = choco_string_view_get(str);
+        assert(0U == view.length);
+
+        choco_string_destroy(&str);
+    }
+    {
+        // choco_string_view_get(): 文字列全体を参照する
+        choco_string_t* str = NULL;
+        choco_string_view_t view = { NULL, 0U };
+
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("camera", &str));
+        view = choco_string_view_get(str);
+        assert(str->buffer == view.data);
+        assert(6U == view.length);
+
+        choco_string_destroy(&str);
+    }
+    {
+        // choco_string_view_from_c_string()
+        const char* str = "texture";
+        choco_string_view_t view = choco_string_view_from_c_string(str);
+
+        assert(str == view.data);
+        assert(7U == view.length);
+
+        view = choco_string_view_from_c_string(NULL);
+        assert(NULL == view.data);
+        assert(0U == view.length);
+    }
+    {
+        // choco_string_view_equal()
+        const char* str = "texture_name.bmp";
+        choco_string_view_t name = { str, 7U };
+        choco_string_view_t empty1 = { NULL, 0U };
+        choco_string_view_t empty2 = { str, 0U };
+
+        assert(choco_string_view_equal(name, choco_string_view_from_c_string("texture")));
+        assert(!choco_string_view_equal(name, choco_string_view_from_c_string("texturf")));
+        assert(!choco_string_view_equal(name, choco_string_view_from_c_string("texture_")));
+        assert(choco_string_view_equal(empty1, empty2));
+        assert(!choco_string_view_equal(empty1, name));
+    }
+    memory_system_destroy();
+}
+
 // Generated by ChatGPT
 static void test_choco_string_equal(void) {
     {
@@ -2917,6 +4409,57 @@ static void NO_COVERAGE test_choco_string_mem_allocate(void) {
 }
 
 // Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_choco_string_mem_reallocate(void) {
+    memory_system_create();
+    {
+        // choco_string_mem_reallocate() 冒頭で強制的に CHOCO_STRING_NO_MEMORY を返させる
+        void* p = NULL;
+        test_choco_string_config_reset();
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        assert(CHOCO_STRING_NO_MEMORY == choco_string_mem_reallocate(NULL, 0U, 16U, &p));
+        assert(NULL == p);
+        test_choco_string_config_reset();
+    }
+    {
+        // out_ptr_ == NULL -> CHOCO_STRING_INVALID_ARGUMENT
+        test_choco_string_config_reset();
+        assert(CHOCO_STRING_INVALID_ARGUMENT == choco_string_mem_reallocate(NULL, 0U, 16U, NULL));
+    }
+    {
+        // memory_system_reallocate() の実行結果変換
+        void* p = NULL;
+        test_call_control_t config = {0};
+
+        test_choco_string_config_reset();
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_LIMIT_EXCEEDED;
+        test_memory_system_reallocate_config_set(&config);
+        assert(CHOCO_STRING_LIMIT_EXCEEDED == choco_string_mem_reallocate(NULL, 0U, 16U, &p));
+        assert(NULL == p);
+
+        test_choco_memory_config_reset();
+        config.forced_result = (int)0x7fffffff;
+        test_memory_system_reallocate_config_set(&config);
+        assert(CHOCO_STRING_UNDEFINED_ERROR == choco_string_mem_reallocate(NULL, 0U, 16U, &p));
+        assert(NULL == p);
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系: 新規割り当て -> 拡張(内容は保持される)
+        char* p = NULL;
+        assert(CHOCO_STRING_SUCCESS == choco_string_mem_reallocate(NULL, 0U, 4U, (void**)&p));
+        assert(NULL != p);
+        memcpy(p, "abc", 4U);
+        assert(CHOCO_STRING_SUCCESS == choco_string_mem_reallocate(p, 4U, 64U, (void**)&p));
+        assert(0 == strcmp("abc", p));
+        assert(0 == p[63]);
+        memory_system_free(p, 64U, MEMORY_TAG_STRING);
+    }
+    memory_system_destroy();
+}
+
 static void NO_COVERAGE test_buffer_reserve(void) {
     memory_system_create();
     {
@@ -2963,7 +4506,7 @@ static void NO_COVERAGE test_buffer_reserve(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_reserve(8U, NULL);
+        ret = buffer_reserve(32U, NULL);
         assert(CHOCO_STRING_INVALID_ARGUMENT == ret);
 
         test_choco_string_config_reset();
@@ -2983,7 +4526,7 @@ static void NO_COVERAGE test_buffer_reserve(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_reserve(8U, &string);
+        ret = buffer_reserve(32U, &string);
         assert(CHOCO_STRING_BAD_OPERATION == ret);
         assert(0U == string.len);
         assert(2U == string.capacity);
@@ -3004,7 +4547,7 @@ static void NO_COVERAGE test_buffer_reserve(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_reserve(8U, &string);
+        ret = buffer_reserve(32U, &string);
         assert(CHOCO_STRING_DATA_CORRUPTED == ret);
         assert(0U == string.len);
         assert(0U == string.capacity);
@@ -3025,7 +4568,7 @@ static void NO_COVERAGE test_buffer_reserve(void) {
         s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
         s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
-        ret = buffer_reserve(8U, &string);
+        ret = buffer_reserve(32U, &string);
         assert(CHOCO_STRING_NO_MEMORY == ret);
         assert(0U == string.len);
         assert(0U == string.capacity);
@@ -3042,10 +4585,10 @@ static void NO_COVERAGE test_buffer_reserve(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_reserve(8U, &string);
+        ret = buffer_reserve(32U, &string);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(0U == string.len);
-        assert(8U == string.capacity);
+        assert(32U == string.capacity);
         assert(NULL != string.buffer);
 
         for(size_t i = 0; i < string.capacity; ++i) {
@@ -3060,6 +4603,25 @@ static void NO_COVERAGE test_buffer_reserve(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
     }
+    {
+        // 内部バッファに収まるサイズ -> ヒープ確保せず内部バッファを使用
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t string = {0};
+
+        test_choco_string_config_reset();
+        test_choco_memory_config_reset();
+
+        ret = buffer_reserve(CHOCO_STRING_SMALL_BUFFER_SIZE, &string);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(string.small_buffer == string.buffer);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == string.capacity);
+        assert(0U == string.len);
+        assert(0U == s_test_config_choco_string_mem_allocate.call_count);
+        assert(true == is_string_valid(&string));
+
+        test_choco_string_config_reset();
+        test_choco_memory_config_reset();
+    }
     memory_system_destroy();
 }
 
@@ -3093,7 +4655,7 @@ static void NO_COVERAGE test_buffer_resize(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_resize(8U, NULL);
+        ret = buffer_resize(32U, NULL);
         assert(CHOCO_STRING_INVALID_ARGUMENT == ret);
 
         test_choco_string_config_reset();
@@ -3128,7 +4690,7 @@ static void NO_COVERAGE test_buffer_resize(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_resize(8U, &string);
+        ret = buffer_resize(32U, &string);
         assert(CHOCO_STRING_DATA_CORRUPTED == ret);
         assert(0U == string.len);
         assert(0U == string.capacity);
@@ -3149,7 +4711,7 @@ static void NO_COVERAGE test_buffer_resize(void) {
         s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
         s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
 
-        ret = buffer_resize(8U, &string);
+        ret = buffer_resize(32U, &string);
         assert(CHOCO_STRING_NO_MEMORY == ret);
         assert(0U == string.len);
         assert(0U == string.capacity);
@@ -3166,10 +4728,10 @@ static void NO_COVERAGE test_buffer_resize(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        ret = buffer_resize(8U, &string);
+        ret = buffer_resize(32U, &string);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(0U == string.len);
-        assert(8U == string.capacity);
+        assert(32U == string.capacity);
         assert(NULL != string.buffer);
 
         for(size_t i = 0; i < string.capacity; ++i) {
@@ -3205,10 +4767,10 @@ static void NO_COVERAGE test_buffer_resize(void) {
         string.capacity = 4U;
         string.len = 0U;
 
-        ret = buffer_resize(8U, &string);
+        ret = buffer_resize(32U, &string);
         assert(CHOCO_STRING_SUCCESS == ret);
         assert(0U == string.len);
-        assert(8U == string.capacity);
+        assert(32U == string.capacity);
         assert(NULL != string.buffer);
         assert(old_buf != string.buffer);
 
@@ -3224,6 +4786,263 @@ static void NO_COVERAGE test_buffer_resize(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
     }
+    {
+        // 内部バッファに収まるサイズ -> 保持していたヒープ領域を解放し、内部バッファを使用
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t string = {0};
+
+        test_choco_string_config_reset();
+        test_choco_memory_config_reset();
+
+        ret = buffer_resize(64U, &string);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(string.small_buffer != string.buffer);
+
+        ret = buffer_resize(4U, &string);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(string.small_buffer == string.buffer);
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == string.capacity);
+        assert(0U == string.len);
+        assert(1U == s_test_config_choco_string_mem_allocate.call_count);
+
+        // 内部バッファ使用中にヒープへ切り替え -> 内部バッファは解放対象にならない
+        ret = buffer_resize(64U, &string);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(string.small_buffer != string.buffer);
+        assert(64U == string.capacity);
+
+        memory_system_free(string.buffer, string.capacity, MEMORY_TAG_STRING);
+        string.buffer = NULL;
+        string.capacity = 0U;
+
+        test_choco_string_config_reset();
+        test_choco_memory_config_reset();
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_buffer_grow(void) {
+    memory_system_create();
+    {
+        // buffer_grow() 冒頭で強制的に CHOCO_STRING_RUNTIME_ERROR を返させる
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t string = {0};
+
+        test_choco_string_config_reset();
+
+        s_test_config_buffer_grow.fail_on_call = 1U;
+        s_test_config_buffer_grow.forced_result = (int)CHOCO_STRING_RUNTIME_ERROR;
+
+        ret = buffer_grow(16U, &string);
+        assert(CHOCO_STRING_RUNTIME_ERROR == ret);
+        assert(0U == string.capacity);
+        assert(NULL == string.buffer);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // required_size_ == 0 -> CHOCO_STRING_INVALID_ARGUMENT
+        choco_string_result_t ret = CHOCO_STRING_SUCCESS;
+        choco_string_t string = {0};
+
+        test_choco_string_config_reset();
+
+        ret = buffer_grow(0U, &string);
+        assert(CHOCO_STRING_INVALID_ARGUMENT == ret);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // 1文字ずつ連結 -> 再確保回数は対数オーダーに抑えられる
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+        size_t prev_capacity = 0U;
+        size_t grow_count = 0U;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_default_create(&str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+
+        for(size_t i = 0; i != 1000U; ++i) {
+            ret = choco_string_concat_from_c_string("a", str);
+            assert(CHOCO_STRING_SUCCESS == ret);
+            if(prev_capacity != str->capacity) {
+                assert(str->capacity >= (prev_capacity * 2U));
+                prev_capacity = str->capacity;
+                grow_count++;
+            }
+        }
+        assert(1000U == str->len);
+        // 内部バッファへの切り替え(確保なし) -> ヒープへの切り替え(新規確保) -> 以降は再確保
+        assert(2U == s_test_config_choco_string_mem_allocate.call_count);  // 構造体 + ヒープへの切り替え
+        assert((grow_count - 2U) == s_test_config_choco_string_mem_reallocate.call_count);
+        assert(grow_count <= 11U);
+        assert(true == is_string_valid(str));
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // 2倍では不足 -> required_size_ちょうどに拡張、文字列は保持
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("ab", &str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+
+        ret = buffer_grow(60U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(60U == str->capacity);
+        assert(2U == str->len);
+        assert(0 == strcmp(str->buffer, "ab"));
+        assert('\0' == str->buffer[59]);
+
+        // 既に十分 -> 何もしない
+        ret = buffer_grow(60U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(60U == str->capacity);
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_grow_capacity(void) {
+    assert(3U == grow_capacity(0U, 3U));
+    assert(8U == grow_capacity(4U, 6U));
+    assert(20U == grow_capacity(4U, 20U));
+    assert(SIZE_MAX == grow_capacity((SIZE_MAX / 2) + 1, SIZE_MAX - 1));
+    assert((SIZE_MAX - 1) == grow_capacity(SIZE_MAX / 2, SIZE_MAX - 1));
+}
+
+static void NO_COVERAGE test_buffer_reallocate(void) {
+    memory_system_create();
+    {
+        // buffer_reallocate() 冒頭で強制的に CHOCO_STRING_RUNTIME_ERROR を返させる
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t string = {0};
+
+        test_choco_string_config_reset();
+
+        s_test_config_buffer_reallocate.fail_on_call = 1U;
+        s_test_config_buffer_reallocate.forced_result = (int)CHOCO_STRING_RUNTIME_ERROR;
+
+        ret = buffer_reallocate(8U, &string);
+        assert(CHOCO_STRING_RUNTIME_ERROR == ret);
+        assert(0U == string.capacity);
+        assert(NULL == string.buffer);
+
+        test_choco_string_config_reset();
+    }
+    {
+        // バッファ未確保 -> 内部バッファ -> ヒープ -> ヒープ拡張 -> 内部バッファの順に切り替え、文字列は保持される
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+        const char* long_str = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        test_choco_string_config_reset();
+        test_choco_memory_config_reset();
+
+        ret = choco_string_default_create(&str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        test_choco_string_config_reset();
+
+        ret = buffer_reallocate(4U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(true == is_small_buffer(str));
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(0U == s_test_config_choco_string_mem_allocate.call_count);
+        assert(0U == s_test_config_choco_string_mem_reallocate.call_count);
+        memcpy(str->buffer, "abc", 4U);
+        str->len = 3U;
+
+        // 内部バッファ内に収まる -> 何もしない
+        ret = buffer_reallocate(10U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(true == is_small_buffer(str));
+
+        ret = buffer_reallocate(CHOCO_STRING_SMALL_BUFFER_SIZE + 1U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(false == is_small_buffer(str));
+        assert((CHOCO_STRING_SMALL_BUFFER_SIZE + 1U) == str->capacity);
+        assert(1U == s_test_config_choco_string_mem_allocate.call_count);
+        assert(0 == strcmp(str->buffer, "abc"));
+        assert(true == is_string_valid(str));
+
+        ret = buffer_reallocate(64U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(64U == str->capacity);
+        assert(1U == s_test_config_choco_string_mem_reallocate.call_count);
+        assert(0 == strcmp(str->buffer, "abc"));
+        memcpy(str->buffer, long_str, strlen(long_str) + 1U);
+        str->len = strlen(long_str);
+
+        // 文字列を短くしてから内部バッファへ戻す -> ヒープ領域は解放される
+        str->buffer[5] = '\0';
+        str->len = 5U;
+        ret = buffer_reallocate(6U, str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(true == is_small_buffer(str));
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(0 == strcmp(str->buffer, "01234"));
+        assert(true == is_string_valid(str));
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // 内部バッファからヒープへの切り替えでメモリ確保失敗 -> エラーを返し、string_不変
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("abc", &str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(true == is_small_buffer(str));
+
+        test_choco_string_config_reset();
+        s_test_config_choco_string_mem_allocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        ret = buffer_reallocate(64U, str);
+        assert(CHOCO_STRING_NO_MEMORY == ret);
+        assert(true == is_small_buffer(str));
+        assert(CHOCO_STRING_SMALL_BUFFER_SIZE == str->capacity);
+        assert(0 == strcmp(str->buffer, "abc"));
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
+    {
+        // ヒープ領域の再確保失敗 -> エラーを返し、string_不変
+        choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+        choco_string_t* str = NULL;
+        char* old_ptr = NULL;
+
+        test_choco_string_config_reset();
+
+        ret = choco_string_create_from_c_string("0123456789abcdefghijklmnopqrstuvwxyz", &str);
+        assert(CHOCO_STRING_SUCCESS == ret);
+        assert(false == is_small_buffer(str));
+        old_ptr = str->buffer;
+
+        test_choco_string_config_reset();
+        s_test_config_choco_string_mem_reallocate.fail_on_call = 1U;
+        s_test_config_choco_string_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        ret = buffer_reallocate(128U, str);
+        assert(CHOCO_STRING_NO_MEMORY == ret);
+        assert(old_ptr == str->buffer);
+        assert(37U == str->capacity);
+
+        choco_string_destroy(&str);
+        test_choco_string_config_reset();
+    }
     memory_system_destroy();
 }
 
@@ -3406,6 +5225,26 @@ static void NO_COVERAGE test_is_string_valid(void) {
         ret = is_string_valid(&string);
         assert(true == ret);
 
+        test_choco_string_config_reset();
+    }
+    {
+        // 異常系: 内部バッファ使用中に capacity != CHOCO_STRING_SMALL_BUFFER_SIZE -> false
+        choco_string_t string = {0};
+        bool ret = true;
+
+        string.len = 0U;
+        string.capacity = CHOCO_STRING_SMALL_BUFFER_SIZE + 1U;
+        string.buffer = string.small_buffer;
+
+        test_choco_string_config_reset();
+
+        ret = is_string_valid(&string);
+        assert(false == ret);
+
+        string.capacity = CHOCO_STRING_SMALL_BUFFER_SIZE;
+        ret = is_string_valid(&string);
+        assert(true == ret);
+
         test_choco_string_config_reset();
     }
 }
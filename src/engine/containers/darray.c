@@ -0,0 +1,1298 @@
+/** @ingroup containers
+ *
+ * @file darray.c
+ * @author chocolate-pie24
+ * @brief 要素を連続したメモリ領域に格納する、容量可変のジェネリック型動的配列モジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset, memcpy
+
+#include "engine/containers/darray.h"
+
+#include "engine/core/memory/choco_memory.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include "engine/containers/test_darray.h"
+#include "engine/core/memory/test_choco_memory.h"
+
+// darrayモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_darray_create;    /**< darray_create()テスト設定 */
+static test_call_control_t s_test_config_darray_push;      /**< darray_push()テスト設定 */
+static test_call_control_t s_test_config_darray_append;    /**< darray_append()テスト設定 */
+
+// プライベート関数テスト設定
+static test_call_control_bool_t s_test_config_is_darray_corrupted;  /**< is_darray_corrupted()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_darray_create(void);
+static void test_darray_destroy(void);
+static void test_darray_reserve(void);
+static void test_darray_push(void);
+static void test_darray_append(void);
+static void test_darray_swap_remove(void);
+static void test_darray_clear(void);
+static void test_darray_at(void);
+static void test_darray_stress(void);
+static void test_grow_capacity(void);
+static void test_rslt_convert_mem_sys(void);
+static void test_is_darray_corrupted(void);
+static void test_rslt_to_str(void);
+#endif
+
+#define DARRAY_MIN_CAPACITY 8U  /**< 要素バッファ未確保の状態から拡張する際の最小容量(要素数) */
+
+/**
+ * @brief darray_t内部データ構造
+ *
+ */
+struct darray {
+    size_t element_size;    /**< 要素のサイズ */
+    size_t element_align;   /**< 要素のアライメント要件 */
+    size_t stride;          /**< 要素1つに必要なメモリ領域(element_sizeをelement_alignの倍数に切り上げた値) */
+    size_t count;           /**< 格納中の要素数 */
+    size_t capacity;        /**< 再確保なしで格納可能な要素数 */
+    memory_tag_t mem_tag;   /**< 配列本体と要素バッファのメモリタグ */
+    void* data;             /**< 要素バッファ(stride * capacity、capacity == 0の場合はNULL) */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< 動的配列API実行結果コード(処理成功)に対応する文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< 動的配列API実行結果コード(無効な引数)に対応する文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< 動的配列API実行結果コード(メモリ不足)に対応する文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< 動的配列API実行結果コード(実行時エラー)に対応する文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< 動的配列API実行結果コード(未定義エラー)に対応する文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< 動的配列API実行結果コード(システム使用可能範囲上限超過)に対応する文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< 動的配列API実行結果コード(API誤用)に対応する文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< 動的配列API実行結果コード(内部データ破損)に対応する文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< 動的配列API実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
+
+static darray_result_t buffer_reallocate(size_t capacity_, const char* func_name_, darray_t* darray_);
+static darray_result_t buffer_grow(size_t required_count_, const char* func_name_, darray_t* darray_);
+static size_t grow_capacity(size_t current_, size_t required_, size_t max_capacity_);
+static void* element_at(const darray_t* darray_, size_t index_);
+static bool is_darray_corrupted(const darray_t* darray_);
+static const char* rslt_to_str(darray_result_t rslt_);
+static darray_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+
+darray_result_t darray_create(size_t initial_capacity_, size_t element_size_, size_t element_align_, memory_tag_t mem_tag_, darray_t** darray_) {
+#ifdef TEST_BUILD
+    s_test_config_darray_create.call_count++;
+    if(s_test_config_darray_create.fail_on_call != 0) {
+        if(s_test_config_darray_create.call_count == s_test_config_darray_create.fail_on_call) {
+            return (darray_result_t)s_test_config_darray_create.forced_result;
+        }
+    }
+#endif
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    darray_t* tmp_darray = NULL;
+    size_t stride = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_create", "darray_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_create", "*darray_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != element_size_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_create", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(element_align_), ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(alignof(max_align_t) >= element_align_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(MEMORY_TAG_MAX > mem_tag_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_create", "mem_tag_")
+    if(element_size_ > SIZE_MAX - (element_align_ - 1)) {
+        ret = DARRAY_OVERFLOW;
+        ERROR_MESSAGE("darray_create(%s) - Element stride is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    stride = (element_size_ + (element_align_ - 1)) & ~(element_align_ - 1);
+    if(initial_capacity_ > SIZE_MAX / stride) {
+        ret = DARRAY_OVERFLOW;
+        ERROR_MESSAGE("darray_create(%s) - Initial capacity is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // Simulation.
+    ret_mem = memory_system_allocate(sizeof(*tmp_darray), mem_tag_, (void**)&tmp_darray);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("darray_create(%s) - Failed to allocate darray memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_darray, 0, sizeof(*tmp_darray));
+    tmp_darray->element_size = element_size_;
+    tmp_darray->element_align = element_align_;
+    tmp_darray->stride = stride;
+    tmp_darray->mem_tag = mem_tag_;
+
+    if(0 != initial_capacity_) {
+        ret = buffer_reallocate(initial_capacity_, "darray_create", tmp_darray);
+        if(DARRAY_SUCCESS != ret) {
+            goto cleanup;
+        }
+    }
+
+    // commit.
+    *darray_ = tmp_darray;
+
+    ret = DARRAY_SUCCESS;
+
+cleanup:
+    if(DARRAY_SUCCESS != ret) {
+        if(NULL != tmp_darray) {
+            // buffer_reallocateは失敗時に要素バッファを確保しないため、解放対象は本体のみ
+            memory_system_free(tmp_darray, sizeof(*tmp_darray), mem_tag_);
+            tmp_darray = NULL;
+        }
+    }
+    return ret;
+}
+
+void darray_destroy(darray_t** darray_) {
+    memory_tag_t mem_tag = MEMORY_TAG_CONTAINER;
+
+    if(NULL == darray_) {
+        goto cleanup;
+    }
+    if(NULL == *darray_) {
+        goto cleanup;
+    }
+    mem_tag = (*darray_)->mem_tag;
+    if(!is_darray_corrupted(*darray_)) { // 内部データが破損していた場合にfreeするのは危険
+        if(NULL != (*darray_)->data) {
+            memory_system_free((*darray_)->data, (*darray_)->stride * (*darray_)->capacity, mem_tag);
+        }
+    } else {
+        WARN_MESSAGE("darray_destroy - Provided darray_ is corrupted.");
+        if(MEMORY_TAG_MAX <= mem_tag) {
+            mem_tag = MEMORY_TAG_CONTAINER;
+        }
+    }
+
+    memory_system_free(*darray_, sizeof(darray_t), mem_tag);
+    *darray_ = NULL;
+cleanup:
+    return;
+}
+
+darray_result_t darray_reserve(size_t capacity_, darray_t* darray_) {
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_reserve", "darray_")
+    if(is_darray_corrupted(darray_)) {
+        ret = DARRAY_DATA_CORRUPTED;
+        ERROR_MESSAGE("darray_reserve(%s) - Provided darray is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(capacity_ <= darray_->capacity) {
+        ret = DARRAY_SUCCESS;
+        goto cleanup;
+    }
+    if(capacity_ > SIZE_MAX / darray_->stride) {
+        ret = DARRAY_OVERFLOW;
+        ERROR_MESSAGE("darray_reserve(%s) - Requested capacity is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = buffer_reallocate(capacity_, "darray_reserve", darray_);
+
+cleanup:
+    return ret;
+}
+
+darray_result_t darray_push(const void* element_, darray_t* darray_) {
+#ifdef TEST_BUILD
+    s_test_config_darray_push.call_count++;
+    if(s_test_config_darray_push.fail_on_call != 0) {
+        if(s_test_config_darray_push.call_count == s_test_config_darray_push.fail_on_call) {
+            return (darray_result_t)s_test_config_darray_push.forced_result;
+        }
+    }
+#endif
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(element_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_push", "element_")
+    IF_ARG_NULL_GOTO_CLEANUP(darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_push", "darray_")
+
+    // 1要素の追加はdarray_appendと同一処理(element_が配列内を指す場合の再確保対策も共通化する)
+    ret = darray_append(element_, 1, darray_);
+
+cleanup:
+    return ret;
+}
+
+darray_result_t darray_append(const void* elements_, size_t count_, darray_t* darray_) {
+#ifdef TEST_BUILD
+    s_test_config_darray_append.call_count++;
+    if(s_test_config_darray_append.fail_on_call != 0) {
+        if(s_test_config_darray_append.call_count == s_test_config_darray_append.fail_on_call) {
+            return (darray_result_t)s_test_config_darray_append.forced_result;
+        }
+    }
+#endif
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+    const void* src = elements_;
+    bool is_self_source = false;
+    size_t src_offset = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(elements_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_append", "elements_")
+    IF_ARG_NULL_GOTO_CLEANUP(darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_append", "darray_")
+    if(is_darray_corrupted(darray_)) {
+        ret = DARRAY_DATA_CORRUPTED;
+        ERROR_MESSAGE("darray_append(%s) - Provided darray is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(0 == count_) {
+        ret = DARRAY_SUCCESS;
+        goto cleanup;
+    }
+    if(count_ > SIZE_MAX - darray_->count) {
+        ret = DARRAY_OVERFLOW;
+        ERROR_MESSAGE("darray_append(%s) - Element count overflow.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // Simulation.
+    // 追加元が要素バッファ内を指す場合は、再確保で先頭アドレスが変わっても追えるようにオフセットで保持する
+    if(NULL != darray_->data) {
+        const uintptr_t begin = (uintptr_t)darray_->data;
+        const uintptr_t end = begin + (uintptr_t)(darray_->stride * darray_->count);
+        const uintptr_t addr = (uintptr_t)elements_;
+        if(addr >= begin && addr < end) {
+            is_self_source = true;
+            src_offset = (size_t)(addr - begin);
+        }
+    }
+    ret = buffer_grow(darray_->count + count_, "darray_append", darray_);
+    if(DARRAY_SUCCESS != ret) {
+        goto cleanup;
+    }
+    if(is_self_source) {
+        src = (const char*)darray_->data + src_offset;
+    }
+
+    // commit.
+    // 要素間のパディングも含めてstride単位でコピーする(追加元は同一型の配列であることが前提)
+    memcpy(element_at(darray_, darray_->count), src, (darray_->stride * (count_ - 1)) + darray_->element_size);
+    darray_->count += count_;
+
+    ret = DARRAY_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+darray_result_t darray_swap_remove(size_t index_, darray_t* darray_) {
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+    size_t last = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_swap_remove", "darray_")
+    if(is_darray_corrupted(darray_)) {
+        ret = DARRAY_DATA_CORRUPTED;
+        ERROR_MESSAGE("darray_swap_remove(%s) - Provided darray is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP(index_ < darray_->count, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_swap_remove", "index_")
+
+    // commit.
+    last = darray_->count - 1;
+    if(index_ != last) {
+        memcpy(element_at(darray_, index_), element_at(darray_, last), darray_->element_size);
+    }
+    darray_->count = last;
+
+    ret = DARRAY_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void darray_clear(darray_t* darray_) {
+    if(NULL == darray_) {
+        return;
+    }
+    darray_->count = 0;
+}
+
+darray_result_t darray_at(size_t index_, const darray_t* darray_, void** out_element_) {
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(darray_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_at", "darray_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_element_, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_at", "out_element_")
+    if(is_darray_corrupted(darray_)) {
+        ret = DARRAY_DATA_CORRUPTED;
+        ERROR_MESSAGE("darray_at(%s) - Provided darray is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP(index_ < darray_->count, ret, DARRAY_INVALID_ARGUMENT, rslt_to_str(DARRAY_INVALID_ARGUMENT), "darray_at", "index_")
+
+    *out_element_ = element_at(darray_, index_);
+
+    ret = DARRAY_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void* darray_data(const darray_t* darray_) {
+    return (NULL == darray_) ? NULL : darray_->data;
+}
+
+size_t darray_count(const darray_t* darray_) {
+    return (NULL == darray_) ? 0 : darray_->count;
+}
+
+size_t darray_capacity(const darray_t* darray_) {
+    return (NULL == darray_) ? 0 : darray_->capacity;
+}
+
+/**
+ * @brief darray_の要素バッファを容量capacity_に再割り当てする
+ *
+ * @note
+ * - 要素バッファ未確保の場合は新規に確保する
+ * - 処理に失敗した場合、darray_の状態は不変
+ * - 本関数を呼び出す前に、darray_->count <= capacity_ かつ stride * capacity_がオーバーフローしないことを保証すること
+ *
+ * @param[in] capacity_ 変更後の容量(要素数、0より大きいこと)
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元関数名
+ * @param[in,out] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @retval DARRAY_NO_MEMORY メモリ確保失敗
+ * @retval DARRAY_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval DARRAY_BAD_OPERATION メモリシステム未初期化、または定常状態割り当てガードにより拒否
+ * @retval DARRAY_SUCCESS 再割り当てに成功し、正常終了
+ */
+static darray_result_t buffer_reallocate(size_t capacity_, const char* func_name_, darray_t* darray_) {
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    void* tmp_data = NULL;
+
+    ret_mem = memory_system_reallocate(darray_->data, darray_->stride * darray_->capacity, darray_->stride * capacity_, darray_->mem_tag, &tmp_data);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("%s(%s) - Failed to reallocate element buffer.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    darray_->data = tmp_data;
+    darray_->capacity = capacity_;
+
+    ret = DARRAY_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief darray_の容量がrequired_count_以上となるように要素バッファを拡張する
+ *
+ * @note
+ * - 容量が足りている場合は何もしない
+ * - 拡張後の容量はgrow_capacityで算出する(容量を倍々で拡張し、要素追加を償却O(1)とする)
+ * - 処理に失敗した場合、darray_の状態は不変
+ *
+ * @param[in] required_count_ 必要な容量(要素数)
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元関数名
+ * @param[in,out] darray_ 対象動的配列構造体インスタンスへのポインタ
+ *
+ * @retval DARRAY_OVERFLOW stride * required_count_がsize_tの最大値を超過
+ * @retval DARRAY_NO_MEMORY メモリ確保失敗
+ * @retval DARRAY_LIMIT_EXCEEDED メモリ管理システムの管理変数が使用可能範囲を超過
+ * @retval DARRAY_BAD_OPERATION メモリシステム未初期化、または定常状態割り当てガードにより拒否
+ * @retval DARRAY_SUCCESS 拡張に成功(または拡張不要)し、正常終了
+ */
+static darray_result_t buffer_grow(size_t required_count_, const char* func_name_, darray_t* darray_) {
+    darray_result_t ret = DARRAY_INVALID_ARGUMENT;
+    const size_t max_capacity = SIZE_MAX / darray_->stride;
+
+    if(required_count_ <= darray_->capacity) {
+        ret = DARRAY_SUCCESS;
+        goto cleanup;
+    }
+    if(required_count_ > max_capacity) {
+        ret = DARRAY_OVERFLOW;
+        ERROR_MESSAGE("%s(%s) - Element buffer size overflow.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = buffer_reallocate(grow_capacity(darray_->capacity, required_count_, max_capacity), func_name_, darray_);
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief 現在の容量current_から、required_以上となる拡張後の容量を算出する
+ *
+ * @note
+ * - current_ == 0の場合はDARRAY_MIN_CAPACITYから倍々で拡張する
+ * - current_の2倍がrequired_に満たない場合はrequired_を返す
+ * - 算出した容量がmax_capacity_を超える場合はmax_capacity_を返す
+ * - 本関数を呼び出す前に、required_ <= max_capacity_であることを保証すること
+ *
+ * @param[in] current_ 現在の容量
+ * @param[in] required_ 必要な容量
+ * @param[in] max_capacity_ 要素バッファのサイズがオーバーフローしない最大容量
+ *
+ * @return size_t 拡張後の容量
+ */
+static size_t grow_capacity(size_t current_, size_t required_, size_t max_capacity_) {
+    size_t new_capacity = 0;
+
+    if(0 == current_) {
+        new_capacity = DARRAY_MIN_CAPACITY;
+    } else if((max_capacity_ / 2) < current_) {
+        new_capacity = max_capacity_;
+    } else {
+        new_capacity = current_ * 2;
+    }
+    if(new_capacity > max_capacity_) {
+        new_capacity = max_capacity_;
+    }
+    return (new_capacity < required_) ? required_ : new_capacity;
+}
+
+/**
+ * @brief darray_のindex_番目の要素のアドレスを取得する
+ *
+ * @note 本関数を呼び出す前にdarray_->data != NULLであることを保証すること(index_ == countの追加位置も指定可)
+ *
+ * @param[in] darray_ 対象動的配列構造体インスタンスへのポインタ
+ * @param[in] index_ 要素のインデックス
+ *
+ * @return void* 要素のアドレス
+ */
+static void* element_at(const darray_t* darray_, size_t index_) {
+    return (char*)darray_->data + (darray_->stride * index_);
+}
+
+/**
+ * @brief 動的配列内部データが破損しているかを判定する
+ *
+ * @note 本関数を呼び出す前に必ず引数が非NULLであることを保証すること
+ *
+ * @param[in] darray_ 判定対象動的配列構造体インスタンスへのポインタ
+ *
+ * @retval true 以下のいずれか
+ * - 0 == darray_->element_size
+ * - darray_->element_alignが2のべき乗ではない、またはmax_align_tを超過
+ * - ストライドが要素サイズ未満、またはアライメント要件の倍数ではない
+ * - darray_->count > darray_->capacity
+ * - 要素バッファのサイズ(stride * capacity)がオーバーフローする
+ * - darray_->capacity != 0 && darray_->data == NULL、またはdarray_->capacity == 0 && darray_->data != NULL
+ * - darray_->mem_tag >= MEMORY_TAG_MAX
+ * @retval false 内部データ破損なし
+ */
+static bool is_darray_corrupted(const darray_t* darray_) {
+#ifdef TEST_BUILD
+    s_test_config_is_darray_corrupted.call_count++;
+    if(s_test_config_is_darray_corrupted.fail_on_call != 0) {
+        if(s_test_config_is_darray_corrupted.call_count == s_test_config_is_darray_corrupted.fail_on_call) {
+            return s_test_config_is_darray_corrupted.forced_result;
+        }
+    }
+#endif
+    if(0 == darray_->element_size) {
+        return true;
+    }
+    if(alignof(max_align_t) < darray_->element_align || !IS_POWER_OF_TWO(darray_->element_align)) {
+        return true;
+    }
+    if(darray_->stride < darray_->element_size || 0 != (darray_->stride % darray_->element_align)) {
+        return true;
+    }
+    if(darray_->count > darray_->capacity || darray_->capacity > SIZE_MAX / darray_->stride) {
+        return true;
+    }
+    if((0 == darray_->capacity) != (NULL == darray_->data)) {
+        return true;
+    }
+    if(MEMORY_TAG_MAX <= darray_->mem_tag) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief メモリシステム実行結果コードを動的配列実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return darray_result_t 変換された動的配列実行結果コード
+ */
+static darray_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return DARRAY_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return DARRAY_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return DARRAY_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return DARRAY_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return DARRAY_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return DARRAY_BAD_OPERATION;
+    default:
+        return DARRAY_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief 動的配列実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 動的配列実行結果コード
+ * @return const char* 変換された文字列
+ */
+static const char* rslt_to_str(darray_result_t rslt_) {
+    switch(rslt_) {
+    case DARRAY_SUCCESS:
+        return s_rslt_str_success;
+    case DARRAY_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case DARRAY_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case DARRAY_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case DARRAY_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case DARRAY_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case DARRAY_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case DARRAY_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case DARRAY_OVERFLOW:
+        return s_rslt_str_overflow;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_darray_create_config_set(const test_call_control_t* config_) {
+    s_test_config_darray_create.fail_on_call = config_->fail_on_call;
+    s_test_config_darray_create.forced_result = config_->forced_result;
+}
+
+void test_darray_push_config_set(const test_call_control_t* config_) {
+    s_test_config_darray_push.fail_on_call = config_->fail_on_call;
+    s_test_config_darray_push.forced_result = config_->forced_result;
+}
+
+void test_darray_append_config_set(const test_call_control_t* config_) {
+    s_test_config_darray_append.fail_on_call = config_->fail_on_call;
+    s_test_config_darray_append.forced_result = config_->forced_result;
+}
+
+void test_darray_config_reset(void) {
+    test_call_control_reset(&s_test_config_darray_create);
+    test_call_control_reset(&s_test_config_darray_push);
+    test_call_control_reset(&s_test_config_darray_append);
+
+    test_call_control_bool_reset(&s_test_config_is_darray_corrupted);
+}
+
+void test_darray(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_darray_create();
+    test_darray_destroy();
+    test_darray_reserve();
+    test_darray_push();
+    test_darray_append();
+    test_darray_swap_remove();
+    test_darray_clear();
+    test_darray_at();
+    test_darray_stress();
+    test_grow_capacity();
+    test_rslt_convert_mem_sys();
+    test_is_darray_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+/**
+ * @brief テスト用の要素型(パディングを含む)
+ *
+ */
+typedef struct test_element {
+    double value;   /**< 値 */
+    int16_t tag;    /**< 識別子 */
+} test_element_t;
+
+static void NO_COVERAGE test_darray_create(void) {
+    test_darray_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // darray_create() 冒頭で強制的に DARRAY_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        darray_t* darray = NULL;
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)DARRAY_NO_MEMORY;
+        test_darray_create_config_set(&config);
+
+        assert(DARRAY_NO_MEMORY == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(NULL == darray);
+
+        test_darray_config_reset();
+    }
+    {
+        // 引数異常 -> DARRAY_INVALID_ARGUMENT
+        darray_t dummy = {0};
+        darray_t* darray = &dummy;
+
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, NULL));
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(&dummy == darray);
+
+        darray = NULL;
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, 0U, alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, sizeof(uint32_t), 0U, MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, sizeof(uint32_t), 3U, MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, sizeof(uint32_t), alignof(max_align_t) * 2U, MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_MAX, &darray));
+        assert(NULL == darray);
+    }
+    {
+        // ストライド/初期容量のオーバーフロー -> DARRAY_OVERFLOW
+        darray_t* darray = NULL;
+
+        assert(DARRAY_OVERFLOW == darray_create(4U, SIZE_MAX, 8U, MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_OVERFLOW == darray_create(SIZE_MAX / 4U + 1U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(NULL == darray);
+    }
+    {
+        // メモリ確保失敗(本体) -> DARRAY_NO_MEMORY
+        test_call_control_t config = {0};
+        darray_t* darray = NULL;
+
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_allocate_config_set(&config);
+
+        assert(DARRAY_NO_MEMORY == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(NULL == darray);
+        test_choco_memory_config_reset();
+    }
+    {
+        // メモリ確保失敗(要素バッファ) -> 本体を解放して DARRAY_NO_MEMORY
+        test_call_control_t config = {0};
+        darray_t* darray = NULL;
+        memory_tag_stats_t stats_before = {0};
+        memory_tag_stats_t stats_after = {0};
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_CONTAINER, &stats_before));
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_reallocate_config_set(&config);
+
+        assert(DARRAY_NO_MEMORY == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(NULL == darray);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_CONTAINER, &stats_after));
+        assert(stats_before.allocated == stats_after.allocated);
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系: 初期容量0では要素バッファを確保しない
+        darray_t* darray = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(NULL != darray);
+        assert(0U == darray->count);
+        assert(0U == darray->capacity);
+        assert(NULL == darray->data);
+        assert(sizeof(uint32_t) == darray->stride);
+        assert(MEMORY_TAG_CONTAINER == darray->mem_tag);
+        darray_destroy(&darray);
+        assert(NULL == darray);
+    }
+    {
+        // 正常系: 初期容量分の要素バッファを確保し、ストライドはアライメント要件の倍数
+        darray_t* darray = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(5U, sizeof(test_element_t), alignof(test_element_t), MEMORY_TAG_RENDERER, &darray));
+        assert(5U == darray->capacity);
+        assert(0U == darray->count);
+        assert(NULL != darray->data);
+        assert(sizeof(test_element_t) == darray->stride);
+        assert(MEMORY_TAG_RENDERER == darray->mem_tag);
+        darray_destroy(&darray);
+
+        assert(DARRAY_SUCCESS == darray_create(2U, 6U, 4U, MEMORY_TAG_CONTAINER, &darray));
+        assert(8U == darray->stride);
+        assert(6U == darray->element_size);
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_destroy(void) {
+    test_darray_config_reset();
+
+    {
+        // NULL -> no-op
+        darray_t* darray = NULL;
+
+        darray_destroy(NULL);
+        darray_destroy(&darray);
+        assert(NULL == darray);
+    }
+    {
+        // メモリタグごとの使用量が生成前に戻ること
+        darray_t* darray = NULL;
+        memory_tag_stats_t stats_before = {0};
+        memory_tag_stats_t stats_after = {0};
+        const uint32_t value = 7U;
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_RENDERER, &stats_before));
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_RENDERER, &darray));
+        for(int i = 0; i != 100; ++i) {
+            assert(DARRAY_SUCCESS == darray_push(&value, darray));
+        }
+        darray_destroy(&darray);
+        assert(NULL == darray);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_RENDERER, &stats_after));
+        assert(stats_before.allocated == stats_after.allocated);
+    }
+    {
+        // 内部データ破損 -> 要素バッファは解放せず、本体のみ解放する
+        darray_t* darray = NULL;
+        void* data = NULL;
+        size_t capacity = 0;
+
+        assert(DARRAY_SUCCESS == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        data = darray->data;
+        capacity = darray->capacity;
+        darray->count = darray->capacity + 1U;
+        darray_destroy(&darray);
+        assert(NULL == darray);
+        memory_system_free(data, sizeof(uint32_t) * capacity, MEMORY_TAG_CONTAINER);
+    }
+}
+
+static void NO_COVERAGE test_darray_reserve(void) {
+    test_darray_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // 引数異常 / 内部データ破損
+        darray_t* darray = NULL;
+
+        assert(DARRAY_INVALID_ARGUMENT == darray_reserve(4U, NULL));
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        darray->stride = 0U;
+        assert(DARRAY_DATA_CORRUPTED == darray_reserve(4U, darray));
+        darray->stride = sizeof(uint32_t);
+
+        assert(DARRAY_OVERFLOW == darray_reserve(SIZE_MAX / sizeof(uint32_t) + 1U, darray));
+        assert(0U == darray->capacity);
+        darray_destroy(&darray);
+    }
+    {
+        // 容量以下の指定 -> 何もしない / 容量超過の指定 -> 指定容量ちょうどに拡張
+        darray_t* darray = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_SUCCESS == darray_reserve(0U, darray));
+        assert(0U == darray->capacity);
+        assert(NULL == darray->data);
+
+        assert(DARRAY_SUCCESS == darray_reserve(10U, darray));
+        assert(10U == darray->capacity);
+        assert(NULL != darray->data);
+
+        assert(DARRAY_SUCCESS == darray_reserve(3U, darray));
+        assert(10U == darray->capacity);
+
+        assert(DARRAY_SUCCESS == darray_reserve(11U, darray));
+        assert(11U == darray->capacity);
+        darray_destroy(&darray);
+    }
+    {
+        // 要素を保持したまま拡張し、失敗時は状態が変化しない
+        darray_t* darray = NULL;
+        test_call_control_t config = {0};
+        uint32_t* value = NULL;
+        void* data = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(2U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        for(uint32_t i = 0; i != 2U; ++i) {
+            assert(DARRAY_SUCCESS == darray_push(&i, darray));
+        }
+        data = darray->data;
+
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_reallocate_config_set(&config);
+        assert(DARRAY_NO_MEMORY == darray_reserve(64U, darray));
+        assert(2U == darray->capacity);
+        assert(2U == darray->count);
+        assert(data == darray->data);
+        test_choco_memory_config_reset();
+
+        assert(DARRAY_SUCCESS == darray_reserve(64U, darray));
+        assert(64U == darray->capacity);
+        for(uint32_t i = 0; i != 2U; ++i) {
+            assert(DARRAY_SUCCESS == darray_at(i, darray, (void**)&value));
+            assert(i == *value);
+        }
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_push(void) {
+    test_darray_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // darray_push() 冒頭で強制的に DARRAY_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        darray_t* darray = NULL;
+        const uint32_t value = 1U;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        config.fail_on_call = 1U;
+        config.forced_result = (int)DARRAY_NO_MEMORY;
+        test_darray_push_config_set(&config);
+        assert(DARRAY_NO_MEMORY == darray_push(&value, darray));
+        assert(0U == darray->count);
+        test_darray_config_reset();
+        darray_destroy(&darray);
+    }
+    {
+        // 引数異常 / 内部データ破損
+        darray_t* darray = NULL;
+        const uint32_t value = 1U;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_push(NULL, darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_push(&value, NULL));
+
+        darray->element_align = 3U;
+        assert(DARRAY_DATA_CORRUPTED == darray_push(&value, darray));
+        darray->element_align = alignof(uint32_t);
+        darray_destroy(&darray);
+    }
+    {
+        // 容量0から最小容量 -> 以降は倍々で拡張される
+        darray_t* darray = NULL;
+        uint32_t* value = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        for(uint32_t i = 0; i != 33U; ++i) {
+            assert(DARRAY_SUCCESS == darray_push(&i, darray));
+            if(i < DARRAY_MIN_CAPACITY) {
+                assert(DARRAY_MIN_CAPACITY == darray->capacity);
+            } else if(i < 16U) {
+                assert(16U == darray->capacity);
+            } else if(i < 32U) {
+                assert(32U == darray->capacity);
+            } else {
+                assert(64U == darray->capacity);
+            }
+        }
+        assert(33U == darray_count(darray));
+        for(uint32_t i = 0; i != 33U; ++i) {
+            assert(DARRAY_SUCCESS == darray_at(i, darray, (void**)&value));
+            assert(i == *value);
+        }
+        darray_destroy(&darray);
+    }
+    {
+        // 配列内の要素を追加元にしても、再確保後に正しい値が追加される
+        darray_t* darray = NULL;
+        uint32_t* value = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(1U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        {
+            const uint32_t first = 0xCAFEU;
+            assert(DARRAY_SUCCESS == darray_push(&first, darray));
+        }
+        for(int i = 0; i != 20; ++i) {
+            assert(DARRAY_SUCCESS == darray_at(0U, darray, (void**)&value));
+            assert(DARRAY_SUCCESS == darray_push(value, darray));
+        }
+        for(size_t i = 0; i != darray_count(darray); ++i) {
+            assert(DARRAY_SUCCESS == darray_at(i, darray, (void**)&value));
+            assert(0xCAFEU == *value);
+        }
+        darray_destroy(&darray);
+    }
+    {
+        // メモリ確保失敗 -> 状態が変化しない
+        darray_t* darray = NULL;
+        test_call_control_t config = {0};
+        const uint32_t value = 1U;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_LIMIT_EXCEEDED;
+        test_memory_system_reallocate_config_set(&config);
+        assert(DARRAY_LIMIT_EXCEEDED == darray_push(&value, darray));
+        assert(0U == darray->count);
+        assert(0U == darray->capacity);
+        assert(NULL == darray->data);
+        test_choco_memory_config_reset();
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_append(void) {
+    test_darray_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // darray_append() 冒頭で強制的に DARRAY_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        darray_t* darray = NULL;
+        const uint32_t values[2] = { 1U, 2U };
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        config.fail_on_call = 1U;
+        config.forced_result = (int)DARRAY_NO_MEMORY;
+        test_darray_append_config_set(&config);
+        assert(DARRAY_NO_MEMORY == darray_append(values, 2U, darray));
+        assert(0U == darray->count);
+        test_darray_config_reset();
+        darray_destroy(&darray);
+    }
+    {
+        // 引数異常 / 内部データ破損 / 要素数オーバーフロー
+        darray_t* darray = NULL;
+        const uint32_t values[2] = { 1U, 2U };
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_append(NULL, 2U, darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_append(values, 2U, NULL));
+
+        darray->capacity = 4U;
+        assert(DARRAY_DATA_CORRUPTED == darray_append(values, 2U, darray));
+        darray->capacity = 0U;
+
+        assert(DARRAY_SUCCESS == darray_append(values, 2U, darray));
+        assert(DARRAY_OVERFLOW == darray_append(values, SIZE_MAX, darray));
+        assert(DARRAY_OVERFLOW == darray_append(values, SIZE_MAX / sizeof(uint32_t), darray));
+        assert(2U == darray->count);
+        darray_destroy(&darray);
+    }
+    {
+        // count_ == 0 -> 何もしない
+        darray_t* darray = NULL;
+        const uint32_t values[2] = { 1U, 2U };
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_SUCCESS == darray_append(values, 0U, darray));
+        assert(0U == darray->count);
+        assert(NULL == darray->data);
+        darray_destroy(&darray);
+    }
+    {
+        // まとめて追加 -> 容量は倍々、または要求数ちょうどに拡張される
+        darray_t* darray = NULL;
+        test_element_t elements[20];
+        test_element_t* element = NULL;
+
+        for(int16_t i = 0; i != 20; ++i) {
+            elements[i].value = (double)i * 0.5;
+            elements[i].tag = i;
+        }
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(test_element_t), alignof(test_element_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_SUCCESS == darray_append(elements, 6U, darray));
+        assert(6U == darray->count);
+        assert(DARRAY_MIN_CAPACITY == darray->capacity);
+        assert(DARRAY_SUCCESS == darray_append(&elements[6], 14U, darray));
+        assert(20U == darray->count);
+        assert(20U == darray->capacity);
+        for(size_t i = 0; i != 20U; ++i) {
+            assert(DARRAY_SUCCESS == darray_at(i, darray, (void**)&element));
+            assert(elements[i].tag == element->tag);
+            assert(elements[i].value == element->value);
+        }
+        assert(0 == memcmp(&((test_element_t*)darray_data(darray))[0], &elements[0], sizeof(test_element_t)));
+        darray_destroy(&darray);
+    }
+    {
+        // 配列自身の要素を追加元にしても、再確保後に正しい値が追加される
+        darray_t* darray = NULL;
+        uint32_t* value = NULL;
+        const uint32_t values[4] = { 10U, 11U, 12U, 13U };
+
+        assert(DARRAY_SUCCESS == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_SUCCESS == darray_append(values, 4U, darray));
+        assert(4U == darray->capacity);
+        assert(DARRAY_SUCCESS == darray_append(darray_data(darray), 4U, darray));
+        assert(8U == darray->count);
+        for(size_t i = 0; i != 8U; ++i) {
+            assert(DARRAY_SUCCESS == darray_at(i, darray, (void**)&value));
+            assert(values[i % 4U] == *value);
+        }
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_swap_remove(void) {
+    test_darray_config_reset();
+
+    {
+        // 引数異常 / 内部データ破損
+        darray_t* darray = NULL;
+        const uint32_t value = 1U;
+
+        assert(DARRAY_INVALID_ARGUMENT == darray_swap_remove(0U, NULL));
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_swap_remove(0U, darray));
+        assert(DARRAY_SUCCESS == darray_push(&value, darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_swap_remove(1U, darray));
+
+        darray->element_size = 0U;
+        assert(DARRAY_DATA_CORRUPTED == darray_swap_remove(0U, darray));
+        darray->element_size = sizeof(uint32_t);
+        darray_destroy(&darray);
+    }
+    {
+        // 削除位置に末尾の要素が移動し、末尾の削除は要素数のみを減らす
+        darray_t* darray = NULL;
+        const uint32_t values[5] = { 0U, 1U, 2U, 3U, 4U };
+        const uint32_t* data = NULL;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_SUCCESS == darray_append(values, 5U, darray));
+
+        assert(DARRAY_SUCCESS == darray_swap_remove(1U, darray));
+        data = (const uint32_t*)darray_data(darray);
+        assert(4U == darray_count(darray));
+        assert(0U == data[0] && 4U == data[1] && 2U == data[2] && 3U == data[3]);
+
+        assert(DARRAY_SUCCESS == darray_swap_remove(3U, darray));
+        assert(3U == darray_count(darray));
+        assert(0U == data[0] && 4U == data[1] && 2U == data[2]);
+
+        assert(DARRAY_SUCCESS == darray_swap_remove(0U, darray));
+        assert(DARRAY_SUCCESS == darray_swap_remove(0U, darray));
+        assert(DARRAY_SUCCESS == darray_swap_remove(0U, darray));
+        assert(0U == darray_count(darray));
+        assert(DARRAY_MIN_CAPACITY == darray_capacity(darray));
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_clear(void) {
+    test_darray_config_reset();
+
+    {
+        darray_t* darray = NULL;
+        const uint32_t values[3] = { 1U, 2U, 3U };
+        void* data = NULL;
+
+        darray_clear(NULL);
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(DARRAY_SUCCESS == darray_append(values, 3U, darray));
+        data = darray->data;
+        darray_clear(darray);
+        assert(0U == darray_count(darray));
+        assert(DARRAY_MIN_CAPACITY == darray_capacity(darray));
+        assert(data == darray_data(darray));
+
+        // 容量内での再構築では再確保が発生しない
+        assert(DARRAY_SUCCESS == darray_append(values, 3U, darray));
+        assert(data == darray_data(darray));
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_at(void) {
+    test_darray_config_reset();
+
+    {
+        darray_t* darray = NULL;
+        const uint32_t value = 5U;
+        uint32_t* out = NULL;
+
+        assert(NULL == darray_data(NULL));
+        assert(0U == darray_count(NULL));
+        assert(0U == darray_capacity(NULL));
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        assert(NULL == darray_data(darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_at(0U, darray, (void**)&out));
+        assert(DARRAY_SUCCESS == darray_push(&value, darray));
+        assert(DARRAY_INVALID_ARGUMENT == darray_at(0U, NULL, (void**)&out));
+        assert(DARRAY_INVALID_ARGUMENT == darray_at(0U, darray, NULL));
+        assert(DARRAY_INVALID_ARGUMENT == darray_at(1U, darray, (void**)&out));
+        assert(NULL == out);
+
+        darray->mem_tag = MEMORY_TAG_MAX;
+        assert(DARRAY_DATA_CORRUPTED == darray_at(0U, darray, (void**)&out));
+        darray->mem_tag = MEMORY_TAG_CONTAINER;
+
+        // 取得したポインタで要素を書き換えられる
+        assert(DARRAY_SUCCESS == darray_at(0U, darray, (void**)&out));
+        assert(5U == *out);
+        *out = 9U;
+        assert(9U == ((const uint32_t*)darray_data(darray))[0]);
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_darray_stress(void) {
+    test_darray_config_reset();
+
+    {
+        // 追加/まとめて追加/削除を繰り返し、参照用の配列と内容が一致し続けること
+        enum { MAX_COUNT = 4096 };
+        static uint32_t reference[MAX_COUNT];
+        darray_t* darray = NULL;
+        size_t count = 0;
+        uint32_t rng = 12345U;
+
+        assert(DARRAY_SUCCESS == darray_create(0U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        for(int step = 0; step != 20000; ++step) {
+            const uint32_t op = (rng >> 16U) % 4U;
+            rng = rng * 1103515245U + 12345U;
+            if(0U == op && count < MAX_COUNT) {
+                const uint32_t value = rng;
+                assert(DARRAY_SUCCESS == darray_push(&value, darray));
+                reference[count++] = value;
+            } else if(1U == op && count + 8U <= MAX_COUNT) {
+                uint32_t values[8];
+                for(size_t i = 0; i != 8U; ++i) {
+                    values[i] = rng + (uint32_t)i;
+                }
+                assert(DARRAY_SUCCESS == darray_append(values, 8U, darray));
+                memcpy(&reference[count], values, sizeof(values));
+                count += 8U;
+            } else if(0 != count) {
+                const size_t index = (size_t)(rng >> 8U) % count;
+                assert(DARRAY_SUCCESS == darray_swap_remove(index, darray));
+                reference[index] = reference[count - 1U];
+                count--;
+            }
+            assert(count == darray_count(darray));
+            assert(darray_count(darray) <= darray_capacity(darray));
+        }
+        assert(0 == memcmp(reference, darray_data(darray), sizeof(uint32_t) * count));
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_grow_capacity(void) {
+    assert(DARRAY_MIN_CAPACITY == grow_capacity(0U, 1U, SIZE_MAX));
+    assert(20U == grow_capacity(0U, 20U, SIZE_MAX));
+    assert(16U == grow_capacity(8U, 9U, SIZE_MAX));
+    assert(40U == grow_capacity(8U, 40U, SIZE_MAX));
+    assert(4U == grow_capacity(0U, 3U, 4U));
+    assert(100U == grow_capacity(60U, 61U, 100U));
+    assert(SIZE_MAX == grow_capacity(SIZE_MAX / 2U + 1U, SIZE_MAX / 2U + 2U, SIZE_MAX));
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(DARRAY_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(DARRAY_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(DARRAY_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(DARRAY_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(DARRAY_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(DARRAY_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(DARRAY_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)100));
+}
+
+static void NO_COVERAGE test_is_darray_corrupted(void) {
+    test_darray_config_reset();
+
+    {
+        darray_t* darray = NULL;
+        darray_t backup = {0};
+
+        assert(DARRAY_SUCCESS == darray_create(4U, sizeof(uint32_t), alignof(uint32_t), MEMORY_TAG_CONTAINER, &darray));
+        backup = *darray;
+        assert(!is_darray_corrupted(darray));
+
+        darray->element_size = 0;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->element_align = 3;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->element_align = alignof(max_align_t) * 2U;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->stride = 2;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->stride = 6;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->count = darray->capacity + 1U;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->capacity = SIZE_MAX;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->data = NULL;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->capacity = 0;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        darray->mem_tag = MEMORY_TAG_MAX;
+        assert(is_darray_corrupted(darray));
+        *darray = backup;
+
+        assert(!is_darray_corrupted(darray));
+        darray_destroy(&darray);
+    }
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(s_rslt_str_success == rslt_to_str(DARRAY_SUCCESS));
+    assert(s_rslt_str_invalid_argument == rslt_to_str(DARRAY_INVALID_ARGUMENT));
+    assert(s_rslt_str_no_memory == rslt_to_str(DARRAY_NO_MEMORY));
+    assert(s_rslt_str_runtime_error == rslt_to_str(DARRAY_RUNTIME_ERROR));
+    assert(s_rslt_str_undefined_error == rslt_to_str(DARRAY_UNDEFINED_ERROR));
+    assert(s_rslt_str_limit_exceeded == rslt_to_str(DARRAY_LIMIT_EXCEEDED));
+    assert(s_rslt_str_bad_operation == rslt_to_str(DARRAY_BAD_OPERATION));
+    assert(s_rslt_str_data_corrupted == rslt_to_str(DARRAY_DATA_CORRUPTED));
+    assert(s_rslt_str_overflow == rslt_to_str(DARRAY_OVERFLOW));
+    assert(s_rslt_str_undefined_error == rslt_to_str((darray_result_t)100));
+}
+#endif
@@ -0,0 +1,1120 @@
+/** @ingroup containers
+ *
+ * @file handle_pool.c
+ * @author chocolate-pie24
+ * @brief 世代付きハンドルで要素を参照するジェネリック型のハンドルプールモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset, memcpy
+
+#include "engine/containers/handle_pool.h"
+
+#include "engine/core/memory/choco_memory.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include "engine/containers/test_handle_pool.h"
+#include "engine/core/memory/test_choco_memory.h"
+
+// handle_poolモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_handle_pool_create;    /**< handle_pool_create()テスト設定 */
+static test_call_control_t s_test_config_handle_pool_register;  /**< handle_pool_register()テスト設定 */
+
+// プライベート関数テスト設定
+static test_call_control_bool_t s_test_config_is_handle_pool_corrupted; /**< is_handle_pool_corrupted()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_handle_pool_create(void);
+static void test_handle_pool_destroy(void);
+static void test_handle_pool_register(void);
+static void test_handle_pool_unregister(void);
+static void test_handle_pool_get(void);
+static void test_handle_pool_valid(void);
+static void test_handle_pool_at(void);
+static void test_rslt_convert_mem_sys(void);
+static void test_is_handle_pool_corrupted(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief 空きスロットリストの終端を表すインデックス
+ *
+ */
+#define HANDLE_POOL_NULL_INDEX UINT32_MAX
+
+/**
+ * @brief ハンドルのスロット
+ *
+ */
+typedef struct handle_pool_slot {
+    uint32_t dense_index;   /**< 登録中: 要素配列のインデックス / 空き: 次の空きスロットのインデックス(終端はHANDLE_POOL_NULL_INDEX) */
+    uint32_t generation;    /**< スロットの世代(登録解除のたびに進める、0は使用しない) */
+} handle_pool_slot_t;
+
+/**
+ * @brief handle_pool_t内部データ構造
+ *
+ */
+struct handle_pool {
+    size_t element_size;        /**< 格納要素のサイズ(パディングサイズを含まない実際の構造体のサイズ) */
+    size_t element_align;       /**< 格納要素のアライメント要件 */
+    size_t stride;              /**< 1要素に必要なメモリ領域(element_sizeをelement_alignの倍数に切り上げた値) */
+    size_t max_element_count;   /**< 格納可能な最大要素数 */
+    size_t count;               /**< 登録中の要素数 */
+    uint32_t free_head;         /**< 空きスロットリストの先頭インデックス(空きがない場合はHANDLE_POOL_NULL_INDEX) */
+    void* dense;                /**< 登録中の要素を詰めて格納する要素配列(stride * max_element_count) */
+    uint32_t* dense_to_slot;    /**< 要素配列のインデックスに対応するスロットインデックス */
+    handle_pool_slot_t* slots;  /**< スロット配列 */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< ハンドルプールAPI実行結果コード(処理成功)に対応する文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< ハンドルプールAPI実行結果コード(無効な引数)に対応する文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< ハンドルプールAPI実行結果コード(メモリ不足)に対応する文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< ハンドルプールAPI実行結果コード(実行時エラー)に対応する文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< ハンドルプールAPI実行結果コード(未定義エラー)に対応する文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< ハンドルプールAPI実行結果コード(システム使用可能範囲上限超過)に対応する文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< ハンドルプールAPI実行結果コード(API誤用)に対応する文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< ハンドルプールAPI実行結果コード(内部データ破損)に対応する文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< ハンドルプールAPI実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
+static const char* const s_rslt_str_stale_handle = "STALE_HANDLE";          /**< ハンドルプールAPI実行結果コード(登録解除済みのハンドル)に対応する文字列 */
+
+static bool is_handle_pool_corrupted(const handle_pool_t* handle_pool_);
+static handle_pool_result_t handle_resolve(handle_pool_handle_t handle_, const handle_pool_t* handle_pool_, const char* func_name_);
+static const char* rslt_to_str(handle_pool_result_t rslt_);
+static handle_pool_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+
+handle_pool_result_t handle_pool_create(size_t max_element_count_, size_t element_size_, size_t element_align_, handle_pool_t** handle_pool_) {
+#ifdef TEST_BUILD
+    s_test_config_handle_pool_create.call_count++;
+    if(s_test_config_handle_pool_create.fail_on_call != 0) {
+        if(s_test_config_handle_pool_create.call_count == s_test_config_handle_pool_create.fail_on_call) {
+            return (handle_pool_result_t)s_test_config_handle_pool_create.forced_result;
+        }
+    }
+#endif
+    handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    handle_pool_t* tmp_pool = NULL;
+    size_t stride = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(handle_pool_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "handle_pool_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*handle_pool_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "*handle_pool_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != max_element_count_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "max_element_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(max_element_count_ <= HANDLE_POOL_MAX_ELEMENT_COUNT, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "max_element_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != element_size_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(element_align_ > 0, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(element_align_), ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(element_align_ <= alignof(max_align_t), ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_create", "element_align_")
+
+    if((SIZE_MAX - (element_align_ - 1)) < element_size_) {
+        ret = HANDLE_POOL_OVERFLOW;
+        ERROR_MESSAGE("handle_pool_create(%s) - Computed stride is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    stride = (element_size_ + (element_align_ - 1)) & ~(element_align_ - 1);
+    if(SIZE_MAX / max_element_count_ < stride || SIZE_MAX / max_element_count_ < sizeof(handle_pool_slot_t)) {
+        ret = HANDLE_POOL_OVERFLOW;
+        ERROR_MESSAGE("handle_pool_create(%s) - Provided 'element_size_' and 'max_element_count_' are too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // Simulation.
+    ret_mem = memory_system_allocate(sizeof(*tmp_pool), MEMORY_TAG_CONTAINER, (void**)&tmp_pool);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("handle_pool_create(%s) - Failed to allocate handle pool memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_pool, 0, sizeof(*tmp_pool));
+    tmp_pool->max_element_count = max_element_count_;
+    tmp_pool->stride = stride;
+
+    ret_mem = memory_system_allocate(stride * max_element_count_, MEMORY_TAG_CONTAINER, &tmp_pool->dense);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("handle_pool_create(%s) - Failed to allocate element array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_mem = memory_system_allocate(sizeof(uint32_t) * max_element_count_, MEMORY_TAG_CONTAINER, (void**)&tmp_pool->dense_to_slot);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("handle_pool_create(%s) - Failed to allocate dense-to-slot table memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_mem = memory_system_allocate(sizeof(handle_pool_slot_t) * max_element_count_, MEMORY_TAG_CONTAINER, (void**)&tmp_pool->slots);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("handle_pool_create(%s) - Failed to allocate slot array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // 全スロットを空きスロットリストに繋ぐ(世代は1から開始し、0は無効なハンドルとする)
+    for(size_t i = 0; i != max_element_count_; ++i) {
+        tmp_pool->slots[i].dense_index = (i + 1 == max_element_count_) ? HANDLE_POOL_NULL_INDEX : (uint32_t)(i + 1);
+        tmp_pool->slots[i].generation = 1;
+    }
+    tmp_pool->free_head = 0;
+    tmp_pool->count = 0;
+    tmp_pool->element_size = element_size_;
+    tmp_pool->element_align = element_align_;
+
+    *handle_pool_ = tmp_pool;
+
+    ret = HANDLE_POOL_SUCCESS;
+
+cleanup:
+    if(HANDLE_POOL_SUCCESS != ret) {
+        if(NULL != tmp_pool) {
+            if(NULL != tmp_pool->slots) {
+                memory_system_free(tmp_pool->slots, sizeof(handle_pool_slot_t) * max_element_count_, MEMORY_TAG_CONTAINER);
+                tmp_pool->slots = NULL;
+            }
+            if(NULL != tmp_pool->dense_to_slot) {
+                memory_system_free(tmp_pool->dense_to_slot, sizeof(uint32_t) * max_element_count_, MEMORY_TAG_CONTAINER);
+                tmp_pool->dense_to_slot = NULL;
+            }
+            if(NULL != tmp_pool->dense) {
+                memory_system_free(tmp_pool->dense, stride * max_element_count_, MEMORY_TAG_CONTAINER);
+                tmp_pool->dense = NULL;
+            }
+            memory_system_free(tmp_pool, sizeof(*tmp_pool), MEMORY_TAG_CONTAINER);
+            tmp_pool = NULL;
+        }
+    }
+    return ret;
+}
+
+void handle_pool_destroy(handle_pool_t** handle_pool_) {
+    if(NULL == handle_pool_) {
+        goto cleanup;
+    }
+    if(NULL == *handle_pool_) {
+        goto cleanup;
+    }
+    if(!is_handle_pool_corrupted(*handle_pool_)) { // 内部データが破損していた場合にfreeするのは危険
+        memory_system_free((*handle_pool_)->slots, sizeof(handle_pool_slot_t) * (*handle_pool_)->max_element_count, MEMORY_TAG_CONTAINER);
+        memory_system_free((*handle_pool_)->dense_to_slot, sizeof(uint32_t) * (*handle_pool_)->max_element_count, MEMORY_TAG_CONTAINER);
+        memory_system_free((*handle_pool_)->dense, (*handle_pool_)->stride * (*handle_pool_)->max_element_count, MEMORY_TAG_CONTAINER);
+    } else {
+        WARN_MESSAGE("handle_pool_destroy - Provided handle_pool_ is corrupted.");
+    }
+
+    memory_system_free(*handle_pool_, sizeof(handle_pool_t), MEMORY_TAG_CONTAINER);
+    *handle_pool_ = NULL;
+cleanup:
+    return;
+}
+
+handle_pool_result_t handle_pool_register(const void* data_, handle_pool_t* handle_pool_, handle_pool_handle_t* out_handle_) {
+#ifdef TEST_BUILD
+    s_test_config_handle_pool_register.call_count++;
+    if(s_test_config_handle_pool_register.fail_on_call != 0) {
+        if(s_test_config_handle_pool_register.call_count == s_test_config_handle_pool_register.fail_on_call) {
+            return (handle_pool_result_t)s_test_config_handle_pool_register.forced_result;
+        }
+    }
+#endif
+    handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+    uint32_t slot_index = 0;
+    handle_pool_slot_t* slot = NULL;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_register", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(handle_pool_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_register", "handle_pool_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_handle_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_register", "out_handle_")
+    if(is_handle_pool_corrupted(handle_pool_)) {
+        ret = HANDLE_POOL_DATA_CORRUPTED;
+        ERROR_MESSAGE("handle_pool_register(%s) - Provided handle pool is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(HANDLE_POOL_NULL_INDEX == handle_pool_->free_head) {
+        ret = HANDLE_POOL_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("handle_pool_register(%s) - Handle pool is full.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    slot_index = handle_pool_->free_head;
+    if(slot_index >= handle_pool_->max_element_count) {
+        ret = HANDLE_POOL_DATA_CORRUPTED;
+        ERROR_MESSAGE("handle_pool_register(%s) - Free slot list is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    slot = &handle_pool_->slots[slot_index];
+    handle_pool_->free_head = slot->dense_index;
+    slot->dense_index = (uint32_t)handle_pool_->count;
+    handle_pool_->dense_to_slot[handle_pool_->count] = slot_index;
+    memcpy((char*)handle_pool_->dense + (handle_pool_->stride * handle_pool_->count), data_, handle_pool_->element_size);
+    handle_pool_->count++;
+
+    out_handle_->index = slot_index;
+    out_handle_->generation = slot->generation;
+
+    ret = HANDLE_POOL_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+handle_pool_result_t handle_pool_unregister(handle_pool_handle_t handle_, handle_pool_t* handle_pool_) {
+    handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+    handle_pool_slot_t* slot = NULL;
+    size_t dense_index = 0;
+    size_t last_index = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(handle_pool_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_unregister", "handle_pool_")
+    ret = handle_resolve(handle_, handle_pool_, "handle_pool_unregister");
+    if(HANDLE_POOL_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // 末尾の要素を空いた位置に移動して要素配列を詰める
+    slot = &handle_pool_->slots[handle_.index];
+    dense_index = slot->dense_index;
+    last_index = handle_pool_->count - 1;
+    if(dense_index != last_index) {
+        const uint32_t moved_slot = handle_pool_->dense_to_slot[last_index];
+        memcpy((char*)handle_pool_->dense + (handle_pool_->stride * dense_index), (char*)handle_pool_->dense + (handle_pool_->stride * last_index), handle_pool_->element_size);
+        handle_pool_->dense_to_slot[dense_index] = moved_slot;
+        handle_pool_->slots[moved_slot].dense_index = (uint32_t)dense_index;
+    }
+    memset((char*)handle_pool_->dense + (handle_pool_->stride * last_index), 0, handle_pool_->stride);
+    handle_pool_->count--;
+
+    // 世代を進めて既存のハンドルを無効化し、空きスロットリストの先頭に戻す(世代0は無効なハンドル用のため使用しない)
+    slot->generation++;
+    if(0 == slot->generation) {
+        slot->generation = 1;
+    }
+    slot->dense_index = handle_pool_->free_head;
+    handle_pool_->free_head = handle_.index;
+
+    ret = HANDLE_POOL_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+handle_pool_result_t handle_pool_get(handle_pool_handle_t handle_, const handle_pool_t* handle_pool_, void** out_element_) {
+    handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(handle_pool_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_get", "handle_pool_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_element_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_get", "out_element_")
+    ret = handle_resolve(handle_, handle_pool_, "handle_pool_get");
+    if(HANDLE_POOL_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // commit.
+    *out_element_ = (char*)handle_pool_->dense + (handle_pool_->stride * handle_pool_->slots[handle_.index].dense_index);
+
+    ret = HANDLE_POOL_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+bool handle_pool_valid(handle_pool_handle_t handle_, const handle_pool_t* handle_pool_) {
+    bool ret = false;
+    const handle_pool_slot_t* slot = NULL;
+
+    if(NULL == handle_pool_ || NULL == handle_pool_->slots || NULL == handle_pool_->dense_to_slot) {
+        goto cleanup;
+    }
+    if(0 == handle_.generation || handle_.index >= handle_pool_->max_element_count) {
+        goto cleanup;
+    }
+    slot = &handle_pool_->slots[handle_.index];
+    if(slot->generation != handle_.generation || slot->dense_index >= handle_pool_->count) {
+        goto cleanup;
+    }
+    ret = (handle_pool_->dense_to_slot[slot->dense_index] == handle_.index);
+
+cleanup:
+    return ret;
+}
+
+size_t handle_pool_count(const handle_pool_t* handle_pool_) {
+    return (NULL == handle_pool_) ? 0 : handle_pool_->count;
+}
+
+handle_pool_result_t handle_pool_at(size_t dense_index_, const handle_pool_t* handle_pool_, void** out_element_, handle_pool_handle_t* out_handle_) {
+    handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+    uint32_t slot_index = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(handle_pool_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_at", "handle_pool_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_element_, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_at", "out_element_")
+    if(is_handle_pool_corrupted(handle_pool_)) {
+        ret = HANDLE_POOL_DATA_CORRUPTED;
+        ERROR_MESSAGE("handle_pool_at(%s) - Provided handle pool is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP(dense_index_ < handle_pool_->count, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), "handle_pool_at", "dense_index_")
+    slot_index = handle_pool_->dense_to_slot[dense_index_];
+    if(slot_index >= handle_pool_->max_element_count) {
+        ret = HANDLE_POOL_DATA_CORRUPTED;
+        ERROR_MESSAGE("handle_pool_at(%s) - Dense-to-slot table is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    *out_element_ = (char*)handle_pool_->dense + (handle_pool_->stride * dense_index_);
+    if(NULL != out_handle_) {
+        out_handle_->index = slot_index;
+        out_handle_->generation = handle_pool_->slots[slot_index].generation;
+    }
+
+    ret = HANDLE_POOL_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief ハンドルが登録中の要素を参照しているかを検証する(handle_pool_unregister / handle_pool_get共通処理)
+ *
+ * @warning 本関数はhandle_pool_のNULLチェックを行わない
+ *
+ * @param[in] handle_ 検証対象ハンドル
+ * @param[in] handle_pool_ 検証対象ハンドルプール構造体インスタンスへのポインタ
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元API名
+ *
+ * @retval HANDLE_POOL_INVALID_ARGUMENT 以下のいずれか
+ * - handle_.generation == 0
+ * - handle_.indexがハンドルプールの容量を超過
+ * @retval HANDLE_POOL_DATA_CORRUPTED ハンドルプール内部データ破損
+ * @retval HANDLE_POOL_STALE_HANDLE handle_が登録解除済み
+ * @retval HANDLE_POOL_SUCCESS handle_は登録中の要素を参照している
+ */
+static handle_pool_result_t handle_resolve(handle_pool_handle_t handle_, const handle_pool_t* handle_pool_, const char* func_name_) {
+    handle_pool_result_t ret = HANDLE_POOL_INVALID_ARGUMENT;
+
+    if(is_handle_pool_corrupted(handle_pool_)) {
+        ret = HANDLE_POOL_DATA_CORRUPTED;
+        ERROR_MESSAGE("%s(%s) - Provided handle pool is corrupted.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != handle_.generation, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), func_name_, "handle_.generation")
+    IF_ARG_FALSE_GOTO_CLEANUP(handle_.index < handle_pool_->max_element_count, ret, HANDLE_POOL_INVALID_ARGUMENT, rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT), func_name_, "handle_.index")
+    if(!handle_pool_valid(handle_, handle_pool_)) {
+        ret = HANDLE_POOL_STALE_HANDLE;
+        ERROR_MESSAGE("%s(%s) - Handle is stale: index=%u generation=%u.", func_name_, rslt_to_str(ret), (unsigned int)handle_.index, (unsigned int)handle_.generation);
+        goto cleanup;
+    }
+
+    ret = HANDLE_POOL_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリシステム実行結果コードをハンドルプール実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return handle_pool_result_t 変換されたハンドルプール実行結果コード
+ */
+static handle_pool_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return HANDLE_POOL_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return HANDLE_POOL_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return HANDLE_POOL_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return HANDLE_POOL_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return HANDLE_POOL_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return HANDLE_POOL_BAD_OPERATION;
+    default:
+        return HANDLE_POOL_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief ハンドルプール内部データが破損しているかを判定する
+ *
+ * @warning 本関数は内部データ破損判定が目的であるため下記のチェックは行わない
+ * - 引数handle_pool_のNULLチェック
+ * - 各スロット、対応表の整合性チェック(O(1)で判定できないため、参照時に個別に検証する)
+ *
+ * @param[in] handle_pool_ 判定対象ハンドルプール
+ *
+ * @retval true 以下のいずれか
+ * - 0 == handle_pool_->element_size
+ * - 0 == handle_pool_->max_element_count
+ * - handle_pool_->max_element_count > HANDLE_POOL_MAX_ELEMENT_COUNT
+ * - alignof(max_align_t) < handle_pool_->element_align || !IS_POWER_OF_TWO(handle_pool_->element_align)(アライメント要件が破損)
+ * - handle_pool_->stride < handle_pool_->element_size
+ * - 0 != (handle_pool_->stride % handle_pool_->element_align)
+ * - handle_pool_->count > handle_pool_->max_element_count
+ * - handle_pool_->count == handle_pool_->max_element_count && handle_pool_->free_head != HANDLE_POOL_NULL_INDEX(満杯なのに空きスロットがある)
+ * - handle_pool_->count < handle_pool_->max_element_count && handle_pool_->free_head == HANDLE_POOL_NULL_INDEX(空きがあるのに空きスロットがない)
+ * - handle_pool_->dense == NULL || handle_pool_->dense_to_slot == NULL || handle_pool_->slots == NULL
+ * @retval false 内部データ破損なし
+ */
+static bool is_handle_pool_corrupted(const handle_pool_t* handle_pool_) {
+#ifdef TEST_BUILD
+    s_test_config_is_handle_pool_corrupted.call_count++;
+    if(s_test_config_is_handle_pool_corrupted.fail_on_call != 0) {
+        if(s_test_config_is_handle_pool_corrupted.call_count == s_test_config_is_handle_pool_corrupted.fail_on_call) {
+            return s_test_config_is_handle_pool_corrupted.forced_result;
+        }
+    }
+#endif
+    if(0 == handle_pool_->element_size || 0 == handle_pool_->max_element_count || handle_pool_->max_element_count > HANDLE_POOL_MAX_ELEMENT_COUNT) {
+        return true;
+    }
+    if(alignof(max_align_t) < handle_pool_->element_align || !IS_POWER_OF_TWO(handle_pool_->element_align)) {
+        return true;
+    }
+    if(handle_pool_->stride < handle_pool_->element_size || 0 != (handle_pool_->stride % handle_pool_->element_align)) {
+        return true;
+    }
+    if(handle_pool_->count > handle_pool_->max_element_count) {
+        return true;
+    }
+    if(handle_pool_->count == handle_pool_->max_element_count && HANDLE_POOL_NULL_INDEX != handle_pool_->free_head) {
+        return true;
+    }
+    if(handle_pool_->count < handle_pool_->max_element_count && HANDLE_POOL_NULL_INDEX == handle_pool_->free_head) {
+        return true;
+    }
+    if(NULL == handle_pool_->dense || NULL == handle_pool_->dense_to_slot || NULL == handle_pool_->slots) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief ハンドルプール実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ ハンドルプール実行結果コード
+ * @return const char* 変換された文字列
+ */
+static const char* rslt_to_str(handle_pool_result_t rslt_) {
+    switch(rslt_) {
+    case HANDLE_POOL_SUCCESS:
+        return s_rslt_str_success;
+    case HANDLE_POOL_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case HANDLE_POOL_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case HANDLE_POOL_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case HANDLE_POOL_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case HANDLE_POOL_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case HANDLE_POOL_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case HANDLE_POOL_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case HANDLE_POOL_OVERFLOW:
+        return s_rslt_str_overflow;
+    case HANDLE_POOL_STALE_HANDLE:
+        return s_rslt_str_stale_handle;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_handle_pool_create_config_set(const test_call_control_t* config_) {
+    s_test_config_handle_pool_create.fail_on_call = config_->fail_on_call;
+    s_test_config_handle_pool_create.forced_result = config_->forced_result;
+}
+
+void test_handle_pool_register_config_set(const test_call_control_t* config_) {
+    s_test_config_handle_pool_register.fail_on_call = config_->fail_on_call;
+    s_test_config_handle_pool_register.forced_result = config_->forced_result;
+}
+
+void test_handle_pool_config_reset(void) {
+    test_call_control_reset(&s_test_config_handle_pool_create);
+    test_call_control_reset(&s_test_config_handle_pool_register);
+
+    test_call_control_bool_reset(&s_test_config_is_handle_pool_corrupted);
+}
+
+void test_handle_pool(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_handle_pool_create();
+    test_handle_pool_destroy();
+    test_handle_pool_register();
+    test_handle_pool_unregister();
+    test_handle_pool_get();
+    test_handle_pool_valid();
+    test_handle_pool_at();
+    test_rslt_convert_mem_sys();
+    test_is_handle_pool_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_handle_pool_create(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // handle_pool_create() 冒頭で強制的に HANDLE_POOL_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        handle_pool_t* handle_pool = NULL;
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HANDLE_POOL_NO_MEMORY;
+        test_handle_pool_create_config_set(&config);
+
+        assert(HANDLE_POOL_NO_MEMORY == handle_pool_create(4U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(NULL == handle_pool);
+
+        test_handle_pool_config_reset();
+    }
+    {
+        // 引数異常 -> HANDLE_POOL_INVALID_ARGUMENT
+        handle_pool_t dummy = {0};
+        handle_pool_t* handle_pool = &dummy;
+
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(4U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(&dummy == handle_pool);
+
+        handle_pool = NULL;
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(0U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(HANDLE_POOL_MAX_ELEMENT_COUNT + 1U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(4U, 0U, alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(4U, sizeof(uint32_t), 0U, &handle_pool));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(4U, sizeof(uint32_t), 3U, &handle_pool));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_create(4U, sizeof(uint32_t), alignof(max_align_t) * 2U, &handle_pool));
+        assert(NULL == handle_pool);
+    }
+    {
+        // 要素配列サイズのオーバーフロー -> HANDLE_POOL_OVERFLOW
+        handle_pool_t* handle_pool = NULL;
+
+        assert(HANDLE_POOL_OVERFLOW == handle_pool_create(4U, SIZE_MAX, 1U, &handle_pool));
+        assert(HANDLE_POOL_OVERFLOW == handle_pool_create(4U, SIZE_MAX - 2U, 8U, &handle_pool));
+        assert(NULL == handle_pool);
+    }
+    {
+        // 各メモリ割り当ての失敗 -> メモリシステムの実行結果を変換して返し、割り当て済みのメモリは解放される
+        for(uint32_t i = 1U; i <= 4U; ++i) {
+            test_call_control_t config = {0};
+            handle_pool_t* handle_pool = NULL;
+            memory_tag_stats_t stats = {0};
+
+            test_choco_memory_config_reset();
+            config.fail_on_call = i;
+            config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+            test_memory_system_allocate_config_set(&config);
+
+            assert(HANDLE_POOL_NO_MEMORY == handle_pool_create(4U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+            assert(NULL == handle_pool);
+            assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_CONTAINER, &stats));
+            assert(0U == stats.allocated);
+        }
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系: ストライドはアライメント要件の倍数に切り上げられ、全スロットが空きスロットリストに繋がる
+        handle_pool_t* handle_pool = NULL;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(3U, 12U, 8U, &handle_pool));
+        assert(NULL != handle_pool);
+        assert(12U == handle_pool->element_size);
+        assert(8U == handle_pool->element_align);
+        assert(16U == handle_pool->stride);
+        assert(3U == handle_pool->max_element_count);
+        assert(0U == handle_pool->count);
+        assert(0U == handle_pool->free_head);
+        assert(1U == handle_pool->slots[0].dense_index);
+        assert(2U == handle_pool->slots[1].dense_index);
+        assert(HANDLE_POOL_NULL_INDEX == handle_pool->slots[2].dense_index);
+        for(size_t i = 0; i != 3U; ++i) {
+            assert(1U == handle_pool->slots[i].generation);
+        }
+        assert(!is_handle_pool_corrupted(handle_pool));
+
+        handle_pool_destroy(&handle_pool);
+        assert(NULL == handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_handle_pool_destroy(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // NULL, *handle_pool_ == NULL -> no-op(2重デストロイ許可)
+        handle_pool_t* handle_pool = NULL;
+
+        handle_pool_destroy(NULL);
+        handle_pool_destroy(&handle_pool);
+        assert(NULL == handle_pool);
+    }
+    {
+        // 正常系: 全てのメモリが解放される
+        handle_pool_t* handle_pool = NULL;
+        memory_tag_stats_t stats = {0};
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(8U, sizeof(uint64_t), alignof(uint64_t), &handle_pool));
+        handle_pool_destroy(&handle_pool);
+        assert(NULL == handle_pool);
+        handle_pool_destroy(&handle_pool);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_CONTAINER, &stats));
+        assert(0U == stats.allocated);
+    }
+    {
+        // 内部データ破損時は管理構造体のみ解放する
+        handle_pool_t* handle_pool = NULL;
+        void* dense = NULL;
+        void* dense_to_slot = NULL;
+        void* slots = NULL;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        dense = handle_pool->dense;
+        dense_to_slot = handle_pool->dense_to_slot;
+        slots = handle_pool->slots;
+
+        test_handle_pool_config_reset();
+        s_test_config_is_handle_pool_corrupted.fail_on_call = 1U;
+        s_test_config_is_handle_pool_corrupted.forced_result = true;
+        handle_pool_destroy(&handle_pool);
+        assert(NULL == handle_pool);
+        test_handle_pool_config_reset();
+
+        memory_system_free(slots, sizeof(handle_pool_slot_t) * 2U, MEMORY_TAG_CONTAINER);
+        memory_system_free(dense_to_slot, sizeof(uint32_t) * 2U, MEMORY_TAG_CONTAINER);
+        memory_system_free(dense, sizeof(uint32_t) * 2U, MEMORY_TAG_CONTAINER);
+    }
+}
+
+static void NO_COVERAGE test_handle_pool_register(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // handle_pool_register() 冒頭で強制的に HANDLE_POOL_LIMIT_EXCEEDED を返させる
+        test_call_control_t config = {0};
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handle = {0};
+        const uint32_t data = 1U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HANDLE_POOL_LIMIT_EXCEEDED;
+        test_handle_pool_register_config_set(&config);
+
+        assert(HANDLE_POOL_LIMIT_EXCEEDED == handle_pool_register(&data, handle_pool, &handle));
+        assert(0U == handle_pool_count(handle_pool));
+
+        test_handle_pool_config_reset();
+        handle_pool_destroy(&handle_pool);
+    }
+    {
+        // 引数異常 -> HANDLE_POOL_INVALID_ARGUMENT
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handle = {0};
+        const uint32_t data = 1U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_register(NULL, handle_pool, &handle));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_register(&data, NULL, &handle));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_register(&data, handle_pool, NULL));
+        assert(0U == handle_pool_count(handle_pool));
+        handle_pool_destroy(&handle_pool);
+    }
+    {
+        // 内部データ破損 -> HANDLE_POOL_DATA_CORRUPTED
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handle = {0};
+        const uint32_t data = 1U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        handle_pool->free_head = HANDLE_POOL_NULL_INDEX;
+        assert(HANDLE_POOL_DATA_CORRUPTED == handle_pool_register(&data, handle_pool, &handle));
+        handle_pool->free_head = 5U;
+        assert(HANDLE_POOL_DATA_CORRUPTED == handle_pool_register(&data, handle_pool, &handle));
+        handle_pool->free_head = 0U;
+        handle_pool_destroy(&handle_pool);
+    }
+    {
+        // 正常系: 要素はコピーして詰めて格納され、満杯になるとHANDLE_POOL_LIMIT_EXCEEDED
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handles[3] = {0};
+        handle_pool_handle_t handle = {0};
+        const uint32_t data[3] = { 10U, 20U, 30U };
+        const uint32_t extra = 40U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(3U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        for(size_t i = 0; i != 3U; ++i) {
+            assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data[i], handle_pool, &handles[i]));
+            assert((uint32_t)i == handles[i].index);
+            assert(1U == handles[i].generation);
+            assert(data[i] == ((const uint32_t*)handle_pool->dense)[i]);
+            assert((uint32_t)i == handle_pool->dense_to_slot[i]);
+        }
+        assert(3U == handle_pool_count(handle_pool));
+        assert(HANDLE_POOL_NULL_INDEX == handle_pool->free_head);
+
+        assert(HANDLE_POOL_LIMIT_EXCEEDED == handle_pool_register(&extra, handle_pool, &handle));
+        assert(0U == handle.generation);
+        assert(3U == handle_pool_count(handle_pool));
+
+        handle_pool_destroy(&handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_handle_pool_unregister(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // 引数異常 -> HANDLE_POOL_INVALID_ARGUMENT
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handle = {0};
+        const uint32_t data = 1U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data, handle_pool, &handle));
+
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_unregister(handle, NULL));
+        {
+            handle_pool_handle_t invalid = handle;
+            invalid.generation = 0U;
+            assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_unregister(invalid, handle_pool));
+        }
+        {
+            handle_pool_handle_t invalid = handle;
+            invalid.index = 2U;
+            assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_unregister(invalid, handle_pool));
+        }
+        assert(1U == handle_pool_count(handle_pool));
+
+        // 内部データ破損 -> HANDLE_POOL_DATA_CORRUPTED
+        handle_pool->count = 3U;
+        assert(HANDLE_POOL_DATA_CORRUPTED == handle_pool_unregister(handle, handle_pool));
+        handle_pool->count = 1U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(handle, handle_pool));
+        handle_pool_destroy(&handle_pool);
+    }
+    {
+        // 正常系: 末尾の要素が空いた位置に移動し、移動した要素のハンドルは有効なまま
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handles[3] = {0};
+        const uint32_t data[3] = { 10U, 20U, 30U };
+        uint32_t* element = NULL;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(3U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        for(size_t i = 0; i != 3U; ++i) {
+            assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data[i], handle_pool, &handles[i]));
+        }
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(handles[0], handle_pool));
+        assert(2U == handle_pool_count(handle_pool));
+        assert(30U == ((const uint32_t*)handle_pool->dense)[0]);
+        assert(20U == ((const uint32_t*)handle_pool->dense)[1]);
+        assert(0U == ((const uint32_t*)handle_pool->dense)[2]);
+        assert(2U == handle_pool->dense_to_slot[0]);
+        assert(0U == handle_pool->slots[2].dense_index);
+        assert(2U == handle_pool->slots[0].generation);
+        assert(0U == handle_pool->free_head);
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_get(handles[2], handle_pool, (void**)&element));
+        assert(30U == *element);
+        assert(HANDLE_POOL_SUCCESS == handle_pool_get(handles[1], handle_pool, (void**)&element));
+        assert(20U == *element);
+
+        // 登録解除済みのハンドル -> HANDLE_POOL_STALE_HANDLE(2重登録解除の検出)
+        assert(HANDLE_POOL_STALE_HANDLE == handle_pool_unregister(handles[0], handle_pool));
+        assert(2U == handle_pool_count(handle_pool));
+
+        // 末尾の要素の登録解除
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(handles[1], handle_pool));
+        assert(1U == handle_pool_count(handle_pool));
+        assert(30U == ((const uint32_t*)handle_pool->dense)[0]);
+        assert(1U == handle_pool->free_head);
+        assert(0U == handle_pool->slots[1].dense_index);
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(handles[2], handle_pool));
+        assert(0U == handle_pool_count(handle_pool));
+        assert(!is_handle_pool_corrupted(handle_pool));
+
+        handle_pool_destroy(&handle_pool);
+    }
+    {
+        // スロット再利用: 古いハンドルは無効、新しいハンドルは世代が進む / 世代のラップアラウンドで0を使用しない
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t old_handle = {0};
+        handle_pool_handle_t new_handle = {0};
+        const uint32_t data_old = 1U;
+        const uint32_t data_new = 2U;
+        uint32_t* element = NULL;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(1U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data_old, handle_pool, &old_handle));
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(old_handle, handle_pool));
+        assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data_new, handle_pool, &new_handle));
+        assert(old_handle.index == new_handle.index);
+        assert(old_handle.generation + 1U == new_handle.generation);
+        assert(HANDLE_POOL_STALE_HANDLE == handle_pool_get(old_handle, handle_pool, (void**)&element));
+        assert(NULL == element);
+        assert(HANDLE_POOL_SUCCESS == handle_pool_get(new_handle, handle_pool, (void**)&element));
+        assert(2U == *element);
+
+        handle_pool->slots[new_handle.index].generation = UINT32_MAX;
+        new_handle.generation = UINT32_MAX;
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(new_handle, handle_pool));
+        assert(1U == handle_pool->slots[new_handle.index].generation);
+
+        handle_pool_destroy(&handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_handle_pool_get(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handle = {0};
+        const uint64_t data = 0x0123456789ABCDEFULL;
+        uint64_t* element = NULL;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint64_t), alignof(uint64_t), &handle_pool));
+        assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data, handle_pool, &handle));
+
+        // 引数異常 -> HANDLE_POOL_INVALID_ARGUMENT
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_get(handle, NULL, (void**)&element));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_get(handle, handle_pool, NULL));
+        {
+            const handle_pool_handle_t invalid = {0};
+            assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_get(invalid, handle_pool, (void**)&element));
+        }
+        assert(NULL == element);
+
+        // 内部データ破損 -> HANDLE_POOL_DATA_CORRUPTED
+        handle_pool->stride = 4U;
+        assert(HANDLE_POOL_DATA_CORRUPTED == handle_pool_get(handle, handle_pool, (void**)&element));
+        handle_pool->stride = sizeof(uint64_t);
+
+        // 世代が一致しても未登録のスロット -> HANDLE_POOL_STALE_HANDLE
+        {
+            handle_pool_handle_t unused = { 1U, 1U };
+            assert(HANDLE_POOL_STALE_HANDLE == handle_pool_get(unused, handle_pool, (void**)&element));
+        }
+        assert(NULL == element);
+
+        // 正常系
+        assert(HANDLE_POOL_SUCCESS == handle_pool_get(handle, handle_pool, (void**)&element));
+        assert(data == *element);
+        *element = 42U;
+        assert(42U == ((const uint64_t*)handle_pool->dense)[0]);
+
+        handle_pool_destroy(&handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_handle_pool_valid(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handle = {0};
+        const uint32_t data = 1U;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data, handle_pool, &handle));
+
+        assert(!handle_pool_valid(handle, NULL));
+        {
+            const handle_pool_handle_t invalid = {0};
+            assert(!handle_pool_valid(invalid, handle_pool));
+        }
+        {
+            handle_pool_handle_t out_of_range = handle;
+            out_of_range.index = 2U;
+            assert(!handle_pool_valid(out_of_range, handle_pool));
+        }
+        assert(handle_pool_valid(handle, handle_pool));
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(handle, handle_pool));
+        assert(!handle_pool_valid(handle, handle_pool));
+
+        assert(0U == handle_pool_count(NULL));
+        handle_pool_destroy(&handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_handle_pool_at(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_handle_t handles[4] = {0};
+        const uint32_t data[4] = { 10U, 20U, 30U, 40U };
+        uint32_t* element = NULL;
+        handle_pool_handle_t handle = {0};
+        uint32_t sum = 0;
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(4U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        for(size_t i = 0; i != 4U; ++i) {
+            assert(HANDLE_POOL_SUCCESS == handle_pool_register(&data[i], handle_pool, &handles[i]));
+        }
+        assert(HANDLE_POOL_SUCCESS == handle_pool_unregister(handles[1], handle_pool));
+
+        // 引数異常 -> HANDLE_POOL_INVALID_ARGUMENT
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_at(0U, NULL, (void**)&element, &handle));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_at(0U, handle_pool, NULL, &handle));
+        assert(HANDLE_POOL_INVALID_ARGUMENT == handle_pool_at(3U, handle_pool, (void**)&element, &handle));
+
+        // 内部データ破損 -> HANDLE_POOL_DATA_CORRUPTED
+        handle_pool->count = 4U;
+        assert(HANDLE_POOL_DATA_CORRUPTED == handle_pool_at(0U, handle_pool, (void**)&element, &handle));
+        handle_pool->count = 3U;
+        handle_pool->dense_to_slot[0] = 4U;
+        assert(HANDLE_POOL_DATA_CORRUPTED == handle_pool_at(0U, handle_pool, (void**)&element, &handle));
+        handle_pool->dense_to_slot[0] = 0U;
+
+        // 正常系: 登録中の要素を詰めて走査でき、取得したハンドルで参照し直せる
+        for(size_t i = 0; i != handle_pool_count(handle_pool); ++i) {
+            uint32_t* resolved = NULL;
+            element = NULL;
+            assert(HANDLE_POOL_SUCCESS == handle_pool_at(i, handle_pool, (void**)&element, &handle));
+            assert(HANDLE_POOL_SUCCESS == handle_pool_get(handle, handle_pool, (void**)&resolved));
+            assert(resolved == element);
+            sum += *element;
+        }
+        assert((10U + 30U + 40U) == sum);
+
+        element = NULL;
+        assert(HANDLE_POOL_SUCCESS == handle_pool_at(1U, handle_pool, (void**)&element, NULL));
+        assert(40U == *element);
+
+        handle_pool_destroy(&handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(HANDLE_POOL_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(HANDLE_POOL_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(HANDLE_POOL_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(HANDLE_POOL_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(HANDLE_POOL_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(HANDLE_POOL_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(HANDLE_POOL_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)100));
+}
+
+static void NO_COVERAGE test_is_handle_pool_corrupted(void) {
+    test_handle_pool_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        handle_pool_t* handle_pool = NULL;
+        handle_pool_t backup = {0};
+
+        assert(HANDLE_POOL_SUCCESS == handle_pool_create(2U, sizeof(uint32_t), alignof(uint32_t), &handle_pool));
+        backup = *handle_pool;
+        assert(!is_handle_pool_corrupted(handle_pool));
+
+        handle_pool->element_size = 0U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->max_element_count = 0U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->max_element_count = HANDLE_POOL_MAX_ELEMENT_COUNT + 1U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->element_align = 3U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->element_align = alignof(max_align_t) * 2U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->stride = 2U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->stride = 6U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->count = 3U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->count = 2U;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->free_head = HANDLE_POOL_NULL_INDEX;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->dense = NULL;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->dense_to_slot = NULL;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool->slots = NULL;
+        assert(is_handle_pool_corrupted(handle_pool));
+        *handle_pool = backup;
+
+        handle_pool_destroy(&handle_pool);
+    }
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(0 == strcmp("SUCCESS", rslt_to_str(HANDLE_POOL_SUCCESS)));
+    assert(0 == strcmp("INVALID_ARGUMENT", rslt_to_str(HANDLE_POOL_INVALID_ARGUMENT)));
+    assert(0 == strcmp("NO_MEMORY", rslt_to_str(HANDLE_POOL_NO_MEMORY)));
+    assert(0 == strcmp("RUNTIME_ERROR", rslt_to_str(HANDLE_POOL_RUNTIME_ERROR)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str(HANDLE_POOL_UNDEFINED_ERROR)));
+    assert(0 == strcmp("LIMIT_EXCEEDED", rslt_to_str(HANDLE_POOL_LIMIT_EXCEEDED)));
+    assert(0 == strcmp("BAD_OPERATION", rslt_to_str(HANDLE_POOL_BAD_OPERATION)));
+    assert(0 == strcmp("DATA_CORRUPTED", rslt_to_str(HANDLE_POOL_DATA_CORRUPTED)));
+    assert(0 == strcmp("OVERFLOW", rslt_to_str(HANDLE_POOL_OVERFLOW)));
+    assert(0 == strcmp("STALE_HANDLE", rslt_to_str(HANDLE_POOL_STALE_HANDLE)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str((handle_pool_result_t)100)));
+}
+#endif
@@ -0,0 +1,1485 @@
+/** @ingroup containers
+ *
+ * @file hash_map.c
+ * @author chocolate-pie24
+ * @brief キーと値を内部に直接格納する、容量固定のジェネリック型ハッシュマップモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset, memcpy, memcmp
+
+#include "engine/containers/hash_map.h"
+
+#include "engine/core/memory/choco_memory.h"
+#include "engine/core/memory/linear_allocator.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <stdlib.h> // for malloc, free
+#include "engine/containers/test_hash_map.h"
+#include "engine/core/memory/test_choco_memory.h"
+#include "engine/core/memory/test_linear_allocator.h"
+
+// hash_mapモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_hash_map_create;       /**< hash_map_create()テスト設定 */
+static test_call_control_t s_test_config_hash_map_initialize;   /**< hash_map_initialize()テスト設定 */
+static test_call_control_t s_test_config_hash_map_insert;       /**< hash_map_insert()テスト設定 */
+
+// プライベート関数テスト設定
+static test_call_control_bool_t s_test_config_is_hash_map_corrupted;    /**< is_hash_map_corrupted()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_hash_map_create(void);
+static void test_hash_map_preinit(void);
+static void test_hash_map_initialize(void);
+static void test_hash_map_destroy(void);
+static void test_hash_map_insert(void);
+static void test_hash_map_find(void);
+static void test_hash_map_remove(void);
+static void test_hash_map_clear(void);
+static void test_hash_map_stress(void);
+static void test_rslt_convert_mem_sys(void);
+static void test_rslt_convert_linear_alloc(void);
+static void test_is_hash_map_corrupted(void);
+static void test_rslt_to_str(void);
+#endif
+
+#define HASH_MAP_FNV_OFFSET_BASIS 2166136261U   /**< FNV-1a(32bit)オフセットベーシス */
+#define HASH_MAP_FNV_PRIME 16777619U            /**< FNV-1a(32bit)FNVプライム */
+
+/**
+ * @brief キー/値配列の末尾に確保する作業用スロット数
+ *
+ * @note 挿入時に押し出したエントリを一時的に保持するスロット(capacity)と、エントリ交換用のスロット(capacity + 1)の2つ
+ */
+#define HASH_MAP_SCRATCH_SLOT_COUNT 2U
+
+/**
+ * @brief バケットのメタデータ
+ *
+ * @note キー/値は別配列の同じインデックスに格納する
+ */
+typedef struct hash_map_bucket {
+    uint32_t hash;      /**< 格納中のキーのハッシュ値 */
+    uint32_t distance;  /**< 理想位置(hash & (capacity - 1))からの探索距離 + 1(0は空きバケット) */
+} hash_map_bucket_t;
+
+/**
+ * @brief 生成パラメータから算出したハッシュマップのメモリレイアウト
+ *
+ */
+typedef struct hash_map_layout {
+    size_t capacity;            /**< バケット数(2のべき乗) */
+    size_t key_stride;          /**< キー1つに必要なメモリ領域(key_sizeをkey_alignの倍数に切り上げた値) */
+    size_t value_stride;        /**< 値1つに必要なメモリ領域(value_sizeをvalue_alignの倍数に切り上げた値) */
+    size_t bucket_array_size;   /**< バケット配列のサイズ(byte) */
+    size_t key_array_size;      /**< キー配列のサイズ(byte、作業用スロットを含む) */
+    size_t value_array_size;    /**< 値配列のサイズ(byte、作業用スロットを含む) */
+} hash_map_layout_t;
+
+/**
+ * @brief hash_map_t内部データ構造
+ *
+ */
+struct hash_map {
+    size_t key_size;            /**< キーのサイズ */
+    size_t key_align;           /**< キーのアライメント要件 */
+    size_t value_size;          /**< 値のサイズ */
+    size_t value_align;         /**< 値のアライメント要件 */
+    size_t max_entry_count;     /**< 格納可能な最大エントリ数 */
+    size_t count;               /**< 登録中のエントリ数 */
+    hash_map_layout_t layout;   /**< メモリレイアウト */
+    bool owns_memory;           /**< true: メモリシステムから確保 / false: リニアアロケータから確保(個別解放しない) */
+    hash_map_bucket_t* buckets; /**< バケットのメタデータ配列(capacity) */
+    void* keys;                 /**< キー配列(key_stride * (capacity + HASH_MAP_SCRATCH_SLOT_COUNT)) */
+    void* values;               /**< 値配列(value_stride * (capacity + HASH_MAP_SCRATCH_SLOT_COUNT)) */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< ハッシュマップAPI実行結果コード(処理成功)に対応する文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< ハッシュマップAPI実行結果コード(無効な引数)に対応する文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< ハッシュマップAPI実行結果コード(メモリ不足)に対応する文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< ハッシュマップAPI実行結果コード(実行時エラー)に対応する文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< ハッシュマップAPI実行結果コード(未定義エラー)に対応する文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< ハッシュマップAPI実行結果コード(システム使用可能範囲上限超過)に対応する文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< ハッシュマップAPI実行結果コード(API誤用)に対応する文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< ハッシュマップAPI実行結果コード(内部データ破損)に対応する文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< ハッシュマップAPI実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
+static const char* const s_rslt_str_key_not_found = "KEY_NOT_FOUND";        /**< ハッシュマップAPI実行結果コード(キー未登録)に対応する文字列 */
+static const char* const s_rslt_str_key_exists = "KEY_EXISTS";              /**< ハッシュマップAPI実行結果コード(キー登録済み)に対応する文字列 */
+
+static hash_map_result_t layout_compute(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, const char* func_name_, hash_map_layout_t* out_layout_);
+static void hash_map_setup(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, const hash_map_layout_t* layout_, hash_map_t* hash_map_);
+static uint32_t key_hash(const void* key_, size_t key_size_);
+static void* key_at(const hash_map_t* hash_map_, size_t index_);
+static void* value_at(const hash_map_t* hash_map_, size_t index_);
+static void entry_copy(size_t dst_, size_t src_, hash_map_t* hash_map_);
+static bool entry_find(const void* key_, uint32_t hash_, const hash_map_t* hash_map_, size_t* out_index_);
+static bool is_hash_map_corrupted(const hash_map_t* hash_map_);
+static const char* rslt_to_str(hash_map_result_t rslt_);
+static hash_map_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+static hash_map_result_t rslt_convert_linear_alloc(linear_allocator_result_t rslt_);
+
+hash_map_result_t hash_map_create(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, hash_map_t** hash_map_) {
+#ifdef TEST_BUILD
+    s_test_config_hash_map_create.call_count++;
+    if(s_test_config_hash_map_create.fail_on_call != 0) {
+        if(s_test_config_hash_map_create.call_count == s_test_config_hash_map_create.fail_on_call) {
+            return (hash_map_result_t)s_test_config_hash_map_create.forced_result;
+        }
+    }
+#endif
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    hash_map_t* tmp_map = NULL;
+    hash_map_layout_t layout = { 0 };
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_create", "hash_map_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_create", "*hash_map_")
+    ret = layout_compute(max_entry_count_, key_size_, key_align_, value_size_, value_align_, "hash_map_create", &layout);
+    if(HASH_MAP_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // Simulation.
+    ret_mem = memory_system_allocate(sizeof(*tmp_map), MEMORY_TAG_CONTAINER, (void**)&tmp_map);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("hash_map_create(%s) - Failed to allocate hash map memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_map, 0, sizeof(*tmp_map));
+
+    ret_mem = memory_system_allocate(layout.bucket_array_size, MEMORY_TAG_CONTAINER, (void**)&tmp_map->buckets);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("hash_map_create(%s) - Failed to allocate bucket array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_mem = memory_system_allocate(layout.key_array_size, MEMORY_TAG_CONTAINER, &tmp_map->keys);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("hash_map_create(%s) - Failed to allocate key array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_mem = memory_system_allocate(layout.value_array_size, MEMORY_TAG_CONTAINER, &tmp_map->values);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("hash_map_create(%s) - Failed to allocate value array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    hash_map_setup(max_entry_count_, key_size_, key_align_, value_size_, value_align_, &layout, tmp_map);
+    tmp_map->owns_memory = true;
+    *hash_map_ = tmp_map;
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    if(HASH_MAP_SUCCESS != ret) {
+        if(NULL != tmp_map) {
+            if(NULL != tmp_map->values) {
+                memory_system_free(tmp_map->values, layout.value_array_size, MEMORY_TAG_CONTAINER);
+                tmp_map->values = NULL;
+            }
+            if(NULL != tmp_map->keys) {
+                memory_system_free(tmp_map->keys, layout.key_array_size, MEMORY_TAG_CONTAINER);
+                tmp_map->keys = NULL;
+            }
+            if(NULL != tmp_map->buckets) {
+                memory_system_free(tmp_map->buckets, layout.bucket_array_size, MEMORY_TAG_CONTAINER);
+                tmp_map->buckets = NULL;
+            }
+            memory_system_free(tmp_map, sizeof(*tmp_map), MEMORY_TAG_CONTAINER);
+            tmp_map = NULL;
+        }
+    }
+    return ret;
+}
+
+hash_map_result_t hash_map_preinit(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, size_t* io_pool_requirement_) {
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    hash_map_layout_t layout = { 0 };
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_preinit", "io_pool_requirement_")
+    ret = layout_compute(max_entry_count_, key_size_, key_align_, value_size_, value_align_, "hash_map_preinit", &layout);
+    if(HASH_MAP_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // hash_map_initializeと同じ順序で加算する
+    ret_linear_alloc = linear_allocator_requirement_add(sizeof(hash_map_t), alignof(hash_map_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(layout.bucket_array_size, alignof(hash_map_bucket_t), io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(layout.key_array_size, key_align_, io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(layout.value_array_size, value_align_, io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        // NOTE: requirement_addは加算結果のオーバーフローのみで失敗する(引数は検証済み)
+        ret = HASH_MAP_OVERFLOW;
+        ERROR_MESSAGE("hash_map_preinit(%s) - Failed to accumulate pool requirement.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+hash_map_result_t hash_map_initialize(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, linear_alloc_t* allocator_, hash_map_t** hash_map_) {
+#ifdef TEST_BUILD
+    s_test_config_hash_map_initialize.call_count++;
+    if(s_test_config_hash_map_initialize.fail_on_call != 0) {
+        if(s_test_config_hash_map_initialize.call_count == s_test_config_hash_map_initialize.fail_on_call) {
+            return (hash_map_result_t)s_test_config_hash_map_initialize.forced_result;
+        }
+    }
+#endif
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    hash_map_t* tmp_map = NULL;
+    hash_map_layout_t layout = { 0 };
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_initialize", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_initialize", "hash_map_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_initialize", "*hash_map_")
+    ret = layout_compute(max_entry_count_, key_size_, key_align_, value_size_, value_align_, "hash_map_initialize", &layout);
+    if(HASH_MAP_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // Simulation.
+    ret_linear_alloc = linear_allocator_allocate(allocator_, sizeof(hash_map_t), alignof(hash_map_t), (void**)&tmp_map);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("hash_map_initialize(%s) - Failed to allocate hash map memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_map, 0, sizeof(*tmp_map));
+
+    ret_linear_alloc = linear_allocator_allocate(allocator_, layout.bucket_array_size, alignof(hash_map_bucket_t), (void**)&tmp_map->buckets);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("hash_map_initialize(%s) - Failed to allocate bucket array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_linear_alloc = linear_allocator_allocate(allocator_, layout.key_array_size, key_align_, &tmp_map->keys);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("hash_map_initialize(%s) - Failed to allocate key array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_linear_alloc = linear_allocator_allocate(allocator_, layout.value_array_size, value_align_, &tmp_map->values);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("hash_map_initialize(%s) - Failed to allocate value array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    hash_map_setup(max_entry_count_, key_size_, key_align_, value_size_, value_align_, &layout, tmp_map);
+    tmp_map->owns_memory = false;
+    *hash_map_ = tmp_map;
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    // リニアアロケータで確保したメモリは個別解放不可であるためクリーンナップ処理はなし
+    return ret;
+}
+
+void hash_map_destroy(hash_map_t** hash_map_) {
+    if(NULL == hash_map_) {
+        goto cleanup;
+    }
+    if(NULL == *hash_map_) {
+        goto cleanup;
+    }
+    if(!(*hash_map_)->owns_memory) {
+        // リニアアロケータから確保したメモリはリニアアロケータごと破棄される
+        *hash_map_ = NULL;
+        goto cleanup;
+    }
+    if(!is_hash_map_corrupted(*hash_map_)) { // 内部データが破損していた場合にfreeするのは危険
+        memory_system_free((*hash_map_)->values, (*hash_map_)->layout.value_array_size, MEMORY_TAG_CONTAINER);
+        memory_system_free((*hash_map_)->keys, (*hash_map_)->layout.key_array_size, MEMORY_TAG_CONTAINER);
+        memory_system_free((*hash_map_)->buckets, (*hash_map_)->layout.bucket_array_size, MEMORY_TAG_CONTAINER);
+    } else {
+        WARN_MESSAGE("hash_map_destroy - Provided hash_map_ is corrupted.");
+    }
+
+    memory_system_free(*hash_map_, sizeof(hash_map_t), MEMORY_TAG_CONTAINER);
+    *hash_map_ = NULL;
+cleanup:
+    return;
+}
+
+hash_map_result_t hash_map_insert(const void* key_, const void* value_, hash_map_t* hash_map_) {
+#ifdef TEST_BUILD
+    s_test_config_hash_map_insert.call_count++;
+    if(s_test_config_hash_map_insert.fail_on_call != 0) {
+        if(s_test_config_hash_map_insert.call_count == s_test_config_hash_map_insert.fail_on_call) {
+            return (hash_map_result_t)s_test_config_hash_map_insert.forced_result;
+        }
+    }
+#endif
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    uint32_t hash = 0;
+    size_t mask = 0;
+    size_t index = 0;
+    size_t found_index = 0;
+    size_t carry = 0;
+    size_t swap = 0;
+    hash_map_bucket_t carry_bucket = { 0 };
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(key_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_insert", "key_")
+    IF_ARG_NULL_GOTO_CLEANUP(value_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_insert", "value_")
+    IF_ARG_NULL_GOTO_CLEANUP(hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_insert", "hash_map_")
+    if(is_hash_map_corrupted(hash_map_)) {
+        ret = HASH_MAP_DATA_CORRUPTED;
+        ERROR_MESSAGE("hash_map_insert(%s) - Provided hash map is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    hash = key_hash(key_, hash_map_->key_size);
+    if(entry_find(key_, hash, hash_map_, &found_index)) {
+        ret = HASH_MAP_KEY_EXISTS;
+        ERROR_MESSAGE("hash_map_insert(%s) - Provided key is already registered.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(hash_map_->count >= hash_map_->max_entry_count) {
+        ret = HASH_MAP_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("hash_map_insert(%s) - Hash map is full.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    // 挿入するエントリを作業用スロットに置き、探索距離が自身より短いエントリと入れ替えながら空きバケットまで進める
+    mask = hash_map_->layout.capacity - 1;
+    carry = hash_map_->layout.capacity;
+    swap = hash_map_->layout.capacity + 1;
+    memcpy(key_at(hash_map_, carry), key_, hash_map_->key_size);
+    memcpy(value_at(hash_map_, carry), value_, hash_map_->value_size);
+    carry_bucket.hash = hash;
+    carry_bucket.distance = 1;
+    index = (size_t)hash & mask;
+    while(0 != hash_map_->buckets[index].distance) {
+        if(hash_map_->buckets[index].distance < carry_bucket.distance) {
+            const hash_map_bucket_t tmp_bucket = hash_map_->buckets[index];
+            hash_map_->buckets[index] = carry_bucket;
+            carry_bucket = tmp_bucket;
+            entry_copy(swap, index, hash_map_);
+            entry_copy(index, carry, hash_map_);
+            entry_copy(carry, swap, hash_map_);
+        }
+        index = (index + 1) & mask;
+        carry_bucket.distance++;
+    }
+    hash_map_->buckets[index] = carry_bucket;
+    entry_copy(index, carry, hash_map_);
+    hash_map_->count++;
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+hash_map_result_t hash_map_find(const void* key_, const hash_map_t* hash_map_, void** out_value_) {
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    size_t index = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(key_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_find", "key_")
+    IF_ARG_NULL_GOTO_CLEANUP(hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_find", "hash_map_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_value_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_find", "out_value_")
+    if(is_hash_map_corrupted(hash_map_)) {
+        ret = HASH_MAP_DATA_CORRUPTED;
+        ERROR_MESSAGE("hash_map_find(%s) - Provided hash map is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(!entry_find(key_, key_hash(key_, hash_map_->key_size), hash_map_, &index)) {
+        // NOTE: キーの存在確認に使用することも考慮し、ワーニング、エラーは出さない
+        ret = HASH_MAP_KEY_NOT_FOUND;
+        goto cleanup;
+    }
+
+    // commit.
+    *out_value_ = value_at(hash_map_, index);
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+hash_map_result_t hash_map_remove(const void* key_, hash_map_t* hash_map_) {
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    size_t mask = 0;
+    size_t index = 0;
+    size_t next = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(key_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_remove", "key_")
+    IF_ARG_NULL_GOTO_CLEANUP(hash_map_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), "hash_map_remove", "hash_map_")
+    if(is_hash_map_corrupted(hash_map_)) {
+        ret = HASH_MAP_DATA_CORRUPTED;
+        ERROR_MESSAGE("hash_map_remove(%s) - Provided hash map is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(!entry_find(key_, key_hash(key_, hash_map_->key_size), hash_map_, &index)) {
+        ret = HASH_MAP_KEY_NOT_FOUND;
+        goto cleanup;
+    }
+
+    // commit.
+    // 後続のエントリを理想位置に到達するか空きバケットに当たるまで1つずつ前に詰める(backward shift deletion)
+    mask = hash_map_->layout.capacity - 1;
+    next = (index + 1) & mask;
+    while(hash_map_->buckets[next].distance > 1) {
+        hash_map_->buckets[index].hash = hash_map_->buckets[next].hash;
+        hash_map_->buckets[index].distance = hash_map_->buckets[next].distance - 1;
+        entry_copy(index, next, hash_map_);
+        index = next;
+        next = (next + 1) & mask;
+    }
+    hash_map_->buckets[index].hash = 0;
+    hash_map_->buckets[index].distance = 0;
+    hash_map_->count--;
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void hash_map_clear(hash_map_t* hash_map_) {
+    if(NULL == hash_map_ || NULL == hash_map_->buckets) {
+        return;
+    }
+    memset(hash_map_->buckets, 0, hash_map_->layout.bucket_array_size);
+    hash_map_->count = 0;
+}
+
+size_t hash_map_count(const hash_map_t* hash_map_) {
+    return (NULL == hash_map_) ? 0 : hash_map_->count;
+}
+
+/**
+ * @brief 生成パラメータを検証し、ハッシュマップのメモリレイアウトを算出する(hash_map_create / hash_map_preinit / hash_map_initialize共通処理)
+ *
+ * @note バケット数は最大エントリ数の8/7倍以上となる最小の2のべき乗とする(負荷率7/8以下)
+ *
+ * @param[in] max_entry_count_ 格納可能な最大エントリ数
+ * @param[in] key_size_ キーのサイズ
+ * @param[in] key_align_ キーのアライメント要件
+ * @param[in] value_size_ 値のサイズ
+ * @param[in] value_align_ 値のアライメント要件
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元API名
+ * @param[out] out_layout_ 算出したメモリレイアウトの格納先
+ *
+ * @retval HASH_MAP_INVALID_ARGUMENT 生成パラメータがhash_map_createの制約を満たさない
+ * @retval HASH_MAP_OVERFLOW 配列サイズの計算過程でオーバーフローが発生
+ * @retval HASH_MAP_SUCCESS 算出に成功し、正常終了
+ */
+static hash_map_result_t layout_compute(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, const char* func_name_, hash_map_layout_t* out_layout_) {
+    hash_map_result_t ret = HASH_MAP_INVALID_ARGUMENT;
+    size_t min_capacity = 0;
+    size_t capacity = 1;
+    size_t slot_count = 0;
+    size_t key_stride = 0;
+    size_t value_stride = 0;
+
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != max_entry_count_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "max_entry_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(max_entry_count_ <= HASH_MAP_MAX_ENTRY_COUNT, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "max_entry_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != key_size_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "key_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(key_align_), ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "key_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(key_align_ <= alignof(max_align_t), ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "key_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != value_size_, ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "value_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(value_align_), ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "value_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(value_align_ <= alignof(max_align_t), ret, HASH_MAP_INVALID_ARGUMENT, rslt_to_str(HASH_MAP_INVALID_ARGUMENT), func_name_, "value_align_")
+
+    if((SIZE_MAX - (key_align_ - 1)) < key_size_ || (SIZE_MAX - (value_align_ - 1)) < value_size_) {
+        ret = HASH_MAP_OVERFLOW;
+        ERROR_MESSAGE("%s(%s) - Computed stride is too large.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+    key_stride = (key_size_ + (key_align_ - 1)) & ~(key_align_ - 1);
+    value_stride = (value_size_ + (value_align_ - 1)) & ~(value_align_ - 1);
+
+    // HASH_MAP_MAX_ENTRY_COUNTの制約によりバケット数の計算はオーバーフローしない
+    min_capacity = max_entry_count_ + ((max_entry_count_ + 6U) / 7U);
+    while(capacity < min_capacity) {
+        capacity <<= 1U;
+    }
+    slot_count = capacity + HASH_MAP_SCRATCH_SLOT_COUNT;
+    if(SIZE_MAX / slot_count < key_stride || SIZE_MAX / slot_count < value_stride) {
+        ret = HASH_MAP_OVERFLOW;
+        ERROR_MESSAGE("%s(%s) - Provided key / value size and 'max_entry_count_' are too large.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    out_layout_->capacity = capacity;
+    out_layout_->key_stride = key_stride;
+    out_layout_->value_stride = value_stride;
+    out_layout_->bucket_array_size = sizeof(hash_map_bucket_t) * capacity;
+    out_layout_->key_array_size = key_stride * slot_count;
+    out_layout_->value_array_size = value_stride * slot_count;
+
+    ret = HASH_MAP_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリ確保済みのハッシュマップの管理変数を設定し、全バケットを空きにする(hash_map_create / hash_map_initialize共通処理)
+ *
+ * @note owns_memoryは呼び出し側で設定する
+ *
+ * @param[in] max_entry_count_ 格納可能な最大エントリ数
+ * @param[in] key_size_ キーのサイズ
+ * @param[in] key_align_ キーのアライメント要件
+ * @param[in] value_size_ 値のサイズ
+ * @param[in] value_align_ 値のアライメント要件
+ * @param[in] layout_ layout_computeで算出したメモリレイアウト
+ * @param[in,out] hash_map_ 設定対象ハッシュマップ(buckets, keys, valuesは確保済みであること)
+ */
+static void hash_map_setup(size_t max_entry_count_, size_t key_size_, size_t key_align_, size_t value_size_, size_t value_align_, const hash_map_layout_t* layout_, hash_map_t* hash_map_) {
+    hash_map_->key_size = key_size_;
+    hash_map_->key_align = key_align_;
+    hash_map_->value_size = value_size_;
+    hash_map_->value_align = value_align_;
+    hash_map_->max_entry_count = max_entry_count_;
+    hash_map_->count = 0;
+    hash_map_->layout = *layout_;
+    memset(hash_map_->buckets, 0, layout_->bucket_array_size);
+    memset(hash_map_->keys, 0, layout_->key_array_size);
+    memset(hash_map_->values, 0, layout_->value_array_size);
+}
+
+/**
+ * @brief キーのバイト列のハッシュ値をFNV-1a(32bit)で計算する
+ *
+ * @param[in] key_ 計算対象キー
+ * @param[in] key_size_ キーのサイズ
+ *
+ * @return uint32_t ハッシュ値
+ */
+static uint32_t key_hash(const void* key_, size_t key_size_) {
+    const unsigned char* bytes = (const unsigned char*)key_;
+    uint32_t hash = HASH_MAP_FNV_OFFSET_BASIS;
+    for(size_t i = 0; i != key_size_; ++i) {
+        hash ^= (uint32_t)bytes[i];
+        hash *= HASH_MAP_FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief キー配列のindex_番目のキーのアドレスを取得する
+ *
+ * @param[in] hash_map_ 対象ハッシュマップ
+ * @param[in] index_ バケットインデックス(作業用スロットを含む)
+ *
+ * @return void* キーのアドレス
+ */
+static void* key_at(const hash_map_t* hash_map_, size_t index_) {
+    return (char*)hash_map_->keys + (hash_map_->layout.key_stride * index_);
+}
+
+/**
+ * @brief 値配列のindex_番目の値のアドレスを取得する
+ *
+ * @param[in] hash_map_ 対象ハッシュマップ
+ * @param[in] index_ バケットインデックス(作業用スロットを含む)
+ *
+ * @return void* 値のアドレス
+ */
+static void* value_at(const hash_map_t* hash_map_, size_t index_) {
+    return (char*)hash_map_->values + (hash_map_->layout.value_stride * index_);
+}
+
+/**
+ * @brief src_番目のキー/値をdst_番目にコピーする(バケットのメタデータはコピーしない)
+ *
+ * @param[in] dst_ コピー先インデックス
+ * @param[in] src_ コピー元インデックス
+ * @param[in,out] hash_map_ 対象ハッシュマップ
+ */
+static void entry_copy(size_t dst_, size_t src_, hash_map_t* hash_map_) {
+    memcpy(key_at(hash_map_, dst_), key_at(hash_map_, src_), hash_map_->key_size);
+    memcpy(value_at(hash_map_, dst_), value_at(hash_map_, src_), hash_map_->value_size);
+}
+
+/**
+ * @brief key_が格納されているバケットを検索する
+ *
+ * @note
+ * - キーの比較はハッシュ値が一致したバケットに対してのみ行う
+ * - 探索距離が現在の探索距離より短いバケットに到達した場合、key_はそれ以降に存在しない(Robin Hood hashingの不変条件)
+ *
+ * @param[in] key_ 検索するキー
+ * @param[in] hash_ key_のハッシュ値
+ * @param[in] hash_map_ 検索対象ハッシュマップ
+ * @param[out] out_index_ 見つかったバケットのインデックスの格納先
+ *
+ * @retval true key_が見つかった
+ * @retval false key_は登録されていない(*out_index_は変更されない)
+ */
+static bool entry_find(const void* key_, uint32_t hash_, const hash_map_t* hash_map_, size_t* out_index_) {
+    const size_t mask = hash_map_->layout.capacity - 1;
+    size_t index = (size_t)hash_ & mask;
+    uint32_t distance = 1;
+
+    while(hash_map_->buckets[index].distance >= distance) {
+        if(hash_map_->buckets[index].hash == hash_ && 0 == memcmp(key_at(hash_map_, index), key_, hash_map_->key_size)) {
+            *out_index_ = index;
+            return true;
+        }
+        index = (index + 1) & mask;
+        distance++;
+    }
+    return false;
+}
+
+/**
+ * @brief メモリシステム実行結果コードをハッシュマップ実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return hash_map_result_t 変換されたハッシュマップ実行結果コード
+ */
+static hash_map_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return HASH_MAP_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return HASH_MAP_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return HASH_MAP_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return HASH_MAP_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return HASH_MAP_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return HASH_MAP_BAD_OPERATION;
+    default:
+        return HASH_MAP_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief リニアアロケータ実行結果コードをハッシュマップ実行結果コードに変換する
+ *
+ * @param[in] rslt_ リニアアロケータ実行結果コード
+ * @return hash_map_result_t 変換されたハッシュマップ実行結果コード
+ */
+static hash_map_result_t rslt_convert_linear_alloc(linear_allocator_result_t rslt_) {
+    switch(rslt_) {
+    case LINEAR_ALLOC_SUCCESS:
+        return HASH_MAP_SUCCESS;
+    case LINEAR_ALLOC_NO_MEMORY:
+        return HASH_MAP_NO_MEMORY;
+    case LINEAR_ALLOC_INVALID_ARGUMENT:
+        return HASH_MAP_INVALID_ARGUMENT;
+    default:
+        return HASH_MAP_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief ハッシュマップ内部データが破損しているかを判定する
+ *
+ * @warning 本関数は内部データ破損判定が目的であるため下記のチェックは行わない
+ * - 引数hash_map_のNULLチェック
+ * - 各バケットの探索距離の整合性チェック(O(1)で判定できないため)
+ *
+ * @param[in] hash_map_ 判定対象ハッシュマップ
+ *
+ * @retval true 以下のいずれか
+ * - 0 == hash_map_->key_size || 0 == hash_map_->value_size
+ * - hash_map_->key_align、hash_map_->value_alignが2のべき乗ではない、またはmax_align_tを超過
+ * - 0 == hash_map_->max_entry_count || hash_map_->max_entry_count > HASH_MAP_MAX_ENTRY_COUNT
+ * - hash_map_->count > hash_map_->max_entry_count
+ * - バケット数が2のべき乗ではない、または最大エントリ数以下
+ * - キー/値のストライドがサイズ未満、またはアライメント要件の倍数ではない
+ * - hash_map_->buckets == NULL || hash_map_->keys == NULL || hash_map_->values == NULL
+ * @retval false 内部データ破損なし
+ */
+static bool is_hash_map_corrupted(const hash_map_t* hash_map_) {
+#ifdef TEST_BUILD
+    s_test_config_is_hash_map_corrupted.call_count++;
+    if(s_test_config_is_hash_map_corrupted.fail_on_call != 0) {
+        if(s_test_config_is_hash_map_corrupted.call_count == s_test_config_is_hash_map_corrupted.fail_on_call) {
+            return s_test_config_is_hash_map_corrupted.forced_result;
+        }
+    }
+#endif
+    const hash_map_layout_t* layout = &hash_map_->layout;
+
+    if(0 == hash_map_->key_size || 0 == hash_map_->value_size) {
+        return true;
+    }
+    if(alignof(max_align_t) < hash_map_->key_align || !IS_POWER_OF_TWO(hash_map_->key_align)) {
+        return true;
+    }
+    if(alignof(max_align_t) < hash_map_->value_align || !IS_POWER_OF_TWO(hash_map_->value_align)) {
+        return true;
+    }
+    if(0 == hash_map_->max_entry_count || hash_map_->max_entry_count > HASH_MAP_MAX_ENTRY_COUNT || hash_map_->count > hash_map_->max_entry_count) {
+        return true;
+    }
+    if(!IS_POWER_OF_TWO(layout->capacity) || layout->capacity <= hash_map_->max_entry_count) {
+        return true;
+    }
+    if(layout->key_stride < hash_map_->key_size || 0 != (layout->key_stride % hash_map_->key_align)) {
+        return true;
+    }
+    if(layout->value_stride < hash_map_->value_size || 0 != (layout->value_stride % hash_map_->value_align)) {
+        return true;
+    }
+    if(NULL == hash_map_->buckets || NULL == hash_map_->keys || NULL == hash_map_->values) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief ハッシュマップ実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ ハッシュマップ実行結果コード
+ * @return const char* 変換された文字列
+ */
+static const char* rslt_to_str(hash_map_result_t rslt_) {
+    switch(rslt_) {
+    case HASH_MAP_SUCCESS:
+        return s_rslt_str_success;
+    case HASH_MAP_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case HASH_MAP_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case HASH_MAP_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case HASH_MAP_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case HASH_MAP_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case HASH_MAP_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case HASH_MAP_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case HASH_MAP_OVERFLOW:
+        return s_rslt_str_overflow;
+    case HASH_MAP_KEY_NOT_FOUND:
+        return s_rslt_str_key_not_found;
+    case HASH_MAP_KEY_EXISTS:
+        return s_rslt_str_key_exists;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_hash_map_create_config_set(const test_call_control_t* config_) {
+    s_test_config_hash_map_create.fail_on_call = config_->fail_on_call;
+    s_test_config_hash_map_create.forced_result = config_->forced_result;
+}
+
+void test_hash_map_initialize_config_set(const test_call_control_t* config_) {
+    s_test_config_hash_map_initialize.fail_on_call = config_->fail_on_call;
+    s_test_config_hash_map_initialize.forced_result = config_->forced_result;
+}
+
+void test_hash_map_insert_config_set(const test_call_control_t* config_) {
+    s_test_config_hash_map_insert.fail_on_call = config_->fail_on_call;
+    s_test_config_hash_map_insert.forced_result = config_->forced_result;
+}
+
+void test_hash_map_config_reset(void) {
+    test_call_control_reset(&s_test_config_hash_map_create);
+    test_call_control_reset(&s_test_config_hash_map_initialize);
+    test_call_control_reset(&s_test_config_hash_map_insert);
+
+    test_call_control_bool_reset(&s_test_config_is_hash_map_corrupted);
+}
+
+void test_hash_map(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_hash_map_create();
+    test_hash_map_preinit();
+    test_hash_map_initialize();
+    test_hash_map_destroy();
+    test_hash_map_insert();
+    test_hash_map_find();
+    test_hash_map_remove();
+    test_hash_map_clear();
+    test_hash_map_stress();
+    test_rslt_convert_mem_sys();
+    test_rslt_convert_linear_alloc();
+    test_is_hash_map_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+/**
+ * @brief テスト用にリニアアロケータとメモリプールを生成する
+ *
+ * @param[in] pool_size_ メモリプール容量
+ * @param[out] out_pool_ 生成したメモリプールの格納先(テスト終了時にfreeすること)
+ *
+ * @return linear_alloc_t* 初期化済みのリニアアロケータ(テスト終了時にfreeすること)
+ */
+static linear_alloc_t* NO_COVERAGE test_linear_allocator_make(size_t pool_size_, void** out_pool_) {
+    size_t mem_req = 0;
+    size_t align_req = 0;
+    linear_alloc_t* allocator = NULL;
+
+    linear_allocator_preinit(&mem_req, &align_req);
+    allocator = (linear_alloc_t*)malloc(mem_req);
+    assert(NULL != allocator);
+    *out_pool_ = malloc(pool_size_);
+    assert(NULL != *out_pool_);
+    assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(allocator, pool_size_, *out_pool_));
+    return allocator;
+}
+
+static void NO_COVERAGE test_hash_map_create(void) {
+    test_hash_map_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // hash_map_create() 冒頭で強制的に HASH_MAP_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        hash_map_t* hash_map = NULL;
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HASH_MAP_NO_MEMORY;
+        test_hash_map_create_config_set(&config);
+
+        assert(HASH_MAP_NO_MEMORY == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(NULL == hash_map);
+
+        test_hash_map_config_reset();
+    }
+    {
+        // 引数異常 -> HASH_MAP_INVALID_ARGUMENT
+        hash_map_t dummy = {0};
+        hash_map_t* hash_map = &dummy;
+
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), NULL));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(&dummy == hash_map);
+
+        hash_map = NULL;
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(0U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(HASH_MAP_MAX_ENTRY_COUNT + 1U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, 0U, alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), 0U, sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), 3U, sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(max_align_t) * 2U, sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), 0U, alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), 0U, &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), 6U, &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(max_align_t) * 2U, &hash_map));
+        assert(NULL == hash_map);
+    }
+    {
+        // キー/値配列サイズのオーバーフロー -> HASH_MAP_OVERFLOW
+        hash_map_t* hash_map = NULL;
+
+        assert(HASH_MAP_OVERFLOW == hash_map_create(4U, SIZE_MAX, 8U, sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_OVERFLOW == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), SIZE_MAX / 4U, 1U, &hash_map));
+        assert(NULL == hash_map);
+    }
+    {
+        // メモリ確保失敗(1〜4回目) -> 確保済みのメモリを解放して HASH_MAP_NO_MEMORY
+        for(int i = 1; i <= 4; ++i) {
+            test_call_control_t config = {0};
+            hash_map_t* hash_map = NULL;
+
+            test_choco_memory_config_reset();
+            config.fail_on_call = (uint32_t)i;
+            config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+            test_memory_system_allocate_config_set(&config);
+
+            assert(HASH_MAP_NO_MEMORY == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+            assert(NULL == hash_map);
+        }
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系: バケット数は最大エントリ数の8/7倍以上の2のべき乗
+        hash_map_t* hash_map = NULL;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(7U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(NULL != hash_map);
+        assert(8U == hash_map->layout.capacity);
+        assert(0U == hash_map->count);
+        assert(7U == hash_map->max_entry_count);
+        assert(hash_map->owns_memory);
+        for(size_t i = 0; i != hash_map->layout.capacity; ++i) {
+            assert(0U == hash_map->buckets[i].distance);
+        }
+        hash_map_destroy(&hash_map);
+        assert(NULL == hash_map);
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(8U, sizeof(uint32_t), alignof(uint32_t), sizeof(double), alignof(double), &hash_map));
+        assert(16U == hash_map->layout.capacity);
+        assert(sizeof(double) == hash_map->layout.value_stride);
+        hash_map_destroy(&hash_map);
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(1U, 3U, 1U, 6U, 2U, &hash_map));
+        assert(2U == hash_map->layout.capacity);
+        assert(3U == hash_map->layout.key_stride);
+        assert(6U == hash_map->layout.value_stride);
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_preinit(void) {
+    test_hash_map_config_reset();
+    test_linear_allocator_config_reset();
+
+    {
+        // 引数異常 -> HASH_MAP_INVALID_ARGUMENT
+        size_t pool_size = 0;
+
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_preinit(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), NULL));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_preinit(0U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &pool_size));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_preinit(4U, sizeof(uint32_t), 3U, sizeof(int16_t), alignof(int16_t), &pool_size));
+        assert(0U == pool_size);
+    }
+    {
+        // 加算結果のオーバーフロー -> HASH_MAP_OVERFLOW
+        size_t pool_size = SIZE_MAX - 8U;
+
+        assert(HASH_MAP_OVERFLOW == hash_map_preinit(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &pool_size));
+    }
+    {
+        // 正常系: 算出した必要量でhash_map_initializeが過不足なく成功すること
+        static const size_t counts[] = { 1U, 7U, 100U, 1000U };
+        for(size_t i = 0; i != sizeof(counts) / sizeof(counts[0]); ++i) {
+            size_t pool_size = 0;
+            size_t marker = 0;
+            void* pool = NULL;
+            linear_alloc_t* allocator = NULL;
+            hash_map_t* hash_map = NULL;
+
+            assert(HASH_MAP_SUCCESS == hash_map_preinit(counts[i], sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &pool_size));
+            assert(0U != pool_size);
+
+            allocator = test_linear_allocator_make(pool_size, &pool);
+            assert(HASH_MAP_SUCCESS == hash_map_initialize(counts[i], sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, &hash_map));
+            assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(allocator, &marker));
+            assert(pool_size == marker);
+
+            free(pool);
+            free(allocator);
+        }
+    }
+}
+
+static void NO_COVERAGE test_hash_map_initialize(void) {
+    test_hash_map_config_reset();
+    test_linear_allocator_config_reset();
+
+    {
+        // hash_map_initialize() 冒頭で強制的に HASH_MAP_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        void* pool = NULL;
+        linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+        hash_map_t* hash_map = NULL;
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HASH_MAP_NO_MEMORY;
+        test_hash_map_initialize_config_set(&config);
+
+        assert(HASH_MAP_NO_MEMORY == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, &hash_map));
+        assert(NULL == hash_map);
+
+        test_hash_map_config_reset();
+        free(pool);
+        free(allocator);
+    }
+    {
+        // 引数異常 -> HASH_MAP_INVALID_ARGUMENT
+        void* pool = NULL;
+        linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+        hash_map_t dummy = {0};
+        hash_map_t* hash_map = &dummy;
+
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), NULL, &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, NULL));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, &hash_map));
+        assert(&dummy == hash_map);
+
+        hash_map = NULL;
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_initialize(0U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), 0U, alignof(int16_t), allocator, &hash_map));
+        assert(NULL == hash_map);
+
+        free(pool);
+        free(allocator);
+    }
+    {
+        // リニアアロケータの割り当て失敗(1〜4回目) -> HASH_MAP_NO_MEMORY
+        for(int i = 1; i <= 4; ++i) {
+            test_call_control_t config = {0};
+            void* pool = NULL;
+            linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+            hash_map_t* hash_map = NULL;
+
+            test_linear_allocator_config_reset();
+            config.fail_on_call = (uint32_t)i;
+            config.forced_result = (int)LINEAR_ALLOC_NO_MEMORY;
+            test_linear_allocator_allocate_config_set(&config);
+
+            assert(HASH_MAP_NO_MEMORY == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, &hash_map));
+            assert(NULL == hash_map);
+
+            test_linear_allocator_config_reset();
+            free(pool);
+            free(allocator);
+        }
+    }
+    {
+        // 正常系: リニアアロケータ上のハッシュマップに登録/検索でき、destroyはポインタのNULL化のみ行う
+        void* pool = NULL;
+        linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 42U;
+        int16_t value = 7;
+        int16_t* found = NULL;
+
+        assert(HASH_MAP_SUCCESS == hash_map_initialize(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), allocator, &hash_map));
+        assert(NULL != hash_map);
+        assert(!hash_map->owns_memory);
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&key, &value, hash_map));
+        assert(HASH_MAP_SUCCESS == hash_map_find(&key, hash_map, (void**)&found));
+        assert(7 == *found);
+
+        hash_map_destroy(&hash_map);
+        assert(NULL == hash_map);
+
+        free(pool);
+        free(allocator);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_destroy(void) {
+    test_hash_map_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // NULL / 2重デストロイ -> no-op
+        hash_map_t* hash_map = NULL;
+
+        hash_map_destroy(NULL);
+        hash_map_destroy(&hash_map);
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        hash_map_destroy(&hash_map);
+        assert(NULL == hash_map);
+        hash_map_destroy(&hash_map);
+        assert(NULL == hash_map);
+    }
+    {
+        // 内部データ破損 -> 配列は解放せず、構造体のみ解放する
+        hash_map_t* hash_map = NULL;
+        hash_map_bucket_t* buckets = NULL;
+        void* keys = NULL;
+        void* values = NULL;
+        hash_map_layout_t layout = {0};
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        buckets = hash_map->buckets;
+        keys = hash_map->keys;
+        values = hash_map->values;
+        layout = hash_map->layout;
+        hash_map->key_size = 0;
+
+        hash_map_destroy(&hash_map);
+        assert(NULL == hash_map);
+
+        memory_system_free(values, layout.value_array_size, MEMORY_TAG_CONTAINER);
+        memory_system_free(keys, layout.key_array_size, MEMORY_TAG_CONTAINER);
+        memory_system_free(buckets, layout.bucket_array_size, MEMORY_TAG_CONTAINER);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_insert(void) {
+    test_hash_map_config_reset();
+
+    {
+        // hash_map_insert() 冒頭で強制的に HASH_MAP_DATA_CORRUPTED を返させる
+        test_call_control_t config = {0};
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 1U;
+        int16_t value = 1;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HASH_MAP_DATA_CORRUPTED;
+        test_hash_map_insert_config_set(&config);
+
+        assert(HASH_MAP_DATA_CORRUPTED == hash_map_insert(&key, &value, hash_map));
+        assert(0U == hash_map_count(hash_map));
+
+        test_hash_map_config_reset();
+        hash_map_destroy(&hash_map);
+    }
+    {
+        // 引数異常 -> HASH_MAP_INVALID_ARGUMENT
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 1U;
+        int16_t value = 1;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_insert(NULL, &value, hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_insert(&key, NULL, hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_insert(&key, &value, NULL));
+        assert(0U == hash_map_count(hash_map));
+        hash_map_destroy(&hash_map);
+    }
+    {
+        // 内部データ破損 -> HASH_MAP_DATA_CORRUPTED
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 1U;
+        int16_t value = 1;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        test_hash_map_config_reset();
+        s_test_config_is_hash_map_corrupted.fail_on_call = 1U;
+        s_test_config_is_hash_map_corrupted.forced_result = true;
+        assert(HASH_MAP_DATA_CORRUPTED == hash_map_insert(&key, &value, hash_map));
+        test_hash_map_config_reset();
+        hash_map_destroy(&hash_map);
+    }
+    {
+        // 登録済みのキー -> HASH_MAP_KEY_EXISTS(値は変更されない)、満杯 -> HASH_MAP_LIMIT_EXCEEDED
+        hash_map_t* hash_map = NULL;
+        int16_t* found = NULL;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(7U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        for(uint32_t i = 0; i != 7U; ++i) {
+            const int16_t value = (int16_t)(i * 10U);
+            assert(HASH_MAP_SUCCESS == hash_map_insert(&i, &value, hash_map));
+            assert((size_t)(i + 1U) == hash_map_count(hash_map));
+        }
+        {
+            const uint32_t key = 3U;
+            const int16_t value = -1;
+            assert(HASH_MAP_KEY_EXISTS == hash_map_insert(&key, &value, hash_map));
+            assert(HASH_MAP_SUCCESS == hash_map_find(&key, hash_map, (void**)&found));
+            assert(30 == *found);
+        }
+        {
+            const uint32_t key = 100U;
+            const int16_t value = 100;
+            assert(HASH_MAP_LIMIT_EXCEEDED == hash_map_insert(&key, &value, hash_map));
+            assert(7U == hash_map_count(hash_map));
+        }
+        // 負荷率7/8の状態でも全てのキーが検索できること
+        for(uint32_t i = 0; i != 7U; ++i) {
+            assert(HASH_MAP_SUCCESS == hash_map_find(&i, hash_map, (void**)&found));
+            assert((int16_t)(i * 10U) == *found);
+        }
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_find(void) {
+    test_hash_map_config_reset();
+
+    {
+        // 引数異常 -> HASH_MAP_INVALID_ARGUMENT、内部データ破損 -> HASH_MAP_DATA_CORRUPTED
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 1U;
+        void* found = NULL;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_find(NULL, hash_map, &found));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_find(&key, NULL, &found));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_find(&key, hash_map, NULL));
+
+        test_hash_map_config_reset();
+        s_test_config_is_hash_map_corrupted.fail_on_call = 1U;
+        s_test_config_is_hash_map_corrupted.forced_result = true;
+        assert(HASH_MAP_DATA_CORRUPTED == hash_map_find(&key, hash_map, &found));
+        test_hash_map_config_reset();
+
+        // 未登録 -> HASH_MAP_KEY_NOT_FOUND(出力は変更されない)
+        assert(HASH_MAP_KEY_NOT_FOUND == hash_map_find(&key, hash_map, &found));
+        assert(NULL == found);
+        hash_map_destroy(&hash_map);
+    }
+    {
+        // 取得したポインタで値を書き換えられること
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 5U;
+        int16_t value = 1;
+        int16_t* found = NULL;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&key, &value, hash_map));
+        assert(HASH_MAP_SUCCESS == hash_map_find(&key, hash_map, (void**)&found));
+        *found = 9;
+        found = NULL;
+        assert(HASH_MAP_SUCCESS == hash_map_find(&key, hash_map, (void**)&found));
+        assert(9 == *found);
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_remove(void) {
+    test_hash_map_config_reset();
+
+    {
+        // 引数異常 -> HASH_MAP_INVALID_ARGUMENT、内部データ破損 -> HASH_MAP_DATA_CORRUPTED、未登録 -> HASH_MAP_KEY_NOT_FOUND
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 1U;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_remove(NULL, hash_map));
+        assert(HASH_MAP_INVALID_ARGUMENT == hash_map_remove(&key, NULL));
+
+        test_hash_map_config_reset();
+        s_test_config_is_hash_map_corrupted.fail_on_call = 1U;
+        s_test_config_is_hash_map_corrupted.forced_result = true;
+        assert(HASH_MAP_DATA_CORRUPTED == hash_map_remove(&key, hash_map));
+        test_hash_map_config_reset();
+
+        assert(HASH_MAP_KEY_NOT_FOUND == hash_map_remove(&key, hash_map));
+        hash_map_destroy(&hash_map);
+    }
+    {
+        // 満杯の状態から1つずつ削除し、残りのキーが常に検索できること(後続エントリの前詰め確認)
+        hash_map_t* hash_map = NULL;
+        int16_t* found = NULL;
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(7U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        for(uint32_t i = 0; i != 7U; ++i) {
+            const int16_t value = (int16_t)i;
+            assert(HASH_MAP_SUCCESS == hash_map_insert(&i, &value, hash_map));
+        }
+        for(uint32_t i = 0; i != 7U; ++i) {
+            assert(HASH_MAP_SUCCESS == hash_map_remove(&i, hash_map));
+            assert(HASH_MAP_KEY_NOT_FOUND == hash_map_remove(&i, hash_map));
+            assert((size_t)(6U - i) == hash_map_count(hash_map));
+            for(uint32_t j = i + 1U; j != 7U; ++j) {
+                assert(HASH_MAP_SUCCESS == hash_map_find(&j, hash_map, (void**)&found));
+                assert((int16_t)j == *found);
+            }
+        }
+        for(size_t i = 0; i != hash_map->layout.capacity; ++i) {
+            assert(0U == hash_map->buckets[i].distance);
+        }
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_clear(void) {
+    test_hash_map_config_reset();
+
+    {
+        hash_map_t* hash_map = NULL;
+        uint32_t key = 1U;
+        int16_t value = 1;
+        void* found = NULL;
+
+        hash_map_clear(NULL);
+        assert(0U == hash_map_count(NULL));
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&key, &value, hash_map));
+        hash_map_clear(hash_map);
+        assert(0U == hash_map_count(hash_map));
+        assert(HASH_MAP_KEY_NOT_FOUND == hash_map_find(&key, hash_map, &found));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&key, &value, hash_map));
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_hash_map_stress(void) {
+    test_hash_map_config_reset();
+
+    {
+        // 登録/削除を繰り返し、参照用の配列と内容が一致し続けること
+        enum { KEY_RANGE = 4096, MAX_ENTRY = 1000 };
+        static int32_t reference[KEY_RANGE];
+        hash_map_t* hash_map = NULL;
+        size_t count = 0;
+        uint32_t rng = 12345U;
+
+        for(size_t i = 0; i != KEY_RANGE; ++i) {
+            reference[i] = -1;
+        }
+        assert(HASH_MAP_SUCCESS == hash_map_create(MAX_ENTRY, sizeof(uint32_t), alignof(uint32_t), sizeof(int32_t), alignof(int32_t), &hash_map));
+        for(int step = 0; step != 20000; ++step) {
+            uint32_t key = 0;
+            int32_t* found = NULL;
+            rng = rng * 1103515245U + 12345U;
+            key = (rng >> 8U) % KEY_RANGE;
+            if(-1 == reference[key]) {
+                const int32_t value = (int32_t)step;
+                if(count < MAX_ENTRY) {
+                    assert(HASH_MAP_SUCCESS == hash_map_insert(&key, &value, hash_map));
+                    reference[key] = value;
+                    count++;
+                } else {
+                    assert(HASH_MAP_LIMIT_EXCEEDED == hash_map_insert(&key, &value, hash_map));
+                }
+            } else if(0 != (rng & 0x10000U)) {
+                assert(HASH_MAP_SUCCESS == hash_map_remove(&key, hash_map));
+                reference[key] = -1;
+                count--;
+            } else {
+                assert(HASH_MAP_SUCCESS == hash_map_find(&key, hash_map, (void**)&found));
+                assert(reference[key] == *found);
+            }
+            assert(count == hash_map_count(hash_map));
+        }
+        for(uint32_t key = 0; key != KEY_RANGE; ++key) {
+            int32_t* found = NULL;
+            if(-1 == reference[key]) {
+                assert(HASH_MAP_KEY_NOT_FOUND == hash_map_find(&key, hash_map, (void**)&found));
+            } else {
+                assert(HASH_MAP_SUCCESS == hash_map_find(&key, hash_map, (void**)&found));
+                assert(reference[key] == *found);
+            }
+        }
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(HASH_MAP_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(HASH_MAP_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(HASH_MAP_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(HASH_MAP_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(HASH_MAP_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(HASH_MAP_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(HASH_MAP_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)100));
+}
+
+static void NO_COVERAGE test_rslt_convert_linear_alloc(void) {
+    assert(HASH_MAP_SUCCESS == rslt_convert_linear_alloc(LINEAR_ALLOC_SUCCESS));
+    assert(HASH_MAP_NO_MEMORY == rslt_convert_linear_alloc(LINEAR_ALLOC_NO_MEMORY));
+    assert(HASH_MAP_INVALID_ARGUMENT == rslt_convert_linear_alloc(LINEAR_ALLOC_INVALID_ARGUMENT));
+    assert(HASH_MAP_UNDEFINED_ERROR == rslt_convert_linear_alloc((linear_allocator_result_t)100));
+}
+
+static void NO_COVERAGE test_is_hash_map_corrupted(void) {
+    test_hash_map_config_reset();
+
+    {
+        hash_map_t* hash_map = NULL;
+        hash_map_t backup = {0};
+
+        assert(HASH_MAP_SUCCESS == hash_map_create(4U, sizeof(uint32_t), alignof(uint32_t), sizeof(int16_t), alignof(int16_t), &hash_map));
+        backup = *hash_map;
+        assert(!is_hash_map_corrupted(hash_map));
+
+        hash_map->key_size = 0;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->value_size = 0;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->key_align = 3;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->value_align = alignof(max_align_t) * 2U;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->max_entry_count = 0;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->count = hash_map->max_entry_count + 1U;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->layout.capacity = 6U;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->layout.capacity = 4U;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->layout.key_stride = 2U;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->layout.value_stride = 3U;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->buckets = NULL;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->keys = NULL;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        hash_map->values = NULL;
+        assert(is_hash_map_corrupted(hash_map));
+        *hash_map = backup;
+
+        assert(!is_hash_map_corrupted(hash_map));
+        hash_map_destroy(&hash_map);
+    }
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(s_rslt_str_success == rslt_to_str(HASH_MAP_SUCCESS));
+    assert(s_rslt_str_invalid_argument == rslt_to_str(HASH_MAP_INVALID_ARGUMENT));
+    assert(s_rslt_str_no_memory == rslt_to_str(HASH_MAP_NO_MEMORY));
+    assert(s_rslt_str_runtime_error == rslt_to_str(HASH_MAP_RUNTIME_ERROR));
+    assert(s_rslt_str_undefined_error == rslt_to_str(HASH_MAP_UNDEFINED_ERROR));
+    assert(s_rslt_str_limit_exceeded == rslt_to_str(HASH_MAP_LIMIT_EXCEEDED));
+    assert(s_rslt_str_bad_operation == rslt_to_str(HASH_MAP_BAD_OPERATION));
+    assert(s_rslt_str_data_corrupted == rslt_to_str(HASH_MAP_DATA_CORRUPTED));
+    assert(s_rslt_str_overflow == rslt_to_str(HASH_MAP_OVERFLOW));
+    assert(s_rslt_str_key_not_found == rslt_to_str(HASH_MAP_KEY_NOT_FOUND));
+    assert(s_rslt_str_key_exists == rslt_to_str(HASH_MAP_KEY_EXISTS));
+    assert(s_rslt_str_undefined_error == rslt_to_str((hash_map_result_t)100));
+}
+#endif
@@ -0,0 +1,957 @@
+/** @ingroup containers
+ *
+ * @file mpmc_ring_queue.c
+ * @author chocolate-pie24
+ * @brief 複数プロデューサ/複数コンシューマ(MPMC)間でグローバルなロックを使用せずにデータを受け渡す、容量固定のジェネリック型リングキューモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset, memcpy
+
+#include "engine/containers/mpmc_ring_queue.h"
+
+#include "engine/core/memory/choco_memory.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <pthread.h>
+#include "engine/containers/test_mpmc_ring_queue.h"
+#include "engine/core/memory/test_choco_memory.h"
+
+// mpmc_ring_queueモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+// push/popは複数スレッドから並行して呼び出されるため、呼び出し回数を管理するテスト設定は持たない
+static test_call_control_t s_test_config_mpmc_ring_queue_create;    /**< mpmc_ring_queue_create()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_mpmc_ring_queue_create(void);
+static void test_mpmc_ring_queue_destroy(void);
+static void test_mpmc_ring_queue_push(void);
+static void test_mpmc_ring_queue_pop(void);
+static void test_mpmc_ring_queue_multithread(void);
+static void* test_mpmc_ring_queue_multithread_producer(void* arg_);
+static void* test_mpmc_ring_queue_multithread_consumer(void* arg_);
+static void test_rslt_convert_mem_sys(void);
+static void test_is_mpmc_ring_queue_corrupted(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief enqueue_pos/dequeue_posを別々のキャッシュラインに配置するために使用するキャッシュラインサイズ(byte)
+ *
+ * @note 構造体自体はmax_align_tでアライメントされるため、各領域の間に1キャッシュライン分の隙間を設けて分離する
+ *
+ */
+#define MPMC_RING_QUEUE_CACHE_LINE_SIZE 64
+
+/**
+ * @brief mpmc_ring_queue_t内部データ構造
+ *
+ * @note
+ * スロットiのシーケンス番号sequences[i]は以下の状態を表す(posはスロットiに対応する投入/取り出し位置)
+ * - sequences[i] == pos: 空きスロット。位置posの投入が書き込み可能
+ * - sequences[i] == pos + 1: 書き込み済みスロット。位置posの取り出しが読み出し可能
+ * - 読み出し完了時にpos + max_element_countを格納し、1周後の投入に備える
+ *
+ */
+struct mpmc_ring_queue {
+    // create後は変更しない領域(全スレッドが読み込む)
+    size_t element_align;       /**< リングキューに格納する要素のアライメント要件 */
+    size_t max_element_count;   /**< リングキューに格納可能な最大要素数(2のべき乗) */
+    size_t mask;                /**< 位置からスロットインデックスへの変換マスク(max_element_count - 1) */
+    size_t padding;             /**< 1要素ごとに必要なパディング量 */
+    size_t element_size;        /**< 格納要素のサイズ(パディングサイズを含まない実際の構造体のサイズ) */
+    size_t stride;              /**< 1要素に必要なメモリ領域(element_size + padding) */
+    size_t capacity;            /**< memory_poolのサイズ */
+    void* memory_pool;          /**< 要素を格納するバッファ */
+    atomic_size_t* sequences;   /**< 各スロットのシーケンス番号配列(要素数max_element_count) */
+    char shared_pad[MPMC_RING_QUEUE_CACHE_LINE_SIZE];   /**< 読み込み専用領域とプロデューサ領域を別キャッシュラインに分離するためのパディング */
+
+    atomic_size_t enqueue_pos;  /**< 次に投入する位置(プロデューサ間でCASにより確保する) */
+    char producer_pad[MPMC_RING_QUEUE_CACHE_LINE_SIZE]; /**< プロデューサ領域とコンシューマ領域を別キャッシュラインに分離するためのパディング */
+
+    atomic_size_t dequeue_pos;  /**< 次に取り出す位置(コンシューマ間でCASにより確保する) */
+    char consumer_pad[MPMC_RING_QUEUE_CACHE_LINE_SIZE]; /**< 後続のメモリ領域とコンシューマ領域を別キャッシュラインに分離するためのパディング */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< リングキューAPI実行結果コード(処理成功)に対応する文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< リングキューAPI実行結果コード(無効な引数)に対応する文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< リングキューAPI実行結果コード(メモリ不足)に対応する文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< リングキューAPI実行結果コード(実行時エラー)に対応する文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< リングキューAPI実行結果コード(未定義エラー)に対応する文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< リングキューAPI実行結果コード(システム使用可能範囲上限超過)に対応する文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< リングキューAPI実行結果コード(API誤用)に対応する文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< リングキューAPI実行結果コード(内部データ破損)に対応する文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< リングキューAPI実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
+static const char* const s_rslt_str_empty = "EMPTY";                        /**< リングキューAPI実行結果コード(キューが空)に対応する文字列 */
+static const char* const s_rslt_str_full = "FULL";                          /**< リングキューAPI実行結果コード(キューが満杯)に対応する文字列 */
+
+static bool is_mpmc_ring_queue_corrupted(const mpmc_ring_queue_t* mpmc_ring_queue_);
+static const char* rslt_to_str(ring_queue_result_t rslt_);
+static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+
+ring_queue_result_t mpmc_ring_queue_create(size_t max_element_count_, size_t element_size_, size_t element_align_, mpmc_ring_queue_t** mpmc_ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_mpmc_ring_queue_create.call_count++;
+    if(s_test_config_mpmc_ring_queue_create.fail_on_call != 0) {
+        if(s_test_config_mpmc_ring_queue_create.call_count == s_test_config_mpmc_ring_queue_create.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_mpmc_ring_queue_create.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    mpmc_ring_queue_t* tmp_queue = NULL;
+    size_t capacity = 0;
+    size_t stride = 0;
+    size_t padding = 0;
+    size_t diff = 0;
+    uintptr_t mem_pool_ptr = 0;
+    void* sequences_mem = NULL;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(mpmc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "mpmc_ring_queue_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*mpmc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "*mpmc_ring_queue_")
+    IF_ARG_FALSE_GOTO_CLEANUP(2 <= max_element_count_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "max_element_count_")   // 1スロットではシーケンス番号で空きと格納済みを区別できない
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(max_element_count_), ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "max_element_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(element_align_ > 0, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(element_align_), ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(element_align_ <= alignof(max_align_t), ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_create", "element_align_")
+
+    if(SIZE_MAX / sizeof(atomic_size_t) < max_element_count_) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Provided 'max_element_count_' is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // Simulation.
+    diff = element_size_ % element_align_;   // アライメントのズレ量
+    if(0 == diff) {
+        padding = 0;
+    } else {
+        if(element_size_ > element_align_) {
+            padding = element_align_ - diff;
+        } else {
+            padding = element_align_ - element_size_;
+        }
+    }
+    if((SIZE_MAX - padding) < element_size_) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Computed stride is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    stride = element_size_ + padding;
+    if(SIZE_MAX / max_element_count_ < stride) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Computed element stride is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    capacity = stride * max_element_count_;
+
+    ret_mem = memory_system_allocate(sizeof(*tmp_queue), MEMORY_TAG_RING_QUEUE, (void**)&tmp_queue);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Failed to allocate ring queue memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_queue, 0, sizeof(*tmp_queue));
+
+    ret_mem = memory_system_allocate(capacity, MEMORY_TAG_RING_QUEUE, &tmp_queue->memory_pool);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Failed to allocate memory pool memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_queue->memory_pool, 0, capacity);
+    mem_pool_ptr = (uintptr_t)tmp_queue->memory_pool;
+    if(0 != (mem_pool_ptr % element_align_)) {
+        ret = RING_QUEUE_RUNTIME_ERROR;
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Allocated memory pool alignment is invalid.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret_mem = memory_system_allocate(sizeof(atomic_size_t) * max_element_count_, MEMORY_TAG_RING_QUEUE, &sequences_mem);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("mpmc_ring_queue_create(%s) - Failed to allocate sequence memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    tmp_queue->sequences = (atomic_size_t*)sequences_mem;
+    for(size_t i = 0; i != max_element_count_; ++i) {
+        atomic_init(&tmp_queue->sequences[i], i);
+    }
+
+    tmp_queue->capacity = capacity;
+    tmp_queue->element_align = element_align_;
+    tmp_queue->element_size = element_size_;
+    tmp_queue->max_element_count = max_element_count_;
+    tmp_queue->mask = max_element_count_ - 1;
+    tmp_queue->padding = padding;
+    tmp_queue->stride = stride;
+    atomic_init(&tmp_queue->enqueue_pos, 0);
+    atomic_init(&tmp_queue->dequeue_pos, 0);
+
+    *mpmc_ring_queue_ = tmp_queue;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    if(RING_QUEUE_SUCCESS != ret) {
+        if(NULL != tmp_queue) {
+            if(NULL != tmp_queue->sequences) {  // 現状ではsequences確保以降にエラーを踏む経路はない
+                memory_system_free(tmp_queue->sequences, sizeof(atomic_size_t) * max_element_count_, MEMORY_TAG_RING_QUEUE);
+                tmp_queue->sequences = NULL;
+            }
+            if(NULL != tmp_queue->memory_pool) {
+                memory_system_free(tmp_queue->memory_pool, capacity, MEMORY_TAG_RING_QUEUE);
+                tmp_queue->memory_pool = NULL;
+            }
+            memory_system_free(tmp_queue, sizeof(*tmp_queue), MEMORY_TAG_RING_QUEUE);
+            tmp_queue = NULL;
+        }
+    }
+    return ret;
+}
+
+void mpmc_ring_queue_destroy(mpmc_ring_queue_t** mpmc_ring_queue_) {
+    if(NULL == mpmc_ring_queue_) {
+        goto cleanup;
+    }
+    if(NULL == *mpmc_ring_queue_) {
+        goto cleanup;
+    }
+    if(!is_mpmc_ring_queue_corrupted(*mpmc_ring_queue_)) { // 内部データが破損していた場合にfreeするのは危険
+        memory_system_free((*mpmc_ring_queue_)->sequences, sizeof(atomic_size_t) * (*mpmc_ring_queue_)->max_element_count, MEMORY_TAG_RING_QUEUE);
+        (*mpmc_ring_queue_)->sequences = NULL;
+        memory_system_free((*mpmc_ring_queue_)->memory_pool, (*mpmc_ring_queue_)->capacity, MEMORY_TAG_RING_QUEUE);
+        (*mpmc_ring_queue_)->memory_pool = NULL;
+    } else {
+        WARN_MESSAGE("mpmc_ring_queue_destroy - Provided mpmc_ring_queue_ is corrupted.");
+    }
+
+    memory_system_free(*mpmc_ring_queue_, sizeof(mpmc_ring_queue_t), MEMORY_TAG_RING_QUEUE);
+    *mpmc_ring_queue_ = NULL;
+cleanup:
+    return;
+}
+
+ring_queue_result_t mpmc_ring_queue_push(const void* data_, size_t element_size_, size_t element_align_, mpmc_ring_queue_t* mpmc_ring_queue_) {
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t pos = 0;
+    size_t slot = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(mpmc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_push", "mpmc_ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_push", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(mpmc_ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_push", "mpmc_ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(mpmc_ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_push", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(mpmc_ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_push", "element_align_")
+
+    if(is_mpmc_ring_queue_corrupted(mpmc_ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("mpmc_ring_queue_push(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // 投入位置の確保
+    pos = atomic_load_explicit(&mpmc_ring_queue_->enqueue_pos, memory_order_relaxed);
+    while(true) {
+        size_t seq = 0;
+        intptr_t seq_diff = 0;
+
+        slot = pos & mpmc_ring_queue_->mask;
+        seq = atomic_load_explicit(&mpmc_ring_queue_->sequences[slot], memory_order_acquire);  // コンシューマによるスロット読み出し完了を保証する
+        seq_diff = (intptr_t)(seq - pos);
+        if(0 == seq_diff) {
+            // スロットは書き込み可能。他のプロデューサより先に位置を確保できれば書き込む(失敗時はposが最新値に更新される)
+            if(atomic_compare_exchange_weak_explicit(&mpmc_ring_queue_->enqueue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if(seq_diff < 0) {
+            // 1周前の位置のデータがまだ取り出されていない
+            ret = RING_QUEUE_FULL;
+            goto cleanup;
+        } else {
+            // 他のプロデューサが先に位置を確保した
+            pos = atomic_load_explicit(&mpmc_ring_queue_->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy((char*)mpmc_ring_queue_->memory_pool + (slot * mpmc_ring_queue_->stride), data_, mpmc_ring_queue_->element_size);
+    atomic_store_explicit(&mpmc_ring_queue_->sequences[slot], pos + 1, memory_order_release);  // スロットへの書き込みをコンシューマに公開
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t mpmc_ring_queue_pop(size_t element_size_, size_t element_align_, mpmc_ring_queue_t* mpmc_ring_queue_, void* data_) {
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t pos = 0;
+    size_t slot = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(mpmc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_pop", "mpmc_ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_pop", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(mpmc_ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_pop", "mpmc_ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(mpmc_ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_pop", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(mpmc_ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "mpmc_ring_queue_pop", "element_align_")
+
+    if(is_mpmc_ring_queue_corrupted(mpmc_ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("mpmc_ring_queue_pop(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // 取り出し位置の確保
+    pos = atomic_load_explicit(&mpmc_ring_queue_->dequeue_pos, memory_order_relaxed);
+    while(true) {
+        size_t seq = 0;
+        intptr_t seq_diff = 0;
+
+        slot = pos & mpmc_ring_queue_->mask;
+        seq = atomic_load_explicit(&mpmc_ring_queue_->sequences[slot], memory_order_acquire);  // プロデューサによるスロット書き込み完了を保証する
+        seq_diff = (intptr_t)(seq - (pos + 1));
+        if(0 == seq_diff) {
+            // スロットは読み出し可能。他のコンシューマより先に位置を確保できれば読み出す(失敗時はposが最新値に更新される)
+            if(atomic_compare_exchange_weak_explicit(&mpmc_ring_queue_->dequeue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if(seq_diff < 0) {
+            // 位置posのデータがまだ書き込まれていない
+            ret = RING_QUEUE_EMPTY;
+            goto cleanup;
+        } else {
+            // 他のコンシューマが先に位置を確保した
+            pos = atomic_load_explicit(&mpmc_ring_queue_->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(data_, (const char*)mpmc_ring_queue_->memory_pool + (slot * mpmc_ring_queue_->stride), mpmc_ring_queue_->element_size);
+    atomic_store_explicit(&mpmc_ring_queue_->sequences[slot], pos + mpmc_ring_queue_->max_element_count, memory_order_release); // 1周後の投入に対してスロットを解放する
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリシステム実行結果コードをリングキュー実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return ring_queue_result_t 変換されたリングキュー実行結果コード
+ */
+static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return RING_QUEUE_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return RING_QUEUE_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return RING_QUEUE_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return RING_QUEUE_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return RING_QUEUE_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return RING_QUEUE_BAD_OPERATION;
+    default:
+        return RING_QUEUE_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief MPMCリングキューの内部データ破損チェックを行う
+ *
+ * @note
+ * - create後に変更されない領域のみをチェックする(enqueue_pos、dequeue_pos、sequencesは並行して更新されるため、整合性をチェックできない)
+ * - 並行して呼び出されるため、テスト用の強制返却設定は持たない(テストでは内部データを直接破損させる)
+ *
+ * 破損と判定する条件は以下
+ * - element_align, max_element_count, element_size, stride, capacityのいずれかが0
+ * - max_element_count < 2、max_element_countが2のべき乗ではない、またはmask != max_element_count - 1
+ * - stride % element_align != 0
+ * - padding >= element_align
+ * - stride != element_size + padding
+ * - element_alignがmax_align_tを超過、または2のべき乗ではない
+ * - capacity != stride * max_element_count
+ * - memory_pool == NULL、またはsequences == NULL
+ *
+ * @param[in] mpmc_ring_queue_ チェック対象MPMCリングキュー構造体インスタンスへのポインタ
+ *
+ * @retval true 内部データ破損
+ * @retval false 内部データは正常
+ */
+static bool is_mpmc_ring_queue_corrupted(const mpmc_ring_queue_t* mpmc_ring_queue_) {
+    if(0 == mpmc_ring_queue_->element_align || 0 == mpmc_ring_queue_->max_element_count || 0 == mpmc_ring_queue_->element_size || 0 == mpmc_ring_queue_->stride || 0 == mpmc_ring_queue_->capacity) {
+        return true;
+    }
+    if(2 > mpmc_ring_queue_->max_element_count || !IS_POWER_OF_TWO(mpmc_ring_queue_->max_element_count) || mpmc_ring_queue_->mask != mpmc_ring_queue_->max_element_count - 1) {
+        return true;
+    }
+    if(0 != (mpmc_ring_queue_->stride % mpmc_ring_queue_->element_align)) {
+        return true;
+    }
+    if(mpmc_ring_queue_->padding >= mpmc_ring_queue_->element_align) {
+        return true;
+    }
+    if(mpmc_ring_queue_->stride != (mpmc_ring_queue_->element_size + mpmc_ring_queue_->padding)) {
+        return true;
+    }
+    if(alignof(max_align_t) < mpmc_ring_queue_->element_align || !IS_POWER_OF_TWO(mpmc_ring_queue_->element_align)) {
+        return true;
+    }
+    if(mpmc_ring_queue_->capacity != mpmc_ring_queue_->stride * mpmc_ring_queue_->max_element_count) {
+        return true;
+    }
+    if(NULL == mpmc_ring_queue_->memory_pool || NULL == mpmc_ring_queue_->sequences) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief リングキュー実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 変換対象実行結果コード
+ * @return const char* 変換された文字列(想定外の実行結果コードの場合はUNDEFINED_ERROR)
+ */
+static const char* rslt_to_str(ring_queue_result_t rslt_) {
+    switch(rslt_) {
+    case RING_QUEUE_SUCCESS:
+        return s_rslt_str_success;
+    case RING_QUEUE_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case RING_QUEUE_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case RING_QUEUE_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case RING_QUEUE_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case RING_QUEUE_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case RING_QUEUE_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case RING_QUEUE_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case RING_QUEUE_OVERFLOW:
+        return s_rslt_str_overflow;
+    case RING_QUEUE_EMPTY:
+        return s_rslt_str_empty;
+    case RING_QUEUE_FULL:
+        return s_rslt_str_full;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+/**
+ * @brief マルチスレッドテストで使用するプロデューサ/コンシューマスレッド数
+ *
+ */
+#define TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT 4U
+
+/**
+ * @brief マルチスレッドテストで各プロデューサスレッドからpushする要素数
+ *
+ */
+#define TEST_MPMC_RING_QUEUE_MT_ELEMENT_COUNT 20000U
+
+/**
+ * @brief マルチスレッドテストのコンシューマスレッド引数
+ *
+ */
+typedef struct test_mpmc_consumer_arg {
+    mpmc_ring_queue_t* queue;   /**< 取り出し対象キュー */
+    atomic_size_t* remaining;   /**< 全コンシューマで未取り出しの要素数 */
+    uint64_t sum;               /**< 取り出した値の合計 */
+} test_mpmc_consumer_arg_t;
+
+/**
+ * @brief マルチスレッドテストのプロデューサスレッド引数
+ *
+ */
+typedef struct test_mpmc_producer_arg {
+    mpmc_ring_queue_t* queue;   /**< 投入対象キュー */
+    uint64_t producer_id;       /**< プロデューサ識別番号(値の上位32bitに格納する) */
+} test_mpmc_producer_arg_t;
+
+void test_mpmc_ring_queue_create_config_set(const test_call_control_t* config_) {
+    s_test_config_mpmc_ring_queue_create.fail_on_call = config_->fail_on_call;
+    s_test_config_mpmc_ring_queue_create.forced_result = config_->forced_result;
+}
+
+void test_mpmc_ring_queue_config_reset(void) {
+    test_call_control_reset(&s_test_config_mpmc_ring_queue_create);
+}
+
+void test_mpmc_ring_queue(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_mpmc_ring_queue_create();
+    test_mpmc_ring_queue_destroy();
+    test_mpmc_ring_queue_push();
+    test_mpmc_ring_queue_pop();
+    test_mpmc_ring_queue_multithread();
+    test_rslt_convert_mem_sys();
+    test_is_mpmc_ring_queue_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_mpmc_ring_queue_create(void) {
+    test_mpmc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // mpmc_ring_queue_create() 冒頭で強制的に RING_QUEUE_NO_MEMORY を返させる
+        mpmc_ring_queue_t* queue = NULL;
+        test_call_control_t config = {0};
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_NO_MEMORY;
+        test_mpmc_ring_queue_create_config_set(&config);
+
+        assert(RING_QUEUE_NO_MEMORY == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(NULL == queue);
+
+        test_mpmc_ring_queue_config_reset();
+    }
+    {
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT
+        mpmc_ring_queue_t* queue = NULL;
+        mpmc_ring_queue_t* not_null = (mpmc_ring_queue_t*)(uintptr_t)0x1U;
+
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &not_null));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(0U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(1U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(3U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(4U, 0U, alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(4U, sizeof(uint32_t), 0U, &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(4U, sizeof(uint32_t), 3U, &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(max_align_t) * 2U, &queue));
+        assert(NULL == queue);
+    }
+    {
+        // 計算過程のオーバーフロー -> RING_QUEUE_OVERFLOW
+        mpmc_ring_queue_t* queue = NULL;
+        const size_t huge_count = ((size_t)1U << (sizeof(size_t) * 8U - 1U));
+
+        assert(RING_QUEUE_OVERFLOW == mpmc_ring_queue_create(huge_count, 1U, 1U, &queue));
+        assert(RING_QUEUE_OVERFLOW == mpmc_ring_queue_create(2U, SIZE_MAX, 8U, &queue));
+        assert(RING_QUEUE_OVERFLOW == mpmc_ring_queue_create(4U, SIZE_MAX / 2U, 8U, &queue));
+        assert(NULL == queue);
+    }
+    {
+        // 依存先 memory_system_allocate() の1〜3回目を失敗させる
+        mpmc_ring_queue_t* queue = NULL;
+        test_call_control_t config = {0};
+
+        for(uint32_t i = 1U; i <= 3U; ++i) {
+            test_choco_memory_config_reset();
+            test_call_control_reset(&config);
+            config.fail_on_call = i;
+            config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+            test_memory_system_allocate_config_set(&config);
+
+            assert(RING_QUEUE_NO_MEMORY == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+            assert(NULL == queue);
+        }
+
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系（padding != 0）、enqueue_pos/dequeue_posが別キャッシュラインに配置される
+        mpmc_ring_queue_t* queue = NULL;
+        uintptr_t shared_end = 0U;
+        uintptr_t enqueue_begin = 0U;
+        uintptr_t enqueue_end = 0U;
+        uintptr_t dequeue_begin = 0U;
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, 1U, 4U, &queue));
+        assert(NULL != queue);
+        assert(4U == queue->element_align);
+        assert(4U == queue->max_element_count);
+        assert(3U == queue->mask);
+        assert(3U == queue->padding);
+        assert(1U == queue->element_size);
+        assert(4U == queue->stride);
+        assert(16U == queue->capacity);
+        assert(NULL != queue->memory_pool);
+        assert(NULL != queue->sequences);
+        for(size_t i = 0U; i != 4U; ++i) {
+            assert(i == atomic_load_explicit(&queue->sequences[i], memory_order_relaxed));
+        }
+        assert(0U == atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed));
+        assert(0U == atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed));
+
+        shared_end = (uintptr_t)&queue->sequences + sizeof(queue->sequences);
+        enqueue_begin = (uintptr_t)&queue->enqueue_pos;
+        enqueue_end = enqueue_begin + sizeof(queue->enqueue_pos);
+        dequeue_begin = (uintptr_t)&queue->dequeue_pos;
+        assert((enqueue_begin - shared_end) >= MPMC_RING_QUEUE_CACHE_LINE_SIZE);
+        assert((dequeue_begin - enqueue_end) >= MPMC_RING_QUEUE_CACHE_LINE_SIZE);
+
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+
+    test_mpmc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_mpmc_ring_queue_destroy(void) {
+    {
+        // NULL、2重デストロイ
+        mpmc_ring_queue_t* queue = NULL;
+
+        mpmc_ring_queue_destroy(NULL);
+        mpmc_ring_queue_destroy(&queue);
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+    {
+        // 内部データ破損時はメモリプール、シーケンス配列を解放せず、構造体のみ解放する
+        mpmc_ring_queue_t* queue = NULL;
+        void* memory_pool = NULL;
+        atomic_size_t* sequences = NULL;
+        size_t capacity = 0U;
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        memory_pool = queue->memory_pool;
+        sequences = queue->sequences;
+        capacity = queue->capacity;
+        queue->mask = 0U;
+
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+
+        memory_system_free(memory_pool, capacity, MEMORY_TAG_RING_QUEUE);
+        memory_system_free(sequences, sizeof(atomic_size_t) * 4U, MEMORY_TAG_RING_QUEUE);
+    }
+}
+
+static void NO_COVERAGE test_mpmc_ring_queue_push(void) {
+    {
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT、内部データ破損 -> RING_QUEUE_DATA_CORRUPTED
+        mpmc_ring_queue_t* queue = NULL;
+        void* saved_memory_pool = NULL;
+        const uint32_t value = 1U;
+
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL));
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_push(NULL, sizeof(uint32_t), alignof(uint32_t), queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_push(&value, sizeof(uint16_t), alignof(uint32_t), queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint16_t), queue));
+
+        saved_memory_pool = queue->memory_pool;
+        queue->memory_pool = NULL;
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+        queue->memory_pool = saved_memory_pool;
+
+        queue->mask = 0U;
+        assert(RING_QUEUE_DATA_CORRUPTED == mpmc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+        queue->mask = 3U;
+
+        assert(0U == atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed));
+
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+    {
+        // 満杯 -> RING_QUEUE_FULL(上書きしない)、1つpopすると再びpushできる
+        mpmc_ring_queue_t* queue = NULL;
+        uint32_t out = 0U;
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        for(uint32_t i = 1U; i <= 4U; ++i) {
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_push(&i, sizeof(uint32_t), alignof(uint32_t), queue));
+        }
+        {
+            const uint32_t value = 5U;
+            assert(RING_QUEUE_FULL == mpmc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+            assert(4U == atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed));
+
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+            assert(1U == out);
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+            assert(5U == atomic_load_explicit(&queue->sequences[0], memory_order_relaxed));
+        }
+
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+}
+
+static void NO_COVERAGE test_mpmc_ring_queue_pop(void) {
+    {
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT、内部データ破損 -> RING_QUEUE_DATA_CORRUPTED、空 -> RING_QUEUE_EMPTY
+        mpmc_ring_queue_t* queue = NULL;
+        void* saved_memory_pool = NULL;
+        uint32_t out = 0U;
+
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out));
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, NULL));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_pop(sizeof(uint16_t), alignof(uint32_t), queue, &out));
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint16_t), queue, &out));
+
+        saved_memory_pool = queue->memory_pool;
+        queue->memory_pool = NULL;
+        assert(RING_QUEUE_INVALID_ARGUMENT == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        queue->memory_pool = saved_memory_pool;
+
+        queue->mask = 0U;
+        assert(RING_QUEUE_DATA_CORRUPTED == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        queue->mask = 3U;
+
+        assert(RING_QUEUE_EMPTY == mpmc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        assert(0U == out);
+
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+    {
+        // 正常系: padding を含む要素で折り返しを繰り返しても FIFO で取り出せる
+        mpmc_ring_queue_t* queue = NULL;
+        uint8_t out = 0U;
+
+        assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint8_t), 4U, &queue));
+        for(uint8_t i = 0U; i != 10U; ++i) {
+            const uint8_t value1 = (uint8_t)(i * 3U);
+            const uint8_t value2 = (uint8_t)(i * 3U + 1U);
+            const uint8_t value3 = (uint8_t)(i * 3U + 2U);
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_push(&value1, sizeof(uint8_t), 4U, queue));
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_push(&value2, sizeof(uint8_t), 4U, queue));
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_push(&value3, sizeof(uint8_t), 4U, queue));
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+            assert(value1 == out);
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+            assert(value2 == out);
+            assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+            assert(value3 == out);
+        }
+        assert(RING_QUEUE_EMPTY == mpmc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+
+        mpmc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+}
+
+static void NO_COVERAGE test_mpmc_ring_queue_multithread(void) {
+    // 複数プロデューサがpushした値を複数コンシューマが欠落、重複なく受け取れること
+    mpmc_ring_queue_t* queue = NULL;
+    pthread_t producers[TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT];
+    pthread_t consumers[TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT];
+    test_mpmc_producer_arg_t producer_args[TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT];
+    test_mpmc_consumer_arg_t consumer_args[TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT];
+    atomic_size_t remaining;
+    uint64_t sum = 0U;
+    uint64_t expected_sum = 0U;
+
+    assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(64U, sizeof(uint64_t), alignof(uint64_t), &queue));
+    atomic_init(&remaining, (size_t)TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT * TEST_MPMC_RING_QUEUE_MT_ELEMENT_COUNT);
+
+    for(uint32_t i = 0U; i != TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT; ++i) {
+        consumer_args[i].queue = queue;
+        consumer_args[i].remaining = &remaining;
+        consumer_args[i].sum = 0U;
+        assert(0 == pthread_create(&consumers[i], NULL, test_mpmc_ring_queue_multithread_consumer, &consumer_args[i]));
+    }
+    for(uint32_t i = 0U; i != TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT; ++i) {
+        producer_args[i].queue = queue;
+        producer_args[i].producer_id = i;
+        assert(0 == pthread_create(&producers[i], NULL, test_mpmc_ring_queue_multithread_producer, &producer_args[i]));
+    }
+    for(uint32_t i = 0U; i != TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT; ++i) {
+        assert(0 == pthread_join(producers[i], NULL));
+    }
+    for(uint32_t i = 0U; i != TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT; ++i) {
+        assert(0 == pthread_join(consumers[i], NULL));
+        sum += consumer_args[i].sum;
+    }
+
+    for(uint64_t p = 0U; p != TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT; ++p) {
+        for(uint64_t i = 0U; i != TEST_MPMC_RING_QUEUE_MT_ELEMENT_COUNT; ++i) {
+            expected_sum += (p << 32U) | i;
+        }
+    }
+    assert(expected_sum == sum);
+    assert(0U == atomic_load_explicit(&remaining, memory_order_relaxed));
+    {
+        uint64_t out = 0U;
+        assert(RING_QUEUE_EMPTY == mpmc_ring_queue_pop(sizeof(uint64_t), alignof(uint64_t), queue, &out));
+    }
+
+    mpmc_ring_queue_destroy(&queue);
+    assert(NULL == queue);
+}
+
+static void* NO_COVERAGE test_mpmc_ring_queue_multithread_producer(void* arg_) {
+    const test_mpmc_producer_arg_t* arg = (const test_mpmc_producer_arg_t*)arg_;
+
+    for(uint64_t i = 0U; i != TEST_MPMC_RING_QUEUE_MT_ELEMENT_COUNT; ++i) {
+        const uint64_t value = (arg->producer_id << 32U) | i;
+        ring_queue_result_t ret = RING_QUEUE_FULL;
+        while(RING_QUEUE_FULL == ret) {
+            ret = mpmc_ring_queue_push(&value, sizeof(uint64_t), alignof(uint64_t), arg->queue);
+        }
+        assert(RING_QUEUE_SUCCESS == ret);
+    }
+    return NULL;
+}
+
+static void* NO_COVERAGE test_mpmc_ring_queue_multithread_consumer(void* arg_) {
+    test_mpmc_consumer_arg_t* arg = (test_mpmc_consumer_arg_t*)arg_;
+    uint64_t last[TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT];
+    bool seen[TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT];
+
+    memset(last, 0, sizeof(last));
+    memset(seen, 0, sizeof(seen));
+    while(0U != atomic_load_explicit(arg->remaining, memory_order_relaxed)) {
+        uint64_t out = 0U;
+        const ring_queue_result_t ret = mpmc_ring_queue_pop(sizeof(uint64_t), alignof(uint64_t), arg->queue, &out);
+        if(RING_QUEUE_EMPTY == ret) {
+            continue;
+        }
+        assert(RING_QUEUE_SUCCESS == ret);
+        {
+            // 同一プロデューサの値は、1つのコンシューマから見て投入順に取り出される
+            const size_t producer_id = (size_t)(out >> 32U);
+            const uint64_t index = out & 0xFFFFFFFFU;
+            assert(producer_id < TEST_MPMC_RING_QUEUE_MT_THREAD_COUNT);
+            assert(!seen[producer_id] || last[producer_id] < index);
+            seen[producer_id] = true;
+            last[producer_id] = index;
+        }
+        arg->sum += out;
+        atomic_fetch_sub_explicit(arg->remaining, 1U, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(RING_QUEUE_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(RING_QUEUE_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(RING_QUEUE_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(RING_QUEUE_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(RING_QUEUE_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(RING_QUEUE_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(RING_QUEUE_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)999));
+}
+
+static void NO_COVERAGE test_is_mpmc_ring_queue_corrupted(void) {
+    mpmc_ring_queue_t* queue = NULL;
+    mpmc_ring_queue_t saved;
+
+    assert(RING_QUEUE_SUCCESS == mpmc_ring_queue_create(4U, sizeof(uint8_t), 4U, &queue));
+    assert(false == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(&saved, queue, sizeof(saved));
+
+    queue->element_align = 0U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->max_element_count = 3U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->max_element_count = 1U;
+    queue->mask = 0U;
+    queue->capacity = queue->stride;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->mask = 1U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->stride = 6U;
+    queue->padding = 5U;
+    queue->element_size = 1U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->padding = 4U;
+    queue->stride = 5U;
+    queue->element_align = 5U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->padding = 4U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->element_size = 2U;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->element_align = alignof(max_align_t) * 2U;
+    queue->stride = alignof(max_align_t) * 2U;
+    queue->padding = queue->stride - queue->element_size;
+    queue->capacity = queue->stride * queue->max_element_count;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->capacity++;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->memory_pool = NULL;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->sequences = NULL;
+    assert(true == is_mpmc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    assert(false == is_mpmc_ring_queue_corrupted(queue));
+    mpmc_ring_queue_destroy(&queue);
+    assert(NULL == queue);
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(0 == strcmp("SUCCESS", rslt_to_str(RING_QUEUE_SUCCESS)));
+    assert(0 == strcmp("INVALID_ARGUMENT", rslt_to_str(RING_QUEUE_INVALID_ARGUMENT)));
+    assert(0 == strcmp("NO_MEMORY", rslt_to_str(RING_QUEUE_NO_MEMORY)));
+    assert(0 == strcmp("RUNTIME_ERROR", rslt_to_str(RING_QUEUE_RUNTIME_ERROR)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str(RING_QUEUE_UNDEFINED_ERROR)));
+    assert(0 == strcmp("LIMIT_EXCEEDED", rslt_to_str(RING_QUEUE_LIMIT_EXCEEDED)));
+    assert(0 == strcmp("BAD_OPERATION", rslt_to_str(RING_QUEUE_BAD_OPERATION)));
+    assert(0 == strcmp("DATA_CORRUPTED", rslt_to_str(RING_QUEUE_DATA_CORRUPTED)));
+    assert(0 == strcmp("OVERFLOW", rslt_to_str(RING_QUEUE_OVERFLOW)));
+    assert(0 == strcmp("EMPTY", rslt_to_str(RING_QUEUE_EMPTY)));
+    assert(0 == strcmp("FULL", rslt_to_str(RING_QUEUE_FULL)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str((ring_queue_result_t)999)));
+}
+#endif
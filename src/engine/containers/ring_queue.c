@@ -31,6 +31,7 @@
 #ifdef TEST_BUILD
 // テスト時のみ使用するヘッダのinclude
 #include <assert.h>
+#include "engine/containers/ring_queue_typed.h"
 #include "engine/containers/test_ring_queue.h"
 #include "engine/core/memory/test_choco_memory.h"
 
@@ -38,8 +39,20 @@
 
 // 外部公開APIテスト設定
 static test_call_control_t s_test_config_ring_queue_create;     /**< ring_queue_create()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_create_pow2;    /**< ring_queue_create_pow2()テスト設定 */
 static test_call_control_t s_test_config_ring_queue_push;       /**< ring_queue_push()テスト設定 */
 static test_call_control_t s_test_config_ring_queue_pop;        /**< ring_queue_pop()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_push_unchecked; /**< ring_queue_push_unchecked()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_pop_unchecked;  /**< ring_queue_pop_unchecked()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_push_n;     /**< ring_queue_push_n()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_pop_n;      /**< ring_queue_pop_n()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_reserve;    /**< ring_queue_reserve()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_commit;     /**< ring_queue_commit()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_peek;       /**< ring_queue_peek()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_release;    /**< ring_queue_release()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_set_overflow_policy;    /**< ring_queue_set_overflow_policy()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_stats_get;  /**< ring_queue_stats_get()テスト設定 */
+static test_call_control_t s_test_config_ring_queue_stats_reset;    /**< ring_queue_stats_reset()テスト設定 */
 static test_call_control_bool_t s_test_config_ring_queue_empty; /**< ring_queue_empty()テスト設定 */
 
 // プライベート関数テスト設定
@@ -50,6 +63,14 @@ static void test_ring_queue_create(void);
 static void test_ring_queue_destroy(void);
 static void test_ring_queue_push(void);
 static void test_ring_queue_pop(void);
+static void test_ring_queue_create_pow2(void);
+static void test_ring_queue_unchecked(void);
+static void test_ring_queue_push_n(void);
+static void test_ring_queue_pop_n(void);
+static void test_ring_queue_reserve_commit(void);
+static void test_ring_queue_peek_release(void);
+static void test_ring_queue_overflow_policy(void);
+static void test_ring_queue_stats(void);
 static void test_ring_queue_empty(void);
 static void test_rslt_convert_mem_sys(void);
 static void test_is_ring_queue_corrupted(void);
@@ -71,6 +92,12 @@ struct ring_queue {
     size_t stride;              /**< 1要素に必要なメモリ領域(element_size + padding) */
     size_t capacity;            /**< memory_poolのサイズ */
     void* memory_pool;          /**< 要素を格納するバッファ */
+    size_t index_mask;          /**< max_element_countが2のべき乗(2以上)の場合はmax_element_count - 1、それ以外は0(インデックス更新をマスク演算で行うか否か) */
+    size_t grow_limit;          /**< RING_QUEUE_OVERFLOW_POLICY_GROW時の最大要素数の上限(それ以外のポリシーでは0) */
+    ring_queue_stats_t stats;   /**< 使用状況統計情報(max_element_countはring_queue_stats_get時に設定する) */
+    ring_queue_overflow_policy_t overflow_policy;   /**< 満杯時の溢れポリシー */
+    bool reserved;              /**< ring_queue_reserveで予約したスロット(tailの位置)がコミット待ちか */
+    bool peeked;                /**< ring_queue_peekで参照した要素(headの位置)がリリース待ちか */
 };
 
 static const char* const s_rslt_str_success = "SUCCESS";                    /**< リングキューAPI実行結果コード(処理成功)に対応する文字列 */
@@ -83,8 +110,18 @@ static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**<
 static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< リングキューAPI実行結果コード(内部データ破損)に対応する文字列 */
 static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< リングキューAPI実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
 static const char* const s_rslt_str_empty = "EMPTY";                        /**< リングキューAPI実行結果コード(キューが空)に対応する文字列 */
+static const char* const s_rslt_str_full = "FULL";                          /**< リングキューAPI実行結果コード(キューが満杯)に対応する文字列 */
 
 static bool is_ring_queue_corrupted(const ring_queue_t* ring_queue_);
+static bool is_overflow_policy_valid(ring_queue_overflow_policy_t policy_);
+static size_t index_advance(const ring_queue_t* ring_queue_, size_t index_, size_t step_);
+static size_t index_mask_of(size_t max_element_count_);
+static ring_queue_result_t make_room(size_t request_count_, ring_queue_t* ring_queue_, size_t* out_accept_count_);
+static ring_queue_result_t grow_pool(size_t new_element_count_, ring_queue_t* ring_queue_);
+static void record_push(size_t count_, ring_queue_t* ring_queue_);
+static void record_drop(size_t count_, ring_queue_t* ring_queue_);
+static void push_element(const void* data_, ring_queue_t* ring_queue_);
+static void pop_element(ring_queue_t* ring_queue_, void* data_);
 static const char* rslt_to_str(ring_queue_result_t rslt_);
 static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
 
@@ -176,6 +213,8 @@ ring_queue_result_t ring_queue_create(size_t max_element_count_, size_t element_
     tmp_queue->padding = padding;
     tmp_queue->stride = stride;
     tmp_queue->tail = 0;
+    tmp_queue->index_mask = index_mask_of(max_element_count_);
+    tmp_queue->overflow_policy = RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST;
 
     *ring_queue_ = tmp_queue;
 
@@ -195,6 +234,34 @@ cleanup:
     return ret;
 }
 
+ring_queue_result_t ring_queue_create_pow2(size_t max_element_count_, size_t element_size_, size_t element_align_, ring_queue_t** ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_create_pow2.call_count++;
+    if(s_test_config_ring_queue_create_pow2.fail_on_call != 0) {
+        if(s_test_config_ring_queue_create_pow2.call_count == s_test_config_ring_queue_create_pow2.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_create_pow2.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t rounded_count = 1;
+
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != max_element_count_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_create_pow2", "max_element_count_")
+    if(max_element_count_ > ((SIZE_MAX >> 1) + 1)) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("ring_queue_create_pow2(%s) - Provided 'max_element_count_' cannot be rounded up to a power of two.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    while(rounded_count < max_element_count_) {
+        rounded_count <<= 1;
+    }
+
+    ret = ring_queue_create(rounded_count, element_size_, element_align_, ring_queue_);
+
+cleanup:
+    return ret;
+}
+
 void ring_queue_destroy(ring_queue_t** ring_queue_) {
     if(NULL == ring_queue_) {
         goto cleanup;
@@ -227,8 +294,7 @@ ring_queue_result_t ring_queue_push(const void* data_, size_t element_size_, siz
     }
 #endif
     ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
-    char* mem_ptr = NULL;
-    char* target_ptr = NULL;
+    size_t accept_count = 0;
 
     IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push", "ring_queue_")
     IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push", "data_")
@@ -241,20 +307,25 @@ ring_queue_result_t ring_queue_push(const void* data_, size_t element_size_, siz
         ERROR_MESSAGE("ring_queue_push(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
         goto cleanup;
     }
-    if(ring_queue_->max_element_count == ring_queue_->len) {
-        DEBUG_MESSAGE("Ring queue is full; overwriting the oldest element.");
+    if(ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_push(%s) - A reserved slot has not been committed.", rslt_to_str(ret));
+        goto cleanup;
     }
-
-    mem_ptr = (char*)ring_queue_->memory_pool;
-    target_ptr = mem_ptr + (ring_queue_->stride * ring_queue_->tail);
-    memcpy(target_ptr, data_, ring_queue_->element_size);
-
-    ring_queue_->tail = (ring_queue_->tail + 1) % ring_queue_->max_element_count;
-    if(ring_queue_->len != ring_queue_->max_element_count) {
-        ring_queue_->len++;
-    } else {
-        ring_queue_->head = (ring_queue_->head + 1) % ring_queue_->max_element_count;
+    if(ring_queue_->peeked) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_push(%s) - A peeked element has not been released.", rslt_to_str(ret));
+        goto cleanup;
     }
+    ret = make_room(1, ring_queue_, &accept_count);
+    if(RING_QUEUE_SUCCESS != ret) {
+        goto cleanup;
+    }
+    if(0 == accept_count) {
+        ret = RING_QUEUE_FULL;
+        goto cleanup;
+    }
+    push_element(data_, ring_queue_);
 
     ret = RING_QUEUE_SUCCESS;
 
@@ -272,8 +343,6 @@ ring_queue_result_t ring_queue_pop(size_t element_size_, size_t element_align_,
     }
 #endif
     ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
-    char* mem_ptr = NULL;
-    char* head_ptr = NULL;
 
     IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop", "ring_queue_")
     IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop", "data_")
@@ -286,22 +355,23 @@ ring_queue_result_t ring_queue_pop(size_t element_size_, size_t element_align_,
         ERROR_MESSAGE("ring_queue_pop(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
         goto cleanup;
     }
+    if(ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_pop(%s) - A reserved slot has not been committed.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(ring_queue_->peeked) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_pop(%s) - A peeked element has not been released.", rslt_to_str(ret));
+        goto cleanup;
+    }
     if(ring_queue_empty(ring_queue_)) {
         DEBUG_MESSAGE("Ring queue is empty.");
         ret = RING_QUEUE_EMPTY;
         goto cleanup;
     }
 
-    mem_ptr = (char*)ring_queue_->memory_pool;
-    head_ptr = mem_ptr + (ring_queue_->head * ring_queue_->stride);
-    memcpy(data_, head_ptr, ring_queue_->element_size);
-    ring_queue_->len--;
-    ring_queue_->head = (ring_queue_->head + 1) % ring_queue_->max_element_count;
-
-    if(0 == ring_queue_->len) {
-        ring_queue_->head = 0;
-        ring_queue_->tail = 0;
-    }
+    pop_element(ring_queue_, data_);
 
     ret = RING_QUEUE_SUCCESS;
 
@@ -309,415 +379,2520 @@ cleanup:
     return ret;
 }
 
-bool ring_queue_empty(const ring_queue_t* ring_queue_) {
+ring_queue_result_t ring_queue_push_unchecked(const void* data_, ring_queue_t* ring_queue_) {
 #ifdef TEST_BUILD
-    s_test_config_ring_queue_empty.call_count++;
-    if(s_test_config_ring_queue_empty.fail_on_call != 0) {
-        if(s_test_config_ring_queue_empty.call_count == s_test_config_ring_queue_empty.fail_on_call) {
-            return s_test_config_ring_queue_empty.forced_result;
+    s_test_config_ring_queue_push_unchecked.call_count++;
+    if(s_test_config_ring_queue_push_unchecked.fail_on_call != 0) {
+        if(s_test_config_ring_queue_push_unchecked.call_count == s_test_config_ring_queue_push_unchecked.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_push_unchecked.forced_result;
         }
     }
 #endif
-    if(NULL == ring_queue_) {
-        return true;
-    } else if(NULL == ring_queue_->memory_pool) {
-        return true;
-    } else {
-        if(0 != ring_queue_->len) {
-            return false;
-        } else {
-            return true;
-        }
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t accept_count = 0;
+
+    if(ring_queue_->reserved) {
+        ERROR_MESSAGE("ring_queue_push_unchecked(%s) - A reserved slot has not been committed.", rslt_to_str(RING_QUEUE_BAD_OPERATION));
+        return RING_QUEUE_BAD_OPERATION;
+    }
+    if(ring_queue_->peeked) {
+        ERROR_MESSAGE("ring_queue_push_unchecked(%s) - A peeked element has not been released.", rslt_to_str(RING_QUEUE_BAD_OPERATION));
+        return RING_QUEUE_BAD_OPERATION;
+    }
+    ret = make_room(1, ring_queue_, &accept_count);
+    if(RING_QUEUE_SUCCESS != ret) {
+        return ret;
     }
+    if(0 == accept_count) {
+        return RING_QUEUE_FULL;
+    }
+    push_element(data_, ring_queue_);
+    return RING_QUEUE_SUCCESS;
 }
 
-/**
- * @brief メモリシステム実行結果コードをリングキュー実行結果コードに変換する
- *
- * @param[in] rslt_ メモリシステム実行結果コード
- * @return ring_queue_result_t 変換されたリングキュー実行結果コード
- */
-static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
-    switch(rslt_) {
-    case MEMORY_SYSTEM_SUCCESS:
-        return RING_QUEUE_SUCCESS;
-    case MEMORY_SYSTEM_INVALID_ARGUMENT:
-        return RING_QUEUE_INVALID_ARGUMENT;
-    case MEMORY_SYSTEM_RUNTIME_ERROR:
-        return RING_QUEUE_RUNTIME_ERROR;
-    case MEMORY_SYSTEM_NO_MEMORY:
-        return RING_QUEUE_NO_MEMORY;
-    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
-        return RING_QUEUE_LIMIT_EXCEEDED;
-    case MEMORY_SYSTEM_BAD_OPERATION:
+ring_queue_result_t ring_queue_pop_unchecked(ring_queue_t* ring_queue_, void* data_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_pop_unchecked.call_count++;
+    if(s_test_config_ring_queue_pop_unchecked.fail_on_call != 0) {
+        if(s_test_config_ring_queue_pop_unchecked.call_count == s_test_config_ring_queue_pop_unchecked.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_pop_unchecked.forced_result;
+        }
+    }
+#endif
+    if(ring_queue_->reserved) {
+        ERROR_MESSAGE("ring_queue_pop_unchecked(%s) - A reserved slot has not been committed.", rslt_to_str(RING_QUEUE_BAD_OPERATION));
+        return RING_QUEUE_BAD_OPERATION;
+    }
+    if(ring_queue_->peeked) {
+        ERROR_MESSAGE("ring_queue_pop_unchecked(%s) - A peeked element has not been released.", rslt_to_str(RING_QUEUE_BAD_OPERATION));
         return RING_QUEUE_BAD_OPERATION;
-    default:
-        return RING_QUEUE_UNDEFINED_ERROR;
     }
+    if(0 == ring_queue_->len) {
+        return RING_QUEUE_EMPTY;
+    }
+    pop_element(ring_queue_, data_);
+    return RING_QUEUE_SUCCESS;
 }
 
-/**
- * @brief リングキュー内部データが破損しているかを判定する
- *
- * @warning 本関数は内部データ破損判定が目的であるため下記のチェックは行わない
- * - 引数ring_queue_のNULLチェック
- *
- * @param[in] ring_queue_ 判定対象リングキュー
- *
- * @retval true 以下のいずれか
- * - 0 == ring_queue_->element_align
- * - 0 == ring_queue_->max_element_count
- * - 0 == ring_queue_->element_size
- * - 0 == ring_queue_->stride
- * - 0 == ring_queue_->capacity
- * - 0 != (ring_queue_->stride % ring_queue_->element_align)(1要素の格納に必要なメモリ領域は、格納要素のアライメント要件の倍数でなければアライメントできない)
- * - ring_queue_->padding >= ring_queue_->element_align(パディングサイズが要素のアライメント要件を超過することはない、最大でもアライメント要件-1)
- * - ring_queue_->stride != (ring_queue_->element_size + ring_queue_->padding)(1要素の格納に必要なメモリ領域が要素サイズ+パディングサイズではない)
- * - 0 == ring_queue_->len && 0 != ring_queue_->head(格納している要素数が0の時にheadが0になっていない)
- * - 0 == ring_queue_->len && 0 != ring_queue_->tail(格納している要素数が0の時にtailが0になっていない)
- * - (0 < ring_queue_->len && ring_queue_->max_element_count > ring_queue_->len) && ring_queue_->head == ring_queue_->tail(0 < len < max_element_countの時にhead==tailになるのはおかしい)
- * - ring_queue_->len == ring_queue_->max_element_count && ring_queue_->head != ring_queue_->tail(リングキューがfullの状態ではhead==tailになるはず)
- * - alignof(max_align_t) < ring_queue_->element_align || !IS_POWER_OF_TWO(ring_queue_->element_align)(アライメント要件が破損)
- * - ring_queue_->head >= ring_queue_->max_element_count
- * - ring_queue_->tail >= ring_queue_->max_element_count
- * - ring_queue_->len > ring_queue_->max_element_count
- * - ring_queue_->capacity != ring_queue_->stride * ring_queue_->max_element_count(メモリプール容量異常)
- * - ring_queue_->memory_pool == NULL(ring_queue_createでmemory_pool != NULLが保証されるため内部データ破損扱い)
- * @retval false 内部データ破損なし
- */
-static bool is_ring_queue_corrupted(const ring_queue_t* ring_queue_) {
+ring_queue_result_t ring_queue_push_n(const void* data_, size_t count_, size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_) {
 #ifdef TEST_BUILD
-    s_test_config_is_ring_queue_corrupted.call_count++;
-    if(s_test_config_is_ring_queue_corrupted.fail_on_call != 0) {
-        if(s_test_config_is_ring_queue_corrupted.call_count == s_test_config_is_ring_queue_corrupted.fail_on_call) {
-            return s_test_config_is_ring_queue_corrupted.forced_result;
+    s_test_config_ring_queue_push_n.call_count++;
+    if(s_test_config_ring_queue_push_n.fail_on_call != 0) {
+        if(s_test_config_ring_queue_push_n.call_count == s_test_config_ring_queue_push_n.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_push_n.forced_result;
         }
     }
 #endif
-    if(0 == ring_queue_->element_align || 0 == ring_queue_->max_element_count || 0 == ring_queue_->element_size || 0 == ring_queue_->stride || 0 == ring_queue_->capacity) {
-        return true;
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    const char* src_ptr = NULL;
+    char* mem_ptr = NULL;
+    size_t push_count = 0;
+    size_t accept_count = 0;
+    size_t first_count = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push_n", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push_n", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push_n", "ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push_n", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_push_n", "element_align_")
+
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_push_n(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
     }
-    if(0 != (ring_queue_->stride % ring_queue_->element_align)) {
-        return true;
+    if(ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_push_n(%s) - A reserved slot has not been committed.", rslt_to_str(ret));
+        goto cleanup;
     }
-    if(ring_queue_->padding >= ring_queue_->element_align) {
-        return true;
+    if(ring_queue_->peeked) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_push_n(%s) - A peeked element has not been released.", rslt_to_str(ret));
+        goto cleanup;
     }
-    if(ring_queue_->stride != (ring_queue_->element_size + ring_queue_->padding)) {
-        return true;
+    if(0 == count_) {
+        WARN_MESSAGE("ring_queue_push_n - No-op: count_ is 0.");
+        ret = RING_QUEUE_SUCCESS;
+        goto cleanup;
     }
-    if(0 == ring_queue_->len && 0 != ring_queue_->head) {
-        return true;
+
+    src_ptr = (const char*)data_;
+    push_count = count_;
+    if(RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST == ring_queue_->overflow_policy && push_count > ring_queue_->max_element_count) {
+        // 容量を超える入力は先頭側を捨て、末尾の容量分のみを格納する(1要素ずつpushした場合と同じ結果になる)
+        record_drop(push_count - ring_queue_->max_element_count, ring_queue_);
+        src_ptr += (push_count - ring_queue_->max_element_count) * ring_queue_->element_size;
+        push_count = ring_queue_->max_element_count;
     }
-    if(0 == ring_queue_->len && 0 != ring_queue_->tail) {
-        return true;
+    ret = make_room(push_count, ring_queue_, &accept_count);
+    if(RING_QUEUE_SUCCESS != ret) {
+        goto cleanup;
     }
-    if((0 < ring_queue_->len && ring_queue_->max_element_count > ring_queue_->len) && ring_queue_->head == ring_queue_->tail) {
-        return true;
+
+    mem_ptr = (char*)ring_queue_->memory_pool;
+    first_count = ring_queue_->max_element_count - ring_queue_->tail;
+    if(first_count > accept_count) {
+        first_count = accept_count;
     }
-    if(ring_queue_->len == ring_queue_->max_element_count && ring_queue_->head != ring_queue_->tail) {
-        return true;
+    if(0 == ring_queue_->padding) {
+        // stride == element_sizeのため、折り返し前後の連続領域をそれぞれ1回のmemcpyでコピーできる
+        memcpy(mem_ptr + (ring_queue_->tail * ring_queue_->stride), src_ptr, first_count * ring_queue_->element_size);
+        if(accept_count != first_count) {
+            memcpy(mem_ptr, src_ptr + (first_count * ring_queue_->element_size), (accept_count - first_count) * ring_queue_->element_size);
+        }
+    } else {
+        for(size_t i = 0; i != accept_count; ++i) {
+            const size_t index = index_advance(ring_queue_, ring_queue_->tail, i);
+            memcpy(mem_ptr + (index * ring_queue_->stride), src_ptr + (i * ring_queue_->element_size), ring_queue_->element_size);
+        }
     }
-    if(alignof(max_align_t) < ring_queue_->element_align || !IS_POWER_OF_TWO(ring_queue_->element_align)) {
-        return true;
+
+    ring_queue_->tail = index_advance(ring_queue_, ring_queue_->tail, accept_count);
+    ring_queue_->len += accept_count;
+    record_push(accept_count, ring_queue_);
+
+    ret = (accept_count == push_count) ? RING_QUEUE_SUCCESS : RING_QUEUE_FULL;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_pop_n(size_t max_count_, size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, void* data_, size_t* out_count_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_pop_n.call_count++;
+    if(s_test_config_ring_queue_pop_n.fail_on_call != 0) {
+        if(s_test_config_ring_queue_pop_n.call_count == s_test_config_ring_queue_pop_n.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_pop_n.forced_result;
+        }
     }
-    if(ring_queue_->head >= ring_queue_->max_element_count) {
-        return true;
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    char* dst_ptr = NULL;
+    char* mem_ptr = NULL;
+    size_t pop_count = 0;
+    size_t first_count = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_count_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "out_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != max_count_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "max_count_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_pop_n", "element_align_")
+
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_pop_n(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
     }
-    if(ring_queue_->tail >= ring_queue_->max_element_count) {
-        return true;
+    if(ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_pop_n(%s) - A reserved slot has not been committed.", rslt_to_str(ret));
+        goto cleanup;
     }
-    if(ring_queue_->len > ring_queue_->max_element_count) {
-        return true;
+    if(ring_queue_->peeked) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_pop_n(%s) - A peeked element has not been released.", rslt_to_str(ret));
+        goto cleanup;
     }
-    if(ring_queue_->capacity != ring_queue_->stride * ring_queue_->max_element_count) {
-        return true;
+    if(0 == ring_queue_->len) {
+        *out_count_ = 0;
+        ret = RING_QUEUE_EMPTY;
+        goto cleanup;
     }
-    if(NULL == ring_queue_->memory_pool) {
-        return true;
+
+    pop_count = (max_count_ < ring_queue_->len) ? max_count_ : ring_queue_->len;
+    first_count = ring_queue_->max_element_count - ring_queue_->head;
+    if(first_count > pop_count) {
+        first_count = pop_count;
+    }
+    dst_ptr = (char*)data_;
+    mem_ptr = (char*)ring_queue_->memory_pool;
+    if(0 == ring_queue_->padding) {
+        memcpy(dst_ptr, mem_ptr + (ring_queue_->head * ring_queue_->stride), first_count * ring_queue_->element_size);
+        if(pop_count != first_count) {
+            memcpy(dst_ptr + (first_count * ring_queue_->element_size), mem_ptr, (pop_count - first_count) * ring_queue_->element_size);
+        }
+    } else {
+        for(size_t i = 0; i != pop_count; ++i) {
+            const size_t index = index_advance(ring_queue_, ring_queue_->head, i);
+            memcpy(dst_ptr + (i * ring_queue_->element_size), mem_ptr + (index * ring_queue_->stride), ring_queue_->element_size);
+        }
     }
-    return false;
-}
 
-/**
- * @brief リングキュー実行結果コードを文字列に変換する
- *
- * @param[in] rslt_ リングキュー実行結果コード
- * @return const char* 変換された文字列
- */
-static const char* rslt_to_str(ring_queue_result_t rslt_) {
-    switch(rslt_) {
-    case RING_QUEUE_SUCCESS:
-        return s_rslt_str_success;
-    case RING_QUEUE_INVALID_ARGUMENT:
-        return s_rslt_str_invalid_argument;
-    case RING_QUEUE_NO_MEMORY:
-        return s_rslt_str_no_memory;
-    case RING_QUEUE_RUNTIME_ERROR:
-        return s_rslt_str_runtime_error;
-    case RING_QUEUE_UNDEFINED_ERROR:
-        return s_rslt_str_undefined_error;
-    case RING_QUEUE_LIMIT_EXCEEDED:
-        return s_rslt_str_limit_exceeded;
-    case RING_QUEUE_BAD_OPERATION:
-        return s_rslt_str_bad_operation;
-    case RING_QUEUE_DATA_CORRUPTED:
-        return s_rslt_str_data_corrupted;
-    case RING_QUEUE_OVERFLOW:
-        return s_rslt_str_overflow;
-    case RING_QUEUE_EMPTY:
-        return s_rslt_str_empty;
-    default:
-        return s_rslt_str_undefined_error;
+    ring_queue_->len -= pop_count;
+    ring_queue_->head = index_advance(ring_queue_, ring_queue_->head, pop_count);
+    if(0 == ring_queue_->len) {
+        ring_queue_->head = 0;
+        ring_queue_->tail = 0;
     }
+    *out_count_ = pop_count;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
 }
 
+ring_queue_result_t ring_queue_reserve(size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, void** out_slot_) {
 #ifdef TEST_BUILD
-void test_ring_queue_create_config_set(const test_call_control_t* config_) {
-    s_test_config_ring_queue_create.fail_on_call = config_->fail_on_call;
-    s_test_config_ring_queue_create.forced_result = config_->forced_result;
-}
+    s_test_config_ring_queue_reserve.call_count++;
+    if(s_test_config_ring_queue_reserve.fail_on_call != 0) {
+        if(s_test_config_ring_queue_reserve.call_count == s_test_config_ring_queue_reserve.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_reserve.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t accept_count = 0;
 
-void test_ring_queue_push_config_set(const test_call_control_t* config_) {
-    s_test_config_ring_queue_push.fail_on_call = config_->fail_on_call;
-    s_test_config_ring_queue_push.forced_result = config_->forced_result;
-}
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_reserve", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_slot_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_reserve", "out_slot_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_reserve", "ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_reserve", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_reserve", "element_align_")
 
-void test_ring_queue_pop_config_set(const test_call_control_t* config_) {
-    s_test_config_ring_queue_pop.fail_on_call = config_->fail_on_call;
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_reserve(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_reserve(%s) - A reserved slot has not been committed.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(ring_queue_->peeked) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_reserve(%s) - A peeked element has not been released.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    // 予約中のスロットと最古のデータが重ならないよう、溢れポリシーの適用は予約時点で行う
+    ret = make_room(1, ring_queue_, &accept_count);
+    if(RING_QUEUE_SUCCESS != ret) {
+        goto cleanup;
+    }
+    if(0 == accept_count) {
+        ret = RING_QUEUE_FULL;
+        goto cleanup;
+    }
+
+    ring_queue_->reserved = true;
+    *out_slot_ = (char*)ring_queue_->memory_pool + (ring_queue_->tail * ring_queue_->stride);
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_commit(ring_queue_t* ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_commit.call_count++;
+    if(s_test_config_ring_queue_commit.fail_on_call != 0) {
+        if(s_test_config_ring_queue_commit.call_count == s_test_config_ring_queue_commit.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_commit.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_commit", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_commit", "ring_queue_->memory_pool")
+
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_commit(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(!ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_commit(%s) - No slot has been reserved.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ring_queue_->tail = index_advance(ring_queue_, ring_queue_->tail, 1);
+    ring_queue_->len++;
+    ring_queue_->reserved = false;
+    record_push(1, ring_queue_);
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_peek(size_t element_size_, size_t element_align_, ring_queue_t* ring_queue_, const void** out_element_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_peek.call_count++;
+    if(s_test_config_ring_queue_peek.fail_on_call != 0) {
+        if(s_test_config_ring_queue_peek.call_count == s_test_config_ring_queue_peek.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_peek.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_peek", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_element_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_peek", "out_element_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_peek", "ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_peek", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_peek", "element_align_")
+
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_peek(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(0 == ring_queue_->len) {
+        ret = RING_QUEUE_EMPTY;
+        goto cleanup;
+    }
+
+    ring_queue_->peeked = true;
+    *out_element_ = (const char*)ring_queue_->memory_pool + (ring_queue_->head * ring_queue_->stride);
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_release(ring_queue_t* ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_release.call_count++;
+    if(s_test_config_ring_queue_release.fail_on_call != 0) {
+        if(s_test_config_ring_queue_release.call_count == s_test_config_ring_queue_release.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_release.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_release", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_release", "ring_queue_->memory_pool")
+
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_release(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(ring_queue_->reserved) {
+        ret = RING_QUEUE_BAD_OPERATION;
+        ERROR_MESSAGE("ring_queue_release(%s) - A reserved slot has not been committed.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(0 == ring_queue_->len) {
+        ret = RING_QUEUE_EMPTY;
+        goto cleanup;
+    }
+
+    ring_queue_->len--;
+    ring_queue_->head = index_advance(ring_queue_, ring_queue_->head, 1);
+    if(0 == ring_queue_->len) {
+        ring_queue_->head = 0;
+        ring_queue_->tail = 0;
+    }
+    ring_queue_->peeked = false;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_set_overflow_policy(ring_queue_overflow_policy_t policy_, size_t grow_limit_, ring_queue_t* ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_set_overflow_policy.call_count++;
+    if(s_test_config_ring_queue_set_overflow_policy.fail_on_call != 0) {
+        if(s_test_config_ring_queue_set_overflow_policy.call_count == s_test_config_ring_queue_set_overflow_policy.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_set_overflow_policy.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_set_overflow_policy", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_set_overflow_policy", "ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(is_overflow_policy_valid(policy_), ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_set_overflow_policy", "policy_")
+
+    if(is_ring_queue_corrupted(ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("ring_queue_set_overflow_policy(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(RING_QUEUE_OVERFLOW_POLICY_GROW == policy_) {
+        IF_ARG_FALSE_GOTO_CLEANUP(grow_limit_ >= ring_queue_->max_element_count, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_set_overflow_policy", "grow_limit_")
+    }
+
+    ring_queue_->overflow_policy = policy_;
+    ring_queue_->grow_limit = (RING_QUEUE_OVERFLOW_POLICY_GROW == policy_) ? grow_limit_ : 0;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_stats_get(const ring_queue_t* ring_queue_, ring_queue_stats_t* out_stats_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_stats_get.call_count++;
+    if(s_test_config_ring_queue_stats_get.fail_on_call != 0) {
+        if(s_test_config_ring_queue_stats_get.call_count == s_test_config_ring_queue_stats_get.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_stats_get.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_stats_get", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_stats_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_stats_get", "out_stats_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_stats_get", "ring_queue_->memory_pool")
+
+    *out_stats_ = ring_queue_->stats;
+    out_stats_->max_element_count = ring_queue_->max_element_count;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t ring_queue_stats_reset(ring_queue_t* ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_stats_reset.call_count++;
+    if(s_test_config_ring_queue_stats_reset.fail_on_call != 0) {
+        if(s_test_config_ring_queue_stats_reset.call_count == s_test_config_ring_queue_stats_reset.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_ring_queue_stats_reset.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_stats_reset", "ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "ring_queue_stats_reset", "ring_queue_->memory_pool")
+
+    memset(&ring_queue_->stats, 0, sizeof(ring_queue_->stats));
+    ring_queue_->stats.peak_len = ring_queue_->len;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+bool ring_queue_empty(const ring_queue_t* ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_ring_queue_empty.call_count++;
+    if(s_test_config_ring_queue_empty.fail_on_call != 0) {
+        if(s_test_config_ring_queue_empty.call_count == s_test_config_ring_queue_empty.fail_on_call) {
+            return s_test_config_ring_queue_empty.forced_result;
+        }
+    }
+#endif
+    if(NULL == ring_queue_) {
+        return true;
+    } else if(NULL == ring_queue_->memory_pool) {
+        return true;
+    } else {
+        if(0 != ring_queue_->len) {
+            return false;
+        } else {
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief メモリシステム実行結果コードをリングキュー実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return ring_queue_result_t 変換されたリングキュー実行結果コード
+ */
+static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return RING_QUEUE_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return RING_QUEUE_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return RING_QUEUE_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return RING_QUEUE_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return RING_QUEUE_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return RING_QUEUE_BAD_OPERATION;
+    default:
+        return RING_QUEUE_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief リングキュー内部データが破損しているかを判定する
+ *
+ * @warning 本関数は内部データ破損判定が目的であるため下記のチェックは行わない
+ * - 引数ring_queue_のNULLチェック
+ *
+ * @param[in] ring_queue_ 判定対象リングキュー
+ *
+ * @retval true 以下のいずれか
+ * - 0 == ring_queue_->element_align
+ * - 0 == ring_queue_->max_element_count
+ * - 0 == ring_queue_->element_size
+ * - 0 == ring_queue_->stride
+ * - 0 == ring_queue_->capacity
+ * - 0 != (ring_queue_->stride % ring_queue_->element_align)(1要素の格納に必要なメモリ領域は、格納要素のアライメント要件の倍数でなければアライメントできない)
+ * - ring_queue_->padding >= ring_queue_->element_align(パディングサイズが要素のアライメント要件を超過することはない、最大でもアライメント要件-1)
+ * - ring_queue_->stride != (ring_queue_->element_size + ring_queue_->padding)(1要素の格納に必要なメモリ領域が要素サイズ+パディングサイズではない)
+ * - 0 == ring_queue_->len && 0 != ring_queue_->head(格納している要素数が0の時にheadが0になっていない)
+ * - 0 == ring_queue_->len && 0 != ring_queue_->tail(格納している要素数が0の時にtailが0になっていない)
+ * - (0 < ring_queue_->len && ring_queue_->max_element_count > ring_queue_->len) && ring_queue_->head == ring_queue_->tail(0 < len < max_element_countの時にhead==tailになるのはおかしい)
+ * - ring_queue_->len == ring_queue_->max_element_count && ring_queue_->head != ring_queue_->tail(リングキューがfullの状態ではhead==tailになるはず)
+ * - alignof(max_align_t) < ring_queue_->element_align || !IS_POWER_OF_TWO(ring_queue_->element_align)(アライメント要件が破損)
+ * - ring_queue_->head >= ring_queue_->max_element_count
+ * - ring_queue_->tail >= ring_queue_->max_element_count
+ * - ring_queue_->len > ring_queue_->max_element_count
+ * - ring_queue_->reserved && ring_queue_->len == ring_queue_->max_element_count(予約時点で満杯であれば最古のデータを捨てているため、予約中に満杯になることはない)
+ * - ring_queue_->peeked && 0 == ring_queue_->len(参照中の要素はリリースまでキューに残るため、参照中に空になることはない)
+ * - 0 != ring_queue_->index_mask && (ring_queue_->index_mask + 1) != ring_queue_->max_element_count(インデックスマスクが最大要素数と一致しない)
+ * - ring_queue_->overflow_policyが範囲外
+ * - RING_QUEUE_OVERFLOW_POLICY_GROW == ring_queue_->overflow_policy && ring_queue_->grow_limit < ring_queue_->max_element_count(拡張上限が現在の最大要素数未満)
+ * - ring_queue_->capacity != ring_queue_->stride * ring_queue_->max_element_count(メモリプール容量異常)
+ * - ring_queue_->memory_pool == NULL(ring_queue_createでmemory_pool != NULLが保証されるため内部データ破損扱い)
+ * @retval false 内部データ破損なし
+ */
+static bool is_ring_queue_corrupted(const ring_queue_t* ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_is_ring_queue_corrupted.call_count++;
+    if(s_test_config_is_ring_queue_corrupted.fail_on_call != 0) {
+        if(s_test_config_is_ring_queue_corrupted.call_count == s_test_config_is_ring_queue_corrupted.fail_on_call) {
+            return s_test_config_is_ring_queue_corrupted.forced_result;
+        }
+    }
+#endif
+    if(0 == ring_queue_->element_align || 0 == ring_queue_->max_element_count || 0 == ring_queue_->element_size || 0 == ring_queue_->stride || 0 == ring_queue_->capacity) {
+        return true;
+    }
+    if(0 != (ring_queue_->stride % ring_queue_->element_align)) {
+        return true;
+    }
+    if(ring_queue_->padding >= ring_queue_->element_align) {
+        return true;
+    }
+    if(ring_queue_->stride != (ring_queue_->element_size + ring_queue_->padding)) {
+        return true;
+    }
+    if(0 == ring_queue_->len && 0 != ring_queue_->head) {
+        return true;
+    }
+    if(0 == ring_queue_->len && 0 != ring_queue_->tail) {
+        return true;
+    }
+    if((0 < ring_queue_->len && ring_queue_->max_element_count > ring_queue_->len) && ring_queue_->head == ring_queue_->tail) {
+        return true;
+    }
+    if(ring_queue_->len == ring_queue_->max_element_count && ring_queue_->head != ring_queue_->tail) {
+        return true;
+    }
+    if(alignof(max_align_t) < ring_queue_->element_align || !IS_POWER_OF_TWO(ring_queue_->element_align)) {
+        return true;
+    }
+    if(ring_queue_->head >= ring_queue_->max_element_count) {
+        return true;
+    }
+    if(ring_queue_->tail >= ring_queue_->max_element_count) {
+        return true;
+    }
+    if(ring_queue_->len > ring_queue_->max_element_count) {
+        return true;
+    }
+    if(ring_queue_->reserved && ring_queue_->len == ring_queue_->max_element_count) {
+        return true;
+    }
+    if(ring_queue_->peeked && 0 == ring_queue_->len) {
+        return true;
+    }
+    if(0 != ring_queue_->index_mask && (ring_queue_->index_mask + 1) != ring_queue_->max_element_count) {
+        return true;
+    }
+    if(!is_overflow_policy_valid(ring_queue_->overflow_policy)) {
+        return true;
+    }
+    if(RING_QUEUE_OVERFLOW_POLICY_GROW == ring_queue_->overflow_policy && ring_queue_->grow_limit < ring_queue_->max_element_count) {
+        return true;
+    }
+    if(ring_queue_->capacity != ring_queue_->stride * ring_queue_->max_element_count) {
+        return true;
+    }
+    if(NULL == ring_queue_->memory_pool) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief 溢れポリシーが定義済みの値かを判定する
+ *
+ * @param[in] policy_ 判定対象溢れポリシー
+ *
+ * @retval true 定義済みの値
+ * @retval false 範囲外の値
+ */
+static bool is_overflow_policy_valid(ring_queue_overflow_policy_t policy_) {
+    switch(policy_) {
+    case RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST:
+    case RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST:
+    case RING_QUEUE_OVERFLOW_POLICY_GROW:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief リングキュー実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ リングキュー実行結果コード
+ * @return const char* 変換された文字列
+ */
+static const char* rslt_to_str(ring_queue_result_t rslt_) {
+    switch(rslt_) {
+    case RING_QUEUE_SUCCESS:
+        return s_rslt_str_success;
+    case RING_QUEUE_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case RING_QUEUE_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case RING_QUEUE_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case RING_QUEUE_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case RING_QUEUE_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case RING_QUEUE_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case RING_QUEUE_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case RING_QUEUE_OVERFLOW:
+        return s_rslt_str_overflow;
+    case RING_QUEUE_EMPTY:
+        return s_rslt_str_empty;
+    case RING_QUEUE_FULL:
+        return s_rslt_str_full;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+/**
+ * @brief リングキューのインデックスindex_をstep_だけ進めた値を返す(最大要素数で折り返す)
+ *
+ * @note 最大要素数が2のべき乗の場合は剰余演算の代わりにマスク演算で折り返す
+ *
+ * @param[in] ring_queue_ 対象リングキュー
+ * @param[in] index_ 現在のインデックス
+ * @param[in] step_ 進める量
+ * @return size_t 更新後のインデックス
+ */
+static size_t index_advance(const ring_queue_t* ring_queue_, size_t index_, size_t step_) {
+    if(0 != ring_queue_->index_mask) {
+        return (index_ + step_) & ring_queue_->index_mask;
+    }
+    return (index_ + step_) % ring_queue_->max_element_count;
+}
+
+/**
+ * @brief 最大要素数に対応するインデックスマスクを返す
+ *
+ * @param[in] max_element_count_ 最大要素数
+ * @return size_t max_element_count_が2以上の2のべき乗の場合はmax_element_count_ - 1、それ以外は0
+ */
+static size_t index_mask_of(size_t max_element_count_) {
+    return (1 < max_element_count_ && IS_POWER_OF_TWO(max_element_count_)) ? (max_element_count_ - 1) : 0;
+}
+
+/**
+ * @brief 溢れポリシーに従い、request_count_個の要素を格納するための空きを確保する
+ *
+ * @note
+ * - RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST: 不足分の最古のデータを捨てる(request_count_ <= max_element_countは呼び出し側で保証すること)
+ * - RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST: 空き容量分のみ格納を許可し、残りを捨てたものとして計上する
+ * - RING_QUEUE_OVERFLOW_POLICY_GROW: grow_limitまで最大要素数を倍々に拡張し、それでも不足する分はREJECT_NEWESTと同様に扱う
+ *
+ * @param[in] request_count_ 格納したい要素数
+ * @param[in,out] ring_queue_ 対象リングキュー
+ * @param[out] out_accept_count_ 格納を許可する要素数(request_count_以下)
+ *
+ * @retval RING_QUEUE_SUCCESS 空きの確保に成功(*out_accept_count_がrequest_count_未満の場合は一部が拒否された)
+ * @retval 上記以外 拡張に失敗(grow_pool参照)
+ */
+static ring_queue_result_t make_room(size_t request_count_, ring_queue_t* ring_queue_, size_t* out_accept_count_) {
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t free_count = ring_queue_->max_element_count - ring_queue_->len;
+
+    if(request_count_ <= free_count) {
+        *out_accept_count_ = request_count_;
+        return RING_QUEUE_SUCCESS;
+    }
+
+    switch(ring_queue_->overflow_policy) {
+    case RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST:
+        record_drop(request_count_ - free_count, ring_queue_);
+        ring_queue_->head = index_advance(ring_queue_, ring_queue_->head, request_count_ - free_count);
+        ring_queue_->len -= request_count_ - free_count;
+        *out_accept_count_ = request_count_;
+        return RING_QUEUE_SUCCESS;
+    case RING_QUEUE_OVERFLOW_POLICY_GROW:
+        if(ring_queue_->max_element_count < ring_queue_->grow_limit) {
+            size_t new_element_count = ring_queue_->max_element_count;
+            while((new_element_count - ring_queue_->len) < request_count_ && new_element_count < ring_queue_->grow_limit) {
+                new_element_count = (new_element_count > (ring_queue_->grow_limit / 2)) ? ring_queue_->grow_limit : (new_element_count * 2);
+            }
+            ret = grow_pool(new_element_count, ring_queue_);
+            if(RING_QUEUE_SUCCESS != ret) {
+                return ret;
+            }
+            free_count = ring_queue_->max_element_count - ring_queue_->len;
+            if(request_count_ <= free_count) {
+                *out_accept_count_ = request_count_;
+                return RING_QUEUE_SUCCESS;
+            }
+        }
+        break;
+    case RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST:
+        break;
+    }
+
+    record_drop(request_count_ - free_count, ring_queue_);
+    *out_accept_count_ = free_count;
+    return RING_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief メモリプールを最大要素数new_element_count_分に再確保し、格納済みの要素を先頭から詰め直す
+ *
+ * @note 失敗した場合、リングキューの状態は変化しない
+ *
+ * @param[in] new_element_count_ 拡張後の最大要素数(現在の最大要素数より大きいこと)
+ * @param[in,out] ring_queue_ 拡張対象リングキュー
+ *
+ * @retval RING_QUEUE_OVERFLOW 必要メモリ量の計算過程でオーバーフローが発生
+ * @retval RING_QUEUE_NO_MEMORY メモリ確保に失敗
+ * @retval RING_QUEUE_LIMIT_EXCEEDED メモリシステムの使用可能範囲上限を超過
+ * @retval RING_QUEUE_SUCCESS 拡張に成功し、正常終了
+ */
+static ring_queue_result_t grow_pool(size_t new_element_count_, ring_queue_t* ring_queue_) {
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    void* new_pool = NULL;
+    char* old_pool = (char*)ring_queue_->memory_pool;
+    size_t new_capacity = 0;
+    size_t first_count = 0;
+
+    if(SIZE_MAX / new_element_count_ < ring_queue_->stride) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("grow_pool(%s) - Computed memory pool size is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    new_capacity = ring_queue_->stride * new_element_count_;
+
+    ret_mem = memory_system_allocate(new_capacity, MEMORY_TAG_RING_QUEUE, &new_pool);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("grow_pool(%s) - Failed to allocate memory pool memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(new_pool, 0, new_capacity);
+
+    // head側から折り返しまでの領域と、折り返し後の領域を順に新しいメモリプールの先頭へ詰める
+    first_count = ring_queue_->max_element_count - ring_queue_->head;
+    if(first_count > ring_queue_->len) {
+        first_count = ring_queue_->len;
+    }
+    memcpy(new_pool, old_pool + (ring_queue_->head * ring_queue_->stride), first_count * ring_queue_->stride);
+    if(ring_queue_->len != first_count) {
+        memcpy((char*)new_pool + (first_count * ring_queue_->stride), old_pool, (ring_queue_->len - first_count) * ring_queue_->stride);
+    }
+    memory_system_free(old_pool, ring_queue_->capacity, MEMORY_TAG_RING_QUEUE);
+
+    DEBUG_MESSAGE("grow_pool - Ring queue grew from %zu to %zu elements.", ring_queue_->max_element_count, new_element_count_);
+    ring_queue_->memory_pool = new_pool;
+    ring_queue_->capacity = new_capacity;
+    ring_queue_->max_element_count = new_element_count_;
+    ring_queue_->index_mask = index_mask_of(new_element_count_);
+    ring_queue_->head = 0;
+    ring_queue_->tail = ring_queue_->len;   // len < new_element_count_のため折り返しは発生しない
+    ring_queue_->stats.grow_count++;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief 格納した要素数を統計情報に計上し、最大格納要素数を更新する
+ *
+ * @param[in] count_ 格納した要素数
+ * @param[in,out] ring_queue_ 対象リングキュー
+ */
+static void record_push(size_t count_, ring_queue_t* ring_queue_) {
+    ring_queue_->stats.push_count += count_;
+    if(ring_queue_->len > ring_queue_->stats.peak_len) {
+        ring_queue_->stats.peak_len = ring_queue_->len;
+    }
+}
+
+/**
+ * @brief 溢れポリシーにより捨てた要素数を統計情報に計上する
+ *
+ * @note 入力バースト時のメッセージ出力を抑えるため、メッセージは統計リセット後の最初の1回のみ出力する
+ *
+ * @param[in] count_ 捨てた要素数
+ * @param[in,out] ring_queue_ 対象リングキュー
+ */
+static void record_drop(size_t count_, ring_queue_t* ring_queue_) {
+    if(0 == count_) {
+        return;
+    }
+    if(0 == ring_queue_->stats.drop_count) {
+        DEBUG_MESSAGE("Ring queue is full; dropping element(s). Further drops are only counted in ring_queue_stats_t.");
+    }
+    ring_queue_->stats.drop_count += count_;
+}
+
+/**
+ * @brief data_をリングキュー末尾にコピーする
+ *
+ * @warning 引数および内部データのチェックと、make_roomによる空きの確保は呼び出し側で行うこと
+ *
+ * @param[in] data_ 格納データへのポインタ
+ * @param[in,out] ring_queue_ 格納先リングキュー
+ */
+static void push_element(const void* data_, ring_queue_t* ring_queue_) {
+    char* target_ptr = (char*)ring_queue_->memory_pool + (ring_queue_->stride * ring_queue_->tail);
+
+    memcpy(target_ptr, data_, ring_queue_->element_size);
+
+    ring_queue_->tail = index_advance(ring_queue_, ring_queue_->tail, 1);
+    ring_queue_->len++;
+    record_push(1, ring_queue_);
+}
+
+/**
+ * @brief リングキュー先頭のデータをdata_にコピーして取り除く
+ *
+ * @warning 引数および内部データのチェック、空チェックは呼び出し側で行うこと
+ *
+ * @param[in,out] ring_queue_ 取り出し元リングキュー
+ * @param[out] data_ 取り出したデータの格納先
+ */
+static void pop_element(ring_queue_t* ring_queue_, void* data_) {
+    const char* head_ptr = (const char*)ring_queue_->memory_pool + (ring_queue_->head * ring_queue_->stride);
+
+    memcpy(data_, head_ptr, ring_queue_->element_size);
+    ring_queue_->len--;
+    ring_queue_->head = index_advance(ring_queue_, ring_queue_->head, 1);
+
+    if(0 == ring_queue_->len) {
+        ring_queue_->head = 0;
+        ring_queue_->tail = 0;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_ring_queue_create_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_create.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_create.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_push_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_push.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_push.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_pop_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_pop.fail_on_call = config_->fail_on_call;
     s_test_config_ring_queue_pop.forced_result = config_->forced_result;
 }
 
-void test_ring_queue_empty_config_set(const test_call_control_bool_t* config_) {
-    s_test_config_ring_queue_empty.fail_on_call = config_->fail_on_call;
-    s_test_config_ring_queue_empty.forced_result = config_->forced_result;
-}
+void test_ring_queue_create_pow2_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_create_pow2.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_create_pow2.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_push_unchecked_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_push_unchecked.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_push_unchecked.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_pop_unchecked_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_pop_unchecked.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_pop_unchecked.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_push_n_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_push_n.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_push_n.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_pop_n_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_pop_n.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_pop_n.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_reserve_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_reserve.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_reserve.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_commit_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_commit.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_commit.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_peek_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_peek.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_peek.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_release_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_release.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_release.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_set_overflow_policy_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_set_overflow_policy.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_set_overflow_policy.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_stats_get_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_stats_get.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_stats_get.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_stats_reset_config_set(const test_call_control_t* config_) {
+    s_test_config_ring_queue_stats_reset.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_stats_reset.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_empty_config_set(const test_call_control_bool_t* config_) {
+    s_test_config_ring_queue_empty.fail_on_call = config_->fail_on_call;
+    s_test_config_ring_queue_empty.forced_result = config_->forced_result;
+}
+
+void test_ring_queue_config_reset(void) {
+    test_call_control_reset(&s_test_config_ring_queue_create);
+    test_call_control_reset(&s_test_config_ring_queue_push);
+    test_call_control_reset(&s_test_config_ring_queue_pop);
+    test_call_control_reset(&s_test_config_ring_queue_create_pow2);
+    test_call_control_reset(&s_test_config_ring_queue_push_unchecked);
+    test_call_control_reset(&s_test_config_ring_queue_pop_unchecked);
+    test_call_control_reset(&s_test_config_ring_queue_push_n);
+    test_call_control_reset(&s_test_config_ring_queue_pop_n);
+    test_call_control_reset(&s_test_config_ring_queue_reserve);
+    test_call_control_reset(&s_test_config_ring_queue_commit);
+    test_call_control_reset(&s_test_config_ring_queue_peek);
+    test_call_control_reset(&s_test_config_ring_queue_release);
+    test_call_control_reset(&s_test_config_ring_queue_set_overflow_policy);
+    test_call_control_reset(&s_test_config_ring_queue_stats_get);
+    test_call_control_reset(&s_test_config_ring_queue_stats_reset);
+    test_call_control_bool_reset(&s_test_config_ring_queue_empty);
+
+    test_call_control_bool_reset(&s_test_config_is_ring_queue_corrupted);
+}
+
+void test_ring_queue(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_ring_queue_create();
+    test_ring_queue_destroy();
+    test_ring_queue_push();
+    test_ring_queue_pop();
+    test_ring_queue_create_pow2();
+    test_ring_queue_unchecked();
+    test_ring_queue_push_n();
+    test_ring_queue_pop_n();
+    test_ring_queue_reserve_commit();
+    test_ring_queue_peek_release();
+    test_ring_queue_overflow_policy();
+    test_ring_queue_stats();
+    test_ring_queue_empty();
+    test_rslt_convert_mem_sys();
+    test_is_ring_queue_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+// Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_ring_queue_create(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_create() 冒頭で強制的に RING_QUEUE_NO_MEMORY を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_NO_MEMORY;
+        test_ring_queue_create_config_set(&config);
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL);
+        assert(RING_QUEUE_NO_MEMORY == ret);
+
+        test_ring_queue_config_reset();
+    }
+    {
+        // ring_queue_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+    }
+    {
+        // *ring_queue_ != NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t dummy = {0};
+        ring_queue_t* ring_queue = &dummy;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(&dummy == ring_queue);
+    }
+    {
+        // max_element_count_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(0U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_size_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, 0U, alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_align_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), 0U, &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_align_ が 2 の冪乗ではない -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), 3U, &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_align_ > alignof(max_align_t) -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        const size_t invalid_align = alignof(max_align_t) * 2U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), invalid_align, &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // SIZE_MAX / element_size_ < max_element_count_ -> RING_QUEUE_OVERFLOW
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(2U, SIZE_MAX, 1U, &ring_queue);
+        assert(RING_QUEUE_OVERFLOW == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // (SIZE_MAX - padding) < element_size_ -> RING_QUEUE_OVERFLOW
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(1U, (SIZE_MAX - 3U), 8U, &ring_queue);
+        assert(RING_QUEUE_OVERFLOW == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // SIZE_MAX / max_element_count_ < stride -> RING_QUEUE_OVERFLOW
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        const size_t element_size = (SIZE_MAX / 2U);
+
+        ret = ring_queue_create(2U, element_size, 8U, &ring_queue);
+        assert(RING_QUEUE_OVERFLOW == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 依存先 memory_system_allocate() の1回目を失敗させる
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        test_call_control_t config = {0};
+
+        test_ring_queue_config_reset();
+        test_choco_memory_config_reset();
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_allocate_config_set(&config);
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_NO_MEMORY == ret);
+        assert(NULL == ring_queue);
+
+        test_choco_memory_config_reset();
+    }
+    {
+        // 依存先 memory_system_allocate() の2回目を失敗させる
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        test_call_control_t config = {0};
+
+        test_ring_queue_config_reset();
+        test_choco_memory_config_reset();
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 2U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_allocate_config_set(&config);
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_NO_MEMORY == ret);
+        assert(NULL == ring_queue);
+
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系（padding == 0）
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        test_ring_queue_config_reset();
+        test_choco_memory_config_reset();
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+        assert(alignof(uint32_t) == ring_queue->element_align);
+        assert(4U == ring_queue->max_element_count);
+        assert(0U == ring_queue->padding);
+        assert(sizeof(uint32_t) == ring_queue->element_size);
+        assert(sizeof(uint32_t) == ring_queue->stride);
+        assert(sizeof(uint32_t) * 4U == ring_queue->capacity);
+        assert(NULL != ring_queue->memory_pool);
+        assert(0U == ((uintptr_t)ring_queue->memory_pool % alignof(uint32_t)));
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系（padding != 0）
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        test_ring_queue_config_reset();
+        test_choco_memory_config_reset();
+
+        ret = ring_queue_create(3U, 1U, 4U, &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+        assert(4U == ring_queue->element_align);
+        assert(3U == ring_queue->max_element_count);
+        assert(3U == ring_queue->padding);
+        assert(1U == ring_queue->element_size);
+        assert(4U == ring_queue->stride);
+        assert(12U == ring_queue->capacity);
+        assert(NULL != ring_queue->memory_pool);
+        assert(0U == ((uintptr_t)ring_queue->memory_pool % 4U));
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+// Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_ring_queue_destroy(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_ == NULL -> no-op
+        ring_queue_destroy(NULL);
+    }
+    {
+        // *ring_queue_ == NULL -> no-op
+        ring_queue_t* ring_queue = NULL;
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+        assert(NULL != ring_queue->memory_pool);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 連続 destroy -> no-op
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 内部データ破損状態でも ring_queue 本体は破棄され、呼び出し元のポインタは NULL になる
+        memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+
+        ret_mem = memory_system_allocate(sizeof(ring_queue_t), MEMORY_TAG_RING_QUEUE, (void**)&ring_queue);
+        assert(MEMORY_SYSTEM_SUCCESS == ret_mem);
+        assert(NULL != ring_queue);
+        memset(ring_queue, 0, sizeof(ring_queue_t));
+
+        ring_queue->head = 0U;
+        ring_queue->tail = 0U;
+        ring_queue->len = 0U;
+        ring_queue->element_align = 1U;
+        ring_queue->max_element_count = 1U;
+        ring_queue->padding = 0U;
+        ring_queue->element_size = 1U;
+        ring_queue->stride = 1U;
+        ring_queue->capacity = 1U;
+        ring_queue->memory_pool = NULL;   // is_ring_queue_corrupted() が true になる条件
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+// Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_ring_queue_push(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_push() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        uint32_t value = 123U;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_push_config_set(&config);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+
+        test_ring_queue_config_reset();
+    }
+    {
+        // ring_queue_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        uint32_t value = 123U;
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+    }
+    {
+        // data_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(NULL, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // ring_queue_->memory_pool == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        void* saved_memory_pool = NULL;
+        uint32_t value = 123U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+        assert(NULL != ring_queue->memory_pool);
+
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue->memory_pool = saved_memory_pool;
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_size_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value = 123U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value, sizeof(uint16_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_align_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value = 123U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint16_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value = 123U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        test_ring_queue_config_reset();
+
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        test_ring_queue_config_reset();
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: 1件 push
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value = 0x12345678U;
+        uint32_t stored = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        assert(0U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(1U == ring_queue->len);
+
+        memcpy(&stored, ring_queue->memory_pool, sizeof(uint32_t));
+        assert(value == stored);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: 複数件 push
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value1 = 10U;
+        uint32_t value2 = 20U;
+        uint32_t stored1 = 0U;
+        uint32_t stored2 = 0U;
+        char* mem_ptr = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        assert(0U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(2U == ring_queue->len);
+
+        mem_ptr = (char*)ring_queue->memory_pool;
+        memcpy(&stored1, mem_ptr + (ring_queue->stride * 0U), sizeof(uint32_t));
+        memcpy(&stored2, mem_ptr + (ring_queue->stride * 1U), sizeof(uint32_t));
+
+        assert(value1 == stored1);
+        assert(value2 == stored2);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // full 状態で push -> 最古要素を上書きし、head を進める
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value1 = 10U;
+        uint32_t value2 = 20U;
+        uint32_t value3 = 30U;
+        uint32_t stored0 = 0U;
+        uint32_t stored1 = 0U;
+        char* mem_ptr = NULL;
+
+        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(2U == ring_queue->len);
+
+        ret = ring_queue_push(&value3, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        assert(1U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(2U == ring_queue->len);
+
+        mem_ptr = (char*)ring_queue->memory_pool;
+        memcpy(&stored0, mem_ptr + (ring_queue->stride * 0U), sizeof(uint32_t));
+        memcpy(&stored1, mem_ptr + (ring_queue->stride * 1U), sizeof(uint32_t));
+
+        assert(value3 == stored0);
+        assert(value2 == stored1);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+// Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_ring_queue_pop(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_pop() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        uint32_t out = 0U;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_pop_config_set(&config);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        assert(0U == out);
+
+        test_ring_queue_config_reset();
+    }
+    {
+        // ring_queue_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        uint32_t out = 0U;
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == out);
+    }
+    {
+        // data_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // ring_queue_->memory_pool == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        void* saved_memory_pool = NULL;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+        assert(NULL != ring_queue->memory_pool);
+
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == out);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue->memory_pool = saved_memory_pool;
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_size_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_pop(sizeof(uint16_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == out);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // element_align_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint16_t), ring_queue, &out);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(0U == out);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        test_ring_queue_config_reset();
+
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+        assert(0U == out);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        test_ring_queue_config_reset();
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 空キュー -> RING_QUEUE_EMPTY
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t out = 0xFFFFFFFFU;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_EMPTY == ret);
+        assert(0xFFFFFFFFU == out);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: 1件 pop して空になったら head/tail が 0 に戻る
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value = 0x12345678U;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(1U == ring_queue->len);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(value == out);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: 複数件 pop して FIFO を確認
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value1 = 10U;
+        uint32_t value2 = 20U;
+        uint32_t out1 = 0U;
+        uint32_t out2 = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        assert(0U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(2U == ring_queue->len);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out1);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(value1 == out1);
+        assert(1U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(1U == ring_queue->len);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out2);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(value2 == out2);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: padding を含む要素でも FIFO で取り出せる
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint8_t value1 = 0x11U;
+        uint8_t value2 = 0x22U;
+        uint8_t out1 = 0U;
+        uint8_t out2 = 0U;
+
+        ret = ring_queue_create(3U, sizeof(uint8_t), 4U, &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+        assert(3U == ring_queue->padding);
+        assert(4U == ring_queue->stride);
+
+        ret = ring_queue_push(&value1, sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value2, sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out1);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(value1 == out1);
+
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out2);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(value2 == out2);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // full 状態で上書き後に pop -> 最古要素ではなく次の要素が返る
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t value1 = 10U;
+        uint32_t value2 = 20U;
+        uint32_t value3 = 30U;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value3, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        assert(1U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(2U == ring_queue->len);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(value2 == out);
+        assert(0U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(1U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_ring_queue_create_pow2(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_create_pow2() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        ring_queue_t* ring_queue = NULL;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_create_pow2_config_set(&config);
+
+        ret = ring_queue_create_pow2(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        assert(NULL == ring_queue);
+
+        test_ring_queue_config_reset();
+    }
+    {
+        // max_element_count_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create_pow2(0U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        assert(NULL == ring_queue);
+
+        // ring_queue_create の引数チェックも通過する
+        ret = ring_queue_create_pow2(4U, sizeof(uint32_t), alignof(uint32_t), NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+    }
+    {
+        // 2 のべき乗に切り上げられない -> RING_QUEUE_OVERFLOW
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create_pow2((SIZE_MAX >> 1) + 2U, sizeof(uint8_t), alignof(uint8_t), &ring_queue);
+        assert(RING_QUEUE_OVERFLOW == ret);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: 最大要素数が切り上げられ、index_mask が設定される
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        const size_t requests[5] = { 1U, 2U, 3U, 100U, 128U };
+        const size_t expected[5] = { 1U, 2U, 4U, 128U, 128U };
+
+        for(size_t i = 0; i != 5U; ++i) {
+            ret = ring_queue_create_pow2(requests[i], sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+            assert(expected[i] == ring_queue->max_element_count);
+            assert((1U == expected[i] ? 0U : expected[i] - 1U) == ring_queue->index_mask);
+            assert(false == is_ring_queue_corrupted(ring_queue));
+            ring_queue_destroy(&ring_queue);
+            assert(NULL == ring_queue);
+        }
+    }
+    {
+        // 2 のべき乗ではない最大要素数 -> index_mask == 0 (剰余演算で折り返す)
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create(3U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0U == ring_queue->index_mask);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // マスク演算での折り返し(上書き、push_n / pop_n を含む)が剰余演算と同じ結果になる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        const uint32_t values[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
+        uint32_t out[4] = { 0U, 0U, 0U, 0U };
+        size_t count = 0U;
+
+        ret = ring_queue_create_pow2(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == ring_queue->index_mask);
+
+        for(size_t i = 0; i != 6U; ++i) {
+            ret = ring_queue_push(&values[i], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        assert(2U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(4U == ring_queue->len);
+
+        ret = ring_queue_pop_n(4U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(4U == count);
+        assert(3U == out[0]);
+        assert(4U == out[1]);
+        assert(5U == out[2]);
+        assert(6U == out[3]);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // index_mask が最大要素数と一致しない -> 破損と判定される
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+
+        ret = ring_queue_create_pow2(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        test_ring_queue_config_reset();
+        ring_queue->index_mask = 1U;
+        assert(true == is_ring_queue_corrupted(ring_queue));
+        ring_queue->index_mask = 3U;
+        assert(false == is_ring_queue_corrupted(ring_queue));
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+RING_QUEUE_DEFINE_TYPED(test_u32_queue, uint32_t)
+
+static void NO_COVERAGE test_ring_queue_unchecked(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_push_unchecked() / ring_queue_pop_unchecked() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        uint32_t value = 0U;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_push_unchecked_config_set(&config);
+        test_ring_queue_pop_unchecked_config_set(&config);
+
+        ret = ring_queue_push_unchecked(&value, NULL);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        ret = ring_queue_pop_unchecked(NULL, &value);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+
+        test_ring_queue_config_reset();
+    }
+    {
+        // 予約中 -> RING_QUEUE_BAD_OPERATION
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        void* slot = NULL;
+        const uint32_t value = 7U;
+        uint32_t out = 0U;
 
-void test_ring_queue_config_reset(void) {
-    test_call_control_reset(&s_test_config_ring_queue_create);
-    test_call_control_reset(&s_test_config_ring_queue_push);
-    test_call_control_reset(&s_test_config_ring_queue_pop);
-    test_call_control_bool_reset(&s_test_config_ring_queue_empty);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push_unchecked(&value, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-    test_call_control_bool_reset(&s_test_config_is_ring_queue_corrupted);
-}
+        ret = ring_queue_push_unchecked(&value, ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        ret = ring_queue_pop_unchecked(ring_queue, &out);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        assert(0U == out);
+        assert(1U == ring_queue->len);
 
-void test_ring_queue(void) {
-    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-    test_ring_queue_create();
-    test_ring_queue_destroy();
-    test_ring_queue_push();
-    test_ring_queue_pop();
-    test_ring_queue_empty();
-    test_rslt_convert_mem_sys();
-    test_is_ring_queue_corrupted();
-    test_rslt_to_str();
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: 剰余演算で折り返すキューでも push / pop の結果はチェック付き API と同じ
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        uint32_t out = 0U;
 
-    memory_system_destroy();
+        ret = ring_queue_create(3U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_pop_unchecked(ring_queue, &out);
+        assert(RING_QUEUE_EMPTY == ret);
+
+        for(uint32_t i = 1U; i <= 4U; ++i) {
+            ret = ring_queue_push_unchecked(&i, ring_queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        assert(3U == ring_queue->len);
+        assert(1U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+
+        for(uint32_t i = 2U; i <= 4U; ++i) {
+            ret = ring_queue_pop_unchecked(ring_queue, &out);
+            assert(RING_QUEUE_SUCCESS == ret);
+            assert(i == out);
+        }
+        assert(0U == ring_queue->len);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 型付きラッパー: create / push / pop / pop_n / empty / destroy
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_u32_queue_t queue = { NULL };
+        uint32_t out[8] = { 0U };
+        size_t count = 0U;
+
+        ret = test_u32_queue_create(4U, NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = test_u32_queue_create(5U, &queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != queue.queue);
+        assert(8U == queue.queue->max_element_count);
+        assert(sizeof(uint32_t) == queue.queue->element_size);
+        assert(alignof(uint32_t) == queue.queue->element_align);
+        assert(true == test_u32_queue_empty(&queue));
+
+        // 作成済みのキューに対する再 create は ring_queue_create の引数チェックで弾かれる
+        ret = test_u32_queue_create(4U, &queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        for(uint32_t i = 0U; i != 10U; ++i) {
+            ret = test_u32_queue_push(&i, &queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        assert(false == test_u32_queue_empty(&queue));
+
+        ret = test_u32_queue_pop(&queue, &out[0]);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == out[0]);
+
+        ret = test_u32_queue_pop_n(8U, &queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(7U == count);
+        for(size_t i = 0; i != count; ++i) {
+            assert((uint32_t)(i + 3U) == out[i]);
+        }
+        assert(true == test_u32_queue_empty(&queue));
+
+        ret = test_u32_queue_pop(&queue, &out[0]);
+        assert(RING_QUEUE_EMPTY == ret);
+
+        test_u32_queue_destroy(&queue);
+        assert(NULL == queue.queue);
+        test_u32_queue_destroy(&queue);
+        test_u32_queue_destroy(NULL);
+    }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
 }
 
-// Generated by ChatGPT 5.4 Thinking
-static void NO_COVERAGE test_ring_queue_create(void) {
+static void NO_COVERAGE test_ring_queue_push_n(void) {
     test_ring_queue_config_reset();
     test_choco_memory_config_reset();
 
     {
-        // ring_queue_create() 冒頭で強制的に RING_QUEUE_NO_MEMORY を返させる
+        // ring_queue_push_n() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
         ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         test_call_control_t config = {0};
+        const uint32_t values[2] = { 1U, 2U };
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
-        config.forced_result = (int)RING_QUEUE_NO_MEMORY;
-        test_ring_queue_create_config_set(&config);
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_push_n_config_set(&config);
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL);
-        assert(RING_QUEUE_NO_MEMORY == ret);
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), NULL);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
 
         test_ring_queue_config_reset();
     }
     {
-        // ring_queue_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        ring_queue_t* ring_queue = NULL;
+        void* saved_memory_pool = NULL;
+        const uint32_t values[2] = { 1U, 2U };
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL);
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), NULL);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        ret = ring_queue_push_n(NULL, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_push_n(values, 2U, sizeof(uint16_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint16_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ring_queue->memory_pool = saved_memory_pool;
+
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
     }
     {
-        // *ring_queue_ != NULL -> RING_QUEUE_INVALID_ARGUMENT
+        // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t dummy = {0};
-        ring_queue_t* ring_queue = &dummy;
+        ring_queue_t* ring_queue = NULL;
+        const uint32_t values[2] = { 1U, 2U };
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(&dummy == ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
+
+        test_ring_queue_config_reset();
+
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+        assert(0U == ring_queue->len);
+
+        test_ring_queue_config_reset();
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
     }
     {
-        // max_element_count_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // count_ == 0 -> 何もせず RING_QUEUE_SUCCESS
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        const uint32_t values[2] = { 1U, 2U };
 
-        ret = ring_queue_create(0U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_push_n(values, 0U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(0U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // element_size_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: 折り返しを含む格納(memcpy 2回)
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        const uint32_t values1[3] = { 10U, 20U, 30U };
+        const uint32_t values2[3] = { 40U, 50U, 60U };
+        uint32_t out = 0U;
+        const uint32_t* pool = NULL;
 
-        ret = ring_queue_create(4U, 0U, alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_push_n(values1, 3U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0U == ring_queue->head);
+        assert(3U == ring_queue->tail);
+        assert(3U == ring_queue->len);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(10U == out);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(20U == out);
+
+        // head = 2, tail = 3, len = 1 -> index 3, 0, 1 に格納
+        ret = ring_queue_push_n(values2, 3U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(4U == ring_queue->len);
+
+        pool = (const uint32_t*)ring_queue->memory_pool;
+        assert(50U == pool[0]);
+        assert(60U == pool[1]);
+        assert(30U == pool[2]);
+        assert(40U == pool[3]);
+
+        ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // element_align_ == 0 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: 空き容量を超える格納 -> 最古要素から上書き
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        const uint32_t values1[3] = { 1U, 2U, 3U };
+        const uint32_t values2[2] = { 4U, 5U };
+        uint32_t out = 0U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), 0U, &ring_queue);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_push_n(values1, 3U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push_n(values2, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(1U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(4U == ring_queue->len);
+
+        for(uint32_t expected = 2U; expected <= 5U; ++expected) {
+            ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+            assert(RING_QUEUE_SUCCESS == ret);
+            assert(expected == out);
+        }
+        assert(true == ring_queue_empty(ring_queue));
+
+        ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // element_align_ が 2 の冪乗ではない -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: count_ がキュー容量を超える -> 入力末尾の容量分のみが残る
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        const uint32_t values[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
+        uint32_t out = 0U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), 3U, &ring_queue);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_push(&values[0], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_push_n(values, 6U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(4U == ring_queue->len);
+        assert(false == is_ring_queue_corrupted(ring_queue));
+
+        for(uint32_t expected = 3U; expected <= 6U; ++expected) {
+            ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+            assert(RING_QUEUE_SUCCESS == ret);
+            assert(expected == out);
+        }
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: padding を含む要素(1要素ずつコピー)
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        const uint8_t values[4] = { 0x11U, 0x22U, 0x33U, 0x44U };
+        uint8_t out = 0U;
+
+        ret = ring_queue_create(3U, sizeof(uint8_t), 4U, &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == ring_queue->padding);
+
+        ret = ring_queue_push(&values[0], sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&values[0], sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&values[0], sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        // head = 1, tail = 2, len = 1
+        ret = ring_queue_push_n(&values[1], 2U, sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(1U == ring_queue->head);
+        assert(1U == ring_queue->tail);
+        assert(3U == ring_queue->len);
+
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0x11U == out);
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0x22U == out);
+        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0x33U == out);
+
+        ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_ring_queue_pop_n(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_pop_n() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        uint32_t out[2] = { 0U, 0U };
+        size_t count = 0U;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_pop_n_config_set(&config);
+
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), NULL, out, &count);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        assert(0U == count);
+
+        test_ring_queue_config_reset();
+    }
     {
-        // element_align_ > alignof(max_align_t) -> RING_QUEUE_INVALID_ARGUMENT
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
-        const size_t invalid_align = alignof(max_align_t) * 2U;
+        void* saved_memory_pool = NULL;
+        uint32_t out[2] = { 0U, 0U };
+        size_t count = 0U;
+        const uint32_t value = 7U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), invalid_align, &ring_queue);
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), NULL, out, &count);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(NULL == ring_queue);
-    }
-    {
-        // SIZE_MAX / element_size_ < max_element_count_ -> RING_QUEUE_OVERFLOW
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
 
-        ret = ring_queue_create(2U, SIZE_MAX, 1U, &ring_queue);
-        assert(RING_QUEUE_OVERFLOW == ret);
-        assert(NULL == ring_queue);
-    }
-    {
-        // (SIZE_MAX - padding) < element_size_ -> RING_QUEUE_OVERFLOW
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-        ret = ring_queue_create(1U, (SIZE_MAX - 3U), 8U, &ring_queue);
-        assert(RING_QUEUE_OVERFLOW == ret);
-        assert(NULL == ring_queue);
-    }
-    {
-        // SIZE_MAX / max_element_count_ < stride -> RING_QUEUE_OVERFLOW
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
-        const size_t element_size = (SIZE_MAX / 2U);
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), ring_queue, NULL, &count);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
 
-        ret = ring_queue_create(2U, element_size, 8U, &ring_queue);
-        assert(RING_QUEUE_OVERFLOW == ret);
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_pop_n(0U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_pop_n(2U, sizeof(uint16_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint16_t), ring_queue, out, &count);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ring_queue->memory_pool = saved_memory_pool;
+
+        assert(0U == count);
+        assert(0U == out[0]);
+        assert(1U == ring_queue->len);
+
+        ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 依存先 memory_system_allocate() の1回目を失敗させる
+        // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
-        test_call_control_t config = {0};
+        uint32_t out[2] = { 0U, 0U };
+        size_t count = 0U;
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != ring_queue);
 
         test_ring_queue_config_reset();
-        test_choco_memory_config_reset();
 
-        test_call_control_reset(&config);
-        config.fail_on_call = 1U;
-        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
-        test_memory_system_allocate_config_set(&config);
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_NO_MEMORY == ret);
-        assert(NULL == ring_queue);
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
 
-        test_choco_memory_config_reset();
+        test_ring_queue_config_reset();
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
     }
     {
-        // 依存先 memory_system_allocate() の2回目を失敗させる
+        // 空のキュー -> RING_QUEUE_EMPTY, *out_count_ = 0
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
-        test_call_control_t config = {0};
+        uint32_t out[2] = { 0U, 0U };
+        size_t count = 99U;
 
-        test_ring_queue_config_reset();
-        test_choco_memory_config_reset();
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-        test_call_control_reset(&config);
-        config.fail_on_call = 2U;
-        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
-        test_memory_system_allocate_config_set(&config);
+        ret = ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_EMPTY == ret);
+        assert(0U == count);
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_NO_MEMORY == ret);
+        ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
-
-        test_choco_memory_config_reset();
     }
     {
-        // 正常系（padding == 0）
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: max_count_ < len -> max_count_ 個のみ取り出す、折り返しを含む取り出し(memcpy 2回)
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-
-        test_ring_queue_config_reset();
-        test_choco_memory_config_reset();
+        const uint32_t values[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
+        uint32_t out[4] = { 0U, 0U, 0U, 0U };
+        size_t count = 0U;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
 
+        // 1, 2 を上書きし、head = 2, tail = 2, len = 4 (3, 4, 5, 6)
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push_n(&values[2], 4U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(4U == ring_queue->len);
+
+        ret = ring_queue_pop_n(1U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(1U == count);
+        assert(3U == out[0]);
+        assert(3U == ring_queue->head);
+        assert(3U == ring_queue->len);
+
+        ret = ring_queue_pop_n(4U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == count);
+        assert(4U == out[0]);
+        assert(5U == out[1]);
+        assert(6U == out[2]);
         assert(0U == ring_queue->head);
         assert(0U == ring_queue->tail);
         assert(0U == ring_queue->len);
-        assert(alignof(uint32_t) == ring_queue->element_align);
-        assert(4U == ring_queue->max_element_count);
-        assert(0U == ring_queue->padding);
-        assert(sizeof(uint32_t) == ring_queue->element_size);
-        assert(sizeof(uint32_t) == ring_queue->stride);
-        assert(sizeof(uint32_t) * 4U == ring_queue->capacity);
-        assert(NULL != ring_queue->memory_pool);
-        assert(0U == ((uintptr_t)ring_queue->memory_pool % alignof(uint32_t)));
+
+        ret = ring_queue_pop_n(4U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_EMPTY == ret);
+        assert(0U == count);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 正常系（padding != 0）
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: padding を含む要素 -> 出力は element_size_ 単位で詰めて格納される
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        const uint8_t values[4] = { 0x11U, 0x22U, 0x33U, 0x44U };
+        uint8_t out[4] = { 0U, 0U, 0U, 0U };
+        size_t count = 0U;
 
-        test_ring_queue_config_reset();
-        test_choco_memory_config_reset();
-
-        ret = ring_queue_create(3U, 1U, 4U, &ring_queue);
+        ret = ring_queue_create(3U, sizeof(uint8_t), 4U, &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+        assert(3U == ring_queue->padding);
 
+        ret = ring_queue_push_n(values, 4U, sizeof(uint8_t), 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
         assert(0U == ring_queue->head);
         assert(0U == ring_queue->tail);
+        assert(3U == ring_queue->len);
+
+        ret = ring_queue_pop_n(4U, sizeof(uint8_t), 4U, ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == count);
+        assert(0x22U == out[0]);
+        assert(0x33U == out[1]);
+        assert(0x44U == out[2]);
+        assert(0U == out[3]);
         assert(0U == ring_queue->len);
-        assert(4U == ring_queue->element_align);
-        assert(3U == ring_queue->max_element_count);
-        assert(3U == ring_queue->padding);
-        assert(1U == ring_queue->element_size);
-        assert(4U == ring_queue->stride);
-        assert(12U == ring_queue->capacity);
-        assert(NULL != ring_queue->memory_pool);
-        assert(0U == ((uintptr_t)ring_queue->memory_pool % 4U));
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
@@ -727,70 +2902,224 @@ static void NO_COVERAGE test_ring_queue_create(void) {
     test_choco_memory_config_reset();
 }
 
-// Generated by ChatGPT 5.4 Thinking
-static void NO_COVERAGE test_ring_queue_destroy(void) {
+static void NO_COVERAGE test_ring_queue_reserve_commit(void) {
     test_ring_queue_config_reset();
     test_choco_memory_config_reset();
 
     {
-        // ring_queue_ == NULL -> no-op
-        ring_queue_destroy(NULL);
+        // ring_queue_reserve() / ring_queue_commit() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        void* slot = NULL;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_reserve_config_set(&config);
+        test_ring_queue_commit_config_set(&config);
+
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), NULL, &slot);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        assert(NULL == slot);
+
+        ret = ring_queue_commit(NULL);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+
+        test_ring_queue_config_reset();
     }
     {
-        // *ring_queue_ == NULL -> no-op
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
+        void* saved_memory_pool = NULL;
+        void* slot = NULL;
+
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), NULL, &slot);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_commit(NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_reserve(sizeof(uint16_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint16_t), ring_queue, &slot);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ring_queue->memory_pool = saved_memory_pool;
+
+        assert(NULL == slot);
+        assert(false == ring_queue->reserved);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 正常系
-        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
+        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
+        void* slot = NULL;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-        assert(NULL != ring_queue->memory_pool);
+
+        test_ring_queue_config_reset();
+
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+        assert(NULL == slot);
+
+        test_ring_queue_config_reset();
+
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+
+        test_ring_queue_config_reset();
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 連続 destroy -> no-op
+        // 予約中の操作 -> RING_QUEUE_BAD_OPERATION、予約なしのコミット -> RING_QUEUE_BAD_OPERATION
         ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        void* slot = NULL;
+        void* slot2 = NULL;
+        const uint32_t value = 7U;
+        uint32_t out = 0U;
+        size_t count = 0U;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        assert(0U == ring_queue->len);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(NULL != slot);
+
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot2);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        assert(NULL == slot2);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        ret = ring_queue_push_n(&value, 1U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        ret = ring_queue_pop_n(1U, sizeof(uint32_t), alignof(uint32_t), ring_queue, &out, &count);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        assert(1U == ring_queue->len);
+        assert(0U == out);
+
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(false == ring_queue->reserved);
+        assert(2U == ring_queue->len);
+
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        assert(2U == ring_queue->len);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
+    }
+    {
+        // 正常系: スロットへ直接書き込み -> commit -> pop で書き込んだ値を取り出せる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        void* slot = NULL;
+        uint32_t out = 0U;
+
+        ret = ring_queue_create(3U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        for(uint32_t i = 1U; i <= 3U; ++i) {
+            ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+            assert(RING_QUEUE_SUCCESS == ret);
+            assert(true == ring_queue->reserved);
+            assert(0U == ((uintptr_t)slot % alignof(uint32_t)));
+            *(uint32_t*)slot = i * 10U;
+            ret = ring_queue_commit(ring_queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        assert(3U == ring_queue->len);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+
+        // 満杯での予約 -> 最古のデータ(10)を捨ててスロットを返す
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == ring_queue->len);
+        assert(1U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+        assert(slot == ring_queue->memory_pool);
+        *(uint32_t*)slot = 40U;
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == ring_queue->len);
+        assert(1U == ring_queue->tail);
+
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(20U == out);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(30U == out);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(40U == out);
+        assert(0U == ring_queue->len);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 内部データ破損状態でも ring_queue 本体は破棄され、呼び出し元のポインタは NULL になる
-        memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        // 予約中に最大要素数を格納している -> 破損と判定される
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
+        void* slot = NULL;
 
-        ret_mem = memory_system_allocate(sizeof(ring_queue_t), MEMORY_TAG_RING_QUEUE, (void**)&ring_queue);
-        assert(MEMORY_SYSTEM_SUCCESS == ret_mem);
-        assert(NULL != ring_queue);
-        memset(ring_queue, 0, sizeof(ring_queue_t));
+        ret = ring_queue_create(1U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-        ring_queue->head = 0U;
-        ring_queue->tail = 0U;
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        test_ring_queue_config_reset();
+        ring_queue->len = 1U;
+        assert(true == is_ring_queue_corrupted(ring_queue));
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
         ring_queue->len = 0U;
-        ring_queue->element_align = 1U;
-        ring_queue->max_element_count = 1U;
-        ring_queue->padding = 0U;
-        ring_queue->element_size = 1U;
-        ring_queue->stride = 1U;
-        ring_queue->capacity = 1U;
-        ring_queue->memory_pool = NULL;   // is_ring_queue_corrupted() が true になる条件
+
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(1U == ring_queue->len);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
@@ -800,112 +3129,69 @@ static void NO_COVERAGE test_ring_queue_destroy(void) {
     test_choco_memory_config_reset();
 }
 
-// Generated by ChatGPT 5.4 Thinking
-static void NO_COVERAGE test_ring_queue_push(void) {
+static void NO_COVERAGE test_ring_queue_peek_release(void) {
     test_ring_queue_config_reset();
     test_choco_memory_config_reset();
 
     {
-        // ring_queue_push() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        // ring_queue_peek() / ring_queue_release() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
         ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         test_call_control_t config = {0};
-        uint32_t value = 123U;
+        const void* element = NULL;
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
         config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
-        test_ring_queue_push_config_set(&config);
+        test_ring_queue_peek_config_set(&config);
+        test_ring_queue_release_config_set(&config);
 
-        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), NULL, &element);
         assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        assert(NULL == element);
 
-        test_ring_queue_config_reset();
-    }
-    {
-        // ring_queue_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        uint32_t value = 123U;
+        ret = ring_queue_release(NULL);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
 
-        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        test_ring_queue_config_reset();
     }
     {
-        // data_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
+        void* saved_memory_pool = NULL;
+        const void* element = NULL;
+        const uint32_t value = 7U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-
-        ret = ring_queue_push(NULL, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), NULL, &element);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
 
-        ring_queue_destroy(&ring_queue);
-        assert(NULL == ring_queue);
-    }
-    {
-        // ring_queue_->memory_pool == NULL -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
-        void* saved_memory_pool = NULL;
-        uint32_t value = 123U;
+        ret = ring_queue_release(NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-        assert(NULL != ring_queue->memory_pool);
-
-        saved_memory_pool = ring_queue->memory_pool;
-        ring_queue->memory_pool = NULL;
-
         ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
-
-        ring_queue->memory_pool = saved_memory_pool;
-        ring_queue_destroy(&ring_queue);
-        assert(NULL == ring_queue);
-    }
-    {
-        // element_size_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
-        uint32_t value = 123U;
-
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
 
-        ret = ring_queue_push(&value, sizeof(uint16_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, NULL);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
 
-        ring_queue_destroy(&ring_queue);
-        assert(NULL == ring_queue);
-    }
-    {
-        // element_align_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
-        uint32_t value = 123U;
+        ret = ring_queue_peek(sizeof(uint16_t), alignof(uint32_t), ring_queue, &element);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint16_t), ring_queue, &element);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
 
-        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint16_t), ring_queue);
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, &element);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ring_queue->memory_pool = saved_memory_pool;
+
+        assert(NULL == element);
+        assert(1U == ring_queue->len);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
@@ -914,22 +3200,25 @@ static void NO_COVERAGE test_ring_queue_push(void) {
         // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value = 123U;
+        const void* element = NULL;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
 
         test_ring_queue_config_reset();
 
         s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
         s_test_config_is_ring_queue_corrupted.forced_result = true;
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, &element);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+        assert(NULL == element);
 
-        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        test_ring_queue_config_reset();
+
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+        ret = ring_queue_release(ring_queue);
         assert(RING_QUEUE_DATA_CORRUPTED == ret);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
 
         test_ring_queue_config_reset();
 
@@ -937,99 +3226,138 @@ static void NO_COVERAGE test_ring_queue_push(void) {
         assert(NULL == ring_queue);
     }
     {
-        // 正常系: 1件 push
+        // 空のキュー -> RING_QUEUE_EMPTY
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value = 0x12345678U;
-        uint32_t stored = 0U;
+        const void* element = NULL;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-
-        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
-        assert(RING_QUEUE_SUCCESS == ret);
 
-        assert(0U == ring_queue->head);
-        assert(1U == ring_queue->tail);
-        assert(1U == ring_queue->len);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, &element);
+        assert(RING_QUEUE_EMPTY == ret);
+        assert(NULL == element);
 
-        memcpy(&stored, ring_queue->memory_pool, sizeof(uint32_t));
-        assert(value == stored);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_EMPTY == ret);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 正常系: 複数件 push
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: padding を含む要素の peek -> release を FIFO 順に行い、折り返しも正しく扱う
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value1 = 10U;
-        uint32_t value2 = 20U;
-        uint32_t stored1 = 0U;
-        uint32_t stored2 = 0U;
-        char* mem_ptr = NULL;
+        const uint8_t values[4] = { 0x11U, 0x22U, 0x33U, 0x44U };
+        const void* element = NULL;
+        const void* element2 = NULL;
+        void* slot = NULL;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(3U, sizeof(uint8_t), 4U, &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+        assert(3U == ring_queue->padding);
 
-        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        // 0x11 を上書きし、head = 1, tail = 1, len = 3 (0x22, 0x33, 0x44)
+        ret = ring_queue_push_n(values, 4U, sizeof(uint8_t), 4U, ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+
+        // peek は状態を変えない
+        ret = ring_queue_peek(sizeof(uint8_t), 4U, ring_queue, &element);
         assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_peek(sizeof(uint8_t), 4U, ring_queue, &element2);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(element == element2);
+        assert(0x22U == *(const uint8_t*)element);
+        assert(0U == ((uintptr_t)element % 4U));
+        assert(3U == ring_queue->len);
 
-        assert(0U == ring_queue->head);
-        assert(2U == ring_queue->tail);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
         assert(2U == ring_queue->len);
 
-        mem_ptr = (char*)ring_queue->memory_pool;
-        memcpy(&stored1, mem_ptr + (ring_queue->stride * 0U), sizeof(uint32_t));
-        memcpy(&stored2, mem_ptr + (ring_queue->stride * 1U), sizeof(uint32_t));
+        // 予約中でも peek は可能
+        ret = ring_queue_reserve(sizeof(uint8_t), 4U, ring_queue, &slot);
+        assert(RING_QUEUE_SUCCESS == ret);
+        *(uint8_t*)slot = 0x55U;
+        ret = ring_queue_peek(sizeof(uint8_t), 4U, ring_queue, &element);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0x33U == *(const uint8_t*)element);
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-        assert(value1 == stored1);
-        assert(value2 == stored2);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_peek(sizeof(uint8_t), 4U, ring_queue, &element);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0x44U == *(const uint8_t*)element);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_peek(sizeof(uint8_t), 4U, ring_queue, &element);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0x55U == *(const uint8_t*)element);
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        // 空になったら head / tail は 0 に戻る
+        assert(0U == ring_queue->len);
+        assert(0U == ring_queue->head);
+        assert(0U == ring_queue->tail);
+
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_EMPTY == ret);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // full 状態で push -> 最古要素を上書きし、head を進める
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 参照中(peek後、release前)は push / pop / reserve が RING_QUEUE_BAD_OPERATION となり、状態は変化しない
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value1 = 10U;
-        uint32_t value2 = 20U;
-        uint32_t value3 = 30U;
-        uint32_t stored0 = 0U;
-        uint32_t stored1 = 0U;
-        char* mem_ptr = NULL;
+        const uint32_t values[2] = { 1U, 2U };
+        uint32_t out[2] = { 0U, 0U };
+        size_t count = 0U;
+        const void* element = NULL;
+        void* slot = NULL;
 
-        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
-        assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-
-        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
 
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(2U == ring_queue->len);
-
-        ret = ring_queue_push(&value3, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, &element);
         assert(RING_QUEUE_SUCCESS == ret);
-
-        assert(1U == ring_queue->head);
-        assert(1U == ring_queue->tail);
+        assert(true == ring_queue->peeked);
+
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_push(&values[0], sizeof(uint32_t), alignof(uint32_t), ring_queue));
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue));
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_push_unchecked(&values[0], ring_queue));
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out[0]));
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_pop_n(2U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count));
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_pop_unchecked(ring_queue, &out[0]));
+        assert(RING_QUEUE_BAD_OPERATION == ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot));
+        assert(NULL == slot);
+        assert(0U == out[0]);
         assert(2U == ring_queue->len);
+        assert(0U == ring_queue->head);
+        assert(2U == ring_queue->tail);
+        assert(1U == *(const uint32_t*)element);
 
-        mem_ptr = (char*)ring_queue->memory_pool;
-        memcpy(&stored0, mem_ptr + (ring_queue->stride * 0U), sizeof(uint32_t));
-        memcpy(&stored1, mem_ptr + (ring_queue->stride * 1U), sizeof(uint32_t));
+        // 参照中に空になっている -> 破損と判定される
+        test_ring_queue_config_reset();
+        ring_queue->len = 0U;
+        ring_queue->tail = 0U;
+        assert(true == is_ring_queue_corrupted(ring_queue));
+        ring_queue->len = 2U;
+        ring_queue->tail = 2U;
+        assert(false == is_ring_queue_corrupted(ring_queue));
 
-        assert(value3 == stored0);
-        assert(value2 == stored1);
+        // release で参照が解除され、以降の操作は可能
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(false == ring_queue->peeked);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out[0]);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == out[0]);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
@@ -1039,298 +3367,474 @@ static void NO_COVERAGE test_ring_queue_push(void) {
     test_choco_memory_config_reset();
 }
 
-// Generated by ChatGPT 5.4 Thinking
-static void NO_COVERAGE test_ring_queue_pop(void) {
+static void NO_COVERAGE test_ring_queue_overflow_policy(void) {
     test_ring_queue_config_reset();
     test_choco_memory_config_reset();
 
     {
-        // ring_queue_pop() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        // ring_queue_set_overflow_policy() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
         ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         test_call_control_t config = {0};
-        uint32_t out = 0U;
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
         config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
-        test_ring_queue_pop_config_set(&config);
+        test_ring_queue_set_overflow_policy_config_set(&config);
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST, 0U, NULL);
         assert(RING_QUEUE_RUNTIME_ERROR == ret);
-        assert(0U == out);
 
         test_ring_queue_config_reset();
     }
     {
-        // ring_queue_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT, 内部データ破損 -> RING_QUEUE_DATA_CORRUPTED
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        uint32_t out = 0U;
+        ring_queue_t* ring_queue = NULL;
+        void* saved_memory_pool = NULL;
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST, 0U, NULL);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == out);
-    }
-    {
-        // data_ == NULL -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+        assert(RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST == ring_queue->overflow_policy);
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, NULL);
+        ret = ring_queue_set_overflow_policy((ring_queue_overflow_policy_t)99, 0U, ring_queue);
         assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, 3U, ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST, 0U, ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ring_queue->memory_pool = saved_memory_pool;
+
+        test_ring_queue_config_reset();
+        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
+        s_test_config_is_ring_queue_corrupted.forced_result = true;
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST, 0U, ring_queue);
+        assert(RING_QUEUE_DATA_CORRUPTED == ret);
+        test_ring_queue_config_reset();
+
+        assert(RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST == ring_queue->overflow_policy);
+
+        // 範囲外のポリシー、拡張上限が最大要素数未満 -> 破損と判定される
+        ring_queue->overflow_policy = (ring_queue_overflow_policy_t)99;
+        assert(true == is_ring_queue_corrupted(ring_queue));
+        ring_queue->overflow_policy = RING_QUEUE_OVERFLOW_POLICY_GROW;
+        ring_queue->grow_limit = 3U;
+        assert(true == is_ring_queue_corrupted(ring_queue));
+        ring_queue->grow_limit = 4U;
+        assert(false == is_ring_queue_corrupted(ring_queue));
+
+        ring_queue_destroy(&ring_queue);
+        assert(NULL == ring_queue);
+    }
+    {
+        // RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST: push / push_unchecked / reserve / push_n は新しいデータを捨てる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        ring_queue_t* ring_queue = NULL;
+        const uint32_t values[4] = { 1U, 2U, 3U, 4U };
+        uint32_t out[4] = { 0U, 0U, 0U, 0U };
+        size_t count = 0U;
+        void* slot = NULL;
+
+        ret = ring_queue_create(3U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_REJECT_NEWEST, 100U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0U == ring_queue->grow_limit);
+
+        // 空き 3 に対して 4 個 -> 先頭 3 個のみ格納し RING_QUEUE_FULL
+        ret = ring_queue_push_n(values, 4U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_FULL == ret);
+        assert(3U == ring_queue->len);
+        assert(1U == ring_queue->stats.drop_count);
+
+        ret = ring_queue_push(&values[3], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_FULL == ret);
+        ret = ring_queue_push_unchecked(&values[3], ring_queue);
+        assert(RING_QUEUE_FULL == ret);
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_FULL == ret);
+        assert(NULL == slot);
+        assert(false == ring_queue->reserved);
+        ret = ring_queue_push_n(&values[3], 1U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_FULL == ret);
+        assert(5U == ring_queue->stats.drop_count);
+        assert(3U == ring_queue->stats.push_count);
+
+        ret = ring_queue_pop_n(4U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == count);
+        assert(1U == out[0]);
+        assert(2U == out[1]);
+        assert(3U == out[2]);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // ring_queue_->memory_pool == NULL -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // RING_QUEUE_OVERFLOW_POLICY_GROW: 折り返した状態から拡張しても FIFO 順が保たれ、上限到達後は拒否する
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        void* saved_memory_pool = NULL;
         uint32_t out = 0U;
+        const uint32_t values[6] = { 10U, 11U, 12U, 13U, 14U, 15U };
+        void* slot = NULL;
 
         ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-        assert(NULL != ring_queue->memory_pool);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, 10U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
 
-        saved_memory_pool = ring_queue->memory_pool;
-        ring_queue->memory_pool = NULL;
+        // head = 2, tail = 2, len = 4 (3, 4, 5, 6) の折り返し状態を作る
+        for(uint32_t i = 1U; i <= 4U; ++i) {
+            ret = ring_queue_push(&i, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        for(uint32_t i = 1U; i <= 2U; ++i) {
+            ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        for(uint32_t i = 5U; i <= 6U; ++i) {
+            ret = ring_queue_push(&i, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+            assert(RING_QUEUE_SUCCESS == ret);
+        }
+        assert(2U == ring_queue->head);
+        assert(2U == ring_queue->tail);
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == out);
+        // 満杯での push -> 4 から 8 へ拡張 (マスク演算も引き継ぐ)
+        ret = ring_queue_push_unchecked(&values[1], ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(8U == ring_queue->max_element_count);
+        assert(7U == ring_queue->index_mask);
+        assert(8U * sizeof(uint32_t) == ring_queue->capacity);
         assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
-
-        ring_queue->memory_pool = saved_memory_pool;
-        ring_queue_destroy(&ring_queue);
-        assert(NULL == ring_queue);
-    }
-    {
-        // element_size_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
-        ring_queue_t* ring_queue = NULL;
-        uint32_t out = 0U;
+        assert(5U == ring_queue->tail);
+        assert(5U == ring_queue->len);
+        assert(1U == ring_queue->stats.grow_count);
+        assert(false == is_ring_queue_corrupted(ring_queue));
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        // 残り 3 の空きに 4 個 -> 上限 10 まで拡張 (2 のべき乗ではないため剰余演算に切り替わる)
+        ret = ring_queue_push_n(values, 4U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+        assert(10U == ring_queue->max_element_count);
+        assert(0U == ring_queue->index_mask);
+        assert(9U == ring_queue->len);
+        assert(2U == ring_queue->stats.grow_count);
 
-        ret = ring_queue_pop(sizeof(uint16_t), alignof(uint32_t), ring_queue, &out);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == out);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        // 上限到達後 -> 空き 1 個分のみ格納し、残りは拒否
+        ret = ring_queue_reserve(sizeof(uint32_t), alignof(uint32_t), ring_queue, &slot);
+        assert(RING_QUEUE_SUCCESS == ret);
+        *(uint32_t*)slot = 99U;
+        ret = ring_queue_commit(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&values[5], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_FULL == ret);
+        assert(10U == ring_queue->len);
+        assert(1U == ring_queue->stats.drop_count);
+        assert(10U == ring_queue->stats.peak_len);
+
+        {
+            const uint32_t expected[10] = { 3U, 4U, 5U, 6U, 11U, 10U, 11U, 12U, 13U, 99U };
+            for(size_t i = 0; i != 10U; ++i) {
+                ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+                assert(RING_QUEUE_SUCCESS == ret);
+                assert(expected[i] == out);
+            }
+        }
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // element_align_ 不一致 -> RING_QUEUE_INVALID_ARGUMENT
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // RING_QUEUE_OVERFLOW_POLICY_GROW: メモリ確保失敗 -> エラーを返し、キューの状態は変化しない
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t out = 0U;
+        test_call_control_t config = {0};
+        const uint32_t value = 7U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(1U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint16_t), ring_queue, &out);
-        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
-        assert(0U == out);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        // 呼び出し回数をリセットし、拡張時の memory_system_allocate() を失敗させる
+        test_choco_memory_config_reset();
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_allocate_config_set(&config);
+
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_NO_MEMORY == ret);
+        assert(1U == ring_queue->max_element_count);
+        assert(1U == ring_queue->len);
+        assert(0U == ring_queue->stats.grow_count);
+        assert(0U == ring_queue->stats.drop_count);
+
+        test_choco_memory_config_reset();
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // is_ring_queue_corrupted() が true を返す -> RING_QUEUE_DATA_CORRUPTED
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // RING_QUEUE_OVERFLOW_POLICY_GROW: 拡張後のメモリプールサイズがオーバーフローする -> RING_QUEUE_OVERFLOW
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t out = 0U;
+        const uint32_t value = 7U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(1U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, SIZE_MAX, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-
-        test_ring_queue_config_reset();
-
-        s_test_config_is_ring_queue_corrupted.fail_on_call = 1U;
-        s_test_config_is_ring_queue_corrupted.forced_result = true;
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
-        assert(RING_QUEUE_DATA_CORRUPTED == ret);
-        assert(0U == out);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        ret = ring_queue_push_n(&value, 1U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == ring_queue->max_element_count);
 
-        test_ring_queue_config_reset();
+        ret = grow_pool(SIZE_MAX, ring_queue);
+        assert(RING_QUEUE_OVERFLOW == ret);
+        assert(2U == ring_queue->max_element_count);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 空キュー -> RING_QUEUE_EMPTY
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // ポリシー切り替え: GROW から OVERWRITE_OLDEST に戻すと拡張後の容量で上書きを行う
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t out = 0xFFFFFFFFU;
+        const uint32_t values[5] = { 1U, 2U, 3U, 4U, 5U };
+        uint32_t out[4] = { 0U, 0U, 0U, 0U };
+        size_t count = 0U;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, 4U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push_n(values, 4U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(4U == ring_queue->max_element_count);
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
-        assert(RING_QUEUE_EMPTY == ret);
-        assert(0xFFFFFFFFU == out);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST, 0U, ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&values[4], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(4U == ring_queue->max_element_count);
+        assert(1U == ring_queue->stats.drop_count);
+
+        ret = ring_queue_pop_n(4U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(4U == count);
+        assert(2U == out[0]);
+        assert(5U == out[3]);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 正常系: 1件 pop して空になったら head/tail が 0 に戻る
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // RING_QUEUE_OVERFLOW_POLICY_OVERWRITE_OLDEST: 参照中の満杯キューへの push は拒否され、参照中の要素は上書きされない
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value = 0x12345678U;
+        const uint32_t values[3] = { 1U, 2U, 3U };
         uint32_t out = 0U;
+        const void* element = NULL;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
 
-        ret = ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, &element);
         assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&values[2], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
         assert(0U == ring_queue->head);
-        assert(1U == ring_queue->tail);
-        assert(1U == ring_queue->len);
+        assert(2U == ring_queue->len);
+        assert(0U == ring_queue->stats.drop_count);
+        assert(1U == *(const uint32_t*)element);
 
+        // release で取り除かれるのは参照した要素
+        ret = ring_queue_release(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_push(&values[2], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
         ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(value == out);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        assert(2U == out);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == out);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // 正常系: 複数件 pop して FIFO を確認
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // RING_QUEUE_OVERFLOW_POLICY_GROW: 参照中の満杯キューへの push は拒否され、メモリプールは再確保されない
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value1 = 10U;
-        uint32_t value2 = 20U;
-        uint32_t out1 = 0U;
-        uint32_t out2 = 0U;
+        const uint32_t values[4] = { 1U, 2U, 3U, 4U };
+        uint32_t out[3] = { 0U, 0U, 0U };
+        size_t count = 0U;
+        const void* element = NULL;
+        void* saved_memory_pool = NULL;
 
-        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-
-        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_set_overflow_policy(RING_QUEUE_OVERFLOW_POLICY_GROW, 8U, ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_push_n(values, 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
 
-        assert(0U == ring_queue->head);
-        assert(2U == ring_queue->tail);
-        assert(2U == ring_queue->len);
-
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out1);
+        ret = ring_queue_peek(sizeof(uint32_t), alignof(uint32_t), ring_queue, &element);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(value1 == out1);
-        assert(1U == ring_queue->head);
-        assert(2U == ring_queue->tail);
-        assert(1U == ring_queue->len);
+        saved_memory_pool = ring_queue->memory_pool;
+        ret = ring_queue_push(&values[2], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        ret = ring_queue_push_n(&values[2], 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_BAD_OPERATION == ret);
+        assert(saved_memory_pool == ring_queue->memory_pool);
+        assert(2U == ring_queue->max_element_count);
+        assert(0U == ring_queue->stats.grow_count);
+        assert(1U == *(const uint32_t*)element);
 
-        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out2);
+        // release 後は拡張して格納できる
+        ret = ring_queue_release(ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(value2 == out2);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        ret = ring_queue_push_n(&values[2], 2U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(4U == ring_queue->max_element_count);
+        assert(1U == ring_queue->stats.grow_count);
+        ret = ring_queue_pop_n(3U, sizeof(uint32_t), alignof(uint32_t), ring_queue, out, &count);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(3U == count);
+        assert(2U == out[0]);
+        assert(3U == out[1]);
+        assert(4U == out[2]);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
+
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_ring_queue_stats(void) {
+    test_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // ring_queue_stats_get() / ring_queue_stats_reset() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+        ring_queue_stats_t stats = {0};
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_ring_queue_stats_get_config_set(&config);
+        test_ring_queue_stats_reset_config_set(&config);
+
+        ret = ring_queue_stats_get(NULL, &stats);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+        ret = ring_queue_stats_reset(NULL);
+        assert(RING_QUEUE_RUNTIME_ERROR == ret);
+
+        test_ring_queue_config_reset();
+    }
     {
-        // 正常系: padding を含む要素でも FIFO で取り出せる
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT (out_stats_ は不変)
         ring_queue_result_t ret = RING_QUEUE_SUCCESS;
         ring_queue_t* ring_queue = NULL;
-        uint8_t value1 = 0x11U;
-        uint8_t value2 = 0x22U;
-        uint8_t out1 = 0U;
-        uint8_t out2 = 0U;
+        void* saved_memory_pool = NULL;
+        ring_queue_stats_t stats = {0};
 
-        ret = ring_queue_create(3U, sizeof(uint8_t), 4U, &ring_queue);
-        assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
-        assert(3U == ring_queue->padding);
-        assert(4U == ring_queue->stride);
+        stats.push_count = 123U;
+        ret = ring_queue_stats_get(NULL, &stats);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_stats_reset(NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
 
-        ret = ring_queue_push(&value1, sizeof(uint8_t), 4U, ring_queue);
-        assert(RING_QUEUE_SUCCESS == ret);
-        ret = ring_queue_push(&value2, sizeof(uint8_t), 4U, ring_queue);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
 
-        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out1);
-        assert(RING_QUEUE_SUCCESS == ret);
-        assert(value1 == out1);
+        ret = ring_queue_stats_get(ring_queue, NULL);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
 
-        ret = ring_queue_pop(sizeof(uint8_t), 4U, ring_queue, &out2);
-        assert(RING_QUEUE_SUCCESS == ret);
-        assert(value2 == out2);
-        assert(0U == ring_queue->head);
-        assert(0U == ring_queue->tail);
-        assert(0U == ring_queue->len);
+        saved_memory_pool = ring_queue->memory_pool;
+        ring_queue->memory_pool = NULL;
+        ret = ring_queue_stats_get(ring_queue, &stats);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ret = ring_queue_stats_reset(ring_queue);
+        assert(RING_QUEUE_INVALID_ARGUMENT == ret);
+        ring_queue->memory_pool = saved_memory_pool;
+
+        assert(123U == stats.push_count);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
     }
     {
-        // full 状態で上書き後に pop -> 最古要素ではなく次の要素が返る
-        ring_queue_result_t ret = RING_QUEUE_SUCCESS;
+        // 正常系: push / pop / 上書きの計上とリセット
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
         ring_queue_t* ring_queue = NULL;
-        uint32_t value1 = 10U;
-        uint32_t value2 = 20U;
-        uint32_t value3 = 30U;
+        ring_queue_stats_t stats = {0};
+        const uint32_t values[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
         uint32_t out = 0U;
 
-        ret = ring_queue_create(2U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
+        ret = ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(NULL != ring_queue);
 
-        ret = ring_queue_push(&value1, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_stats_get(ring_queue, &stats);
         assert(RING_QUEUE_SUCCESS == ret);
-        ret = ring_queue_push(&value2, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(0U == stats.push_count);
+        assert(0U == stats.drop_count);
+        assert(0U == stats.peak_len);
+        assert(0U == stats.grow_count);
+        assert(4U == stats.max_element_count);
+
+        ret = ring_queue_push(&values[0], sizeof(uint32_t), alignof(uint32_t), ring_queue);
         assert(RING_QUEUE_SUCCESS == ret);
-        ret = ring_queue_push(&value3, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        ret = ring_queue_push(&values[1], sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
         assert(RING_QUEUE_SUCCESS == ret);
 
-        assert(1U == ring_queue->head);
-        assert(1U == ring_queue->tail);
-        assert(2U == ring_queue->len);
+        ret = ring_queue_stats_get(ring_queue, &stats);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(2U == stats.push_count);
+        assert(0U == stats.drop_count);
+        assert(2U == stats.peak_len);
+
+        // 1 個格納済みに 6 個 -> 先頭 2 個は容量超過で、さらに 1 個は上書きで捨てられる
+        ret = ring_queue_push_n(values, 6U, sizeof(uint32_t), alignof(uint32_t), ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+
+        ret = ring_queue_stats_get(ring_queue, &stats);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(6U == stats.push_count);
+        assert(3U == stats.drop_count);
+        assert(4U == stats.peak_len);
 
         ret = ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), ring_queue, &out);
         assert(RING_QUEUE_SUCCESS == ret);
-        assert(value2 == out);
-        assert(0U == ring_queue->head);
-        assert(1U == ring_queue->tail);
-        assert(1U == ring_queue->len);
+        assert(3U == out);
+
+        ret = ring_queue_stats_reset(ring_queue);
+        assert(RING_QUEUE_SUCCESS == ret);
+        ret = ring_queue_stats_get(ring_queue, &stats);
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(0U == stats.push_count);
+        assert(0U == stats.drop_count);
+        assert(3U == stats.peak_len);
+        assert(0U == stats.grow_count);
 
         ring_queue_destroy(&ring_queue);
         assert(NULL == ring_queue);
@@ -1959,6 +4463,11 @@ static void NO_COVERAGE test_rslt_to_str(void) {
         assert(NULL != str);
         assert(0 == strcmp("EMPTY", str));
     }
+    {
+        const char* str = rslt_to_str(RING_QUEUE_FULL);
+        assert(NULL != str);
+        assert(0 == strcmp("FULL", str));
+    }
     {
         const char* str = rslt_to_str((ring_queue_result_t)999);
         assert(NULL != str);
@@ -0,0 +1,1181 @@
+/** @ingroup containers
+ *
+ * @file sparse_set.c
+ * @author chocolate-pie24
+ * @brief 容量固定の整数ID集合を、登録中のIDを密に走査できる形で管理するスパースセットモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset
+
+#include "engine/containers/sparse_set.h"
+
+#include "engine/core/memory/choco_memory.h"
+#include "engine/core/memory/linear_allocator.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <stdlib.h> // for malloc, free
+#include "engine/containers/test_sparse_set.h"
+#include "engine/core/memory/test_choco_memory.h"
+#include "engine/core/memory/test_linear_allocator.h"
+
+// sparse_setモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_sparse_set_create;     /**< sparse_set_create()テスト設定 */
+static test_call_control_t s_test_config_sparse_set_initialize; /**< sparse_set_initialize()テスト設定 */
+static test_call_control_t s_test_config_sparse_set_acquire;    /**< sparse_set_acquire()テスト設定 */
+
+// プライベート関数テスト設定
+static test_call_control_bool_t s_test_config_is_sparse_set_corrupted;  /**< is_sparse_set_corrupted()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_sparse_set_create(void);
+static void test_sparse_set_preinit(void);
+static void test_sparse_set_initialize(void);
+static void test_sparse_set_destroy(void);
+static void test_sparse_set_acquire(void);
+static void test_sparse_set_insert(void);
+static void test_sparse_set_remove(void);
+static void test_sparse_set_clear(void);
+static void test_sparse_set_stress(void);
+static void test_rslt_convert_mem_sys(void);
+static void test_rslt_convert_linear_alloc(void);
+static void test_is_sparse_set_corrupted(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief sparse_set_t内部データ構造
+ *
+ * @note
+ * dense(密配列)は0〜max_id_count - 1の並べ替えで、先頭count個が登録中のID、以降が未登録のID。
+ * sparse(疎配列)はIDからdense内の位置への対応表で、常にsparse[dense[i]] == iが成り立つ。
+ * IDの登録/返却はdense内の2要素の入れ替えとcountの増減のみで行う
+ */
+struct sparse_set {
+    size_t max_id_count;    /**< 管理するID数 */
+    size_t count;           /**< 登録中のID数 */
+    size_t array_size;      /**< dense/sparseを合わせたメモリ領域のサイズ(byte) */
+    bool owns_memory;       /**< true: メモリシステムから確保 / false: リニアアロケータから確保(個別解放しない) */
+    uint32_t* dense;        /**< 密配列(max_id_count) */
+    uint32_t* sparse;       /**< 疎配列(max_id_count、denseと同一領域の後半) */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< スパースセットAPI実行結果コード(処理成功)に対応する文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< スパースセットAPI実行結果コード(無効な引数)に対応する文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< スパースセットAPI実行結果コード(メモリ不足)に対応する文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< スパースセットAPI実行結果コード(実行時エラー)に対応する文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< スパースセットAPI実行結果コード(未定義エラー)に対応する文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< スパースセットAPI実行結果コード(システム使用可能範囲上限超過)に対応する文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< スパースセットAPI実行結果コード(API誤用)に対応する文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< スパースセットAPI実行結果コード(内部データ破損)に対応する文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< スパースセットAPI実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
+static const char* const s_rslt_str_id_not_found = "ID_NOT_FOUND";          /**< スパースセットAPI実行結果コード(ID未登録)に対応する文字列 */
+static const char* const s_rslt_str_id_exists = "ID_EXISTS";                /**< スパースセットAPI実行結果コード(ID登録済み)に対応する文字列 */
+
+static sparse_set_result_t array_size_compute(size_t max_id_count_, const char* func_name_, size_t* out_array_size_);
+static void sparse_set_setup(size_t max_id_count_, size_t array_size_, uint32_t* array_, sparse_set_t* sparse_set_);
+static void dense_swap(size_t pos_a_, size_t pos_b_, sparse_set_t* sparse_set_);
+static bool is_sparse_set_corrupted(const sparse_set_t* sparse_set_);
+static const char* rslt_to_str(sparse_set_result_t rslt_);
+static sparse_set_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+static sparse_set_result_t rslt_convert_linear_alloc(linear_allocator_result_t rslt_);
+
+sparse_set_result_t sparse_set_create(size_t max_id_count_, sparse_set_t** sparse_set_) {
+#ifdef TEST_BUILD
+    s_test_config_sparse_set_create.call_count++;
+    if(s_test_config_sparse_set_create.fail_on_call != 0) {
+        if(s_test_config_sparse_set_create.call_count == s_test_config_sparse_set_create.fail_on_call) {
+            return (sparse_set_result_t)s_test_config_sparse_set_create.forced_result;
+        }
+    }
+#endif
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    sparse_set_t* tmp_set = NULL;
+    uint32_t* tmp_array = NULL;
+    size_t array_size = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_create", "sparse_set_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_create", "*sparse_set_")
+    ret = array_size_compute(max_id_count_, "sparse_set_create", &array_size);
+    if(SPARSE_SET_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // Simulation.
+    ret_mem = memory_system_allocate(sizeof(*tmp_set), MEMORY_TAG_CONTAINER, (void**)&tmp_set);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("sparse_set_create(%s) - Failed to allocate sparse set memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_mem = memory_system_allocate(array_size, MEMORY_TAG_CONTAINER, (void**)&tmp_array);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("sparse_set_create(%s) - Failed to allocate id array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    sparse_set_setup(max_id_count_, array_size, tmp_array, tmp_set);
+    tmp_set->owns_memory = true;
+    *sparse_set_ = tmp_set;
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    if(SPARSE_SET_SUCCESS != ret) {
+        if(NULL != tmp_set) {
+            memory_system_free(tmp_set, sizeof(*tmp_set), MEMORY_TAG_CONTAINER);
+            tmp_set = NULL;
+        }
+    }
+    return ret;
+}
+
+sparse_set_result_t sparse_set_preinit(size_t max_id_count_, size_t* io_pool_requirement_) {
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    size_t array_size = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_preinit", "io_pool_requirement_")
+    ret = array_size_compute(max_id_count_, "sparse_set_preinit", &array_size);
+    if(SPARSE_SET_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // sparse_set_initializeと同じ順序で加算する
+    ret_linear_alloc = linear_allocator_requirement_add(sizeof(sparse_set_t), alignof(sparse_set_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(array_size, alignof(uint32_t), io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        // NOTE: requirement_addは加算結果のオーバーフローのみで失敗する(引数は検証済み)
+        ret = SPARSE_SET_OVERFLOW;
+        ERROR_MESSAGE("sparse_set_preinit(%s) - Failed to accumulate pool requirement.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+sparse_set_result_t sparse_set_initialize(size_t max_id_count_, linear_alloc_t* allocator_, sparse_set_t** sparse_set_) {
+#ifdef TEST_BUILD
+    s_test_config_sparse_set_initialize.call_count++;
+    if(s_test_config_sparse_set_initialize.fail_on_call != 0) {
+        if(s_test_config_sparse_set_initialize.call_count == s_test_config_sparse_set_initialize.fail_on_call) {
+            return (sparse_set_result_t)s_test_config_sparse_set_initialize.forced_result;
+        }
+    }
+#endif
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    sparse_set_t* tmp_set = NULL;
+    uint32_t* tmp_array = NULL;
+    size_t array_size = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_initialize", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_initialize", "sparse_set_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_initialize", "*sparse_set_")
+    ret = array_size_compute(max_id_count_, "sparse_set_initialize", &array_size);
+    if(SPARSE_SET_SUCCESS != ret) {
+        goto cleanup;
+    }
+
+    // Simulation.
+    ret_linear_alloc = linear_allocator_allocate(allocator_, sizeof(sparse_set_t), alignof(sparse_set_t), (void**)&tmp_set);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("sparse_set_initialize(%s) - Failed to allocate sparse set memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_linear_alloc = linear_allocator_allocate(allocator_, array_size, alignof(uint32_t), (void**)&tmp_array);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("sparse_set_initialize(%s) - Failed to allocate id array memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    sparse_set_setup(max_id_count_, array_size, tmp_array, tmp_set);
+    tmp_set->owns_memory = false;
+    *sparse_set_ = tmp_set;
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    // リニアアロケータで確保したメモリは個別解放不可であるためクリーンナップ処理はなし
+    return ret;
+}
+
+void sparse_set_destroy(sparse_set_t** sparse_set_) {
+    if(NULL == sparse_set_) {
+        goto cleanup;
+    }
+    if(NULL == *sparse_set_) {
+        goto cleanup;
+    }
+    if(!(*sparse_set_)->owns_memory) {
+        // リニアアロケータから確保したメモリはリニアアロケータごと破棄される
+        *sparse_set_ = NULL;
+        goto cleanup;
+    }
+    if(!is_sparse_set_corrupted(*sparse_set_)) { // 内部データが破損していた場合にfreeするのは危険
+        memory_system_free((*sparse_set_)->dense, (*sparse_set_)->array_size, MEMORY_TAG_CONTAINER);
+    } else {
+        WARN_MESSAGE("sparse_set_destroy - Provided sparse_set_ is corrupted.");
+    }
+
+    memory_system_free(*sparse_set_, sizeof(sparse_set_t), MEMORY_TAG_CONTAINER);
+    *sparse_set_ = NULL;
+cleanup:
+    return;
+}
+
+sparse_set_result_t sparse_set_acquire(sparse_set_t* sparse_set_, uint32_t* out_id_) {
+#ifdef TEST_BUILD
+    s_test_config_sparse_set_acquire.call_count++;
+    if(s_test_config_sparse_set_acquire.fail_on_call != 0) {
+        if(s_test_config_sparse_set_acquire.call_count == s_test_config_sparse_set_acquire.fail_on_call) {
+            return (sparse_set_result_t)s_test_config_sparse_set_acquire.forced_result;
+        }
+    }
+#endif
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_acquire", "sparse_set_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_id_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_acquire", "out_id_")
+    if(is_sparse_set_corrupted(sparse_set_)) {
+        ret = SPARSE_SET_DATA_CORRUPTED;
+        ERROR_MESSAGE("sparse_set_acquire(%s) - Provided sparse set is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(sparse_set_->count >= sparse_set_->max_id_count) {
+        ret = SPARSE_SET_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("sparse_set_acquire(%s) - All ids are in use.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit.
+    // 未登録領域の先頭のIDは、countを1つ進めるだけで登録済みになる
+    *out_id_ = sparse_set_->dense[sparse_set_->count];
+    sparse_set_->count++;
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+sparse_set_result_t sparse_set_insert(uint32_t id_, sparse_set_t* sparse_set_) {
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_insert", "sparse_set_")
+    if(is_sparse_set_corrupted(sparse_set_)) {
+        ret = SPARSE_SET_DATA_CORRUPTED;
+        ERROR_MESSAGE("sparse_set_insert(%s) - Provided sparse set is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP((size_t)id_ < sparse_set_->max_id_count, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_insert", "id_")
+    if((size_t)sparse_set_->sparse[id_] < sparse_set_->count) {
+        ret = SPARSE_SET_ID_EXISTS;
+        ERROR_MESSAGE("sparse_set_insert(%s) - Provided id '%u' is already in use.", rslt_to_str(ret), (unsigned int)id_);
+        goto cleanup;
+    }
+
+    // commit.
+    // id_を未登録領域の先頭に移動してから登録済み領域に取り込む
+    dense_swap((size_t)sparse_set_->sparse[id_], sparse_set_->count, sparse_set_);
+    sparse_set_->count++;
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+sparse_set_result_t sparse_set_remove(uint32_t id_, sparse_set_t* sparse_set_) {
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(sparse_set_, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_remove", "sparse_set_")
+    if(is_sparse_set_corrupted(sparse_set_)) {
+        ret = SPARSE_SET_DATA_CORRUPTED;
+        ERROR_MESSAGE("sparse_set_remove(%s) - Provided sparse set is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP((size_t)id_ < sparse_set_->max_id_count, ret, SPARSE_SET_INVALID_ARGUMENT, rslt_to_str(SPARSE_SET_INVALID_ARGUMENT), "sparse_set_remove", "id_")
+    if((size_t)sparse_set_->sparse[id_] >= sparse_set_->count) {
+        ret = SPARSE_SET_ID_NOT_FOUND;
+        ERROR_MESSAGE("sparse_set_remove(%s) - Provided id '%u' is not in use.", rslt_to_str(ret), (unsigned int)id_);
+        goto cleanup;
+    }
+
+    // commit.
+    // 登録済み領域の末尾のIDと入れ替えてから登録済み領域を縮める
+    dense_swap((size_t)sparse_set_->sparse[id_], sparse_set_->count - 1, sparse_set_);
+    sparse_set_->count--;
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+bool sparse_set_contains(uint32_t id_, const sparse_set_t* sparse_set_) {
+    if(NULL == sparse_set_ || NULL == sparse_set_->sparse) {
+        return false;
+    }
+    if((size_t)id_ >= sparse_set_->max_id_count) {
+        return false;
+    }
+    return (size_t)sparse_set_->sparse[id_] < sparse_set_->count;
+}
+
+void sparse_set_clear(sparse_set_t* sparse_set_) {
+    if(NULL == sparse_set_) {
+        return;
+    }
+    // denseは常に全IDの並べ替えであるため、countを0にするだけで全IDが未登録になる
+    sparse_set_->count = 0;
+}
+
+size_t sparse_set_count(const sparse_set_t* sparse_set_) {
+    return (NULL == sparse_set_) ? 0 : sparse_set_->count;
+}
+
+const uint32_t* sparse_set_dense(const sparse_set_t* sparse_set_) {
+    return (NULL == sparse_set_) ? NULL : sparse_set_->dense;
+}
+
+/**
+ * @brief 管理ID数max_id_count_を検証し、dense/sparseに必要なメモリ領域のサイズを算出する(sparse_set_create / sparse_set_preinit / sparse_set_initialize共通処理)
+ *
+ * @param[in] max_id_count_ 管理するID数
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元API名
+ * @param[out] out_array_size_ 算出したサイズ(byte)の格納先
+ *
+ * @retval SPARSE_SET_INVALID_ARGUMENT 0 == max_id_count_、またはmax_id_count_ > SPARSE_SET_MAX_ID_COUNT
+ * @retval SPARSE_SET_OVERFLOW サイズの算出でオーバーフローが発生
+ * @retval SPARSE_SET_SUCCESS 算出に成功し、正常終了
+ */
+static sparse_set_result_t array_size_compute(size_t max_id_count_, const char* func_name_, size_t* out_array_size_) {
+    sparse_set_result_t ret = SPARSE_SET_INVALID_ARGUMENT;
+
+    if(0 == max_id_count_ || max_id_count_ > SPARSE_SET_MAX_ID_COUNT) {
+        ret = SPARSE_SET_INVALID_ARGUMENT;
+        ERROR_MESSAGE("%s(%s) - Argument 'max_id_count_' is out of range.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(SIZE_MAX / (sizeof(uint32_t) * 2) < max_id_count_) {
+        ret = SPARSE_SET_OVERFLOW;
+        ERROR_MESSAGE("%s(%s) - Provided 'max_id_count_' is too large.", func_name_, rslt_to_str(ret));
+        goto cleanup;
+    }
+    *out_array_size_ = sizeof(uint32_t) * 2 * max_id_count_;
+
+    ret = SPARSE_SET_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリ確保済みのスパースセットの管理変数を設定し、全IDを未登録にする(sparse_set_create / sparse_set_initialize共通処理)
+ *
+ * @note owns_memoryは呼び出し側で設定する。denseとsparseは恒等な並べ替え(dense[i] == sparse[i] == i)で初期化する
+ *
+ * @param[in] max_id_count_ 管理するID数
+ * @param[in] array_size_ array_のサイズ(byte)
+ * @param[in] array_ dense/sparseに使用するメモリ領域(max_id_count_ * 2個のuint32_t)
+ * @param[in,out] sparse_set_ 設定対象スパースセット
+ */
+static void sparse_set_setup(size_t max_id_count_, size_t array_size_, uint32_t* array_, sparse_set_t* sparse_set_) {
+    memset(sparse_set_, 0, sizeof(*sparse_set_));
+    sparse_set_->max_id_count = max_id_count_;
+    sparse_set_->count = 0;
+    sparse_set_->array_size = array_size_;
+    sparse_set_->dense = array_;
+    sparse_set_->sparse = array_ + max_id_count_;
+    for(size_t i = 0; i != max_id_count_; ++i) {
+        sparse_set_->dense[i] = (uint32_t)i;
+        sparse_set_->sparse[i] = (uint32_t)i;
+    }
+}
+
+/**
+ * @brief dense内の位置pos_a_とpos_b_のIDを入れ替え、sparseの対応を更新する
+ *
+ * @param[in] pos_a_ 入れ替え対象位置
+ * @param[in] pos_b_ 入れ替え対象位置
+ * @param[in,out] sparse_set_ 対象スパースセット
+ */
+static void dense_swap(size_t pos_a_, size_t pos_b_, sparse_set_t* sparse_set_) {
+    const uint32_t id_a = sparse_set_->dense[pos_a_];
+    const uint32_t id_b = sparse_set_->dense[pos_b_];
+
+    sparse_set_->dense[pos_a_] = id_b;
+    sparse_set_->dense[pos_b_] = id_a;
+    sparse_set_->sparse[id_a] = (uint32_t)pos_b_;
+    sparse_set_->sparse[id_b] = (uint32_t)pos_a_;
+}
+
+/**
+ * @brief メモリシステム実行結果コードをスパースセット実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return sparse_set_result_t 変換されたスパースセット実行結果コード
+ */
+static sparse_set_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return SPARSE_SET_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return SPARSE_SET_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return SPARSE_SET_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return SPARSE_SET_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return SPARSE_SET_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return SPARSE_SET_BAD_OPERATION;
+    default:
+        return SPARSE_SET_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief リニアアロケータ実行結果コードをスパースセット実行結果コードに変換する
+ *
+ * @param[in] rslt_ リニアアロケータ実行結果コード
+ * @return sparse_set_result_t 変換されたスパースセット実行結果コード
+ */
+static sparse_set_result_t rslt_convert_linear_alloc(linear_allocator_result_t rslt_) {
+    switch(rslt_) {
+    case LINEAR_ALLOC_SUCCESS:
+        return SPARSE_SET_SUCCESS;
+    case LINEAR_ALLOC_NO_MEMORY:
+        return SPARSE_SET_NO_MEMORY;
+    case LINEAR_ALLOC_INVALID_ARGUMENT:
+        return SPARSE_SET_INVALID_ARGUMENT;
+    default:
+        return SPARSE_SET_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief スパースセット内部データが破損しているかを判定する
+ *
+ * @warning 本関数は内部データ破損判定が目的であるため下記のチェックは行わない
+ * - 引数sparse_set_のNULLチェック
+ * - dense/sparseの対応の整合性チェック(O(1)で判定できないため)
+ *
+ * @param[in] sparse_set_ 判定対象スパースセット
+ *
+ * @retval true 以下のいずれか
+ * - 0 == sparse_set_->max_id_count || sparse_set_->max_id_count > SPARSE_SET_MAX_ID_COUNT
+ * - sparse_set_->count > sparse_set_->max_id_count
+ * - sparse_set_->dense == NULL || sparse_set_->sparse == NULL
+ * - sparse_set_->sparseがdenseの直後を指していない
+ * @retval false 内部データ破損なし
+ */
+static bool is_sparse_set_corrupted(const sparse_set_t* sparse_set_) {
+#ifdef TEST_BUILD
+    s_test_config_is_sparse_set_corrupted.call_count++;
+    if(s_test_config_is_sparse_set_corrupted.fail_on_call != 0) {
+        if(s_test_config_is_sparse_set_corrupted.call_count == s_test_config_is_sparse_set_corrupted.fail_on_call) {
+            return s_test_config_is_sparse_set_corrupted.forced_result;
+        }
+    }
+#endif
+    if(0 == sparse_set_->max_id_count || sparse_set_->max_id_count > SPARSE_SET_MAX_ID_COUNT) {
+        return true;
+    }
+    if(sparse_set_->count > sparse_set_->max_id_count) {
+        return true;
+    }
+    if(NULL == sparse_set_->dense || NULL == sparse_set_->sparse) {
+        return true;
+    }
+    if(sparse_set_->dense + sparse_set_->max_id_count != sparse_set_->sparse) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief スパースセット実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ スパースセット実行結果コード
+ * @return const char* 変換された文字列
+ */
+static const char* rslt_to_str(sparse_set_result_t rslt_) {
+    switch(rslt_) {
+    case SPARSE_SET_SUCCESS:
+        return s_rslt_str_success;
+    case SPARSE_SET_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case SPARSE_SET_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case SPARSE_SET_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case SPARSE_SET_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case SPARSE_SET_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case SPARSE_SET_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case SPARSE_SET_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case SPARSE_SET_OVERFLOW:
+        return s_rslt_str_overflow;
+    case SPARSE_SET_ID_NOT_FOUND:
+        return s_rslt_str_id_not_found;
+    case SPARSE_SET_ID_EXISTS:
+        return s_rslt_str_id_exists;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_sparse_set_create_config_set(const test_call_control_t* config_) {
+    s_test_config_sparse_set_create.fail_on_call = config_->fail_on_call;
+    s_test_config_sparse_set_create.forced_result = config_->forced_result;
+}
+
+void test_sparse_set_initialize_config_set(const test_call_control_t* config_) {
+    s_test_config_sparse_set_initialize.fail_on_call = config_->fail_on_call;
+    s_test_config_sparse_set_initialize.forced_result = config_->forced_result;
+}
+
+void test_sparse_set_acquire_config_set(const test_call_control_t* config_) {
+    s_test_config_sparse_set_acquire.fail_on_call = config_->fail_on_call;
+    s_test_config_sparse_set_acquire.forced_result = config_->forced_result;
+}
+
+void test_sparse_set_config_reset(void) {
+    test_call_control_reset(&s_test_config_sparse_set_create);
+    test_call_control_reset(&s_test_config_sparse_set_initialize);
+    test_call_control_reset(&s_test_config_sparse_set_acquire);
+
+    test_call_control_bool_reset(&s_test_config_is_sparse_set_corrupted);
+}
+
+void test_sparse_set(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_sparse_set_create();
+    test_sparse_set_preinit();
+    test_sparse_set_initialize();
+    test_sparse_set_destroy();
+    test_sparse_set_acquire();
+    test_sparse_set_insert();
+    test_sparse_set_remove();
+    test_sparse_set_clear();
+    test_sparse_set_stress();
+    test_rslt_convert_mem_sys();
+    test_rslt_convert_linear_alloc();
+    test_is_sparse_set_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+/**
+ * @brief テスト用にリニアアロケータとメモリプールを生成する
+ *
+ * @param[in] pool_size_ メモリプール容量
+ * @param[out] out_pool_ 生成したメモリプールの格納先(テスト終了時にfreeすること)
+ *
+ * @return linear_alloc_t* 初期化済みのリニアアロケータ(テスト終了時にfreeすること)
+ */
+static linear_alloc_t* NO_COVERAGE test_linear_allocator_make(size_t pool_size_, void** out_pool_) {
+    size_t mem_req = 0;
+    size_t align_req = 0;
+    linear_alloc_t* allocator = NULL;
+
+    linear_allocator_preinit(&mem_req, &align_req);
+    allocator = (linear_alloc_t*)malloc(mem_req);
+    assert(NULL != allocator);
+    *out_pool_ = malloc(pool_size_);
+    assert(NULL != *out_pool_);
+    assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(allocator, pool_size_, *out_pool_));
+    return allocator;
+}
+
+/**
+ * @brief denseとsparseの対応、および登録中IDの一覧がexpected_と一致することを検査する
+ *
+ * @param[in] sparse_set_ 検査対象スパースセット
+ * @param[in] expected_ 登録中であるべきIDの配列(順不同)
+ * @param[in] expected_count_ expected_の要素数
+ */
+static void NO_COVERAGE test_sparse_set_verify(const sparse_set_t* sparse_set_, const uint32_t* expected_, size_t expected_count_) {
+    assert(expected_count_ == sparse_set_->count);
+    for(size_t i = 0; i != sparse_set_->max_id_count; ++i) {
+        assert(i == sparse_set_->sparse[sparse_set_->dense[i]]);
+    }
+    for(size_t i = 0; i != expected_count_; ++i) {
+        assert(sparse_set_contains(expected_[i], sparse_set_));
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_create(void) {
+    test_sparse_set_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // sparse_set_create() 冒頭で強制的に SPARSE_SET_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        sparse_set_t* sparse_set = NULL;
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SPARSE_SET_NO_MEMORY;
+        test_sparse_set_create_config_set(&config);
+
+        assert(SPARSE_SET_NO_MEMORY == sparse_set_create(4U, &sparse_set));
+        assert(NULL == sparse_set);
+
+        test_sparse_set_config_reset();
+    }
+    {
+        // 引数異常 -> SPARSE_SET_INVALID_ARGUMENT
+        sparse_set_t dummy = {0};
+        sparse_set_t* sparse_set = &dummy;
+
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_create(4U, NULL));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_create(4U, &sparse_set));
+        assert(&dummy == sparse_set);
+
+        sparse_set = NULL;
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_create(0U, &sparse_set));
+#if SIZE_MAX > UINT32_MAX
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_create(SPARSE_SET_MAX_ID_COUNT + 1U, &sparse_set));
+#endif
+        assert(NULL == sparse_set);
+    }
+    {
+        // メモリ確保失敗(1〜2回目) -> 確保済みのメモリを解放して SPARSE_SET_NO_MEMORY
+        for(int i = 1; i <= 2; ++i) {
+            test_call_control_t config = {0};
+            sparse_set_t* sparse_set = NULL;
+
+            test_choco_memory_config_reset();
+            config.fail_on_call = (uint32_t)i;
+            config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+            test_memory_system_allocate_config_set(&config);
+
+            assert(SPARSE_SET_NO_MEMORY == sparse_set_create(4U, &sparse_set));
+            assert(NULL == sparse_set);
+        }
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系: 全IDが未登録で、denseとsparseは恒等な並べ替え
+        sparse_set_t* sparse_set = NULL;
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(5U, &sparse_set));
+        assert(NULL != sparse_set);
+        assert(5U == sparse_set->max_id_count);
+        assert(0U == sparse_set->count);
+        assert(sparse_set->owns_memory);
+        assert(sizeof(uint32_t) * 10U == sparse_set->array_size);
+        for(uint32_t i = 0; i != 5U; ++i) {
+            assert(i == sparse_set->dense[i]);
+            assert(i == sparse_set->sparse[i]);
+            assert(!sparse_set_contains(i, sparse_set));
+        }
+        sparse_set_destroy(&sparse_set);
+        assert(NULL == sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_preinit(void) {
+    test_sparse_set_config_reset();
+    test_linear_allocator_config_reset();
+
+    {
+        // 引数異常 -> SPARSE_SET_INVALID_ARGUMENT
+        size_t pool_size = 0;
+
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_preinit(4U, NULL));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_preinit(0U, &pool_size));
+        assert(0U == pool_size);
+    }
+    {
+        // 加算結果のオーバーフロー -> SPARSE_SET_OVERFLOW
+        size_t pool_size = SIZE_MAX - 8U;
+
+        assert(SPARSE_SET_OVERFLOW == sparse_set_preinit(4U, &pool_size));
+    }
+    {
+        // 正常系: 算出した必要量でsparse_set_initializeが過不足なく成功すること
+        static const size_t counts[] = { 1U, 7U, 100U, 1000U };
+        for(size_t i = 0; i != sizeof(counts) / sizeof(counts[0]); ++i) {
+            size_t pool_size = 0;
+            size_t marker = 0;
+            void* pool = NULL;
+            linear_alloc_t* allocator = NULL;
+            sparse_set_t* sparse_set = NULL;
+
+            assert(SPARSE_SET_SUCCESS == sparse_set_preinit(counts[i], &pool_size));
+            assert(0U != pool_size);
+
+            allocator = test_linear_allocator_make(pool_size, &pool);
+            assert(SPARSE_SET_SUCCESS == sparse_set_initialize(counts[i], allocator, &sparse_set));
+            assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(allocator, &marker));
+            assert(pool_size == marker);
+
+            free(pool);
+            free(allocator);
+        }
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_initialize(void) {
+    test_sparse_set_config_reset();
+    test_linear_allocator_config_reset();
+
+    {
+        // sparse_set_initialize() 冒頭で強制的に SPARSE_SET_NO_MEMORY を返させる
+        test_call_control_t config = {0};
+        void* pool = NULL;
+        linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+        sparse_set_t* sparse_set = NULL;
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SPARSE_SET_NO_MEMORY;
+        test_sparse_set_initialize_config_set(&config);
+
+        assert(SPARSE_SET_NO_MEMORY == sparse_set_initialize(4U, allocator, &sparse_set));
+        assert(NULL == sparse_set);
+
+        test_sparse_set_config_reset();
+        free(pool);
+        free(allocator);
+    }
+    {
+        // 引数異常 -> SPARSE_SET_INVALID_ARGUMENT
+        void* pool = NULL;
+        linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+        sparse_set_t dummy = {0};
+        sparse_set_t* sparse_set = &dummy;
+
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_initialize(4U, NULL, &sparse_set));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_initialize(4U, allocator, NULL));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_initialize(4U, allocator, &sparse_set));
+        assert(&dummy == sparse_set);
+
+        sparse_set = NULL;
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_initialize(0U, allocator, &sparse_set));
+        assert(NULL == sparse_set);
+
+        free(pool);
+        free(allocator);
+    }
+    {
+        // リニアアロケータの割り当て失敗(1〜2回目) -> SPARSE_SET_NO_MEMORY
+        for(int i = 1; i <= 2; ++i) {
+            test_call_control_t config = {0};
+            void* pool = NULL;
+            linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+            sparse_set_t* sparse_set = NULL;
+
+            test_linear_allocator_config_reset();
+            config.fail_on_call = (uint32_t)i;
+            config.forced_result = (int)LINEAR_ALLOC_NO_MEMORY;
+            test_linear_allocator_allocate_config_set(&config);
+
+            assert(SPARSE_SET_NO_MEMORY == sparse_set_initialize(4U, allocator, &sparse_set));
+            assert(NULL == sparse_set);
+
+            test_linear_allocator_config_reset();
+            free(pool);
+            free(allocator);
+        }
+    }
+    {
+        // 正常系: リニアアロケータ上のスパースセットでIDを払い出せ、destroyはポインタのNULL化のみ行う
+        void* pool = NULL;
+        linear_alloc_t* allocator = test_linear_allocator_make(1024U, &pool);
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = UINT32_MAX;
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_initialize(4U, allocator, &sparse_set));
+        assert(NULL != sparse_set);
+        assert(!sparse_set->owns_memory);
+        assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+        assert(0U == id);
+        assert(sparse_set_contains(0U, sparse_set));
+
+        sparse_set_destroy(&sparse_set);
+        assert(NULL == sparse_set);
+
+        free(pool);
+        free(allocator);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_destroy(void) {
+    test_sparse_set_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // NULL / 2重デストロイ -> no-op
+        sparse_set_t* sparse_set = NULL;
+
+        sparse_set_destroy(NULL);
+        sparse_set_destroy(&sparse_set);
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        sparse_set_destroy(&sparse_set);
+        assert(NULL == sparse_set);
+        sparse_set_destroy(&sparse_set);
+        assert(NULL == sparse_set);
+    }
+    {
+        // 内部データ破損 -> 配列は解放せず、構造体のみ解放する
+        sparse_set_t* sparse_set = NULL;
+        uint32_t* array = NULL;
+        size_t array_size = 0;
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        array = sparse_set->dense;
+        array_size = sparse_set->array_size;
+        sparse_set->sparse = NULL;
+
+        sparse_set_destroy(&sparse_set);
+        assert(NULL == sparse_set);
+
+        memory_system_free(array, array_size, MEMORY_TAG_CONTAINER);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_acquire(void) {
+    test_sparse_set_config_reset();
+
+    {
+        // sparse_set_acquire() 冒頭で強制的に SPARSE_SET_LIMIT_EXCEEDED を返させる
+        test_call_control_t config = {0};
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = UINT32_MAX;
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SPARSE_SET_LIMIT_EXCEEDED;
+        test_sparse_set_acquire_config_set(&config);
+
+        assert(SPARSE_SET_LIMIT_EXCEEDED == sparse_set_acquire(sparse_set, &id));
+        assert(UINT32_MAX == id);
+        assert(0U == sparse_set_count(sparse_set));
+
+        test_sparse_set_config_reset();
+        sparse_set_destroy(&sparse_set);
+    }
+    {
+        // 引数異常 / 内部データ破損
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = UINT32_MAX;
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_acquire(NULL, &id));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_acquire(sparse_set, NULL));
+
+        sparse_set->count = 5U;
+        assert(SPARSE_SET_DATA_CORRUPTED == sparse_set_acquire(sparse_set, &id));
+        sparse_set->count = 0U;
+        assert(UINT32_MAX == id);
+        sparse_set_destroy(&sparse_set);
+    }
+    {
+        // 0から昇順に払い出し、全て登録済みになったら SPARSE_SET_LIMIT_EXCEEDED
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = UINT32_MAX;
+        const uint32_t expected[3] = { 0U, 1U, 2U };
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(3U, &sparse_set));
+        for(uint32_t i = 0; i != 3U; ++i) {
+            assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+            assert(i == id);
+        }
+        test_sparse_set_verify(sparse_set, expected, 3U);
+        assert(SPARSE_SET_LIMIT_EXCEEDED == sparse_set_acquire(sparse_set, &id));
+        assert(3U == sparse_set_count(sparse_set));
+
+        // 返却したIDが再利用される
+        assert(SPARSE_SET_SUCCESS == sparse_set_remove(1U, sparse_set));
+        assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+        assert(1U == id);
+        test_sparse_set_verify(sparse_set, expected, 3U);
+        sparse_set_destroy(&sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_insert(void) {
+    test_sparse_set_config_reset();
+
+    {
+        // 引数異常 / 内部データ破損 / 登録済み
+        sparse_set_t* sparse_set = NULL;
+
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_insert(0U, NULL));
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_insert(4U, sparse_set));
+
+        sparse_set->max_id_count = 0U;
+        assert(SPARSE_SET_DATA_CORRUPTED == sparse_set_insert(0U, sparse_set));
+        sparse_set->max_id_count = 4U;
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(2U, sparse_set));
+        assert(SPARSE_SET_ID_EXISTS == sparse_set_insert(2U, sparse_set));
+        assert(1U == sparse_set_count(sparse_set));
+        sparse_set_destroy(&sparse_set);
+    }
+    {
+        // 指定したIDが登録され、払い出しは未登録のIDのみから行われる
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = UINT32_MAX;
+        const uint32_t expected[4] = { 3U, 1U, 0U, 2U };
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(3U, sparse_set));
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(1U, sparse_set));
+        test_sparse_set_verify(sparse_set, expected, 2U);
+        assert(3U == sparse_set_dense(sparse_set)[0]);
+        assert(1U == sparse_set_dense(sparse_set)[1]);
+        assert(!sparse_set_contains(0U, sparse_set));
+        assert(!sparse_set_contains(2U, sparse_set));
+
+        for(int i = 0; i != 2; ++i) {
+            assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+            assert(0U == id || 2U == id);
+        }
+        test_sparse_set_verify(sparse_set, expected, 4U);
+        assert(SPARSE_SET_LIMIT_EXCEEDED == sparse_set_acquire(sparse_set, &id));
+        sparse_set_destroy(&sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_remove(void) {
+    test_sparse_set_config_reset();
+
+    {
+        // 引数異常 / 内部データ破損 / 未登録
+        sparse_set_t* sparse_set = NULL;
+
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_remove(0U, NULL));
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        assert(SPARSE_SET_INVALID_ARGUMENT == sparse_set_remove(4U, sparse_set));
+        assert(SPARSE_SET_ID_NOT_FOUND == sparse_set_remove(0U, sparse_set));
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(0U, sparse_set));
+        sparse_set->dense = NULL;
+        assert(SPARSE_SET_DATA_CORRUPTED == sparse_set_remove(0U, sparse_set));
+        sparse_set->dense = sparse_set->sparse - sparse_set->max_id_count;
+        assert(SPARSE_SET_SUCCESS == sparse_set_remove(0U, sparse_set));
+        assert(SPARSE_SET_ID_NOT_FOUND == sparse_set_remove(0U, sparse_set));
+        sparse_set_destroy(&sparse_set);
+    }
+    {
+        // 返却位置に末尾の登録中IDが移動し、登録中のIDは先頭から詰めて格納される
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = 0;
+        const uint32_t remain[3] = { 0U, 3U, 2U };
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(5U, &sparse_set));
+        for(int i = 0; i != 4; ++i) {
+            assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+        }
+        assert(SPARSE_SET_SUCCESS == sparse_set_remove(1U, sparse_set));
+        test_sparse_set_verify(sparse_set, remain, 3U);
+        assert(0U == sparse_set_dense(sparse_set)[0]);
+        assert(3U == sparse_set_dense(sparse_set)[1]);
+        assert(2U == sparse_set_dense(sparse_set)[2]);
+        assert(!sparse_set_contains(1U, sparse_set));
+        assert(!sparse_set_contains(4U, sparse_set));
+        assert(!sparse_set_contains(100U, sparse_set));
+        assert(!sparse_set_contains(0U, NULL));
+
+        // 末尾の登録中IDの返却は登録数を減らすのみ
+        assert(SPARSE_SET_SUCCESS == sparse_set_remove(2U, sparse_set));
+        test_sparse_set_verify(sparse_set, remain, 2U);
+        sparse_set_destroy(&sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_clear(void) {
+    test_sparse_set_config_reset();
+
+    {
+        sparse_set_t* sparse_set = NULL;
+        uint32_t id = 0;
+
+        sparse_set_clear(NULL);
+        assert(0U == sparse_set_count(NULL));
+        assert(NULL == sparse_set_dense(NULL));
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(3U, &sparse_set));
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(2U, sparse_set));
+        assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+        sparse_set_clear(sparse_set);
+        assert(0U == sparse_set_count(sparse_set));
+        test_sparse_set_verify(sparse_set, NULL, 0U);
+        for(uint32_t i = 0; i != 3U; ++i) {
+            assert(!sparse_set_contains(i, sparse_set));
+        }
+
+        // 全IDを再度払い出せる
+        for(int i = 0; i != 3; ++i) {
+            assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+        }
+        assert(SPARSE_SET_LIMIT_EXCEEDED == sparse_set_acquire(sparse_set, &id));
+        sparse_set_destroy(&sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_sparse_set_stress(void) {
+    test_sparse_set_config_reset();
+
+    {
+        // 払い出し/返却を繰り返し、参照用の配列と登録状態が一致し続けること
+        enum { MAX_ID = 1000 };
+        static bool reference[MAX_ID];
+        sparse_set_t* sparse_set = NULL;
+        size_t count = 0;
+        uint32_t rng = 12345U;
+
+        memset(reference, 0, sizeof(reference));
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(MAX_ID, &sparse_set));
+        for(int step = 0; step != 20000; ++step) {
+            uint32_t id = 0;
+            rng = rng * 1103515245U + 12345U;
+            id = (rng >> 8U) % MAX_ID;
+            if(0 != (rng & 0x10000U)) {
+                if(count < MAX_ID) {
+                    assert(SPARSE_SET_SUCCESS == sparse_set_acquire(sparse_set, &id));
+                    assert(!reference[id]);
+                    reference[id] = true;
+                    count++;
+                } else {
+                    assert(SPARSE_SET_LIMIT_EXCEEDED == sparse_set_acquire(sparse_set, &id));
+                }
+            } else if(reference[id]) {
+                assert(SPARSE_SET_SUCCESS == sparse_set_remove(id, sparse_set));
+                reference[id] = false;
+                count--;
+            } else {
+                assert(SPARSE_SET_ID_NOT_FOUND == sparse_set_remove(id, sparse_set));
+            }
+            assert(count == sparse_set_count(sparse_set));
+        }
+        for(uint32_t id = 0; id != MAX_ID; ++id) {
+            assert(reference[id] == sparse_set_contains(id, sparse_set));
+            assert(id == sparse_set->sparse[sparse_set->dense[id]]);
+        }
+        for(size_t i = 0; i != sparse_set_count(sparse_set); ++i) {
+            assert(reference[sparse_set_dense(sparse_set)[i]]);
+        }
+        sparse_set_destroy(&sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(SPARSE_SET_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(SPARSE_SET_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(SPARSE_SET_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(SPARSE_SET_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(SPARSE_SET_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(SPARSE_SET_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(SPARSE_SET_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)100));
+}
+
+static void NO_COVERAGE test_rslt_convert_linear_alloc(void) {
+    assert(SPARSE_SET_SUCCESS == rslt_convert_linear_alloc(LINEAR_ALLOC_SUCCESS));
+    assert(SPARSE_SET_NO_MEMORY == rslt_convert_linear_alloc(LINEAR_ALLOC_NO_MEMORY));
+    assert(SPARSE_SET_INVALID_ARGUMENT == rslt_convert_linear_alloc(LINEAR_ALLOC_INVALID_ARGUMENT));
+    assert(SPARSE_SET_UNDEFINED_ERROR == rslt_convert_linear_alloc((linear_allocator_result_t)100));
+}
+
+static void NO_COVERAGE test_is_sparse_set_corrupted(void) {
+    test_sparse_set_config_reset();
+
+    {
+        sparse_set_t* sparse_set = NULL;
+        sparse_set_t backup = {0};
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_create(4U, &sparse_set));
+        backup = *sparse_set;
+        assert(!is_sparse_set_corrupted(sparse_set));
+
+        sparse_set->max_id_count = 0;
+        assert(is_sparse_set_corrupted(sparse_set));
+        *sparse_set = backup;
+
+        sparse_set->count = 5;
+        assert(is_sparse_set_corrupted(sparse_set));
+        *sparse_set = backup;
+
+        sparse_set->dense = NULL;
+        assert(is_sparse_set_corrupted(sparse_set));
+        *sparse_set = backup;
+
+        sparse_set->sparse = NULL;
+        assert(is_sparse_set_corrupted(sparse_set));
+        *sparse_set = backup;
+
+        sparse_set->sparse = sparse_set->dense + 1;
+        assert(is_sparse_set_corrupted(sparse_set));
+        *sparse_set = backup;
+
+        assert(!is_sparse_set_corrupted(sparse_set));
+        sparse_set_destroy(&sparse_set);
+    }
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(s_rslt_str_success == rslt_to_str(SPARSE_SET_SUCCESS));
+    assert(s_rslt_str_invalid_argument == rslt_to_str(SPARSE_SET_INVALID_ARGUMENT));
+    assert(s_rslt_str_no_memory == rslt_to_str(SPARSE_SET_NO_MEMORY));
+    assert(s_rslt_str_runtime_error == rslt_to_str(SPARSE_SET_RUNTIME_ERROR));
+    assert(s_rslt_str_undefined_error == rslt_to_str(SPARSE_SET_UNDEFINED_ERROR));
+    assert(s_rslt_str_limit_exceeded == rslt_to_str(SPARSE_SET_LIMIT_EXCEEDED));
+    assert(s_rslt_str_bad_operation == rslt_to_str(SPARSE_SET_BAD_OPERATION));
+    assert(s_rslt_str_data_corrupted == rslt_to_str(SPARSE_SET_DATA_CORRUPTED));
+    assert(s_rslt_str_overflow == rslt_to_str(SPARSE_SET_OVERFLOW));
+    assert(s_rslt_str_id_not_found == rslt_to_str(SPARSE_SET_ID_NOT_FOUND));
+    assert(s_rslt_str_id_exists == rslt_to_str(SPARSE_SET_ID_EXISTS));
+    assert(s_rslt_str_undefined_error == rslt_to_str((sparse_set_result_t)100));
+}
+#endif
@@ -0,0 +1,961 @@
+/** @ingroup containers
+ *
+ * @file spsc_ring_queue.c
+ * @author chocolate-pie24
+ * @brief 単一プロデューサ/単一コンシューマ(SPSC)間でロックを使用せずにデータを受け渡すジェネリック型のリングキューモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset, memcpy
+
+#include "engine/containers/spsc_ring_queue.h"
+
+#include "engine/core/memory/choco_memory.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <pthread.h>
+#include "engine/containers/test_spsc_ring_queue.h"
+#include "engine/core/memory/test_choco_memory.h"
+
+// spsc_ring_queueモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_spsc_ring_queue_create;    /**< spsc_ring_queue_create()テスト設定 */
+static test_call_control_t s_test_config_spsc_ring_queue_push;      /**< spsc_ring_queue_push()テスト設定 */
+static test_call_control_t s_test_config_spsc_ring_queue_pop;       /**< spsc_ring_queue_pop()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_spsc_ring_queue_create(void);
+static void test_spsc_ring_queue_destroy(void);
+static void test_spsc_ring_queue_push(void);
+static void test_spsc_ring_queue_pop(void);
+static void test_spsc_ring_queue_empty(void);
+static void test_spsc_ring_queue_multithread(void);
+static void* test_spsc_ring_queue_multithread_producer(void* arg_);
+static void test_rslt_convert_mem_sys(void);
+static void test_is_spsc_ring_queue_corrupted(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief head/tailを別々のキャッシュラインに配置するために使用するキャッシュラインサイズ(byte)
+ *
+ * @note 構造体自体はmax_align_tでアライメントされるため、各領域の間に1キャッシュライン分の隙間を設けて分離する
+ *
+ */
+#define SPSC_RING_QUEUE_CACHE_LINE_SIZE 64
+
+/**
+ * @brief spsc_ring_queue_t内部データ構造
+ *
+ * @note
+ * memory_poolはmax_element_count + 1個分のスロットを持ち、1スロットを常に空けておくことで満杯(tail + 1 == head)と空(tail == head)を区別する
+ *
+ */
+struct spsc_ring_queue {
+    // create後は変更しない領域(プロデューサ/コンシューマの双方が読み込む)
+    size_t element_align;       /**< リングキューに格納する要素のアライメント要件 */
+    size_t max_element_count;   /**< リングキューに格納可能な最大要素数 */
+    size_t slot_count;          /**< memory_poolのスロット数(max_element_count + 1) */
+    size_t padding;             /**< 1要素ごとに必要なパディング量 */
+    size_t element_size;        /**< 格納要素のサイズ(パディングサイズを含まない実際の構造体のサイズ) */
+    size_t stride;              /**< 1要素に必要なメモリ領域(element_size + padding) */
+    size_t capacity;            /**< memory_poolのサイズ */
+    void* memory_pool;          /**< 要素を格納するバッファ */
+    char shared_pad[SPSC_RING_QUEUE_CACHE_LINE_SIZE];   /**< 読み込み専用領域とコンシューマ領域を別キャッシュラインに分離するためのパディング */
+
+    // コンシューマ領域
+    atomic_size_t head;         /**< 次にpopするスロットインデックス(コンシューマのみが更新する) */
+    size_t cached_tail;         /**< コンシューマが最後に読み込んだtailの値 */
+    char consumer_pad[SPSC_RING_QUEUE_CACHE_LINE_SIZE]; /**< コンシューマ領域とプロデューサ領域を別キャッシュラインに分離するためのパディング */
+
+    // プロデューサ領域
+    atomic_size_t tail;         /**< 次にpushするスロットインデックス(プロデューサのみが更新する) */
+    size_t cached_head;         /**< プロデューサが最後に読み込んだheadの値 */
+    char producer_pad[SPSC_RING_QUEUE_CACHE_LINE_SIZE]; /**< 後続のメモリ領域とプロデューサ領域を別キャッシュラインに分離するためのパディング */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< リングキューAPI実行結果コード(処理成功)に対応する文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< リングキューAPI実行結果コード(無効な引数)に対応する文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< リングキューAPI実行結果コード(メモリ不足)に対応する文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< リングキューAPI実行結果コード(実行時エラー)に対応する文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< リングキューAPI実行結果コード(未定義エラー)に対応する文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< リングキューAPI実行結果コード(システム使用可能範囲上限超過)に対応する文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< リングキューAPI実行結果コード(API誤用)に対応する文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< リングキューAPI実行結果コード(内部データ破損)に対応する文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< リングキューAPI実行結果コード(計算過程でオーバーフロー発生)に対応する文字列 */
+static const char* const s_rslt_str_empty = "EMPTY";                        /**< リングキューAPI実行結果コード(キューが空)に対応する文字列 */
+static const char* const s_rslt_str_full = "FULL";                          /**< リングキューAPI実行結果コード(キューが満杯)に対応する文字列 */
+
+static bool is_spsc_ring_queue_corrupted(const spsc_ring_queue_t* spsc_ring_queue_);
+static const char* rslt_to_str(ring_queue_result_t rslt_);
+static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+
+ring_queue_result_t spsc_ring_queue_create(size_t max_element_count_, size_t element_size_, size_t element_align_, spsc_ring_queue_t** spsc_ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_spsc_ring_queue_create.call_count++;
+    if(s_test_config_spsc_ring_queue_create.fail_on_call != 0) {
+        if(s_test_config_spsc_ring_queue_create.call_count == s_test_config_spsc_ring_queue_create.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_spsc_ring_queue_create.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    spsc_ring_queue_t* tmp_queue = NULL;
+    size_t slot_count = 0;
+    size_t capacity = 0;
+    size_t stride = 0;
+    size_t padding = 0;
+    size_t diff = 0;
+    uintptr_t mem_pool_ptr = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(spsc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "spsc_ring_queue_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*spsc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "*spsc_ring_queue_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != max_element_count_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "max_element_count_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(element_align_ > 0, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(element_align_), ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "element_align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(element_align_ <= alignof(max_align_t), ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_create", "element_align_")
+
+    if(SIZE_MAX == max_element_count_) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("spsc_ring_queue_create(%s) - Provided 'max_element_count_' is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    slot_count = max_element_count_ + 1;
+
+    // Simulation.
+    diff = element_size_ % element_align_;   // アライメントのズレ量
+    if(0 == diff) {
+        padding = 0;
+    } else {
+        if(element_size_ > element_align_) {
+            padding = element_align_ - diff;
+        } else {
+            padding = element_align_ - element_size_;
+        }
+    }
+    if((SIZE_MAX - padding) < element_size_) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("spsc_ring_queue_create(%s) - Computed stride is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    stride = element_size_ + padding;
+    if(SIZE_MAX / slot_count < stride) {
+        ret = RING_QUEUE_OVERFLOW;
+        ERROR_MESSAGE("spsc_ring_queue_create(%s) - Computed element stride is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    capacity = stride * slot_count;
+
+    ret_mem = memory_system_allocate(sizeof(*tmp_queue), MEMORY_TAG_RING_QUEUE, (void**)&tmp_queue);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("spsc_ring_queue_create(%s) - Failed to allocate ring queue memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_queue, 0, sizeof(*tmp_queue));
+
+    ret_mem = memory_system_allocate(capacity, MEMORY_TAG_RING_QUEUE, &tmp_queue->memory_pool);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = rslt_convert_mem_sys(ret_mem);
+        ERROR_MESSAGE("spsc_ring_queue_create(%s) - Failed to allocate memory pool memory.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp_queue->memory_pool, 0, capacity);
+    mem_pool_ptr = (uintptr_t)tmp_queue->memory_pool;
+    if(0 != (mem_pool_ptr % element_align_)) {
+        ret = RING_QUEUE_RUNTIME_ERROR;
+        ERROR_MESSAGE("spsc_ring_queue_create(%s) - Allocated memory pool alignment is invalid.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    tmp_queue->capacity = capacity;
+    tmp_queue->element_align = element_align_;
+    tmp_queue->element_size = element_size_;
+    tmp_queue->max_element_count = max_element_count_;
+    tmp_queue->slot_count = slot_count;
+    tmp_queue->padding = padding;
+    tmp_queue->stride = stride;
+    atomic_init(&tmp_queue->head, 0);
+    atomic_init(&tmp_queue->tail, 0);
+    tmp_queue->cached_head = 0;
+    tmp_queue->cached_tail = 0;
+
+    *spsc_ring_queue_ = tmp_queue;
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    if(RING_QUEUE_SUCCESS != ret) {
+        if(NULL != tmp_queue) {
+            if(NULL != tmp_queue->memory_pool) {
+                memory_system_free(tmp_queue->memory_pool, capacity, MEMORY_TAG_RING_QUEUE);
+                tmp_queue->memory_pool = NULL;
+            }
+            memory_system_free(tmp_queue, sizeof(*tmp_queue), MEMORY_TAG_RING_QUEUE);
+            tmp_queue = NULL;
+        }
+    }
+    return ret;
+}
+
+void spsc_ring_queue_destroy(spsc_ring_queue_t** spsc_ring_queue_) {
+    if(NULL == spsc_ring_queue_) {
+        goto cleanup;
+    }
+    if(NULL == *spsc_ring_queue_) {
+        goto cleanup;
+    }
+    if(!is_spsc_ring_queue_corrupted(*spsc_ring_queue_)) { // 内部データが破損していた場合にfreeするのは危険
+        memory_system_free((*spsc_ring_queue_)->memory_pool, (*spsc_ring_queue_)->capacity, MEMORY_TAG_RING_QUEUE);
+        (*spsc_ring_queue_)->memory_pool = NULL;
+    } else {
+        WARN_MESSAGE("spsc_ring_queue_destroy - Provided spsc_ring_queue_ is corrupted.");
+    }
+
+    memory_system_free(*spsc_ring_queue_, sizeof(spsc_ring_queue_t), MEMORY_TAG_RING_QUEUE);
+    *spsc_ring_queue_ = NULL;
+cleanup:
+    return;
+}
+
+ring_queue_result_t spsc_ring_queue_push(const void* data_, size_t element_size_, size_t element_align_, spsc_ring_queue_t* spsc_ring_queue_) {
+#ifdef TEST_BUILD
+    s_test_config_spsc_ring_queue_push.call_count++;
+    if(s_test_config_spsc_ring_queue_push.fail_on_call != 0) {
+        if(s_test_config_spsc_ring_queue_push.call_count == s_test_config_spsc_ring_queue_push.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_spsc_ring_queue_push.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t tail = 0;
+    size_t next_tail = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(spsc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_push", "spsc_ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_push", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(spsc_ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_push", "spsc_ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(spsc_ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_push", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(spsc_ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_push", "element_align_")
+
+    if(is_spsc_ring_queue_corrupted(spsc_ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("spsc_ring_queue_push(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // tailを更新するのは自スレッドのみのため、relaxedで読み込んでよい
+    tail = atomic_load_explicit(&spsc_ring_queue_->tail, memory_order_relaxed);
+    next_tail = tail + 1;
+    if(next_tail == spsc_ring_queue_->slot_count) {
+        next_tail = 0;
+    }
+    if(next_tail == spsc_ring_queue_->cached_head) {
+        // キャッシュ上は満杯のため、コンシューマがpopを完了したheadを読み直す(acquireでコンシューマによるスロット読み出しの完了を保証する)
+        spsc_ring_queue_->cached_head = atomic_load_explicit(&spsc_ring_queue_->head, memory_order_acquire);
+        if(next_tail == spsc_ring_queue_->cached_head) {
+            ret = RING_QUEUE_FULL;
+            goto cleanup;
+        }
+    }
+
+    memcpy((char*)spsc_ring_queue_->memory_pool + (tail * spsc_ring_queue_->stride), data_, spsc_ring_queue_->element_size);
+    atomic_store_explicit(&spsc_ring_queue_->tail, next_tail, memory_order_release);   // スロットへの書き込みをコンシューマに公開
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+ring_queue_result_t spsc_ring_queue_pop(size_t element_size_, size_t element_align_, spsc_ring_queue_t* spsc_ring_queue_, void* data_) {
+#ifdef TEST_BUILD
+    s_test_config_spsc_ring_queue_pop.call_count++;
+    if(s_test_config_spsc_ring_queue_pop.fail_on_call != 0) {
+        if(s_test_config_spsc_ring_queue_pop.call_count == s_test_config_spsc_ring_queue_pop.fail_on_call) {
+            return (ring_queue_result_t)s_test_config_spsc_ring_queue_pop.forced_result;
+        }
+    }
+#endif
+    ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+    size_t head = 0;
+    size_t next_head = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(spsc_ring_queue_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_pop", "spsc_ring_queue_")
+    IF_ARG_NULL_GOTO_CLEANUP(data_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_pop", "data_")
+    IF_ARG_NULL_GOTO_CLEANUP(spsc_ring_queue_->memory_pool, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_pop", "spsc_ring_queue_->memory_pool")
+    IF_ARG_FALSE_GOTO_CLEANUP(spsc_ring_queue_->element_size == element_size_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_pop", "element_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(spsc_ring_queue_->element_align == element_align_, ret, RING_QUEUE_INVALID_ARGUMENT, rslt_to_str(RING_QUEUE_INVALID_ARGUMENT), "spsc_ring_queue_pop", "element_align_")
+
+    if(is_spsc_ring_queue_corrupted(spsc_ring_queue_)) {
+        ret = RING_QUEUE_DATA_CORRUPTED;
+        ERROR_MESSAGE("spsc_ring_queue_pop(%s) - Provided ring queue is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // headを更新するのは自スレッドのみのため、relaxedで読み込んでよい
+    head = atomic_load_explicit(&spsc_ring_queue_->head, memory_order_relaxed);
+    if(head == spsc_ring_queue_->cached_tail) {
+        // キャッシュ上は空のため、プロデューサがpushを完了したtailを読み直す(acquireでプロデューサによるスロット書き込みの完了を保証する)
+        spsc_ring_queue_->cached_tail = atomic_load_explicit(&spsc_ring_queue_->tail, memory_order_acquire);
+        if(head == spsc_ring_queue_->cached_tail) {
+            ret = RING_QUEUE_EMPTY;
+            goto cleanup;
+        }
+    }
+
+    memcpy(data_, (const char*)spsc_ring_queue_->memory_pool + (head * spsc_ring_queue_->stride), spsc_ring_queue_->element_size);
+    next_head = head + 1;
+    if(next_head == spsc_ring_queue_->slot_count) {
+        next_head = 0;
+    }
+    atomic_store_explicit(&spsc_ring_queue_->head, next_head, memory_order_release);   // スロットの読み出し完了をプロデューサに公開
+
+    ret = RING_QUEUE_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+bool spsc_ring_queue_empty(const spsc_ring_queue_t* spsc_ring_queue_) {
+    if(NULL == spsc_ring_queue_) {
+        return true;
+    } else if(NULL == spsc_ring_queue_->memory_pool) {
+        return true;
+    } else {
+        const size_t head = atomic_load_explicit(&spsc_ring_queue_->head, memory_order_acquire);
+        const size_t tail = atomic_load_explicit(&spsc_ring_queue_->tail, memory_order_acquire);
+        return (head == tail) ? true : false;
+    }
+}
+
+/**
+ * @brief メモリシステム実行結果コードをリングキュー実行結果コードに変換する
+ *
+ * @param[in] rslt_ メモリシステム実行結果コード
+ * @return ring_queue_result_t 変換されたリングキュー実行結果コード
+ */
+static ring_queue_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return RING_QUEUE_SUCCESS;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return RING_QUEUE_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return RING_QUEUE_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return RING_QUEUE_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return RING_QUEUE_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return RING_QUEUE_BAD_OPERATION;
+    default:
+        return RING_QUEUE_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief SPSCリングキューの内部データ破損チェックを行う
+ *
+ * @note
+ * - create後に変更されない領域と、head/tailの範囲のみをチェックする
+ * - cached_head/cached_tailはそれぞれプロデューサ/コンシューマのみがアクセスするため、チェック対象外とする(他スレッドから読み込むとデータ競合になる)
+ * - 並行して呼び出されるため、テスト用の強制返却設定は持たない(テストでは内部データを直接破損させる)
+ *
+ * 破損と判定する条件は以下
+ * - element_align, max_element_count, element_size, stride, capacityのいずれかが0
+ * - slot_count != max_element_count + 1
+ * - stride % element_align != 0
+ * - padding >= element_align
+ * - stride != element_size + padding
+ * - element_alignがmax_align_tを超過、または2のべき乗ではない
+ * - capacity != stride * slot_count
+ * - head >= slot_count、またはtail >= slot_count
+ * - memory_pool == NULL
+ *
+ * @param[in] spsc_ring_queue_ チェック対象SPSCリングキュー構造体インスタンスへのポインタ
+ *
+ * @retval true 内部データ破損
+ * @retval false 内部データは正常
+ */
+static bool is_spsc_ring_queue_corrupted(const spsc_ring_queue_t* spsc_ring_queue_) {
+    if(0 == spsc_ring_queue_->element_align || 0 == spsc_ring_queue_->max_element_count || 0 == spsc_ring_queue_->element_size || 0 == spsc_ring_queue_->stride || 0 == spsc_ring_queue_->capacity) {
+        return true;
+    }
+    if(spsc_ring_queue_->slot_count != spsc_ring_queue_->max_element_count + 1) {
+        return true;
+    }
+    if(0 != (spsc_ring_queue_->stride % spsc_ring_queue_->element_align)) {
+        return true;
+    }
+    if(spsc_ring_queue_->padding >= spsc_ring_queue_->element_align) {
+        return true;
+    }
+    if(spsc_ring_queue_->stride != (spsc_ring_queue_->element_size + spsc_ring_queue_->padding)) {
+        return true;
+    }
+    if(alignof(max_align_t) < spsc_ring_queue_->element_align || !IS_POWER_OF_TWO(spsc_ring_queue_->element_align)) {
+        return true;
+    }
+    if(spsc_ring_queue_->capacity != spsc_ring_queue_->stride * spsc_ring_queue_->slot_count) {
+        return true;
+    }
+    if(atomic_load_explicit(&spsc_ring_queue_->head, memory_order_relaxed) >= spsc_ring_queue_->slot_count) {
+        return true;
+    }
+    if(atomic_load_explicit(&spsc_ring_queue_->tail, memory_order_relaxed) >= spsc_ring_queue_->slot_count) {
+        return true;
+    }
+    if(NULL == spsc_ring_queue_->memory_pool) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief リングキュー実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 変換対象実行結果コード
+ * @return const char* 変換された文字列(想定外の実行結果コードの場合はUNDEFINED_ERROR)
+ */
+static const char* rslt_to_str(ring_queue_result_t rslt_) {
+    switch(rslt_) {
+    case RING_QUEUE_SUCCESS:
+        return s_rslt_str_success;
+    case RING_QUEUE_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case RING_QUEUE_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case RING_QUEUE_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case RING_QUEUE_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case RING_QUEUE_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case RING_QUEUE_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case RING_QUEUE_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case RING_QUEUE_OVERFLOW:
+        return s_rslt_str_overflow;
+    case RING_QUEUE_EMPTY:
+        return s_rslt_str_empty;
+    case RING_QUEUE_FULL:
+        return s_rslt_str_full;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+/**
+ * @brief マルチスレッドテストでプロデューサスレッドからpushする要素数
+ *
+ */
+#define TEST_SPSC_RING_QUEUE_MT_ELEMENT_COUNT 100000U
+
+void test_spsc_ring_queue_create_config_set(const test_call_control_t* config_) {
+    s_test_config_spsc_ring_queue_create.fail_on_call = config_->fail_on_call;
+    s_test_config_spsc_ring_queue_create.forced_result = config_->forced_result;
+}
+
+void test_spsc_ring_queue_push_config_set(const test_call_control_t* config_) {
+    s_test_config_spsc_ring_queue_push.fail_on_call = config_->fail_on_call;
+    s_test_config_spsc_ring_queue_push.forced_result = config_->forced_result;
+}
+
+void test_spsc_ring_queue_pop_config_set(const test_call_control_t* config_) {
+    s_test_config_spsc_ring_queue_pop.fail_on_call = config_->fail_on_call;
+    s_test_config_spsc_ring_queue_pop.forced_result = config_->forced_result;
+}
+
+void test_spsc_ring_queue_config_reset(void) {
+    test_call_control_reset(&s_test_config_spsc_ring_queue_create);
+    test_call_control_reset(&s_test_config_spsc_ring_queue_push);
+    test_call_control_reset(&s_test_config_spsc_ring_queue_pop);
+}
+
+void test_spsc_ring_queue(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_spsc_ring_queue_create();
+    test_spsc_ring_queue_destroy();
+    test_spsc_ring_queue_push();
+    test_spsc_ring_queue_pop();
+    test_spsc_ring_queue_empty();
+    test_spsc_ring_queue_multithread();
+    test_rslt_convert_mem_sys();
+    test_is_spsc_ring_queue_corrupted();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_spsc_ring_queue_create(void) {
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // spsc_ring_queue_create() 冒頭で強制的に RING_QUEUE_NO_MEMORY を返させる
+        ring_queue_result_t ret = RING_QUEUE_INVALID_ARGUMENT;
+        spsc_ring_queue_t* queue = NULL;
+        test_call_control_t config = {0};
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_NO_MEMORY;
+        test_spsc_ring_queue_create_config_set(&config);
+
+        ret = spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue);
+        assert(RING_QUEUE_NO_MEMORY == ret);
+        assert(NULL == queue);
+
+        test_spsc_ring_queue_config_reset();
+    }
+    {
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT
+        spsc_ring_queue_t* queue = NULL;
+        spsc_ring_queue_t* not_null = (spsc_ring_queue_t*)(uintptr_t)0x1U;
+
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), NULL));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &not_null));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(0U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(4U, 0U, alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(4U, sizeof(uint32_t), 0U, &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(4U, sizeof(uint32_t), 3U, &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(max_align_t) * 2U, &queue));
+        assert(NULL == queue);
+    }
+    {
+        // 計算過程のオーバーフロー -> RING_QUEUE_OVERFLOW
+        spsc_ring_queue_t* queue = NULL;
+
+        assert(RING_QUEUE_OVERFLOW == spsc_ring_queue_create(SIZE_MAX, 1U, 1U, &queue));
+        assert(RING_QUEUE_OVERFLOW == spsc_ring_queue_create(1U, SIZE_MAX, 8U, &queue));
+        assert(RING_QUEUE_OVERFLOW == spsc_ring_queue_create(2U, SIZE_MAX / 2U, 8U, &queue));
+        assert(NULL == queue);
+    }
+    {
+        // 依存先 memory_system_allocate() の1回目、2回目を失敗させる
+        spsc_ring_queue_t* queue = NULL;
+        test_call_control_t config = {0};
+
+        for(uint32_t i = 1U; i <= 2U; ++i) {
+            test_choco_memory_config_reset();
+            test_call_control_reset(&config);
+            config.fail_on_call = i;
+            config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+            test_memory_system_allocate_config_set(&config);
+
+            assert(RING_QUEUE_NO_MEMORY == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+            assert(NULL == queue);
+        }
+
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系（padding != 0）、head/tailが別キャッシュラインに配置される
+        spsc_ring_queue_t* queue = NULL;
+        uintptr_t shared_end = 0U;
+        uintptr_t head_begin = 0U;
+        uintptr_t head_end = 0U;
+        uintptr_t tail_begin = 0U;
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(3U, 1U, 4U, &queue));
+        assert(NULL != queue);
+        assert(4U == queue->element_align);
+        assert(3U == queue->max_element_count);
+        assert(4U == queue->slot_count);
+        assert(3U == queue->padding);
+        assert(1U == queue->element_size);
+        assert(4U == queue->stride);
+        assert(16U == queue->capacity);
+        assert(NULL != queue->memory_pool);
+        assert(0U == atomic_load_explicit(&queue->head, memory_order_relaxed));
+        assert(0U == atomic_load_explicit(&queue->tail, memory_order_relaxed));
+
+        shared_end = (uintptr_t)&queue->memory_pool + sizeof(queue->memory_pool);
+        head_begin = (uintptr_t)&queue->head;
+        head_end = (uintptr_t)&queue->cached_tail + sizeof(queue->cached_tail);
+        tail_begin = (uintptr_t)&queue->tail;
+        assert((head_begin - shared_end) >= SPSC_RING_QUEUE_CACHE_LINE_SIZE);
+        assert((tail_begin - head_end) >= SPSC_RING_QUEUE_CACHE_LINE_SIZE);
+
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_spsc_ring_queue_destroy(void) {
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // NULL、2重デストロイ
+        spsc_ring_queue_t* queue = NULL;
+
+        spsc_ring_queue_destroy(NULL);
+        spsc_ring_queue_destroy(&queue);
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+    {
+        // 内部データ破損時はメモリプールを解放せず、構造体のみ解放する
+        spsc_ring_queue_t* queue = NULL;
+        void* memory_pool = NULL;
+        size_t capacity = 0U;
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        memory_pool = queue->memory_pool;
+        capacity = queue->capacity;
+        queue->slot_count = 0U;
+
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+
+        memory_system_free(memory_pool, capacity, MEMORY_TAG_RING_QUEUE);
+    }
+
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_spsc_ring_queue_push(void) {
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // spsc_ring_queue_push() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        test_call_control_t config = {0};
+        const uint32_t value = 1U;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_spsc_ring_queue_push_config_set(&config);
+
+        assert(RING_QUEUE_RUNTIME_ERROR == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL));
+
+        test_spsc_ring_queue_config_reset();
+    }
+    {
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT、内部データ破損 -> RING_QUEUE_DATA_CORRUPTED
+        spsc_ring_queue_t* queue = NULL;
+        void* saved_memory_pool = NULL;
+        const uint32_t value = 1U;
+
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), NULL));
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_push(NULL, sizeof(uint32_t), alignof(uint32_t), queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_push(&value, sizeof(uint16_t), alignof(uint32_t), queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint16_t), queue));
+
+        saved_memory_pool = queue->memory_pool;
+        queue->memory_pool = NULL;
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+        queue->memory_pool = saved_memory_pool;
+
+        atomic_store_explicit(&queue->tail, queue->slot_count, memory_order_relaxed);
+        assert(RING_QUEUE_DATA_CORRUPTED == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+        atomic_store_explicit(&queue->tail, 0U, memory_order_relaxed);
+
+        assert(true == spsc_ring_queue_empty(queue));
+
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+    {
+        // 満杯 -> RING_QUEUE_FULL(上書きしない)
+        spsc_ring_queue_t* queue = NULL;
+        uint32_t out = 0U;
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(3U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        for(uint32_t i = 1U; i <= 3U; ++i) {
+            assert(RING_QUEUE_SUCCESS == spsc_ring_queue_push(&i, sizeof(uint32_t), alignof(uint32_t), queue));
+        }
+        {
+            const uint32_t value = 4U;
+            assert(RING_QUEUE_FULL == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+        }
+        assert(3U == atomic_load_explicit(&queue->tail, memory_order_relaxed));
+
+        // 1つpopすると再びpushできる(cached_headの読み直し)
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        assert(1U == out);
+        {
+            const uint32_t value = 4U;
+            assert(RING_QUEUE_SUCCESS == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+        }
+        assert(0U == atomic_load_explicit(&queue->tail, memory_order_relaxed));
+
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_spsc_ring_queue_pop(void) {
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // spsc_ring_queue_pop() 冒頭で強制的に RING_QUEUE_RUNTIME_ERROR を返させる
+        test_call_control_t config = {0};
+        uint32_t out = 0U;
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RING_QUEUE_RUNTIME_ERROR;
+        test_spsc_ring_queue_pop_config_set(&config);
+
+        assert(RING_QUEUE_RUNTIME_ERROR == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out));
+
+        test_spsc_ring_queue_config_reset();
+    }
+    {
+        // 引数異常 -> RING_QUEUE_INVALID_ARGUMENT、内部データ破損 -> RING_QUEUE_DATA_CORRUPTED、空 -> RING_QUEUE_EMPTY
+        spsc_ring_queue_t* queue = NULL;
+        void* saved_memory_pool = NULL;
+        uint32_t out = 0U;
+
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), NULL, &out));
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, NULL));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_pop(sizeof(uint16_t), alignof(uint32_t), queue, &out));
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint16_t), queue, &out));
+
+        saved_memory_pool = queue->memory_pool;
+        queue->memory_pool = NULL;
+        assert(RING_QUEUE_INVALID_ARGUMENT == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        queue->memory_pool = saved_memory_pool;
+
+        atomic_store_explicit(&queue->head, queue->slot_count, memory_order_relaxed);
+        assert(RING_QUEUE_DATA_CORRUPTED == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        atomic_store_explicit(&queue->head, 0U, memory_order_relaxed);
+
+        assert(RING_QUEUE_EMPTY == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+        assert(0U == out);
+
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+    {
+        // 正常系: padding を含む要素で折り返しを繰り返しても FIFO で取り出せる
+        spsc_ring_queue_t* queue = NULL;
+        uint8_t out = 0U;
+
+        assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(3U, sizeof(uint8_t), 4U, &queue));
+        for(uint8_t i = 0U; i != 10U; ++i) {
+            const uint8_t value1 = (uint8_t)(i * 2U);
+            const uint8_t value2 = (uint8_t)(i * 2U + 1U);
+            assert(RING_QUEUE_SUCCESS == spsc_ring_queue_push(&value1, sizeof(uint8_t), 4U, queue));
+            assert(RING_QUEUE_SUCCESS == spsc_ring_queue_push(&value2, sizeof(uint8_t), 4U, queue));
+            assert(RING_QUEUE_SUCCESS == spsc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+            assert(value1 == out);
+            assert(RING_QUEUE_SUCCESS == spsc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+            assert(value2 == out);
+        }
+        assert(RING_QUEUE_EMPTY == spsc_ring_queue_pop(sizeof(uint8_t), 4U, queue, &out));
+
+        spsc_ring_queue_destroy(&queue);
+        assert(NULL == queue);
+    }
+
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+}
+
+static void NO_COVERAGE test_spsc_ring_queue_empty(void) {
+    spsc_ring_queue_t* queue = NULL;
+    void* saved_memory_pool = NULL;
+    const uint32_t value = 1U;
+    uint32_t out = 0U;
+
+    assert(true == spsc_ring_queue_empty(NULL));
+
+    assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(4U, sizeof(uint32_t), alignof(uint32_t), &queue));
+    assert(true == spsc_ring_queue_empty(queue));
+    assert(RING_QUEUE_SUCCESS == spsc_ring_queue_push(&value, sizeof(uint32_t), alignof(uint32_t), queue));
+    assert(false == spsc_ring_queue_empty(queue));
+
+    saved_memory_pool = queue->memory_pool;
+    queue->memory_pool = NULL;
+    assert(true == spsc_ring_queue_empty(queue));
+    queue->memory_pool = saved_memory_pool;
+
+    assert(RING_QUEUE_SUCCESS == spsc_ring_queue_pop(sizeof(uint32_t), alignof(uint32_t), queue, &out));
+    assert(true == spsc_ring_queue_empty(queue));
+
+    spsc_ring_queue_destroy(&queue);
+    assert(NULL == queue);
+}
+
+static void NO_COVERAGE test_spsc_ring_queue_multithread(void) {
+    // プロデューサスレッドがpushした値を、コンシューマ(本スレッド)が欠落、重複なく順序通りに受け取れること
+    spsc_ring_queue_t* queue = NULL;
+    pthread_t producer;
+    uint64_t expected = 0U;
+
+    test_spsc_ring_queue_config_reset();
+    test_choco_memory_config_reset();
+
+    assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(64U, sizeof(uint64_t), alignof(uint64_t), &queue));
+    assert(0 == pthread_create(&producer, NULL, test_spsc_ring_queue_multithread_producer, queue));
+
+    while(expected != TEST_SPSC_RING_QUEUE_MT_ELEMENT_COUNT) {
+        uint64_t out = 0U;
+        const ring_queue_result_t ret = spsc_ring_queue_pop(sizeof(uint64_t), alignof(uint64_t), queue, &out);
+        if(RING_QUEUE_EMPTY == ret) {
+            continue;
+        }
+        assert(RING_QUEUE_SUCCESS == ret);
+        assert(expected == out);
+        expected++;
+    }
+
+    assert(0 == pthread_join(producer, NULL));
+    assert(true == spsc_ring_queue_empty(queue));
+
+    spsc_ring_queue_destroy(&queue);
+    assert(NULL == queue);
+}
+
+static void* NO_COVERAGE test_spsc_ring_queue_multithread_producer(void* arg_) {
+    spsc_ring_queue_t* queue = (spsc_ring_queue_t*)arg_;
+
+    for(uint64_t i = 0U; i != TEST_SPSC_RING_QUEUE_MT_ELEMENT_COUNT; ++i) {
+        ring_queue_result_t ret = RING_QUEUE_FULL;
+        while(RING_QUEUE_FULL == ret) {
+            ret = spsc_ring_queue_push(&i, sizeof(uint64_t), alignof(uint64_t), queue);
+        }
+        assert(RING_QUEUE_SUCCESS == ret);
+    }
+    return NULL;
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(RING_QUEUE_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(RING_QUEUE_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(RING_QUEUE_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(RING_QUEUE_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(RING_QUEUE_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(RING_QUEUE_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(RING_QUEUE_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)999));
+}
+
+static void NO_COVERAGE test_is_spsc_ring_queue_corrupted(void) {
+    spsc_ring_queue_t* queue = NULL;
+    spsc_ring_queue_t saved;
+
+    assert(RING_QUEUE_SUCCESS == spsc_ring_queue_create(4U, sizeof(uint8_t), 4U, &queue));
+    assert(false == is_spsc_ring_queue_corrupted(queue));
+    memcpy(&saved, queue, sizeof(saved));
+
+    queue->element_align = 0U;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->max_element_count = 0U;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->slot_count = queue->max_element_count;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->stride = 6U;
+    queue->padding = 5U;
+    queue->element_size = 1U;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->padding = 4U;
+    queue->stride = 5U;
+    queue->element_align = 5U;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->padding = 4U;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->element_size = 2U;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->element_align = alignof(max_align_t) * 2U;
+    queue->stride = alignof(max_align_t) * 2U;
+    queue->padding = queue->stride - queue->element_size;
+    queue->capacity = queue->stride * queue->slot_count;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->capacity++;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    atomic_store_explicit(&queue->head, queue->slot_count, memory_order_relaxed);
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    atomic_store_explicit(&queue->tail, queue->slot_count, memory_order_relaxed);
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    queue->memory_pool = NULL;
+    assert(true == is_spsc_ring_queue_corrupted(queue));
+    memcpy(queue, &saved, sizeof(saved));
+
+    assert(false == is_spsc_ring_queue_corrupted(queue));
+    spsc_ring_queue_destroy(&queue);
+    assert(NULL == queue);
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(0 == strcmp("SUCCESS", rslt_to_str(RING_QUEUE_SUCCESS)));
+    assert(0 == strcmp("INVALID_ARGUMENT", rslt_to_str(RING_QUEUE_INVALID_ARGUMENT)));
+    assert(0 == strcmp("NO_MEMORY", rslt_to_str(RING_QUEUE_NO_MEMORY)));
+    assert(0 == strcmp("RUNTIME_ERROR", rslt_to_str(RING_QUEUE_RUNTIME_ERROR)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str(RING_QUEUE_UNDEFINED_ERROR)));
+    assert(0 == strcmp("LIMIT_EXCEEDED", rslt_to_str(RING_QUEUE_LIMIT_EXCEEDED)));
+    assert(0 == strcmp("BAD_OPERATION", rslt_to_str(RING_QUEUE_BAD_OPERATION)));
+    assert(0 == strcmp("DATA_CORRUPTED", rslt_to_str(RING_QUEUE_DATA_CORRUPTED)));
+    assert(0 == strcmp("OVERFLOW", rslt_to_str(RING_QUEUE_OVERFLOW)));
+    assert(0 == strcmp("EMPTY", rslt_to_str(RING_QUEUE_EMPTY)));
+    assert(0 == strcmp("FULL", rslt_to_str(RING_QUEUE_FULL)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str((ring_queue_result_t)999)));
+}
+#endif
@@ -0,0 +1,1070 @@
+/** @ingroup containers
+ *
+ * @file string_intern.c
+ * @author chocolate-pie24
+ * @brief 文字列を一意な整数値(アトム)に対応付けて一元管理する文字列インターンテーブルモジュールAPIの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for strlen, memcpy, memcmp, memset
+
+#include "engine/containers/string_intern.h"
+#include "engine/containers/choco_string.h"
+
+#include "engine/core/memory/choco_memory.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <stdio.h>  // for snprintf
+#include "test_controller.h"
+#include "engine/containers/test_string_intern.h"
+#include "engine/core/memory/test_choco_memory.h"
+
+// string_internモジュール専用テスト制御構造体定義
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_string_intern_acquire;     /**< string_intern_acquire()テスト設定 */
+
+// プライベート関数テスト設定
+static test_call_control_t s_test_config_string_intern_mem_allocate;    /**< string_intern_mem_allocate()テスト設定 */
+static test_call_control_t s_test_config_string_intern_mem_reallocate;  /**< string_intern_mem_reallocate()テスト設定 */
+
+// 全テスト関数プロトタイプ宣言
+static void test_string_intern_acquire(void);
+static void test_string_intern_release(void);
+static void test_string_intern_find(void);
+static void test_string_intern_c_str(void);
+static void test_string_hash(void);
+static void test_buckets_rehash(void);
+static void test_entries_grow(void);
+static void test_rslt_convert_mem_sys(void);
+static void test_rslt_to_str(void);
+#endif
+
+#define STRING_INTERN_INITIAL_CAPACITY 16   /**< エントリ配列、ハッシュインデックスの初期容量(ハッシュインデックスは2のべき乗であること) */
+#define STRING_INTERN_TOMBSTONE UINT32_MAX  /**< ハッシュインデックスの削除済みバケットを示す値 */
+#define STRING_INTERN_ATOM_MAX (UINT32_MAX - 1U)    /**< 割り当て可能なアトムの最大値(STRING_INTERN_TOMBSTONEと重複しないこと) */
+#define STRING_INTERN_FNV_OFFSET_BASIS 2166136261U  /**< FNV-1a(32bit)オフセットベーシス */
+#define STRING_INTERN_FNV_PRIME 16777619U           /**< FNV-1a(32bit)FNVプライム */
+
+/**
+ * @brief インターンテーブルに登録された文字列1つ分のエントリ
+ *
+ */
+typedef struct string_intern_entry {
+    char* str;                  /**< 登録文字列(NULL: 未使用エントリ) */
+    size_t length;              /**< 文字列長さ(終端文字は含まない) */
+    uint32_t hash;              /**< 登録時に計算した文字列のハッシュ値 */
+    uint32_t ref_count;         /**< 参照カウント */
+    string_atom_t next_free;    /**< 未使用エントリリストの次の要素(未使用エントリのみ有効、STRING_ATOM_INVALIDで終端) */
+} string_intern_entry_t;
+
+/**
+ * @brief インターンテーブル内部状態管理構造体
+ *
+ * @note
+ * - アトムはentriesのインデックス+1で、entriesを再確保しても値は変化しない
+ * - bucketsはアトムを格納するオープンアドレス法(線形探索)のハッシュインデックス。使用中+削除済みバケット数を容量の1/2以下に保つ
+ * - 削除されたエントリは未使用エントリリストで管理し、次回の登録で再利用する
+ */
+typedef struct string_intern_table {
+    string_intern_entry_t* entries; /**< エントリ配列 */
+    size_t entry_capacity;          /**< エントリ配列の容量 */
+    size_t entry_used;              /**< 一度でも使用されたエントリ数(entries[0]からentries[entry_used - 1]までが使用済み) */
+    string_atom_t free_head;        /**< 未使用エントリリストの先頭(STRING_ATOM_INVALID: 未使用エントリなし) */
+    string_atom_t* buckets;         /**< ハッシュインデックス(STRING_ATOM_INVALID: 空, STRING_INTERN_TOMBSTONE: 削除済み) */
+    size_t bucket_capacity;         /**< ハッシュインデックスの容量(2のべき乗) */
+    size_t tombstone_count;         /**< 削除済みバケット数 */
+    size_t count;                   /**< 登録文字列数 */
+} string_intern_table_t;
+
+static string_intern_table_t s_table = { 0 };   /**< インターンテーブルインスタンス */
+
+static const char* const s_rslt_str_success = "SUCCESS";                    /**< 実行結果コード(成功)文字列 */
+static const char* const s_rslt_str_data_corrupted = "DATA_CORRUPTED";      /**< 実行結果コード(内部データ整合異常)文字列 */
+static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**< 実行結果コード(API誤用)文字列 */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< 実行結果コード(無効な引数)文字列 */
+static const char* const s_rslt_str_runtime_error = "RUNTIME_ERROR";        /**< 実行結果コード(実行時エラー)文字列 */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                /**< 実行結果コード(メモリ不足)文字列 */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< 実行結果コード(未定義エラー)文字列 */
+static const char* const s_rslt_str_overflow = "OVERFLOW";                  /**< 実行結果コード(計算過程でオーバーフロー発生)文字列 */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";      /**< 実行結果コード(システム使用範囲上限超過) */
+
+static const char* rslt_to_str(choco_string_result_t rslt_);
+static choco_string_result_t rslt_convert_mem_sys(memory_system_result_t rslt_);
+static choco_string_result_t string_intern_mem_allocate(size_t size_, void** out_ptr_);
+static choco_string_result_t string_intern_mem_reallocate(void* ptr_, size_t old_size_, size_t new_size_, void** out_ptr_);
+static uint32_t string_hash(const char* str_, size_t length_);
+static string_atom_t bucket_find(const char* str_, size_t length_, uint32_t hash_);
+static void bucket_insert(string_atom_t atom_, uint32_t hash_);
+static void bucket_remove(string_atom_t atom_, uint32_t hash_);
+static choco_string_result_t buckets_reserve(void);
+static choco_string_result_t buckets_rehash(size_t new_capacity_);
+static choco_string_result_t entries_grow(void);
+static bool is_atom_registered(string_atom_t atom_);
+static void table_release(void);
+
+choco_string_result_t string_intern_acquire(const char* str_, string_atom_t* out_atom_) {
+#ifdef TEST_BUILD
+    s_test_config_string_intern_acquire.call_count++;
+    if(s_test_config_string_intern_acquire.fail_on_call != 0) {
+        if(s_test_config_string_intern_acquire.call_count == s_test_config_string_intern_acquire.fail_on_call) {
+            return (choco_string_result_t)s_test_config_string_intern_acquire.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    string_atom_t atom = STRING_ATOM_INVALID;
+    string_intern_entry_t* entry = NULL;
+    char* tmp_str = NULL;
+    size_t length = 0;
+    uint32_t hash = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(str_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "string_intern_acquire", "str_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_atom_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "string_intern_acquire", "out_atom_")
+
+    length = strlen(str_);
+    if(SIZE_MAX == length) {
+        ret = CHOCO_STRING_OVERFLOW;
+        ERROR_MESSAGE("string_intern_acquire(%s) - String length is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    hash = string_hash(str_, length);
+
+    // 登録済みの場合は参照カウントのみ更新
+    atom = bucket_find(str_, length, hash);
+    if(STRING_ATOM_INVALID != atom) {
+        entry = &s_table.entries[atom - 1];
+        if(UINT32_MAX == entry->ref_count) {
+            ret = CHOCO_STRING_LIMIT_EXCEEDED;
+            ERROR_MESSAGE("string_intern_acquire(%s) - Reference count of '%s' exceeds the limit.", rslt_to_str(ret), str_);
+            goto cleanup;
+        }
+        entry->ref_count++;
+        *out_atom_ = atom;
+        ret = CHOCO_STRING_SUCCESS;
+        goto cleanup;
+    }
+
+    // 新規登録: テーブルの状態を変更する前に必要な領域を全て確保する
+    ret = buckets_reserve();
+    if(CHOCO_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("string_intern_acquire(%s) - Failed to reserve hash index.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(STRING_ATOM_INVALID == s_table.free_head && s_table.entry_used == s_table.entry_capacity) {
+        ret = entries_grow();
+        if(CHOCO_STRING_SUCCESS != ret) {
+            ERROR_MESSAGE("string_intern_acquire(%s) - Failed to grow entries.", rslt_to_str(ret));
+            goto cleanup;
+        }
+    }
+    ret = string_intern_mem_allocate(length + 1, (void**)&tmp_str);
+    if(CHOCO_STRING_SUCCESS != ret) {
+        ERROR_MESSAGE("string_intern_acquire(%s) - Failed to allocate memory for string.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memcpy(tmp_str, str_, length + 1);
+
+    if(STRING_ATOM_INVALID != s_table.free_head) {
+        atom = s_table.free_head;
+        s_table.free_head = s_table.entries[atom - 1].next_free;
+    } else {
+        s_table.entry_used++;
+        atom = (string_atom_t)s_table.entry_used;
+    }
+    entry = &s_table.entries[atom - 1];
+    entry->str = tmp_str;
+    entry->length = length;
+    entry->hash = hash;
+    entry->ref_count = 1;
+    entry->next_free = STRING_ATOM_INVALID;
+    bucket_insert(atom, hash);
+    s_table.count++;
+
+    *out_atom_ = atom;
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    if(CHOCO_STRING_SUCCESS != ret) {
+        if(0 == s_table.count) {
+            // 空のテーブルに対する登録失敗時に確保済みの領域を残さない
+            table_release();
+        }
+    }
+    return ret;
+}
+
+void string_intern_release(string_atom_t atom_) {
+    string_intern_entry_t* entry = NULL;
+
+    if(STRING_ATOM_INVALID == atom_) {
+        return;
+    }
+    if(!is_atom_registered(atom_)) {
+        WARN_MESSAGE("string_intern_release - Provided atom '%u' is not registered.", (unsigned int)atom_);
+        return;
+    }
+    entry = &s_table.entries[atom_ - 1];
+    entry->ref_count--;
+    if(0 != entry->ref_count) {
+        return;
+    }
+
+    bucket_remove(atom_, entry->hash);
+    memory_system_free(entry->str, entry->length + 1, MEMORY_TAG_STRING);
+    entry->str = NULL;
+    entry->length = 0;
+    entry->hash = 0;
+    entry->next_free = s_table.free_head;
+    s_table.free_head = atom_;
+    s_table.count--;
+
+    if(0 == s_table.count) {
+        table_release();
+    }
+}
+
+string_atom_t string_intern_find(const char* str_) {
+    size_t length = 0;
+
+    if(NULL == str_ || 0 == s_table.count) {
+        return STRING_ATOM_INVALID;
+    }
+    length = strlen(str_);
+    return bucket_find(str_, length, string_hash(str_, length));
+}
+
+const char* string_intern_c_str(string_atom_t atom_) {
+    if(!is_atom_registered(atom_)) {
+        return NULL;
+    }
+    return s_table.entries[atom_ - 1].str;
+}
+
+size_t string_intern_count(void) {
+    return s_table.count;
+}
+
+/**
+ * @brief 実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 文字列に変換する実行結果コード
+ * @return const char* 変換された文字列の先頭アドレス
+ */
+static const char* rslt_to_str(choco_string_result_t rslt_) {
+    switch(rslt_) {
+    case CHOCO_STRING_SUCCESS:
+        return s_rslt_str_success;
+    case CHOCO_STRING_DATA_CORRUPTED:
+        return s_rslt_str_data_corrupted;
+    case CHOCO_STRING_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case CHOCO_STRING_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case CHOCO_STRING_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case CHOCO_STRING_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case CHOCO_STRING_UNDEFINED_ERROR:
+        return s_rslt_str_undefined_error;
+    case CHOCO_STRING_OVERFLOW:
+        return s_rslt_str_overflow;
+    case CHOCO_STRING_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+/**
+ * @brief メモリシステムの実行結果コードをchoco_string_result_tに変換する
+ *
+ * @param[in] rslt_ メモリシステムの実行結果コード
+ *
+ * @return choco_string_result_t 変換後の実行結果コード(未定義の値はCHOCO_STRING_UNDEFINED_ERROR)
+ */
+static choco_string_result_t rslt_convert_mem_sys(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return CHOCO_STRING_INVALID_ARGUMENT;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return CHOCO_STRING_NO_MEMORY;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return CHOCO_STRING_LIMIT_EXCEEDED;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return CHOCO_STRING_BAD_OPERATION;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return CHOCO_STRING_RUNTIME_ERROR;
+    case MEMORY_SYSTEM_SUCCESS:
+        return CHOCO_STRING_SUCCESS;
+    default:
+        return CHOCO_STRING_UNDEFINED_ERROR;
+    }
+}
+
+/**
+ * @brief memory_system_allocateのラッパ関数で、指定されたサイズのメモリを確保する
+ *
+ * @note メモリタグはMEMORY_TAG_STRING固定
+ *
+ * @param[in] size_ 確保するメモリサイズ
+ * @param[out] out_ptr_ 確保したメモリの先頭アドレス
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT out_ptr_ == NULL、またはmemory_system_allocateの実行結果がMEMORY_SYSTEM_INVALID_ARGUMENT
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリシステムの使用可能範囲上限超過
+ * @retval CHOCO_STRING_RUNTIME_ERROR memory_system_allocateがMEMORY_SYSTEM_RUNTIME_ERRORを返した
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS メモリ確保に成功し、正常終了
+ */
+static choco_string_result_t string_intern_mem_allocate(size_t size_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    s_test_config_string_intern_mem_allocate.call_count++;
+    if(s_test_config_string_intern_mem_allocate.fail_on_call != 0) {
+        if(s_test_config_string_intern_mem_allocate.call_count == s_test_config_string_intern_mem_allocate.fail_on_call) {
+            return (choco_string_result_t)s_test_config_string_intern_mem_allocate.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "string_intern_mem_allocate", "out_ptr_")
+
+    ret = rslt_convert_mem_sys(memory_system_allocate(size_, MEMORY_TAG_STRING, out_ptr_));
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief memory_system_reallocateのラッパ関数で、確保済みのメモリをnew_size_に再割り当てする
+ *
+ * @note
+ * - メモリタグはMEMORY_TAG_STRING固定
+ * - 処理に失敗した場合、ptr_の領域と*out_ptr_は不変
+ *
+ * @param[in] ptr_ 再割り当て対象メモリアドレス(NULLの場合は新規割り当て)
+ * @param[in] old_size_ 現在の割り当てサイズ(ptr_ == NULLの場合は0)
+ * @param[in] new_size_ 変更後の割り当てサイズ
+ * @param[out] out_ptr_ 再割り当て後のメモリの先頭アドレス(ptr_を保持している変数のアドレスを渡してもよい)
+ *
+ * @retval CHOCO_STRING_INVALID_ARGUMENT out_ptr_ == NULL、またはmemory_system_reallocateの実行結果がMEMORY_SYSTEM_INVALID_ARGUMENT
+ * @retval CHOCO_STRING_NO_MEMORY メモリ確保失敗
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED メモリシステムの使用可能範囲上限超過
+ * @retval CHOCO_STRING_RUNTIME_ERROR memory_system_reallocateがMEMORY_SYSTEM_RUNTIME_ERRORを返した
+ * @retval CHOCO_STRING_BAD_OPERATION メモリシステム未初期化
+ * @retval CHOCO_STRING_SUCCESS 再割り当てに成功し、正常終了
+ */
+static choco_string_result_t string_intern_mem_reallocate(void* ptr_, size_t old_size_, size_t new_size_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    s_test_config_string_intern_mem_reallocate.call_count++;
+    if(s_test_config_string_intern_mem_reallocate.fail_on_call != 0) {
+        if(s_test_config_string_intern_mem_reallocate.call_count == s_test_config_string_intern_mem_reallocate.fail_on_call) {
+            return (choco_string_result_t)s_test_config_string_intern_mem_reallocate.forced_result;
+        }
+    }
+#endif
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, CHOCO_STRING_INVALID_ARGUMENT, rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT), "string_intern_mem_reallocate", "out_ptr_")
+
+    ret = rslt_convert_mem_sys(memory_system_reallocate(ptr_, old_size_, new_size_, MEMORY_TAG_STRING, out_ptr_));
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief 文字列のハッシュ値をFNV-1a(32bit)で計算する
+ *
+ * @param[in] str_ 計算対象文字列
+ * @param[in] length_ 文字列長さ(終端文字は含まない)
+ *
+ * @return uint32_t ハッシュ値
+ */
+static uint32_t string_hash(const char* str_, size_t length_) {
+    uint32_t hash = STRING_INTERN_FNV_OFFSET_BASIS;
+    for(size_t i = 0; i != length_; ++i) {
+        hash ^= (uint32_t)(unsigned char)str_[i];
+        hash *= STRING_INTERN_FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief ハッシュインデックスからstr_に対応するアトムを検索する
+ *
+ * @note ハッシュ値、文字列長さが一致したエントリに対してのみ文字列比較を行う
+ *
+ * @param[in] str_ 検索する文字列
+ * @param[in] length_ 文字列長さ(終端文字は含まない)
+ * @param[in] hash_ str_のハッシュ値
+ *
+ * @return string_atom_t str_に対応するアトム(未登録の場合はSTRING_ATOM_INVALID)
+ */
+static string_atom_t bucket_find(const char* str_, size_t length_, uint32_t hash_) {
+    size_t mask = 0;
+    size_t index = 0;
+
+    if(0 == s_table.bucket_capacity) {
+        return STRING_ATOM_INVALID;
+    }
+    mask = s_table.bucket_capacity - 1;
+    index = (size_t)hash_ & mask;
+    while(STRING_ATOM_INVALID != s_table.buckets[index]) {
+        const string_atom_t atom = s_table.buckets[index];
+        if(STRING_INTERN_TOMBSTONE != atom) {
+            const string_intern_entry_t* entry = &s_table.entries[atom - 1];
+            if(entry->hash == hash_ && entry->length == length_ && 0 == memcmp(entry->str, str_, length_)) {
+                return atom;
+            }
+        }
+        index = (index + 1) & mask;
+    }
+    return STRING_ATOM_INVALID;
+}
+
+/**
+ * @brief ハッシュインデックスにatom_を追加する
+ *
+ * @note 呼び出し前にbuckets_reserveで空きバケットを確保しておくこと
+ *
+ * @param[in] atom_ 追加するアトム
+ * @param[in] hash_ atom_に対応する文字列のハッシュ値
+ */
+static void bucket_insert(string_atom_t atom_, uint32_t hash_) {
+    const size_t mask = s_table.bucket_capacity - 1;
+    size_t index = (size_t)hash_ & mask;
+
+    while(STRING_ATOM_INVALID != s_table.buckets[index] && STRING_INTERN_TOMBSTONE != s_table.buckets[index]) {
+        index = (index + 1) & mask;
+    }
+    if(STRING_INTERN_TOMBSTONE == s_table.buckets[index]) {
+        s_table.tombstone_count--;
+    }
+    s_table.buckets[index] = atom_;
+}
+
+/**
+ * @brief ハッシュインデックスからatom_を削除し、削除済みバケットにする
+ *
+ * @param[in] atom_ 削除するアトム
+ * @param[in] hash_ atom_に対応する文字列のハッシュ値
+ */
+static void bucket_remove(string_atom_t atom_, uint32_t hash_) {
+    const size_t mask = s_table.bucket_capacity - 1;
+    size_t index = (size_t)hash_ & mask;
+
+    while(STRING_ATOM_INVALID != s_table.buckets[index]) {
+        if(atom_ == s_table.buckets[index]) {
+            s_table.buckets[index] = STRING_INTERN_TOMBSTONE;
+            s_table.tombstone_count++;
+            return;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+/**
+ * @brief 文字列を1つ追加しても使用中+削除済みバケット数が容量の1/2以下となるようにハッシュインデックスを再構築する
+ *
+ * @note 登録文字列数に対して容量が不足する場合は容量を2倍にし、削除済みバケットが多い場合は同じ容量で再構築する
+ *
+ * @retval CHOCO_STRING_OVERFLOW 容量の計算過程でオーバーフローが発生
+ * @retval CHOCO_STRING_SUCCESS 再構築が不要、または再構築に成功し、正常終了
+ * @retval 上記以外 buckets_rehashの実行結果
+ */
+static choco_string_result_t buckets_reserve(void) {
+    size_t new_capacity = 0;
+
+    if((s_table.count + s_table.tombstone_count + 1) * 2 <= s_table.bucket_capacity) {
+        return CHOCO_STRING_SUCCESS;
+    }
+    if(0 == s_table.bucket_capacity) {
+        new_capacity = STRING_INTERN_INITIAL_CAPACITY;
+    } else if((s_table.count + 1) * 2 > s_table.bucket_capacity) {
+        if(s_table.bucket_capacity > SIZE_MAX / 2) {
+            return CHOCO_STRING_OVERFLOW;
+        }
+        new_capacity = s_table.bucket_capacity * 2;
+    } else {
+        new_capacity = s_table.bucket_capacity;
+    }
+    return buckets_rehash(new_capacity);
+}
+
+/**
+ * @brief 容量new_capacity_のハッシュインデックスを確保し、登録済みの全アトムを格納し直す
+ *
+ * @note
+ * - 各エントリが保持するハッシュ値を使用するため、文字列のハッシュ値は再計算しない
+ * - 処理に失敗した場合、ハッシュインデックスは不変
+ *
+ * @param[in] new_capacity_ 新しい容量(2のべき乗 かつ 登録文字列数より大きいこと)
+ *
+ * @retval CHOCO_STRING_OVERFLOW 必要メモリ量の計算過程でオーバーフローが発生
+ * @retval CHOCO_STRING_SUCCESS 再構築に成功し、正常終了
+ * @retval 上記以外 string_intern_mem_allocateの実行結果
+ */
+static choco_string_result_t buckets_rehash(size_t new_capacity_) {
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    string_atom_t* new_buckets = NULL;
+    string_atom_t* old_buckets = s_table.buckets;
+    const size_t old_capacity = s_table.bucket_capacity;
+
+    if(new_capacity_ > SIZE_MAX / sizeof(string_atom_t)) {
+        ret = CHOCO_STRING_OVERFLOW;
+        goto cleanup;
+    }
+    ret = string_intern_mem_allocate(new_capacity_ * sizeof(string_atom_t), (void**)&new_buckets);
+    if(CHOCO_STRING_SUCCESS != ret) {
+        goto cleanup;
+    }
+    memset(new_buckets, 0, new_capacity_ * sizeof(string_atom_t));
+
+    s_table.buckets = new_buckets;
+    s_table.bucket_capacity = new_capacity_;
+    s_table.tombstone_count = 0;
+    for(size_t i = 0; i != s_table.entry_used; ++i) {
+        if(NULL != s_table.entries[i].str) {
+            bucket_insert((string_atom_t)(i + 1), s_table.entries[i].hash);
+        }
+    }
+    if(NULL != old_buckets) {
+        memory_system_free(old_buckets, old_capacity * sizeof(string_atom_t), MEMORY_TAG_STRING);
+    }
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief エントリ配列の容量を2倍(初回はSTRING_INTERN_INITIAL_CAPACITY)に拡張する
+ *
+ * @note
+ * - 容量はSTRING_INTERN_ATOM_MAXで頭打ちとする
+ * - 処理に失敗した場合、エントリ配列は不変
+ *
+ * @retval CHOCO_STRING_LIMIT_EXCEEDED エントリ数がSTRING_INTERN_ATOM_MAXに到達済み
+ * @retval CHOCO_STRING_OVERFLOW 必要メモリ量の計算過程でオーバーフローが発生
+ * @retval CHOCO_STRING_SUCCESS 拡張に成功し、正常終了
+ * @retval 上記以外 string_intern_mem_reallocateの実行結果
+ */
+static choco_string_result_t entries_grow(void) {
+    choco_string_result_t ret = CHOCO_STRING_INVALID_ARGUMENT;
+    size_t new_capacity = 0;
+
+    if(s_table.entry_capacity >= STRING_INTERN_ATOM_MAX) {
+        ret = CHOCO_STRING_LIMIT_EXCEEDED;
+        goto cleanup;
+    }
+    if(0 == s_table.entry_capacity) {
+        new_capacity = STRING_INTERN_INITIAL_CAPACITY;
+    } else if(s_table.entry_capacity > STRING_INTERN_ATOM_MAX / 2) {
+        new_capacity = STRING_INTERN_ATOM_MAX;
+    } else {
+        new_capacity = s_table.entry_capacity * 2;
+    }
+    if(new_capacity > SIZE_MAX / sizeof(string_intern_entry_t)) {
+        ret = CHOCO_STRING_OVERFLOW;
+        goto cleanup;
+    }
+    ret = string_intern_mem_reallocate(s_table.entries, s_table.entry_capacity * sizeof(string_intern_entry_t), new_capacity * sizeof(string_intern_entry_t), (void**)&s_table.entries);
+    if(CHOCO_STRING_SUCCESS != ret) {
+        goto cleanup;
+    }
+    s_table.entry_capacity = new_capacity;
+
+    ret = CHOCO_STRING_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief atom_が登録中の文字列に対応するアトムかを判定する
+ *
+ * @param[in] atom_ 判定対象アトム
+ *
+ * @retval true 登録中の文字列に対応する
+ * @retval false STRING_ATOM_INVALID、範囲外、または削除済み
+ */
+static bool is_atom_registered(string_atom_t atom_) {
+    if(STRING_ATOM_INVALID == atom_ || (size_t)atom_ > s_table.entry_used) {
+        return false;
+    }
+    return (NULL != s_table.entries[atom_ - 1].str && 0 != s_table.entries[atom_ - 1].ref_count) ? true : false;
+}
+
+/**
+ * @brief インターンテーブルが管理する全てのメモリを解放し、テーブルを初期状態に戻す
+ *
+ */
+static void table_release(void) {
+    if(NULL != s_table.entries) {
+        for(size_t i = 0; i != s_table.entry_used; ++i) {
+            if(NULL != s_table.entries[i].str) {
+                memory_system_free(s_table.entries[i].str, s_table.entries[i].length + 1, MEMORY_TAG_STRING);
+            }
+        }
+        memory_system_free(s_table.entries, s_table.entry_capacity * sizeof(string_intern_entry_t), MEMORY_TAG_STRING);
+    }
+    if(NULL != s_table.buckets) {
+        memory_system_free(s_table.buckets, s_table.bucket_capacity * sizeof(string_atom_t), MEMORY_TAG_STRING);
+    }
+    memset(&s_table, 0, sizeof(s_table));
+}
+
+#ifdef TEST_BUILD
+void test_string_intern_acquire_config_set(const test_call_control_t* config_) {
+    s_test_config_string_intern_acquire.fail_on_call = config_->fail_on_call;
+    s_test_config_string_intern_acquire.forced_result = config_->forced_result;
+}
+
+void test_string_intern_config_reset(void) {
+    test_call_control_reset(&s_test_config_string_intern_acquire);
+
+    test_call_control_reset(&s_test_config_string_intern_mem_allocate);
+    test_call_control_reset(&s_test_config_string_intern_mem_reallocate);
+}
+
+void test_string_intern(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    test_string_intern_acquire();
+    test_string_intern_release();
+    test_string_intern_find();
+    test_string_intern_c_str();
+    test_string_hash();
+    test_buckets_rehash();
+    test_entries_grow();
+    test_rslt_convert_mem_sys();
+    test_rslt_to_str();
+
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_string_intern_acquire(void) {
+    test_string_intern_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // string_intern_acquire() 冒頭で強制的に CHOCO_STRING_NO_MEMORY を返させる
+        string_atom_t atom = STRING_ATOM_INVALID;
+        test_call_control_t config = {0};
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        test_string_intern_acquire_config_set(&config);
+
+        assert(CHOCO_STRING_NO_MEMORY == string_intern_acquire("main_camera", &atom));
+        assert(STRING_ATOM_INVALID == atom);
+        assert(0U == string_intern_count());
+
+        test_string_intern_config_reset();
+    }
+    {
+        // 引数異常 -> CHOCO_STRING_INVALID_ARGUMENT
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        assert(CHOCO_STRING_INVALID_ARGUMENT == string_intern_acquire(NULL, &atom));
+        assert(CHOCO_STRING_INVALID_ARGUMENT == string_intern_acquire("main_camera", NULL));
+        assert(STRING_ATOM_INVALID == atom);
+        assert(NULL == s_table.entries);
+        assert(NULL == s_table.buckets);
+    }
+    {
+        // 新規登録 -> 同一内容の文字列は同一アトム、参照カウントが増える
+        string_atom_t atom_a = STRING_ATOM_INVALID;
+        string_atom_t atom_b = STRING_ATOM_INVALID;
+        string_atom_t atom_c = STRING_ATOM_INVALID;
+        char same_name[] = "main_camera";
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("main_camera", &atom_a));
+        assert(STRING_ATOM_INVALID != atom_a);
+        assert(1U == string_intern_count());
+        assert(STRING_INTERN_INITIAL_CAPACITY == s_table.entry_capacity);
+        assert(STRING_INTERN_INITIAL_CAPACITY == s_table.bucket_capacity);
+        assert(1U == s_table.entries[atom_a - 1].ref_count);
+        assert(string_hash("main_camera", 11U) == s_table.entries[atom_a - 1].hash);
+        assert(11U == s_table.entries[atom_a - 1].length);
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire(same_name, &atom_b));
+        assert(atom_a == atom_b);
+        assert(1U == string_intern_count());
+        assert(2U == s_table.entries[atom_a - 1].ref_count);
+        assert(string_intern_c_str(atom_a) != same_name);
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("", &atom_c));
+        assert(STRING_ATOM_INVALID != atom_c);
+        assert(atom_a != atom_c);
+        assert(2U == string_intern_count());
+        assert(0 == strcmp("", string_intern_c_str(atom_c)));
+
+        string_intern_release(atom_a);
+        string_intern_release(atom_b);
+        string_intern_release(atom_c);
+        assert(0U == string_intern_count());
+        assert(NULL == s_table.entries);
+        assert(NULL == s_table.buckets);
+    }
+    {
+        // 参照カウント上限 -> CHOCO_STRING_LIMIT_EXCEEDED
+        string_atom_t atom = STRING_ATOM_INVALID;
+        string_atom_t out_atom = STRING_ATOM_INVALID;
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("main_camera", &atom));
+        s_table.entries[atom - 1].ref_count = UINT32_MAX;
+        assert(CHOCO_STRING_LIMIT_EXCEEDED == string_intern_acquire("main_camera", &out_atom));
+        assert(STRING_ATOM_INVALID == out_atom);
+        assert(UINT32_MAX == s_table.entries[atom - 1].ref_count);
+
+        s_table.entries[atom - 1].ref_count = 1U;
+        string_intern_release(atom);
+        assert(0U == string_intern_count());
+    }
+    {
+        // 空のテーブルで文字列のメモリ確保に失敗 -> 確保済みのテーブル領域も解放される
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        test_string_intern_config_reset();
+        s_test_config_string_intern_mem_allocate.fail_on_call = 2U;
+        s_test_config_string_intern_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+
+        assert(CHOCO_STRING_NO_MEMORY == string_intern_acquire("main_camera", &atom));
+        assert(STRING_ATOM_INVALID == atom);
+        assert(0U == string_intern_count());
+        assert(NULL == s_table.entries);
+        assert(NULL == s_table.buckets);
+
+        test_string_intern_config_reset();
+    }
+    {
+        // ハッシュインデックス/エントリ配列の確保失敗 -> 登録済みの文字列は不変
+        string_atom_t atom = STRING_ATOM_INVALID;
+        string_atom_t out_atom = STRING_ATOM_INVALID;
+
+        test_string_intern_config_reset();
+        s_test_config_string_intern_mem_allocate.fail_on_call = 1U;
+        s_test_config_string_intern_mem_allocate.forced_result = (int)CHOCO_STRING_LIMIT_EXCEEDED;
+        assert(CHOCO_STRING_LIMIT_EXCEEDED == string_intern_acquire("main_camera", &out_atom));
+        assert(NULL == s_table.entries);
+        assert(NULL == s_table.buckets);
+
+        test_string_intern_config_reset();
+        s_test_config_string_intern_mem_reallocate.fail_on_call = 1U;
+        s_test_config_string_intern_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+        assert(CHOCO_STRING_NO_MEMORY == string_intern_acquire("main_camera", &out_atom));
+        assert(NULL == s_table.entries);
+        assert(NULL == s_table.buckets);
+        assert(STRING_ATOM_INVALID == out_atom);
+
+        // エントリ配列が満杯の状態でエントリ配列の拡張に失敗
+        {
+            string_atom_t atoms[STRING_INTERN_INITIAL_CAPACITY];
+            char name[32];
+
+            test_string_intern_config_reset();
+            for(size_t i = 0; i != STRING_INTERN_INITIAL_CAPACITY; ++i) {
+                (void)snprintf(name, sizeof(name), "camera_%zu", i);
+                assert(CHOCO_STRING_SUCCESS == string_intern_acquire(name, &atoms[i]));
+            }
+            atom = atoms[0];
+            assert(STRING_INTERN_INITIAL_CAPACITY == s_table.entry_used);
+            assert(STRING_INTERN_INITIAL_CAPACITY == s_table.entry_capacity);
+
+            s_test_config_string_intern_mem_reallocate.fail_on_call = s_test_config_string_intern_mem_reallocate.call_count + 1U;
+            s_test_config_string_intern_mem_reallocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+            assert(CHOCO_STRING_NO_MEMORY == string_intern_acquire("sub_camera", &out_atom));
+            assert(STRING_ATOM_INVALID == out_atom);
+            assert(STRING_INTERN_INITIAL_CAPACITY == string_intern_count());
+            assert(STRING_INTERN_INITIAL_CAPACITY == s_table.entry_capacity);
+            assert(atom == string_intern_find("camera_0"));
+            assert(STRING_ATOM_INVALID == string_intern_find("sub_camera"));
+
+            test_string_intern_config_reset();
+            for(size_t i = 0; i != STRING_INTERN_INITIAL_CAPACITY; ++i) {
+                string_intern_release(atoms[i]);
+            }
+            assert(0U == string_intern_count());
+        }
+    }
+    {
+        // 多数の文字列を登録 -> エントリ配列/ハッシュインデックスが拡張され、既存アトムと文字列アドレスは不変
+        string_atom_t atoms[100];
+        const char* first_str = NULL;
+        char name[32];
+
+        for(size_t i = 0; i != 100U; ++i) {
+            (void)snprintf(name, sizeof(name), "texture_%zu", i);
+            atoms[i] = STRING_ATOM_INVALID;
+            assert(CHOCO_STRING_SUCCESS == string_intern_acquire(name, &atoms[i]));
+            if(0U == i) {
+                first_str = string_intern_c_str(atoms[0]);
+            }
+        }
+        assert(100U == string_intern_count());
+        assert(128U <= s_table.entry_capacity);
+        assert(256U == s_table.bucket_capacity);
+        assert(first_str == string_intern_c_str(atoms[0]));
+        for(size_t i = 0; i != 100U; ++i) {
+            (void)snprintf(name, sizeof(name), "texture_%zu", i);
+            assert(atoms[i] == string_intern_find(name));
+            assert(0 == strcmp(name, string_intern_c_str(atoms[i])));
+        }
+        for(size_t i = 0; i != 100U; ++i) {
+            string_intern_release(atoms[i]);
+        }
+        assert(0U == string_intern_count());
+        assert(NULL == s_table.entries);
+    }
+}
+
+static void NO_COVERAGE test_string_intern_release(void) {
+    test_string_intern_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // STRING_ATOM_INVALID、未登録アトム -> no-op
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        string_intern_release(STRING_ATOM_INVALID);
+        string_intern_release(12345U);
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("main_camera", &atom));
+        string_intern_release(atom + 1U);
+        assert(1U == string_intern_count());
+        string_intern_release(atom);
+        assert(0U == string_intern_count());
+    }
+    {
+        // 参照が残っている間は削除されない、削除後のエントリは再利用される
+        string_atom_t atom_a = STRING_ATOM_INVALID;
+        string_atom_t atom_b = STRING_ATOM_INVALID;
+        string_atom_t atom_c = STRING_ATOM_INVALID;
+        string_atom_t atom_d = STRING_ATOM_INVALID;
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_0", &atom_a));
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_0", &atom_a));
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_1", &atom_b));
+
+        string_intern_release(atom_a);
+        assert(2U == string_intern_count());
+        assert(0 == strcmp("camera_0", string_intern_c_str(atom_a)));
+
+        string_intern_release(atom_a);
+        assert(1U == string_intern_count());
+        assert(NULL == string_intern_c_str(atom_a));
+        assert(STRING_ATOM_INVALID == string_intern_find("camera_0"));
+        assert(atom_b == string_intern_find("camera_1"));
+        assert(atom_a == s_table.free_head);
+        assert(1U == s_table.tombstone_count);
+
+        // 2重解放 -> no-op
+        string_intern_release(atom_a);
+        assert(1U == string_intern_count());
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_2", &atom_c));
+        assert(atom_a == atom_c);
+        assert(STRING_ATOM_INVALID == s_table.free_head);
+        assert(2U == s_table.entry_used);
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_3", &atom_d));
+        assert(3U == atom_d);
+
+        string_intern_release(atom_b);
+        string_intern_release(atom_c);
+        string_intern_release(atom_d);
+        assert(0U == string_intern_count());
+        assert(NULL == s_table.entries);
+        assert(NULL == s_table.buckets);
+        assert(0U == s_table.entry_used);
+        assert(STRING_ATOM_INVALID == s_table.free_head);
+    }
+}
+
+static void NO_COVERAGE test_string_intern_find(void) {
+    test_string_intern_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // 空のテーブル、NULL -> STRING_ATOM_INVALID
+        assert(STRING_ATOM_INVALID == string_intern_find(NULL));
+        assert(STRING_ATOM_INVALID == string_intern_find("main_camera"));
+    }
+    {
+        // 登録済み/未登録、参照カウントは変化しない
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("main_camera", &atom));
+        assert(atom == string_intern_find("main_camera"));
+        assert(1U == s_table.entries[atom - 1].ref_count);
+        assert(STRING_ATOM_INVALID == string_intern_find(NULL));
+        assert(STRING_ATOM_INVALID == string_intern_find("main_camer"));
+        assert(STRING_ATOM_INVALID == string_intern_find("main_camera_"));
+        assert(STRING_ATOM_INVALID == string_intern_find(""));
+
+        string_intern_release(atom);
+    }
+    {
+        // ハッシュ値が衝突するバケットを線形探索でたどれる
+        string_atom_t atom_a = STRING_ATOM_INVALID;
+        string_atom_t atom_b = STRING_ATOM_INVALID;
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_a", &atom_a));
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("camera_b", &atom_b));
+
+        // camera_bのハッシュ値をcamera_aと同じにしてハッシュインデックスを構築し直す
+        memset(s_table.buckets, 0, s_table.bucket_capacity * sizeof(string_atom_t));
+        s_table.tombstone_count = 0;
+        s_table.entries[atom_b - 1].hash = s_table.entries[atom_a - 1].hash;
+        bucket_insert(atom_a, s_table.entries[atom_a - 1].hash);
+        bucket_insert(atom_b, s_table.entries[atom_b - 1].hash);
+
+        assert(atom_a == bucket_find("camera_a", 8U, s_table.entries[atom_a - 1].hash));
+        assert(atom_b == bucket_find("camera_b", 8U, s_table.entries[atom_a - 1].hash));
+
+        // 探索経路上のcamera_aを削除しても削除済みバケットを越えてcamera_bを探索できる
+        string_intern_release(atom_a);
+        assert(atom_b == bucket_find("camera_b", 8U, s_table.entries[atom_b - 1].hash));
+        string_intern_release(atom_b);
+        assert(0U == string_intern_count());
+    }
+}
+
+static void NO_COVERAGE test_string_intern_c_str(void) {
+    test_string_intern_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        assert(NULL == string_intern_c_str(STRING_ATOM_INVALID));
+        assert(NULL == string_intern_c_str(1U));
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("main_camera", &atom));
+        assert(0 == strcmp("main_camera", string_intern_c_str(atom)));
+        assert(NULL == string_intern_c_str(atom + 1U));
+
+        string_intern_release(atom);
+        assert(NULL == string_intern_c_str(atom));
+    }
+}
+
+static void NO_COVERAGE test_string_hash(void) {
+    // FNV-1a(32bit)の参照値
+    assert(2166136261U == string_hash("", 0U));
+    assert(0xE40C292CU == string_hash("a", 1U));
+    assert(0xBF9CF968U == string_hash("foobar", 6U));
+    assert(string_hash("foobar", 3U) == string_hash("foo", 3U));
+}
+
+static void NO_COVERAGE test_buckets_rehash(void) {
+    test_string_intern_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // 削除済みバケットが増えた場合は同じ容量で再構築され、削除済みバケットが除去される
+        string_atom_t keep = STRING_ATOM_INVALID;
+        char name[32];
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("keep", &keep));
+        for(size_t i = 0; i != 32U; ++i) {
+            string_atom_t atom = STRING_ATOM_INVALID;
+            (void)snprintf(name, sizeof(name), "temporary_%zu", i);
+            assert(CHOCO_STRING_SUCCESS == string_intern_acquire(name, &atom));
+            string_intern_release(atom);
+            assert(STRING_INTERN_INITIAL_CAPACITY == s_table.bucket_capacity);
+            assert((s_table.count + s_table.tombstone_count) * 2 <= s_table.bucket_capacity);
+        }
+        assert(keep == string_intern_find("keep"));
+
+        // 再構築の確保失敗 -> CHOCO_STRING_NO_MEMORY、ハッシュインデックスは不変
+        {
+            string_atom_t* old_buckets = s_table.buckets;
+            test_string_intern_config_reset();
+            s_test_config_string_intern_mem_allocate.fail_on_call = 1U;
+            s_test_config_string_intern_mem_allocate.forced_result = (int)CHOCO_STRING_NO_MEMORY;
+            assert(CHOCO_STRING_NO_MEMORY == buckets_rehash(32U));
+            assert(old_buckets == s_table.buckets);
+            assert(STRING_INTERN_INITIAL_CAPACITY == s_table.bucket_capacity);
+            test_string_intern_config_reset();
+        }
+        assert(CHOCO_STRING_OVERFLOW == buckets_rehash(SIZE_MAX));
+
+        assert(CHOCO_STRING_SUCCESS == buckets_rehash(64U));
+        assert(64U == s_table.bucket_capacity);
+        assert(0U == s_table.tombstone_count);
+        assert(keep == string_intern_find("keep"));
+
+        string_intern_release(keep);
+        assert(0U == string_intern_count());
+    }
+}
+
+static void NO_COVERAGE test_entries_grow(void) {
+    test_string_intern_config_reset();
+    test_choco_memory_config_reset();
+
+    {
+        // 容量上限 -> CHOCO_STRING_LIMIT_EXCEEDED
+        s_table.entry_capacity = STRING_INTERN_ATOM_MAX;
+        assert(CHOCO_STRING_LIMIT_EXCEEDED == entries_grow());
+        s_table.entry_capacity = 0U;
+    }
+    {
+        // 初回確保、2倍拡張
+        assert(CHOCO_STRING_SUCCESS == entries_grow());
+        assert(STRING_INTERN_INITIAL_CAPACITY == s_table.entry_capacity);
+        assert(NULL != s_table.entries);
+        assert(CHOCO_STRING_SUCCESS == entries_grow());
+        assert(STRING_INTERN_INITIAL_CAPACITY * 2U == s_table.entry_capacity);
+
+        table_release();
+        assert(NULL == s_table.entries);
+        assert(0U == s_table.entry_capacity);
+    }
+}
+
+static void NO_COVERAGE test_rslt_convert_mem_sys(void) {
+    assert(CHOCO_STRING_INVALID_ARGUMENT == rslt_convert_mem_sys(MEMORY_SYSTEM_INVALID_ARGUMENT));
+    assert(CHOCO_STRING_NO_MEMORY == rslt_convert_mem_sys(MEMORY_SYSTEM_NO_MEMORY));
+    assert(CHOCO_STRING_LIMIT_EXCEEDED == rslt_convert_mem_sys(MEMORY_SYSTEM_LIMIT_EXCEEDED));
+    assert(CHOCO_STRING_BAD_OPERATION == rslt_convert_mem_sys(MEMORY_SYSTEM_BAD_OPERATION));
+    assert(CHOCO_STRING_RUNTIME_ERROR == rslt_convert_mem_sys(MEMORY_SYSTEM_RUNTIME_ERROR));
+    assert(CHOCO_STRING_SUCCESS == rslt_convert_mem_sys(MEMORY_SYSTEM_SUCCESS));
+    assert(CHOCO_STRING_UNDEFINED_ERROR == rslt_convert_mem_sys((memory_system_result_t)100));
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(0 == strcmp("SUCCESS", rslt_to_str(CHOCO_STRING_SUCCESS)));
+    assert(0 == strcmp("DATA_CORRUPTED", rslt_to_str(CHOCO_STRING_DATA_CORRUPTED)));
+    assert(0 == strcmp("BAD_OPERATION", rslt_to_str(CHOCO_STRING_BAD_OPERATION)));
+    assert(0 == strcmp("NO_MEMORY", rslt_to_str(CHOCO_STRING_NO_MEMORY)));
+    assert(0 == strcmp("INVALID_ARGUMENT", rslt_to_str(CHOCO_STRING_INVALID_ARGUMENT)));
+    assert(0 == strcmp("RUNTIME_ERROR", rslt_to_str(CHOCO_STRING_RUNTIME_ERROR)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str(CHOCO_STRING_UNDEFINED_ERROR)));
+    assert(0 == strcmp("OVERFLOW", rslt_to_str(CHOCO_STRING_OVERFLOW)));
+    assert(0 == strcmp("LIMIT_EXCEEDED", rslt_to_str(CHOCO_STRING_LIMIT_EXCEEDED)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str((choco_string_result_t)100)));
+}
+#endif
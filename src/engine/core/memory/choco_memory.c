@@ -13,17 +13,23 @@
  * MIT License. See LICENSE file in the project root for full license text.
  *
  */
+#include <pthread.h>
 #include <stdalign.h>
+#include <stdarg.h> // for va_list
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>  // for fprintf
-#include <stdlib.h> // for malloc TODO: remove this!!
+#include <stdio.h>  // for fprintf, vsnprintf
+#include <stdlib.h> // for malloc, posix_memalign TODO: remove this!!
 #include <string.h> // for memset
 
 #include "engine/base/choco_macros.h"
 #include "engine/base/choco_message.h"
 
 #include "engine/core/memory/choco_memory.h"
+#include "engine/core/memory/freelist_allocator.h"
+#include "engine/core/memory/slab_allocator.h"
 
 // #define TEST_BUILD
 
@@ -33,10 +39,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "engine/core/memory/test_choco_memory.h"
+#include "engine/core/memory/test_freelist_allocator.h"
+#include "engine/core/memory/test_slab_allocator.h"
 
 // 外部公開APIテスト設定
 static test_call_control_t s_test_config_memory_system_create;       /**< memory_system_create()テスト設定 */
 static test_call_control_t s_test_config_memory_system_allocate;     /**< memory_system_allocate()テスト設定 */
+static test_call_control_t s_test_config_memory_system_allocate_aligned;  /**< memory_system_allocate_aligned()テスト設定 */
+static test_call_control_t s_test_config_memory_system_reallocate;   /**< memory_system_reallocate()テスト設定 */
+static test_call_control_t s_test_config_memory_system_reallocate_aligned;    /**< memory_system_reallocate_aligned()テスト設定 */
+static bool s_test_config_suspended;    /**< trueの間は上記APIの呼び出し回数カウントと失敗注入を行わない(マルチスレッドテスト中のデータ競合回避) */
 
 // プライベート関数テスト設定
 static test_call_control_t s_test_config_test_malloc;                /**< test_malloc()テスト設定値 */
@@ -46,22 +58,131 @@ static void test_memory_system_create(void);
 static void test_memory_system_destroy(void);
 static void test_memory_system_allocate(void);
 static void test_memory_system_free(void);
+static void test_memory_system_allocate_aligned(void);
+static void test_memory_system_free_aligned(void);
+static void test_memory_system_reallocate(void);
+static void test_memory_system_reallocate_aligned(void);
 static void test_memory_system_report(void);
+static void test_memory_system_tag_stats_get(void);
+static void test_memory_system_tag_str_get(void);
+static void test_memory_system_frame_stats_sample(void);
+static void test_memory_system_stats_export(void);
+static void test_histogram_bin_index(void);
+static void test_memory_system_guard(void);
+static void test_memory_system_multithread(void);
+static void* test_memory_system_multithread_worker(void* arg_);
 static void test_rslt_to_str(void);
 static void test_test_malloc(void);
+static void test_slab_class_index(void);
+#endif
+
+#ifndef MEMORY_SYSTEM_FREELIST_POOL_SIZE
+/**
+ * @brief メモリシステム起動時に予約するフリーリストアロケータ用メモリプール容量
+ *
+ * @note プールに収まらない割り当て要求はmallocにフォールバックする
+ */
+#define MEMORY_SYSTEM_FREELIST_POOL_SIZE (32 * MIB)
+#endif
+
+#ifndef MEMORY_SYSTEM_SLAB_POOL_SIZE
+/**
+ * @brief サイズクラスごとにフリーリストから切り出すスラブアロケータ用メモリプール容量
+ *
+ * @note スラブが枯渇した場合の割り当て要求はフリーリストにフォールバックする
+ */
+#define MEMORY_SYSTEM_SLAB_POOL_SIZE (256 * KIB)
 #endif
 
+/**
+ * @brief スラブアロケータの最小サイズクラス(byte)
+ *
+ * @note サイズクラスは MEMORY_SYSTEM_SLAB_MIN_SIZE << i (i = 0 .. MEMORY_SYSTEM_SLAB_CLASS_COUNT - 1)
+ */
+#define MEMORY_SYSTEM_SLAB_MIN_SIZE ((size_t)16)
+
+/**
+ * @brief スラブアロケータのサイズクラス数(16, 32, 64, 128, 256byte)
+ *
+ */
+#define MEMORY_SYSTEM_SLAB_CLASS_COUNT 5
+
+/**
+ * @brief スレッドキャッシュがサイズクラスごとに保持する空きブロック数の上限
+ *
+ */
+#define MEMORY_SYSTEM_THREAD_CACHE_CAPACITY 32
+
+/**
+ * @brief スレッドキャッシュとスラブアロケータ間で一度に受け渡すブロック数
+ *
+ * @note ロックの取得回数を抑えるため、補充と返却はこの単位でまとめて行う
+ */
+#define MEMORY_SYSTEM_THREAD_CACHE_BATCH 16
+
 /**
  * @brief メモリシステム内部状態管理構造体
  *
+ * @note
+ * - 使用量、統計情報のカウンタはアトミック変数とし、ロックを取得せずに更新する
+ * - フリーリスト、スラブアロケータ、mallocへのフォールバック、ガード違反記録はlockで保護する
  */
 typedef struct memory_system {
-    size_t total_allocated;                     /**< メモリ総割り当て量 */
-    size_t mem_tag_allocated[MEMORY_TAG_MAX];   /**< 各メモリタグごとのメモリ割り当て量 */
+    atomic_size_t total_allocated;                      /**< メモリ総割り当て量 */
+    atomic_size_t total_peak;                           /**< メモリ総割り当て量の最大値 */
+    atomic_size_t mem_tag_allocated[MEMORY_TAG_MAX];    /**< 各メモリタグごとのメモリ割り当て量 */
+    atomic_size_t mem_tag_peak[MEMORY_TAG_MAX];         /**< 各メモリタグごとのメモリ割り当て量の最大値 */
+    atomic_size_t mem_tag_alloc_count[MEMORY_TAG_MAX];  /**< 各メモリタグごとの割り当て回数 */
+    atomic_size_t mem_tag_free_count[MEMORY_TAG_MAX];   /**< 各メモリタグごとの解放回数 */
+    atomic_size_t mem_tag_histogram[MEMORY_TAG_MAX][MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT];   /**< 各メモリタグごとの割り当てサイズヒストグラム */
+    atomic_size_t frame_alloc_count[MEMORY_TAG_MAX];        /**< 前回memory_system_frame_stats_sample呼び出し時点からの割り当て回数 */
+    atomic_size_t frame_free_count[MEMORY_TAG_MAX];         /**< 前回memory_system_frame_stats_sample呼び出し時点からの解放回数 */
+    atomic_size_t frame_allocated_bytes[MEMORY_TAG_MAX];    /**< 前回memory_system_frame_stats_sample呼び出し時点からの割り当て量 */
+    atomic_size_t frame_freed_bytes[MEMORY_TAG_MAX];        /**< 前回memory_system_frame_stats_sample呼び出し時点からの解放量 */
+    atomic_bool guard_armed;                            /**< 定常状態割り当てガード有効フラグ */
+    atomic_int guard_mode;                              /**< 定常状態割り当てガード動作モード(memory_guard_mode_t) */
+    atomic_size_t guard_violation_count;                /**< 定常状態割り当てガード違反回数(lock内で記録の書き込み後に更新) */
+    memory_guard_violation_t guard_violations[MEMORY_SYSTEM_GUARD_RECORD_MAX];  /**< 定常状態割り当てガード違反記録(lockで保護) */
     const char* mem_tag_str[MEMORY_TAG_MAX];    /**< 各メモリタグ文字列 */
+    freelist_alloc_t* freelist;                 /**< メモリ割り当てに使用するフリーリストアロケータ */
+    void* freelist_pool;                        /**< フリーリストアロケータが管理するメモリプール */
+    slab_alloc_t* slab[MEMORY_SYSTEM_SLAB_CLASS_COUNT]; /**< 固定サイズの小さな割り当てに使用するサイズクラスごとのスラブアロケータ */
+    pthread_mutex_t lock;                       /**< アロケータとガード違反記録を保護するロック */
+    pthread_key_t thread_cache_key;             /**< スレッド終了時にスレッドキャッシュをスラブへ返却するためのキー */
+    size_t generation;                          /**< メモリシステムの世代(破棄済みのメモリシステムのスレッドキャッシュを判別する) */
 } memory_system_t;
 
+/**
+ * @brief スラブアロケータのブロックをスレッドごとに保持するキャッシュ
+ *
+ * @details
+ * 256byte以下の割り当て、解放はまずスレッドキャッシュで処理し、ロックを取得しない \n
+ * キャッシュが空、または満杯の場合のみロックを取得し、MEMORY_SYSTEM_THREAD_CACHE_BATCH単位でスラブアロケータと受け渡す \n
+ * キャッシュ中のブロックは、スラブアロケータからは割り当て済みとして扱われる
+ */
+typedef struct thread_cache {
+    size_t generation;                                  /**< キャッシュ中のブロックの割り当て元メモリシステムの世代(0は未使用) */
+    size_t count[MEMORY_SYSTEM_SLAB_CLASS_COUNT];       /**< サイズクラスごとのキャッシュ中のブロック数 */
+    void* blocks[MEMORY_SYSTEM_SLAB_CLASS_COUNT][MEMORY_SYSTEM_THREAD_CACHE_CAPACITY];  /**< サイズクラスごとのキャッシュ中のブロック */
+} thread_cache_t;
+
+#if defined(__clang__) || defined(__GNUC__)
+/**
+ * @brief 定常状態割り当てガードの違反記録に使用する呼び出し元アドレス取得マクロ(clang, gcc使用時のみ)
+ *
+ */
+#define MEMORY_SYSTEM_CALLER_ADDRESS() __builtin_return_address(0)
+#else
+/**
+ * @brief clang, gcc使用時以外は呼び出し元アドレスを取得しない
+ *
+ */
+#define MEMORY_SYSTEM_CALLER_ADDRESS() NULL
+#endif
+
 static memory_system_t* s_mem_sys_ptr = NULL;   /**< メモリシステム内部状態管理構造体インスタンス */
+static size_t s_generation = 0;                 /**< 最後に起動したメモリシステムの世代(memory_system_createごとにインクリメント) */
+static _Thread_local thread_cache_t s_thread_cache; /**< 呼び出しスレッドのスレッドキャッシュ */
 
 static const char* const s_rslt_str_success = "SUCCESS";                    /**< メモリシステムAPI実行結果コード(処理成功)に対応する文字列 */
 static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";  /**< メモリシステムAPI実行結果コード(無効な引数)に対応する文字列 */
@@ -72,7 +193,27 @@ static const char* const s_rslt_str_bad_operation = "BAD_OPERATION";        /**<
 static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";    /**< メモリシステムAPI実行結果コード(不明なエラー)に対応する文字列 */
 
 static const char* rslt_to_str(memory_system_result_t rslt_);
-static void* test_malloc(size_t size_); // TODO: 現状はlinear_allocatorと同じだが、将来的にFreeListになった際に挙動が変わるので、とりあえずコピーを置く
+static void* test_malloc(size_t size_);
+static void* test_aligned_alloc(size_t size_, size_t align_);
+static void* test_realloc(void* ptr_, size_t size_);
+static memory_system_result_t allocate_impl(size_t size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_, const char* func_name_);
+static memory_system_result_t reallocate_impl(void* ptr_, size_t old_size_, size_t new_size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_, const char* func_name_);
+static void free_impl(void* ptr_, size_t size_, memory_tag_t mem_tag_, const char* func_name_);
+static size_t slab_class_index(size_t size_);
+static size_t histogram_bin_index(size_t size_);
+static thread_cache_t* thread_cache_get(void);
+static void* thread_cache_allocate(size_t slab_index_);
+static void thread_cache_free(size_t slab_index_, void* ptr_);
+static void thread_cache_release(void* cache_);
+static void counter_add(atomic_size_t* counter_, size_t value_);
+static void counter_sub(atomic_size_t* counter_, size_t value_);
+static size_t counter_load(atomic_size_t* counter_);
+static void counter_store(atomic_size_t* counter_, size_t value_);
+static void counter_max(atomic_size_t* counter_, size_t value_);
+static bool guard_check(memory_guard_op_t op_, size_t size_, memory_tag_t mem_tag_, const void* caller_, const char* func_name_);
+static void stats_allocate_record(size_t size_, memory_tag_t mem_tag_);
+static void stats_free_record(size_t size_, memory_tag_t mem_tag_);
+static bool stats_append(char* buffer_, size_t buffer_size_, size_t* io_length_, const char* format_, ...);
 
 memory_system_result_t memory_system_create(void) {
 #ifdef TEST_BUILD
@@ -85,6 +226,13 @@ memory_system_result_t memory_system_create(void) {
 #endif
     memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
     memory_system_t* tmp = NULL;
+    freelist_alloc_t* tmp_freelist = NULL;
+    void* tmp_pool = NULL;
+    size_t freelist_mem_req = 0;
+    size_t freelist_align_req = 0;
+    size_t slab_mem_req = 0;
+    size_t slab_align_req = 0;
+    bool lock_initialized = false;
 
     // Preconditions.
     if(NULL != s_mem_sys_ptr) {
@@ -98,9 +246,9 @@ memory_system_result_t memory_system_create(void) {
     IF_ALLOC_FAIL_GOTO_CLEANUP(tmp, ret, MEMORY_SYSTEM_NO_MEMORY, "memory_system_create", "tmp")
     memset(tmp, 0, sizeof(memory_system_t));
 
-    tmp->total_allocated = 0;
+    counter_store(&tmp->total_allocated, 0);
     for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-        tmp->mem_tag_allocated[i] = 0;
+        counter_store(&tmp->mem_tag_allocated[i], 0);
     }
     tmp->mem_tag_str[MEMORY_TAG_SYSTEM] = "system";
     tmp->mem_tag_str[MEMORY_TAG_STRING] = "string";
@@ -109,20 +257,82 @@ memory_system_result_t memory_system_create(void) {
     tmp->mem_tag_str[MEMORY_TAG_FILE_IO] = "file_io";
     tmp->mem_tag_str[MEMORY_TAG_CAMERA] = "camera";
     tmp->mem_tag_str[MEMORY_TAG_TEXTURE] = "texture";
+    tmp->mem_tag_str[MEMORY_TAG_CONTAINER] = "container";
+
+    // フリーリストアロケータとメモリプールを予約
+    freelist_allocator_preinit(&freelist_mem_req, &freelist_align_req);
+    tmp_freelist = (freelist_alloc_t*)test_malloc(freelist_mem_req);
+    IF_ALLOC_FAIL_GOTO_CLEANUP(tmp_freelist, ret, MEMORY_SYSTEM_NO_MEMORY, "memory_system_create", "tmp_freelist")
+    tmp_pool = test_malloc(MEMORY_SYSTEM_FREELIST_POOL_SIZE);
+    IF_ALLOC_FAIL_GOTO_CLEANUP(tmp_pool, ret, MEMORY_SYSTEM_NO_MEMORY, "memory_system_create", "tmp_pool")
+    if(FREELIST_ALLOC_SUCCESS != freelist_allocator_init(tmp_freelist, MEMORY_SYSTEM_FREELIST_POOL_SIZE, tmp_pool)) {
+        ret = MEMORY_SYSTEM_RUNTIME_ERROR;
+        ERROR_MESSAGE("memory_system_create(%s) - Failed to initialize freelist allocator.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    tmp->freelist = tmp_freelist;
+    tmp->freelist_pool = tmp_pool;
+
+    // スラブアロケータ構造体インスタンスとメモリプールはフリーリストから切り出す(破棄はフリーリストのメモリプールごと行う)
+    slab_allocator_preinit(&slab_mem_req, &slab_align_req);
+    for(size_t i = 0; i != MEMORY_SYSTEM_SLAB_CLASS_COUNT; ++i) {
+        void* slab = NULL;
+        void* slab_pool = NULL;
+        if(FREELIST_ALLOC_SUCCESS != freelist_allocator_allocate(tmp_freelist, slab_mem_req, slab_align_req, &slab)) {
+            ret = MEMORY_SYSTEM_NO_MEMORY;
+            ERROR_MESSAGE("memory_system_create(%s) - Failed to allocate slab allocator.", rslt_to_str(ret));
+            goto cleanup;
+        }
+        if(FREELIST_ALLOC_SUCCESS != freelist_allocator_allocate(tmp_freelist, MEMORY_SYSTEM_SLAB_POOL_SIZE, alignof(max_align_t), &slab_pool)) {
+            ret = MEMORY_SYSTEM_NO_MEMORY;
+            ERROR_MESSAGE("memory_system_create(%s) - Failed to allocate slab memory pool.", rslt_to_str(ret));
+            goto cleanup;
+        }
+        if(SLAB_ALLOC_SUCCESS != slab_allocator_init((slab_alloc_t*)slab, MEMORY_SYSTEM_SLAB_MIN_SIZE << i, MEMORY_SYSTEM_SLAB_POOL_SIZE, slab_pool)) {
+            ret = MEMORY_SYSTEM_RUNTIME_ERROR;
+            ERROR_MESSAGE("memory_system_create(%s) - Failed to initialize slab allocator.", rslt_to_str(ret));
+            goto cleanup;
+        }
+        tmp->slab[i] = (slab_alloc_t*)slab;
+    }
+
+    if(0 != pthread_mutex_init(&tmp->lock, NULL)) {
+        ret = MEMORY_SYSTEM_RUNTIME_ERROR;
+        ERROR_MESSAGE("memory_system_create(%s) - Failed to initialize mutex.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    lock_initialized = true;
+    if(0 != pthread_key_create(&tmp->thread_cache_key, thread_cache_release)) {
+        ret = MEMORY_SYSTEM_RUNTIME_ERROR;
+        ERROR_MESSAGE("memory_system_create(%s) - Failed to create thread cache key.", rslt_to_str(ret));
+        goto cleanup;
+    }
 
     // commit
+    s_generation++;
+    tmp->generation = s_generation;
     s_mem_sys_ptr = tmp;
 
     ret = MEMORY_SYSTEM_SUCCESS;
 
 cleanup:
-    // NOTE: test_malloc以降でエラーの発生は現状ではないためリソース解放コードはなし
-    // ただし、将来的に構造体への変数追加等で仕様変更が発生し、リソース解放が必要になった際に即気付けるよう、assertを仕込んでおく
-#ifdef TEST_BUILD
     if(MEMORY_SYSTEM_SUCCESS != ret) {
-        assert(NULL == tmp);
+        if(lock_initialized) {
+            pthread_mutex_destroy(&tmp->lock);
+        }
+        if(NULL != tmp_pool) {
+            free(tmp_pool);
+            tmp_pool = NULL;
+        }
+        if(NULL != tmp_freelist) {
+            free(tmp_freelist);
+            tmp_freelist = NULL;
+        }
+        if(NULL != tmp) {
+            free(tmp);
+            tmp = NULL;
+        }
     }
-#endif
     return ret;
 }
 
@@ -130,13 +340,19 @@ void memory_system_destroy(void) {
     if(NULL == s_mem_sys_ptr) {
         goto cleanup;
     }
-    if(0 != s_mem_sys_ptr->total_allocated) {
+    if(0 != counter_load(&s_mem_sys_ptr->total_allocated)) {
         WARN_MESSAGE("memory_system_destroy - total_allocated != 0. Check memory leaks.");
     }
-    s_mem_sys_ptr->total_allocated = 0;
+    counter_store(&s_mem_sys_ptr->total_allocated, 0);
     for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-        s_mem_sys_ptr->mem_tag_allocated[i] = 0;
+        counter_store(&s_mem_sys_ptr->mem_tag_allocated[i], 0);
     }
+    // スレッドキャッシュ中のブロックはメモリプールごと解放されるため、返却せずに破棄する(他スレッドのキャッシュは世代の不一致で破棄される)
+    s_thread_cache.generation = 0;
+    pthread_key_delete(s_mem_sys_ptr->thread_cache_key);
+    pthread_mutex_destroy(&s_mem_sys_ptr->lock);
+    free(s_mem_sys_ptr->freelist_pool);
+    free(s_mem_sys_ptr->freelist);
     free(s_mem_sys_ptr);
     s_mem_sys_ptr = NULL;
 
@@ -146,79 +362,119 @@ cleanup:
 
 memory_system_result_t memory_system_allocate(size_t size_, memory_tag_t mem_tag_, void** out_ptr_) {
 #ifdef TEST_BUILD
-    s_test_config_memory_system_allocate.call_count++;
-    if(s_test_config_memory_system_allocate.fail_on_call != 0) {
-        if(s_test_config_memory_system_allocate.call_count == s_test_config_memory_system_allocate.fail_on_call) {
-            return (memory_system_result_t)s_test_config_memory_system_allocate.forced_result;
+    if(!s_test_config_suspended) {
+        s_test_config_memory_system_allocate.call_count++;
+        if(s_test_config_memory_system_allocate.fail_on_call != 0) {
+            if(s_test_config_memory_system_allocate.call_count == s_test_config_memory_system_allocate.fail_on_call) {
+                return (memory_system_result_t)s_test_config_memory_system_allocate.forced_result;
+            }
         }
     }
 #endif
     memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
-    void* tmp = NULL;
-
-    // Preconditions.
-    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_allocate", "s_mem_sys_ptr")
-    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_allocate", "out_ptr_")
-    IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_ptr_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_allocate", "*out_ptr_")
-    IF_ARG_FALSE_GOTO_CLEANUP(mem_tag_ < MEMORY_TAG_MAX, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_allocate", "mem_tag_")
 
-    if(0 == size_) {
-        WARN_MESSAGE("memory_system_allocate - No-op: size_ is 0.");
-        ret = MEMORY_SYSTEM_SUCCESS;
+    if(guard_check(MEMORY_GUARD_OP_ALLOCATE, size_, mem_tag_, MEMORY_SYSTEM_CALLER_ADDRESS(), "memory_system_allocate")) {
+        ret = MEMORY_SYSTEM_BAD_OPERATION;
         goto cleanup;
     }
-    if(s_mem_sys_ptr->mem_tag_allocated[mem_tag_] > (SIZE_MAX - size_)) {
-        ret = MEMORY_SYSTEM_LIMIT_EXCEEDED;
-        ERROR_MESSAGE("memory_system_allocate(%s) - size_t overflow: tag=%s used=%zu, requested=%zu, sum would exceed SIZE_MAX.", rslt_to_str(ret), s_mem_sys_ptr->mem_tag_str[mem_tag_], s_mem_sys_ptr->mem_tag_allocated[mem_tag_], size_);
-        goto cleanup;
+    ret = allocate_impl(size_, alignof(max_align_t), mem_tag_, out_ptr_, "memory_system_allocate");
+
+cleanup:
+    return ret;
+}
+
+memory_system_result_t memory_system_allocate_aligned(size_t size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    if(!s_test_config_suspended) {
+        s_test_config_memory_system_allocate_aligned.call_count++;
+        if(s_test_config_memory_system_allocate_aligned.fail_on_call != 0) {
+            if(s_test_config_memory_system_allocate_aligned.call_count == s_test_config_memory_system_allocate_aligned.fail_on_call) {
+                return (memory_system_result_t)s_test_config_memory_system_allocate_aligned.forced_result;
+            }
+        }
     }
-    if(s_mem_sys_ptr->total_allocated > (SIZE_MAX - size_)) {
-        ret = MEMORY_SYSTEM_LIMIT_EXCEEDED;
-        ERROR_MESSAGE("memory_system_allocate(%s) - size_t overflow: total_allocated=%zu, requested=%zu, sum would exceed SIZE_MAX.", rslt_to_str(ret), s_mem_sys_ptr->total_allocated, size_);
+#endif
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(align_), ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_allocate_aligned", "align_")
+    if(guard_check(MEMORY_GUARD_OP_ALLOCATE, size_, mem_tag_, MEMORY_SYSTEM_CALLER_ADDRESS(), "memory_system_allocate_aligned")) {
+        ret = MEMORY_SYSTEM_BAD_OPERATION;
         goto cleanup;
     }
 
-    // Simulation.
-    tmp = test_malloc(size_);    // TODO: FreeList
-    IF_ALLOC_FAIL_GOTO_CLEANUP(tmp, ret, MEMORY_SYSTEM_NO_MEMORY, "memory_system_allocate", "tmp")
-    memset(tmp, 0, size_);
-
-    // commit.
-    *out_ptr_ = tmp;
-    s_mem_sys_ptr->total_allocated += size_;
-    s_mem_sys_ptr->mem_tag_allocated[mem_tag_] += size_;
-
-    ret = MEMORY_SYSTEM_SUCCESS;
+    // max_align_t以下のアライメント要件は、通常の割り当てで満たされる
+    ret = allocate_impl(size_, (align_ < alignof(max_align_t)) ? alignof(max_align_t) : align_, mem_tag_, out_ptr_, "memory_system_allocate_aligned");
 
 cleanup:
     return ret;
 }
 
-void memory_system_free(void* ptr_, size_t size_, memory_tag_t mem_tag_) {
-    if(NULL == s_mem_sys_ptr) {
-        WARN_MESSAGE("memory_system_free - No-op: memory system is uninitialized.");
-        goto cleanup;
+memory_system_result_t memory_system_reallocate(void* ptr_, size_t old_size_, size_t new_size_, memory_tag_t mem_tag_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    if(!s_test_config_suspended) {
+        s_test_config_memory_system_reallocate.call_count++;
+        if(s_test_config_memory_system_reallocate.fail_on_call != 0) {
+            if(s_test_config_memory_system_reallocate.call_count == s_test_config_memory_system_reallocate.fail_on_call) {
+                return (memory_system_result_t)s_test_config_memory_system_reallocate.forced_result;
+            }
+        }
     }
-    if(NULL == ptr_) {
-        WARN_MESSAGE("memory_system_free - No-op: 'ptr_' must not be NULL.");
+#endif
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+    if(guard_check(MEMORY_GUARD_OP_REALLOCATE, new_size_, mem_tag_, MEMORY_SYSTEM_CALLER_ADDRESS(), "memory_system_reallocate")) {
+        ret = MEMORY_SYSTEM_BAD_OPERATION;
         goto cleanup;
     }
-    if(mem_tag_ >= MEMORY_TAG_MAX) {
-        WARN_MESSAGE("memory_system_free - No-op: 'mem_tag_' is invalid.");
+    ret = reallocate_impl(ptr_, old_size_, new_size_, alignof(max_align_t), mem_tag_, out_ptr_, "memory_system_reallocate");
+
+cleanup:
+    return ret;
+}
+
+memory_system_result_t memory_system_reallocate_aligned(void* ptr_, size_t old_size_, size_t new_size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    if(!s_test_config_suspended) {
+        s_test_config_memory_system_reallocate_aligned.call_count++;
+        if(s_test_config_memory_system_reallocate_aligned.fail_on_call != 0) {
+            if(s_test_config_memory_system_reallocate_aligned.call_count == s_test_config_memory_system_reallocate_aligned.fail_on_call) {
+                return (memory_system_result_t)s_test_config_memory_system_reallocate_aligned.forced_result;
+            }
+        }
+    }
+#endif
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(align_), ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_reallocate_aligned", "align_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 == ((uintptr_t)ptr_ & (uintptr_t)(align_ - 1)), ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_reallocate_aligned", "ptr_")
+    if(guard_check(MEMORY_GUARD_OP_REALLOCATE, new_size_, mem_tag_, MEMORY_SYSTEM_CALLER_ADDRESS(), "memory_system_reallocate_aligned")) {
+        ret = MEMORY_SYSTEM_BAD_OPERATION;
         goto cleanup;
     }
-    if(s_mem_sys_ptr->mem_tag_allocated[mem_tag_] < size_) {
-        WARN_MESSAGE("memory_system_free - No-op: 'mem_tag_allocated' would underflow.");
+
+    ret = reallocate_impl(ptr_, old_size_, new_size_, (align_ < alignof(max_align_t)) ? alignof(max_align_t) : align_, mem_tag_, out_ptr_, "memory_system_reallocate_aligned");
+
+cleanup:
+    return ret;
+}
+
+void memory_system_free(void* ptr_, size_t size_, memory_tag_t mem_tag_) {
+    guard_check(MEMORY_GUARD_OP_FREE, size_, mem_tag_, MEMORY_SYSTEM_CALLER_ADDRESS(), "memory_system_free");  // 解放はMEMORY_GUARD_MODE_DENYでも実行する(リーク防止)
+    free_impl(ptr_, size_, mem_tag_, "memory_system_free");
+}
+
+void memory_system_free_aligned(void* ptr_, size_t size_, size_t align_, memory_tag_t mem_tag_) {
+    if(!IS_POWER_OF_TWO(align_)) {
+        WARN_MESSAGE("memory_system_free_aligned - No-op: 'align_' must be a power of two.");
         goto cleanup;
     }
-    if(s_mem_sys_ptr->total_allocated < size_) {
-        WARN_MESSAGE("memory_system_free: No-op: 'total_allocated' would underflow.");
+    if(0 != ((uintptr_t)ptr_ & (uintptr_t)(align_ - 1))) {
+        WARN_MESSAGE("memory_system_free_aligned - No-op: 'ptr_' is not aligned to 'align_'.");
         goto cleanup;
     }
+    guard_check(MEMORY_GUARD_OP_FREE, size_, mem_tag_, MEMORY_SYSTEM_CALLER_ADDRESS(), "memory_system_free_aligned");
+    free_impl(ptr_, size_, mem_tag_, "memory_system_free_aligned");
 
-    free(ptr_);
-    s_mem_sys_ptr->total_allocated -= size_;
-    s_mem_sys_ptr->mem_tag_allocated[mem_tag_] -= size_;
 cleanup:
     return;
 }
@@ -230,11 +486,15 @@ void memory_system_report(void) {
     }
     INFO_MESSAGE("memory_system_report");
     // TODO: [INFORMATION]を出力しないINFO_MESSAGE_RAW(...)をbase/messageに追加し、fprintfを廃止する
-    fprintf(stdout, "\033[1;35m\tTotal allocated: %zu\n", s_mem_sys_ptr->total_allocated);
+    fprintf(stdout, "\033[1;35m\tTotal allocated: %zu (peak: %zu)\n", counter_load(&s_mem_sys_ptr->total_allocated), counter_load(&s_mem_sys_ptr->total_peak));
     fprintf(stdout, "\tMemory tag allocated:\n");
     for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
         const char* const tag_str = s_mem_sys_ptr->mem_tag_str[i];
-        fprintf(stdout, "\t\ttag(%s): %zu\n", (NULL != tag_str) ? tag_str : "unknown", s_mem_sys_ptr->mem_tag_allocated[i]);
+        fprintf(stdout, "\t\ttag(%s): %zu (peak: %zu, alloc: %zu, free: %zu)\n", (NULL != tag_str) ? tag_str : "unknown",
+            counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]), counter_load(&s_mem_sys_ptr->mem_tag_peak[i]), counter_load(&s_mem_sys_ptr->mem_tag_alloc_count[i]), counter_load(&s_mem_sys_ptr->mem_tag_free_count[i]));
+    }
+    if(atomic_load_explicit(&s_mem_sys_ptr->guard_armed, memory_order_acquire) || 0 != counter_load(&s_mem_sys_ptr->guard_violation_count)) {
+        fprintf(stdout, "\tSteady-state guard(%s): %zu violation(s)\n", atomic_load_explicit(&s_mem_sys_ptr->guard_armed, memory_order_acquire) ? "armed" : "disarmed", counter_load(&s_mem_sys_ptr->guard_violation_count));
     }
     fprintf(stdout, "\033[0m\n");
 
@@ -242,124 +502,925 @@ cleanup:
     return;
 }
 
-/**
- * @brief 実行結果コードを文字列に変換する
- *
- * @param[in] rslt_ 文字列に変換する実行結果コード
- * @return const char* 変換された文字列の先頭アドレス
- */
-static const char* rslt_to_str(memory_system_result_t rslt_) {
-    switch(rslt_) {
-    case MEMORY_SYSTEM_SUCCESS:
-        return s_rslt_str_success;
-    case MEMORY_SYSTEM_INVALID_ARGUMENT:
-        return s_rslt_str_invalid_argument;
-    case MEMORY_SYSTEM_RUNTIME_ERROR:
-        return s_rslt_str_runtime_error;
-    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
-        return s_rslt_str_limit_exceeded;
-    case MEMORY_SYSTEM_BAD_OPERATION:
-        return s_rslt_str_bad_operation;
-    case MEMORY_SYSTEM_NO_MEMORY:
-        return s_rslt_str_no_memory;
-    default:
-        return s_rslt_str_undefined_error;
-    }
-}
+memory_system_result_t memory_system_tag_stats_get(memory_tag_t mem_tag_, memory_tag_stats_t* out_stats_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
 
-/**
- * @brief mallocのラッパ関数で、size_のメモリを確保する
- *
- * @note choco_memory保有APIの単体テストのため、test_config_test_mallocの設定により、強制的にNULLを返させる、以下の条件でNULLになる
- * - s_test_config_test_malloc.fail_on_call > 0 && s_test_config_test_malloc.call_count == s_test_config_test_malloc.fail_on_call
- *
- * @param[in] size_ 確保するメモリ容量
- *
- * @return void* 確保されたメモリの先頭アドレス
- */
-static void* test_malloc(size_t size_) {
-    void* ret = NULL;
-#ifdef TEST_BUILD
-    s_test_config_test_malloc.call_count++;
-    if(0 == s_test_config_test_malloc.fail_on_call) {
-        ret = malloc(size_);
-    } else {
-        if(s_test_config_test_malloc.call_count == s_test_config_test_malloc.fail_on_call) {
-            ret = NULL;
-        } else {
-            ret = malloc(size_);
-        }
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_tag_stats_get", "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_stats_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_tag_stats_get", "out_stats_")
+    IF_ARG_FALSE_GOTO_CLEANUP(mem_tag_ < MEMORY_TAG_MAX, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_tag_stats_get", "mem_tag_")
+
+    // commit.
+    out_stats_->allocated = counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]);
+    out_stats_->peak = counter_load(&s_mem_sys_ptr->mem_tag_peak[mem_tag_]);
+    out_stats_->alloc_count = counter_load(&s_mem_sys_ptr->mem_tag_alloc_count[mem_tag_]);
+    out_stats_->free_count = counter_load(&s_mem_sys_ptr->mem_tag_free_count[mem_tag_]);
+    for(size_t i = 0; i != MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT; ++i) {
+        out_stats_->size_histogram[i] = counter_load(&s_mem_sys_ptr->mem_tag_histogram[mem_tag_][i]);
     }
-#else
-    ret = malloc(size_);
-#endif
+
+    ret = MEMORY_SYSTEM_SUCCESS;
+
+cleanup:
     return ret;
 }
 
-#ifdef TEST_BUILD
-void test_memory_system_create_config_set(const test_call_control_t* config_) {
-    s_test_config_memory_system_create.fail_on_call = config_->fail_on_call;
-    s_test_config_memory_system_create.forced_result = config_->forced_result;
+const char* memory_system_tag_str_get(memory_tag_t mem_tag_) {
+    if(NULL == s_mem_sys_ptr || mem_tag_ >= MEMORY_TAG_MAX || NULL == s_mem_sys_ptr->mem_tag_str[mem_tag_]) {
+        return "unknown";
+    }
+    return s_mem_sys_ptr->mem_tag_str[mem_tag_];
 }
 
-void test_memory_system_allocate_config_set(const test_call_control_t* config_) {
-    s_test_config_memory_system_allocate.fail_on_call = config_->fail_on_call;
-    s_test_config_memory_system_allocate.forced_result = config_->forced_result;
-}
+memory_system_result_t memory_system_frame_stats_sample(memory_frame_stats_t* out_stats_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
 
-void test_choco_memory_config_reset(void) {
-    test_call_control_reset(&s_test_config_memory_system_create);
-    test_call_control_reset(&s_test_config_memory_system_allocate);
-    test_call_control_reset(&s_test_config_test_malloc);
-}
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_frame_stats_sample", "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_stats_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_frame_stats_sample", "out_stats_")
 
-void test_choco_memory(void) {
-    test_choco_memory_config_reset();
+    // commit.
+    for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
+        out_stats_->alloc_count[i] = atomic_exchange_explicit(&s_mem_sys_ptr->frame_alloc_count[i], 0, memory_order_relaxed);
+        out_stats_->free_count[i] = atomic_exchange_explicit(&s_mem_sys_ptr->frame_free_count[i], 0, memory_order_relaxed);
+        out_stats_->allocated_bytes[i] = atomic_exchange_explicit(&s_mem_sys_ptr->frame_allocated_bytes[i], 0, memory_order_relaxed);
+        out_stats_->freed_bytes[i] = atomic_exchange_explicit(&s_mem_sys_ptr->frame_freed_bytes[i], 0, memory_order_relaxed);
+    }
 
-    test_rslt_to_str();
-    test_test_malloc();
-    test_memory_system_create();
-    test_memory_system_destroy();
-    test_memory_system_allocate();
-    test_memory_system_free();
-    test_memory_system_report();
+    ret = MEMORY_SYSTEM_SUCCESS;
 
-    test_choco_memory_config_reset();
+cleanup:
+    return ret;
 }
 
-// Generated by ChatGPT 5.4 Thinking
-static void NO_COVERAGE test_memory_system_create(void) {
-    {
-        // memory_system_create() 冒頭で強制的に MEMORY_SYSTEM_NO_MEMORY を返させる
-        memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
-        test_call_control_t config = {0};
+memory_system_result_t memory_system_stats_export(memory_stats_format_t format_, char* buffer_, size_t buffer_size_, size_t* out_length_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    size_t length = 0;
+    bool ok = true;
 
-        test_choco_memory_config_reset();
-        assert(NULL == s_mem_sys_ptr);
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_stats_export", "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_length_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_stats_export", "out_length_")
+    IF_ARG_FALSE_GOTO_CLEANUP(NULL != buffer_ || 0 == buffer_size_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_stats_export", "buffer_")
+    IF_ARG_FALSE_GOTO_CLEANUP(MEMORY_STATS_FORMAT_JSON == format_ || MEMORY_STATS_FORMAT_CSV == format_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_stats_export", "format_")
 
-        config.fail_on_call = 1U;
-        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
-        test_memory_system_create_config_set(&config);
+    if(0 != buffer_size_) {
+        buffer_[0] = '\0';
+    }
 
-        ret = memory_system_create();
-        assert(MEMORY_SYSTEM_NO_MEMORY == ret);
-        assert(NULL == s_mem_sys_ptr);
+    // Simulation.
+    if(MEMORY_STATS_FORMAT_JSON == format_) {
+        ok = stats_append(buffer_, buffer_size_, &length, "{\"total_allocated\":%zu,\"total_peak\":%zu,\"tags\":[", counter_load(&s_mem_sys_ptr->total_allocated), counter_load(&s_mem_sys_ptr->total_peak));
+        for(size_t i = 0; ok && i != MEMORY_TAG_MAX; ++i) {
+            const char* const tag_str = s_mem_sys_ptr->mem_tag_str[i];
+            ok = stats_append(buffer_, buffer_size_, &length, "%s{\"tag\":\"%s\",\"allocated\":%zu,\"peak\":%zu,\"alloc_count\":%zu,\"free_count\":%zu,\"size_histogram\":[",
+                (0 == i) ? "" : ",", (NULL != tag_str) ? tag_str : "unknown",
+                counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]), counter_load(&s_mem_sys_ptr->mem_tag_peak[i]), counter_load(&s_mem_sys_ptr->mem_tag_alloc_count[i]), counter_load(&s_mem_sys_ptr->mem_tag_free_count[i]));
+            for(size_t j = 0; ok && j != MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT; ++j) {
+                ok = stats_append(buffer_, buffer_size_, &length, "%s%zu", (0 == j) ? "" : ",", counter_load(&s_mem_sys_ptr->mem_tag_histogram[i][j]));
+            }
+            ok = ok && stats_append(buffer_, buffer_size_, &length, "]}");
+        }
+        ok = ok && stats_append(buffer_, buffer_size_, &length, "]}");
+    } else {
+        ok = stats_append(buffer_, buffer_size_, &length, "tag,allocated,peak,alloc_count,free_count,hist_le_16,hist_le_64,hist_le_256,hist_le_1k,hist_le_4k,hist_le_16k,hist_le_64k,hist_gt_64k\n");
+        for(size_t i = 0; ok && i != MEMORY_TAG_MAX; ++i) {
+            const char* const tag_str = s_mem_sys_ptr->mem_tag_str[i];
+            ok = stats_append(buffer_, buffer_size_, &length, "%s,%zu,%zu,%zu,%zu", (NULL != tag_str) ? tag_str : "unknown",
+                counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]), counter_load(&s_mem_sys_ptr->mem_tag_peak[i]), counter_load(&s_mem_sys_ptr->mem_tag_alloc_count[i]), counter_load(&s_mem_sys_ptr->mem_tag_free_count[i]));
+            for(size_t j = 0; ok && j != MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT; ++j) {
+                ok = stats_append(buffer_, buffer_size_, &length, ",%zu", counter_load(&s_mem_sys_ptr->mem_tag_histogram[i][j]));
+            }
+            ok = ok && stats_append(buffer_, buffer_size_, &length, "\n");
+        }
+    }
+    if(!ok) {
+        ret = MEMORY_SYSTEM_RUNTIME_ERROR;
+        ERROR_MESSAGE("memory_system_stats_export(%s) - Failed to format memory statistics.", rslt_to_str(ret));
+        goto cleanup;
+    }
 
-        test_choco_memory_config_reset();
+    // commit.
+    *out_length_ = length;
+    if(0 != buffer_size_ && length >= buffer_size_) {
+        ret = MEMORY_SYSTEM_LIMIT_EXCEEDED;
+        goto cleanup;
     }
-    {
-        // NULL != s_mem_sys_ptr -> MEMORY_SYSTEM_RUNTIME_ERROR
-        memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
 
-        test_choco_memory_config_reset();
-        assert(NULL == s_mem_sys_ptr);
+    ret = MEMORY_SYSTEM_SUCCESS;
 
-        s_mem_sys_ptr = (memory_system_t*)malloc(sizeof(memory_system_t));
-        assert(NULL != s_mem_sys_ptr);
+cleanup:
+    return ret;
+}
 
-        ret = memory_system_create();
-        assert(MEMORY_SYSTEM_RUNTIME_ERROR == ret);
-        assert(NULL != s_mem_sys_ptr);
+memory_system_result_t memory_system_guard_arm(memory_guard_mode_t mode_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    bool armed = false;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_guard_arm", "s_mem_sys_ptr")
+    IF_ARG_FALSE_GOTO_CLEANUP(MEMORY_GUARD_MODE_COUNT == mode_ || MEMORY_GUARD_MODE_WARN == mode_ || MEMORY_GUARD_MODE_DENY == mode_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_guard_arm", "mode_")
+
+    // commit.
+    pthread_mutex_lock(&s_mem_sys_ptr->lock);
+    armed = atomic_load_explicit(&s_mem_sys_ptr->guard_armed, memory_order_relaxed);
+    if(!armed) {
+        atomic_store_explicit(&s_mem_sys_ptr->guard_mode, (int)mode_, memory_order_relaxed);
+        counter_store(&s_mem_sys_ptr->guard_violation_count, 0);
+        memset(s_mem_sys_ptr->guard_violations, 0, sizeof(s_mem_sys_ptr->guard_violations));
+        atomic_store_explicit(&s_mem_sys_ptr->guard_armed, true, memory_order_release);
+    }
+    pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    if(armed) {
+        ret = MEMORY_SYSTEM_BAD_OPERATION;
+        ERROR_MESSAGE("memory_system_guard_arm(%s) - Guard is already armed. Call memory_system_guard_disarm first.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = MEMORY_SYSTEM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void memory_system_guard_disarm(void) {
+    if(NULL == s_mem_sys_ptr) {
+        goto cleanup;
+    }
+    atomic_store_explicit(&s_mem_sys_ptr->guard_armed, false, memory_order_release);
+
+cleanup:
+    return;
+}
+
+memory_system_result_t memory_system_guard_violation_count_get(size_t* out_count_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_guard_violation_count_get", "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_count_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_guard_violation_count_get", "out_count_")
+
+    // commit.
+    *out_count_ = counter_load(&s_mem_sys_ptr->guard_violation_count);
+
+    ret = MEMORY_SYSTEM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+memory_system_result_t memory_system_guard_violation_get(size_t index_, memory_guard_violation_t* out_violation_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    bool recorded = false;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), "memory_system_guard_violation_get", "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_violation_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_guard_violation_get", "out_violation_")
+
+    // commit.
+    // 違反回数と違反記録はlock内で一貫して参照する(書き込み途中の記録を返さない)
+    pthread_mutex_lock(&s_mem_sys_ptr->lock);
+    recorded = index_ < counter_load(&s_mem_sys_ptr->guard_violation_count) && index_ < MEMORY_SYSTEM_GUARD_RECORD_MAX;
+    if(recorded) {
+        *out_violation_ = s_mem_sys_ptr->guard_violations[index_];
+    }
+    pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    IF_ARG_FALSE_GOTO_CLEANUP(recorded, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), "memory_system_guard_violation_get", "index_")
+
+    ret = MEMORY_SYSTEM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリ割り当てとメモリタグごとのトラッキングを行う(memory_system_allocate / memory_system_allocate_aligned共通処理)
+ *
+ * @param[in] size_ 割り当てサイズ
+ * @param[in] align_ アライメント要件(alignof(max_align_t)以上の2の冪乗であること)
+ * @param[in] mem_tag_ メモリタグ
+ * @param[out] out_ptr_ 割り当てたメモリ格納先
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元API名
+ *
+ * @return memory_system_result_t memory_system_allocateに準じる
+ */
+static memory_system_result_t allocate_impl(size_t size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_, const char* func_name_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    void* tmp = NULL;
+    size_t slab_index = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), func_name_, "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "out_ptr_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_ptr_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "*out_ptr_")
+    IF_ARG_FALSE_GOTO_CLEANUP(mem_tag_ < MEMORY_TAG_MAX, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "mem_tag_")
+
+    if(0 == size_) {
+        WARN_MESSAGE("%s - No-op: size_ is 0.", func_name_);
+        ret = MEMORY_SYSTEM_SUCCESS;
+        goto cleanup;
+    }
+    if(counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]) > (SIZE_MAX - size_)) {
+        ret = MEMORY_SYSTEM_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("%s(%s) - size_t overflow: tag=%s used=%zu, requested=%zu, sum would exceed SIZE_MAX.", func_name_, rslt_to_str(ret), s_mem_sys_ptr->mem_tag_str[mem_tag_], counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]), size_);
+        goto cleanup;
+    }
+    if(counter_load(&s_mem_sys_ptr->total_allocated) > (SIZE_MAX - size_)) {
+        ret = MEMORY_SYSTEM_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("%s(%s) - size_t overflow: total_allocated=%zu, requested=%zu, sum would exceed SIZE_MAX.", func_name_, rslt_to_str(ret), counter_load(&s_mem_sys_ptr->total_allocated), size_);
+        goto cleanup;
+    }
+
+    // Simulation.
+    // 小さな割り当てはサイズクラスのスラブから(スレッドキャッシュ経由)、スラブが枯渇またはサイズ超過の場合はフリーリストから、
+    // フリーリストで確保できない(プール容量不足)場合のみmallocにフォールバックする
+    // スラブのブロックはmax_align_tアラインのため、それを超えるアライメント要件はフリーリストから割り当てる
+    slab_index = (align_ <= alignof(max_align_t)) ? slab_class_index(size_) : MEMORY_SYSTEM_SLAB_CLASS_COUNT;
+    if(slab_index < MEMORY_SYSTEM_SLAB_CLASS_COUNT) {
+        tmp = thread_cache_allocate(slab_index);
+    }
+    if(NULL == tmp) {
+        pthread_mutex_lock(&s_mem_sys_ptr->lock);
+        if(FREELIST_ALLOC_SUCCESS != freelist_allocator_allocate(s_mem_sys_ptr->freelist, size_, align_, &tmp)) {
+            tmp = (align_ <= alignof(max_align_t)) ? test_malloc(size_) : test_aligned_alloc(size_, align_);
+        }
+        pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    }
+    IF_ALLOC_FAIL_GOTO_CLEANUP(tmp, ret, MEMORY_SYSTEM_NO_MEMORY, func_name_, "tmp")
+    memset(tmp, 0, size_);
+
+    // commit.
+    *out_ptr_ = tmp;
+    counter_add(&s_mem_sys_ptr->total_allocated, size_);
+    counter_add(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_], size_);
+    stats_allocate_record(size_, mem_tag_);
+
+    ret = MEMORY_SYSTEM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief メモリ解放とメモリタグごとのトラッキングを行う(memory_system_free / memory_system_free_aligned共通処理)
+ *
+ * @param[in] ptr_ 解放メモリアドレス
+ * @param[in] size_ 解放サイズ
+ * @param[in] mem_tag_ メモリタグ
+ * @param[in] func_name_ ワーニングメッセージに出力する呼び出し元API名
+ */
+static void free_impl(void* ptr_, size_t size_, memory_tag_t mem_tag_, const char* func_name_) {
+    size_t slab_index = 0;
+
+    if(NULL == s_mem_sys_ptr) {
+        WARN_MESSAGE("%s - No-op: memory system is uninitialized.", func_name_);
+        goto cleanup;
+    }
+    if(NULL == ptr_) {
+        WARN_MESSAGE("%s - No-op: 'ptr_' must not be NULL.", func_name_);
+        goto cleanup;
+    }
+    if(mem_tag_ >= MEMORY_TAG_MAX) {
+        WARN_MESSAGE("%s - No-op: 'mem_tag_' is invalid.", func_name_);
+        goto cleanup;
+    }
+    if(counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]) < size_) {
+        WARN_MESSAGE("%s - No-op: 'mem_tag_allocated' would underflow.", func_name_);
+        goto cleanup;
+    }
+    if(counter_load(&s_mem_sys_ptr->total_allocated) < size_) {
+        WARN_MESSAGE("%s: No-op: 'total_allocated' would underflow.", func_name_);
+        goto cleanup;
+    }
+
+    // 割り当て元はアドレスで判定する(mallocへのフォールバック分はaligned含めfreeで解放可能)
+    // ownsはメモリプールのアドレス範囲のみを参照するため、ロック不要
+    slab_index = slab_class_index(size_);
+    if(slab_index < MEMORY_SYSTEM_SLAB_CLASS_COUNT && slab_allocator_owns(s_mem_sys_ptr->slab[slab_index], ptr_)) {
+        thread_cache_free(slab_index, ptr_);
+    } else if(freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr_)) {
+        pthread_mutex_lock(&s_mem_sys_ptr->lock);
+        freelist_allocator_free(s_mem_sys_ptr->freelist, ptr_);
+        pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    } else {
+        free(ptr_);
+    }
+    counter_sub(&s_mem_sys_ptr->total_allocated, size_);
+    counter_sub(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_], size_);
+    stats_free_record(size_, mem_tag_);
+cleanup:
+    return;
+}
+
+/**
+ * @brief メモリの再割り当てとメモリタグごとのトラッキングを行う(memory_system_reallocate / memory_system_reallocate_aligned共通処理)
+ *
+ * @note
+ * 割り当て元のアロケータでその場でサイズを変更できる場合は先頭アドレスを変えずに変更する
+ * - スラブ: 変更後のサイズが同じサイズクラスに収まる場合
+ * - フリーリスト: 縮小時、または直後の空きブロックを取り込める拡張時
+ * - malloc: reallocで変更(max_align_tを超えるアライメント要件の場合は対象外)
+ * 上記以外は新規割り当て + コピー + 旧領域の解放で行う
+ *
+ * @param[in] ptr_ 再割り当て対象メモリアドレス(NULLの場合は新規割り当て)
+ * @param[in] old_size_ 現在の割り当てサイズ
+ * @param[in] new_size_ 変更後の割り当てサイズ
+ * @param[in] align_ アライメント要件(alignof(max_align_t)以上の2の冪乗であること)
+ * @param[in] mem_tag_ メモリタグ
+ * @param[out] out_ptr_ 再割り当て後のメモリ格納先
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元API名
+ *
+ * @return memory_system_result_t memory_system_reallocateに準じる
+ */
+static memory_system_result_t reallocate_impl(void* ptr_, size_t old_size_, size_t new_size_, size_t align_, memory_tag_t mem_tag_, void** out_ptr_, const char* func_name_) {
+    memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+    void* tmp = NULL;
+    size_t slab_index = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(s_mem_sys_ptr, ret, MEMORY_SYSTEM_BAD_OPERATION, rslt_to_str(MEMORY_SYSTEM_BAD_OPERATION), func_name_, "s_mem_sys_ptr")
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "out_ptr_")
+    IF_ARG_FALSE_GOTO_CLEANUP(mem_tag_ < MEMORY_TAG_MAX, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "mem_tag_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != new_size_, ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "new_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP((NULL == ptr_) == (0 == old_size_), ret, MEMORY_SYSTEM_INVALID_ARGUMENT, rslt_to_str(MEMORY_SYSTEM_INVALID_ARGUMENT), func_name_, "old_size_")
+    if(counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]) < old_size_ || counter_load(&s_mem_sys_ptr->total_allocated) < old_size_) {
+        ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        ERROR_MESSAGE("%s(%s) - old_size_ exceeds tracked allocation: tag=%s used=%zu, old_size=%zu.", func_name_, rslt_to_str(ret), s_mem_sys_ptr->mem_tag_str[mem_tag_], counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]), old_size_);
+        goto cleanup;
+    }
+    if(new_size_ > old_size_ && (counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]) > (SIZE_MAX - (new_size_ - old_size_)) || counter_load(&s_mem_sys_ptr->total_allocated) > (SIZE_MAX - (new_size_ - old_size_)))) {
+        ret = MEMORY_SYSTEM_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("%s(%s) - size_t overflow: tag=%s used=%zu, total_allocated=%zu, requested=%zu.", func_name_, rslt_to_str(ret), s_mem_sys_ptr->mem_tag_str[mem_tag_], counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]), counter_load(&s_mem_sys_ptr->total_allocated), new_size_ - old_size_);
+        goto cleanup;
+    }
+    if(NULL == ptr_) {
+        ret = allocate_impl(new_size_, align_, mem_tag_, &tmp, func_name_);
+        if(MEMORY_SYSTEM_SUCCESS == ret) {
+            *out_ptr_ = tmp;
+        }
+        goto cleanup;
+    }
+    if(new_size_ == old_size_) {
+        *out_ptr_ = ptr_;
+        ret = MEMORY_SYSTEM_SUCCESS;
+        goto cleanup;
+    }
+
+    // Simulation.
+    slab_index = slab_class_index(old_size_);
+    if(slab_index < MEMORY_SYSTEM_SLAB_CLASS_COUNT && slab_allocator_owns(s_mem_sys_ptr->slab[slab_index], ptr_)) {
+        if(slab_class_index(new_size_) == slab_index) {
+            tmp = ptr_;
+        }
+    } else if(freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr_)) {
+        pthread_mutex_lock(&s_mem_sys_ptr->lock);
+        if(FREELIST_ALLOC_SUCCESS == freelist_allocator_resize(s_mem_sys_ptr->freelist, ptr_, new_size_)) {
+            tmp = ptr_;
+        }
+        pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    } else if(align_ <= alignof(max_align_t)) {
+        tmp = test_realloc(ptr_, new_size_);
+        IF_ALLOC_FAIL_GOTO_CLEANUP(tmp, ret, MEMORY_SYSTEM_NO_MEMORY, func_name_, "tmp")
+    }
+    if(NULL == tmp) {
+        // その場で変更できないため、新規割り当て領域へコピーする(メモリタグの使用量はallocate_impl / free_implで更新)
+        ret = allocate_impl(new_size_, align_, mem_tag_, &tmp, func_name_);
+        if(MEMORY_SYSTEM_SUCCESS != ret) {
+            goto cleanup;
+        }
+        memcpy(tmp, ptr_, (old_size_ < new_size_) ? old_size_ : new_size_);
+        free_impl(ptr_, old_size_, mem_tag_, func_name_);
+        *out_ptr_ = tmp;
+        goto cleanup;
+    }
+
+    // commit.
+    if(new_size_ > old_size_) {
+        memset((char*)tmp + old_size_, 0, new_size_ - old_size_);
+        counter_add(&s_mem_sys_ptr->total_allocated, new_size_ - old_size_);
+        counter_add(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_], new_size_ - old_size_);
+    } else {
+        counter_sub(&s_mem_sys_ptr->total_allocated, old_size_ - new_size_);
+        counter_sub(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_], old_size_ - new_size_);
+    }
+    // 統計上はコピーを伴う再割り当てと同様に、旧サイズの解放 + 新サイズの割り当てとして計上する
+    stats_free_record(old_size_, mem_tag_);
+    stats_allocate_record(new_size_, mem_tag_);
+    *out_ptr_ = tmp;
+
+    ret = MEMORY_SYSTEM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief 実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 文字列に変換する実行結果コード
+ * @return const char* 変換された文字列の先頭アドレス
+ */
+static const char* rslt_to_str(memory_system_result_t rslt_) {
+    switch(rslt_) {
+    case MEMORY_SYSTEM_SUCCESS:
+        return s_rslt_str_success;
+    case MEMORY_SYSTEM_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case MEMORY_SYSTEM_RUNTIME_ERROR:
+        return s_rslt_str_runtime_error;
+    case MEMORY_SYSTEM_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    case MEMORY_SYSTEM_BAD_OPERATION:
+        return s_rslt_str_bad_operation;
+    case MEMORY_SYSTEM_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+/**
+ * @brief mallocのラッパ関数で、size_のメモリを確保する
+ *
+ * @note choco_memory保有APIの単体テストのため、test_config_test_mallocの設定により、強制的にNULLを返させる、以下の条件でNULLになる
+ * - s_test_config_test_malloc.fail_on_call > 0 && s_test_config_test_malloc.call_count == s_test_config_test_malloc.fail_on_call
+ *
+ * @param[in] size_ 確保するメモリ容量
+ *
+ * @return void* 確保されたメモリの先頭アドレス
+ */
+static void* test_malloc(size_t size_) {
+    void* ret = NULL;
+#ifdef TEST_BUILD
+    s_test_config_test_malloc.call_count++;
+    if(0 == s_test_config_test_malloc.fail_on_call) {
+        ret = malloc(size_);
+    } else {
+        if(s_test_config_test_malloc.call_count == s_test_config_test_malloc.fail_on_call) {
+            ret = NULL;
+        } else {
+            ret = malloc(size_);
+        }
+    }
+#else
+    ret = malloc(size_);
+#endif
+    return ret;
+}
+
+/**
+ * @brief posix_memalignのラッパ関数で、align_でアラインされたsize_のメモリを確保する
+ *
+ * @note
+ * - 確保したメモリはfreeで解放可能
+ * - 単体テストのため、test_mallocと同じテスト設定(s_test_config_test_malloc)で強制的にNULLを返させる
+ *
+ * @param[in] size_ 確保するメモリ容量
+ * @param[in] align_ アライメント要件(sizeof(void*)の倍数である2の冪乗)
+ *
+ * @return void* 確保されたメモリの先頭アドレス(失敗時はNULL)
+ */
+static void* test_aligned_alloc(size_t size_, size_t align_) {
+    void* ret = NULL;
+#ifdef TEST_BUILD
+    s_test_config_test_malloc.call_count++;
+    if(0 != s_test_config_test_malloc.fail_on_call && s_test_config_test_malloc.call_count == s_test_config_test_malloc.fail_on_call) {
+        return NULL;
+    }
+#endif
+    if(0 != posix_memalign(&ret, align_, size_)) {
+        ret = NULL;
+    }
+    return ret;
+}
+
+/**
+ * @brief reallocのラッパ関数
+ *
+ * @note 単体テストのため、test_mallocと同じテスト設定(s_test_config_test_malloc)で強制的にNULLを返させる
+ *
+ * @param[in] ptr_ 再割り当て対象メモリアドレス
+ * @param[in] size_ 変更後のメモリ容量
+ *
+ * @return void* 再割り当て後のメモリの先頭アドレス(失敗時はNULLで、ptr_の領域は不変)
+ */
+static void* test_realloc(void* ptr_, size_t size_) {
+#ifdef TEST_BUILD
+    s_test_config_test_malloc.call_count++;
+    if(0 != s_test_config_test_malloc.fail_on_call && s_test_config_test_malloc.call_count == s_test_config_test_malloc.fail_on_call) {
+        return NULL;
+    }
+#endif
+    return realloc(ptr_, size_);
+}
+
+/**
+ * @brief 割り当てサイズsize_に対応するスラブアロケータのサイズクラスインデックスを取得する
+ *
+ * @param[in] size_ 割り当てサイズ
+ *
+ * @return size_t サイズクラスインデックス(最大サイズクラスを超える場合はMEMORY_SYSTEM_SLAB_CLASS_COUNT)
+ */
+static size_t slab_class_index(size_t size_) {
+    size_t index = 0;
+    size_t class_size = MEMORY_SYSTEM_SLAB_MIN_SIZE;
+    while(index != MEMORY_SYSTEM_SLAB_CLASS_COUNT && class_size < size_) {
+        index++;
+        class_size <<= 1;
+    }
+    return index;
+}
+
+/**
+ * @brief 割り当てサイズsize_に対応する割り当てサイズヒストグラムのビンインデックスを取得する
+ *
+ * @param[in] size_ 割り当てサイズ
+ *
+ * @return size_t ビンインデックス(@ref MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT 参照)
+ */
+static size_t histogram_bin_index(size_t size_) {
+    size_t index = 0;
+    size_t bin_size = 16;
+    while(index != (MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT - 1) && bin_size < size_) {
+        index++;
+        bin_size <<= 2;
+    }
+    return index;
+}
+
+/**
+ * @brief 呼び出しスレッドのスレッドキャッシュを取得する
+ *
+ * @note
+ * - キャッシュの世代が現在のメモリシステムと異なる場合は、破棄済みのメモリシステムのブロックとみなしてキャッシュを空にする
+ * - 初回使用時にスレッド終了時の返却処理(thread_cache_release)を登録する
+ *
+ * @return thread_cache_t* 呼び出しスレッドのスレッドキャッシュ
+ */
+static thread_cache_t* thread_cache_get(void) {
+    thread_cache_t* const cache = &s_thread_cache;
+    if(cache->generation != s_mem_sys_ptr->generation) {
+        memset(cache->count, 0, sizeof(cache->count));
+        cache->generation = s_mem_sys_ptr->generation;
+        pthread_setspecific(s_mem_sys_ptr->thread_cache_key, cache);
+    }
+    return cache;
+}
+
+/**
+ * @brief スレッドキャッシュからサイズクラスslab_index_のブロックを取り出す
+ *
+ * @note キャッシュが空の場合は、ロックを取得してスラブアロケータから最大MEMORY_SYSTEM_THREAD_CACHE_BATCH個のブロックを補充する
+ *
+ * @param[in] slab_index_ サイズクラスのインデックス
+ *
+ * @return void* 取り出したブロック(スラブが枯渇している場合はNULL)
+ */
+static void* thread_cache_allocate(size_t slab_index_) {
+    thread_cache_t* const cache = thread_cache_get();
+    void* ret = NULL;
+
+    if(0 == cache->count[slab_index_]) {
+        void* batch[MEMORY_SYSTEM_THREAD_CACHE_BATCH] = { 0 };
+        size_t batch_count = 0;
+        pthread_mutex_lock(&s_mem_sys_ptr->lock);
+        while(batch_count != MEMORY_SYSTEM_THREAD_CACHE_BATCH) {
+            void* block = NULL;
+            if(SLAB_ALLOC_SUCCESS != slab_allocator_allocate(s_mem_sys_ptr->slab[slab_index_], &block)) {
+                break;
+            }
+            batch[batch_count] = block;
+            batch_count++;
+        }
+        pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+        // スラブが払い出した順に取り出されるよう、逆順に積む
+        for(size_t i = 0; i != batch_count; ++i) {
+            cache->blocks[slab_index_][i] = batch[batch_count - 1 - i];
+        }
+        cache->count[slab_index_] = batch_count;
+    }
+    if(0 != cache->count[slab_index_]) {
+        cache->count[slab_index_]--;
+        ret = cache->blocks[slab_index_][cache->count[slab_index_]];
+    }
+    return ret;
+}
+
+/**
+ * @brief サイズクラスslab_index_のブロックをスレッドキャッシュに戻す
+ *
+ * @note キャッシュが満杯の場合は、ロックを取得してMEMORY_SYSTEM_THREAD_CACHE_BATCH個のブロックをスラブアロケータへ返却する
+ *
+ * @param[in] slab_index_ サイズクラスのインデックス
+ * @param[in] ptr_ 戻すブロック
+ */
+static void thread_cache_free(size_t slab_index_, void* ptr_) {
+    thread_cache_t* const cache = thread_cache_get();
+
+    if(MEMORY_SYSTEM_THREAD_CACHE_CAPACITY == cache->count[slab_index_]) {
+        pthread_mutex_lock(&s_mem_sys_ptr->lock);
+        for(size_t i = 0; i != MEMORY_SYSTEM_THREAD_CACHE_BATCH; ++i) {
+            cache->count[slab_index_]--;
+            slab_allocator_free(s_mem_sys_ptr->slab[slab_index_], cache->blocks[slab_index_][cache->count[slab_index_]]);
+        }
+        pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    }
+    cache->blocks[slab_index_][cache->count[slab_index_]] = ptr_;
+    cache->count[slab_index_]++;
+}
+
+/**
+ * @brief スレッド終了時にスレッドキャッシュ中のブロックを全てスラブアロケータへ返却する(pthread_key_createに登録するデストラクタ)
+ *
+ * @note メモリシステムが破棄済み、または作り直されている場合は返却せずにキャッシュを空にする
+ *
+ * @param[in,out] cache_ 終了するスレッドのスレッドキャッシュ
+ */
+static void thread_cache_release(void* cache_) {
+    thread_cache_t* const cache = (thread_cache_t*)cache_;
+    if(NULL == cache) {
+        goto cleanup;
+    }
+    if(NULL != s_mem_sys_ptr && cache->generation == s_mem_sys_ptr->generation) {
+        pthread_mutex_lock(&s_mem_sys_ptr->lock);
+        for(size_t i = 0; i != MEMORY_SYSTEM_SLAB_CLASS_COUNT; ++i) {
+            for(size_t j = 0; j != cache->count[i]; ++j) {
+                slab_allocator_free(s_mem_sys_ptr->slab[i], cache->blocks[i][j]);
+            }
+        }
+        pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+    }
+    memset(cache->count, 0, sizeof(cache->count));
+    cache->generation = 0;
+
+cleanup:
+    return;
+}
+
+/**
+ * @brief カウンタにvalue_を加算する
+ *
+ * @note カウンタは統計用途のため、順序保証のない(relaxed)アトミック操作とする
+ *
+ * @param[in,out] counter_ 加算対象カウンタ
+ * @param[in] value_ 加算値
+ */
+static void counter_add(atomic_size_t* counter_, size_t value_) {
+    atomic_fetch_add_explicit(counter_, value_, memory_order_relaxed);
+}
+
+/**
+ * @brief カウンタからvalue_を減算する
+ *
+ * @param[in,out] counter_ 減算対象カウンタ
+ * @param[in] value_ 減算値
+ */
+static void counter_sub(atomic_size_t* counter_, size_t value_) {
+    atomic_fetch_sub_explicit(counter_, value_, memory_order_relaxed);
+}
+
+/**
+ * @brief カウンタの値を取得する
+ *
+ * @param[in] counter_ 取得対象カウンタ
+ *
+ * @return size_t カウンタの値
+ */
+static size_t counter_load(atomic_size_t* counter_) {
+    return atomic_load_explicit(counter_, memory_order_relaxed);
+}
+
+/**
+ * @brief カウンタにvalue_を設定する
+ *
+ * @param[in,out] counter_ 設定対象カウンタ
+ * @param[in] value_ 設定値
+ */
+static void counter_store(atomic_size_t* counter_, size_t value_) {
+    atomic_store_explicit(counter_, value_, memory_order_relaxed);
+}
+
+/**
+ * @brief カウンタの値がvalue_より小さい場合にvalue_で更新する(ピーク値の記録用)
+ *
+ * @param[in,out] counter_ 更新対象カウンタ
+ * @param[in] value_ 比較値
+ */
+static void counter_max(atomic_size_t* counter_, size_t value_) {
+    size_t current = atomic_load_explicit(counter_, memory_order_relaxed);
+    while(current < value_ && !atomic_compare_exchange_weak_explicit(counter_, &current, value_, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief 定常状態割り当てガードが有効な場合、メモリ操作を違反として記録する
+ *
+ * @param[in] op_ メモリ操作種別
+ * @param[in] size_ 要求サイズ
+ * @param[in] mem_tag_ メモリタグ
+ * @param[in] caller_ 呼び出し元アドレス
+ * @param[in] func_name_ ワーニングメッセージに出力する呼び出し元API名
+ *
+ * @retval true MEMORY_GUARD_MODE_DENYのため、メモリ操作を拒否する
+ * @retval false メモリ操作を続行する(ガード無効時を含む)
+ */
+static bool guard_check(memory_guard_op_t op_, size_t size_, memory_tag_t mem_tag_, const void* caller_, const char* func_name_) {
+    bool ret = false;
+    size_t index = 0;
+    memory_guard_mode_t mode = MEMORY_GUARD_MODE_COUNT;
+
+    if(NULL == s_mem_sys_ptr || !atomic_load_explicit(&s_mem_sys_ptr->guard_armed, memory_order_acquire)) {
+        goto cleanup;
+    }
+    mode = (memory_guard_mode_t)atomic_load_explicit(&s_mem_sys_ptr->guard_mode, memory_order_relaxed);
+
+    // 違反記録の書き込み完了後に違反回数を更新する
+    pthread_mutex_lock(&s_mem_sys_ptr->lock);
+    index = counter_load(&s_mem_sys_ptr->guard_violation_count);
+    if(index < MEMORY_SYSTEM_GUARD_RECORD_MAX) {
+        memory_guard_violation_t* const violation = &s_mem_sys_ptr->guard_violations[index];
+        violation->op = op_;
+        violation->mem_tag = mem_tag_;
+        violation->size = size_;
+        violation->caller = caller_;
+    }
+    counter_store(&s_mem_sys_ptr->guard_violation_count, index + 1);
+    pthread_mutex_unlock(&s_mem_sys_ptr->lock);
+
+    if(MEMORY_GUARD_MODE_COUNT != mode) {
+        WARN_MESSAGE("%s - Steady-state guard violation: tag=%s size=%zu caller=%p.", func_name_,
+            (mem_tag_ < MEMORY_TAG_MAX && NULL != s_mem_sys_ptr->mem_tag_str[mem_tag_]) ? s_mem_sys_ptr->mem_tag_str[mem_tag_] : "unknown", size_, caller_);
+    }
+    ret = (MEMORY_GUARD_MODE_DENY == mode && MEMORY_GUARD_OP_FREE != op_);
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief 割り当て統計情報に割り当て1回分を計上する
+ *
+ * @note メモリタグごとの割り当て量更新後に呼び出すこと(最大割り当て量の更新に使用する)
+ *
+ * @param[in] size_ 割り当てサイズ
+ * @param[in] mem_tag_ メモリタグ
+ */
+static void stats_allocate_record(size_t size_, memory_tag_t mem_tag_) {
+    counter_add(&s_mem_sys_ptr->mem_tag_alloc_count[mem_tag_], 1);
+    counter_add(&s_mem_sys_ptr->mem_tag_histogram[mem_tag_][histogram_bin_index(size_)], 1);
+    counter_max(&s_mem_sys_ptr->mem_tag_peak[mem_tag_], counter_load(&s_mem_sys_ptr->mem_tag_allocated[mem_tag_]));
+    counter_max(&s_mem_sys_ptr->total_peak, counter_load(&s_mem_sys_ptr->total_allocated));
+    counter_add(&s_mem_sys_ptr->frame_alloc_count[mem_tag_], 1);
+    counter_add(&s_mem_sys_ptr->frame_allocated_bytes[mem_tag_], size_);
+}
+
+/**
+ * @brief 割り当て統計情報に解放1回分を計上する
+ *
+ * @param[in] size_ 解放サイズ
+ * @param[in] mem_tag_ メモリタグ
+ */
+static void stats_free_record(size_t size_, memory_tag_t mem_tag_) {
+    counter_add(&s_mem_sys_ptr->mem_tag_free_count[mem_tag_], 1);
+    counter_add(&s_mem_sys_ptr->frame_free_count[mem_tag_], 1);
+    counter_add(&s_mem_sys_ptr->frame_freed_bytes[mem_tag_], size_);
+}
+
+/**
+ * @brief 書式化した文字列をバッファ末尾に追記する(memory_system_stats_export用)
+ *
+ * @note
+ * - バッファに収まらない部分は切り捨て、常に終端文字を書き込む
+ * - 切り捨てが発生した場合も、io_length_には切り捨て前の長さを加算する
+ *
+ * @param[in,out] buffer_ 追記先バッファ(NULLの場合は長さの計算のみ行う)
+ * @param[in] buffer_size_ 追記先バッファのサイズ
+ * @param[in,out] io_length_ 追記前の文字列長(追記後の文字列長に更新する)
+ * @param[in] format_ 書式文字列
+ *
+ * @retval true 追記に成功
+ * @retval false 書式化に失敗
+ */
+static bool stats_append(char* buffer_, size_t buffer_size_, size_t* io_length_, const char* format_, ...) {
+    bool ret = false;
+    int written = 0;
+    va_list args;
+
+    va_start(args, format_);
+    if(*io_length_ < buffer_size_) {
+        written = vsnprintf(buffer_ + *io_length_, buffer_size_ - *io_length_, format_, args);
+    } else {
+        written = vsnprintf(NULL, 0, format_, args);
+    }
+    va_end(args);
+    if(0 > written) {
+        goto cleanup;
+    }
+    *io_length_ += (size_t)written;
+
+    ret = true;
+
+cleanup:
+    return ret;
+}
+
+#ifdef TEST_BUILD
+void test_memory_system_create_config_set(const test_call_control_t* config_) {
+    s_test_config_memory_system_create.fail_on_call = config_->fail_on_call;
+    s_test_config_memory_system_create.forced_result = config_->forced_result;
+}
+
+void test_memory_system_allocate_config_set(const test_call_control_t* config_) {
+    s_test_config_memory_system_allocate.fail_on_call = config_->fail_on_call;
+    s_test_config_memory_system_allocate.forced_result = config_->forced_result;
+}
+
+void test_memory_system_allocate_aligned_config_set(const test_call_control_t* config_) {
+    s_test_config_memory_system_allocate_aligned.fail_on_call = config_->fail_on_call;
+    s_test_config_memory_system_allocate_aligned.forced_result = config_->forced_result;
+}
+
+void test_memory_system_reallocate_config_set(const test_call_control_t* config_) {
+    s_test_config_memory_system_reallocate.fail_on_call = config_->fail_on_call;
+    s_test_config_memory_system_reallocate.forced_result = config_->forced_result;
+}
+
+void test_memory_system_reallocate_aligned_config_set(const test_call_control_t* config_) {
+    s_test_config_memory_system_reallocate_aligned.fail_on_call = config_->fail_on_call;
+    s_test_config_memory_system_reallocate_aligned.forced_result = config_->forced_result;
+}
+
+void test_choco_memory_config_reset(void) {
+    test_call_control_reset(&s_test_config_memory_system_create);
+    test_call_control_reset(&s_test_config_memory_system_allocate);
+    test_call_control_reset(&s_test_config_memory_system_allocate_aligned);
+    test_call_control_reset(&s_test_config_memory_system_reallocate);
+    test_call_control_reset(&s_test_config_memory_system_reallocate_aligned);
+    test_call_control_reset(&s_test_config_test_malloc);
+    s_test_config_suspended = false;
+    test_freelist_allocator_config_reset();
+    test_slab_allocator_config_reset();
+}
+
+void test_choco_memory(void) {
+    test_choco_memory_config_reset();
+
+    test_rslt_to_str();
+    test_test_malloc();
+    test_slab_class_index();
+    test_histogram_bin_index();
+    test_memory_system_create();
+    test_memory_system_destroy();
+    test_memory_system_allocate();
+    test_memory_system_free();
+    test_memory_system_allocate_aligned();
+    test_memory_system_free_aligned();
+    test_memory_system_reallocate();
+    test_memory_system_reallocate_aligned();
+    test_memory_system_report();
+    test_memory_system_tag_stats_get();
+    test_memory_system_tag_str_get();
+    test_memory_system_frame_stats_sample();
+    test_memory_system_stats_export();
+    test_memory_system_guard();
+    test_memory_system_multithread();
+
+    test_choco_memory_config_reset();
+}
+
+// Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_memory_system_create(void) {
+    {
+        // memory_system_create() 冒頭で強制的に MEMORY_SYSTEM_NO_MEMORY を返させる
+        memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_create_config_set(&config);
+
+        ret = memory_system_create();
+        assert(MEMORY_SYSTEM_NO_MEMORY == ret);
+        assert(NULL == s_mem_sys_ptr);
+
+        test_choco_memory_config_reset();
+    }
+    {
+        // NULL != s_mem_sys_ptr -> MEMORY_SYSTEM_RUNTIME_ERROR
+        memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+
+        s_mem_sys_ptr = (memory_system_t*)malloc(sizeof(memory_system_t));
+        assert(NULL != s_mem_sys_ptr);
+
+        ret = memory_system_create();
+        assert(MEMORY_SYSTEM_RUNTIME_ERROR == ret);
+        assert(NULL != s_mem_sys_ptr);
 
         free(s_mem_sys_ptr);
         s_mem_sys_ptr = NULL;
@@ -380,6 +1441,80 @@ static void NO_COVERAGE test_memory_system_create(void) {
 
         test_choco_memory_config_reset();
     }
+    {
+        // 内部 test_malloc() の2回目(フリーリスト構造体)、3回目(メモリプール)を失敗させる -> MEMORY_SYSTEM_NO_MEMORY
+        for(uint32_t fail_on_call = 2U; fail_on_call <= 3U; ++fail_on_call) {
+            memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+
+            test_choco_memory_config_reset();
+            assert(NULL == s_mem_sys_ptr);
+
+            s_test_config_test_malloc.fail_on_call = fail_on_call;
+
+            ret = memory_system_create();
+            assert(MEMORY_SYSTEM_NO_MEMORY == ret);
+            assert(NULL == s_mem_sys_ptr);
+            assert(fail_on_call == s_test_config_test_malloc.call_count);
+
+            test_choco_memory_config_reset();
+        }
+    }
+    {
+        // freelist_allocator_init() を失敗させる -> MEMORY_SYSTEM_RUNTIME_ERROR
+        memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)FREELIST_ALLOC_INVALID_ARGUMENT;
+        test_freelist_allocator_init_config_set(&config);
+
+        ret = memory_system_create();
+        assert(MEMORY_SYSTEM_RUNTIME_ERROR == ret);
+        assert(NULL == s_mem_sys_ptr);
+
+        test_choco_memory_config_reset();
+    }
+    {
+        // スラブアロケータ構造体インスタンス、メモリプールの切り出しを失敗させる -> MEMORY_SYSTEM_NO_MEMORY
+        for(uint32_t fail_on_call = 1U; fail_on_call <= 2U; ++fail_on_call) {
+            memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+            test_call_control_t config = {0};
+
+            test_choco_memory_config_reset();
+            assert(NULL == s_mem_sys_ptr);
+
+            config.fail_on_call = fail_on_call;
+            config.forced_result = (int)FREELIST_ALLOC_NO_MEMORY;
+            test_freelist_allocator_allocate_config_set(&config);
+
+            ret = memory_system_create();
+            assert(MEMORY_SYSTEM_NO_MEMORY == ret);
+            assert(NULL == s_mem_sys_ptr);
+
+            test_choco_memory_config_reset();
+        }
+    }
+    {
+        // slab_allocator_init() を失敗させる -> MEMORY_SYSTEM_RUNTIME_ERROR
+        memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        test_call_control_t config = {0};
+
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+
+        config.fail_on_call = MEMORY_SYSTEM_SLAB_CLASS_COUNT;
+        config.forced_result = (int)SLAB_ALLOC_INVALID_ARGUMENT;
+        test_slab_allocator_init_config_set(&config);
+
+        ret = memory_system_create();
+        assert(MEMORY_SYSTEM_RUNTIME_ERROR == ret);
+        assert(NULL == s_mem_sys_ptr);
+
+        test_choco_memory_config_reset();
+    }
     {
         // 正常系
         memory_system_result_t ret = MEMORY_SYSTEM_INVALID_ARGUMENT;
@@ -389,11 +1524,15 @@ static void NO_COVERAGE test_memory_system_create(void) {
 
         ret = memory_system_create();
         assert(MEMORY_SYSTEM_SUCCESS == ret);
+        for(size_t i = 0; i != MEMORY_SYSTEM_SLAB_CLASS_COUNT; ++i) {
+            assert((MEMORY_SYSTEM_SLAB_MIN_SIZE << i) == slab_allocator_block_size(s_mem_sys_ptr->slab[i]));
+            assert(0U == slab_allocator_used_count(s_mem_sys_ptr->slab[i]));
+        }
         assert(NULL != s_mem_sys_ptr);
 
-        assert(0U == s_mem_sys_ptr->total_allocated);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
         for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
         }
 
         assert(0 == strcmp("system", s_mem_sys_ptr->mem_tag_str[MEMORY_TAG_SYSTEM]));
@@ -403,6 +1542,7 @@ static void NO_COVERAGE test_memory_system_create(void) {
         assert(0 == strcmp("file_io", s_mem_sys_ptr->mem_tag_str[MEMORY_TAG_FILE_IO]));
         assert(0 == strcmp("camera", s_mem_sys_ptr->mem_tag_str[MEMORY_TAG_CAMERA]));
         assert(0 == strcmp("texture", s_mem_sys_ptr->mem_tag_str[MEMORY_TAG_TEXTURE]));
+        assert(0 == strcmp("container", s_mem_sys_ptr->mem_tag_str[MEMORY_TAG_CONTAINER]));
 
         memory_system_destroy();
         assert(NULL == s_mem_sys_ptr);
@@ -449,9 +1589,9 @@ static void NO_COVERAGE test_memory_system_destroy(void) {
         assert(MEMORY_SYSTEM_SUCCESS == ret);
         assert(NULL != s_mem_sys_ptr);
 
-        s_mem_sys_ptr->total_allocated = 128U;
-        s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING] = 32U;
-        s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM] = 96U;
+        counter_store(&s_mem_sys_ptr->total_allocated, 128U);
+        counter_store(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING], 32U);
+        counter_store(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM], 96U);
 
         memory_system_destroy();
         assert(NULL == s_mem_sys_ptr);
@@ -482,18 +1622,18 @@ static void NO_COVERAGE test_memory_system_allocate(void) {
         ret = memory_system_create();
         assert(MEMORY_SYSTEM_SUCCESS == ret);
         assert(NULL != s_mem_sys_ptr);
-        assert(0U == s_mem_sys_ptr->total_allocated);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
         for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
         }
 
         {
             // out_ptr_ == NULL -> MEMORY_SYSTEM_INVALID_ARGUMENT
             ret = memory_system_allocate(128U, MEMORY_TAG_STRING, NULL);
             assert(MEMORY_SYSTEM_INVALID_ARGUMENT == ret);
-            assert(0U == s_mem_sys_ptr->total_allocated);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
             for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-                assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+                assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
             }
         }
         {
@@ -504,9 +1644,9 @@ static void NO_COVERAGE test_memory_system_allocate(void) {
             ret = memory_system_allocate(128U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_INVALID_ARGUMENT == ret);
             assert(NULL != ptr);
-            assert(0U == s_mem_sys_ptr->total_allocated);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
             for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-                assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+                assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
             }
 
             free(ptr);
@@ -519,9 +1659,9 @@ static void NO_COVERAGE test_memory_system_allocate(void) {
             ret = memory_system_allocate(128U, MEMORY_TAG_MAX, &ptr);
             assert(MEMORY_SYSTEM_INVALID_ARGUMENT == ret);
             assert(NULL == ptr);
-            assert(0U == s_mem_sys_ptr->total_allocated);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
             for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-                assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+                assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
             }
         }
         {
@@ -531,40 +1671,40 @@ static void NO_COVERAGE test_memory_system_allocate(void) {
             ret = memory_system_allocate(0U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_SUCCESS == ret);
             assert(NULL == ptr);
-            assert(0U == s_mem_sys_ptr->total_allocated);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
             for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-                assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+                assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
             }
         }
         {
             // mem_tag_allocated[mem_tag_] の加算で SIZE_MAX を超える -> MEMORY_SYSTEM_LIMIT_EXCEEDED
             void* ptr = NULL;
 
-            s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING] = SIZE_MAX - 100U;
+            counter_store(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING], SIZE_MAX - 100U);
 
             ret = memory_system_allocate(101U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_LIMIT_EXCEEDED == ret);
             assert(NULL == ptr);
-            assert(0U == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
-            assert((SIZE_MAX - 100U) == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+            assert((SIZE_MAX - 100U) == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
 
-            s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING] = 0U;
+            counter_store(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING], 0U);
         }
         {
             // total_allocated の加算で SIZE_MAX を超える -> MEMORY_SYSTEM_LIMIT_EXCEEDED
             void* ptr = NULL;
 
-            s_mem_sys_ptr->total_allocated = SIZE_MAX - 100U;
+            counter_store(&s_mem_sys_ptr->total_allocated, SIZE_MAX - 100U);
 
             ret = memory_system_allocate(101U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_LIMIT_EXCEEDED == ret);
             assert(NULL == ptr);
-            assert((SIZE_MAX - 100U) == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
+            assert((SIZE_MAX - 100U) == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
 
-            s_mem_sys_ptr->total_allocated = 0U;
+            counter_store(&s_mem_sys_ptr->total_allocated, 0U);
         }
         {
             // memory_system_allocate() 冒頭で強制的に MEMORY_SYSTEM_NO_MEMORY を返させる
@@ -581,9 +1721,9 @@ static void NO_COVERAGE test_memory_system_allocate(void) {
             ret_local = memory_system_allocate(128U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_NO_MEMORY == ret_local);
             assert(NULL == ptr);
-            assert(0U == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
 
             // 冒頭で return しているので、内部 test_malloc() には到達しない
             assert(0U == s_test_config_test_malloc.call_count);
@@ -591,41 +1731,105 @@ static void NO_COVERAGE test_memory_system_allocate(void) {
             test_choco_memory_config_reset();
         }
         {
-            // 内部 test_malloc() の1回目を失敗させる -> MEMORY_SYSTEM_NO_MEMORY
+            // スラブ、フリーリストからの割り当てと、フォールバックの test_malloc() を失敗させる -> MEMORY_SYSTEM_NO_MEMORY
+            test_call_control_t config = {0};
             void* ptr = NULL;
 
             test_choco_memory_config_reset();
+            config.fail_on_call = 1U;
+            config.forced_result = (int)SLAB_ALLOC_NO_MEMORY;
+            test_slab_allocator_allocate_config_set(&config);
+            config.forced_result = (int)FREELIST_ALLOC_NO_MEMORY;
+            test_freelist_allocator_allocate_config_set(&config);
             s_test_config_test_malloc.fail_on_call = 1U;
 
             ret = memory_system_allocate(128U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_NO_MEMORY == ret);
             assert(NULL == ptr);
-            assert(0U == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
             assert(1U == s_test_config_test_malloc.call_count);
 
             test_choco_memory_config_reset();
         }
         {
-            // 正常系
+            // 正常系: サイズクラス内の割り当てはスラブから(スレッドキャッシュへMEMORY_SYSTEM_THREAD_CACHE_BATCH個まとめて補充される)
             void* ptr = NULL;
 
             test_choco_memory_config_reset();
 
-            ret = memory_system_allocate(128U, MEMORY_TAG_STRING, &ptr);
+            ret = memory_system_allocate(100U, MEMORY_TAG_STRING, &ptr);
             assert(MEMORY_SYSTEM_SUCCESS == ret);
             assert(NULL != ptr);
-            assert(128U == s_mem_sys_ptr->total_allocated);
-            assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
-
-            memory_system_free(ptr, 128U, MEMORY_TAG_STRING);
+            assert(slab_allocator_owns(s_mem_sys_ptr->slab[3], ptr));
+            assert(MEMORY_SYSTEM_THREAD_CACHE_BATCH == slab_allocator_used_count(s_mem_sys_ptr->slab[3]));
+            assert((MEMORY_SYSTEM_THREAD_CACHE_BATCH - 1U) == s_thread_cache.count[3]);
+            assert(100U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(100U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+
+            memory_system_free(ptr, 100U, MEMORY_TAG_STRING);
             ptr = NULL;
 
-            assert(0U == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            // 解放したブロックはスレッドキャッシュに戻り、スレッド終了時(thread_cache_release)にスラブへ返却される
+            assert(MEMORY_SYSTEM_THREAD_CACHE_BATCH == s_thread_cache.count[3]);
+            assert(MEMORY_SYSTEM_THREAD_CACHE_BATCH == slab_allocator_used_count(s_mem_sys_ptr->slab[3]));
+            thread_cache_release(&s_thread_cache);
+            assert(0U == s_thread_cache.count[3]);
+            assert(0U == slab_allocator_used_count(s_mem_sys_ptr->slab[3]));
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+        }
+        {
+            // 正常系: サイズクラス超過、またはスラブ枯渇の割り当てはフリーリストから
+            const size_t free_space = freelist_allocator_free_space(s_mem_sys_ptr->freelist);
+            test_call_control_t config = {0};
+            void* ptr_large = NULL;
+            void* ptr_small = NULL;
+
+            test_choco_memory_config_reset();
+
+            ret = memory_system_allocate(1024U, MEMORY_TAG_STRING, &ptr_large);
+            assert(MEMORY_SYSTEM_SUCCESS == ret);
+            assert(freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr_large));
+            for(size_t i = 0; i != MEMORY_SYSTEM_SLAB_CLASS_COUNT; ++i) {
+                assert(!slab_allocator_owns(s_mem_sys_ptr->slab[i], ptr_large));
+            }
+
+            config.fail_on_call = 1U;
+            config.forced_result = (int)SLAB_ALLOC_NO_MEMORY;
+            test_slab_allocator_allocate_config_set(&config);
+            ret = memory_system_allocate(16U, MEMORY_TAG_SYSTEM, &ptr_small);
+            assert(MEMORY_SYSTEM_SUCCESS == ret);
+            assert(!slab_allocator_owns(s_mem_sys_ptr->slab[0], ptr_small));
+            assert(freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr_small));
+            assert((1024U + 16U) == counter_load(&s_mem_sys_ptr->total_allocated));
+
+            memory_system_free(ptr_large, 1024U, MEMORY_TAG_STRING);
+            memory_system_free(ptr_small, 16U, MEMORY_TAG_SYSTEM);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(free_space == freelist_allocator_free_space(s_mem_sys_ptr->freelist));
+
+            test_choco_memory_config_reset();
+        }
+        {
+            // 正常系: プール容量を超える要求は malloc にフォールバックする
+            void* ptr = NULL;
+
+            test_choco_memory_config_reset();
+
+            ret = memory_system_allocate(MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, MEMORY_TAG_SYSTEM, &ptr);
+            assert(MEMORY_SYSTEM_SUCCESS == ret);
+            assert(NULL != ptr);
+            assert(!freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr));
+            assert(1U == s_test_config_test_malloc.call_count);
+            assert((MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U) == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+
+            memory_system_free(ptr, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, MEMORY_TAG_SYSTEM);
+            ptr = NULL;
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
         }
 
         memory_system_destroy();
@@ -663,66 +1867,66 @@ static void NO_COVERAGE test_memory_system_free(void) {
         ret = memory_system_allocate(128U, MEMORY_TAG_STRING, &ptr_string);
         assert(MEMORY_SYSTEM_SUCCESS == ret);
         assert(NULL != ptr_string);
-        assert(128U == s_mem_sys_ptr->total_allocated);
-        assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-        assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+        assert(128U == counter_load(&s_mem_sys_ptr->total_allocated));
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
 
         ret = memory_system_allocate(256U, MEMORY_TAG_SYSTEM, &ptr_system);
         assert(MEMORY_SYSTEM_SUCCESS == ret);
         assert(NULL != ptr_system);
-        assert((128U + 256U) == s_mem_sys_ptr->total_allocated);
-        assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-        assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+        assert((128U + 256U) == counter_load(&s_mem_sys_ptr->total_allocated));
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+        assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
 
         {
             // ptr_ == NULL -> no-op
             memory_system_free(NULL, 128U, MEMORY_TAG_STRING);
-            assert((128U + 256U) == s_mem_sys_ptr->total_allocated);
-            assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert((128U + 256U) == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
         }
         {
             // mem_tag_ >= MEMORY_TAG_MAX -> no-op
             memory_system_free(ptr_string, 128U, MEMORY_TAG_MAX);
-            assert((128U + 256U) == s_mem_sys_ptr->total_allocated);
-            assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert((128U + 256U) == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
         }
         {
             // mem_tag_allocated[mem_tag_] < size_ -> no-op
             memory_system_free(ptr_string, 1024U, MEMORY_TAG_STRING);
-            assert((128U + 256U) == s_mem_sys_ptr->total_allocated);
-            assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert((128U + 256U) == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
         }
         {
             // total_allocated < size_ -> no-op
-            s_mem_sys_ptr->total_allocated = 64U;
+            counter_store(&s_mem_sys_ptr->total_allocated, 64U);
 
             memory_system_free(ptr_string, 128U, MEMORY_TAG_STRING);
-            assert(64U == s_mem_sys_ptr->total_allocated);
-            assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert(64U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
 
-            s_mem_sys_ptr->total_allocated = 128U + 256U;
+            counter_store(&s_mem_sys_ptr->total_allocated, 128U + 256U);
         }
         {
             // 正常系: string を free
             memory_system_free(ptr_string, 128U, MEMORY_TAG_STRING);
             ptr_string = NULL;
 
-            assert(256U == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert(256U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
         }
         {
             // 正常系: system を free
             memory_system_free(ptr_system, 256U, MEMORY_TAG_SYSTEM);
             ptr_system = NULL;
 
-            assert(0U == s_mem_sys_ptr->total_allocated);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
         }
 
         memory_system_destroy();
@@ -730,6 +1934,309 @@ static void NO_COVERAGE test_memory_system_free(void) {
     }
 }
 
+static void NO_COVERAGE test_memory_system_allocate_aligned(void) {
+    {
+        // テスト基盤による強制失敗
+        void* ptr = NULL;
+        test_call_control_t config = {0};
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_allocate_aligned_config_set(&config);
+        assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_allocate_aligned(64U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(NULL == ptr);
+        test_choco_memory_config_reset();
+    }
+    {
+        // メモリシステム未初期化 -> MEMORY_SYSTEM_BAD_OPERATION
+        void* ptr = NULL;
+        assert(NULL == s_mem_sys_ptr);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_allocate_aligned(64U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(NULL == ptr);
+    }
+    {
+        void* ptr = NULL;
+        void* ptr_small = NULL;
+        void* ptr_big = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        // 引数異常 -> MEMORY_SYSTEM_INVALID_ARGUMENT
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_allocate_aligned(64U, 0U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_allocate_aligned(64U, 48U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_allocate_aligned(64U, 64U, MEMORY_TAG_TEXTURE, NULL));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_allocate_aligned(64U, 64U, MEMORY_TAG_MAX, &ptr));
+        assert(NULL == ptr);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+
+        // size_ == 0 -> 何もしない
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(0U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(NULL == ptr);
+
+        // 正常系: max_align_t以下のアライメント要件(スラブから割り当て)
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(24U, 1U, MEMORY_TAG_TEXTURE, &ptr_small));
+        assert(NULL != ptr_small);
+        assert(0U == ((uintptr_t)ptr_small % alignof(max_align_t)));
+
+        // 正常系: max_align_tを超えるアライメント要件(スラブ対象サイズでもフリーリストから割り当て)
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(24U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(NULL != ptr);
+        assert(0U == ((uintptr_t)ptr % 64U));
+        assert(freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr));
+        assert((24U + 24U) == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+
+        // 正常系: フリーリストで確保できないサイズはposix_memalignにフォールバック
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, 4096U, MEMORY_TAG_TEXTURE, &ptr_big));
+        assert(NULL != ptr_big);
+        assert(0U == ((uintptr_t)ptr_big % 4096U));
+        assert(!freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr_big));
+        assert((24U + 24U + MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U) == counter_load(&s_mem_sys_ptr->total_allocated));
+
+        memory_system_free_aligned(ptr_big, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, 4096U, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(ptr, 24U, 64U, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(ptr_small, 24U, 1U, MEMORY_TAG_TEXTURE);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+
+        {
+            // posix_memalign失敗 -> MEMORY_SYSTEM_NO_MEMORY
+            test_choco_memory_config_reset();
+            s_test_config_test_malloc.fail_on_call = 1U;
+            ptr_big = NULL;
+            assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_allocate_aligned(MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, 4096U, MEMORY_TAG_TEXTURE, &ptr_big));
+            assert(NULL == ptr_big);
+            assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+            test_choco_memory_config_reset();
+        }
+
+        memory_system_destroy();
+        assert(NULL == s_mem_sys_ptr);
+    }
+}
+
+static void NO_COVERAGE test_memory_system_free_aligned(void) {
+    void* ptr = NULL;
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(128U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+    {
+        // align_が2の冪乗ではない -> 何もしない
+        memory_system_free_aligned(ptr, 128U, 0U, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(ptr, 128U, 96U, MEMORY_TAG_TEXTURE);
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+    }
+    {
+        // ptr_がalign_でアラインされていない -> 何もしない
+        memory_system_free_aligned((char*)ptr + 16, 128U, 64U, MEMORY_TAG_TEXTURE);
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+    }
+    {
+        // NULL、メモリタグ異常 -> 何もしない
+        memory_system_free_aligned(NULL, 128U, 64U, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(ptr, 128U, 64U, MEMORY_TAG_MAX);
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+    }
+    {
+        // 正常系
+        memory_system_free_aligned(ptr, 128U, 64U, MEMORY_TAG_TEXTURE);
+        ptr = NULL;
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_memory_system_reallocate(void) {
+    {
+        // テスト基盤による強制失敗
+        void* ptr = NULL;
+        test_call_control_t config = {0};
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_reallocate_config_set(&config);
+        assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_reallocate(NULL, 0U, 64U, MEMORY_TAG_STRING, &ptr));
+        assert(NULL == ptr);
+        test_choco_memory_config_reset();
+    }
+    {
+        // メモリシステム未初期化 -> MEMORY_SYSTEM_BAD_OPERATION
+        void* ptr = NULL;
+        assert(NULL == s_mem_sys_ptr);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_reallocate(NULL, 0U, 64U, MEMORY_TAG_STRING, &ptr));
+        assert(NULL == ptr);
+    }
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+    {
+        // 引数異常 -> MEMORY_SYSTEM_INVALID_ARGUMENT
+        void* ptr = NULL;
+        void* out = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(32U, MEMORY_TAG_STRING, &ptr));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate(ptr, 32U, 64U, MEMORY_TAG_STRING, NULL));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate(ptr, 32U, 64U, MEMORY_TAG_MAX, &out));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate(ptr, 32U, 0U, MEMORY_TAG_STRING, &out));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate(ptr, 0U, 64U, MEMORY_TAG_STRING, &out));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate(NULL, 32U, 64U, MEMORY_TAG_STRING, &out));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate(ptr, 33U, 64U, MEMORY_TAG_STRING, &out));   // トラッキング値超過
+        assert(NULL == out);
+        assert(32U == counter_load(&s_mem_sys_ptr->total_allocated));
+
+        // size_t overflow -> MEMORY_SYSTEM_LIMIT_EXCEEDED
+        assert(MEMORY_SYSTEM_LIMIT_EXCEEDED == memory_system_reallocate(ptr, 32U, SIZE_MAX, MEMORY_TAG_STRING, &out));
+        assert(NULL == out);
+
+        // サイズ不変 -> 同じアドレス
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 32U, 32U, MEMORY_TAG_STRING, &out));
+        assert(ptr == out);
+        memory_system_free(ptr, 32U, MEMORY_TAG_STRING);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    {
+        // ptr_ == NULL -> 新規割り当て
+        void* ptr = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(NULL, 0U, 24U, MEMORY_TAG_STRING, &ptr));
+        assert(NULL != ptr);
+        assert(24U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+
+        // スラブ: 同じサイズクラス内はその場で変更、クラスを跨ぐとコピー
+        memset(ptr, 'a', 24U);
+        void* out = ptr;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 24U, 30U, MEMORY_TAG_STRING, &out));
+        assert(ptr == out);
+        assert('a' == ((char*)out)[23]);
+        assert(0 == ((char*)out)[29]);
+        assert(30U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 30U, 100U, MEMORY_TAG_STRING, &out));
+        assert(ptr != out);
+        assert('a' == ((char*)out)[0]);
+        assert('a' == ((char*)out)[23]);
+        assert(0 == ((char*)out)[99]);
+        assert(100U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+        assert(100U == counter_load(&s_mem_sys_ptr->total_allocated));
+        memory_system_free(out, 100U, MEMORY_TAG_STRING);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    {
+        // フリーリスト: 直後が空きならその場で拡張、縮小は常にその場
+        void* ptr = NULL;
+        void* out = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(1024U, MEMORY_TAG_FILE_IO, &ptr));
+        assert(freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr));
+        memset(ptr, 'b', 1024U);
+        out = ptr;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 1024U, 4096U, MEMORY_TAG_FILE_IO, &out));
+        assert(ptr == out);
+        assert('b' == ((char*)out)[1023]);
+        assert(0 == ((char*)out)[1024]);
+        assert(4096U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_FILE_IO]));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 4096U, 512U, MEMORY_TAG_FILE_IO, &out));
+        assert(ptr == out);
+        assert(512U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_FILE_IO]));
+        assert(512U == counter_load(&s_mem_sys_ptr->total_allocated));
+
+        // 直後が割り当て済み、かつコピー先の割り当て失敗 -> MEMORY_SYSTEM_NO_MEMORY(旧領域は不変)
+        void* blocker = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(1024U, MEMORY_TAG_FILE_IO, &blocker));
+        {
+            test_call_control_t config = {0};
+            test_choco_memory_config_reset();
+            config.fail_on_call = 1;
+            config.forced_result = (int)FREELIST_ALLOC_NO_MEMORY;
+            test_freelist_allocator_allocate_config_set(&config);
+            s_test_config_test_malloc.fail_on_call = 1U;
+            assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_reallocate(ptr, 512U, 8192U, MEMORY_TAG_FILE_IO, &out));
+            assert(ptr == out);
+            assert('b' == ((char*)ptr)[511]);
+            assert((512U + 1024U) == counter_load(&s_mem_sys_ptr->total_allocated));
+            test_choco_memory_config_reset();
+        }
+
+        // 直後が割り当て済み -> コピー
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 512U, 8192U, MEMORY_TAG_FILE_IO, &out));
+        assert(ptr != out);
+        assert('b' == ((char*)out)[511]);
+        assert(0 == ((char*)out)[512]);
+        assert((8192U + 1024U) == counter_load(&s_mem_sys_ptr->total_allocated));
+        memory_system_free(blocker, 1024U, MEMORY_TAG_FILE_IO);
+        memory_system_free(out, 8192U, MEMORY_TAG_FILE_IO);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    {
+        // malloc(フォールバック)領域: reallocで変更、realloc失敗 -> MEMORY_SYSTEM_NO_MEMORY(旧領域は不変)
+        void* ptr = NULL;
+        void* out = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, MEMORY_TAG_FILE_IO, &ptr));
+        assert(!freelist_allocator_owns(s_mem_sys_ptr->freelist, ptr));
+        ((char*)ptr)[MEMORY_SYSTEM_FREELIST_POOL_SIZE] = 'c';
+
+        test_choco_memory_config_reset();
+        s_test_config_test_malloc.fail_on_call = 1U;
+        out = ptr;
+        assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_reallocate(ptr, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 2U, MEMORY_TAG_FILE_IO, &out));
+        assert(ptr == out);
+        assert((MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U) == counter_load(&s_mem_sys_ptr->total_allocated));
+        test_choco_memory_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 2U, MEMORY_TAG_FILE_IO, &out));
+        assert('c' == ((char*)out)[MEMORY_SYSTEM_FREELIST_POOL_SIZE]);
+        assert(0 == ((char*)out)[MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U]);
+        assert((MEMORY_SYSTEM_FREELIST_POOL_SIZE + 2U) == counter_load(&s_mem_sys_ptr->total_allocated));
+        memory_system_free(out, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 2U, MEMORY_TAG_FILE_IO);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    memory_system_destroy();
+}
+
+static void NO_COVERAGE test_memory_system_reallocate_aligned(void) {
+    {
+        // テスト基盤による強制失敗
+        void* ptr = NULL;
+        test_call_control_t config = {0};
+        test_choco_memory_config_reset();
+        config.fail_on_call = 1;
+        config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
+        test_memory_system_reallocate_aligned_config_set(&config);
+        assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_reallocate_aligned(NULL, 0U, 64U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+        assert(NULL == ptr);
+        test_choco_memory_config_reset();
+    }
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+    {
+        void* ptr = NULL;
+        void* out = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(256U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+
+        // align_が2の冪乗ではない、ptr_がアラインされていない -> MEMORY_SYSTEM_INVALID_ARGUMENT
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate_aligned(ptr, 256U, 128U, 0U, MEMORY_TAG_TEXTURE, &out));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate_aligned(ptr, 256U, 128U, 96U, MEMORY_TAG_TEXTURE, &out));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_reallocate_aligned((char*)ptr + 16, 256U, 128U, 64U, MEMORY_TAG_TEXTURE, &out));
+        assert(NULL == out);
+
+        // 縮小はその場で行われ、アライメントは維持される
+        memset(ptr, 'd', 256U);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate_aligned(ptr, 256U, 128U, 64U, MEMORY_TAG_TEXTURE, &out));
+        assert(ptr == out);
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_TEXTURE]));
+        memory_system_free_aligned(out, 128U, 64U, MEMORY_TAG_TEXTURE);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    {
+        // malloc(フォールバック)領域はreallocを使用せず、アライン済みの新規領域へコピーする
+        void* ptr = NULL;
+        void* out = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, 4096U, MEMORY_TAG_TEXTURE, &ptr));
+        ((char*)ptr)[0] = 'e';
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate_aligned(ptr, MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, 1024U, 4096U, MEMORY_TAG_TEXTURE, &out));
+        assert(NULL != out);
+        assert(0U == ((uintptr_t)out % 4096U));
+        assert('e' == ((char*)out)[0]);
+        assert(1024U == counter_load(&s_mem_sys_ptr->total_allocated));
+        memory_system_free_aligned(out, 1024U, 4096U, MEMORY_TAG_TEXTURE);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+    }
+    memory_system_destroy();
+}
+
 // Generated by ChatGPT 5.4 Thinking
 static void NO_COVERAGE test_memory_system_report(void) {
     {
@@ -755,18 +2262,18 @@ static void NO_COVERAGE test_memory_system_report(void) {
 
         // all 0 の状態で呼べる
         memory_system_report();
-        assert(0U == s_mem_sys_ptr->total_allocated);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
         for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
         }
 
         // string だけ確保した状態で呼べる
         ret = memory_system_allocate(128U, MEMORY_TAG_STRING, &ptr_string);
         assert(MEMORY_SYSTEM_SUCCESS == ret);
         assert(NULL != ptr_string);
-        assert(128U == s_mem_sys_ptr->total_allocated);
-        assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-        assert(0U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+        assert(128U == counter_load(&s_mem_sys_ptr->total_allocated));
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
 
         memory_system_report();
 
@@ -774,9 +2281,9 @@ static void NO_COVERAGE test_memory_system_report(void) {
         ret = memory_system_allocate(256U, MEMORY_TAG_SYSTEM, &ptr_system);
         assert(MEMORY_SYSTEM_SUCCESS == ret);
         assert(NULL != ptr_system);
-        assert((128U + 256U) == s_mem_sys_ptr->total_allocated);
-        assert(128U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]);
-        assert(256U == s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]);
+        assert((128U + 256U) == counter_load(&s_mem_sys_ptr->total_allocated));
+        assert(128U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+        assert(256U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
 
         memory_system_report();
 
@@ -789,16 +2296,488 @@ static void NO_COVERAGE test_memory_system_report(void) {
         memory_system_free(ptr_string, 128U, MEMORY_TAG_STRING);
         ptr_string = NULL;
 
-        assert(0U == s_mem_sys_ptr->total_allocated);
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+        for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
+            assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[i]));
+        }
+
+        memory_system_destroy();
+        assert(NULL == s_mem_sys_ptr);
+    }
+}
+
+static void NO_COVERAGE test_memory_system_tag_str_get(void) {
+    {
+        // メモリシステム未初期化 -> "unknown"
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+        assert(0 == strcmp("unknown", memory_system_tag_str_get(MEMORY_TAG_SYSTEM)));
+    }
+    {
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        // 範囲外 -> "unknown"
+        assert(0 == strcmp("unknown", memory_system_tag_str_get(MEMORY_TAG_MAX)));
+
+        // 正常系
+        assert(0 == strcmp("system", memory_system_tag_str_get(MEMORY_TAG_SYSTEM)));
+        assert(0 == strcmp("string", memory_system_tag_str_get(MEMORY_TAG_STRING)));
+        assert(0 == strcmp("container", memory_system_tag_str_get(MEMORY_TAG_CONTAINER)));
+
+        memory_system_destroy();
+    }
+}
+
+static void NO_COVERAGE test_memory_system_tag_stats_get(void) {
+    {
+        // メモリシステム未初期化 -> MEMORY_SYSTEM_BAD_OPERATION
+        memory_tag_stats_t stats = { 0 };
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_tag_stats_get(MEMORY_TAG_SYSTEM, &stats));
+    }
+    {
+        memory_tag_stats_t stats = { 0 };
+        void* ptr_small = NULL;
+        void* ptr_large = NULL;
+        void* ptr_other = NULL;
+
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        // 引数異常
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_tag_stats_get(MEMORY_TAG_SYSTEM, NULL));
+        stats.alloc_count = 123U;
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_tag_stats_get(MEMORY_TAG_MAX, &stats));
+        assert(123U == stats.alloc_count);
+
+        // 初期状態は全て0
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_STRING, &stats));
+        assert(0U == stats.allocated);
+        assert(0U == stats.peak);
+        assert(0U == stats.alloc_count);
+        assert(0U == stats.free_count);
+        for(size_t i = 0; i != MEMORY_SYSTEM_SIZE_HISTOGRAM_BIN_COUNT; ++i) {
+            assert(0U == stats.size_histogram[i]);
+        }
+
+        // 割り当て: 回数, ヒストグラム, 最大値が更新される
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(16U, MEMORY_TAG_STRING, &ptr_small));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(1000U, MEMORY_TAG_STRING, &ptr_large));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(64U, MEMORY_TAG_SYSTEM, &ptr_other));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_STRING, &stats));
+        assert(1016U == stats.allocated);
+        assert(1016U == stats.peak);
+        assert(2U == stats.alloc_count);
+        assert(0U == stats.free_count);
+        assert(1U == stats.size_histogram[0]);
+        assert(1U == stats.size_histogram[3]);
+        assert(1080U == counter_load(&s_mem_sys_ptr->total_peak));
+
+        // 解放: 最大値は維持される
+        memory_system_free(ptr_large, 1000U, MEMORY_TAG_STRING);
+        ptr_large = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_STRING, &stats));
+        assert(16U == stats.allocated);
+        assert(1016U == stats.peak);
+        assert(2U == stats.alloc_count);
+        assert(1U == stats.free_count);
+
+        // 再割り当て: 解放1回 + 割り当て1回として計上
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr_small, 16U, 24U, MEMORY_TAG_STRING, &ptr_small));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_STRING, &stats));
+        assert(24U == stats.allocated);
+        assert(3U == stats.alloc_count);
+        assert(2U == stats.free_count);
+        assert(1U == stats.size_histogram[1]);
+
+        // 他タグには影響しない
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_SYSTEM, &stats));
+        assert(64U == stats.allocated);
+        assert(1U == stats.alloc_count);
+        assert(1U == stats.size_histogram[1]);
+
+        // 失敗した割り当ては計上しない
+        test_choco_memory_config_reset();
+        s_test_config_test_malloc.fail_on_call = 1U;
+        {
+            void* ptr_fail = NULL;
+            assert(MEMORY_SYSTEM_NO_MEMORY == memory_system_allocate(MEMORY_SYSTEM_FREELIST_POOL_SIZE + 1U, MEMORY_TAG_SYSTEM, &ptr_fail));
+        }
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_SYSTEM, &stats));
+        assert(1U == stats.alloc_count);
+
+        memory_system_free(ptr_small, 24U, MEMORY_TAG_STRING);
+        memory_system_free(ptr_other, 64U, MEMORY_TAG_SYSTEM);
+        memory_system_destroy();
+    }
+}
+
+static void NO_COVERAGE test_memory_system_frame_stats_sample(void) {
+    {
+        // メモリシステム未初期化 -> MEMORY_SYSTEM_BAD_OPERATION
+        memory_frame_stats_t stats = { 0 };
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_frame_stats_sample(&stats));
+    }
+    {
+        memory_frame_stats_t stats = { 0 };
+        void* ptr = NULL;
+
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_frame_stats_sample(NULL));
+
+        // 1フレーム目: 割り当て2回, 解放1回
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(32U, MEMORY_TAG_RING_QUEUE, &ptr));
+        memory_system_free(ptr, 32U, MEMORY_TAG_RING_QUEUE);
+        ptr = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(48U, MEMORY_TAG_RING_QUEUE, &ptr));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_frame_stats_sample(&stats));
+        assert(2U == stats.alloc_count[MEMORY_TAG_RING_QUEUE]);
+        assert(1U == stats.free_count[MEMORY_TAG_RING_QUEUE]);
+        assert(80U == stats.allocated_bytes[MEMORY_TAG_RING_QUEUE]);
+        assert(32U == stats.freed_bytes[MEMORY_TAG_RING_QUEUE]);
+        assert(0U == stats.alloc_count[MEMORY_TAG_STRING]);
+
+        // 2フレーム目: 割り当てなし -> 差分はリセットされている
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_frame_stats_sample(&stats));
         for(size_t i = 0; i != MEMORY_TAG_MAX; ++i) {
-            assert(0U == s_mem_sys_ptr->mem_tag_allocated[i]);
+            assert(0U == stats.alloc_count[i]);
+            assert(0U == stats.free_count[i]);
+            assert(0U == stats.allocated_bytes[i]);
+            assert(0U == stats.freed_bytes[i]);
+        }
+
+        memory_system_free(ptr, 48U, MEMORY_TAG_RING_QUEUE);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_frame_stats_sample(&stats));
+        assert(0U == stats.alloc_count[MEMORY_TAG_RING_QUEUE]);
+        assert(1U == stats.free_count[MEMORY_TAG_RING_QUEUE]);
+        assert(48U == stats.freed_bytes[MEMORY_TAG_RING_QUEUE]);
+
+        memory_system_destroy();
+    }
+}
+
+static void NO_COVERAGE test_memory_system_stats_export(void) {
+    {
+        // メモリシステム未初期化 -> MEMORY_SYSTEM_BAD_OPERATION
+        size_t length = 0U;
+        test_choco_memory_config_reset();
+        assert(NULL == s_mem_sys_ptr);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, NULL, 0U, &length));
+    }
+    {
+        char buffer[2048] = { 0 };
+        size_t length = 0U;
+        size_t required = 0U;
+        void* ptr = NULL;
+
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        // 引数異常
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, buffer, sizeof(buffer), NULL));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, NULL, sizeof(buffer), &length));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_stats_export((memory_stats_format_t)100, buffer, sizeof(buffer), &length));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(256U, MEMORY_TAG_SYSTEM, &ptr));
+
+        // JSON: 長さのみ取得 -> 出力
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, NULL, 0U, &required));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, buffer, sizeof(buffer), &length));
+        assert(required == length);
+        assert(length == strlen(buffer));
+        {
+            const char* const expected_head = "{\"total_allocated\":256,\"total_peak\":256,\"tags\":[{\"tag\":\"system\",\"allocated\":256,\"peak\":256,\"alloc_count\":1,\"free_count\":0,\"size_histogram\":[0,0,1,0,0,0,0,0]},{\"tag\":\"string\",";
+            assert(0 == strncmp(buffer, expected_head, strlen(expected_head)));
+            assert(0 == strcmp(buffer + length - 4U, "]}]}"));
+        }
+
+        // CSV: ヘッダ行 + タグごとに1行
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_stats_export(MEMORY_STATS_FORMAT_CSV, buffer, sizeof(buffer), &length));
+        {
+            const char* const expected_head = "tag,allocated,peak,alloc_count,free_count,hist_le_16,hist_le_64,hist_le_256,hist_le_1k,hist_le_4k,hist_le_16k,hist_le_64k,hist_gt_64k\nsystem,256,256,1,0,0,0,1,0,0,0,0,0\nstring,0,0,0,0,";
+            assert(0 == strncmp(buffer, expected_head, strlen(expected_head)));
+        }
+        {
+            size_t line_count = 0U;
+            for(size_t i = 0; i != length; ++i) {
+                line_count += ('\n' == buffer[i]) ? 1U : 0U;
+            }
+            assert((1U + MEMORY_TAG_MAX) == line_count);
         }
 
+        // タグ文字列がNULLの場合は"unknown"
+        s_mem_sys_ptr->mem_tag_str[MEMORY_TAG_TEXTURE] = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_stats_export(MEMORY_STATS_FORMAT_CSV, buffer, sizeof(buffer), &length));
+        assert(NULL != strstr(buffer, "\nunknown,0,0,0,0,"));
+
+        // バッファ不足 -> 切り詰めて終端し、MEMORY_SYSTEM_LIMIT_EXCEEDED
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, NULL, 0U, &required));
+        assert(MEMORY_SYSTEM_LIMIT_EXCEEDED == memory_system_stats_export(MEMORY_STATS_FORMAT_JSON, buffer, 10U, &length));
+        assert(required == length);
+        assert(9U == strlen(buffer));
+        assert(0 == strcmp(buffer, "{\"total_a"));
+
+        memory_system_free(ptr, 256U, MEMORY_TAG_SYSTEM);
         memory_system_destroy();
+    }
+}
+
+static void NO_COVERAGE test_memory_system_guard(void) {
+    {
+        // メモリシステム未初期化
+        size_t count = 123U;
+        memory_guard_violation_t violation = { 0 };
+        test_choco_memory_config_reset();
         assert(NULL == s_mem_sys_ptr);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_guard_arm(MEMORY_GUARD_MODE_COUNT));
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_guard_violation_count_get(&count));
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_guard_violation_get(0U, &violation));
+        assert(123U == count);
+        memory_system_guard_disarm();   // no-op
+    }
+    {
+        // 引数異常
+        size_t count = 0U;
+        memory_guard_violation_t violation = { 0 };
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_guard_arm((memory_guard_mode_t)100));
+        assert(false == atomic_load_explicit(&s_mem_sys_ptr->guard_armed, memory_order_acquire));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_guard_violation_count_get(NULL));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_guard_violation_get(0U, NULL));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_guard_violation_get(0U, &violation));   // 記録なし
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(0U == count);
+
+        memory_system_destroy();
+    }
+    {
+        // MEMORY_GUARD_MODE_COUNT: 有効化中の割り当て/再割り当て/解放を記録し、操作は実行する
+        size_t count = 0U;
+        memory_guard_violation_t violation = { 0 };
+        void* ptr_before = NULL;
+        void* ptr = NULL;
+
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        // 有効化前の割り当ては対象外
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(32U, MEMORY_TAG_SYSTEM, &ptr_before));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_arm(MEMORY_GUARD_MODE_COUNT));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(64U, MEMORY_TAG_STRING, &ptr));
+        assert(NULL != ptr);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptr, 64U, 96U, MEMORY_TAG_STRING, &ptr));
+        memory_system_free(ptr, 96U, MEMORY_TAG_STRING);
+        ptr = NULL;
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(3U == count);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_get(0U, &violation));
+        assert(MEMORY_GUARD_OP_ALLOCATE == violation.op);
+        assert(MEMORY_TAG_STRING == violation.mem_tag);
+        assert(64U == violation.size);
+#if defined(__clang__) || defined(__GNUC__)
+        assert(NULL != violation.caller);
+#endif
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_get(1U, &violation));
+        assert(MEMORY_GUARD_OP_REALLOCATE == violation.op);
+        assert(96U == violation.size);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_get(2U, &violation));
+        assert(MEMORY_GUARD_OP_FREE == violation.op);
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_guard_violation_get(3U, &violation));
+
+        // 無効化後は記録しないが、記録は保持される
+        memory_system_guard_disarm();
+        memory_system_free(ptr_before, 32U, MEMORY_TAG_SYSTEM);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(3U == count);
+        memory_system_report();
+
+        // 再有効化で記録はクリアされる
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_arm(MEMORY_GUARD_MODE_COUNT));
+
+        // 有効化中の再有効化 -> MEMORY_SYSTEM_BAD_OPERATION(モード、記録は変化しない)
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_guard_arm(MEMORY_GUARD_MODE_DENY));
+        assert(MEMORY_GUARD_MODE_COUNT == (memory_guard_mode_t)atomic_load_explicit(&s_mem_sys_ptr->guard_mode, memory_order_relaxed));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(0U == count);
+
+        // 記録上限を超えた分は回数のみカウント
+        for(size_t i = 0; i != MEMORY_SYSTEM_GUARD_RECORD_MAX + 2U; ++i) {
+            assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(16U + i, MEMORY_TAG_SYSTEM, &ptr));
+            memory_system_free(ptr, 16U + i, MEMORY_TAG_SYSTEM);
+            ptr = NULL;
+        }
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(2U * (MEMORY_SYSTEM_GUARD_RECORD_MAX + 2U) == count);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_get(MEMORY_SYSTEM_GUARD_RECORD_MAX - 1U, &violation));
+        assert(MEMORY_SYSTEM_INVALID_ARGUMENT == memory_system_guard_violation_get(MEMORY_SYSTEM_GUARD_RECORD_MAX, &violation));
+        memory_system_report();
+        memory_system_guard_disarm();
+
+        memory_system_destroy();
+    }
+    {
+        // MEMORY_GUARD_MODE_DENY: 割り当て/再割り当ては失敗し、解放は実行する
+        size_t count = 0U;
+        void* ptr = NULL;
+        void* ptr_realloc = NULL;
+
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(32U, MEMORY_TAG_SYSTEM, &ptr));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_arm(MEMORY_GUARD_MODE_DENY));
+        {
+            void* ptr_denied = NULL;
+            assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_allocate(32U, MEMORY_TAG_SYSTEM, &ptr_denied));
+            assert(NULL == ptr_denied);
+            assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_allocate_aligned(32U, 64U, MEMORY_TAG_SYSTEM, &ptr_denied));
+            assert(NULL == ptr_denied);
+        }
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_reallocate(ptr, 32U, 64U, MEMORY_TAG_SYSTEM, &ptr_realloc));
+        assert(NULL == ptr_realloc);
+        assert(MEMORY_SYSTEM_BAD_OPERATION == memory_system_reallocate_aligned(ptr, 32U, 64U, 16U, MEMORY_TAG_SYSTEM, &ptr_realloc));
+        assert(NULL == ptr_realloc);
+        assert(32U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+
+        memory_system_free(ptr, 32U, MEMORY_TAG_SYSTEM);
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_SYSTEM]));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(5U == count);
+
+        // MEMORY_GUARD_MODE_WARN: ワーニングを出力して操作は実行する
+        memory_system_guard_disarm();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_arm(MEMORY_GUARD_MODE_WARN));
+        ptr = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(32U, 64U, MEMORY_TAG_TEXTURE, &ptr));
+        memory_system_free_aligned(ptr, 32U, 64U, MEMORY_TAG_TEXTURE);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_guard_violation_count_get(&count));
+        assert(2U == count);
+        memory_system_guard_disarm();
+
+        memory_system_destroy();
+    }
+}
+
+/**
+ * @brief test_memory_system_multithreadのワーカースレッド(サイズクラス、フリーリストにまたがる割り当て、再割り当て、解放を繰り返す)
+ *
+ * @param[in] arg_ 未使用
+ *
+ * @return void* 常にNULL
+ */
+static void* test_memory_system_multithread_worker(void* arg_) {
+    static const size_t sizes[] = { 16U, 40U, 100U, 200U, 1000U, 5000U };
+    enum { SLOT_COUNT = 8, ITERATION_COUNT = 4000 };
+    void* ptrs[SLOT_COUNT] = { 0 };
+    size_t ptr_sizes[SLOT_COUNT] = { 0 };
+    (void)arg_;
+
+    for(size_t i = 0; i != ITERATION_COUNT; ++i) {
+        const size_t slot = (i * 7U) % SLOT_COUNT;
+        const size_t size = sizes[(i * 5U) % (sizeof(sizes) / sizeof(sizes[0]))];
+        if(NULL == ptrs[slot]) {
+            assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(size, MEMORY_TAG_STRING, &ptrs[slot]));
+            memset(ptrs[slot], (int)(slot & 0xFFU), size);
+            ptr_sizes[slot] = size;
+        } else if(0U == (i % 3U)) {
+            void* tmp = NULL;
+            assert(MEMORY_SYSTEM_SUCCESS == memory_system_reallocate(ptrs[slot], ptr_sizes[slot], size, MEMORY_TAG_STRING, &tmp));
+            ptrs[slot] = tmp;
+            ptr_sizes[slot] = size;
+        } else {
+            assert(((unsigned char*)ptrs[slot])[0] == (unsigned char)(slot & 0xFFU));
+            memory_system_free(ptrs[slot], ptr_sizes[slot], MEMORY_TAG_STRING);
+            ptrs[slot] = NULL;
+        }
+    }
+    for(size_t i = 0; i != SLOT_COUNT; ++i) {
+        if(NULL != ptrs[i]) {
+            memory_system_free(ptrs[i], ptr_sizes[i], MEMORY_TAG_STRING);
+        }
+    }
+    return NULL;
+}
+
+static void NO_COVERAGE test_memory_system_multithread(void) {
+    {
+        // 複数スレッドからの同時割り当て、解放で使用量が一致し、スレッド終了時にスレッドキャッシュがスラブへ返却されること
+        enum { THREAD_COUNT = 4 };
+        pthread_t threads[THREAD_COUNT];
+        memory_tag_stats_t stats = { 0 };
+
+        test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        // テスト設定のカウンタは非アトミックのため、ワーカースレッド実行中はカウントを停止する
+        s_test_config_suspended = true;
+        for(size_t i = 0; i != THREAD_COUNT; ++i) {
+            assert(0 == pthread_create(&threads[i], NULL, test_memory_system_multithread_worker, NULL));
+        }
+        for(size_t i = 0; i != THREAD_COUNT; ++i) {
+            assert(0 == pthread_join(threads[i], NULL));
+        }
+        s_test_config_suspended = false;
+        assert(0U == s_test_config_memory_system_allocate.call_count);
+
+        assert(0U == counter_load(&s_mem_sys_ptr->total_allocated));
+        assert(0U == counter_load(&s_mem_sys_ptr->mem_tag_allocated[MEMORY_TAG_STRING]));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_tag_stats_get(MEMORY_TAG_STRING, &stats));
+        assert(0U != stats.alloc_count);
+        assert(stats.alloc_count == stats.free_count);
+        for(size_t i = 0; i != MEMORY_SYSTEM_SLAB_CLASS_COUNT; ++i) {
+            assert(0U == slab_allocator_used_count(s_mem_sys_ptr->slab[i]));
+        }
+
+        memory_system_destroy();
+    }
+    {
+        // 破棄後に作り直したメモリシステムでは、以前のスレッドキャッシュは破棄される
+        void* ptr = NULL;
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(16U, MEMORY_TAG_SYSTEM, &ptr));
+        assert(slab_allocator_owns(s_mem_sys_ptr->slab[0], ptr));
+        memory_system_free(ptr, 16U, MEMORY_TAG_SYSTEM);
+        assert(0U != s_thread_cache.count[0]);
+        memory_system_destroy();
+
+        ptr = NULL;
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(16U, MEMORY_TAG_SYSTEM, &ptr));
+        assert(slab_allocator_owns(s_mem_sys_ptr->slab[0], ptr));
+        assert(s_mem_sys_ptr->generation == s_thread_cache.generation);
+        assert((MEMORY_SYSTEM_THREAD_CACHE_BATCH - 1U) == s_thread_cache.count[0]);
+        memory_system_free(ptr, 16U, MEMORY_TAG_SYSTEM);
+        memory_system_destroy();
     }
 }
 
+static void NO_COVERAGE test_histogram_bin_index(void) {
+    assert(0U == histogram_bin_index(1U));
+    assert(0U == histogram_bin_index(16U));
+    assert(1U == histogram_bin_index(17U));
+    assert(1U == histogram_bin_index(64U));
+    assert(2U == histogram_bin_index(256U));
+    assert(3U == histogram_bin_index(1024U));
+    assert(4U == histogram_bin_index(4U * KIB));
+    assert(5U == histogram_bin_index(16U * KIB));
+    assert(6U == histogram_bin_index(64U * KIB));
+    assert(7U == histogram_bin_index(64U * KIB + 1U));
+    assert(7U == histogram_bin_index(SIZE_MAX));
+}
+
 // Generated by ChatGPT 5.4 Thinking
 static void NO_COVERAGE test_rslt_to_str(void) {
     {
@@ -839,6 +2818,18 @@ static void NO_COVERAGE test_rslt_to_str(void) {
 }
 
 // Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_slab_class_index(void) {
+    assert(0U == slab_class_index(0U));
+    assert(0U == slab_class_index(1U));
+    assert(0U == slab_class_index(16U));
+    assert(1U == slab_class_index(17U));
+    assert(1U == slab_class_index(32U));
+    assert(3U == slab_class_index(128U));
+    assert(4U == slab_class_index(256U));
+    assert(MEMORY_SYSTEM_SLAB_CLASS_COUNT == slab_class_index(257U));
+    assert(MEMORY_SYSTEM_SLAB_CLASS_COUNT == slab_class_index(SIZE_MAX));
+}
+
 static void NO_COVERAGE test_test_malloc(void) {
     {
         // fail_on_call == 0 -> 常に通常の malloc 動作
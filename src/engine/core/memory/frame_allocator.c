@@ -0,0 +1,469 @@
+/** @ingroup core
+ *
+ * @file frame_allocator.c
+ * @author chocolate-pie24
+ * @brief 1フレームの間だけ有効な一時メモリの確保に対応するフレームアロケータモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset
+
+#include "engine/core/memory/frame_allocator.h"
+#include "engine/core/memory/linear_allocator.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <stdlib.h>
+#include "test_controller.h"
+#include "engine/core/memory/test_frame_allocator.h"
+#include "engine/core/memory/test_linear_allocator.h"
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_frame_allocator_initialize;    /**< frame_allocator_initialize()テスト設定 */
+
+// プライベート関数テスト設定
+// 現状ではなし
+
+// 全テスト関数プロトタイプ宣言
+static void test_frame_allocator_preinit(void);
+static void test_frame_allocator_initialize(void);
+static void test_frame_allocator_begin_frame(void);
+static void test_frame_allocator_allocate(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief ダブルバッファのバッファ数
+ *
+ */
+#define FRAME_ALLOC_BUFFER_COUNT 2
+
+/**
+ * @brief frame_alloc_t内部データ構造
+ *
+ */
+struct frame_alloc {
+    size_t frame_capacity;                              /**< 1フレームで使用可能なメモリ容量(byte) */
+    size_t current;                                     /**< カレントフレームで使用するリニアアロケータのインデックス */
+    linear_alloc_t* arena[FRAME_ALLOC_BUFFER_COUNT];    /**< フレームごとに切り替えて使用するリニアアロケータ */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                     /**< 実行結果種別文字列(処理成功) */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                 /**< 実行結果種別文字列(メモリ確保失敗) */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";   /**< 実行結果種別文字列(無効な引数) */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";     /**< 実行結果種別文字列(不明なエラー) */
+
+static const char* rslt_to_str(linear_allocator_result_t rslt_);
+
+linear_allocator_result_t frame_allocator_preinit(size_t frame_capacity_, size_t* io_pool_requirement_) {
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+    size_t linear_alloc_mem_req = 0;
+    size_t linear_alloc_align_req = 0;
+
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != frame_capacity_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_preinit", "frame_capacity_")
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_preinit", "io_pool_requirement_")
+
+    // frame_allocator_initializeと同じ順序で加算する
+    ret = linear_allocator_requirement_add(sizeof(frame_alloc_t), alignof(frame_alloc_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS != ret) {
+        goto cleanup;
+    }
+    linear_allocator_preinit(&linear_alloc_mem_req, &linear_alloc_align_req);
+    for(size_t i = 0; i != FRAME_ALLOC_BUFFER_COUNT; ++i) {
+        ret = linear_allocator_requirement_add(linear_alloc_mem_req, linear_alloc_align_req, io_pool_requirement_);
+        if(LINEAR_ALLOC_SUCCESS != ret) {
+            goto cleanup;
+        }
+        ret = linear_allocator_requirement_add(frame_capacity_, alignof(max_align_t), io_pool_requirement_);
+        if(LINEAR_ALLOC_SUCCESS != ret) {
+            goto cleanup;
+        }
+    }
+
+    ret = LINEAR_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+linear_allocator_result_t frame_allocator_initialize(size_t frame_capacity_, linear_alloc_t* allocator_, frame_alloc_t** out_frame_alloc_) {
+#ifdef TEST_BUILD
+    s_test_config_frame_allocator_initialize.call_count++;
+    if(s_test_config_frame_allocator_initialize.fail_on_call != 0) {
+        if(s_test_config_frame_allocator_initialize.call_count == s_test_config_frame_allocator_initialize.fail_on_call) {
+            return (linear_allocator_result_t)s_test_config_frame_allocator_initialize.forced_result;
+        }
+    }
+#endif
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+    frame_alloc_t* tmp = NULL;
+    size_t linear_alloc_mem_req = 0;
+    size_t linear_alloc_align_req = 0;
+
+    // Preconditions.
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != frame_capacity_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_initialize", "frame_capacity_")
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_initialize", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_frame_alloc_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_initialize", "out_frame_alloc_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_frame_alloc_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_initialize", "*out_frame_alloc_")
+
+    // Simulation.
+    ret = linear_allocator_allocate(allocator_, sizeof(frame_alloc_t), alignof(frame_alloc_t), (void**)&tmp);
+    if(LINEAR_ALLOC_SUCCESS != ret) {
+        ERROR_MESSAGE("frame_allocator_initialize(%s) - Failed to allocate memory for frame allocator.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    memset(tmp, 0, sizeof(frame_alloc_t));
+    tmp->frame_capacity = frame_capacity_;
+    tmp->current = 0;
+
+    linear_allocator_preinit(&linear_alloc_mem_req, &linear_alloc_align_req);
+    for(size_t i = 0; i != FRAME_ALLOC_BUFFER_COUNT; ++i) {
+        void* pool = NULL;
+        ret = linear_allocator_allocate(allocator_, linear_alloc_mem_req, linear_alloc_align_req, (void**)&tmp->arena[i]);
+        if(LINEAR_ALLOC_SUCCESS != ret) {
+            ERROR_MESSAGE("frame_allocator_initialize(%s) - Failed to allocate memory for frame arena.", rslt_to_str(ret));
+            goto cleanup;
+        }
+        ret = linear_allocator_allocate(allocator_, frame_capacity_, alignof(max_align_t), &pool);
+        if(LINEAR_ALLOC_SUCCESS != ret) {
+            ERROR_MESSAGE("frame_allocator_initialize(%s) - Failed to allocate memory for frame arena pool.", rslt_to_str(ret));
+            goto cleanup;
+        }
+        ret = linear_allocator_init(tmp->arena[i], frame_capacity_, pool);
+        if(LINEAR_ALLOC_SUCCESS != ret) {
+            ERROR_MESSAGE("frame_allocator_initialize(%s) - Failed to initialize frame arena.", rslt_to_str(ret));
+            goto cleanup;
+        }
+    }
+
+    // commit.
+    *out_frame_alloc_ = tmp;
+
+    ret = LINEAR_ALLOC_SUCCESS;
+
+cleanup:
+    // リニアアロケータで確保したメモリは個別解放不可であるためクリーンナップ処理はなし
+    return ret;
+}
+
+void frame_allocator_begin_frame(frame_alloc_t* frame_alloc_) {
+    if(NULL == frame_alloc_) {
+        WARN_MESSAGE("frame_allocator_begin_frame - No-op: 'frame_alloc_' must not be NULL.");
+        return;
+    }
+    frame_alloc_->current = (frame_alloc_->current + 1) % FRAME_ALLOC_BUFFER_COUNT;
+    linear_allocator_reset(frame_alloc_->arena[frame_alloc_->current]);
+}
+
+linear_allocator_result_t frame_allocator_allocate(frame_alloc_t* frame_alloc_, size_t req_size_, size_t req_align_, void** out_ptr_) {
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(frame_alloc_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "frame_allocator_allocate", "frame_alloc_")
+
+    ret = linear_allocator_allocate(frame_alloc_->arena[frame_alloc_->current], req_size_, req_align_, out_ptr_);
+
+cleanup:
+    return ret;
+}
+
+/**
+ * @brief 実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 文字列に変換する実行結果コード
+ * @return const char* 変換された文字列の先頭アドレス
+ */
+static const char* rslt_to_str(linear_allocator_result_t rslt_) {
+    switch(rslt_) {
+    case LINEAR_ALLOC_SUCCESS:
+        return s_rslt_str_success;
+    case LINEAR_ALLOC_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case LINEAR_ALLOC_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_frame_allocator_initialize_config_set(const test_call_control_t* config_) {
+    s_test_config_frame_allocator_initialize.fail_on_call = config_->fail_on_call;
+    s_test_config_frame_allocator_initialize.forced_result = config_->forced_result;
+}
+
+void test_frame_allocator_config_reset(void) {
+    test_call_control_reset(&s_test_config_frame_allocator_initialize);
+}
+
+void NO_COVERAGE test_frame_allocator(void) {
+    test_frame_allocator_config_reset();
+
+    test_frame_allocator_preinit();
+    test_frame_allocator_initialize();
+    test_frame_allocator_begin_frame();
+    test_frame_allocator_allocate();
+    test_rslt_to_str();
+
+    test_frame_allocator_config_reset();
+}
+
+static void NO_COVERAGE test_frame_allocator_preinit(void) {
+    {
+        // 引数異常 -> LINEAR_ALLOC_INVALID_ARGUMENT
+        size_t pool_size = 0;
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_preinit(0U, &pool_size));
+        assert(0U == pool_size);
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_preinit(64U, NULL));
+    }
+    {
+        // 正常系: 算出した容量でframe_allocator_initializeが過不足なく成功すること
+        size_t linear_alloc_mem_req = 0;
+        size_t linear_alloc_align_req = 0;
+        size_t pool_size = 0;
+        size_t marker = 0;
+        linear_alloc_t* linear_alloc = NULL;
+        void* pool = NULL;
+        frame_alloc_t* frame_alloc = NULL;
+
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_preinit(24U, &pool_size));
+        assert(0U != pool_size);
+
+        linear_allocator_preinit(&linear_alloc_mem_req, &linear_alloc_align_req);
+        linear_alloc = malloc(linear_alloc_mem_req);
+        assert(NULL != linear_alloc);
+        pool = malloc(pool_size);
+        assert(NULL != pool);
+
+        // 1byte不足 -> LINEAR_ALLOC_NO_MEMORY
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size - 1U, pool));
+        assert(LINEAR_ALLOC_NO_MEMORY == frame_allocator_initialize(24U, linear_alloc, &frame_alloc));
+        assert(NULL == frame_alloc);
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_initialize(24U, linear_alloc, &frame_alloc));
+        assert(NULL != frame_alloc);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(linear_alloc, &marker));
+        assert(pool_size == marker);
+
+        free(pool);
+        free(linear_alloc);
+    }
+}
+
+static void NO_COVERAGE test_frame_allocator_initialize(void) {
+    linear_alloc_t* linear_alloc = NULL;
+    size_t mem_req = 0;
+    size_t align_req = 0;
+    void* pool = NULL;
+    const size_t pool_size = 1024;
+
+    linear_allocator_preinit(&mem_req, &align_req);
+    linear_alloc = (linear_alloc_t*)malloc(mem_req);
+    pool = malloc(pool_size);
+    assert(NULL != linear_alloc);
+    assert(NULL != pool);
+    {
+        // この関数自身の失敗注入が効くこと
+        test_call_control_t config = {0};
+        frame_alloc_t* frame_alloc = NULL;
+
+        test_frame_allocator_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)LINEAR_ALLOC_NO_MEMORY;
+        test_frame_allocator_initialize_config_set(&config);
+
+        assert(LINEAR_ALLOC_NO_MEMORY == frame_allocator_initialize(64U, (linear_alloc_t*)0x1, &frame_alloc));
+        assert(NULL == frame_alloc);
+
+        test_frame_allocator_config_reset();
+    }
+    {
+        // 引数異常 -> LINEAR_ALLOC_INVALID_ARGUMENT
+        frame_alloc_t* frame_alloc = NULL;
+        frame_alloc_t* dummy = (frame_alloc_t*)0x1;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_initialize(0U, linear_alloc, &frame_alloc));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_initialize(64U, NULL, &frame_alloc));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_initialize(64U, linear_alloc, NULL));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_initialize(64U, linear_alloc, &dummy));
+        assert(NULL == frame_alloc);
+        assert((frame_alloc_t*)0x1 == dummy);
+    }
+    {
+        // リニアアロケータの各割り当て、初期化の失敗が伝搬すること
+        for(uint32_t fail_on_call = 1U; fail_on_call <= 5U; ++fail_on_call) {
+            test_call_control_t config = {0};
+            frame_alloc_t* frame_alloc = NULL;
+            assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+
+            test_linear_allocator_config_reset();
+            config.fail_on_call = fail_on_call;
+            config.forced_result = (int)LINEAR_ALLOC_NO_MEMORY;
+            test_linear_allocator_allocate_config_set(&config);
+
+            assert(LINEAR_ALLOC_NO_MEMORY == frame_allocator_initialize(64U, linear_alloc, &frame_alloc));
+            assert(NULL == frame_alloc);
+
+            test_linear_allocator_config_reset();
+        }
+        {
+            test_call_control_t config = {0};
+            frame_alloc_t* frame_alloc = NULL;
+            assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+
+            test_linear_allocator_config_reset();
+            config.fail_on_call = 1U;
+            config.forced_result = (int)LINEAR_ALLOC_INVALID_ARGUMENT;
+            test_linear_allocator_init_config_set(&config);
+
+            assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_initialize(64U, linear_alloc, &frame_alloc));
+            assert(NULL == frame_alloc);
+
+            test_linear_allocator_config_reset();
+        }
+    }
+    {
+        // リニアアロケータの容量不足 -> LINEAR_ALLOC_NO_MEMORY
+        frame_alloc_t* frame_alloc = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+        assert(LINEAR_ALLOC_NO_MEMORY == frame_allocator_initialize(pool_size, linear_alloc, &frame_alloc));
+        assert(NULL == frame_alloc);
+    }
+    {
+        // 正常系
+        frame_alloc_t* frame_alloc = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_initialize(64U, linear_alloc, &frame_alloc));
+        assert(NULL != frame_alloc);
+        assert(64U == frame_alloc->frame_capacity);
+        assert(0U == frame_alloc->current);
+        assert(NULL != frame_alloc->arena[0]);
+        assert(NULL != frame_alloc->arena[1]);
+        assert(frame_alloc->arena[0] != frame_alloc->arena[1]);
+    }
+
+    free(pool);
+    free(linear_alloc);
+}
+
+static void NO_COVERAGE test_frame_allocator_begin_frame(void) {
+    linear_alloc_t* linear_alloc = NULL;
+    size_t mem_req = 0;
+    size_t align_req = 0;
+    void* pool = NULL;
+    const size_t pool_size = 1024;
+    frame_alloc_t* frame_alloc = NULL;
+
+    linear_allocator_preinit(&mem_req, &align_req);
+    linear_alloc = (linear_alloc_t*)malloc(mem_req);
+    pool = malloc(pool_size);
+    assert(NULL != linear_alloc);
+    assert(NULL != pool);
+    assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+    assert(LINEAR_ALLOC_SUCCESS == frame_allocator_initialize(64U, linear_alloc, &frame_alloc));
+    {
+        // frame_alloc_ == NULL -> no-op
+        frame_allocator_begin_frame(NULL);
+    }
+    {
+        // 正常系: バッファが交互に切り替わり、切り替え先はリセットされる
+        void* frame0 = NULL;
+        void* frame1 = NULL;
+        void* frame2 = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_allocate(frame_alloc, 64U, 8U, &frame0));
+
+        frame_allocator_begin_frame(frame_alloc);
+        assert(1U == frame_alloc->current);
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_allocate(frame_alloc, 64U, 8U, &frame1));
+        assert(frame0 != frame1);
+
+        frame_allocator_begin_frame(frame_alloc);
+        assert(0U == frame_alloc->current);
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_allocate(frame_alloc, 64U, 8U, &frame2));
+        assert(frame0 == frame2);
+    }
+
+    free(pool);
+    free(linear_alloc);
+}
+
+static void NO_COVERAGE test_frame_allocator_allocate(void) {
+    linear_alloc_t* linear_alloc = NULL;
+    size_t mem_req = 0;
+    size_t align_req = 0;
+    void* pool = NULL;
+    const size_t pool_size = 1024;
+    frame_alloc_t* frame_alloc = NULL;
+
+    linear_allocator_preinit(&mem_req, &align_req);
+    linear_alloc = (linear_alloc_t*)malloc(mem_req);
+    pool = malloc(pool_size);
+    assert(NULL != linear_alloc);
+    assert(NULL != pool);
+    assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(linear_alloc, pool_size, pool));
+    assert(LINEAR_ALLOC_SUCCESS == frame_allocator_initialize(64U, linear_alloc, &frame_alloc));
+    {
+        // frame_alloc_ == NULL -> LINEAR_ALLOC_INVALID_ARGUMENT
+        void* ptr = NULL;
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == frame_allocator_allocate(NULL, 8U, 8U, &ptr));
+        assert(NULL == ptr);
+    }
+    {
+        // 1フレームの容量を超える -> LINEAR_ALLOC_NO_MEMORY
+        void* ptr1 = NULL;
+        void* ptr2 = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_allocate(frame_alloc, 48U, 8U, &ptr1));
+        assert(NULL != ptr1);
+        assert(LINEAR_ALLOC_NO_MEMORY == frame_allocator_allocate(frame_alloc, 32U, 8U, &ptr2));
+        assert(NULL == ptr2);
+
+        // 次のフレームでは再度割り当て可能
+        frame_allocator_begin_frame(frame_alloc);
+        assert(LINEAR_ALLOC_SUCCESS == frame_allocator_allocate(frame_alloc, 32U, 8U, &ptr2));
+        assert(NULL != ptr2);
+    }
+
+    free(pool);
+    free(linear_alloc);
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    {
+        const char* str = rslt_to_str(LINEAR_ALLOC_SUCCESS);
+        assert(NULL != str);
+        assert(0 == strcmp("SUCCESS", str));
+    }
+    {
+        const char* str = rslt_to_str(LINEAR_ALLOC_NO_MEMORY);
+        assert(NULL != str);
+        assert(0 == strcmp("NO_MEMORY", str));
+    }
+    {
+        const char* str = rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT);
+        assert(NULL != str);
+        assert(0 == strcmp("INVALID_ARGUMENT", str));
+    }
+    {
+        const char* str = rslt_to_str((linear_allocator_result_t)999);
+        assert(NULL != str);
+        assert(0 == strcmp("UNDEFINED_ERROR", str));
+    }
+}
+#endif
@@ -0,0 +1,807 @@
+/** @ingroup core
+ *
+ * @file freelist_allocator.c
+ * @author chocolate-pie24
+ * @brief 個別のメモリ確保、解放に対応するフリーリストアロケータモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset
+
+#include "engine/core/memory/freelist_allocator.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <stdlib.h>
+#include "test_controller.h"
+#include "engine/core/memory/test_freelist_allocator.h"
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_freelist_allocator_init;       /**< freelist_allocator_init()テスト設定 */
+static test_call_control_t s_test_config_freelist_allocator_allocate;   /**< freelist_allocator_allocate()テスト設定 */
+
+// プライベート関数テスト設定
+// 現状ではなし
+
+// 全テスト関数プロトタイプ宣言
+static void test_freelist_allocator_preinit(void);
+static void test_freelist_allocator_init(void);
+static void test_freelist_allocator_allocate(void);
+static void test_freelist_allocator_free(void);
+static void test_freelist_allocator_resize(void);
+static void test_freelist_allocator_owns(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief 空きブロックの先頭に配置されるリストノード
+ *
+ */
+typedef struct freelist_node {
+    size_t size;                    /**< ノードを含む空きブロック全体のサイズ(byte) */
+    struct freelist_node* next;     /**< 次の空きブロック(アドレス昇順) */
+} freelist_node_t;
+
+/**
+ * @brief 割り当て済みブロックで、ユーザー領域の直前に配置されるヘッダ
+ *
+ */
+typedef struct freelist_header {
+    size_t block_size;  /**< ヘッダとパディングを含むブロック全体のサイズ(byte) */
+    size_t padding;     /**< ブロック先頭からユーザー領域先頭までのオフセット(byte) */
+} freelist_header_t;
+
+/**
+ * @brief freelist_alloc_t内部データ構造
+ *
+ */
+struct freelist_alloc {
+    size_t capacity;            /**< アロケータが管理するメモリ容量(アライメント調整後、byte) */
+    size_t free_space;          /**< 空きブロックサイズの総和(byte) */
+    void* memory_pool;          /**< アロケータが管理するメモリ領域(max_align_tにアライメント調整済み) */
+    freelist_node_t* head;      /**< 空きブロックリストの先頭(アドレス昇順) */
+};
+
+/**
+ * @brief ブロックサイズ、ブロック先頭アドレスのアライメント単位
+ *
+ */
+#define FREELIST_BLOCK_ALIGN ((uintptr_t)alignof(max_align_t))
+
+/**
+ * @brief 分割して空きブロックとして成立する最小サイズ
+ *
+ */
+#define FREELIST_MIN_BLOCK_SIZE (((uintptr_t)sizeof(freelist_node_t) + FREELIST_BLOCK_ALIGN - 1) & ~(FREELIST_BLOCK_ALIGN - 1))
+
+static const char* const s_rslt_str_success = "SUCCESS";                     /**< 実行結果種別文字列(処理成功) */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                 /**< 実行結果種別文字列(メモリ確保失敗) */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";   /**< 実行結果種別文字列(無効な引数) */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";     /**< 実行結果種別文字列(不明なエラー) */
+
+static const char* rslt_to_str(freelist_allocator_result_t rslt_);
+static uintptr_t align_up(uintptr_t value_, uintptr_t align_);
+static bool block_get(const freelist_alloc_t* allocator_, const void* ptr_, uintptr_t* out_block_start_, uintptr_t* out_block_size_);
+
+void freelist_allocator_preinit(size_t* memory_requirement_, size_t* align_requirement_) {
+    if(NULL == memory_requirement_ || NULL == align_requirement_) {
+        return;
+    }
+    *memory_requirement_ = sizeof(freelist_alloc_t);
+    *align_requirement_ = alignof(freelist_alloc_t);
+}
+
+freelist_allocator_result_t freelist_allocator_init(freelist_alloc_t* allocator_, size_t capacity_, void* memory_pool_) {
+#ifdef TEST_BUILD
+    s_test_config_freelist_allocator_init.call_count++;
+    if(s_test_config_freelist_allocator_init.fail_on_call != 0) {
+        if(s_test_config_freelist_allocator_init.call_count == s_test_config_freelist_allocator_init.fail_on_call) {
+            return (freelist_allocator_result_t)s_test_config_freelist_allocator_init.forced_result;
+        }
+    }
+#endif
+    freelist_allocator_result_t ret = FREELIST_ALLOC_INVALID_ARGUMENT;
+    uintptr_t pool = 0;
+    uintptr_t start = 0;
+    uintptr_t usable = 0;
+    freelist_node_t* node = NULL;
+
+    // Preconditions
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_init", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(memory_pool_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_init", "memory_pool_")
+
+    // Simulation
+    pool = (uintptr_t)memory_pool_;
+    start = align_up(pool, FREELIST_BLOCK_ALIGN);
+    if((uintptr_t)capacity_ < (start - pool)) {
+        ret = FREELIST_ALLOC_INVALID_ARGUMENT;
+        ERROR_MESSAGE("freelist_allocator_init(%s) - Provided capacity_ is smaller than the alignment adjustment.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    usable = ((uintptr_t)capacity_ - (start - pool)) & ~(FREELIST_BLOCK_ALIGN - 1);
+    IF_ARG_FALSE_GOTO_CLEANUP(usable >= FREELIST_MIN_BLOCK_SIZE, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_init", "capacity_")
+
+    // commit
+    node = (freelist_node_t*)start;
+    node->size = (size_t)usable;
+    node->next = NULL;
+
+    allocator_->capacity = (size_t)usable;
+    allocator_->free_space = (size_t)usable;
+    allocator_->memory_pool = (void*)start;
+    allocator_->head = node;
+
+    ret = FREELIST_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+freelist_allocator_result_t freelist_allocator_allocate(freelist_alloc_t* allocator_, size_t req_size_, size_t req_align_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    s_test_config_freelist_allocator_allocate.call_count++;
+    if(s_test_config_freelist_allocator_allocate.fail_on_call != 0) {
+        if(s_test_config_freelist_allocator_allocate.call_count == s_test_config_freelist_allocator_allocate.fail_on_call) {
+            return (freelist_allocator_result_t)s_test_config_freelist_allocator_allocate.forced_result;
+        }
+    }
+#endif
+    freelist_allocator_result_t ret = FREELIST_ALLOC_INVALID_ARGUMENT;
+    freelist_node_t* prev = NULL;
+    freelist_node_t* node = NULL;
+    freelist_node_t* link = NULL;
+    freelist_header_t* header = NULL;
+    uintptr_t align = 0;
+    uintptr_t block_start = 0;
+    uintptr_t user = 0;
+    uintptr_t padding = 0;
+    uintptr_t required = 0;
+
+    // Preconditions
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_allocate", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_allocate", "out_ptr_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_ptr_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_allocate", "*out_ptr_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != req_size_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_allocate", "req_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(req_align_), ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_allocate", "req_align_")
+
+    // プール容量を超える要求はリストを走査するまでもなく失敗(以降の計算のオーバーフロー防止も兼ねる)
+    if(req_size_ > allocator_->free_space || req_align_ > allocator_->capacity) {
+        ret = FREELIST_ALLOC_NO_MEMORY;
+        goto cleanup;
+    }
+
+    // Simulation
+    align = (req_align_ < FREELIST_BLOCK_ALIGN) ? FREELIST_BLOCK_ALIGN : (uintptr_t)req_align_;
+    for(node = allocator_->head; NULL != node; prev = node, node = node->next) {
+        block_start = (uintptr_t)node;
+        user = align_up(block_start + sizeof(freelist_header_t), align);
+        padding = user - block_start;
+        required = align_up(padding + (uintptr_t)req_size_, FREELIST_BLOCK_ALIGN);
+        if((uintptr_t)node->size >= required) {
+            break;
+        }
+    }
+    if(NULL == node) {
+        ret = FREELIST_ALLOC_NO_MEMORY;
+        goto cleanup;
+    }
+
+    // commit
+    if(((uintptr_t)node->size - required) >= FREELIST_MIN_BLOCK_SIZE) {
+        link = (freelist_node_t*)(block_start + required);
+        link->size = node->size - (size_t)required;
+        link->next = node->next;
+    } else {
+        required = (uintptr_t)node->size;   // 残りが小さすぎる場合はブロック全体を割り当てる
+        link = node->next;
+    }
+    if(NULL == prev) {
+        allocator_->head = link;
+    } else {
+        prev->next = link;
+    }
+
+    header = (freelist_header_t*)(user - sizeof(freelist_header_t));
+    header->block_size = (size_t)required;
+    header->padding = (size_t)padding;
+    allocator_->free_space -= (size_t)required;
+    *out_ptr_ = (void*)user;
+
+    ret = FREELIST_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void freelist_allocator_free(freelist_alloc_t* allocator_, void* ptr_) {
+    freelist_node_t* prev = NULL;
+    freelist_node_t* node = NULL;
+    freelist_node_t* block = NULL;
+    uintptr_t block_start = 0;
+    uintptr_t block_size = 0;
+
+    if(NULL == allocator_ || NULL == ptr_) {
+        WARN_MESSAGE("freelist_allocator_free - No-op: 'allocator_' and 'ptr_' must not be NULL.");
+        goto cleanup;
+    }
+    if(!freelist_allocator_owns(allocator_, ptr_)) {
+        WARN_MESSAGE("freelist_allocator_free - No-op: 'ptr_' is not owned by this allocator.");
+        goto cleanup;
+    }
+
+    if(!block_get(allocator_, ptr_, &block_start, &block_size)) {
+        WARN_MESSAGE("freelist_allocator_free - No-op: 'ptr_' is not a block address or block header is corrupted.");
+        goto cleanup;
+    }
+
+    // アドレス昇順で挿入位置を探す
+    for(node = allocator_->head; NULL != node && (uintptr_t)node < block_start; node = node->next) {
+        prev = node;
+    }
+    if((NULL != node && (block_start + block_size) > (uintptr_t)node) || (NULL != prev && ((uintptr_t)prev + prev->size) > block_start)) {
+        WARN_MESSAGE("freelist_allocator_free - No-op: block overlaps a free block (double free?).");
+        goto cleanup;
+    }
+
+    block = (freelist_node_t*)block_start;
+    block->size = (size_t)block_size;
+    block->next = node;
+    allocator_->free_space += (size_t)block_size;
+
+    // 後方の空きブロックと結合
+    if(NULL != node && (block_start + block_size) == (uintptr_t)node) {
+        block->size += node->size;
+        block->next = node->next;
+    }
+    // 前方の空きブロックと結合
+    if(NULL == prev) {
+        allocator_->head = block;
+    } else if(((uintptr_t)prev + prev->size) == block_start) {
+        prev->size += block->size;
+        prev->next = block->next;
+    } else {
+        prev->next = block;
+    }
+
+cleanup:
+    return;
+}
+
+freelist_allocator_result_t freelist_allocator_resize(freelist_alloc_t* allocator_, void* ptr_, size_t new_size_) {
+    freelist_allocator_result_t ret = FREELIST_ALLOC_INVALID_ARGUMENT;
+    freelist_header_t* header = NULL;
+    freelist_node_t* prev = NULL;
+    freelist_node_t* node = NULL;
+    freelist_node_t* link = NULL;
+    uintptr_t block_start = 0;
+    uintptr_t block_size = 0;
+    uintptr_t required = 0;
+
+    // Preconditions
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_resize", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(ptr_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_resize", "ptr_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != new_size_, ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_resize", "new_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(freelist_allocator_owns(allocator_, ptr_), ret, FREELIST_ALLOC_INVALID_ARGUMENT, rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT), "freelist_allocator_resize", "ptr_")
+    if(!block_get(allocator_, ptr_, &block_start, &block_size)) {
+        ret = FREELIST_ALLOC_INVALID_ARGUMENT;
+        ERROR_MESSAGE("freelist_allocator_resize(%s) - 'ptr_' is not a block address or block header is corrupted.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    if(new_size_ > allocator_->capacity) {
+        ret = FREELIST_ALLOC_NO_MEMORY;
+        goto cleanup;
+    }
+
+    // Simulation
+    header = (freelist_header_t*)((uintptr_t)ptr_ - sizeof(freelist_header_t));
+    required = align_up((uintptr_t)header->padding + (uintptr_t)new_size_, FREELIST_BLOCK_ALIGN);
+    for(node = allocator_->head; NULL != node && (uintptr_t)node < block_start; node = node->next) {
+        prev = node;
+    }
+
+    // commit
+    if(required <= block_size) {
+        // 縮小: 末尾の余りが空きブロックとして成立する場合のみ切り離す(後方の空きブロックとは結合する)
+        if((block_size - required) >= FREELIST_MIN_BLOCK_SIZE) {
+            link = (freelist_node_t*)(block_start + required);
+            link->size = (size_t)(block_size - required);
+            link->next = node;
+            if(NULL != node && (block_start + block_size) == (uintptr_t)node) {
+                link->size += node->size;
+                link->next = node->next;
+            }
+            if(NULL == prev) {
+                allocator_->head = link;
+            } else {
+                prev->next = link;
+            }
+            allocator_->free_space += (size_t)(block_size - required);
+            header->block_size = (size_t)required;
+        }
+    } else {
+        // 拡張: 直後に隣接する空きブロックを取り込めない場合は失敗
+        if(NULL == node || (block_start + block_size) != (uintptr_t)node || (block_size + (uintptr_t)node->size) < required) {
+            ret = FREELIST_ALLOC_NO_MEMORY;
+            goto cleanup;
+        }
+        if((block_size + (uintptr_t)node->size - required) >= FREELIST_MIN_BLOCK_SIZE) {
+            link = (freelist_node_t*)(block_start + required);
+            link->size = (size_t)(block_size + (uintptr_t)node->size - required);
+            link->next = node->next;
+        } else {
+            required = block_size + (uintptr_t)node->size;  // 残りが小さすぎる場合は空きブロック全体を取り込む
+            link = node->next;
+        }
+        if(NULL == prev) {
+            allocator_->head = link;
+        } else {
+            prev->next = link;
+        }
+        allocator_->free_space -= (size_t)(required - block_size);
+        header->block_size = (size_t)required;
+    }
+
+    ret = FREELIST_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+bool freelist_allocator_owns(const freelist_alloc_t* allocator_, const void* ptr_) {
+    uintptr_t pool = 0;
+    uintptr_t ptr = 0;
+
+    if(NULL == allocator_ || NULL == ptr_ || NULL == allocator_->memory_pool) {
+        return false;
+    }
+    pool = (uintptr_t)allocator_->memory_pool;
+    ptr = (uintptr_t)ptr_;
+    return (ptr >= pool && (ptr - pool) < (uintptr_t)allocator_->capacity) ? true : false;
+}
+
+size_t freelist_allocator_free_space(const freelist_alloc_t* allocator_) {
+    if(NULL == allocator_) {
+        return 0;
+    }
+    return allocator_->free_space;
+}
+
+/**
+ * @brief 実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 文字列に変換する実行結果コード
+ * @return const char* 変換された文字列の先頭アドレス
+ */
+static const char* rslt_to_str(freelist_allocator_result_t rslt_) {
+    switch(rslt_) {
+    case FREELIST_ALLOC_SUCCESS:
+        return s_rslt_str_success;
+    case FREELIST_ALLOC_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case FREELIST_ALLOC_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+/**
+ * @brief 割り当て済みブロックのユーザー領域アドレスptr_から、ブロック先頭アドレスとブロックサイズを取得する
+ *
+ * @note ptr_はallocator_の管理するメモリプール内のアドレスであること(freelist_allocator_ownsで確認済み)
+ *
+ * @param[in] allocator_ freelist_alloc_t型構造体インスタンスへのポインタ
+ * @param[in] ptr_ ユーザー領域アドレス
+ * @param[out] out_block_start_ ブロック先頭アドレス格納先
+ * @param[out] out_block_size_ ブロックサイズ格納先
+ *
+ * @retval true  取得に成功
+ * @retval false ptr_がブロックのアドレスではない、またはブロックヘッダが破損している
+ */
+static bool block_get(const freelist_alloc_t* allocator_, const void* ptr_, uintptr_t* out_block_start_, uintptr_t* out_block_size_) {
+    const uintptr_t pool = (uintptr_t)allocator_->memory_pool;
+    const uintptr_t pool_end = pool + allocator_->capacity;
+    const uintptr_t user = (uintptr_t)ptr_;
+    const freelist_header_t* header = NULL;
+    uintptr_t block_start = 0;
+    uintptr_t block_size = 0;
+
+    if((user - pool) < sizeof(freelist_header_t)) {
+        return false;
+    }
+    header = (const freelist_header_t*)(user - sizeof(freelist_header_t));
+    block_size = (uintptr_t)header->block_size;
+    if(header->padding < sizeof(freelist_header_t) || (uintptr_t)header->padding > (user - pool) || block_size <= (uintptr_t)header->padding) {
+        return false;
+    }
+    block_start = user - (uintptr_t)header->padding;
+    if(0 != (block_size % FREELIST_BLOCK_ALIGN) || block_size > (pool_end - block_start)) {
+        return false;
+    }
+    *out_block_start_ = block_start;
+    *out_block_size_ = block_size;
+    return true;
+}
+
+/**
+ * @brief value_をalign_の倍数に切り上げる
+ *
+ * @param[in] value_ 切り上げ対象値
+ * @param[in] align_ アライメント(2の冪乗であること)
+ * @return uintptr_t 切り上げ後の値
+ */
+static uintptr_t align_up(uintptr_t value_, uintptr_t align_) {
+    return (value_ + (align_ - 1)) & ~(align_ - 1);
+}
+
+#ifdef TEST_BUILD
+void test_freelist_allocator_init_config_set(const test_call_control_t* config_) {
+    s_test_config_freelist_allocator_init.fail_on_call = config_->fail_on_call;
+    s_test_config_freelist_allocator_init.forced_result = config_->forced_result;
+}
+
+void test_freelist_allocator_allocate_config_set(const test_call_control_t* config_) {
+    s_test_config_freelist_allocator_allocate.fail_on_call = config_->fail_on_call;
+    s_test_config_freelist_allocator_allocate.forced_result = config_->forced_result;
+}
+
+void test_freelist_allocator_config_reset(void) {
+    test_call_control_reset(&s_test_config_freelist_allocator_init);
+    test_call_control_reset(&s_test_config_freelist_allocator_allocate);
+}
+
+void NO_COVERAGE test_freelist_allocator(void) {
+    test_freelist_allocator_config_reset();
+
+    test_freelist_allocator_preinit();
+    test_freelist_allocator_init();
+    test_freelist_allocator_allocate();
+    test_freelist_allocator_free();
+    test_freelist_allocator_resize();
+    test_freelist_allocator_owns();
+    test_rslt_to_str();
+
+    test_freelist_allocator_config_reset();
+}
+
+static void NO_COVERAGE test_freelist_allocator_preinit(void) {
+    {
+        // いずれかがNULLの場合は何もしない
+        size_t mem = 1234U;
+        size_t align = 5678U;
+        freelist_allocator_preinit(&mem, NULL);
+        assert(1234U == mem);
+        freelist_allocator_preinit(NULL, &align);
+        assert(5678U == align);
+        freelist_allocator_preinit(NULL, NULL);
+    }
+    {
+        // 正常系
+        size_t mem = 0U;
+        size_t align = 0U;
+        freelist_allocator_preinit(&mem, &align);
+        assert(sizeof(freelist_alloc_t) == mem);
+        assert(alignof(freelist_alloc_t) == align);
+    }
+}
+
+static void NO_COVERAGE test_freelist_allocator_init(void) {
+    freelist_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[256];
+    {
+        // テスト基盤による強制失敗
+        test_call_control_t config = {0};
+        memset(&alloc, 0, sizeof(alloc));
+
+        test_freelist_allocator_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)FREELIST_ALLOC_NO_MEMORY;
+        test_freelist_allocator_init_config_set(&config);
+
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(NULL == alloc.memory_pool);
+
+        test_freelist_allocator_config_reset();
+    }
+    {
+        // 引数異常 -> FREELIST_ALLOC_INVALID_ARGUMENT
+        memset(&alloc, 0, sizeof(alloc));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_init(NULL, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_init(&alloc, sizeof(pool), NULL));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_init(&alloc, 0U, pool));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_init(&alloc, (size_t)FREELIST_MIN_BLOCK_SIZE - 1U, pool));
+        // アライメント調整量より容量が小さい
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_init(&alloc, 0U, pool + 1));
+        assert(NULL == alloc.memory_pool);
+    }
+    {
+        // 正常系
+        memset(&alloc, 0, sizeof(alloc));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert((void*)pool == alloc.memory_pool);
+        assert(sizeof(pool) == alloc.capacity);
+        assert(sizeof(pool) == alloc.free_space);
+        assert((void*)pool == (void*)alloc.head);
+        assert(sizeof(pool) == alloc.head->size);
+        assert(NULL == alloc.head->next);
+    }
+    {
+        // 正常系: 非アライメントのプール先頭は調整され、容量から差し引かれる
+        memset(&alloc, 0, sizeof(alloc));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool) - 1U, pool + 1));
+        assert((void*)(pool + FREELIST_BLOCK_ALIGN) == alloc.memory_pool);
+        assert((sizeof(pool) - FREELIST_BLOCK_ALIGN) == alloc.capacity);
+    }
+}
+
+static void NO_COVERAGE test_freelist_allocator_allocate(void) {
+    freelist_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[512];
+    {
+        // テスト基盤による強制失敗
+        test_call_control_t config = {0};
+        void* ptr = NULL;
+
+        test_freelist_allocator_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)FREELIST_ALLOC_NO_MEMORY;
+        test_freelist_allocator_allocate_config_set(&config);
+
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_allocate(NULL, 16U, 8U, &ptr));
+        assert(NULL == ptr);
+
+        test_freelist_allocator_config_reset();
+    }
+    {
+        // 引数異常 -> FREELIST_ALLOC_INVALID_ARGUMENT
+        void* ptr = NULL;
+        void* dummy = pool;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_allocate(NULL, 16U, 8U, &ptr));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_allocate(&alloc, 16U, 8U, NULL));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_allocate(&alloc, 16U, 8U, &dummy));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_allocate(&alloc, 0U, 8U, &ptr));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_allocate(&alloc, 16U, 0U, &ptr));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_allocate(&alloc, 16U, 24U, &ptr));
+        assert(NULL == ptr);
+        assert(sizeof(pool) == alloc.free_space);
+    }
+    {
+        // 容量不足 -> FREELIST_ALLOC_NO_MEMORY
+        void* ptr = NULL;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_allocate(&alloc, sizeof(pool) + 1U, 8U, &ptr));
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_allocate(&alloc, sizeof(pool), 8U, &ptr));   // ヘッダ分が入らない
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_allocate(&alloc, 8U, 1024U, &ptr));
+        assert(NULL == ptr);
+        assert(sizeof(pool) == alloc.free_space);
+    }
+    {
+        // 正常系: 分割、アライメント、プール全体の使い切り
+        void* p1 = NULL;
+        void* p2 = NULL;
+        void* p3 = NULL;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 10U, 1U, &p1));
+        assert(NULL != p1);
+        assert(0U == ((uintptr_t)p1 % alignof(max_align_t)));
+        assert(freelist_allocator_owns(&alloc, p1));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 40U, 64U, &p2));
+        assert(0U == ((uintptr_t)p2 % 64U));
+        assert((uintptr_t)p2 > (uintptr_t)p1 + 10U);
+        memset(p1, 0xAA, 10U);
+        memset(p2, 0xBB, 40U);
+
+        // 残り全てを確保
+        size_t remain = alloc.free_space - sizeof(freelist_header_t);
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, remain, 8U, &p3));
+        assert(0U == alloc.free_space);
+        assert(NULL == alloc.head);
+
+        freelist_allocator_free(&alloc, p1);
+        freelist_allocator_free(&alloc, p2);
+        freelist_allocator_free(&alloc, p3);
+        assert(sizeof(pool) == alloc.free_space);
+        assert((void*)pool == (void*)alloc.head);
+        assert(sizeof(pool) == alloc.head->size);
+    }
+    {
+        // 正常系: 残りが最小ブロック未満の場合はブロック全体を割り当てる
+        void* p1 = NULL;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, sizeof(pool) - sizeof(freelist_header_t) - 1U, 8U, &p1));
+        assert(0U == alloc.free_space);
+        assert(NULL == alloc.head);
+        freelist_allocator_free(&alloc, p1);
+        assert(sizeof(pool) == alloc.free_space);
+    }
+}
+
+static void NO_COVERAGE test_freelist_allocator_free(void) {
+    freelist_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[1024];
+    {
+        // NULL、プール外、ヘッダ破損、2重解放はno-op
+        void* p1 = NULL;
+        unsigned char outside[32];
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p1));
+        size_t free_space = alloc.free_space;
+
+        freelist_allocator_free(NULL, p1);
+        freelist_allocator_free(&alloc, NULL);
+        freelist_allocator_free(&alloc, outside);
+        freelist_allocator_free(&alloc, pool);
+        assert(free_space == alloc.free_space);
+
+        freelist_header_t* header = (freelist_header_t*)((uintptr_t)p1 - sizeof(freelist_header_t));
+        const size_t saved_padding = header->padding;
+        header->padding = 0U;
+        freelist_allocator_free(&alloc, p1);
+        assert(free_space == alloc.free_space);
+        header->padding = saved_padding;
+
+        const size_t saved_size = header->block_size;
+        header->block_size = saved_size + 1U;
+        freelist_allocator_free(&alloc, p1);
+        assert(free_space == alloc.free_space);
+        header->block_size = saved_size;
+
+        freelist_allocator_free(&alloc, p1);
+        assert(sizeof(pool) == alloc.free_space);
+        freelist_allocator_free(&alloc, p1);    // 2重解放
+        assert(sizeof(pool) == alloc.free_space);
+        assert(NULL == alloc.head->next);
+    }
+    {
+        // 結合: 前方、後方、両側
+        void* p[4] = { NULL, NULL, NULL, NULL };
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        for(size_t i = 0; i != 4; ++i) {
+            assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 48U, 8U, &p[i]));
+        }
+        // 空き: [tail]
+        freelist_allocator_free(&alloc, p[1]);  // 空き: [1][tail]
+        assert((void*)((uintptr_t)p[1] - sizeof(freelist_header_t)) == (void*)alloc.head);
+        freelist_allocator_free(&alloc, p[0]);  // 後方結合 -> [0-1][tail]
+        assert((void*)pool == (void*)alloc.head);
+        assert(NULL != alloc.head->next);
+        freelist_allocator_free(&alloc, p[3]);  // 後方(tail)結合 -> [0-1][3-tail]
+        assert(NULL != alloc.head->next);
+        assert(NULL == alloc.head->next->next);
+        freelist_allocator_free(&alloc, p[2]);  // 両側結合 -> [all]
+        assert((void*)pool == (void*)alloc.head);
+        assert(sizeof(pool) == alloc.head->size);
+        assert(NULL == alloc.head->next);
+        assert(sizeof(pool) == freelist_allocator_free_space(&alloc));
+    }
+    {
+        // 解放済み領域の再利用(first-fit)
+        void* p1 = NULL;
+        void* p2 = NULL;
+        void* p3 = NULL;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 64U, 8U, &p1));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 64U, 8U, &p2));
+        freelist_allocator_free(&alloc, p1);
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p3));
+        assert(p1 == p3);
+        freelist_allocator_free(&alloc, p2);
+        freelist_allocator_free(&alloc, p3);
+        assert(sizeof(pool) == alloc.free_space);
+    }
+    assert(0U == freelist_allocator_free_space(NULL));
+}
+
+static void NO_COVERAGE test_freelist_allocator_resize(void) {
+    freelist_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[1024];
+    {
+        // 引数異常 -> FREELIST_ALLOC_INVALID_ARGUMENT
+        void* p1 = NULL;
+        unsigned char outside[32];
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p1));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_resize(NULL, p1, 64U));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_resize(&alloc, NULL, 64U));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_resize(&alloc, p1, 0U));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_resize(&alloc, outside, 64U));
+        assert(FREELIST_ALLOC_INVALID_ARGUMENT == freelist_allocator_resize(&alloc, pool, 64U));
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_resize(&alloc, p1, sizeof(pool) + 1U));
+    }
+    {
+        // 拡張: 直後の空きブロックを取り込む、縮小: 末尾を空きブロックとして返却し後方と結合
+        void* p1 = NULL;
+        size_t free_space = 0;
+        size_t block_size = 0;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p1));
+        memset(p1, 0xAB, 32U);
+        free_space = alloc.free_space;
+        block_size = ((freelist_header_t*)((uintptr_t)p1 - sizeof(freelist_header_t)))->block_size;
+
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_resize(&alloc, p1, 256U));
+        assert(0xAB == ((unsigned char*)p1)[31]);
+        assert(alloc.free_space < free_space);
+        assert((uintptr_t)alloc.head >= (uintptr_t)p1 + 256U);
+
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_resize(&alloc, p1, 32U));
+        assert(free_space == alloc.free_space);
+        assert(block_size == ((freelist_header_t*)((uintptr_t)p1 - sizeof(freelist_header_t)))->block_size);
+        assert(NULL == alloc.head->next);
+
+        // 同一ブロックに収まるサイズ変更は何もしない
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_resize(&alloc, p1, 30U));
+        assert(free_space == alloc.free_space);
+
+        // 空きブロック全体を取り込む
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_resize(&alloc, p1, sizeof(pool) - sizeof(freelist_header_t) - 1U));
+        assert(0U == alloc.free_space);
+        assert(NULL == alloc.head);
+        freelist_allocator_free(&alloc, p1);
+        assert(sizeof(pool) == alloc.free_space);
+    }
+    {
+        // 直後が割り当て済み -> FREELIST_ALLOC_NO_MEMORY(状態は不変)、直後の空きが不足 -> FREELIST_ALLOC_NO_MEMORY
+        void* p1 = NULL;
+        void* p2 = NULL;
+        void* p3 = NULL;
+        size_t free_space = 0;
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p1));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p2));
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_allocate(&alloc, 32U, 8U, &p3));
+        free_space = alloc.free_space;
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_resize(&alloc, p1, 64U));
+        assert(free_space == alloc.free_space);
+
+        freelist_allocator_free(&alloc, p2);
+        free_space = alloc.free_space;
+        assert(FREELIST_ALLOC_NO_MEMORY == freelist_allocator_resize(&alloc, p1, 256U));
+        assert(free_space == alloc.free_space);
+        assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_resize(&alloc, p1, 64U));
+
+        freelist_allocator_free(&alloc, p1);
+        freelist_allocator_free(&alloc, p3);
+        assert(sizeof(pool) == alloc.free_space);
+        assert(NULL == alloc.head->next);
+    }
+}
+
+static void NO_COVERAGE test_freelist_allocator_owns(void) {
+    freelist_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[128];
+    assert(FREELIST_ALLOC_SUCCESS == freelist_allocator_init(&alloc, sizeof(pool), pool));
+    assert(!freelist_allocator_owns(NULL, pool));
+    assert(!freelist_allocator_owns(&alloc, NULL));
+    assert(freelist_allocator_owns(&alloc, pool));
+    assert(freelist_allocator_owns(&alloc, pool + sizeof(pool) - 1U));
+    assert(!freelist_allocator_owns(&alloc, pool + sizeof(pool)));
+    assert(!freelist_allocator_owns(&alloc, &alloc));
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(0 == strcmp("SUCCESS", rslt_to_str(FREELIST_ALLOC_SUCCESS)));
+    assert(0 == strcmp("NO_MEMORY", rslt_to_str(FREELIST_ALLOC_NO_MEMORY)));
+    assert(0 == strcmp("INVALID_ARGUMENT", rslt_to_str(FREELIST_ALLOC_INVALID_ARGUMENT)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str((freelist_allocator_result_t)100)));
+}
+#endif
@@ -21,6 +21,7 @@
 #include <string.h> // for memset
 
 #include "engine/core/memory/linear_allocator.h"
+#include "engine/core/memory/virtual_arena.h"
 
 #include "engine/base/choco_macros.h"
 #include "engine/base/choco_message.h"
@@ -32,6 +33,7 @@
 #include <assert.h>
 #include "test_controller.h"
 #include "engine/core/memory/test_linear_allocator.h"
+#include "engine/core/memory/test_virtual_arena.h"
 
 // 外部公開APIテスト設定
 static test_call_control_t s_test_config_linear_allocator_init;         /**< linear_allocator_init()テスト設定 */
@@ -43,7 +45,12 @@ static test_call_control_t s_test_config_linear_allocator_allocate;     /**< lin
 // 全テスト関数プロトタイプ宣言
 static void test_linear_allocator_preinit(void);
 static void test_linear_allocator_init(void);
+static void test_linear_allocator_init_virtual(void);
 static void test_linear_allocator_allocate(void);
+static void test_linear_allocator_requirement_add(void);
+static void test_linear_allocator_reset(void);
+static void test_linear_allocator_marker_get(void);
+static void test_linear_allocator_rewind(void);
 static void test_rslt_to_str(void);
 #endif
 
@@ -55,6 +62,7 @@ struct linear_alloc {
     size_t capacity;    /**< アロケータが管理するメモリ容量(byte) */
     void* head_ptr;     /**< 次にメモリを確保する際の先頭アドレス(実際にはアライメント要件分オフセットされたアドレスを渡す) */
     void* memory_pool;  /**< アロケータが管理するメモリ領域 */
+    virtual_arena_t* backend;   /**< メモリ領域の仮想メモリアリーナ(NULLの場合はコミット済みのメモリプールを使用) */
 };
 
 static const char* const s_rslt_str_success = "SUCCESS";                     /**< 実行結果種別文字列(処理成功) */
@@ -90,6 +98,27 @@ linear_allocator_result_t linear_allocator_init(linear_alloc_t* allocator_, size
     allocator_->capacity = capacity_;
     allocator_->head_ptr = memory_pool_;
     allocator_->memory_pool = memory_pool_;
+    allocator_->backend = NULL;
+
+    ret = LINEAR_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+linear_allocator_result_t linear_allocator_init_virtual(linear_alloc_t* allocator_, virtual_arena_t* arena_) {
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+    void* base = NULL;
+
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_init_virtual", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(arena_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_init_virtual", "arena_")
+    base = virtual_arena_base_get(arena_);
+    IF_ARG_NULL_GOTO_CLEANUP(base, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_init_virtual", "arena_")
+
+    allocator_->capacity = virtual_arena_reserved_size_get(arena_);
+    allocator_->head_ptr = base;
+    allocator_->memory_pool = base;
+    allocator_->backend = arena_;
 
     ret = LINEAR_ALLOC_SUCCESS;
 
@@ -154,6 +183,15 @@ linear_allocator_result_t linear_allocator_allocate(linear_alloc_t* allocator_,
         goto cleanup;
     }
 
+    if(NULL != allocator_->backend) {
+        // 仮想メモリアリーナ使用時は、割り当て範囲の末尾までコミットする(先頭アドレスは変化しない)
+        if(VIRTUAL_ARENA_SUCCESS != virtual_arena_commit(allocator_->backend, (size_t)(start_addr + size - pool))) {
+            ret = LINEAR_ALLOC_NO_MEMORY;
+            ERROR_MESSAGE("linear_allocator_allocate(%s) - Failed to commit virtual memory. Requested size: %zu", rslt_to_str(ret), req_size_);
+            goto cleanup;
+        }
+    }
+
     // commit
     *out_ptr_ = (void*)start_addr;
     head += offset + size;
@@ -165,6 +203,83 @@ cleanup:
     return ret;
 }
 
+linear_allocator_result_t linear_allocator_requirement_add(size_t req_size_, size_t req_align_, size_t* io_pool_size_) {
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+    size_t offset = 0;
+    size_t total = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_size_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_requirement_add", "io_pool_size_")
+    if(0 == req_align_ || 0 == req_size_) {
+        ret = LINEAR_ALLOC_SUCCESS;
+        goto cleanup;
+    }
+    IF_ARG_FALSE_GOTO_CLEANUP(IS_POWER_OF_TWO(req_align_), ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_requirement_add", "req_align_")
+
+    // メモリプール先頭はmax_align_tでアラインされているため、オフセットのみでアライメント調整分を算出可能
+    total = *io_pool_size_;
+    offset = total % req_align_;
+    if(0 != offset) {
+        offset = req_align_ - offset;
+    }
+    if(req_align_ > alignof(max_align_t)) {
+        offset += req_align_ - alignof(max_align_t);    // メモリプール先頭アドレス次第で必要となる最悪ケースの調整分
+    }
+    if(SIZE_MAX - offset < total || SIZE_MAX - offset - total < req_size_) {
+        ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+        ERROR_MESSAGE("linear_allocator_requirement_add(%s) - Pool size requirement overflow.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    *io_pool_size_ = total + offset + req_size_;
+
+    ret = LINEAR_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void linear_allocator_reset(linear_alloc_t* allocator_) {
+    if(NULL == allocator_) {
+        WARN_MESSAGE("linear_allocator_reset - No-op: 'allocator_' must not be NULL.");
+        return;
+    }
+    allocator_->head_ptr = allocator_->memory_pool;
+}
+
+linear_allocator_result_t linear_allocator_marker_get(const linear_alloc_t* allocator_, size_t* out_marker_) {
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_marker_get", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_marker_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_marker_get", "out_marker_")
+
+    *out_marker_ = (size_t)((uintptr_t)allocator_->head_ptr - (uintptr_t)allocator_->memory_pool);
+
+    ret = LINEAR_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+linear_allocator_result_t linear_allocator_rewind(linear_alloc_t* allocator_, size_t marker_) {
+    linear_allocator_result_t ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+    uintptr_t used = 0;
+
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, LINEAR_ALLOC_INVALID_ARGUMENT, rslt_to_str(LINEAR_ALLOC_INVALID_ARGUMENT), "linear_allocator_rewind", "allocator_")
+    used = (uintptr_t)allocator_->head_ptr - (uintptr_t)allocator_->memory_pool;
+    if((uintptr_t)marker_ > used) {
+        ret = LINEAR_ALLOC_INVALID_ARGUMENT;
+        ERROR_MESSAGE("linear_allocator_rewind(%s) - Marker is ahead of the current head. Marker: %zu / Used: %zu", rslt_to_str(ret), marker_, (size_t)used);
+        goto cleanup;
+    }
+
+    allocator_->head_ptr = (void*)((uintptr_t)allocator_->memory_pool + (uintptr_t)marker_);
+
+    ret = LINEAR_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
 /**
  * @brief 実行結果コードを文字列に変換する
  *
@@ -205,7 +320,12 @@ void NO_COVERAGE test_linear_allocator(void) {
 
     test_linear_allocator_preinit();
     test_linear_allocator_init();
+    test_linear_allocator_init_virtual();
     test_linear_allocator_allocate();
+    test_linear_allocator_requirement_add();
+    test_linear_allocator_reset();
+    test_linear_allocator_marker_get();
+    test_linear_allocator_rewind();
     test_rslt_to_str();
 
     test_linear_allocator_config_reset();
@@ -381,6 +501,85 @@ static void NO_COVERAGE test_linear_allocator_init(void) {
 }
 
 // Generated by ChatGPT 5.4 Thinking
+static void NO_COVERAGE test_linear_allocator_init_virtual(void) {
+    {
+        // 引数異常 -> LINEAR_ALLOC_INVALID_ARGUMENT
+        linear_alloc_t alloc;
+        virtual_arena_t* arena = NULL;
+        size_t arena_mem_req = 0;
+        size_t arena_align_req = 0;
+        virtual_arena_preinit(&arena_mem_req, &arena_align_req);
+        arena = malloc(arena_mem_req);
+        assert(NULL != arena);
+        memset(arena, 0, arena_mem_req);
+
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_init_virtual(NULL, arena));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_init_virtual(&alloc, NULL));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_init_virtual(&alloc, arena)); // 未予約
+
+        free(arena);
+    }
+    {
+        // 正常系: 割り当てに合わせてコミットされ、割り当て済みアドレスは移動しない
+        linear_alloc_t alloc;
+        virtual_arena_t* arena = NULL;
+        size_t arena_mem_req = 0;
+        size_t arena_align_req = 0;
+        size_t reserved = 0;
+        unsigned char* ptr1 = NULL;
+        unsigned char* ptr2 = NULL;
+        void* ptr3 = NULL;
+        virtual_arena_preinit(&arena_mem_req, &arena_align_req);
+        arena = malloc(arena_mem_req);
+        assert(NULL != arena);
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_init(arena, 1 * MIB));
+        reserved = virtual_arena_reserved_size_get(arena);
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init_virtual(&alloc, arena));
+        assert(reserved == alloc.capacity);
+        assert(virtual_arena_base_get(arena) == alloc.memory_pool);
+        assert(arena == alloc.backend);
+        assert(0U == virtual_arena_committed_size_get(arena));
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 16U, 8U, (void**)&ptr1));
+        assert(0U != virtual_arena_committed_size_get(arena));
+        ptr1[0] = 0x12;
+        ptr1[15] = 0x34;
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, reserved / 2U, 8U, (void**)&ptr2));
+        assert(virtual_arena_committed_size_get(arena) >= (reserved / 2U + 16U));
+        ptr2[reserved / 2U - 1U] = 0x56;
+        assert(0x12 == ptr1[0]);
+        assert(0x34 == ptr1[15]);
+
+        // 予約範囲超過 -> LINEAR_ALLOC_NO_MEMORY
+        assert(LINEAR_ALLOC_NO_MEMORY == linear_allocator_allocate(&alloc, reserved, 8U, &ptr3));
+        assert(NULL == ptr3);
+
+        // コミット失敗 -> LINEAR_ALLOC_NO_MEMORY
+        {
+            test_call_control_t config = {0};
+            test_virtual_arena_config_reset();
+            config.fail_on_call = 1;
+            config.forced_result = (int)VIRTUAL_ARENA_NO_MEMORY;
+            test_virtual_arena_commit_config_set(&config);
+            assert(LINEAR_ALLOC_NO_MEMORY == linear_allocator_allocate(&alloc, 8U, 8U, &ptr3));
+            assert(NULL == ptr3);
+            test_virtual_arena_config_reset();
+        }
+
+        // 通常のinitではbackendはNULL
+        {
+            alignas(max_align_t) unsigned char pool[16];
+            assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(&alloc, sizeof(pool), pool));
+            assert(NULL == alloc.backend);
+        }
+
+        virtual_arena_deinit(arena);
+        free(arena);
+    }
+}
+
 static void NO_COVERAGE test_linear_allocator_allocate(void) {
     {
         // テスト基盤による強制失敗（前提条件チェックより前に失敗させる）
@@ -764,6 +963,161 @@ static void NO_COVERAGE test_linear_allocator_allocate(void) {
     }
 }
 
+static void NO_COVERAGE test_linear_allocator_requirement_add(void) {
+    {
+        // 引数異常 -> LINEAR_ALLOC_INVALID_ARGUMENT
+        size_t pool_size = 8U;
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_requirement_add(8U, 8U, NULL));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_requirement_add(8U, 7U, &pool_size));
+        assert(8U == pool_size);
+    }
+    {
+        // オーバーフロー -> LINEAR_ALLOC_INVALID_ARGUMENT, 加算されない
+        size_t pool_size = SIZE_MAX - 4U;
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_requirement_add(8U, 1U, &pool_size));
+        assert((SIZE_MAX - 4U) == pool_size);
+        pool_size = SIZE_MAX - 4U;
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_requirement_add(1U, 8U, &pool_size));
+        assert((SIZE_MAX - 4U) == pool_size);
+    }
+    {
+        // req_size_ == 0 または req_align_ == 0 -> 何も加算しない
+        size_t pool_size = 3U;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_requirement_add(0U, 8U, &pool_size));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_requirement_add(8U, 0U, &pool_size));
+        assert(3U == pool_size);
+    }
+    {
+        // 正常系: 算出した容量でlinear_allocator_allocateが過不足なく成功すること
+        linear_alloc_t alloc;
+        alignas(max_align_t) unsigned char pool[64];
+        size_t pool_size = 0;
+        size_t marker = 0;
+        void* ptr1 = NULL;
+        void* ptr2 = NULL;
+        void* ptr3 = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_requirement_add(3U, 1U, &pool_size));
+        assert(3U == pool_size);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_requirement_add(8U, 8U, &pool_size));
+        assert(16U == pool_size);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_requirement_add(4U, 4U, &pool_size));
+        assert(20U == pool_size);
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(&alloc, pool_size, pool));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 3U, 1U, &ptr1));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 8U, 8U, &ptr2));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 4U, 4U, &ptr3));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(&alloc, &marker));
+        assert(pool_size == marker);
+    }
+    {
+        // 正常系: max_align_tを超えるアライメント要件は最悪ケースの調整分を加算
+        size_t pool_size = 0;
+        size_t big_align = alignof(max_align_t) * 2U;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_requirement_add(1U, big_align, &pool_size));
+        assert((big_align - alignof(max_align_t) + 1U) == pool_size);
+    }
+}
+
+static void NO_COVERAGE test_linear_allocator_reset(void) {
+    {
+        // allocator_ == NULL -> no-op
+        linear_allocator_reset(NULL);
+    }
+    {
+        // 正常系: 割り当て後にリセットすると、メモリプール先頭から再度割り当てられる
+        linear_alloc_t alloc;
+        alignas(max_align_t) unsigned char pool[64];
+        void* ptr1 = NULL;
+        void* ptr2 = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(&alloc, sizeof(pool), pool));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, sizeof(pool), 1U, &ptr1));
+        assert((void*)pool == ptr1);
+        assert((void*)(pool + sizeof(pool)) == alloc.head_ptr);
+
+        linear_allocator_reset(&alloc);
+        assert((void*)pool == alloc.head_ptr);
+        assert(sizeof(pool) == alloc.capacity);
+        assert((void*)pool == alloc.memory_pool);
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 16U, 8U, &ptr2));
+        assert(ptr1 == ptr2);
+    }
+}
+
+static void NO_COVERAGE test_linear_allocator_marker_get(void) {
+    linear_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[64];
+    assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(&alloc, sizeof(pool), pool));
+    {
+        // 引数異常 -> LINEAR_ALLOC_INVALID_ARGUMENT
+        size_t marker = 1234U;
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_marker_get(NULL, &marker));
+        assert(1234U == marker);
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_marker_get(&alloc, NULL));
+    }
+    {
+        // 正常系: マーカーはアライメント調整分を含む使用量
+        size_t marker = 1234U;
+        void* ptr1 = NULL;
+        void* ptr2 = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(&alloc, &marker));
+        assert(0U == marker);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 3U, 1U, &ptr1));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(&alloc, &marker));
+        assert(3U == marker);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 8U, 8U, &ptr2));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(&alloc, &marker));
+        assert(16U == marker);
+    }
+}
+
+static void NO_COVERAGE test_linear_allocator_rewind(void) {
+    linear_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[64];
+    {
+        // allocator_ == NULL -> LINEAR_ALLOC_INVALID_ARGUMENT
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_rewind(NULL, 0U));
+    }
+    {
+        // 現在の割り当て位置より先のマーカー -> LINEAR_ALLOC_INVALID_ARGUMENT
+        void* ptr = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(&alloc, sizeof(pool), pool));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 8U, 8U, &ptr));
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_rewind(&alloc, 9U));
+        assert((void*)(pool + 8) == alloc.head_ptr);
+    }
+    {
+        // 正常系: 入れ子のスコープをLIFOで巻き戻す
+        size_t outer = 0U;
+        size_t inner = 0U;
+        void* persistent = NULL;
+        void* scratch1 = NULL;
+        void* scratch2 = NULL;
+        void* reuse = NULL;
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(&alloc, sizeof(pool), pool));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 8U, 8U, &persistent));
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(&alloc, &outer));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 16U, 8U, &scratch1));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(&alloc, &inner));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 32U, 8U, &scratch2));
+
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_rewind(&alloc, inner));
+        assert(scratch2 == alloc.head_ptr);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_rewind(&alloc, outer));
+        assert(scratch1 == alloc.head_ptr);
+
+        // 巻き戻し済みスコープのマーカーは使用不可
+        assert(LINEAR_ALLOC_INVALID_ARGUMENT == linear_allocator_rewind(&alloc, inner));
+
+        // 解放した領域は再利用される
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_allocate(&alloc, 48U, 8U, &reuse));
+        assert(scratch1 == reuse);
+        assert((void*)pool == persistent);
+    }
+}
+
 // Generated by ChatGPT 5.4 Thinking
 static void NO_COVERAGE test_rslt_to_str(void) {
     {
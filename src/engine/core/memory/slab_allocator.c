@@ -0,0 +1,460 @@
+/** @ingroup core
+ *
+ * @file slab_allocator.c
+ * @author chocolate-pie24
+ * @brief 固定サイズブロックの確保、解放に対応するスラブアロケータモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h> // for memset
+
+#include "engine/core/memory/slab_allocator.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include "test_controller.h"
+#include "engine/core/memory/test_slab_allocator.h"
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_slab_allocator_init;       /**< slab_allocator_init()テスト設定 */
+static test_call_control_t s_test_config_slab_allocator_allocate;   /**< slab_allocator_allocate()テスト設定 */
+
+// プライベート関数テスト設定
+// 現状ではなし
+
+// 全テスト関数プロトタイプ宣言
+static void test_slab_allocator_preinit(void);
+static void test_slab_allocator_init(void);
+static void test_slab_allocator_allocate(void);
+static void test_slab_allocator_free(void);
+static void test_slab_allocator_owns(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief 解放済みブロックの先頭に配置されるリストノード
+ *
+ */
+typedef struct slab_node {
+    struct slab_node* next;     /**< 次の解放済みブロック */
+} slab_node_t;
+
+/**
+ * @brief slab_alloc_t内部データ構造
+ *
+ */
+struct slab_alloc {
+    size_t block_size;      /**< 1ブロックのサイズ(アライメント調整後、byte) */
+    size_t block_count;     /**< メモリプールに含まれるブロック数 */
+    size_t used_count;      /**< 割り当て中のブロック数 */
+    size_t bump_index;      /**< 一度も払い出していないブロックの先頭インデックス */
+    void* memory_pool;      /**< アロケータが管理するメモリ領域(max_align_tにアライメント調整済み) */
+    slab_node_t* free_head; /**< 解放済みブロックリストの先頭 */
+};
+
+/**
+ * @brief ブロックサイズ、メモリプール先頭アドレスのアライメント単位
+ *
+ */
+#define SLAB_BLOCK_ALIGN ((uintptr_t)alignof(max_align_t))
+
+static const char* const s_rslt_str_success = "SUCCESS";                     /**< 実行結果種別文字列(処理成功) */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                 /**< 実行結果種別文字列(メモリ確保失敗) */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";   /**< 実行結果種別文字列(無効な引数) */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";     /**< 実行結果種別文字列(不明なエラー) */
+
+static const char* rslt_to_str(slab_allocator_result_t rslt_);
+
+void slab_allocator_preinit(size_t* memory_requirement_, size_t* align_requirement_) {
+    if(NULL == memory_requirement_ || NULL == align_requirement_) {
+        return;
+    }
+    *memory_requirement_ = sizeof(slab_alloc_t);
+    *align_requirement_ = alignof(slab_alloc_t);
+}
+
+slab_allocator_result_t slab_allocator_init(slab_alloc_t* allocator_, size_t block_size_, size_t capacity_, void* memory_pool_) {
+#ifdef TEST_BUILD
+    s_test_config_slab_allocator_init.call_count++;
+    if(s_test_config_slab_allocator_init.fail_on_call != 0) {
+        if(s_test_config_slab_allocator_init.call_count == s_test_config_slab_allocator_init.fail_on_call) {
+            return (slab_allocator_result_t)s_test_config_slab_allocator_init.forced_result;
+        }
+    }
+#endif
+    slab_allocator_result_t ret = SLAB_ALLOC_INVALID_ARGUMENT;
+    uintptr_t pool = 0;
+    uintptr_t start = 0;
+    uintptr_t block_size = 0;
+
+    // Preconditions
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_init", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(memory_pool_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_init", "memory_pool_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != block_size_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_init", "block_size_")
+    IF_ARG_FALSE_GOTO_CLEANUP(block_size_ <= capacity_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_init", "capacity_")
+
+    // Simulation
+    pool = (uintptr_t)memory_pool_;
+    start = (pool + (SLAB_BLOCK_ALIGN - 1)) & ~(SLAB_BLOCK_ALIGN - 1);
+    block_size = ((uintptr_t)block_size_ + (SLAB_BLOCK_ALIGN - 1)) & ~(SLAB_BLOCK_ALIGN - 1);
+    if((uintptr_t)capacity_ < (start - pool) || ((uintptr_t)capacity_ - (start - pool)) < block_size) {
+        ret = SLAB_ALLOC_INVALID_ARGUMENT;
+        ERROR_MESSAGE("slab_allocator_init(%s) - Provided capacity_ is too small to hold a block.", rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    // commit
+    allocator_->block_size = (size_t)block_size;
+    allocator_->block_count = (size_t)(((uintptr_t)capacity_ - (start - pool)) / block_size);
+    allocator_->used_count = 0;
+    allocator_->bump_index = 0;
+    allocator_->memory_pool = (void*)start;
+    allocator_->free_head = NULL;
+
+    ret = SLAB_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+slab_allocator_result_t slab_allocator_allocate(slab_alloc_t* allocator_, void** out_ptr_) {
+#ifdef TEST_BUILD
+    s_test_config_slab_allocator_allocate.call_count++;
+    if(s_test_config_slab_allocator_allocate.fail_on_call != 0) {
+        if(s_test_config_slab_allocator_allocate.call_count == s_test_config_slab_allocator_allocate.fail_on_call) {
+            return (slab_allocator_result_t)s_test_config_slab_allocator_allocate.forced_result;
+        }
+    }
+#endif
+    slab_allocator_result_t ret = SLAB_ALLOC_INVALID_ARGUMENT;
+    void* block = NULL;
+
+    // Preconditions
+    IF_ARG_NULL_GOTO_CLEANUP(allocator_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_allocate", "allocator_")
+    IF_ARG_NULL_GOTO_CLEANUP(out_ptr_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_allocate", "out_ptr_")
+    IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_ptr_, ret, SLAB_ALLOC_INVALID_ARGUMENT, rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT), "slab_allocator_allocate", "*out_ptr_")
+
+    // Simulation
+    if(NULL != allocator_->free_head) {
+        block = (void*)allocator_->free_head;
+        allocator_->free_head = allocator_->free_head->next;
+    } else if(allocator_->bump_index < allocator_->block_count) {
+        block = (void*)((uintptr_t)allocator_->memory_pool + (uintptr_t)(allocator_->bump_index * allocator_->block_size));
+        allocator_->bump_index++;
+    } else {
+        ret = SLAB_ALLOC_NO_MEMORY;
+        goto cleanup;
+    }
+
+    // commit
+    allocator_->used_count++;
+    *out_ptr_ = block;
+
+    ret = SLAB_ALLOC_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void slab_allocator_free(slab_alloc_t* allocator_, void* ptr_) {
+    slab_node_t* node = NULL;
+    uintptr_t offset = 0;
+
+    if(NULL == allocator_ || NULL == ptr_) {
+        WARN_MESSAGE("slab_allocator_free - No-op: 'allocator_' and 'ptr_' must not be NULL.");
+        goto cleanup;
+    }
+    if(!slab_allocator_owns(allocator_, ptr_)) {
+        WARN_MESSAGE("slab_allocator_free - No-op: 'ptr_' is not owned by this allocator.");
+        goto cleanup;
+    }
+    offset = (uintptr_t)ptr_ - (uintptr_t)allocator_->memory_pool;
+    if(0 != (offset % (uintptr_t)allocator_->block_size) || (offset / (uintptr_t)allocator_->block_size) >= (uintptr_t)allocator_->bump_index) {
+        WARN_MESSAGE("slab_allocator_free - No-op: 'ptr_' is not an allocated block address.");
+        goto cleanup;
+    }
+    if(0 == allocator_->used_count) {
+        WARN_MESSAGE("slab_allocator_free - No-op: no block is allocated.");
+        goto cleanup;
+    }
+
+    node = (slab_node_t*)ptr_;
+    node->next = allocator_->free_head;
+    allocator_->free_head = node;
+    allocator_->used_count--;
+
+cleanup:
+    return;
+}
+
+bool slab_allocator_owns(const slab_alloc_t* allocator_, const void* ptr_) {
+    uintptr_t pool = 0;
+    uintptr_t ptr = 0;
+
+    if(NULL == allocator_ || NULL == ptr_ || NULL == allocator_->memory_pool) {
+        return false;
+    }
+    pool = (uintptr_t)allocator_->memory_pool;
+    ptr = (uintptr_t)ptr_;
+    return (ptr >= pool && (ptr - pool) < (uintptr_t)(allocator_->block_count * allocator_->block_size)) ? true : false;
+}
+
+size_t slab_allocator_block_size(const slab_alloc_t* allocator_) {
+    return (NULL != allocator_) ? allocator_->block_size : 0;
+}
+
+size_t slab_allocator_used_count(const slab_alloc_t* allocator_) {
+    return (NULL != allocator_) ? allocator_->used_count : 0;
+}
+
+/**
+ * @brief 実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 文字列に変換する実行結果コード
+ * @return const char* 変換された文字列の先頭アドレス
+ */
+static const char* rslt_to_str(slab_allocator_result_t rslt_) {
+    switch(rslt_) {
+    case SLAB_ALLOC_SUCCESS:
+        return s_rslt_str_success;
+    case SLAB_ALLOC_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case SLAB_ALLOC_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_slab_allocator_init_config_set(const test_call_control_t* config_) {
+    s_test_config_slab_allocator_init.fail_on_call = config_->fail_on_call;
+    s_test_config_slab_allocator_init.forced_result = config_->forced_result;
+}
+
+void test_slab_allocator_allocate_config_set(const test_call_control_t* config_) {
+    s_test_config_slab_allocator_allocate.fail_on_call = config_->fail_on_call;
+    s_test_config_slab_allocator_allocate.forced_result = config_->forced_result;
+}
+
+void test_slab_allocator_config_reset(void) {
+    test_call_control_reset(&s_test_config_slab_allocator_init);
+    test_call_control_reset(&s_test_config_slab_allocator_allocate);
+}
+
+void NO_COVERAGE test_slab_allocator(void) {
+    test_slab_allocator_config_reset();
+
+    test_slab_allocator_preinit();
+    test_slab_allocator_init();
+    test_slab_allocator_allocate();
+    test_slab_allocator_free();
+    test_slab_allocator_owns();
+    test_rslt_to_str();
+
+    test_slab_allocator_config_reset();
+}
+
+static void NO_COVERAGE test_slab_allocator_preinit(void) {
+    {
+        // いずれかがNULLの場合は何もしない
+        size_t mem = 1234U;
+        size_t align = 5678U;
+        slab_allocator_preinit(&mem, NULL);
+        assert(1234U == mem);
+        slab_allocator_preinit(NULL, &align);
+        assert(5678U == align);
+        slab_allocator_preinit(NULL, NULL);
+    }
+    {
+        // 正常系
+        size_t mem = 0U;
+        size_t align = 0U;
+        slab_allocator_preinit(&mem, &align);
+        assert(sizeof(slab_alloc_t) == mem);
+        assert(alignof(slab_alloc_t) == align);
+    }
+}
+
+static void NO_COVERAGE test_slab_allocator_init(void) {
+    slab_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[256];
+    {
+        // テスト基盤による強制失敗
+        test_call_control_t config = {0};
+        memset(&alloc, 0, sizeof(alloc));
+
+        test_slab_allocator_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SLAB_ALLOC_NO_MEMORY;
+        test_slab_allocator_init_config_set(&config);
+
+        assert(SLAB_ALLOC_NO_MEMORY == slab_allocator_init(&alloc, 32U, sizeof(pool), pool));
+        assert(NULL == alloc.memory_pool);
+
+        test_slab_allocator_config_reset();
+    }
+    {
+        // 引数異常 -> SLAB_ALLOC_INVALID_ARGUMENT
+        memset(&alloc, 0, sizeof(alloc));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_init(NULL, 32U, sizeof(pool), pool));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_init(&alloc, 32U, sizeof(pool), NULL));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_init(&alloc, 0U, sizeof(pool), pool));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_init(&alloc, 512U, sizeof(pool), pool));
+        // アライメント調整後に1ブロックも入らない
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_init(&alloc, SLAB_BLOCK_ALIGN, SLAB_BLOCK_ALIGN, pool + 1));
+        assert(NULL == alloc.memory_pool);
+    }
+    {
+        // 正常系: ブロックサイズはmax_align_tの倍数に切り上げ
+        memset(&alloc, 0, sizeof(alloc));
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 1U, sizeof(pool), pool));
+        assert(SLAB_BLOCK_ALIGN == alloc.block_size);
+        assert((sizeof(pool) / SLAB_BLOCK_ALIGN) == alloc.block_count);
+        assert(0U == alloc.used_count);
+        assert(0U == alloc.bump_index);
+        assert((void*)pool == alloc.memory_pool);
+        assert(NULL == alloc.free_head);
+        assert(SLAB_BLOCK_ALIGN == slab_allocator_block_size(&alloc));
+        assert(0U == slab_allocator_block_size(NULL));
+    }
+    {
+        // 正常系: 非アライメントのプール先頭は調整され、端数は使用しない
+        memset(&alloc, 0, sizeof(alloc));
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 64U, sizeof(pool) - 1U, pool + 1));
+        assert((void*)(pool + SLAB_BLOCK_ALIGN) == alloc.memory_pool);
+        assert(((sizeof(pool) - SLAB_BLOCK_ALIGN) / 64U) == alloc.block_count);
+    }
+}
+
+static void NO_COVERAGE test_slab_allocator_allocate(void) {
+    slab_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[256];
+    {
+        // テスト基盤による強制失敗
+        test_call_control_t config = {0};
+        void* ptr = NULL;
+
+        test_slab_allocator_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SLAB_ALLOC_NO_MEMORY;
+        test_slab_allocator_allocate_config_set(&config);
+
+        assert(SLAB_ALLOC_NO_MEMORY == slab_allocator_allocate(NULL, &ptr));
+        assert(NULL == ptr);
+
+        test_slab_allocator_config_reset();
+    }
+    {
+        // 引数異常 -> SLAB_ALLOC_INVALID_ARGUMENT
+        void* ptr = NULL;
+        void* dummy = pool;
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 64U, sizeof(pool), pool));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_allocate(NULL, &ptr));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_allocate(&alloc, NULL));
+        assert(SLAB_ALLOC_INVALID_ARGUMENT == slab_allocator_allocate(&alloc, &dummy));
+        assert(NULL == ptr);
+        assert(0U == alloc.used_count);
+    }
+    {
+        // 正常系: 全ブロックを払い出した後はSLAB_ALLOC_NO_MEMORY
+        void* ptr[4] = { NULL, NULL, NULL, NULL };
+        void* over = NULL;
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 64U, sizeof(pool), pool));
+        for(size_t i = 0; i != 4; ++i) {
+            assert(SLAB_ALLOC_SUCCESS == slab_allocator_allocate(&alloc, &ptr[i]));
+            assert((void*)(pool + i * 64U) == ptr[i]);
+            assert(0U == ((uintptr_t)ptr[i] % alignof(max_align_t)));
+        }
+        assert(4U == slab_allocator_used_count(&alloc));
+        assert(SLAB_ALLOC_NO_MEMORY == slab_allocator_allocate(&alloc, &over));
+        assert(NULL == over);
+        assert(4U == slab_allocator_used_count(&alloc));
+        assert(0U == slab_allocator_used_count(NULL));
+    }
+}
+
+static void NO_COVERAGE test_slab_allocator_free(void) {
+    slab_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[256];
+    {
+        // NULL、プール外、ブロック境界外、未払い出しブロックはno-op
+        void* p1 = NULL;
+        unsigned char outside[32];
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 64U, sizeof(pool), pool));
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_allocate(&alloc, &p1));
+
+        slab_allocator_free(NULL, p1);
+        slab_allocator_free(&alloc, NULL);
+        slab_allocator_free(&alloc, outside);
+        slab_allocator_free(&alloc, pool + 8);
+        slab_allocator_free(&alloc, pool + 64);
+        assert(1U == alloc.used_count);
+        assert(NULL == alloc.free_head);
+
+        slab_allocator_free(&alloc, p1);
+        assert(0U == alloc.used_count);
+        assert((void*)p1 == (void*)alloc.free_head);
+
+        // 割り当て中のブロックがない
+        slab_allocator_free(&alloc, p1);
+        assert(0U == alloc.used_count);
+        assert((void*)p1 == (void*)alloc.free_head);
+    }
+    {
+        // 解放済みブロックはLIFOで再利用される
+        void* p[3] = { NULL, NULL, NULL };
+        void* q = NULL;
+        void* r = NULL;
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 64U, sizeof(pool), pool));
+        for(size_t i = 0; i != 3; ++i) {
+            assert(SLAB_ALLOC_SUCCESS == slab_allocator_allocate(&alloc, &p[i]));
+        }
+        slab_allocator_free(&alloc, p[0]);
+        slab_allocator_free(&alloc, p[2]);
+        assert(1U == alloc.used_count);
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_allocate(&alloc, &q));
+        assert(p[2] == q);
+        assert(SLAB_ALLOC_SUCCESS == slab_allocator_allocate(&alloc, &r));
+        assert(p[0] == r);
+        assert(3U == alloc.used_count);
+        assert(3U == alloc.bump_index);
+    }
+}
+
+static void NO_COVERAGE test_slab_allocator_owns(void) {
+    slab_alloc_t alloc;
+    alignas(max_align_t) unsigned char pool[200];
+    assert(SLAB_ALLOC_SUCCESS == slab_allocator_init(&alloc, 64U, sizeof(pool), pool));
+    assert(!slab_allocator_owns(NULL, pool));
+    assert(!slab_allocator_owns(&alloc, NULL));
+    assert(slab_allocator_owns(&alloc, pool));
+    assert(slab_allocator_owns(&alloc, pool + 191));
+    assert(!slab_allocator_owns(&alloc, pool + 192));    // 端数領域は管理外
+    assert(!slab_allocator_owns(&alloc, &alloc));
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    assert(0 == strcmp("SUCCESS", rslt_to_str(SLAB_ALLOC_SUCCESS)));
+    assert(0 == strcmp("NO_MEMORY", rslt_to_str(SLAB_ALLOC_NO_MEMORY)));
+    assert(0 == strcmp("INVALID_ARGUMENT", rslt_to_str(SLAB_ALLOC_INVALID_ARGUMENT)));
+    assert(0 == strcmp("UNDEFINED_ERROR", rslt_to_str((slab_allocator_result_t)100)));
+}
+#endif
@@ -0,0 +1,464 @@
+/** @ingroup core
+ *
+ * @file virtual_arena.c
+ * @author chocolate-pie24
+ * @brief 仮想アドレス空間を予約し、使用量に応じて物理メモリをコミットする仮想メモリアリーナモジュールの実装
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#if defined(PLATFORM_LINUX) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE // for MAP_ANONYMOUS(_POSIX_C_SOURCE指定時は無効となるため)
+#endif
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sys/mman.h>   // for mmap, mprotect, munmap
+#include <unistd.h>     // for sysconf
+
+#include "engine/core/memory/virtual_arena.h"
+
+#include "engine/base/choco_macros.h"
+#include "engine/base/choco_message.h"
+
+// #define TEST_BUILD
+
+#ifdef TEST_BUILD
+// テスト時のみ使用するヘッダのinclude
+#include <assert.h>
+#include <string.h> // for memset, strcmp
+#include "test_controller.h"
+#include "engine/core/memory/test_virtual_arena.h"
+
+// 外部公開APIテスト設定
+static test_call_control_t s_test_config_virtual_arena_init;     /**< virtual_arena_init()テスト設定 */
+static test_call_control_t s_test_config_virtual_arena_commit;   /**< virtual_arena_commit()テスト設定 */
+
+// プライベート関数テスト設定
+// 現状ではなし
+
+// 全テスト関数プロトタイプ宣言
+static void test_virtual_arena_preinit(void);
+static void test_virtual_arena_init(void);
+static void test_virtual_arena_commit(void);
+static void test_virtual_arena_getters(void);
+static void test_rslt_to_str(void);
+#endif
+
+/**
+ * @brief コミットを行う最小単位(byte)
+ *
+ * @note ページサイズの倍数に切り上げて使用する
+ */
+#ifndef VIRTUAL_ARENA_COMMIT_GRANULARITY
+#define VIRTUAL_ARENA_COMMIT_GRANULARITY (64 * KIB)
+#endif
+
+/**
+ * @brief virtual_arena_t内部データ構造
+ *
+ */
+struct virtual_arena {
+    void* base;             /**< 予約した仮想アドレス空間の先頭アドレス */
+    size_t reserved_size;   /**< 予約容量(byte, ページサイズの倍数) */
+    size_t committed_size;  /**< コミット済み容量(byte, ページサイズの倍数) */
+    size_t page_size;       /**< ページサイズ(byte) */
+};
+
+static const char* const s_rslt_str_success = "SUCCESS";                     /**< 実行結果種別文字列(処理成功) */
+static const char* const s_rslt_str_no_memory = "NO_MEMORY";                 /**< 実行結果種別文字列(メモリ確保失敗) */
+static const char* const s_rslt_str_invalid_argument = "INVALID_ARGUMENT";   /**< 実行結果種別文字列(無効な引数) */
+static const char* const s_rslt_str_limit_exceeded = "LIMIT_EXCEEDED";       /**< 実行結果種別文字列(システム使用可能範囲上限超過) */
+static const char* const s_rslt_str_undefined_error = "UNDEFINED_ERROR";     /**< 実行結果種別文字列(不明なエラー) */
+
+static size_t page_size_get(void);
+static bool round_up(size_t value_, size_t unit_, size_t* out_value_);
+static const char* rslt_to_str(virtual_arena_result_t rslt_);
+
+void virtual_arena_preinit(size_t* memory_requirement_, size_t* align_requirement_) {
+    if(NULL == memory_requirement_ || NULL == align_requirement_) {
+        return;
+    }
+    *memory_requirement_ = sizeof(virtual_arena_t);
+    *align_requirement_ = alignof(virtual_arena_t);
+}
+
+virtual_arena_result_t virtual_arena_init(virtual_arena_t* arena_, size_t reserve_size_) {
+#ifdef TEST_BUILD
+    s_test_config_virtual_arena_init.call_count++;
+    if(s_test_config_virtual_arena_init.fail_on_call != 0) {
+        if(s_test_config_virtual_arena_init.call_count == s_test_config_virtual_arena_init.fail_on_call) {
+            return (virtual_arena_result_t)s_test_config_virtual_arena_init.forced_result;
+        }
+    }
+#endif
+    virtual_arena_result_t ret = VIRTUAL_ARENA_INVALID_ARGUMENT;
+    size_t page_size = 0;
+    size_t reserve_size = 0;
+    void* base = NULL;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(arena_, ret, VIRTUAL_ARENA_INVALID_ARGUMENT, rslt_to_str(VIRTUAL_ARENA_INVALID_ARGUMENT), "virtual_arena_init", "arena_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 != reserve_size_, ret, VIRTUAL_ARENA_INVALID_ARGUMENT, rslt_to_str(VIRTUAL_ARENA_INVALID_ARGUMENT), "virtual_arena_init", "reserve_size_")
+
+    // Simulation.
+    page_size = page_size_get();
+    if(!round_up(reserve_size_, page_size, &reserve_size)) {
+        ret = VIRTUAL_ARENA_INVALID_ARGUMENT;
+        ERROR_MESSAGE("virtual_arena_init(%s) - Reserve size is too large.", rslt_to_str(ret));
+        goto cleanup;
+    }
+    base = mmap(NULL, reserve_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(MAP_FAILED == base) {
+        ret = VIRTUAL_ARENA_NO_MEMORY;
+        ERROR_MESSAGE("virtual_arena_init(%s) - Failed to reserve virtual address space. Requested size: %zu", rslt_to_str(ret), reserve_size);
+        goto cleanup;
+    }
+
+    // commit.
+    arena_->base = base;
+    arena_->reserved_size = reserve_size;
+    arena_->committed_size = 0;
+    arena_->page_size = page_size;
+
+    ret = VIRTUAL_ARENA_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void virtual_arena_deinit(virtual_arena_t* arena_) {
+    if(NULL == arena_ || NULL == arena_->base) {
+        return;
+    }
+    if(0 != munmap(arena_->base, arena_->reserved_size)) {
+        WARN_MESSAGE("virtual_arena_deinit - Failed to release virtual address space.");
+    }
+    arena_->base = NULL;
+    arena_->reserved_size = 0;
+    arena_->committed_size = 0;
+}
+
+virtual_arena_result_t virtual_arena_commit(virtual_arena_t* arena_, size_t commit_size_) {
+#ifdef TEST_BUILD
+    s_test_config_virtual_arena_commit.call_count++;
+    if(s_test_config_virtual_arena_commit.fail_on_call != 0) {
+        if(s_test_config_virtual_arena_commit.call_count == s_test_config_virtual_arena_commit.fail_on_call) {
+            return (virtual_arena_result_t)s_test_config_virtual_arena_commit.forced_result;
+        }
+    }
+#endif
+    virtual_arena_result_t ret = VIRTUAL_ARENA_INVALID_ARGUMENT;
+    size_t granularity = 0;
+    size_t new_committed = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(arena_, ret, VIRTUAL_ARENA_INVALID_ARGUMENT, rslt_to_str(VIRTUAL_ARENA_INVALID_ARGUMENT), "virtual_arena_commit", "arena_")
+    IF_ARG_NULL_GOTO_CLEANUP(arena_->base, ret, VIRTUAL_ARENA_INVALID_ARGUMENT, rslt_to_str(VIRTUAL_ARENA_INVALID_ARGUMENT), "virtual_arena_commit", "arena_->base")
+    if(commit_size_ <= arena_->committed_size) {
+        ret = VIRTUAL_ARENA_SUCCESS;
+        goto cleanup;
+    }
+    if(commit_size_ > arena_->reserved_size) {
+        ret = VIRTUAL_ARENA_LIMIT_EXCEEDED;
+        ERROR_MESSAGE("virtual_arena_commit(%s) - Commit size exceeds reserved size. Requested: %zu / Reserved: %zu", rslt_to_str(ret), commit_size_, arena_->reserved_size);
+        goto cleanup;
+    }
+
+    // Simulation.
+    (void)round_up(VIRTUAL_ARENA_COMMIT_GRANULARITY, arena_->page_size, &granularity);
+    if(!round_up(commit_size_, granularity, &new_committed) || new_committed > arena_->reserved_size) {
+        new_committed = arena_->reserved_size;  // 予約範囲を上限とする(予約容量はページサイズの倍数)
+    }
+    if(0 != mprotect((char*)arena_->base + arena_->committed_size, new_committed - arena_->committed_size, PROT_READ | PROT_WRITE)) {
+        ret = VIRTUAL_ARENA_NO_MEMORY;
+        ERROR_MESSAGE("virtual_arena_commit(%s) - Failed to commit pages. Requested: %zu / Committed: %zu", rslt_to_str(ret), commit_size_, arena_->committed_size);
+        goto cleanup;
+    }
+
+    // commit.
+    arena_->committed_size = new_committed;
+
+    ret = VIRTUAL_ARENA_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
+void* virtual_arena_base_get(const virtual_arena_t* arena_) {
+    return (NULL == arena_) ? NULL : arena_->base;
+}
+
+size_t virtual_arena_reserved_size_get(const virtual_arena_t* arena_) {
+    return (NULL == arena_) ? 0 : arena_->reserved_size;
+}
+
+size_t virtual_arena_committed_size_get(const virtual_arena_t* arena_) {
+    return (NULL == arena_) ? 0 : arena_->committed_size;
+}
+
+/**
+ * @brief システムのページサイズを取得する
+ *
+ * @note 取得に失敗した場合は4KiBとみなす
+ *
+ * @return size_t ページサイズ(byte)
+ */
+static size_t page_size_get(void) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    if(page_size <= 0) {
+        return (size_t)(4 * KIB);
+    }
+    return (size_t)page_size;
+}
+
+/**
+ * @brief value_をunit_の倍数に切り上げる
+ *
+ * @param[in] value_ 切り上げ対象値
+ * @param[in] unit_ 切り上げ単位(2の冪乗であること)
+ * @param[out] out_value_ 切り上げ結果格納先
+ *
+ * @retval true  切り上げに成功
+ * @retval false 切り上げ結果がオーバーフロー
+ */
+static bool round_up(size_t value_, size_t unit_, size_t* out_value_) {
+    if(SIZE_MAX - (unit_ - 1) < value_) {
+        return false;
+    }
+    *out_value_ = (value_ + (unit_ - 1)) & ~(unit_ - 1);
+    return true;
+}
+
+/**
+ * @brief 実行結果コードを文字列に変換する
+ *
+ * @param[in] rslt_ 文字列に変換する実行結果コード
+ * @return const char* 変換された文字列の先頭アドレス
+ */
+static const char* rslt_to_str(virtual_arena_result_t rslt_) {
+    switch(rslt_) {
+    case VIRTUAL_ARENA_SUCCESS:
+        return s_rslt_str_success;
+    case VIRTUAL_ARENA_NO_MEMORY:
+        return s_rslt_str_no_memory;
+    case VIRTUAL_ARENA_INVALID_ARGUMENT:
+        return s_rslt_str_invalid_argument;
+    case VIRTUAL_ARENA_LIMIT_EXCEEDED:
+        return s_rslt_str_limit_exceeded;
+    default:
+        return s_rslt_str_undefined_error;
+    }
+}
+
+#ifdef TEST_BUILD
+void test_virtual_arena_init_config_set(const test_call_control_t* config_) {
+    s_test_config_virtual_arena_init.fail_on_call = config_->fail_on_call;
+    s_test_config_virtual_arena_init.forced_result = config_->forced_result;
+}
+
+void test_virtual_arena_commit_config_set(const test_call_control_t* config_) {
+    s_test_config_virtual_arena_commit.fail_on_call = config_->fail_on_call;
+    s_test_config_virtual_arena_commit.forced_result = config_->forced_result;
+}
+
+void test_virtual_arena_config_reset(void) {
+    test_call_control_reset(&s_test_config_virtual_arena_init);
+    test_call_control_reset(&s_test_config_virtual_arena_commit);
+}
+
+void NO_COVERAGE test_virtual_arena(void) {
+    test_virtual_arena_config_reset();
+
+    test_virtual_arena_preinit();
+    test_virtual_arena_init();
+    test_virtual_arena_commit();
+    test_virtual_arena_getters();
+    test_rslt_to_str();
+
+    test_virtual_arena_config_reset();
+}
+
+static void NO_COVERAGE test_virtual_arena_preinit(void) {
+    {
+        // NULL引数 -> 何もしない
+        size_t mem_req = 0;
+        size_t align_req = 0;
+        virtual_arena_preinit(NULL, &align_req);
+        virtual_arena_preinit(&mem_req, NULL);
+        assert(0 == mem_req);
+        assert(0 == align_req);
+    }
+    {
+        // 正常系
+        size_t mem_req = 0;
+        size_t align_req = 0;
+        virtual_arena_preinit(&mem_req, &align_req);
+        assert(sizeof(virtual_arena_t) == mem_req);
+        assert(alignof(virtual_arena_t) == align_req);
+    }
+}
+
+static void NO_COVERAGE test_virtual_arena_init(void) {
+    {
+        // テスト基盤による強制失敗
+        virtual_arena_t arena;
+        test_call_control_t config = {0};
+        memset(&arena, 0, sizeof(arena));
+        config.fail_on_call = 1;
+        config.forced_result = (int)VIRTUAL_ARENA_NO_MEMORY;
+        test_virtual_arena_init_config_set(&config);
+        assert(VIRTUAL_ARENA_NO_MEMORY == virtual_arena_init(&arena, 4096U));
+        assert(NULL == arena.base);
+        assert(1U == s_test_config_virtual_arena_init.call_count);
+        test_virtual_arena_config_reset();
+    }
+    {
+        // 引数異常 -> VIRTUAL_ARENA_INVALID_ARGUMENT
+        virtual_arena_t arena;
+        memset(&arena, 0, sizeof(arena));
+        assert(VIRTUAL_ARENA_INVALID_ARGUMENT == virtual_arena_init(NULL, 4096U));
+        assert(VIRTUAL_ARENA_INVALID_ARGUMENT == virtual_arena_init(&arena, 0U));
+        assert(VIRTUAL_ARENA_INVALID_ARGUMENT == virtual_arena_init(&arena, SIZE_MAX));
+        assert(NULL == arena.base);
+    }
+    {
+        // 仮想アドレス空間の予約失敗 -> VIRTUAL_ARENA_NO_MEMORY
+        virtual_arena_t arena;
+        memset(&arena, 0, sizeof(arena));
+        assert(VIRTUAL_ARENA_NO_MEMORY == virtual_arena_init(&arena, SIZE_MAX / 2U));
+        assert(NULL == arena.base);
+    }
+    {
+        // 正常系: ページサイズに切り上げて予約し、コミットは行わない
+        virtual_arena_t arena;
+        size_t page_size = page_size_get();
+        memset(&arena, 0, sizeof(arena));
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_init(&arena, 1U));
+        assert(NULL != arena.base);
+        assert(page_size == arena.reserved_size);
+        assert(0U == arena.committed_size);
+        virtual_arena_deinit(&arena);
+        assert(NULL == arena.base);
+        assert(0U == arena.reserved_size);
+
+        // 多重解放、NULLは何もしない
+        virtual_arena_deinit(&arena);
+        virtual_arena_deinit(NULL);
+    }
+}
+
+static void NO_COVERAGE test_virtual_arena_commit(void) {
+    {
+        // テスト基盤による強制失敗
+        virtual_arena_t arena;
+        test_call_control_t config = {0};
+        memset(&arena, 0, sizeof(arena));
+        config.fail_on_call = 1;
+        config.forced_result = (int)VIRTUAL_ARENA_NO_MEMORY;
+        test_virtual_arena_commit_config_set(&config);
+        assert(VIRTUAL_ARENA_NO_MEMORY == virtual_arena_commit(&arena, 1U));
+        test_virtual_arena_config_reset();
+    }
+    {
+        // 引数異常 -> VIRTUAL_ARENA_INVALID_ARGUMENT
+        virtual_arena_t arena;
+        memset(&arena, 0, sizeof(arena));
+        assert(VIRTUAL_ARENA_INVALID_ARGUMENT == virtual_arena_commit(NULL, 1U));
+        assert(VIRTUAL_ARENA_INVALID_ARGUMENT == virtual_arena_commit(&arena, 1U));   // 未予約
+    }
+    {
+        // 正常系: コミット粒度で切り上げ、予約範囲を上限とする。先頭アドレスは変化しない
+        virtual_arena_t arena;
+        size_t granularity = 0;
+        size_t reserve_size = 0;
+        unsigned char* base = NULL;
+        memset(&arena, 0, sizeof(arena));
+        (void)round_up(VIRTUAL_ARENA_COMMIT_GRANULARITY, page_size_get(), &granularity);
+        reserve_size = granularity * 2U + page_size_get();
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_init(&arena, reserve_size));
+        base = (unsigned char*)arena.base;
+
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_commit(&arena, 0U));
+        assert(0U == arena.committed_size);
+
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_commit(&arena, 1U));
+        assert(granularity == arena.committed_size);
+        base[0] = 0xAB;
+        base[granularity - 1U] = 0xCD;
+
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_commit(&arena, granularity));
+        assert(granularity == arena.committed_size);
+
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_commit(&arena, granularity * 2U + 1U));
+        assert(reserve_size == arena.committed_size);
+        base[reserve_size - 1U] = 0xEF;
+        assert(base == (unsigned char*)arena.base);
+        assert(0xAB == base[0]);
+        assert(0xCD == base[granularity - 1U]);
+
+        // 予約範囲超過 -> VIRTUAL_ARENA_LIMIT_EXCEEDED
+        assert(VIRTUAL_ARENA_LIMIT_EXCEEDED == virtual_arena_commit(&arena, reserve_size + 1U));
+        assert(reserve_size == arena.committed_size);
+
+        virtual_arena_deinit(&arena);
+    }
+}
+
+static void NO_COVERAGE test_virtual_arena_getters(void) {
+    {
+        // NULL -> NULL / 0
+        assert(NULL == virtual_arena_base_get(NULL));
+        assert(0U == virtual_arena_reserved_size_get(NULL));
+        assert(0U == virtual_arena_committed_size_get(NULL));
+    }
+    {
+        // 正常系
+        virtual_arena_t arena;
+        memset(&arena, 0, sizeof(arena));
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_init(&arena, 1U));
+        assert(VIRTUAL_ARENA_SUCCESS == virtual_arena_commit(&arena, 1U));
+        assert(arena.base == virtual_arena_base_get(&arena));
+        assert(arena.reserved_size == virtual_arena_reserved_size_get(&arena));
+        assert(arena.committed_size == virtual_arena_committed_size_get(&arena));
+        virtual_arena_deinit(&arena);
+    }
+}
+
+static void NO_COVERAGE test_rslt_to_str(void) {
+    {
+        const char* str = rslt_to_str(VIRTUAL_ARENA_SUCCESS);
+        assert(NULL != str);
+        assert(0 == strcmp("SUCCESS", str));
+    }
+    {
+        const char* str = rslt_to_str(VIRTUAL_ARENA_NO_MEMORY);
+        assert(NULL != str);
+        assert(0 == strcmp("NO_MEMORY", str));
+    }
+    {
+        const char* str = rslt_to_str(VIRTUAL_ARENA_INVALID_ARGUMENT);
+        assert(NULL != str);
+        assert(0 == strcmp("INVALID_ARGUMENT", str));
+    }
+    {
+        const char* str = rslt_to_str(VIRTUAL_ARENA_LIMIT_EXCEEDED);
+        assert(NULL != str);
+        assert(0 == strcmp("LIMIT_EXCEEDED", str));
+    }
+    {
+        const char* str = rslt_to_str((virtual_arena_result_t)999);
+        assert(NULL != str);
+        assert(0 == strcmp("UNDEFINED_ERROR", str));
+    }
+}
+#endif
@@ -64,6 +64,7 @@ static void test_fs_utils_create(void);
 static void test_fs_utils_destroy(void);
 static void test_fs_utils_text_file_read(void);
 static void test_fs_utils_fullpath_get(void);
+static void test_fs_utils_fullpath_c_str(void);
 static void test_rslt_to_str(void);
 static void test_fs_utils_valid_check(void);
 static void test_filesystem_result_convert(void);
@@ -77,9 +78,7 @@ static void test_memory_system_result_convert(void);
  */
 struct fs_utils {
     filesystem_t* filesystem;       /**< ファイルシステム構造体インスタンスへのポインタ */
-    choco_string_t* filepath;       /**< ファイルパス文字列格納コンテナ */
-    choco_string_t* filename;       /**< ファイル名文字列格納コンテナ */
-    choco_string_t* extension;      /**< ファイル拡張子文字列格納コンテナ */
+    choco_string_t* fullpath;       /**< フルパス(ファイルパス + ファイル名 + 拡張子)文字列格納コンテナ */
     filesystem_open_mode_t mode;    /**< ファイルオープンモード */
 };
 
@@ -114,7 +113,6 @@ fs_utils_result_t fs_utils_create(const char* filepath_, const char* filename_,
     choco_string_result_t ret_str = CHOCO_STRING_INVALID_ARGUMENT;
     filesystem_result_t ret_fs = FILESYSTEM_INVALID_ARGUMENT;
     fs_utils_t* tmp_fs_utils = NULL;
-    choco_string_t* tmp_fullpath = NULL;
     const char* open_mode_str = NULL;
 
     // Preconditions.
@@ -141,31 +139,21 @@ fs_utils_result_t fs_utils_create(const char* filepath_, const char* filename_,
     memset(tmp_fs_utils, 0, sizeof(fs_utils_t));
     tmp_fs_utils->mode = open_mode_;
 
-    ret_str = choco_string_create_from_c_string(filepath_, &tmp_fs_utils->filepath);
+    // フルパスは1つの文字列コンテナに直接組み立てる(ファイルパス/ファイル名/拡張子ごとに文字列コンテナを生成しない)
+    ret_str = choco_string_default_create(&tmp_fs_utils->fullpath);
     if(CHOCO_STRING_SUCCESS != ret_str) {
         ret = choco_string_result_convert(ret_str);
-        ERROR_MESSAGE("fs_utils_create(%s) - Failed to initialize string from char for 'tmp_fs_utils->filepath'.", rslt_to_str(ret));
+        ERROR_MESSAGE("fs_utils_create(%s) - Failed to create fullpath string instance.", rslt_to_str(ret));
         goto cleanup;
     }
 
-    ret_str = choco_string_create_from_c_string(filename_, &tmp_fs_utils->filename);
+    ret_str = choco_string_append_format(tmp_fs_utils->fullpath, "%s%s%s", filepath_, filename_, (NULL != extension_) ? extension_ : "");
     if(CHOCO_STRING_SUCCESS != ret_str) {
         ret = choco_string_result_convert(ret_str);
-        ERROR_MESSAGE("fs_utils_create(%s) - Failed to initialize string from char for 'tmp_fs_utils->filename'.", rslt_to_str(ret));
+        ERROR_MESSAGE("fs_utils_create(%s) - Failed to build fullpath string.", rslt_to_str(ret));
         goto cleanup;
     }
 
-    if(NULL == extension_) {
-        tmp_fs_utils->extension = NULL;
-    } else {
-        ret_str = choco_string_create_from_c_string(extension_, &tmp_fs_utils->extension);
-        if(CHOCO_STRING_SUCCESS != ret_str) {
-            ret = choco_string_result_convert(ret_str);
-            ERROR_MESSAGE("fs_utils_create(%s) - Failed to initialize string from char for 'tmp_fs_utils->extension'.", rslt_to_str(ret));
-            goto cleanup;
-        }
-    }
-
     ret_fs = filesystem_create(&tmp_fs_utils->filesystem);
     if(FILESYSTEM_SUCCESS != ret_fs) {
         ret = filesystem_result_convert(ret_fs);
@@ -173,26 +161,12 @@ fs_utils_result_t fs_utils_create(const char* filepath_, const char* filename_,
         goto cleanup;
     }
 
-    ret_str = choco_string_default_create(&tmp_fullpath);
-    if(CHOCO_STRING_SUCCESS != ret_str) {
-        ret = choco_string_result_convert(ret_str);
-        ERROR_MESSAGE("fs_utils_create(%s) - Failed to create fullpath string instance.", rslt_to_str(ret));
-        goto cleanup;
-    }
-
-    ret = fs_utils_fullpath_get(tmp_fs_utils, tmp_fullpath);
-    if(FS_UTILS_SUCCESS != ret) {
-        ERROR_MESSAGE("fs_utils_create(%s) - Failed to build fullpath string.", rslt_to_str(ret));
-        goto cleanup;
-    }
-
-    ret_fs = filesystem_open(choco_string_c_str(tmp_fullpath), open_mode_, tmp_fs_utils->filesystem);
+    ret_fs = filesystem_open(choco_string_c_str(tmp_fs_utils->fullpath), open_mode_, tmp_fs_utils->filesystem);
     if(FILESYSTEM_SUCCESS != ret_fs) {
         ret = filesystem_result_convert(ret_fs);
         ERROR_MESSAGE("fs_utils_create(%s) - Failed to open file. File open mode = '%s'.", rslt_to_str(ret), open_mode_str);
         goto cleanup;
     }
-    choco_string_destroy(&tmp_fullpath);
 
     *fs_utils_ = tmp_fs_utils;
 
@@ -200,7 +174,6 @@ fs_utils_result_t fs_utils_create(const char* filepath_, const char* filename_,
 
 cleanup:
     if(FS_UTILS_SUCCESS != ret) {
-        choco_string_destroy(&tmp_fullpath);
         fs_utils_destroy(&tmp_fs_utils);
     }
     return ret;
@@ -213,9 +186,7 @@ void fs_utils_destroy(fs_utils_t** fs_utils_) {
     if(NULL == *fs_utils_) {
         return;
     }
-    choco_string_destroy(&(*fs_utils_)->extension);
-    choco_string_destroy(&(*fs_utils_)->filepath);
-    choco_string_destroy(&(*fs_utils_)->filename);
+    choco_string_destroy(&(*fs_utils_)->fullpath);
     filesystem_destroy(&(*fs_utils_)->filesystem);
     memory_system_free(*fs_utils_, sizeof(fs_utils_t), MEMORY_TAG_FILE_IO);
 
@@ -312,35 +283,26 @@ fs_utils_result_t fs_utils_fullpath_get(fs_utils_t* fs_utils_, choco_string_t* o
         goto cleanup;
     }
 
-    ret_str = choco_string_copy(fs_utils_->filepath, out_fullpath_);
+    ret_str = choco_string_copy(fs_utils_->fullpath, out_fullpath_);
     if(CHOCO_STRING_SUCCESS != ret_str) {
         ret = choco_string_result_convert(ret_str);
-        ERROR_MESSAGE("fs_utils_fullpath_get(%s) - Failed to copy filepath string.", rslt_to_str(ret));
+        ERROR_MESSAGE("fs_utils_fullpath_get(%s) - Failed to copy fullpath string.", rslt_to_str(ret));
         goto cleanup;
     }
 
-    ret_str = choco_string_concat(fs_utils_->filename, out_fullpath_);
-    if(CHOCO_STRING_SUCCESS != ret_str) {
-        ret = choco_string_result_convert(ret_str);
-        ERROR_MESSAGE("fs_utils_fullpath_get(%s) - Failed to append filename string.", rslt_to_str(ret));
-        goto cleanup;
-    }
-
-    if(NULL != fs_utils_->extension) {
-        ret_str = choco_string_concat(fs_utils_->extension, out_fullpath_);
-        if(CHOCO_STRING_SUCCESS != ret_str) {
-            ret = choco_string_result_convert(ret_str);
-            ERROR_MESSAGE("fs_utils_fullpath_get(%s) - Failed to append extension string.", rslt_to_str(ret));
-            goto cleanup;
-        }
-    }
-
     ret = FS_UTILS_SUCCESS;
 
 cleanup:
     return ret;
 }
 
+const char* fs_utils_fullpath_c_str(const fs_utils_t* fs_utils_) {
+    if(!fs_utils_valid_check(fs_utils_)) {
+        return NULL;
+    }
+    return choco_string_c_str(fs_utils_->fullpath);
+}
+
 /**
  * @brief 実行結果コードを文字列に変換する
  *
@@ -392,12 +354,9 @@ static bool fs_utils_valid_check(const fs_utils_t* fs_utils_) {
         }
     }
 #endif
-    // extensionはNULLを許可
     if(NULL == fs_utils_) {
         return false;
-    } else if(NULL == fs_utils_->filename) {
-        return false;
-    } else if(NULL == fs_utils_->filepath) {
+    } else if(NULL == fs_utils_->fullpath) {
         return false;
     } else if(NULL == fs_utils_->filesystem) {
         return false;
@@ -541,6 +500,7 @@ void NO_COVERAGE test_fs_utils(void) {
     test_fs_utils_destroy();
     test_fs_utils_text_file_read();
     test_fs_utils_fullpath_get();
+    test_fs_utils_fullpath_c_str();
     test_rslt_to_str();
     test_fs_utils_valid_check();
     test_filesystem_result_convert();
@@ -646,7 +606,7 @@ static void NO_COVERAGE test_fs_utils_create(void) {
         assert(NULL == fs_utils);
     }
     {
-        // choco_string_create_from_c_string() 失敗(filepath)
+        // choco_string_default_create() 失敗
         test_call_control_t config = { 0 };
         fs_utils_t* fs_utils = NULL;
 
@@ -658,13 +618,13 @@ static void NO_COVERAGE test_fs_utils_create(void) {
 
         config.fail_on_call = 1;
         config.forced_result = (int)CHOCO_STRING_NO_MEMORY;
-        test_choco_string_create_from_c_string_config_set(&config);
+        test_choco_string_default_create_config_set(&config);
 
         assert(FS_UTILS_NO_MEMORY == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
         assert(NULL == fs_utils);
     }
     {
-        // choco_string_create_from_c_string() 失敗(filename)
+        // choco_string_append_format() 失敗
         test_call_control_t config = { 0 };
         fs_utils_t* fs_utils = NULL;
 
@@ -674,31 +634,13 @@ static void NO_COVERAGE test_fs_utils_create(void) {
         test_choco_memory_config_reset();
         test_call_control_reset(&config);
 
-        config.fail_on_call = 2;
+        config.fail_on_call = 1;
         config.forced_result = (int)CHOCO_STRING_OVERFLOW;
-        test_choco_string_create_from_c_string_config_set(&config);
+        test_choco_string_append_format_config_set(&config);
 
         assert(FS_UTILS_OVERFLOW == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
         assert(NULL == fs_utils);
     }
-    {
-        // choco_string_create_from_c_string() 失敗(extension)
-        test_call_control_t config = { 0 };
-        fs_utils_t* fs_utils = NULL;
-
-        test_fs_utils_config_reset();
-        test_filesystem_config_reset();
-        test_choco_string_config_reset();
-        test_choco_memory_config_reset();
-        test_call_control_reset(&config);
-
-        config.fail_on_call = 3;
-        config.forced_result = (int)CHOCO_STRING_LIMIT_EXCEEDED;
-        test_choco_string_create_from_c_string_config_set(&config);
-
-        assert(FS_UTILS_LIMIT_EXCEEDED == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
-        assert(NULL == fs_utils);
-    }
     {
         // filesystem_create() 失敗
         test_call_control_t config = { 0 };
@@ -717,42 +659,6 @@ static void NO_COVERAGE test_fs_utils_create(void) {
         assert(FS_UTILS_NO_MEMORY == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
         assert(NULL == fs_utils);
     }
-    {
-        // choco_string_default_create() 失敗
-        test_call_control_t config = { 0 };
-        fs_utils_t* fs_utils = NULL;
-
-        test_fs_utils_config_reset();
-        test_filesystem_config_reset();
-        test_choco_string_config_reset();
-        test_choco_memory_config_reset();
-        test_call_control_reset(&config);
-
-        config.fail_on_call = 1;
-        config.forced_result = (int)CHOCO_STRING_NO_MEMORY;
-        test_choco_string_default_create_config_set(&config);
-
-        assert(FS_UTILS_NO_MEMORY == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
-        assert(NULL == fs_utils);
-    }
-    {
-        // fs_utils_fullpath_get() 失敗
-        test_call_control_t config = { 0 };
-        fs_utils_t* fs_utils = NULL;
-
-        test_fs_utils_config_reset();
-        test_filesystem_config_reset();
-        test_choco_string_config_reset();
-        test_choco_memory_config_reset();
-        test_call_control_reset(&config);
-
-        config.fail_on_call = 1;
-        config.forced_result = (int)FS_UTILS_RUNTIME_ERROR;
-        test_fs_utils_fullpath_get_config_set(&config);
-
-        assert(FS_UTILS_RUNTIME_ERROR == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
-        assert(NULL == fs_utils);
-    }
     {
         // filesystem_open() 失敗
         test_call_control_t config = { 0 };
@@ -790,13 +696,9 @@ static void NO_COVERAGE test_fs_utils_create(void) {
         assert(FS_UTILS_SUCCESS == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
         assert(NULL != fs_utils);
         assert(NULL != fs_utils->filesystem);
-        assert(NULL != fs_utils->filepath);
-        assert(NULL != fs_utils->filename);
-        assert(NULL != fs_utils->extension);
+        assert(NULL != fs_utils->fullpath);
         assert(FILESYSTEM_MODE_READ == fs_utils->mode);
-        assert(0 == strcmp(choco_string_c_str(fs_utils->filepath), "path/to/"));
-        assert(0 == strcmp(choco_string_c_str(fs_utils->filename), "file"));
-        assert(0 == strcmp(choco_string_c_str(fs_utils->extension), ".txt"));
+        assert(0 == strcmp(choco_string_c_str(fs_utils->fullpath), "path/to/file.txt"));
 
         fs_utils_destroy(&fs_utils);
         assert(NULL == fs_utils);
@@ -820,12 +722,9 @@ static void NO_COVERAGE test_fs_utils_create(void) {
         assert(FS_UTILS_SUCCESS == fs_utils_create("path/to/", "file", NULL, FILESYSTEM_MODE_READ, &fs_utils));
         assert(NULL != fs_utils);
         assert(NULL != fs_utils->filesystem);
-        assert(NULL != fs_utils->filepath);
-        assert(NULL != fs_utils->filename);
-        assert(NULL == fs_utils->extension);
+        assert(NULL != fs_utils->fullpath);
         assert(FILESYSTEM_MODE_READ == fs_utils->mode);
-        assert(0 == strcmp(choco_string_c_str(fs_utils->filepath), "path/to/"));
-        assert(0 == strcmp(choco_string_c_str(fs_utils->filename), "file"));
+        assert(0 == strcmp(choco_string_c_str(fs_utils->fullpath), "path/to/file"));
 
         fs_utils_destroy(&fs_utils);
         assert(NULL == fs_utils);
@@ -936,9 +835,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_string = NULL;
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -979,9 +876,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         // out_string_ == NULL
         fs_utils_t fs_utils = { 0 };
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -997,9 +892,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_string = NULL;
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1023,9 +916,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_string = NULL;
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_WRITE;
 
@@ -1047,9 +938,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_string = NULL;
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1076,9 +965,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_string = NULL;
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1105,9 +992,7 @@ static void NO_COVERAGE test_fs_utils_text_file_read(void) {
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_string = NULL;
 
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1195,9 +1080,7 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         test_choco_memory_config_reset();
         test_call_control_reset(&config);
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/file.txt", &fs_utils.fullpath));
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
         assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
@@ -1209,9 +1092,7 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         assert(FS_UTILS_RUNTIME_ERROR == fs_utils_fullpath_get(&fs_utils, out_fullpath));
 
         choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        choco_string_destroy(&fs_utils.fullpath);
     }
     {
         // fs_utils_ == NULL
@@ -1238,17 +1119,13 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/file.txt", &fs_utils.fullpath));
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
         assert(FS_UTILS_INVALID_ARGUMENT == fs_utils_fullpath_get(&fs_utils, NULL));
 
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        choco_string_destroy(&fs_utils.fullpath);
     }
     {
         // fs_utils_valid_check() が false
@@ -1260,9 +1137,7 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/file.txt", &fs_utils.fullpath));
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
         assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
@@ -1273,12 +1148,10 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         assert(FS_UTILS_DATA_CORRUPTED == fs_utils_fullpath_get(&fs_utils, out_fullpath));
 
         choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        choco_string_destroy(&fs_utils.fullpath);
     }
     {
-        // choco_string_copy() 失敗(filepath copy)
+        // choco_string_copy() 失敗
         test_call_control_t config = { 0 };
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_fullpath = NULL;
@@ -1289,9 +1162,7 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         test_choco_memory_config_reset();
         test_call_control_reset(&config);
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/file.txt", &fs_utils.fullpath));
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
         assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
@@ -1303,13 +1174,10 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         assert(FS_UTILS_NO_MEMORY == fs_utils_fullpath_get(&fs_utils, out_fullpath));
 
         choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        choco_string_destroy(&fs_utils.fullpath);
     }
     {
-        // choco_string_concat() 失敗(filename concat)
-        test_call_control_t config = { 0 };
+        // 正常系
         fs_utils_t fs_utils = { 0 };
         choco_string_t* out_fullpath = NULL;
 
@@ -1317,104 +1185,61 @@ static void NO_COVERAGE test_fs_utils_fullpath_get(void) {
         test_filesystem_config_reset();
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
-        test_call_control_reset(&config);
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
+        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/file.txt", &fs_utils.fullpath));
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
         assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
 
-        config.fail_on_call = 1;
-        config.forced_result = (int)CHOCO_STRING_OVERFLOW;
-        test_choco_string_concat_config_set(&config);
-
-        assert(FS_UTILS_OVERFLOW == fs_utils_fullpath_get(&fs_utils, out_fullpath));
+        assert(FS_UTILS_SUCCESS == fs_utils_fullpath_get(&fs_utils, out_fullpath));
+        assert(0 == strcmp(choco_string_c_str(out_fullpath), "path/to/file.txt"));
 
         choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        choco_string_destroy(&fs_utils.fullpath);
     }
-    {
-        // choco_string_concat() 失敗(extension concat)
-        test_call_control_t config = { 0 };
-        fs_utils_t fs_utils = { 0 };
-        choco_string_t* out_fullpath = NULL;
+}
 
+static void NO_COVERAGE test_fs_utils_fullpath_c_str(void) {
+    {
+        // fs_utils_ == NULL -> NULL
         test_fs_utils_config_reset();
-        test_filesystem_config_reset();
-        test_choco_string_config_reset();
-        test_choco_memory_config_reset();
-        test_call_control_reset(&config);
-
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
-        fs_utils.filesystem = (filesystem_t*)1;
-        fs_utils.mode = FILESYSTEM_MODE_READ;
-        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
-
-        config.fail_on_call = 2;
-        config.forced_result = (int)CHOCO_STRING_LIMIT_EXCEEDED;
-        test_choco_string_concat_config_set(&config);
 
-        assert(FS_UTILS_LIMIT_EXCEEDED == fs_utils_fullpath_get(&fs_utils, out_fullpath));
-
-        choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        assert(NULL == fs_utils_fullpath_c_str(NULL));
     }
     {
-        // 正常系(extensionあり)
+        // fs_utils_valid_check() が false -> NULL
         fs_utils_t fs_utils = { 0 };
-        choco_string_t* out_fullpath = NULL;
 
         test_fs_utils_config_reset();
-        test_filesystem_config_reset();
-        test_choco_string_config_reset();
-        test_choco_memory_config_reset();
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string(".txt", &fs_utils.extension));
-        fs_utils.filesystem = (filesystem_t*)1;
+        fs_utils.fullpath = (choco_string_t*)1;
+        fs_utils.filesystem = NULL;
         fs_utils.mode = FILESYSTEM_MODE_READ;
-        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
-
-        assert(FS_UTILS_SUCCESS == fs_utils_fullpath_get(&fs_utils, out_fullpath));
-        assert(0 == strcmp(choco_string_c_str(out_fullpath), "path/to/file.txt"));
 
-        choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.extension);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        assert(NULL == fs_utils_fullpath_c_str(&fs_utils));
     }
     {
-        // 正常系(extensionなし)
-        fs_utils_t fs_utils = { 0 };
-        choco_string_t* out_fullpath = NULL;
+        // 正常系: fs_utils_create()で組み立てたフルパスを、文字列コンテナを生成せずに取得できる
+        test_call_control_t config = { 0 };
+        fs_utils_t* fs_utils = NULL;
 
         test_fs_utils_config_reset();
         test_filesystem_config_reset();
         test_choco_string_config_reset();
         test_choco_memory_config_reset();
+        test_call_control_reset(&config);
 
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("path/to/", &fs_utils.filepath));
-        assert(CHOCO_STRING_SUCCESS == choco_string_create_from_c_string("file", &fs_utils.filename));
-        fs_utils.extension = NULL;
-        fs_utils.filesystem = (filesystem_t*)1;
-        fs_utils.mode = FILESYSTEM_MODE_READ;
-        assert(CHOCO_STRING_SUCCESS == choco_string_default_create(&out_fullpath));
+        // 実ファイル依存を避けるため filesystem_open() だけ成功注入
+        config.fail_on_call = 1;
+        config.forced_result = (int)FILESYSTEM_SUCCESS;
+        test_filesystem_open_config_set(&config);
 
-        assert(FS_UTILS_SUCCESS == fs_utils_fullpath_get(&fs_utils, out_fullpath));
-        assert(0 == strcmp(choco_string_c_str(out_fullpath), "path/to/file"));
+        assert(FS_UTILS_SUCCESS == fs_utils_create("path/to/", "file", ".txt", FILESYSTEM_MODE_READ, &fs_utils));
+        assert(0 == strcmp("path/to/file.txt", fs_utils_fullpath_c_str(fs_utils)));
+        assert(choco_string_c_str(fs_utils->fullpath) == fs_utils_fullpath_c_str(fs_utils));
 
-        choco_string_destroy(&out_fullpath);
-        choco_string_destroy(&fs_utils.filename);
-        choco_string_destroy(&fs_utils.filepath);
+        fs_utils_destroy(&fs_utils);
+        assert(NULL == fs_utils);
     }
 }
 
@@ -1450,9 +1275,7 @@ static void NO_COVERAGE test_fs_utils_valid_check(void) {
 
         {
             fs_utils_t fs_utils = { 0 };
-            fs_utils.filepath = (choco_string_t*)1;
-            fs_utils.filename = (choco_string_t*)1;
-            fs_utils.extension = NULL;
+            fs_utils.fullpath = (choco_string_t*)1;
             fs_utils.filesystem = (filesystem_t*)1;
             fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1466,26 +1289,11 @@ static void NO_COVERAGE test_fs_utils_valid_check(void) {
         assert(false == fs_utils_valid_check(NULL));
     }
     {
-        // filename == NULL
-        test_fs_utils_config_reset();
-
-        fs_utils_t fs_utils = { 0 };
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = NULL;
-        fs_utils.extension = NULL;
-        fs_utils.filesystem = (filesystem_t*)1;
-        fs_utils.mode = FILESYSTEM_MODE_READ;
-
-        assert(false == fs_utils_valid_check(&fs_utils));
-    }
-    {
-        // filepath == NULL
+        // fullpath == NULL
         test_fs_utils_config_reset();
 
         fs_utils_t fs_utils = { 0 };
-        fs_utils.filepath = NULL;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = NULL;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1496,9 +1304,7 @@ static void NO_COVERAGE test_fs_utils_valid_check(void) {
         test_fs_utils_config_reset();
 
         fs_utils_t fs_utils = { 0 };
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = NULL;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
@@ -1509,35 +1315,29 @@ static void NO_COVERAGE test_fs_utils_valid_check(void) {
         test_fs_utils_config_reset();
 
         fs_utils_t fs_utils = { 0 };
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_NONE;
 
         assert(false == fs_utils_valid_check(&fs_utils));
     }
     {
-        // 正常系(extensionあり)
+        // 正常系(FILESYSTEM_MODE_READ)
         test_fs_utils_config_reset();
 
         fs_utils_t fs_utils = { 0 };
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = (choco_string_t*)1;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ;
 
         assert(true == fs_utils_valid_check(&fs_utils));
     }
     {
-        // 正常系(extensionなし)
+        // 正常系(FILESYSTEM_MODE_READ_PLUS)
         test_fs_utils_config_reset();
 
         fs_utils_t fs_utils = { 0 };
-        fs_utils.filepath = (choco_string_t*)1;
-        fs_utils.filename = (choco_string_t*)1;
-        fs_utils.extension = NULL;
+        fs_utils.fullpath = (choco_string_t*)1;
         fs_utils.filesystem = (filesystem_t*)1;
         fs_utils.mode = FILESYSTEM_MODE_READ_PLUS;
 
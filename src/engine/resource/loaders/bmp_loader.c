@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h> // for memmove
 
 #include "engine/resource/loaders/bmp_loader.h"
 
@@ -108,7 +109,7 @@ struct bmp_loader {
 
 static resource_result_t bmp_loader_pixel_bgr_to_rgb(const info_header_t* info_header_, uint8_t* pixels_);
 static resource_result_t bmp_loader_pixel_flip(const info_header_t* info_header_, uint8_t* pixels_);
-static resource_result_t bmp_loader_padding_remove(const info_header_t* info_header_, size_t stride_, size_t padding_, const uint8_t* src_pixels_, uint8_t** dst_pixels_, size_t* out_new_size_);
+static resource_result_t bmp_loader_padding_remove(const info_header_t* info_header_, size_t stride_, size_t padding_, size_t size_, uint8_t** io_pixels_, size_t* out_new_size_);
 
 static resource_result_t header_load(const char* fullpath_, file_header_t* file_header_, info_header_t* info_header_);
 static resource_result_t pixel_load(const char* fullpath_, const file_header_t* file_header_, info_header_t* info_header_, size_t stride_, uint8_t** out_pixels_);
@@ -186,6 +187,7 @@ static void test_invalid_reason_to_str(void);
 
 // テスト用ヘルパー関数
 static void test_bmp_loader_valid_header_make(file_header_t* file_header_, info_header_t* info_header_);
+static void test_bmp_loader_pixel_buffer_make(const uint8_t* src_, size_t size_, uint8_t** out_pixels_);
 static void test_bmp_file_write(const char* filepath_, const uint8_t* data_, size_t size_);
 static void test_bmp_file_2x2_24bit_bottom_up_write(const char* filepath_);
 static void test_bmp_file_2x2_24bit_top_down_write(const char* filepath_);
@@ -263,7 +265,7 @@ void bmp_loader_destroy(bmp_loader_t** bmp_loader_) {
         return;
     }
     if(NULL != (*bmp_loader_)->pixels) {
-        memory_system_free((*bmp_loader_)->pixels, (*bmp_loader_)->info_header.bi_size_image, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned((*bmp_loader_)->pixels, (*bmp_loader_)->info_header.bi_size_image, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         (*bmp_loader_)->pixels = NULL;
     }
 
@@ -286,7 +288,6 @@ resource_result_t bmp_loader_load(const char* fullpath_, bmp_loader_t* bmp_loade
     file_header_t tmp_file_header = { 0 };
     info_header_t tmp_info_header = { 0 };
     uint8_t* tmp_pixels = NULL;
-    uint8_t* formatted_pixels = NULL;
     size_t formatted_size = 0;
     size_t width = 0;
     size_t bit_count = 0;
@@ -347,16 +348,12 @@ resource_result_t bmp_loader_load(const char* fullpath_, bmp_loader_t* bmp_loade
     }
 
     if(0 < padding) {
-        ret = bmp_loader_padding_remove(&tmp_info_header, stride, padding, tmp_pixels, &formatted_pixels, &formatted_size); // 内部でformatted_pixelsのメモリが確保されるが、失敗時には解放される
+        ret = bmp_loader_padding_remove(&tmp_info_header, stride, padding, tmp_info_header.bi_size_image, &tmp_pixels, &formatted_size);  // tmp_pixelsはその場で縮小される(失敗時もtmp_pixelsのサイズは不変)
         if(RESOURCE_SUCCESS != ret) {
             ERROR_MESSAGE("bmp_loader_load(%s) - Failed to remove BMP row padding.", resource_rslt_to_str(ret));
             goto cleanup;
         }
-        memory_system_free(tmp_pixels, tmp_info_header.bi_size_image, MEMORY_TAG_TEXTURE);
-        tmp_pixels = NULL;
-        tmp_pixels = formatted_pixels;
-        formatted_pixels = NULL;
-        tmp_info_header.bi_size_image = formatted_size;
+        tmp_info_header.bi_size_image = (uint32_t)formatted_size;
     }
 
     ret = bmp_loader_pixel_bgr_to_rgb(&tmp_info_header, tmp_pixels);
@@ -384,12 +381,8 @@ resource_result_t bmp_loader_load(const char* fullpath_, bmp_loader_t* bmp_loade
 
 cleanup:
     if(RESOURCE_SUCCESS != ret) {
-        if(NULL != formatted_pixels && 0 != formatted_size) {
-            memory_system_free(formatted_pixels, formatted_size, MEMORY_TAG_TEXTURE);
-            formatted_pixels = NULL;
-        }
         if(NULL != tmp_pixels) {
-            memory_system_free(tmp_pixels, tmp_info_header.bi_size_image, MEMORY_TAG_TEXTURE);
+            memory_system_free_aligned(tmp_pixels, tmp_info_header.bi_size_image, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
             tmp_pixels = NULL;
         }
     }
@@ -638,21 +631,29 @@ cleanup:
 /**
  * @brief 読み込んだピクセルデータからpaddingを除去する
  *
+ * @details
+ * 各行をバッファ先頭側へ詰めてpaddingを除去した後、memory_system_reallocate_alignedでバッファを縮小する \n
+ * 縮小はその場で行われるため、新規バッファの確保とコピーは発生しない(割り当て元がmallocへのフォールバック領域の場合を除く)
+ *
  * @warning 24bit BMPデータ専用, 32bitではpaddingが発生しないため、呼び出し対象外で、RESOURCE_BAD_OPERATIONを返す
- * @note 処理に失敗した場合、out引数は不変
+ * @note
+ * - *io_pixels_はmemory_system_allocate_aligned(RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE)で確保したsize_のバッファであること
+ * - 処理に失敗した場合、*io_pixels_のアドレスとサイズ、*out_new_size_は不変
+ * - ただし、バッファの縮小に失敗した場合はpadding除去途中の内容となるため、呼び出し側でバッファを破棄すること
  *
  * @param[in] info_header_ INFOHEADER構造体インスタンスへのポインタ
  * @param[in] stride_ BMPファイルの各行のサイズ(byte)
  * @param[in] padding_ パディングサイズ
- * @param[in] src_pixels_ padding除去前のピクセルデータ
- * @param[out] dst_pixels_ padding除去後のピクセルデータ
+ * @param[in] size_ padding除去前のピクセルデータサイズ(byte)
+ * @param[in,out] io_pixels_ padding除去対象のピクセルデータ(処理後はpadding除去後のピクセルデータ)
  * @param[out] out_new_size_ padding除去後のピクセルデータサイズ(byte)
  *
  * @retval RESOURCE_INVALID_ARGUMENT 以下のいずれか
  * - info_header_ == NULL
- * - src_pixels_ == NULL
- * - dst_pixels_ == NULL
+ * - io_pixels_ == NULL
+ * - *io_pixels_ == NULL
  * - out_new_size_ == NULL
+ * @retval RESOURCE_DATA_CORRUPTED size_がpadding除去前のピクセルデータサイズ(height * (width * 3 + padding_))未満
  * @retval RESOURCE_BAD_OPERATION 以下のいずれか
  * - stride_ == 0
  * - padding_ == 0
@@ -665,7 +666,7 @@ cleanup:
  * @retval RESOURCE_NO_MEMORY メモリ確保失敗
  * @retval RESOURCE_SUCCESS 処理に成功し、正常終了
  */
-static resource_result_t bmp_loader_padding_remove(const info_header_t* info_header_, size_t stride_, size_t padding_, const uint8_t* src_pixels_, uint8_t** dst_pixels_, size_t* out_new_size_) {
+static resource_result_t bmp_loader_padding_remove(const info_header_t* info_header_, size_t stride_, size_t padding_, size_t size_, uint8_t** io_pixels_, size_t* out_new_size_) {
 #ifdef TEST_BUILD
     s_test_config_bmp_loader_padding_remove.call_count++;
     if(s_test_config_bmp_loader_padding_remove.fail_on_call != 0) {
@@ -677,13 +678,14 @@ static resource_result_t bmp_loader_padding_remove(const info_header_t* info_hea
     resource_result_t ret = RESOURCE_INVALID_ARGUMENT;
     memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
 
+    uint8_t* pixels = NULL;
     uint8_t* new_pixel = NULL;
     size_t new_size = 0;
+    size_t row_size = 0;
 
     IF_ARG_NULL_GOTO_CLEANUP(info_header_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "info_header_")
-    IF_ARG_NULL_GOTO_CLEANUP(src_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "src_pixels_")
-    IF_ARG_NULL_GOTO_CLEANUP(dst_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "dst_pixels_")
-    IF_ARG_NOT_NULL_GOTO_CLEANUP(*dst_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "*dst_pixels_")
+    IF_ARG_NULL_GOTO_CLEANUP(io_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "io_pixels_")
+    IF_ARG_NULL_GOTO_CLEANUP(*io_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "*io_pixels_")
     IF_ARG_NULL_GOTO_CLEANUP(out_new_size_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "bmp_loader_padding_remove", "out_new_size_")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != stride_, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "bmp_loader_padding_remove", "stride_")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != padding_, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "bmp_loader_padding_remove", "padding_")
@@ -714,38 +716,37 @@ static resource_result_t bmp_loader_padding_remove(const info_header_t* info_hea
         ERROR_MESSAGE("bmp_loader_padding_remove(%s) - BMP output image size exceeds uint32_t range. output_size=%zu, limit=%u", resource_rslt_to_str(ret), new_size, UINT32_MAX);
         goto cleanup;
     }
-    ret_mem = memory_system_allocate(new_size, MEMORY_TAG_TEXTURE, (void**)&new_pixel);
-    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
-        ret = resource_rslt_convert_choco_memory(ret_mem);
-        ERROR_MESSAGE("bmp_loader_padding_remove(%s) - Failed to allocate memory for new_pixel.", resource_rslt_to_str(ret));
+    row_size = width * channel_count;
+    if((SIZE_MAX - padding_) < row_size || (SIZE_MAX / height) < (row_size + padding_)) {
+        ret = RESOURCE_OVERFLOW;
+        ERROR_MESSAGE("bmp_loader_padding_remove(%s) - Failed to calculate BMP source image size: height * (row_size + padding) would overflow. row_size=%zu, padding=%zu, height=%zu", resource_rslt_to_str(ret), row_size, padding_, height);
+        goto cleanup;
+    }
+    if(size_ < height * (row_size + padding_)) {
+        ret = RESOURCE_DATA_CORRUPTED;
+        ERROR_MESSAGE("bmp_loader_padding_remove(%s) - Source pixel buffer is too small. size=%zu, expected=%zu", resource_rslt_to_str(ret), size_, height * (row_size + padding_));
         goto cleanup;
     }
 
-    size_t ii = 0;
-    size_t ii_new = 0;
-    for(size_t i = 0; i != height; ++i) {
-        for(size_t j = 0; j != width; ++j) {
-            for(size_t k = 0; k != channel_count; ++k) {
-                new_pixel[ii_new + k] = src_pixels_[ii + k];
-            }
-            ii_new += channel_count;
-            ii += channel_count;
-        }
-        ii += padding_;
+    // 各行をバッファ先頭側へ詰める(転送先は常に転送元以前なので、先頭行から処理すれば未処理の行を上書きしない)
+    pixels = *io_pixels_;
+    for(size_t i = 1; i < height; ++i) {
+        memmove(pixels + i * row_size, pixels + i * (row_size + padding_), row_size);
     }
 
-    *dst_pixels_ = new_pixel;
+    ret_mem = memory_system_reallocate_aligned(pixels, size_, new_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE, (void**)&new_pixel);
+    if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
+        ret = resource_rslt_convert_choco_memory(ret_mem);
+        ERROR_MESSAGE("bmp_loader_padding_remove(%s) - Failed to shrink pixel buffer.", resource_rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    *io_pixels_ = new_pixel;
     *out_new_size_ = new_size;
 
     ret = RESOURCE_SUCCESS;
 
 cleanup:
-    if(RESOURCE_SUCCESS != ret) {
-        if(NULL != new_pixel) {
-            memory_system_free(new_pixel, new_size, MEMORY_TAG_TEXTURE);
-            new_pixel = NULL;
-        }
-    }
     return ret;
 }
 
@@ -965,7 +966,7 @@ static resource_result_t pixel_load(const char* fullpath_, const file_header_t*
         goto cleanup;
     }
 
-    ret_mem = memory_system_allocate(pixel_buffer_size, MEMORY_TAG_TEXTURE, (void**)&tmp_pixels);
+    ret_mem = memory_system_allocate_aligned(pixel_buffer_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE, (void**)&tmp_pixels);
     if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
         ret = resource_rslt_convert_choco_memory(ret_mem);
         ERROR_MESSAGE("pixel_load(%s) - Failed to allocate memory for tmp_pixels.", resource_rslt_to_str(ret));
@@ -992,7 +993,7 @@ cleanup:
             tmp_buffer = NULL;
         }
         if(NULL != tmp_pixels) {
-            memory_system_free(tmp_pixels, pixel_buffer_size, MEMORY_TAG_TEXTURE);
+            memory_system_free_aligned(tmp_pixels, pixel_buffer_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
             tmp_pixels = NULL;
         }
     }
@@ -1510,7 +1511,7 @@ static void NO_COVERAGE test_bmp_loader_destroy(void) {
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != loader);
 
-        ret_mem = memory_system_allocate(pixel_size, MEMORY_TAG_TEXTURE, (void**)&loader->pixels);
+        ret_mem = memory_system_allocate_aligned(pixel_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE, (void**)&loader->pixels);
         assert(MEMORY_SYSTEM_SUCCESS == ret_mem);
         assert(NULL != loader->pixels);
 
@@ -3075,10 +3076,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // bmp_loader_padding_remove() 冒頭で強制的に RESOURCE_NO_MEMORY を返させる
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
 
-        const uint8_t src_pixels[16] = {
+        uint8_t src_pixels[16] = {
             0xFF, 0x00, 0x00,
             0xFF, 0xFF, 0xFF,
             0x00, 0x00,
@@ -3087,6 +3087,7 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
             0x00, 0xFF, 0x00,
             0x00, 0x00
         };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3096,9 +3097,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         s_test_config_bmp_loader_padding_remove.fail_on_call = 1U;
         s_test_config_bmp_loader_padding_remove.forced_result = (int)RESOURCE_NO_MEMORY;
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_NO_MEMORY == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3107,26 +3108,25 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
     {
         // info_header_ == NULL -> RESOURCE_INVALID_ARGUMENT
         resource_result_t ret = RESOURCE_SUCCESS;
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
 
-        ret = bmp_loader_padding_remove(NULL, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(NULL, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_INVALID_ARGUMENT == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
     }
     {
-        // src_pixels_ == NULL -> RESOURCE_INVALID_ARGUMENT
+        // io_pixels_ == NULL -> RESOURCE_INVALID_ARGUMENT
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
 
         test_bmp_loader_config_reset();
@@ -3134,50 +3134,28 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, NULL, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, 16U, NULL, &out_new_size);
         assert(RESOURCE_INVALID_ARGUMENT == ret);
-        assert(NULL == dst_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
     }
     {
-        // dst_pixels_ == NULL -> RESOURCE_INVALID_ARGUMENT
+        // *io_pixels_ == NULL -> RESOURCE_INVALID_ARGUMENT
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
+        uint8_t* io_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, NULL, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, 16U, &io_pixels, &out_new_size);
         assert(RESOURCE_INVALID_ARGUMENT == ret);
-        assert(123U == out_new_size);
-
-        test_bmp_loader_config_reset();
-        test_choco_memory_config_reset();
-    }
-    {
-        // *dst_pixels_ != NULL -> RESOURCE_INVALID_ARGUMENT
-        resource_result_t ret = RESOURCE_SUCCESS;
-        info_header_t info_header = { 0 };
-        uint8_t dummy = 0U;
-        uint8_t* dst_pixels = &dummy;
-        size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
-
-        test_bmp_loader_config_reset();
-        test_choco_memory_config_reset();
-
-        test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
-
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
-        assert(RESOURCE_INVALID_ARGUMENT == ret);
-        assert(&dummy == dst_pixels);
+        assert(NULL == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3187,17 +3165,17 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // out_new_size_ == NULL -> RESOURCE_INVALID_ARGUMENT
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, NULL);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, NULL);
         assert(RESOURCE_INVALID_ARGUMENT == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3206,18 +3184,18 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // stride_ == 0 -> RESOURCE_BAD_OPERATION
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
 
-        ret = bmp_loader_padding_remove(&info_header, 0U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 0U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_BAD_OPERATION == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3227,18 +3205,18 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // padding_ == 0 -> RESOURCE_BAD_OPERATION
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 0U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 0U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_BAD_OPERATION == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3248,9 +3226,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // info_header_->bi_width == 0 -> RESOURCE_BAD_OPERATION
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3258,9 +3236,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
         info_header.bi_width = 0;
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_BAD_OPERATION == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3270,9 +3248,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // info_header_->bi_height == 0 -> RESOURCE_BAD_OPERATION
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3280,9 +3258,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
         info_header.bi_height = 0;
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_BAD_OPERATION == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3292,9 +3270,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // info_header_->bi_bit_count != 24 -> RESOURCE_BAD_OPERATION
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[16] = { 0 };
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3302,9 +3280,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
         info_header.bi_bit_count = 32U;
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_BAD_OPERATION == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3315,9 +3293,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // 防御的分岐の確認。通常は is_bmp_supported() 済みのinfo_headerでは到達しない。
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[1] = { 0 };
+        uint8_t src_pixels[1] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3327,9 +3305,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         info_header.bi_height = 2;
         info_header.bi_bit_count = 24U;
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_OVERFLOW == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
@@ -3340,9 +3318,9 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // 防御的分岐の確認。通常は is_bmp_supported() 済みのinfo_headerでは到達しない。
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
         size_t out_new_size = 123U;
-        const uint8_t src_pixels[1] = { 0 };
+        uint8_t src_pixels[1] = { 0 };
+        uint8_t* io_pixels = src_pixels;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3352,19 +3330,42 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         info_header.bi_height = 1;
         info_header.bi_bit_count = 24U;
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_OVERFLOW == ret);
-        assert(NULL == dst_pixels);
+        assert(src_pixels == io_pixels);
+        assert(123U == out_new_size);
+
+        test_bmp_loader_config_reset();
+        test_choco_memory_config_reset();
+    }
+    {
+        // size_ がpadding除去前のピクセルデータサイズ未満 -> RESOURCE_DATA_CORRUPTED
+        resource_result_t ret = RESOURCE_SUCCESS;
+        info_header_t info_header = { 0 };
+        size_t out_new_size = 123U;
+        uint8_t src_pixels[16] = { 0 };
+        uint8_t* io_pixels = src_pixels;
+
+        test_bmp_loader_config_reset();
+        test_choco_memory_config_reset();
+
+        test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
+
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels) - 1U, &io_pixels, &out_new_size);
+        assert(RESOURCE_DATA_CORRUPTED == ret);
+        assert(src_pixels == io_pixels);
         assert(123U == out_new_size);
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
     }
     {
-        // new_pixel用 memory_system_allocate() 失敗 -> RESOURCE_NO_MEMORY
+        // ピクセルバッファ縮小用 memory_system_reallocate_aligned() 失敗 -> RESOURCE_NO_MEMORY
+        // バッファのアドレスとサイズは不変(内容はpadding除去途中)
         resource_result_t ret = RESOURCE_SUCCESS;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
+        uint8_t* io_pixels = NULL;
+        uint8_t* org_pixels = NULL;
         size_t out_new_size = 123U;
         test_call_control_t config = { 0 };
 
@@ -3382,16 +3383,21 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         test_choco_memory_config_reset();
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
+        test_bmp_loader_pixel_buffer_make(src_pixels, sizeof(src_pixels), &io_pixels);
+        org_pixels = io_pixels;
 
         config.fail_on_call = 1U;
         config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
-        test_memory_system_allocate_config_set(&config);
+        test_memory_system_reallocate_aligned_config_set(&config);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_NO_MEMORY == ret);
-        assert(NULL == dst_pixels);
+        assert(org_pixels == io_pixels);
         assert(123U == out_new_size);
 
+        memory_system_free_aligned(io_pixels, sizeof(src_pixels), RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
+        io_pixels = NULL;
+
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
     }
@@ -3400,7 +3406,7 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // padding 2byte/row を除去し、生のBGRピクセル順序は維持する
         resource_result_t ret = RESOURCE_INVALID_ARGUMENT;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
+        uint8_t* io_pixels = NULL;
         size_t out_new_size = 0U;
 
         const uint8_t src_pixels[16] = {
@@ -3429,15 +3435,17 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         test_choco_memory_config_reset();
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
+        test_bmp_loader_pixel_buffer_make(src_pixels, sizeof(src_pixels), &io_pixels);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_SUCCESS == ret);
-        assert(NULL != dst_pixels);
+        assert(NULL != io_pixels);
+        assert(0U == ((uintptr_t)io_pixels % RESOURCE_PIXEL_ALIGNMENT));
         assert(12U == out_new_size);
-        assert(0 == memcmp(dst_pixels, expected_pixels, sizeof(expected_pixels)));
+        assert(0 == memcmp(io_pixels, expected_pixels, sizeof(expected_pixels)));
 
-        memory_system_free(dst_pixels, out_new_size, MEMORY_TAG_TEXTURE);
-        dst_pixels = NULL;
+        memory_system_free_aligned(io_pixels, out_new_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
+        io_pixels = NULL;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -3447,7 +3455,7 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
         // padding除去のみを行い、行順は変更しない
         resource_result_t ret = RESOURCE_INVALID_ARGUMENT;
         info_header_t info_header = { 0 };
-        uint8_t* dst_pixels = NULL;
+        uint8_t* io_pixels = NULL;
         size_t out_new_size = 0U;
 
         const uint8_t src_pixels[16] = {
@@ -3477,15 +3485,16 @@ static void NO_COVERAGE test_bmp_loader_padding_remove(void) {
 
         test_bmp_loader_valid_header_make(&(file_header_t){0}, &info_header);
         info_header.bi_height = -2;
+        test_bmp_loader_pixel_buffer_make(src_pixels, sizeof(src_pixels), &io_pixels);
 
-        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, src_pixels, &dst_pixels, &out_new_size);
+        ret = bmp_loader_padding_remove(&info_header, 8U, 2U, sizeof(src_pixels), &io_pixels, &out_new_size);
         assert(RESOURCE_SUCCESS == ret);
-        assert(NULL != dst_pixels);
+        assert(NULL != io_pixels);
         assert(12U == out_new_size);
-        assert(0 == memcmp(dst_pixels, expected_pixels, sizeof(expected_pixels)));
+        assert(0 == memcmp(io_pixels, expected_pixels, sizeof(expected_pixels)));
 
-        memory_system_free(dst_pixels, out_new_size, MEMORY_TAG_TEXTURE);
-        dst_pixels = NULL;
+        memory_system_free_aligned(io_pixels, out_new_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
+        io_pixels = NULL;
 
         test_bmp_loader_config_reset();
         test_choco_memory_config_reset();
@@ -4131,11 +4140,8 @@ static void NO_COVERAGE test_pixel_load(void) {
         test_choco_memory_config_reset();
     }
     {
-        // tmp_pixels用 memory_system_allocate() 失敗 -> RESOURCE_NO_MEMORY
-        // memory_system_allocate() 呼び出し順:
-        // 1回目: tmp_buffer
-        // 2回目: filesystem_create() 内部
-        // 3回目: tmp_pixels
+        // tmp_pixels用 memory_system_allocate_aligned() 失敗 -> RESOURCE_NO_MEMORY
+        // ピクセルデータはmemory_system_allocate_aligned()で確保するため、1回目の呼び出しがtmp_pixelsとなる
         resource_result_t ret = RESOURCE_SUCCESS;
         file_header_t file_header = { 0 };
         info_header_t info_header = { 0 };
@@ -4149,9 +4155,9 @@ static void NO_COVERAGE test_pixel_load(void) {
         test_bmp_loader_valid_header_make(&file_header, &info_header);
         test_bmp_file_2x2_24bit_bottom_up_write("test_bmp_loader_pixel_2x2_24bit_bottom_up.bmp");
 
-        config.fail_on_call = 3U;
+        config.fail_on_call = 1U;
         config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
-        test_memory_system_allocate_config_set(&config);
+        test_memory_system_allocate_aligned_config_set(&config);
 
         ret = pixel_load("test_bmp_loader_pixel_2x2_24bit_bottom_up.bmp", &file_header, &info_header, 8U, &pixels);
         assert(RESOURCE_NO_MEMORY == ret);
@@ -4194,7 +4200,7 @@ static void NO_COVERAGE test_pixel_load(void) {
         assert(16U == info_header.bi_size_image);
         assert(0 == memcmp(pixels, expected_pixels, sizeof(expected_pixels)));
 
-        memory_system_free(pixels, info_header.bi_size_image, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(pixels, info_header.bi_size_image, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         pixels = NULL;
 
         remove("test_bmp_loader_pixel_2x2_24bit_bottom_up.bmp");
@@ -4235,7 +4241,7 @@ static void NO_COVERAGE test_pixel_load(void) {
         assert(16U == info_header.bi_size_image);
         assert(0 == memcmp(pixels, expected_pixels, sizeof(expected_pixels)));
 
-        memory_system_free(pixels, info_header.bi_size_image, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(pixels, info_header.bi_size_image, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         pixels = NULL;
 
         remove("test_bmp_loader_pixel_2x2_24bit_top_down.bmp");
@@ -5162,6 +5168,16 @@ static void NO_COVERAGE test_bmp_loader_valid_header_make(file_header_t* file_he
     info_header_->bi_clr_important = 0;
 }
 
+static void NO_COVERAGE test_bmp_loader_pixel_buffer_make(const uint8_t* src_, size_t size_, uint8_t** out_pixels_) {
+    assert(NULL != src_);
+    assert(0U != size_);
+    assert(NULL != out_pixels_);
+
+    *out_pixels_ = NULL;
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate_aligned(size_, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE, (void**)out_pixels_));
+    memcpy(*out_pixels_, src_, size_);
+}
+
 // Generated by ChatGPT
 static void NO_COVERAGE test_bmp_file_write(const char* filepath_, const uint8_t* data_, size_t size_) {
     FILE* fp = NULL;
@@ -28,6 +28,7 @@
 #include "engine/io_utils/fs_utils/fs_utils.h"
 
 #include "engine/containers/choco_string.h"
+#include "engine/containers/string_intern.h"
 
 #include "engine/resource/resource_core/resource_types.h"
 #include "engine/resource/resource_core/resource_err_utils.h"
@@ -49,7 +50,7 @@ typedef enum {
  *
  */
 struct texture {
-    choco_string_t* name;   /**< テクスチャCPU側リソース名称 */
+    string_atom_t name_atom;    /**< テクスチャCPU側リソース名称のアトム(文字列インターンテーブルに登録) */
 
     uint16_t width;         /**< テクスチャ幅 */
     uint16_t height;        /**< テクスチャ高さ(左上原点の画像を基準にする) */
@@ -74,6 +75,7 @@ static resource_result_t test_texture_generate(test_texture_t test_texture_color
 
 #include "engine/core/memory/test_choco_memory.h"
 #include "engine/containers/test_choco_string.h"
+#include "engine/containers/test_string_intern.h"
 #include "engine/io_utils/fs_utils/test_fs_utils.h"
 #include "engine/resource/loaders/test_bmp_loader.h"
 
@@ -98,6 +100,7 @@ static void test_texture_pixel_unload(void);
 static void test_texture_pixel_get(void);
 static void test_texture_pixel_size_get(void);
 static void test_texture_name_get(void);
+static void test_texture_name_atom_get(void);
 static void test_bmp_load(void);
 static void test_test_texture_generate(void);
 
@@ -132,13 +135,13 @@ resource_result_t texture_create(const char* name_, texture_t** texture_) {
         ERROR_MESSAGE("texture_create(%s) - Failed to allocate memory for texture_t.", resource_rslt_to_str(ret));
         goto cleanup;
     }
-    tmp->name = NULL;
+    tmp->name_atom = STRING_ATOM_INVALID;
     tmp->channel_count = 0;
     tmp->height = 0;
     tmp->width = 0;
     tmp->pixels = NULL;
 
-    ret_string = choco_string_create_from_c_string(name_, &tmp->name);
+    ret_string = string_intern_acquire(name_, &tmp->name_atom);
     if(CHOCO_STRING_SUCCESS != ret_string) {
         ret = resource_rslt_convert_choco_string(ret_string);
         ERROR_MESSAGE("texture_create(%s) - Failed to create texture name.", resource_rslt_to_str(ret));
@@ -151,9 +154,7 @@ resource_result_t texture_create(const char* name_, texture_t** texture_) {
 cleanup:
     if(RESOURCE_SUCCESS != ret) {
         if(NULL != tmp) {
-            if(NULL != tmp->name) {
-                choco_string_destroy(&tmp->name);
-            }
+            string_intern_release(tmp->name_atom);
             memory_system_free(tmp, sizeof(texture_t), MEMORY_TAG_TEXTURE);
             tmp = NULL;
         }
@@ -172,18 +173,14 @@ void texture_destroy(texture_t** texture_) {
     if(NULL != (*texture_)->pixels) {
         ret = texture_pixel_unload(*texture_);
         if(RESOURCE_SUCCESS != ret) {
-            const char* texture_name = NULL;
-            if(NULL == (*texture_)->name) {
+            const char* texture_name = string_intern_c_str((*texture_)->name_atom);
+            if(NULL == texture_name) {
                 texture_name = "corrupted";
-            } else {
-                texture_name = choco_string_c_str((*texture_)->name);
             }
             WARN_MESSAGE("texture_destroy(%s) - Failed to unload texture pixels during destroy. texture_name = '%s'. Continue destroying texture object.", resource_rslt_to_str(ret), texture_name);
         }
     }
-    if(NULL != (*texture_)->name) {
-        choco_string_destroy(&(*texture_)->name);
-    }
+    string_intern_release((*texture_)->name_atom);
 
     memory_system_free(*texture_, sizeof(texture_t), MEMORY_TAG_TEXTURE);
     *texture_ = NULL;
@@ -200,7 +197,6 @@ resource_result_t texture_pixel_load(texture_t* texture_, const char* filepath_,
 #endif
     resource_result_t ret = RESOURCE_INVALID_ARGUMENT;
     fs_utils_result_t ret_fs_utils = FS_UTILS_INVALID_ARGUMENT;
-    choco_string_result_t ret_string = CHOCO_STRING_INVALID_ARGUMENT;
 
     uint16_t tmp_width = 0;
     uint16_t tmp_height = 0;
@@ -208,62 +204,47 @@ resource_result_t texture_pixel_load(texture_t* texture_, const char* filepath_,
     uint8_t* tmp_pixels = NULL;
 
     fs_utils_t* fs_utils = NULL;
-    choco_string_t* fullpath = NULL;
 
     IF_ARG_NULL_GOTO_CLEANUP(texture_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "texture_pixel_load", "texture_")
-    IF_ARG_NULL_GOTO_CLEANUP(texture_->name, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_load", "texture_->name")
+    IF_ARG_FALSE_GOTO_CLEANUP(STRING_ATOM_INVALID != texture_->name_atom, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_load", "texture_->name_atom")
     IF_ARG_NOT_NULL_GOTO_CLEANUP(texture_->pixels, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_load", "texture_->pixels")
     IF_ARG_FALSE_GOTO_CLEANUP(0 == texture_->channel_count, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_load", "0 != texture_->channel_count")
     IF_ARG_FALSE_GOTO_CLEANUP(0 == texture_->width, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_load", "0 != texture_->width")
     IF_ARG_FALSE_GOTO_CLEANUP(0 == texture_->height, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_load", "0 != texture_->height")
 
-    if(choco_string_equal("test_texture_red", choco_string_c_str(texture_->name))) {
+    if(choco_string_equal("test_texture_red", string_intern_c_str(texture_->name_atom))) {
         ret = test_texture_generate(TEST_TEXTURE_RED, &tmp_width, &tmp_height, &tmp_channel_count, &tmp_pixels);
         if(RESOURCE_SUCCESS != ret) {
             ERROR_MESSAGE("texture_pixel_load(%s) - Failed to create red test texture.", resource_rslt_to_str(ret));
             goto cleanup;
         }
-    } else if(choco_string_equal("test_texture_green", choco_string_c_str(texture_->name))) {
+    } else if(choco_string_equal("test_texture_green", string_intern_c_str(texture_->name_atom))) {
         ret = test_texture_generate(TEST_TEXTURE_GREEN, &tmp_width, &tmp_height, &tmp_channel_count, &tmp_pixels);
         if(RESOURCE_SUCCESS != ret) {
             ERROR_MESSAGE("texture_pixel_load(%s) - Failed to create green test texture.", resource_rslt_to_str(ret));
             goto cleanup;
         }
-    } else if(choco_string_equal("test_texture_blue", choco_string_c_str(texture_->name))) {
+    } else if(choco_string_equal("test_texture_blue", string_intern_c_str(texture_->name_atom))) {
         ret = test_texture_generate(TEST_TEXTURE_BLUE, &tmp_width, &tmp_height, &tmp_channel_count, &tmp_pixels);
         if(RESOURCE_SUCCESS != ret) {
             ERROR_MESSAGE("texture_pixel_load(%s) - Failed to create blue test texture.", resource_rslt_to_str(ret));
             goto cleanup;
         }
     } else if(choco_string_equal(".bmp", extension_)) { // NOTE: choco_string_equalは引数 == NULLでfalse
-        ret_fs_utils = fs_utils_create(filepath_, choco_string_c_str(texture_->name), extension_, FILESYSTEM_MODE_READ, &fs_utils);
+        ret_fs_utils = fs_utils_create(filepath_, string_intern_c_str(texture_->name_atom), extension_, FILESYSTEM_MODE_READ, &fs_utils);
         if(FS_UTILS_SUCCESS != ret_fs_utils) {
             ret = resource_rslt_convert_fs_utils(ret_fs_utils);
             ERROR_MESSAGE("texture_pixel_load(%s) - Failed to create fs_utils.", resource_rslt_to_str(ret));
             goto cleanup;
         }
 
-        ret_string = choco_string_default_create(&fullpath);
-        if(CHOCO_STRING_SUCCESS != ret_string) {
-            ret = resource_rslt_convert_choco_string(ret_string);
-            ERROR_MESSAGE("texture_pixel_load(%s) - Failed to create fullpath.", resource_rslt_to_str(ret));
-            goto cleanup;
-        }
-
-        ret_fs_utils = fs_utils_fullpath_get(fs_utils, fullpath);
-        if(FS_UTILS_SUCCESS != ret_fs_utils) {
-            ret = resource_rslt_convert_fs_utils(ret_fs_utils);
-            ERROR_MESSAGE("texture_pixel_load(%s) - Failed to create fullpath.", resource_rslt_to_str(ret));
-            goto cleanup;
-        }
-
-        ret = bmp_load(choco_string_c_str(fullpath), &tmp_width, &tmp_height, &tmp_channel_count, &tmp_pixels);
+        // フルパスはfs_utilsが保持する文字列を直接参照する(フルパス用の文字列コンテナは生成しない)
+        ret = bmp_load(fs_utils_fullpath_c_str(fs_utils), &tmp_width, &tmp_height, &tmp_channel_count, &tmp_pixels);
         if(RESOURCE_SUCCESS != ret) {
             ERROR_MESSAGE("texture_pixel_load(%s) - Failed to load BMP texture.", resource_rslt_to_str(ret));
             goto cleanup;
         }
 
-        choco_string_destroy(&fullpath);
         fs_utils_destroy(&fs_utils);
     } else {
         ret = RESOURCE_UNSUPPORTED_FILE;
@@ -281,7 +262,6 @@ resource_result_t texture_pixel_load(texture_t* texture_, const char* filepath_,
 
 cleanup:
     if(RESOURCE_SUCCESS != ret) {
-        choco_string_destroy(&fullpath);
         fs_utils_destroy(&fs_utils);
     }
     return ret;
@@ -299,13 +279,13 @@ resource_result_t texture_pixel_unload(texture_t* texture_) {
     resource_result_t ret = RESOURCE_INVALID_ARGUMENT;
 
     IF_ARG_NULL_GOTO_CLEANUP(texture_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "texture_pixel_unload", "texture_")
-    IF_ARG_NULL_GOTO_CLEANUP(texture_->name, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_unload", "texture_->name")
+    IF_ARG_FALSE_GOTO_CLEANUP(STRING_ATOM_INVALID != texture_->name_atom, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_unload", "texture_->name_atom")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->channel_count, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_unload", "texture_->channel_count")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->height, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_unload", "texture_->height")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->width, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_unload", "texture_->width")
     IF_ARG_NULL_GOTO_CLEANUP(texture_->pixels, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_unload", "texture_->pixels")
 
-    memory_system_free(texture_->pixels, (size_t)texture_->width * (size_t)texture_->height * (size_t)texture_->channel_count, MEMORY_TAG_TEXTURE);
+    memory_system_free_aligned(texture_->pixels, (size_t)texture_->width * (size_t)texture_->height * (size_t)texture_->channel_count, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
     texture_->pixels = NULL;
     texture_->channel_count = 0;
     texture_->width = 0;
@@ -334,7 +314,7 @@ resource_result_t texture_pixel_get(const texture_t* texture_, uint8_t** out_pix
     IF_ARG_NULL_GOTO_CLEANUP(texture_->pixels, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_get", "texture_->pixels")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->width, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_get", "texture_->width")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->height, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_get", "texture_->height")
-    IF_ARG_NULL_GOTO_CLEANUP(texture_->name, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_get", "texture_->name")
+    IF_ARG_FALSE_GOTO_CLEANUP(STRING_ATOM_INVALID != texture_->name_atom, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_get", "texture_->name_atom")
 
     *out_pixels_ = texture_->pixels;
 
@@ -363,7 +343,7 @@ resource_result_t texture_pixel_size_get(const texture_t* texture_, uint16_t* wi
     IF_ARG_NULL_GOTO_CLEANUP(texture_->pixels, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_size_get", "texture_->pixels")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->width, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_size_get", "texture_->width")
     IF_ARG_FALSE_GOTO_CLEANUP(0 != texture_->height, ret, RESOURCE_BAD_OPERATION, resource_rslt_to_str(RESOURCE_BAD_OPERATION), "texture_pixel_size_get", "texture_->height")
-    IF_ARG_NULL_GOTO_CLEANUP(texture_->name, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_size_get", "texture_->name")
+    IF_ARG_FALSE_GOTO_CLEANUP(STRING_ATOM_INVALID != texture_->name_atom, ret, RESOURCE_DATA_CORRUPTED, resource_rslt_to_str(RESOURCE_DATA_CORRUPTED), "texture_pixel_size_get", "texture_->name_atom")
 
     *width_ = texture_->width;
     *height_ = texture_->height;
@@ -379,11 +359,22 @@ const char* texture_name_get(const texture_t* texture_) {
     if(NULL == texture_) {
         return NULL;
     }
-    if(NULL == texture_->name) {
+    if(NULL == string_intern_c_str(texture_->name_atom)) {
         WARN_MESSAGE("texture_name_get - Provided texture is corrupted.");
         return NULL;
     }
-    return choco_string_c_str(texture_->name);
+    return string_intern_c_str(texture_->name_atom);
+}
+
+string_atom_t texture_name_atom_get(const texture_t* texture_) {
+    if(NULL == texture_) {
+        return STRING_ATOM_INVALID;
+    }
+    if(NULL == string_intern_c_str(texture_->name_atom)) {
+        WARN_MESSAGE("texture_name_atom_get - Provided texture is corrupted.");
+        return STRING_ATOM_INVALID;
+    }
+    return texture_->name_atom;
 }
 
 /**
@@ -534,7 +525,7 @@ static resource_result_t test_texture_generate(test_texture_t test_texture_color
     IF_ARG_NULL_GOTO_CLEANUP(out_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "test_texture_generate", "out_pixels_")
     IF_ARG_NOT_NULL_GOTO_CLEANUP(*out_pixels_, ret, RESOURCE_INVALID_ARGUMENT, resource_rslt_to_str(RESOURCE_INVALID_ARGUMENT), "test_texture_generate", "*out_pixels_")
 
-    ret_mem = memory_system_allocate(pixel_size, MEMORY_TAG_TEXTURE, (void**)&tmp_pixels);
+    ret_mem = memory_system_allocate_aligned(pixel_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE, (void**)&tmp_pixels);
     if(MEMORY_SYSTEM_SUCCESS != ret_mem) {
         ret = resource_rslt_convert_choco_memory(ret_mem);
         ERROR_MESSAGE("test_texture_generate(%s) - Failed to allocate memory for pixels.", resource_rslt_to_str(ret));
@@ -569,7 +560,7 @@ static resource_result_t test_texture_generate(test_texture_t test_texture_color
 cleanup:
     if(RESOURCE_SUCCESS != ret) {
         if(NULL != tmp_pixels) {
-            memory_system_free(tmp_pixels, pixel_size, MEMORY_TAG_TEXTURE);
+            memory_system_free_aligned(tmp_pixels, pixel_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
             tmp_pixels = NULL;
         }
     }
@@ -642,6 +633,7 @@ void NO_COVERAGE test_texture(void) {
     test_texture_pixel_get();
     test_texture_pixel_size_get();
     test_texture_name_get();
+    test_texture_name_atom_get();
     test_bmp_load();
     test_test_texture_generate();
 }
@@ -743,26 +735,27 @@ static void NO_COVERAGE test_texture_create(void) {
         test_choco_string_config_reset();
     }
     {
-        // choco_string_create_from_c_string() 失敗 -> RESOURCE_INVALID_ARGUMENT
+        // string_intern_acquire() 失敗 -> RESOURCE_INVALID_ARGUMENT
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
         test_call_control_t config = { 0 };
 
         test_texture_config_reset();
         test_choco_memory_config_reset();
-        test_choco_string_config_reset();
+        test_string_intern_config_reset();
 
         config.fail_on_call = 1U;
         config.forced_result = (int)CHOCO_STRING_INVALID_ARGUMENT;
-        test_choco_string_create_from_c_string_config_set(&config);
+        test_string_intern_acquire_config_set(&config);
 
         ret = texture_create("test_texture", &texture);
         assert(RESOURCE_INVALID_ARGUMENT == ret);
         assert(NULL == texture);
+        assert(0U == string_intern_count());
 
         test_texture_config_reset();
         test_choco_memory_config_reset();
-        test_choco_string_config_reset();
+        test_string_intern_config_reset();
     }
     {
         // 正常系: texture_t が確保され、全フィールドが初期化される
@@ -777,8 +770,8 @@ static void NO_COVERAGE test_texture_create(void) {
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
 
-        assert(NULL != texture->name);
-        assert(choco_string_equal("test_texture", choco_string_c_str(texture->name)));
+        assert(STRING_ATOM_INVALID != texture->name_atom);
+        assert(choco_string_equal("test_texture", string_intern_c_str(texture->name_atom)));
 
         assert(0U == texture->width);
         assert(0U == texture->height);
@@ -840,7 +833,7 @@ static void NO_COVERAGE test_texture_destroy(void) {
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
 
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
         assert(0U == texture->width);
         assert(0U == texture->height);
         assert(0U == texture->channel_count);
@@ -934,7 +927,7 @@ static void NO_COVERAGE test_texture_destroy(void) {
         test_choco_string_config_reset();
     }
     {
-        // texture_->name == NULL かつ pixels != NULL の破損状態でも、
+        // texture_->name_atom == STRING_ATOM_INVALID かつ pixels != NULL の破損状態でも、
         // texture_destroy() はwarning出力時にNULL文字列を渡さず、texture本体の破棄を継続する
         resource_result_t ret = RESOURCE_INVALID_ARGUMENT;
         texture_t* texture = NULL;
@@ -947,10 +940,10 @@ static void NO_COVERAGE test_texture_destroy(void) {
         ret = texture_create("test_texture", &texture);
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
 
-        choco_string_destroy(&texture->name);
-        assert(NULL == texture->name);
+        string_intern_release(texture->name_atom);
+        texture->name_atom = STRING_ATOM_INVALID;
 
         texture->width = 1U;
         texture->height = 1U;
@@ -1026,7 +1019,7 @@ static void NO_COVERAGE test_texture_pixel_load(void) {
         test_bmp_loader_config_reset();
     }
     {
-        // texture_->name == NULL -> RESOURCE_DATA_CORRUPTED
+        // texture_->name_atom == STRING_ATOM_INVALID -> RESOURCE_DATA_CORRUPTED
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
 
@@ -1039,10 +1032,10 @@ static void NO_COVERAGE test_texture_pixel_load(void) {
         ret = texture_create("test_texture_red", &texture);
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
 
-        choco_string_destroy(&texture->name);
-        assert(NULL == texture->name);
+        string_intern_release(texture->name_atom);
+        texture->name_atom = STRING_ATOM_INVALID;
 
         ret = texture_pixel_load(texture, NULL, NULL);
         assert(RESOURCE_DATA_CORRUPTED == ret);
@@ -1446,7 +1439,7 @@ static void NO_COVERAGE test_texture_pixel_load(void) {
         test_bmp_loader_config_reset();
     }
     {
-        // .bmp 経路: choco_string_default_create() 失敗 -> texture状態は未ロードのまま
+        // .bmp 経路: choco_string_default_create() 失敗(fs_utils_create内のフルパス生成) -> texture状態は未ロードのまま
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
         test_call_control_t config = { 0 };
@@ -1693,7 +1686,7 @@ static void NO_COVERAGE test_texture_pixel_unload(void) {
         test_choco_string_config_reset();
     }
     {
-        // texture_->name == NULL -> RESOURCE_DATA_CORRUPTED
+        // texture_->name_atom == STRING_ATOM_INVALID -> RESOURCE_DATA_CORRUPTED
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
         uint8_t dummy_pixels[3] = { 0U, 0U, 0U };
@@ -1705,10 +1698,10 @@ static void NO_COVERAGE test_texture_pixel_unload(void) {
         ret = texture_create("test_texture", &texture);
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
 
-        choco_string_destroy(&texture->name);
-        assert(NULL == texture->name);
+        string_intern_release(texture->name_atom);
+        texture->name_atom = STRING_ATOM_INVALID;
 
         texture->width = 1U;
         texture->height = 1U;
@@ -1886,8 +1879,8 @@ static void NO_COVERAGE test_texture_pixel_unload(void) {
         assert(0U == texture->width);
         assert(0U == texture->height);
         assert(0U == texture->channel_count);
-        assert(NULL != texture->name);
-        assert(choco_string_equal("test_texture_red", choco_string_c_str(texture->name)));
+        assert(STRING_ATOM_INVALID != texture->name_atom);
+        assert(choco_string_equal("test_texture_red", string_intern_c_str(texture->name_atom)));
 
         texture_destroy(&texture);
         assert(NULL == texture);
@@ -2161,7 +2154,7 @@ static void NO_COVERAGE test_texture_pixel_get(void) {
         test_choco_string_config_reset();
     }
     {
-        // texture_->name == NULL -> RESOURCE_DATA_CORRUPTED
+        // texture_->name_atom == STRING_ATOM_INVALID -> RESOURCE_DATA_CORRUPTED
         // out_pixels は変更されない
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
@@ -2176,10 +2169,10 @@ static void NO_COVERAGE test_texture_pixel_get(void) {
         ret = texture_create("test_texture", &texture);
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
 
-        choco_string_destroy(&texture->name);
-        assert(NULL == texture->name);
+        string_intern_release(texture->name_atom);
+        texture->name_atom = STRING_ATOM_INVALID;
 
         texture->channel_count = 3U;
         texture->pixels = dummy_pixels;
@@ -2559,7 +2552,7 @@ static void NO_COVERAGE test_texture_pixel_size_get(void) {
         test_choco_string_config_reset();
     }
     {
-        // texture_->name == NULL -> RESOURCE_DATA_CORRUPTED
+        // texture_->name_atom == STRING_ATOM_INVALID -> RESOURCE_DATA_CORRUPTED
         // width / height / channel_count は変更されない
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
@@ -2575,10 +2568,10 @@ static void NO_COVERAGE test_texture_pixel_size_get(void) {
         ret = texture_create("test_texture", &texture);
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
 
-        choco_string_destroy(&texture->name);
-        assert(NULL == texture->name);
+        string_intern_release(texture->name_atom);
+        texture->name_atom = STRING_ATOM_INVALID;
 
         texture->channel_count = 3U;
         texture->pixels = dummy_pixels;
@@ -2667,7 +2660,7 @@ static void NO_COVERAGE test_texture_name_get(void) {
         test_choco_string_config_reset();
     }
     {
-        // texture_->name == NULL -> NULL
+        // texture_->name_atom == STRING_ATOM_INVALID -> NULL
         resource_result_t ret = RESOURCE_SUCCESS;
         texture_t* texture = NULL;
         const char* name = NULL;
@@ -2679,10 +2672,10 @@ static void NO_COVERAGE test_texture_name_get(void) {
         ret = texture_create("test_texture", &texture);
         assert(RESOURCE_SUCCESS == ret);
         assert(NULL != texture);
-        assert(NULL != texture->name);
+        assert(STRING_ATOM_INVALID != texture->name_atom);
 
-        choco_string_destroy(&texture->name);
-        assert(NULL == texture->name);
+        string_intern_release(texture->name_atom);
+        texture->name_atom = STRING_ATOM_INVALID;
 
         name = texture_name_get(texture);
         assert(NULL == name);
@@ -2751,6 +2744,58 @@ static void NO_COVERAGE test_texture_name_get(void) {
     memory_system_destroy();
 }
 
+static void NO_COVERAGE test_texture_name_atom_get(void) {
+    assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+    {
+        // texture_ == NULL、texture_->name_atom == STRING_ATOM_INVALID -> STRING_ATOM_INVALID
+        texture_t* texture = NULL;
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        test_texture_config_reset();
+        test_choco_memory_config_reset();
+        test_string_intern_config_reset();
+
+        assert(STRING_ATOM_INVALID == texture_name_atom_get(NULL));
+
+        assert(RESOURCE_SUCCESS == texture_create("test_texture", &texture));
+        atom = texture->name_atom;
+        texture->name_atom = STRING_ATOM_INVALID;
+        assert(STRING_ATOM_INVALID == texture_name_atom_get(texture));
+
+        texture->name_atom = atom;
+        texture_destroy(&texture);
+        assert(0U == string_intern_count());
+    }
+    {
+        // 正常系: 同一名称のテクスチャは同一のアトムを持ち、名称文字列は1つだけ登録される
+        texture_t* texture_a = NULL;
+        texture_t* texture_b = NULL;
+        texture_t* texture_c = NULL;
+
+        assert(RESOURCE_SUCCESS == texture_create("test_texture", &texture_a));
+        assert(RESOURCE_SUCCESS == texture_create("test_texture", &texture_b));
+        assert(RESOURCE_SUCCESS == texture_create("test_texture_red", &texture_c));
+
+        assert(STRING_ATOM_INVALID != texture_name_atom_get(texture_a));
+        assert(texture_name_atom_get(texture_a) == texture_name_atom_get(texture_b));
+        assert(texture_name_atom_get(texture_a) != texture_name_atom_get(texture_c));
+        assert(texture_name_atom_get(texture_a) == string_intern_find("test_texture"));
+        assert(2U == string_intern_count());
+
+        texture_destroy(&texture_a);
+        texture_destroy(&texture_b);
+        texture_destroy(&texture_c);
+        assert(0U == string_intern_count());
+
+        test_texture_config_reset();
+        test_choco_memory_config_reset();
+        test_string_intern_config_reset();
+    }
+
+    memory_system_destroy();
+}
+
 // Generated by ChatGPT
 static void NO_COVERAGE test_bmp_load(void) {
     assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
@@ -3068,7 +3113,7 @@ static void NO_COVERAGE test_bmp_load(void) {
         assert(NULL != pixels);
         assert(0 == memcmp(expected_pixels, pixels, sizeof(expected_pixels)));
 
-        memory_system_free(pixels, (size_t)width * (size_t)height * (size_t)channel_count, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(pixels, (size_t)width * (size_t)height * (size_t)channel_count, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         pixels = NULL;
 
         remove("test_texture_bmp_load_success.bmp");
@@ -3215,7 +3260,7 @@ static void NO_COVERAGE test_test_texture_generate(void) {
         test_choco_memory_config_reset();
     }
     {
-        // memory_system_allocate() 失敗 -> RESOURCE_NO_MEMORY
+        // memory_system_allocate_aligned() 失敗 -> RESOURCE_NO_MEMORY
         // out 引数は変更されない
         resource_result_t ret = RESOURCE_SUCCESS;
         uint16_t width = 111U;
@@ -3229,7 +3274,7 @@ static void NO_COVERAGE test_test_texture_generate(void) {
 
         config.fail_on_call = 1U;
         config.forced_result = (int)MEMORY_SYSTEM_NO_MEMORY;
-        test_memory_system_allocate_config_set(&config);
+        test_memory_system_allocate_aligned_config_set(&config);
 
         ret = test_texture_generate(TEST_TEXTURE_RED, &width, &height, &channel_count, &pixels);
         assert(RESOURCE_NO_MEMORY == ret);
@@ -3288,7 +3333,7 @@ static void NO_COVERAGE test_test_texture_generate(void) {
             assert(0U == pixels[i + 2U]);
         }
 
-        memory_system_free(pixels, pixel_size, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(pixels, pixel_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         pixels = NULL;
 
         test_texture_config_reset();
@@ -3319,7 +3364,7 @@ static void NO_COVERAGE test_test_texture_generate(void) {
             assert(0U == pixels[i + 2U]);
         }
 
-        memory_system_free(pixels, pixel_size, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(pixels, pixel_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         pixels = NULL;
 
         test_texture_config_reset();
@@ -3350,7 +3395,7 @@ static void NO_COVERAGE test_test_texture_generate(void) {
             assert(255U == pixels[i + 2U]);
         }
 
-        memory_system_free(pixels, pixel_size, MEMORY_TAG_TEXTURE);
+        memory_system_free_aligned(pixels, pixel_size, RESOURCE_PIXEL_ALIGNMENT, MEMORY_TAG_TEXTURE);
         pixels = NULL;
 
         test_texture_config_reset();
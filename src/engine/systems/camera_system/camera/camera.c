@@ -27,6 +27,7 @@
 #include "engine/base/choco_message.h"
 
 #include "engine/containers/choco_string.h"
+#include "engine/containers/string_intern.h"
 
 // #define TEST_BUILD
 
@@ -43,6 +44,7 @@
 #include "engine/systems/camera_system/camera_core/test_camera_memory.h"
 
 #include "engine/containers/test_choco_string.h"
+#include "engine/containers/test_string_intern.h"
 
 // camera用モジュール専用テスト制御構造体定義
 
@@ -72,6 +74,7 @@ static test_call_control_bool_t s_test_config_is_valid_frustum;     /**< is_vali
 static void test_camera_create(void);
 static void test_camera_destroy(void);
 static void test_camera_name_get(void);
+static void test_camera_name_atom_get(void);
 static void test_camera_viewing_frustum_update(void);
 static void test_camera_euler_update(void);
 static void test_camera_position_update(void);
@@ -124,7 +127,7 @@ struct camera {
 
     viewing_frustum_t frustum;          /**< 視錐台パラメータ */
 
-    choco_string_t* name;               /**< カメラ名称文字列 */
+    string_atom_t name_atom;            /**< カメラ名称文字列のアトム(文字列インターンテーブルに登録) */
 
     bool posture_cache_dirty;           /**< true: 姿勢が更新されているが、姿勢由来の行列が更新されていない, false: 姿勢と姿勢由来の行列が同期済み */
     bool frustum_cache_dirty;           /**< true: 視錐台が更新されているが、視錐台由来の行列が更新されていない, false: 視錐台と視錐台由来の行列が同期済み */
@@ -160,9 +163,9 @@ camera_result_t camera_create(const char* name_, camera_t** out_camera_) {
         ERROR_MESSAGE("camera_create(%s) - Failed to allocate memory for camera.", camera_rslt_to_str(ret));
         goto cleanup;
     }
-    tmp_camera->name = NULL;
+    tmp_camera->name_atom = STRING_ATOM_INVALID;
 
-    string_ret = choco_string_create_from_c_string(name_, &tmp_camera->name);
+    string_ret = string_intern_acquire(name_, &tmp_camera->name_atom);
     if(CHOCO_STRING_SUCCESS != string_ret) {
         ret = camera_rslt_convert_choco_string(string_ret);
         ERROR_MESSAGE("camera_create(%s) - Failed to create string for camera name.", camera_rslt_to_str(ret));
@@ -191,10 +194,6 @@ camera_result_t camera_create(const char* name_, camera_t** out_camera_) {
 cleanup:
     if(CAMERA_SUCCESS != ret) {
         if(NULL != tmp_camera) {
-            if(NULL != tmp_camera->name) {
-                // ここは現状では通ることがないためカバレッジは100にならないが許容
-                choco_string_destroy(&tmp_camera->name);
-            }
             camera_destroy(&tmp_camera);
         }
     }
@@ -208,9 +207,7 @@ void camera_destroy(camera_t** camera_) {
     if(NULL == *camera_) {
         return;
     }
-    if(NULL != (*camera_)->name) {
-        choco_string_destroy(&(*camera_)->name);
-    }
+    string_intern_release((*camera_)->name_atom);
     camera_mem_free(*camera_, sizeof(camera_t));
     *camera_ = NULL;
 }
@@ -220,11 +217,23 @@ const char* camera_name_get(const camera_t* camera_) {
         ERROR_MESSAGE("camera_name_get(%s) - Argument camera_ requires a valid pointer.", camera_rslt_to_str(CAMERA_INVALID_ARGUMENT));
         return NULL;
     }
-    if(NULL == camera_->name) {
+    if(NULL == string_intern_c_str(camera_->name_atom)) {
         ERROR_MESSAGE("camera_name_get(%s) - Provided camera_ is corrupted.", camera_rslt_to_str(CAMERA_DATA_CORRUPTED));
         return NULL;
     }
-    return choco_string_c_str(camera_->name);
+    return string_intern_c_str(camera_->name_atom);
+}
+
+string_atom_t camera_name_atom_get(const camera_t* camera_) {
+    if(NULL == camera_) {
+        ERROR_MESSAGE("camera_name_atom_get(%s) - Argument camera_ requires a valid pointer.", camera_rslt_to_str(CAMERA_INVALID_ARGUMENT));
+        return STRING_ATOM_INVALID;
+    }
+    if(NULL == string_intern_c_str(camera_->name_atom)) {
+        ERROR_MESSAGE("camera_name_atom_get(%s) - Provided camera_ is corrupted.", camera_rslt_to_str(CAMERA_DATA_CORRUPTED));
+        return STRING_ATOM_INVALID;
+    }
+    return camera_->name_atom;
 }
 
 camera_result_t camera_viewing_frustum_update(float fovy_, float aspect_, float near_clip_, float far_clip_, camera_t* camera_) {
@@ -969,6 +978,7 @@ void NO_COVERAGE test_camera(void) {
     test_camera_create();
     test_camera_destroy();
     test_camera_name_get();
+    test_camera_name_atom_get();
     test_camera_viewing_frustum_update();
     test_camera_euler_update();
     test_camera_position_update();
@@ -1071,7 +1081,7 @@ static void NO_COVERAGE test_camera_create(void) {
         test_camera_config_reset();
     }
     {
-        // choco_string_create_from_c_string() 失敗 ->
+        // string_intern_acquire() 失敗 ->
         // camera_rslt_convert_choco_string() により CAMERA_LIMIT_EXCEEDED に変換されること
         camera_result_t ret = CAMERA_UNDEFINED_ERROR;
         camera_t* camera = NULL;
@@ -1079,22 +1089,23 @@ static void NO_COVERAGE test_camera_create(void) {
 
         test_camera_config_reset();
         test_camera_memory_config_reset();
-        test_choco_string_config_reset();
+        test_string_intern_config_reset();
         test_call_control_reset(&config);
 
         assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
 
         config.fail_on_call = 1U;
         config.forced_result = (int)CHOCO_STRING_LIMIT_EXCEEDED;
-        test_choco_string_create_from_c_string_config_set(&config);
+        test_string_intern_acquire_config_set(&config);
 
         ret = camera_create("main_camera", &camera);
         assert(CAMERA_LIMIT_EXCEEDED == ret);
         assert(NULL == camera);
+        assert(0U == string_intern_count());
 
         memory_system_destroy();
 
-        test_choco_string_config_reset();
+        test_string_intern_config_reset();
         test_camera_memory_config_reset();
         test_camera_config_reset();
     }
@@ -1115,7 +1126,8 @@ static void NO_COVERAGE test_camera_create(void) {
         assert(NULL != camera);
 
         // name 初期化確認
-        assert(NULL != camera->name);
+        assert(STRING_ATOM_INVALID != camera->name_atom);
+        assert(camera->name_atom == string_intern_find("main_camera"));
         assert(true == choco_string_equal("main_camera", camera_name_get(camera)));
 
         // frustum 初期値確認
@@ -1185,7 +1197,7 @@ static void NO_COVERAGE test_camera_destroy(void) {
         test_camera_config_reset();
     }
     {
-        // name != NULL を持つ通常の camera を破棄できること
+        // 名称登録済みの通常の camera を破棄でき、名称の参照が解放されること
         camera_result_t ret = CAMERA_UNDEFINED_ERROR;
         camera_t* camera = NULL;
 
@@ -1198,10 +1210,12 @@ static void NO_COVERAGE test_camera_destroy(void) {
         ret = camera_create("main_camera", &camera);
         assert(CAMERA_SUCCESS == ret);
         assert(NULL != camera);
-        assert(NULL != camera->name);
+        assert(STRING_ATOM_INVALID != camera->name_atom);
+        assert(1U == string_intern_count());
 
         camera_destroy(&camera);
         assert(NULL == camera);
+        assert(0U == string_intern_count());
 
         // 2回目も no-op で呼べること
         camera_destroy(&camera);
@@ -1214,7 +1228,7 @@ static void NO_COVERAGE test_camera_destroy(void) {
         test_camera_config_reset();
     }
     {
-        // name == NULL の camera でも破棄できること
+        // 名称未登録(name_atom == STRING_ATOM_INVALID)の camera でも破棄できること
         camera_result_t ret = CAMERA_UNDEFINED_ERROR;
         camera_t* camera = NULL;
 
@@ -1227,10 +1241,10 @@ static void NO_COVERAGE test_camera_destroy(void) {
         ret = camera_create("main_camera", &camera);
         assert(CAMERA_SUCCESS == ret);
         assert(NULL != camera);
-        assert(NULL != camera->name);
+        assert(STRING_ATOM_INVALID != camera->name_atom);
 
-        choco_string_destroy(&camera->name);
-        assert(NULL == camera->name);
+        string_intern_release(camera->name_atom);
+        camera->name_atom = STRING_ATOM_INVALID;
 
         camera_destroy(&camera);
         assert(NULL == camera);
@@ -1261,7 +1275,7 @@ static void NO_COVERAGE test_camera_name_get(void) {
         test_camera_config_reset();
     }
     {
-        // camera_->name == NULL -> NULL
+        // camera_->name_atom == STRING_ATOM_INVALID -> NULL
         camera_t camera = {0};
         const char* name = NULL;
 
@@ -1336,6 +1350,57 @@ static void NO_COVERAGE test_camera_name_get(void) {
     }
 }
 
+static void NO_COVERAGE test_camera_name_atom_get(void) {
+    {
+        // camera_ == NULL、camera_->name_atom == STRING_ATOM_INVALID -> STRING_ATOM_INVALID
+        camera_t camera = {0};
+
+        test_camera_config_reset();
+        test_camera_memory_config_reset();
+
+        assert(STRING_ATOM_INVALID == camera_name_atom_get(NULL));
+        assert(STRING_ATOM_INVALID == camera_name_atom_get(&camera));
+
+        test_camera_memory_config_reset();
+        test_camera_config_reset();
+    }
+    {
+        // 正常系: 同一名称のカメラは同一のアトムを持ち、名称文字列は1つだけ登録されること
+        camera_t* camera_a = NULL;
+        camera_t* camera_b = NULL;
+        camera_t* camera_c = NULL;
+
+        test_camera_config_reset();
+        test_camera_memory_config_reset();
+        test_string_intern_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        assert(CAMERA_SUCCESS == camera_create("main_camera", &camera_a));
+        assert(CAMERA_SUCCESS == camera_create("main_camera", &camera_b));
+        assert(CAMERA_SUCCESS == camera_create("sub_camera", &camera_c));
+
+        assert(STRING_ATOM_INVALID != camera_name_atom_get(camera_a));
+        assert(camera_name_atom_get(camera_a) == camera_name_atom_get(camera_b));
+        assert(camera_name_atom_get(camera_a) != camera_name_atom_get(camera_c));
+        assert(camera_name_atom_get(camera_a) == string_intern_find("main_camera"));
+        assert(camera_name_get(camera_a) == camera_name_get(camera_b));
+        assert(2U == string_intern_count());
+
+        camera_destroy(&camera_a);
+        assert(camera_name_atom_get(camera_b) == string_intern_find("main_camera"));
+        camera_destroy(&camera_b);
+        camera_destroy(&camera_c);
+        assert(0U == string_intern_count());
+
+        memory_system_destroy();
+
+        test_string_intern_config_reset();
+        test_camera_memory_config_reset();
+        test_camera_config_reset();
+    }
+}
+
 // Generated by ChatGPT
 static void NO_COVERAGE test_camera_viewing_frustum_update(void) {
     {
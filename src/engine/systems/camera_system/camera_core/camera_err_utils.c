@@ -18,6 +18,8 @@
 #include "engine/systems/camera_system/camera_core/camera_types.h"
 
 #include "engine/containers/choco_string.h"
+#include "engine/containers/hash_map.h"
+#include "engine/containers/sparse_set.h"
 
 #include "engine/core/memory/choco_memory.h"
 #include "engine/core/memory/linear_allocator.h"
@@ -37,6 +39,8 @@
 static test_call_control_t s_test_config_camera_rslt_convert_choco_memory;  /**< camera_rslt_convert_choco_memory()テスト設定 */
 static test_call_control_t s_test_config_camera_rslt_convert_choco_string;  /**< camera_rslt_convert_choco_string()テスト設定 */
 static test_call_control_t s_test_config_camera_rslt_convert_linear_alloc;  /**< camera_rslt_convert_linear_alloc()テスト設定 */
+static test_call_control_t s_test_config_camera_rslt_convert_hash_map;      /**< camera_rslt_convert_hash_map()テスト設定 */
+static test_call_control_t s_test_config_camera_rslt_convert_sparse_set;    /**< camera_rslt_convert_sparse_set()テスト設定 */
 
 // プライベート関数テスト設定
 
@@ -45,6 +49,8 @@ static void test_camera_rslt_to_str(void);
 static void test_camera_rslt_convert_choco_memory(void);
 static void test_camera_rslt_convert_choco_string(void);
 static void test_camera_rslt_convert_linear_alloc(void);
+static void test_camera_rslt_convert_hash_map(void);
+static void test_camera_rslt_convert_sparse_set(void);
 #endif
 
 static const char* const s_rslt_str_success = "SUCCESS";                    /**< 実行結果コード(成功)文字列 */
@@ -160,6 +166,80 @@ camera_result_t camera_rslt_convert_linear_alloc(linear_allocator_result_t rslt_
     }
 }
 
+camera_result_t camera_rslt_convert_hash_map(hash_map_result_t rslt_) {
+#ifdef TEST_BUILD
+    s_test_config_camera_rslt_convert_hash_map.call_count++;
+    if(s_test_config_camera_rslt_convert_hash_map.fail_on_call != 0) {
+        if(s_test_config_camera_rslt_convert_hash_map.call_count == s_test_config_camera_rslt_convert_hash_map.fail_on_call) {
+            return (camera_result_t)s_test_config_camera_rslt_convert_hash_map.forced_result;
+        }
+    }
+#endif
+    switch(rslt_) {
+    case HASH_MAP_SUCCESS:
+        return CAMERA_SUCCESS;
+    case HASH_MAP_INVALID_ARGUMENT:
+        return CAMERA_INVALID_ARGUMENT;
+    case HASH_MAP_NO_MEMORY:
+        return CAMERA_NO_MEMORY;
+    case HASH_MAP_RUNTIME_ERROR:
+        return CAMERA_RUNTIME_ERROR;
+    case HASH_MAP_LIMIT_EXCEEDED:
+        return CAMERA_LIMIT_EXCEEDED;
+    case HASH_MAP_BAD_OPERATION:
+        return CAMERA_BAD_OPERATION;
+    case HASH_MAP_DATA_CORRUPTED:
+        return CAMERA_DATA_CORRUPTED;
+    case HASH_MAP_OVERFLOW:
+        return CAMERA_RUNTIME_ERROR;  // OVERFLOW -> RUNTIMEERRORに伝播
+    case HASH_MAP_KEY_NOT_FOUND:
+        return CAMERA_BAD_OPERATION;
+    case HASH_MAP_KEY_EXISTS:
+        return CAMERA_BAD_OPERATION;
+    case HASH_MAP_UNDEFINED_ERROR:
+        return CAMERA_UNDEFINED_ERROR;
+    default:
+        return CAMERA_UNDEFINED_ERROR;
+    }
+}
+
+camera_result_t camera_rslt_convert_sparse_set(sparse_set_result_t rslt_) {
+#ifdef TEST_BUILD
+    s_test_config_camera_rslt_convert_sparse_set.call_count++;
+    if(s_test_config_camera_rslt_convert_sparse_set.fail_on_call != 0) {
+        if(s_test_config_camera_rslt_convert_sparse_set.call_count == s_test_config_camera_rslt_convert_sparse_set.fail_on_call) {
+            return (camera_result_t)s_test_config_camera_rslt_convert_sparse_set.forced_result;
+        }
+    }
+#endif
+    switch(rslt_) {
+    case SPARSE_SET_SUCCESS:
+        return CAMERA_SUCCESS;
+    case SPARSE_SET_INVALID_ARGUMENT:
+        return CAMERA_INVALID_ARGUMENT;
+    case SPARSE_SET_NO_MEMORY:
+        return CAMERA_NO_MEMORY;
+    case SPARSE_SET_RUNTIME_ERROR:
+        return CAMERA_RUNTIME_ERROR;
+    case SPARSE_SET_LIMIT_EXCEEDED:
+        return CAMERA_LIMIT_EXCEEDED;
+    case SPARSE_SET_BAD_OPERATION:
+        return CAMERA_BAD_OPERATION;
+    case SPARSE_SET_DATA_CORRUPTED:
+        return CAMERA_DATA_CORRUPTED;
+    case SPARSE_SET_OVERFLOW:
+        return CAMERA_RUNTIME_ERROR;  // OVERFLOW -> RUNTIMEERRORに伝播
+    case SPARSE_SET_ID_NOT_FOUND:
+        return CAMERA_BAD_OPERATION;
+    case SPARSE_SET_ID_EXISTS:
+        return CAMERA_BAD_OPERATION;
+    case SPARSE_SET_UNDEFINED_ERROR:
+        return CAMERA_UNDEFINED_ERROR;
+    default:
+        return CAMERA_UNDEFINED_ERROR;
+    }
+}
+
 #ifdef TEST_BUILD
 void NO_COVERAGE test_camera_rslt_convert_choco_memory_config_set(const test_call_control_t* config_) {
     if(NULL == config_) {
@@ -188,10 +268,30 @@ void NO_COVERAGE test_camera_rslt_convert_linear_alloc_config_set(const test_cal
     s_test_config_camera_rslt_convert_linear_alloc.forced_result = config_->forced_result;
 }
 
+void NO_COVERAGE test_camera_rslt_convert_hash_map_config_set(const test_call_control_t* config_) {
+    if(NULL == config_) {
+        assert(false);
+        return;
+    }
+    s_test_config_camera_rslt_convert_hash_map.fail_on_call = config_->fail_on_call;
+    s_test_config_camera_rslt_convert_hash_map.forced_result = config_->forced_result;
+}
+
+void NO_COVERAGE test_camera_rslt_convert_sparse_set_config_set(const test_call_control_t* config_) {
+    if(NULL == config_) {
+        assert(false);
+        return;
+    }
+    s_test_config_camera_rslt_convert_sparse_set.fail_on_call = config_->fail_on_call;
+    s_test_config_camera_rslt_convert_sparse_set.forced_result = config_->forced_result;
+}
+
 void NO_COVERAGE test_camera_err_utils_config_reset(void) {
     test_call_control_reset(&s_test_config_camera_rslt_convert_choco_memory);
     test_call_control_reset(&s_test_config_camera_rslt_convert_choco_string);
     test_call_control_reset(&s_test_config_camera_rslt_convert_linear_alloc);
+    test_call_control_reset(&s_test_config_camera_rslt_convert_hash_map);
+    test_call_control_reset(&s_test_config_camera_rslt_convert_sparse_set);
 }
 
 void NO_COVERAGE test_camera_err_utils(void) {
@@ -199,6 +299,8 @@ void NO_COVERAGE test_camera_err_utils(void) {
     test_camera_rslt_convert_choco_memory();
     test_camera_rslt_convert_choco_string();
     test_camera_rslt_convert_linear_alloc();
+    test_camera_rslt_convert_hash_map();
+    test_camera_rslt_convert_sparse_set();
 }
 
 // Generated by ChatGPT 5.4 Thinking
@@ -419,4 +521,71 @@ static void NO_COVERAGE test_camera_rslt_convert_linear_alloc(void) {
 
     test_camera_err_utils_config_reset();
 }
+static void NO_COVERAGE test_camera_rslt_convert_hash_map(void) {
+    camera_result_t actual = CAMERA_UNDEFINED_ERROR;
+    test_call_control_t config = { 0 };
+
+    test_camera_err_utils_config_reset();
+
+    /* 通常の変換結果確認 */
+    assert(CAMERA_SUCCESS == camera_rslt_convert_hash_map(HASH_MAP_SUCCESS));
+    assert(CAMERA_INVALID_ARGUMENT == camera_rslt_convert_hash_map(HASH_MAP_INVALID_ARGUMENT));
+    assert(CAMERA_NO_MEMORY == camera_rslt_convert_hash_map(HASH_MAP_NO_MEMORY));
+    assert(CAMERA_RUNTIME_ERROR == camera_rslt_convert_hash_map(HASH_MAP_RUNTIME_ERROR));
+    assert(CAMERA_LIMIT_EXCEEDED == camera_rslt_convert_hash_map(HASH_MAP_LIMIT_EXCEEDED));
+    assert(CAMERA_BAD_OPERATION == camera_rslt_convert_hash_map(HASH_MAP_BAD_OPERATION));
+    assert(CAMERA_DATA_CORRUPTED == camera_rslt_convert_hash_map(HASH_MAP_DATA_CORRUPTED));
+    assert(CAMERA_RUNTIME_ERROR == camera_rslt_convert_hash_map(HASH_MAP_OVERFLOW));
+    assert(CAMERA_BAD_OPERATION == camera_rslt_convert_hash_map(HASH_MAP_KEY_NOT_FOUND));
+    assert(CAMERA_BAD_OPERATION == camera_rslt_convert_hash_map(HASH_MAP_KEY_EXISTS));
+    assert(CAMERA_UNDEFINED_ERROR == camera_rslt_convert_hash_map(HASH_MAP_UNDEFINED_ERROR));
+
+    /* 未定義の入力は UNDEFINED_ERROR にフォールバックすること */
+    assert(CAMERA_UNDEFINED_ERROR == camera_rslt_convert_hash_map((hash_map_result_t)999));
+
+    /* 1回目呼び出しでの失敗注入確認 */
+    test_camera_err_utils_config_reset();
+    config.fail_on_call = 1;
+    config.forced_result = (int)CAMERA_BAD_OPERATION;
+    test_camera_rslt_convert_hash_map_config_set(&config);
+
+    actual = camera_rslt_convert_hash_map(HASH_MAP_SUCCESS);
+    assert(actual == CAMERA_BAD_OPERATION);
+
+    test_camera_err_utils_config_reset();
+}
+
+static void NO_COVERAGE test_camera_rslt_convert_sparse_set(void) {
+    camera_result_t actual = CAMERA_UNDEFINED_ERROR;
+    test_call_control_t config = { 0 };
+
+    test_camera_err_utils_config_reset();
+
+    /* 通常の変換結果確認 */
+    assert(CAMERA_SUCCESS == camera_rslt_convert_sparse_set(SPARSE_SET_SUCCESS));
+    assert(CAMERA_INVALID_ARGUMENT == camera_rslt_convert_sparse_set(SPARSE_SET_INVALID_ARGUMENT));
+    assert(CAMERA_NO_MEMORY == camera_rslt_convert_sparse_set(SPARSE_SET_NO_MEMORY));
+    assert(CAMERA_RUNTIME_ERROR == camera_rslt_convert_sparse_set(SPARSE_SET_RUNTIME_ERROR));
+    assert(CAMERA_LIMIT_EXCEEDED == camera_rslt_convert_sparse_set(SPARSE_SET_LIMIT_EXCEEDED));
+    assert(CAMERA_BAD_OPERATION == camera_rslt_convert_sparse_set(SPARSE_SET_BAD_OPERATION));
+    assert(CAMERA_DATA_CORRUPTED == camera_rslt_convert_sparse_set(SPARSE_SET_DATA_CORRUPTED));
+    assert(CAMERA_RUNTIME_ERROR == camera_rslt_convert_sparse_set(SPARSE_SET_OVERFLOW));
+    assert(CAMERA_BAD_OPERATION == camera_rslt_convert_sparse_set(SPARSE_SET_ID_NOT_FOUND));
+    assert(CAMERA_BAD_OPERATION == camera_rslt_convert_sparse_set(SPARSE_SET_ID_EXISTS));
+    assert(CAMERA_UNDEFINED_ERROR == camera_rslt_convert_sparse_set(SPARSE_SET_UNDEFINED_ERROR));
+
+    /* 未定義の入力は UNDEFINED_ERROR にフォールバックすること */
+    assert(CAMERA_UNDEFINED_ERROR == camera_rslt_convert_sparse_set((sparse_set_result_t)999));
+
+    /* 1回目呼び出しでの失敗注入確認 */
+    test_camera_err_utils_config_reset();
+    config.fail_on_call = 1;
+    config.forced_result = (int)CAMERA_BAD_OPERATION;
+    test_camera_rslt_convert_sparse_set_config_set(&config);
+
+    actual = camera_rslt_convert_sparse_set(SPARSE_SET_SUCCESS);
+    assert(actual == CAMERA_BAD_OPERATION);
+
+    test_camera_err_utils_config_reset();
+}
 #endif
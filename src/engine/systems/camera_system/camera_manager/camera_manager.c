@@ -27,6 +27,9 @@
 #include "engine/core/memory/linear_allocator.h"
 
 #include "engine/containers/choco_string.h"
+#include "engine/containers/hash_map.h"
+#include "engine/containers/sparse_set.h"
+#include "engine/containers/string_intern.h"
 
 #include "engine/systems/camera_system/camera_core/camera_types.h"
 #include "engine/systems/camera_system/camera_core/camera_err_utils.h"
@@ -42,6 +45,8 @@
 struct camera_manager {
     int16_t max_camera_count;   /**< 管理システムに登録可能なカメラ数上限値 */
     camera_t** camera_array;    /**< カメラ構造体インスタンス格納配列 */
+    hash_map_t* name_index;     /**< カメラ名アトム(string_atom_t)からカメラID(int16_t)への対応表 */
+    sparse_set_t* live_ids;     /**< 登録中のカメラIDの集合(空きスロットの払い出しと登録中カメラの走査に使用) */
 };
 
 #ifdef TEST_BUILD
@@ -52,6 +57,9 @@ struct camera_manager {
 #include "engine/core/memory/test_choco_memory.h"
 #include "engine/core/memory/test_linear_allocator.h"
 
+#include "engine/containers/test_hash_map.h"
+#include "engine/containers/test_sparse_set.h"
+
 #include "engine/systems/camera_system/camera_manager/test_camera_manager.h"
 #include "engine/systems/camera_system/camera/test_camera.h"
 #include "engine/systems/camera_system/camera_core/test_camera_memory.h"
@@ -70,6 +78,7 @@ static test_call_control_t s_test_config_camera_manager_camera_get_by_name; /**<
 // プライベート関数テスト設定
 
 // 全テスト関数プロトタイプ宣言
+static void test_camera_manager_preinit(void);
 static void test_camera_manager_initialize(void);
 static void test_camera_manager_deinitialize(void);
 static void test_camera_manager_register(void);
@@ -78,8 +87,52 @@ static void test_camera_manager_unregister_by_name(void);
 static void test_camera_manager_camera_id_get(void);
 static void test_camera_manager_camera_get(void);
 static void test_camera_manager_camera_get_by_name(void);
+
+static void test_name_index_attach(camera_manager_t* manager_);
+static void test_name_index_detach(camera_manager_t* manager_);
 #endif
 
+static camera_result_t camera_slot_release(int16_t camera_id_, camera_manager_t* camera_manager_, const char* func_name_);
+
+camera_result_t camera_manager_preinit(int16_t max_camera_count_, size_t* io_pool_requirement_) {
+    camera_result_t ret = CAMERA_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
+    sparse_set_result_t ret_sparse_set = SPARSE_SET_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_preinit", "io_pool_requirement_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 < max_camera_count_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_preinit", "max_camera_count_")
+
+    // camera_manager_initializeと同じ順序で加算する
+    ret_linear_alloc = linear_allocator_requirement_add(sizeof(camera_manager_t), alignof(camera_manager_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(sizeof(camera_t*) * (size_t)(max_camera_count_), alignof(camera_t*), io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = camera_rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("camera_manager_preinit(%s) - Failed to accumulate pool requirement.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_hash_map = hash_map_preinit((size_t)max_camera_count_, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), io_pool_requirement_);
+    if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = camera_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("camera_manager_preinit(%s) - Failed to accumulate pool requirement for name index.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_sparse_set = sparse_set_preinit((size_t)max_camera_count_, io_pool_requirement_);
+    if(SPARSE_SET_SUCCESS != ret_sparse_set) {
+        ret = camera_rslt_convert_sparse_set(ret_sparse_set);
+        ERROR_MESSAGE("camera_manager_preinit(%s) - Failed to accumulate pool requirement for live id set.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = CAMERA_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
 camera_result_t camera_manager_initialize(int16_t max_camera_count_, linear_alloc_t* allocator_, camera_manager_t** out_camera_manager_) {
 #ifdef TEST_BUILD
     s_test_config_camera_manager_initialize.call_count++;
@@ -91,6 +144,8 @@ camera_result_t camera_manager_initialize(int16_t max_camera_count_, linear_allo
 #endif
     camera_result_t ret = CAMERA_INVALID_ARGUMENT;
     linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
+    sparse_set_result_t ret_sparse_set = SPARSE_SET_INVALID_ARGUMENT;
     camera_manager_t* tmp_manager = NULL;
     camera_t** tmp_camera_array = NULL;
 
@@ -121,6 +176,19 @@ camera_result_t camera_manager_initialize(int16_t max_camera_count_, linear_allo
         tmp_manager->camera_array[i] = NULL;
     }
 
+    ret_hash_map = hash_map_initialize((size_t)max_camera_count_, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), allocator_, &tmp_manager->name_index);
+    if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = camera_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("camera_manager_initialize(%s) - Failed to initialize name index.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_sparse_set = sparse_set_initialize((size_t)max_camera_count_, allocator_, &tmp_manager->live_ids);
+    if(SPARSE_SET_SUCCESS != ret_sparse_set) {
+        ret = camera_rslt_convert_sparse_set(ret_sparse_set);
+        ERROR_MESSAGE("camera_manager_initialize(%s) - Failed to initialize live id set.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+
     // commit.
     *out_camera_manager_ = tmp_manager;
 
@@ -132,15 +200,27 @@ cleanup:
 }
 
 void camera_manager_deinitialize(camera_manager_t* camera_manager_) {
+    const uint32_t* live_ids = NULL;
+    size_t live_count = 0;
+
     if(NULL == camera_manager_) {
         return;
     }
     if(0 >= camera_manager_->max_camera_count) {
         return;
     }
-    for(int16_t i = 0; i != camera_manager_->max_camera_count; ++i) {
-        camera_destroy(&camera_manager_->camera_array[i]);
+    if(NULL == camera_manager_->live_ids) {
+        WARN_MESSAGE("camera_manager_deinitialize - Provided camera manager has no live id set.");
+        return;
+    }
+    // 全スロットではなく、登録中のカメラIDのみを走査する
+    live_ids = sparse_set_dense(camera_manager_->live_ids);
+    live_count = sparse_set_count(camera_manager_->live_ids);
+    for(size_t i = 0; i != live_count; ++i) {
+        camera_destroy(&camera_manager_->camera_array[live_ids[i]]);
     }
+    sparse_set_clear(camera_manager_->live_ids);
+    hash_map_clear(camera_manager_->name_index);
     camera_manager_->max_camera_count = 0;
 }
 
@@ -154,8 +234,13 @@ camera_result_t camera_manager_register(const char* camera_name_, camera_manager
     }
 #endif
     camera_result_t ret = CAMERA_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
+    sparse_set_result_t ret_sparse_set = SPARSE_SET_INVALID_ARGUMENT;
     int16_t free_slot = INVALID_CAMERA_ID;
+    uint32_t acquired_id = 0;
     camera_t* tmp_camera = NULL;
+    string_atom_t name_atom = STRING_ATOM_INVALID;
+    void* registered_id = NULL;
 
     IF_ARG_NULL_GOTO_CLEANUP(camera_name_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_register", "camera_name_")
     IF_ARG_NULL_GOTO_CLEANUP(camera_manager_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_register", "camera_manager_")
@@ -163,41 +248,69 @@ camera_result_t camera_manager_register(const char* camera_name_, camera_manager
     IF_ARG_FALSE_GOTO_CLEANUP(camera_manager_->max_camera_count > 0, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_register", "camera_manager_->max_camera_count")
     IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->camera_array, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_register", "camera_manager_->camera_array")
 
-    for(int16_t i = 0; i != camera_manager_->max_camera_count; ++i) {
-        if(NULL == camera_manager_->camera_array[i]) {
-            if(INVALID_CAMERA_ID == free_slot) {
-                free_slot = i;
-            }
-        } else {
-            const char* tmp_camera_name = camera_name_get(camera_manager_->camera_array[i]);
-            if(NULL == tmp_camera_name) {
-                ret = CAMERA_DATA_CORRUPTED;
-                ERROR_MESSAGE("camera_manager_register(%s) - Camera manager data corrupted.", camera_rslt_to_str(ret));
-                goto cleanup;
-            } else if(choco_string_equal(tmp_camera_name, camera_name_)) {
-                ret = CAMERA_BAD_OPERATION;
-                ERROR_MESSAGE("camera_manager_register(%s) - Provided camera name '%s' is already registered.", camera_rslt_to_str(ret), camera_name_);
-                goto cleanup;
-            }
+    IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->name_index, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_register", "camera_manager_->name_index")
+    IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->live_ids, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_register", "camera_manager_->live_ids")
+
+    // NOTE: 名称が未登録(STRING_ATOM_INVALID)の場合、登録済みカメラのアトムとは一致しないため重複チェックは不要
+    name_atom = string_intern_find(camera_name_);
+    if(STRING_ATOM_INVALID != name_atom) {
+        ret_hash_map = hash_map_find(&name_atom, camera_manager_->name_index, &registered_id);
+        if(HASH_MAP_SUCCESS == ret_hash_map) {
+            ret = CAMERA_BAD_OPERATION;
+            ERROR_MESSAGE("camera_manager_register(%s) - Provided camera name '%s' is already registered.", camera_rslt_to_str(ret), camera_name_);
+            goto cleanup;
+        } else if(HASH_MAP_KEY_NOT_FOUND != ret_hash_map) {
+            ret = camera_rslt_convert_hash_map(ret_hash_map);
+            ERROR_MESSAGE("camera_manager_register(%s) - Failed to search name index.", camera_rslt_to_str(ret));
+            goto cleanup;
         }
     }
-    if(INVALID_CAMERA_ID == free_slot) {
+    ret_sparse_set = sparse_set_acquire(camera_manager_->live_ids, &acquired_id);
+    if(SPARSE_SET_LIMIT_EXCEEDED == ret_sparse_set) {
         ret = CAMERA_LIMIT_EXCEEDED;
         ERROR_MESSAGE("camera_manager_register(%s) - Camera manager has no free slot.", camera_rslt_to_str(ret));
         goto cleanup;
-    } else {
-        ret = camera_create(camera_name_, &tmp_camera);
-        if(CAMERA_SUCCESS != ret) {
-            ERROR_MESSAGE("camera_manager_register(%s) - Failed to create camera(%s).", camera_rslt_to_str(ret), camera_name_);
-            goto cleanup;
-        }
-        camera_manager_->camera_array[free_slot] = tmp_camera;
-        *out_camera_id_ = free_slot;
+    } else if(SPARSE_SET_SUCCESS != ret_sparse_set) {
+        ret = camera_rslt_convert_sparse_set(ret_sparse_set);
+        ERROR_MESSAGE("camera_manager_register(%s) - Failed to acquire free slot.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+    free_slot = (int16_t)acquired_id;
+    if(NULL != camera_manager_->camera_array[free_slot]) {
+        ret = CAMERA_DATA_CORRUPTED;
+        ERROR_MESSAGE("camera_manager_register(%s) - Acquired slot '%d' is already in use.", camera_rslt_to_str(ret), free_slot);
+        goto cleanup;
     }
 
+    // Simulation.
+    ret = camera_create(camera_name_, &tmp_camera);
+    if(CAMERA_SUCCESS != ret) {
+        ERROR_MESSAGE("camera_manager_register(%s) - Failed to create camera(%s).", camera_rslt_to_str(ret), camera_name_);
+        goto cleanup;
+    }
+    // camera_createで名称がインターンテーブルに登録されるため、アトムはカメラから取得する
+    name_atom = camera_name_atom_get(tmp_camera);
+    ret_hash_map = hash_map_insert(&name_atom, &free_slot, camera_manager_->name_index);
+    if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = camera_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("camera_manager_register(%s) - Failed to register camera name '%s' to name index.", camera_rslt_to_str(ret), camera_name_);
+        goto cleanup;
+    }
+
+    // commit.
+    camera_manager_->camera_array[free_slot] = tmp_camera;
+    tmp_camera = NULL;
+    *out_camera_id_ = free_slot;
+
     ret = CAMERA_SUCCESS;
 
 cleanup:
+    if(CAMERA_SUCCESS != ret) {
+        camera_destroy(&tmp_camera);
+        if(INVALID_CAMERA_ID != free_slot) {
+            sparse_set_remove((uint32_t)free_slot, camera_manager_->live_ids);
+        }
+    }
     return ret;
 }
 
@@ -217,15 +330,15 @@ camera_result_t camera_manager_unregister(int16_t camera_id_, camera_manager_t*
     IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->camera_array, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_unregister", "camera_manager_->camera_array")
     IF_ARG_FALSE_GOTO_CLEANUP(camera_id_ >= 0, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_unregister", "camera_id_")
     IF_ARG_FALSE_GOTO_CLEANUP(camera_manager_->max_camera_count > camera_id_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_unregister", "camera_id")
+    IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->name_index, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_unregister", "camera_manager_->name_index")
+    IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->live_ids, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_unregister", "camera_manager_->live_ids")
 
     if(NULL == camera_manager_->camera_array[camera_id_]) {
         ret = CAMERA_BAD_OPERATION;
         ERROR_MESSAGE("camera_manager_unregister(%s) - Provided camera id '%d' is not registered.", camera_rslt_to_str(ret), camera_id_);
         goto cleanup;
     }
-    camera_destroy(&camera_manager_->camera_array[camera_id_]);
-
-    ret = CAMERA_SUCCESS;
+    ret = camera_slot_release(camera_id_, camera_manager_, "camera_manager_unregister");
 
 cleanup:
     return ret;
@@ -253,9 +366,7 @@ camera_result_t camera_manager_unregister_by_name(const char* name_, camera_mana
         ERROR_MESSAGE("camera_manager_unregister_by_name(%s) - Failed to get camera id. Provided camera name = '%s'.", camera_rslt_to_str(ret), name_);
         goto cleanup;
     }
-    camera_destroy(&camera_manager_->camera_array[tmp_id]);
-
-    ret = CAMERA_SUCCESS;
+    ret = camera_slot_release(tmp_id, camera_manager_, "camera_manager_unregister_by_name");
 
 cleanup:
     return ret;
@@ -271,33 +382,39 @@ camera_result_t camera_manager_camera_id_get(const char* name_, const camera_man
     }
 #endif
     camera_result_t ret = CAMERA_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
     int16_t tmp_id = INVALID_CAMERA_ID;
-    bool found = false;
+    void* found_id = NULL;
+    string_atom_t name_atom = STRING_ATOM_INVALID;
 
     IF_ARG_NULL_GOTO_CLEANUP(camera_manager_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_camera_id_get", "camera_manager_")
     IF_ARG_FALSE_GOTO_CLEANUP(camera_manager_->max_camera_count > 0, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_camera_id_get", "camera_manager_->max_camera_count")
     IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->camera_array, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_camera_id_get", "camera_manager_->camera_array")
     IF_ARG_NULL_GOTO_CLEANUP(name_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_camera_id_get", "name_")
     IF_ARG_NULL_GOTO_CLEANUP(out_camera_id_, ret, CAMERA_INVALID_ARGUMENT, camera_rslt_to_str(CAMERA_INVALID_ARGUMENT), "camera_manager_camera_id_get", "out_camera_id_")
+    IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->name_index, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), "camera_manager_camera_id_get", "camera_manager_->name_index")
 
-    for(int16_t i = 0; i != camera_manager_->max_camera_count; ++i) {
-        if(NULL != camera_manager_->camera_array[i]) {
-            const char* tmp_name = camera_name_get(camera_manager_->camera_array[i]);
-            if(NULL == tmp_name) {
-                ret = CAMERA_DATA_CORRUPTED;
-                ERROR_MESSAGE("camera_manager_camera_id_get(%s) - Camera manager data corrupted.", camera_rslt_to_str(ret));
-                goto cleanup;
-            } else if(choco_string_equal(name_, tmp_name)) {
-                tmp_id = i;
-                found = true;
-                break;
-            }
-        }
+    // 名称をアトムに変換し、名称インデックスからカメラIDを検索する
+    // NOTE: カメラの存在確認に使用することも考慮し、未登録の場合はワーニング、エラーは出さない
+    name_atom = string_intern_find(name_);
+    if(STRING_ATOM_INVALID == name_atom) {
+        ret = CAMERA_BAD_OPERATION;
+        goto cleanup;
     }
-    if(!found) {
-        // NOTE: カメラの存在確認に使用することも考慮し、ワーニング、エラーは出さない
+    ret_hash_map = hash_map_find(&name_atom, camera_manager_->name_index, &found_id);
+    if(HASH_MAP_KEY_NOT_FOUND == ret_hash_map) {
         ret = CAMERA_BAD_OPERATION;
         goto cleanup;
+    } else if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = camera_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("camera_manager_camera_id_get(%s) - Failed to search name index.", camera_rslt_to_str(ret));
+        goto cleanup;
+    }
+    tmp_id = *(const int16_t*)found_id;
+    if(tmp_id < 0 || tmp_id >= camera_manager_->max_camera_count || NULL == camera_manager_->camera_array[tmp_id] || name_atom != camera_name_atom_get(camera_manager_->camera_array[tmp_id])) {
+        ret = CAMERA_DATA_CORRUPTED;
+        ERROR_MESSAGE("camera_manager_camera_id_get(%s) - Camera manager data corrupted.", camera_rslt_to_str(ret));
+        goto cleanup;
     }
 
     *out_camera_id_ = tmp_id;
@@ -370,6 +487,45 @@ cleanup:
     return ret;
 }
 
+/**
+ * @brief 登録中のカメラを名称インデックスと登録中IDの集合から削除し、カメラを破棄する(camera_manager_unregister / camera_manager_unregister_by_name共通処理)
+ *
+ * @warning 本関数は引数のチェックを行わない(camera_id_は登録中のカメラのIDであること)
+ *
+ * @param[in] camera_id_ 破棄するカメラのID
+ * @param[in,out] camera_manager_ カメラ管理構造体インスタンスへのポインタ
+ * @param[in] func_name_ エラーメッセージに出力する呼び出し元API名
+ *
+ * @retval CAMERA_BAD_OPERATION 登録中IDの集合が未設定(camera_manager_->live_ids == NULL)
+ * @retval CAMERA_DATA_CORRUPTED camera_id_が登録中IDの集合に含まれない、カメラ名称が名称インデックスに登録されていない、または名称インデックス内部データ破損(カメラは破棄しない)
+ * @retval CAMERA_SUCCESS カメラの破棄に成功し、正常終了
+ */
+static camera_result_t camera_slot_release(int16_t camera_id_, camera_manager_t* camera_manager_, const char* func_name_) {
+    camera_result_t ret = CAMERA_INVALID_ARGUMENT;
+    const string_atom_t name_atom = camera_name_atom_get(camera_manager_->camera_array[camera_id_]);
+
+    // NOTE: unregister_by_nameはlive_idsを検証しない経路から呼び出されるためここで検証する
+    IF_ARG_NULL_GOTO_CLEANUP(camera_manager_->live_ids, ret, CAMERA_BAD_OPERATION, camera_rslt_to_str(CAMERA_BAD_OPERATION), func_name_, "camera_manager_->live_ids")
+    if(!sparse_set_contains((uint32_t)camera_id_, camera_manager_->live_ids)) {
+        ret = CAMERA_DATA_CORRUPTED;
+        ERROR_MESSAGE("%s(%s) - Camera id '%d' is not found in live id set.", func_name_, camera_rslt_to_str(ret), camera_id_);
+        goto cleanup;
+    }
+    if(HASH_MAP_SUCCESS != hash_map_remove(&name_atom, camera_manager_->name_index)) {
+        ret = CAMERA_DATA_CORRUPTED;
+        ERROR_MESSAGE("%s(%s) - Camera id '%d' is not found in name index.", func_name_, camera_rslt_to_str(ret), camera_id_);
+        goto cleanup;
+    }
+    // 登録中であることは確認済みのため失敗しない
+    sparse_set_remove((uint32_t)camera_id_, camera_manager_->live_ids);
+    camera_destroy(&camera_manager_->camera_array[camera_id_]);
+
+    ret = CAMERA_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
 #ifdef TEST_BUILD
 void NO_COVERAGE test_camera_manager_initialize_config_set(const test_call_control_t* config_) {
     if(NULL == config_) {
@@ -445,6 +601,7 @@ void NO_COVERAGE test_camera_manager_config_reset(void) {
 }
 
 void NO_COVERAGE test_camera_manager(void) {
+    test_camera_manager_preinit();
     test_camera_manager_initialize();
     test_camera_manager_deinitialize();
     test_camera_manager_register();
@@ -455,6 +612,79 @@ void NO_COVERAGE test_camera_manager(void) {
     test_camera_manager_camera_get_by_name();
 }
 
+/**
+ * @brief テスト用に手動で構築したカメラ管理構造体に、メモリシステムから確保した名称インデックスと登録中IDの集合を付与する
+ *
+ * @note メモリシステムが初期化済みであること。camera_arrayに格納済みのカメラは名称インデックスと登録中IDの集合に登録される
+ *
+ * @param[in,out] manager_ 付与対象カメラ管理構造体(max_camera_count, camera_arrayは設定済みであること)
+ */
+static void NO_COVERAGE test_name_index_attach(camera_manager_t* manager_) {
+    assert(HASH_MAP_SUCCESS == hash_map_create((size_t)manager_->max_camera_count, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), &manager_->name_index));
+    assert(SPARSE_SET_SUCCESS == sparse_set_create((size_t)manager_->max_camera_count, &manager_->live_ids));
+    for(int16_t i = 0; i != manager_->max_camera_count; ++i) {
+        if(NULL != manager_->camera_array[i]) {
+            const string_atom_t atom = camera_name_atom_get(manager_->camera_array[i]);
+            assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &i, manager_->name_index));
+            assert(SPARSE_SET_SUCCESS == sparse_set_insert((uint32_t)i, manager_->live_ids));
+        }
+    }
+}
+
+/**
+ * @brief test_name_index_attachで付与した名称インデックスと登録中IDの集合を破棄する
+ *
+ * @param[in,out] manager_ 破棄対象カメラ管理構造体
+ */
+static void NO_COVERAGE test_name_index_detach(camera_manager_t* manager_) {
+    hash_map_destroy(&manager_->name_index);
+    sparse_set_destroy(&manager_->live_ids);
+}
+
+static void NO_COVERAGE test_camera_manager_preinit(void) {
+    {
+        /* 引数異常 -> CAMERA_INVALID_ARGUMENT */
+        size_t pool_size = 0U;
+        assert(CAMERA_INVALID_ARGUMENT == camera_manager_preinit(4, NULL));
+        assert(CAMERA_INVALID_ARGUMENT == camera_manager_preinit(0, &pool_size));
+        assert(CAMERA_INVALID_ARGUMENT == camera_manager_preinit(-1, &pool_size));
+        assert(0U == pool_size);
+    }
+    {
+        /* 正常系: 算出した容量で camera_manager_initialize が過不足なく成功すること */
+        linear_alloc_t* allocator = NULL;
+        void* linear_alloc_pool = NULL;
+        size_t linear_alloc_pool_size = 0U;
+        size_t linear_alloc_mem_req = 0U;
+        size_t linear_alloc_align_req = 0U;
+        size_t marker = 0U;
+        camera_manager_t* camera_manager = NULL;
+
+        test_camera_manager_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+
+        assert(CAMERA_SUCCESS == camera_manager_preinit(4, &linear_alloc_pool_size));
+        assert((sizeof(camera_manager_t) + sizeof(camera_t*) * 4U) <= linear_alloc_pool_size);
+
+        linear_allocator_preinit(&linear_alloc_mem_req, &linear_alloc_align_req);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(linear_alloc_mem_req, MEMORY_TAG_SYSTEM, (void**)&allocator));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(linear_alloc_pool_size, MEMORY_TAG_SYSTEM, &linear_alloc_pool));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(allocator, linear_alloc_pool_size, linear_alloc_pool));
+
+        assert(CAMERA_SUCCESS == camera_manager_initialize(4, allocator, &camera_manager));
+        assert(NULL != camera_manager);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(allocator, &marker));
+        assert(linear_alloc_pool_size == marker);
+
+        camera_manager_deinitialize(camera_manager);
+        memory_system_free(linear_alloc_pool, linear_alloc_pool_size, MEMORY_TAG_SYSTEM);
+        memory_system_free(allocator, linear_alloc_mem_req, MEMORY_TAG_SYSTEM);
+        memory_system_destroy();
+    }
+}
+
 // Generated by ChatGPT
 static void NO_COVERAGE test_camera_manager_initialize(void) {
     {
@@ -681,6 +911,7 @@ static void NO_COVERAGE test_camera_manager_initialize(void) {
 
         assert(max_camera_count == camera_manager->max_camera_count);
         assert(NULL != camera_manager->camera_array);
+        assert(NULL != camera_manager->name_index);
 
         for(int16_t i = 0; i != max_camera_count; ++i) {
             assert(NULL == camera_manager->camera_array[i]);
@@ -748,16 +979,35 @@ static void NO_COVERAGE test_camera_manager_deinitialize(void) {
         assert((camera_t*)0x2 == manager.camera_array[1]);
     }
     {
-        /* 登録カメラがない場合でも全スロットを処理し、max_camera_count が 0 になること */
+        /* live_ids == NULL の場合は no-op であること */
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { (camera_t*)0x1, NULL };
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+
+        camera_manager_deinitialize(&manager);
+
+        assert(2 == manager.max_camera_count);
+        assert((camera_t*)0x1 == manager.camera_array[0]);
+    }
+    {
+        /* 登録カメラがない場合でも max_camera_count が 0 になること */
         camera_manager_t manager = {0};
         camera_t* camera_array[3] = { NULL, NULL, NULL };
 
         test_camera_manager_config_reset();
         test_camera_config_reset();
         test_choco_memory_config_reset();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         camera_manager_deinitialize(&manager);
 
@@ -766,6 +1016,9 @@ static void NO_COVERAGE test_camera_manager_deinitialize(void) {
         assert(NULL == manager.camera_array[0]);
         assert(NULL == manager.camera_array[1]);
         assert(NULL == manager.camera_array[2]);
+
+        test_name_index_detach(&manager);
+        memory_system_destroy();
     }
     {
         /* 登録済みカメラを全て破棄し、各スロットが NULL になること */
@@ -795,6 +1048,7 @@ static void NO_COVERAGE test_camera_manager_deinitialize(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         camera_manager_deinitialize(&manager);
 
@@ -803,11 +1057,13 @@ static void NO_COVERAGE test_camera_manager_deinitialize(void) {
         assert(NULL == manager.camera_array[0]);
         assert(NULL == manager.camera_array[1]);
         assert(NULL == manager.camera_array[2]);
+        assert(0U == sparse_set_count(manager.live_ids));
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
-        /* NULLスロットと登録済みカメラが混在していても全走査できること */
+        /* NULLスロットと登録済みカメラが混在していても登録中のカメラのみを破棄できること */
         memory_system_result_t ret_mem = MEMORY_SYSTEM_INVALID_ARGUMENT;
         camera_result_t ret = CAMERA_UNDEFINED_ERROR;
         camera_manager_t manager = {0};
@@ -830,6 +1086,7 @@ static void NO_COVERAGE test_camera_manager_deinitialize(void) {
 
         manager.max_camera_count = 4;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         camera_manager_deinitialize(&manager);
 
@@ -839,7 +1096,9 @@ static void NO_COVERAGE test_camera_manager_deinitialize(void) {
         assert(NULL == manager.camera_array[1]);
         assert(NULL == manager.camera_array[2]);
         assert(NULL == manager.camera_array[3]);
+        assert(0U == sparse_set_count(manager.live_ids));
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -987,6 +1246,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_register("main_camera", &manager, &camera_id);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -998,6 +1258,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
         assert(choco_string_equal("main_camera", camera_name_get(manager.camera_array[1])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1025,6 +1286,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
 
         manager.max_camera_count = 2;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_register("new_camera", &manager, &camera_id);
         assert(CAMERA_LIMIT_EXCEEDED == ret);
@@ -1036,6 +1298,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
         assert(choco_string_equal("camera_1", camera_name_get(manager.camera_array[1])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1051,8 +1314,11 @@ static void NO_COVERAGE test_camera_manager_register(void) {
         test_choco_memory_config_reset();
         test_call_control_reset(&config);
 
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
         manager.max_camera_count = 2;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         config.fail_on_call = 1U;
         config.forced_result = (int)CAMERA_NO_MEMORY;
@@ -1063,8 +1329,154 @@ static void NO_COVERAGE test_camera_manager_register(void) {
         assert(123 == camera_id);
         assert(NULL == manager.camera_array[0]);
         assert(NULL == manager.camera_array[1]);
+        assert(0U == hash_map_count(manager.name_index));
+        assert(0U == sparse_set_count(manager.live_ids));
+
+        test_camera_config_reset();
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+    }
+    {
+        /* camera_manager_->name_index == NULL -> CAMERA_BAD_OPERATION */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+        int16_t camera_id = 123;
 
+        test_camera_manager_config_reset();
         test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+
+        ret = camera_manager_register("main_camera", &manager, &camera_id);
+        assert(CAMERA_BAD_OPERATION == ret);
+        assert(123 == camera_id);
+        assert(NULL == manager.camera_array[0]);
+    }
+    {
+        /* 名称インデックスへの登録失敗が伝播し、生成したカメラは破棄されること */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        test_call_control_t config = {0};
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+        int16_t camera_id = 123;
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+        test_hash_map_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HASH_MAP_LIMIT_EXCEEDED;
+        test_hash_map_insert_config_set(&config);
+
+        ret = camera_manager_register("main_camera", &manager, &camera_id);
+        assert(CAMERA_LIMIT_EXCEEDED == ret);
+        assert(123 == camera_id);
+        assert(NULL == manager.camera_array[0]);
+        assert(NULL == manager.camera_array[1]);
+        assert(STRING_ATOM_INVALID == string_intern_find("main_camera"));
+        assert(0U == sparse_set_count(manager.live_ids));
+
+        test_hash_map_config_reset();
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+    }
+    {
+        /* camera_manager_->live_ids == NULL -> CAMERA_BAD_OPERATION */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+        int16_t camera_id = 123;
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
+        sparse_set_destroy(&manager.live_ids);
+
+        ret = camera_manager_register("main_camera", &manager, &camera_id);
+        assert(CAMERA_BAD_OPERATION == ret);
+        assert(123 == camera_id);
+        assert(NULL == manager.camera_array[0]);
+
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+    }
+    {
+        /* 空きスロット払い出しの失敗が伝播し、カメラは生成されないこと */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        test_call_control_t config = {0};
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+        int16_t camera_id = 123;
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+        test_sparse_set_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
+
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SPARSE_SET_DATA_CORRUPTED;
+        test_sparse_set_acquire_config_set(&config);
+
+        ret = camera_manager_register("main_camera", &manager, &camera_id);
+        assert(CAMERA_DATA_CORRUPTED == ret);
+        assert(123 == camera_id);
+        assert(NULL == manager.camera_array[0]);
+        assert(NULL == manager.camera_array[1]);
+        assert(STRING_ATOM_INVALID == string_intern_find("main_camera"));
+
+        test_sparse_set_config_reset();
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+    }
+    {
+        /* 払い出されたスロットが使用中(live_idsとcamera_arrayの不整合) -> CAMERA_DATA_CORRUPTED */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+        int16_t camera_id = 123;
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
+        camera_array[0] = (camera_t*)0x1;
+
+        ret = camera_manager_register("main_camera", &manager, &camera_id);
+        assert(CAMERA_DATA_CORRUPTED == ret);
+        assert(123 == camera_id);
+        assert((camera_t*)0x1 == manager.camera_array[0]);
+        assert(0U == sparse_set_count(manager.live_ids));
+
+        camera_array[0] = NULL;
+        test_name_index_detach(&manager);
+        memory_system_destroy();
     }
     {
         /* 正常系: 空配列なら先頭スロットに登録されること */
@@ -1083,6 +1495,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
 
         manager.max_camera_count = 2;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_register("main_camera", &manager, &camera_id);
         assert(CAMERA_SUCCESS == ret);
@@ -1093,6 +1506,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
         assert(choco_string_equal("main_camera", camera_name_get(manager.camera_array[0])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1120,6 +1534,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
 
         manager.max_camera_count = 4;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_register("new_camera", &manager, &camera_id);
         assert(CAMERA_SUCCESS == ret);
@@ -1135,6 +1550,7 @@ static void NO_COVERAGE test_camera_manager_register(void) {
         assert(choco_string_equal("existing_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -1276,6 +1692,7 @@ static void NO_COVERAGE test_camera_manager_unregister(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_unregister(1, &manager);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -1286,6 +1703,7 @@ static void NO_COVERAGE test_camera_manager_unregister(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1316,6 +1734,7 @@ static void NO_COVERAGE test_camera_manager_unregister(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_unregister(1, &manager);
         assert(CAMERA_SUCCESS == ret);
@@ -1326,8 +1745,40 @@ static void NO_COVERAGE test_camera_manager_unregister(void) {
 
         assert(choco_string_equal("camera_0", camera_name_get(manager.camera_array[0])));
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
+        assert(2U == sparse_set_count(manager.live_ids));
+        assert(!sparse_set_contains(1U, manager.live_ids));
+
+        camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+    }
+    {
+        /* 登録中IDの集合に含まれないカメラ -> CAMERA_DATA_CORRUPTED(カメラは破棄しない) */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
 
+        assert(CAMERA_SUCCESS == camera_create("camera_0", &camera_array[0]));
+
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
+        assert(SPARSE_SET_SUCCESS == sparse_set_remove(0U, manager.live_ids));
+
+        ret = camera_manager_unregister(0, &manager);
+        assert(CAMERA_DATA_CORRUPTED == ret);
+        assert(NULL != manager.camera_array[0]);
+        assert(1U == hash_map_count(manager.name_index));
+
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(0U, manager.live_ids));
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -1453,6 +1904,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
 
         manager.max_camera_count = 2;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         config.fail_on_call = 1U;
         config.forced_result = (int)CAMERA_DATA_CORRUPTED;
@@ -1469,6 +1921,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
         test_camera_manager_config_reset();
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1495,6 +1948,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_unregister_by_name("not_found_camera", &manager);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -1506,6 +1960,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1536,6 +1991,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
 
         manager.max_camera_count = 4;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_unregister_by_name("target_camera", &manager);
         assert(CAMERA_SUCCESS == ret);
@@ -1549,6 +2005,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
         assert(choco_string_equal("camera_3", camera_name_get(manager.camera_array[3])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1579,6 +2036,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_unregister_by_name("target_camera", &manager);
         assert(CAMERA_SUCCESS == ret);
@@ -1591,6 +2049,7 @@ static void NO_COVERAGE test_camera_manager_unregister_by_name(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -1742,6 +2201,7 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_id_get("not_found_camera", &manager, &camera_id);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -1754,6 +2214,7 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1767,8 +2228,11 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
         test_camera_config_reset();
         test_choco_memory_config_reset();
 
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_id_get("main_camera", &manager, &camera_id);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -1777,6 +2241,71 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
         assert(NULL == manager.camera_array[0]);
         assert(NULL == manager.camera_array[1]);
         assert(NULL == manager.camera_array[2]);
+
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+    }
+    {
+        /* camera_manager_->name_index == NULL -> CAMERA_BAD_OPERATION */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        camera_manager_t manager = {0};
+        camera_t* camera_array[1] = { NULL };
+        int16_t camera_id = 123;
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        manager.max_camera_count = 1;
+        manager.camera_array = camera_array;
+
+        ret = camera_manager_camera_id_get("main_camera", &manager, &camera_id);
+        assert(CAMERA_BAD_OPERATION == ret);
+        assert(123 == camera_id);
+    }
+    {
+        /* 名称インデックスとカメラ配列が一致しない場合は CAMERA_DATA_CORRUPTED を返すこと */
+        camera_result_t ret = CAMERA_UNDEFINED_ERROR;
+        camera_manager_t manager = {0};
+        camera_t* camera_array[2] = { NULL, NULL };
+        int16_t camera_id = 123;
+        int16_t* indexed_id = NULL;
+        string_atom_t atom = STRING_ATOM_INVALID;
+
+        test_camera_manager_config_reset();
+        test_camera_config_reset();
+        test_choco_memory_config_reset();
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        assert(CAMERA_SUCCESS == camera_create("main_camera", &camera_array[0]));
+        manager.max_camera_count = 2;
+        manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
+
+        // 名称インデックスが空きスロットを指すように改ざんする
+        atom = camera_name_atom_get(camera_array[0]);
+        assert(HASH_MAP_SUCCESS == hash_map_find(&atom, manager.name_index, (void**)&indexed_id));
+        *indexed_id = 1;
+        ret = camera_manager_camera_id_get("main_camera", &manager, &camera_id);
+        assert(CAMERA_DATA_CORRUPTED == ret);
+        assert(123 == camera_id);
+
+        // 範囲外のIDを指すように改ざんする
+        *indexed_id = 2;
+        ret = camera_manager_camera_id_get("main_camera", &manager, &camera_id);
+        assert(CAMERA_DATA_CORRUPTED == ret);
+        assert(123 == camera_id);
+
+        // 名称インデックスから削除されたカメラの登録解除は CAMERA_DATA_CORRUPTED となり、カメラは破棄されないこと
+        assert(HASH_MAP_SUCCESS == hash_map_remove(&atom, manager.name_index));
+        ret = camera_manager_unregister(0, &manager);
+        assert(CAMERA_DATA_CORRUPTED == ret);
+        assert(NULL != manager.camera_array[0]);
+
+        camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
     }
     {
         /* 先頭に NULL スロットがあっても後ろの一致名を探索できること */
@@ -1807,6 +2336,7 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
 
         manager.max_camera_count = 4;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_id_get("target_camera", &manager, &camera_id);
         assert(CAMERA_SUCCESS == ret);
@@ -1821,6 +2351,7 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
         assert(choco_string_equal("camera_3", camera_name_get(manager.camera_array[3])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -1852,6 +2383,7 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_id_get("target_camera", &manager, &camera_id);
         assert(CAMERA_SUCCESS == ret);
@@ -1866,6 +2398,7 @@ static void NO_COVERAGE test_camera_manager_camera_id_get(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -2038,7 +2571,9 @@ static void NO_COVERAGE test_camera_manager_camera_get(void) {
         assert(NULL == manager.camera_array[1]);
         assert(NULL != manager.camera_array[2]);
 
+        test_name_index_attach(&manager);
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -2084,7 +2619,9 @@ static void NO_COVERAGE test_camera_manager_camera_get(void) {
         assert(choco_string_equal("target_camera", camera_name_get(manager.camera_array[1])));
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
+        test_name_index_attach(&manager);
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -2240,6 +2777,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
 
         manager.max_camera_count = 2;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         config.fail_on_call = 1U;
         config.forced_result = (int)CAMERA_DATA_CORRUPTED;
@@ -2257,6 +2795,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
         test_camera_manager_config_reset();
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -2284,6 +2823,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_get_by_name("not_found_camera", &manager, &out_camera);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -2296,6 +2836,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -2309,8 +2850,11 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
         test_camera_config_reset();
         test_choco_memory_config_reset();
 
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_get_by_name("main_camera", &manager, &out_camera);
         assert(CAMERA_BAD_OPERATION == ret);
@@ -2319,6 +2863,9 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
         assert(NULL == manager.camera_array[0]);
         assert(NULL == manager.camera_array[1]);
         assert(NULL == manager.camera_array[2]);
+
+        test_name_index_detach(&manager);
+        memory_system_destroy();
     }
     {
         /* 先頭に NULL スロットがあっても後ろの一致名を取得できること */
@@ -2349,6 +2896,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
 
         manager.max_camera_count = 4;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_get_by_name("target_camera", &manager, &out_camera);
         assert(CAMERA_SUCCESS == ret);
@@ -2364,6 +2912,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
         assert(choco_string_equal("camera_3", camera_name_get(manager.camera_array[3])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
     {
@@ -2395,6 +2944,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
 
         manager.max_camera_count = 3;
         manager.camera_array = camera_array;
+        test_name_index_attach(&manager);
 
         ret = camera_manager_camera_get_by_name("target_camera", &manager, &out_camera);
         assert(CAMERA_SUCCESS == ret);
@@ -2410,6 +2960,7 @@ static void NO_COVERAGE test_camera_manager_camera_get_by_name(void) {
         assert(choco_string_equal("camera_2", camera_name_get(manager.camera_array[2])));
 
         camera_manager_deinitialize(&manager);
+        test_name_index_detach(&manager);
         memory_system_destroy();
     }
 }
@@ -107,6 +107,7 @@ static test_call_control_t s_test_config_test_vtable_pump_messages;           /*
 static test_call_control_t s_test_config_test_vtable_swap_buffers;            /**< test_vtable_swap_buffers()テスト設定 */
 
 // 全テスト関数プロトタイプ宣言
+static void test_platform_preinit(void);
 static void test_platform_initialize(void);
 static void test_platform_destroy(void);
 static void test_platform_window_create(void);
@@ -130,6 +131,42 @@ static const platform_vtable_t* platform_vtable_get(platform_type_t platform_typ
 
 static bool platform_type_valid_check(platform_type_t platform_type_);
 
+platform_result_t platform_preinit(platform_type_t platform_type_, size_t* io_pool_requirement_) {
+    platform_result_t ret = PLATFORM_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    const platform_vtable_t* vtable = NULL;
+    size_t backend_memory_req = 0;
+    size_t backend_align_req = 0;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, PLATFORM_INVALID_ARGUMENT, platform_rslt_to_str(PLATFORM_INVALID_ARGUMENT), "platform_preinit", "io_pool_requirement_")
+    IF_ARG_FALSE_GOTO_CLEANUP(platform_type_valid_check(platform_type_), ret, PLATFORM_INVALID_ARGUMENT, platform_rslt_to_str(PLATFORM_INVALID_ARGUMENT), "platform_preinit", "platform_type_")
+
+    vtable = platform_vtable_get(platform_type_);
+    if(NULL == vtable) {
+        ret = PLATFORM_RUNTIME_ERROR;
+        ERROR_MESSAGE("platform_preinit(%s) - Failed to get platform vtable.", platform_rslt_to_str(ret));
+        goto cleanup;
+    }
+    vtable->platform_backend_preinit(&backend_memory_req, &backend_align_req);
+
+    // platform_initializeと同じ順序で加算する
+    ret_linear_alloc = linear_allocator_requirement_add(sizeof(platform_context_t), alignof(platform_context_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(backend_memory_req, backend_align_req, io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = platform_rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("platform_preinit(%s) - Failed to accumulate pool requirement.", platform_rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = PLATFORM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
 platform_result_t platform_initialize(linear_alloc_t* allocator_, platform_type_t platform_type_, platform_context_t** out_platform_context_) {
 #ifdef TEST_BUILD
     s_test_config_platform_initialize.call_count++;
@@ -406,6 +443,7 @@ void NO_COVERAGE test_platform_context_config_reset(void) {
 void test_platform_context(void) {
     test_platform_context_config_reset();
 
+    test_platform_preinit();
     test_platform_initialize();
     test_platform_destroy();
     test_platform_window_create();
@@ -502,6 +540,71 @@ static void NO_COVERAGE dummy_mouse_event_callback(const mouse_event_t* event_)
 }
 
 // Generated by ChatGPT
+static void NO_COVERAGE test_platform_preinit(void) {
+    test_platform_context_config_reset();
+
+    {
+        // io_pool_requirement_ == NULL
+        assert(PLATFORM_INVALID_ARGUMENT == platform_preinit(PLATFORM_USE_GLFW, NULL));
+    }
+
+    {
+        // platform_type_が無効値
+        size_t pool_size = 0;
+
+        test_platform_context_config_reset();
+        s_test_config_platform_type_valid_check.fail_on_call = 1;
+        s_test_config_platform_type_valid_check.forced_result = false;
+
+        assert(PLATFORM_INVALID_ARGUMENT == platform_preinit(PLATFORM_USE_GLFW, &pool_size));
+        assert(0U == pool_size);
+    }
+
+    {
+        // vtable取得失敗
+        size_t pool_size = 0;
+
+        test_platform_context_config_reset();
+        s_test_config_platform_vtable_config.enable_test_vtable = true;
+        s_test_config_platform_vtable_config.vtable_select = TEST_PLATFORM_VTABLE_NULL;
+
+        assert(PLATFORM_RUNTIME_ERROR == platform_preinit(PLATFORM_USE_GLFW, &pool_size));
+        assert(0U == pool_size);
+    }
+
+    {
+        // 正常系: 算出した容量でplatform_initializeが過不足なく成功すること
+        platform_result_t ret = PLATFORM_INVALID_ARGUMENT;
+        platform_context_t* context = NULL;
+        size_t pool_size = 0;
+        size_t marker = 0;
+
+        linear_alloc_t* allocator = NULL;
+        void* memory_pool = NULL;
+
+        test_platform_context_config_reset();
+        s_test_config_platform_vtable_config.enable_test_vtable = true;
+        s_test_config_platform_vtable_config.vtable_select = TEST_PLATFORM_VTABLE_TEST;
+        s_test_config_test_vtable_init.forced_result = PLATFORM_SUCCESS;
+
+        ret = platform_preinit(PLATFORM_USE_GLFW, &pool_size);
+        assert(PLATFORM_SUCCESS == ret);
+        assert(sizeof(platform_context_t) <= pool_size);
+
+        test_linear_allocator_create(&allocator, &memory_pool, pool_size);
+
+        ret = platform_initialize(allocator, PLATFORM_USE_GLFW, &context);
+        assert(PLATFORM_SUCCESS == ret);
+        assert(NULL != context);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(allocator, &marker));
+        assert(pool_size == marker);
+
+        test_linear_allocator_destroy(&allocator, &memory_pool);
+    }
+
+    test_platform_context_config_reset();
+}
+
 static void NO_COVERAGE test_platform_initialize(void) {
     test_platform_context_config_reset();
 
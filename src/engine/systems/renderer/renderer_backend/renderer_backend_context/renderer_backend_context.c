@@ -230,6 +230,7 @@ static renderer_result_t s_test_config_test_renderer_texture_unbind;
 static renderer_result_t s_test_config_test_renderer_texture_pixel_upload;              /**< test_renderer_texture_pixel_upload()テスト設定 */
 
 // 全テスト関数プロトタイプ宣言
+static void test_renderer_backend_preinit(void);
 static void test_renderer_backend_initialize(void);
 static void test_renderer_backend_destroy(void);
 static void test_renderer_backend_shader_create(void);
@@ -262,6 +263,28 @@ static void test_texture_vtable_get(void);
 static void test_graphics_api_valid_check(void);
 #endif
 
+renderer_result_t renderer_backend_preinit(target_graphics_api_t target_api_, size_t* io_pool_requirement_) {
+    renderer_result_t ret = RENDERER_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, RENDERER_INVALID_ARGUMENT, renderer_rslt_to_str(RENDERER_INVALID_ARGUMENT), "renderer_backend_preinit", "io_pool_requirement_")
+    IF_ARG_FALSE_GOTO_CLEANUP(graphics_api_valid_check(target_api_), ret, RENDERER_INVALID_ARGUMENT, renderer_rslt_to_str(RENDERER_INVALID_ARGUMENT), "renderer_backend_preinit", "target_api_")
+
+    // renderer_backend_initializeと同じ順序で加算する(各vtableは静的データのため割り当て不要)
+    ret_linear_alloc = linear_allocator_requirement_add(sizeof(renderer_backend_context_t), alignof(renderer_backend_context_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = renderer_rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("renderer_backend_preinit(%s) - Failed to accumulate pool requirement.", renderer_rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = RENDERER_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
 renderer_result_t renderer_backend_initialize(linear_alloc_t* allocator_, target_graphics_api_t target_api_, renderer_backend_context_t** out_renderer_backend_context_) {
 #ifdef TEST_BUILD
     s_test_config_renderer_backend_initialize.call_count++;
@@ -1413,6 +1436,7 @@ void NO_COVERAGE test_renderer_backend_context_config_reset(void) {
 }
 
 void NO_COVERAGE test_renderer_backend_context(void) {
+    test_renderer_backend_preinit();
     test_renderer_backend_initialize();
     test_renderer_backend_destroy();
     test_renderer_backend_shader_create();
@@ -1446,6 +1470,39 @@ void NO_COVERAGE test_renderer_backend_context(void) {
 }
 
 // Generated by ChatGPT
+static void NO_COVERAGE test_renderer_backend_preinit(void) {
+    {
+        // io_pool_requirement_ == NULL
+        test_renderer_backend_context_config_reset();
+        assert(RENDERER_INVALID_ARGUMENT == renderer_backend_preinit(GRAPHICS_API_GL33, NULL));
+    }
+    {
+        // target_api_が既定値外
+        size_t pool_size = 0U;
+
+        test_renderer_backend_context_config_reset();
+        s_test_config_graphics_api_valid_check.fail_on_call = 1U;
+        s_test_config_graphics_api_valid_check.forced_result = false;
+
+        assert(RENDERER_INVALID_ARGUMENT == renderer_backend_preinit(GRAPHICS_API_GL33, &pool_size));
+        assert(0U == pool_size);
+
+        test_renderer_backend_context_config_reset();
+    }
+    {
+        // 正常系: コンテキストのアライメント調整分を含めて加算される
+        size_t pool_size = 0U;
+
+        test_renderer_backend_context_config_reset();
+        assert(RENDERER_SUCCESS == renderer_backend_preinit(GRAPHICS_API_GL33, &pool_size));
+        assert(sizeof(renderer_backend_context_t) == pool_size);
+
+        pool_size = 1U;
+        assert(RENDERER_SUCCESS == renderer_backend_preinit(GRAPHICS_API_GL33, &pool_size));
+        assert((alignof(renderer_backend_context_t) + sizeof(renderer_backend_context_t)) == pool_size);
+    }
+}
+
 static void NO_COVERAGE test_renderer_backend_initialize(void) {
     {
         // renderer_backend_initialize() 冒頭で強制的に RENDERER_BAD_OPERATION を返させる
@@ -27,6 +27,9 @@
 #include "engine/core/memory/linear_allocator.h"
 
 #include "engine/containers/choco_string.h"
+#include "engine/containers/hash_map.h"
+#include "engine/containers/sparse_set.h"
+#include "engine/containers/string_intern.h"
 
 #include "engine/resource/resource_core/resource_types.h"
 #include "engine/resource/resource_core/resource_err_utils.h"
@@ -43,6 +46,8 @@ struct texture_manager {
     int16_t max_texture_count;                      /**< システムで管理可能なテクスチャの最大値 */
     texture_t** cpu_resources;                      /**< CPU側テクスチャリソース配列 */
     renderer_backend_texture_t** gpu_resources;     /**< GPU側テクスチャリソース配列 */
+    hash_map_t* name_index;                         /**< テクスチャ名アトム(string_atom_t)からテクスチャID(int16_t)への対応表 */
+    sparse_set_t* live_ids;                         /**< 登録中のテクスチャIDの集合(空きスロットの払い出しと登録中テクスチャの走査に使用) */
 };
 
 static const char* const s_rslt_str_success = "SUCCESS";                        /**< 実行結果コード: TEXTURE_SYSTEM_SUCCESSの文字列 */
@@ -63,6 +68,8 @@ static const char* tex_sys_rslt_to_str(texture_system_result_t rslt_);
 static texture_system_result_t tex_sys_rslt_convert_linear_alloc(linear_allocator_result_t rslt_);
 static texture_system_result_t tex_sys_rslt_convert_renderer(renderer_result_t rslt_);
 static texture_system_result_t tex_sys_rslt_convert_resource(resource_result_t rslt_);
+static texture_system_result_t tex_sys_rslt_convert_hash_map(hash_map_result_t rslt_);
+static texture_system_result_t tex_sys_rslt_convert_sparse_set(sparse_set_result_t rslt_);
 
 // #define TEST_BUILD
 
@@ -74,6 +81,9 @@ static texture_system_result_t tex_sys_rslt_convert_resource(resource_result_t r
 #include "engine/core/memory/test_choco_memory.h"
 #include "engine/core/memory/test_linear_allocator.h"
 
+#include "engine/containers/test_hash_map.h"
+#include "engine/containers/test_sparse_set.h"
+
 #include "engine/systems/texture_system/test_texture_manager.h"
 
 #include "engine/systems/renderer/renderer_backend/renderer_backend_context/test_context_texture.h"
@@ -95,6 +105,7 @@ static test_call_control_t s_test_config_texture_manager_gpu_resource_get_by_nam
 // プライベート関数テスト設定
 
 // 全テスト関数プロトタイプ宣言
+static void test_texture_manager_preinit(void);
 static void test_texture_manager_initialize(void);
 static void test_texture_manager_deinitialize(void);
 static void test_texture_manager_register(void);
@@ -107,8 +118,55 @@ static void test_tex_sys_rslt_to_str(void);
 static void test_tex_sys_rslt_convert_linear_alloc(void);
 static void test_tex_sys_rslt_convert_renderer(void);
 static void test_tex_sys_rslt_convert_resource(void);
+static void test_tex_sys_rslt_convert_hash_map(void);
+static void test_tex_sys_rslt_convert_sparse_set(void);
+
+static void test_name_index_attach(texture_manager_t* manager_);
+static void test_name_index_detach(texture_manager_t* manager_);
 #endif
 
+texture_system_result_t texture_manager_preinit(int16_t max_texture_count_, size_t* io_pool_requirement_) {
+    texture_system_result_t ret = TEXTURE_SYSTEM_INVALID_ARGUMENT;
+    linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
+    sparse_set_result_t ret_sparse_set = SPARSE_SET_INVALID_ARGUMENT;
+
+    // Preconditions.
+    IF_ARG_NULL_GOTO_CLEANUP(io_pool_requirement_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_preinit", "io_pool_requirement_")
+    IF_ARG_FALSE_GOTO_CLEANUP(0 < max_texture_count_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_preinit", "max_texture_count_")
+
+    // texture_manager_initializeと同じ順序で加算する
+    ret_linear_alloc = linear_allocator_requirement_add(sizeof(texture_manager_t), alignof(texture_manager_t), io_pool_requirement_);
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(sizeof(texture_t*) * (size_t)(max_texture_count_), alignof(texture_t*), io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS == ret_linear_alloc) {
+        ret_linear_alloc = linear_allocator_requirement_add(sizeof(renderer_backend_texture_t*) * (size_t)(max_texture_count_), alignof(renderer_backend_texture_t*), io_pool_requirement_);
+    }
+    if(LINEAR_ALLOC_SUCCESS != ret_linear_alloc) {
+        ret = tex_sys_rslt_convert_linear_alloc(ret_linear_alloc);
+        ERROR_MESSAGE("texture_manager_preinit(%s) - Failed to accumulate pool requirement.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_hash_map = hash_map_preinit((size_t)max_texture_count_, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), io_pool_requirement_);
+    if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = tex_sys_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("texture_manager_preinit(%s) - Failed to accumulate pool requirement for name index.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_sparse_set = sparse_set_preinit((size_t)max_texture_count_, io_pool_requirement_);
+    if(SPARSE_SET_SUCCESS != ret_sparse_set) {
+        ret = tex_sys_rslt_convert_sparse_set(ret_sparse_set);
+        ERROR_MESSAGE("texture_manager_preinit(%s) - Failed to accumulate pool requirement for live id set.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+
+    ret = TEXTURE_SYSTEM_SUCCESS;
+
+cleanup:
+    return ret;
+}
+
 texture_system_result_t texture_manager_initialize(int16_t max_texture_count_, linear_alloc_t* allocator_, texture_manager_t** out_texture_manager_) {
 #ifdef TEST_BUILD
     s_test_config_texture_manager_initialize.call_count++;
@@ -120,6 +178,8 @@ texture_system_result_t texture_manager_initialize(int16_t max_texture_count_, l
 #endif
     texture_system_result_t ret = TEXTURE_SYSTEM_INVALID_ARGUMENT;
     linear_allocator_result_t ret_linear_alloc = LINEAR_ALLOC_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
+    sparse_set_result_t ret_sparse_set = SPARSE_SET_INVALID_ARGUMENT;
     texture_manager_t* tmp_manager = NULL;
     texture_t** tmp_cpu_resources = NULL;
     renderer_backend_texture_t** tmp_gpu_resources = NULL;
@@ -161,6 +221,19 @@ texture_system_result_t texture_manager_initialize(int16_t max_texture_count_, l
         tmp_manager->gpu_resources[i] = NULL;
     }
 
+    ret_hash_map = hash_map_initialize((size_t)max_texture_count_, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), allocator_, &tmp_manager->name_index);
+    if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = tex_sys_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("texture_manager_initialize(%s) - Failed to initialize name index.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_sparse_set = sparse_set_initialize((size_t)max_texture_count_, allocator_, &tmp_manager->live_ids);
+    if(SPARSE_SET_SUCCESS != ret_sparse_set) {
+        ret = tex_sys_rslt_convert_sparse_set(ret_sparse_set);
+        ERROR_MESSAGE("texture_manager_initialize(%s) - Failed to initialize live id set.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+
     // commit.
     *out_texture_manager_ = tmp_manager;
 
@@ -172,6 +245,9 @@ cleanup:
 }
 
 void texture_manager_deinitialize(renderer_backend_context_t* backend_context_, texture_manager_t* texture_manager_) {
+    const uint32_t* live_ids = NULL;
+    size_t live_count = 0;
+
     if(NULL == backend_context_) {
         WARN_MESSAGE("texture_manager_deinitialize - Provided backend_context_ is not valid.");
         return;
@@ -188,11 +264,20 @@ void texture_manager_deinitialize(renderer_backend_context_t* backend_context_,
         WARN_MESSAGE("texture_manager_deinitialize - Provided texture_manager_->gpu_resources or texture_manager_->cpu_resources is not initialized.");
         return;
     }
-    for(int16_t i = 0; i != texture_manager_->max_texture_count; ++i) {
+    if(NULL == texture_manager_->live_ids) {
+        WARN_MESSAGE("texture_manager_deinitialize - Provided texture_manager_->live_ids is not initialized.");
+        return;
+    }
+    // 全スロットではなく、登録中のテクスチャIDのみを走査する
+    live_ids = sparse_set_dense(texture_manager_->live_ids);
+    live_count = sparse_set_count(texture_manager_->live_ids);
+    for(size_t i = 0; i != live_count; ++i) {
         // NOTE: texture_destroy, renderer_backend_texture_destroyはNULLを渡されたら何もしないのでチェック不要
-        texture_destroy(&texture_manager_->cpu_resources[i]);
-        renderer_backend_texture_destroy(backend_context_, &texture_manager_->gpu_resources[i]);
+        texture_destroy(&texture_manager_->cpu_resources[live_ids[i]]);
+        renderer_backend_texture_destroy(backend_context_, &texture_manager_->gpu_resources[live_ids[i]]);
     }
+    sparse_set_clear(texture_manager_->live_ids);
+    hash_map_clear(texture_manager_->name_index);
     texture_manager_->max_texture_count = 0;
     texture_manager_->cpu_resources = NULL;
     texture_manager_->gpu_resources = NULL;
@@ -217,6 +302,11 @@ texture_system_result_t texture_manager_register(renderer_backend_context_t* bac
     uint16_t width = 0;
     uint16_t height = 0;
     uint8_t channel_count = 0;
+    string_atom_t name_atom = STRING_ATOM_INVALID;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
+    sparse_set_result_t ret_sparse_set = SPARSE_SET_INVALID_ARGUMENT;
+    uint32_t acquired_id = 0;
+    void* registered_id = NULL;
 
     IF_ARG_NULL_GOTO_CLEANUP(backend_context_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_register", "backend_context_")
     IF_ARG_NULL_GOTO_CLEANUP(texture_name_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_register", "texture_name_")
@@ -226,38 +316,39 @@ texture_system_result_t texture_manager_register(renderer_backend_context_t* bac
     IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->cpu_resources, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_register", "texture_manager_->cpu_resources")
     IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->gpu_resources, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_register", "texture_manager_->gpu_resources")
     IF_ARG_FALSE_GOTO_CLEANUP(gpu_unit_num_ >= 0, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_register", "gpu_unit_num_")
-
-    for(int16_t i = 0; i != texture_manager_->max_texture_count; ++i) {
-        if(NULL == texture_manager_->cpu_resources[i] && NULL != texture_manager_->gpu_resources[i]) {
-            ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
-            ERROR_MESSAGE("texture_manager_register(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
+    IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->name_index, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_register", "texture_manager_->name_index")
+    IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->live_ids, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_register", "texture_manager_->live_ids")
+
+    // NOTE: 名称が未登録(STRING_ATOM_INVALID)の場合、登録済みテクスチャのアトムとは一致しないため重複チェックは不要
+    name_atom = string_intern_find(texture_name_);
+    if(STRING_ATOM_INVALID != name_atom) {
+        ret_hash_map = hash_map_find(&name_atom, texture_manager_->name_index, &registered_id);
+        if(HASH_MAP_SUCCESS == ret_hash_map) {
+            ret = TEXTURE_SYSTEM_BAD_OPERATION;
+            ERROR_MESSAGE("texture_manager_register(%s) - Provided texture name '%s' is already registered.", tex_sys_rslt_to_str(ret), texture_name_);
             goto cleanup;
-        } else if(NULL != texture_manager_->cpu_resources[i] && NULL == texture_manager_->gpu_resources[i]) {
-            ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
-            ERROR_MESSAGE("texture_manager_register(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
+        } else if(HASH_MAP_KEY_NOT_FOUND != ret_hash_map) {
+            ret = tex_sys_rslt_convert_hash_map(ret_hash_map);
+            ERROR_MESSAGE("texture_manager_register(%s) - Failed to search name index.", tex_sys_rslt_to_str(ret));
             goto cleanup;
-        } else if(NULL == texture_manager_->cpu_resources[i] && NULL == texture_manager_->gpu_resources[i]) {
-            if(INVALID_TEXTURE_ID == free_slot) {
-                free_slot = i;
-            }
-        } else {
-            const char* name = texture_name_get(texture_manager_->cpu_resources[i]);
-            if(NULL == name) {
-                // NOTE: cpu_resources[i] != NULL && gpu_resources[i] != NULLでname == NULLは破損
-                ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
-                ERROR_MESSAGE("texture_manager_register(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
-                goto cleanup;
-            } else if(choco_string_equal(texture_name_, name)) {
-                ret = TEXTURE_SYSTEM_BAD_OPERATION;
-                ERROR_MESSAGE("texture_manager_register(%s) - Provided texture name '%s' is already registered.", tex_sys_rslt_to_str(ret), texture_name_);
-                goto cleanup;
-            }
         }
     }
-    if(INVALID_TEXTURE_ID == free_slot) {
+    ret_sparse_set = sparse_set_acquire(texture_manager_->live_ids, &acquired_id);
+    if(SPARSE_SET_LIMIT_EXCEEDED == ret_sparse_set) {
         ret = TEXTURE_SYSTEM_LIMIT_EXCEEDED;
         ERROR_MESSAGE("texture_manager_register(%s) - Texture manager has no free slot.", tex_sys_rslt_to_str(ret));
         goto cleanup;
+    } else if(SPARSE_SET_SUCCESS != ret_sparse_set) {
+        ret = tex_sys_rslt_convert_sparse_set(ret_sparse_set);
+        ERROR_MESSAGE("texture_manager_register(%s) - Failed to acquire free slot.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+    free_slot = (int16_t)acquired_id;
+    // 払い出されたスロットは未登録であるため、CPU / GPUリソースのいずれかが格納されていれば内部データ破損
+    if(NULL != texture_manager_->cpu_resources[free_slot] || NULL != texture_manager_->gpu_resources[free_slot]) {
+        ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
+        ERROR_MESSAGE("texture_manager_register(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
     } else {
         ret_resource = texture_create(texture_name_, &tmp_cpu_resource);
         if(RESOURCE_SUCCESS != ret_resource) {
@@ -308,6 +399,15 @@ texture_system_result_t texture_manager_register(renderer_backend_context_t* bac
             goto cleanup;
         }
 
+        // texture_createで名称がインターンテーブルに登録されるため、アトムはテクスチャから取得する
+        name_atom = texture_name_atom_get(tmp_cpu_resource);
+        ret_hash_map = hash_map_insert(&name_atom, &free_slot, texture_manager_->name_index);
+        if(HASH_MAP_SUCCESS != ret_hash_map) {
+            ret = tex_sys_rslt_convert_hash_map(ret_hash_map);
+            ERROR_MESSAGE("texture_manager_register(%s) - Failed to register texture name '%s' to name index.", tex_sys_rslt_to_str(ret), texture_name_);
+            goto cleanup;
+        }
+
         texture_manager_->cpu_resources[free_slot] = tmp_cpu_resource;
         texture_manager_->gpu_resources[free_slot] = tmp_gpu_resource;
         *out_texture_id_ = free_slot;
@@ -319,6 +419,9 @@ cleanup:
     if(TEXTURE_SYSTEM_SUCCESS != ret && NULL != backend_context_) {
         texture_destroy(&tmp_cpu_resource);
         renderer_backend_texture_destroy(backend_context_, &tmp_gpu_resource);
+        if(INVALID_TEXTURE_ID != free_slot) {
+            sparse_set_remove((uint32_t)free_slot, texture_manager_->live_ids);
+        }
     }
     return ret;
 }
@@ -333,6 +436,7 @@ texture_system_result_t texture_manager_unregister(renderer_backend_context_t* b
     }
 #endif
     texture_system_result_t ret = TEXTURE_SYSTEM_INVALID_ARGUMENT;
+    string_atom_t name_atom = STRING_ATOM_INVALID;
 
     IF_ARG_NULL_GOTO_CLEANUP(backend_context_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_unregister", "backend_context_")
     IF_ARG_NULL_GOTO_CLEANUP(texture_manager_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_unregister", "texture_manager_")
@@ -341,6 +445,8 @@ texture_system_result_t texture_manager_unregister(renderer_backend_context_t* b
     IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->gpu_resources, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_unregister", "texture_manager_->gpu_resources")
     IF_ARG_FALSE_GOTO_CLEANUP(texture_id_ < texture_manager_->max_texture_count, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_unregister", "texture_id_")
     IF_ARG_FALSE_GOTO_CLEANUP(texture_id_ >= 0, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_unregister", "texture_id_")
+    IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->name_index, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_unregister", "texture_manager_->name_index")
+    IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->live_ids, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_unregister", "texture_manager_->live_ids")
 
     if(NULL == texture_manager_->cpu_resources[texture_id_] && NULL != texture_manager_->gpu_resources[texture_id_]) {
         ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
@@ -355,6 +461,19 @@ texture_system_result_t texture_manager_unregister(renderer_backend_context_t* b
         ERROR_MESSAGE("texture_manager_unregister(%s) - Provided texture id '%d' is not registered.", tex_sys_rslt_to_str(ret), texture_id_);
         goto cleanup;
     }
+    if(!sparse_set_contains((uint32_t)texture_id_, texture_manager_->live_ids)) {
+        ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
+        ERROR_MESSAGE("texture_manager_unregister(%s) - Provided texture id '%d' is not found in live id set.", tex_sys_rslt_to_str(ret), texture_id_);
+        goto cleanup;
+    }
+    name_atom = texture_name_atom_get(texture_manager_->cpu_resources[texture_id_]);
+    if(HASH_MAP_SUCCESS != hash_map_remove(&name_atom, texture_manager_->name_index)) {
+        ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
+        ERROR_MESSAGE("texture_manager_unregister(%s) - Provided texture id '%d' is not found in name index.", tex_sys_rslt_to_str(ret), texture_id_);
+        goto cleanup;
+    }
+    // 登録中であることは確認済みのため失敗しない
+    sparse_set_remove((uint32_t)texture_id_, texture_manager_->live_ids);
     renderer_backend_texture_destroy(backend_context_, &texture_manager_->gpu_resources[texture_id_]);
     texture_destroy(&texture_manager_->cpu_resources[texture_id_]);
 
@@ -411,8 +530,10 @@ texture_system_result_t texture_manager_texture_id_get(const char* name_, const
     }
 #endif
     texture_system_result_t ret = TEXTURE_SYSTEM_INVALID_ARGUMENT;
+    hash_map_result_t ret_hash_map = HASH_MAP_INVALID_ARGUMENT;
     int16_t ret_id = INVALID_TEXTURE_ID;
-    bool found = false;
+    void* found_id = NULL;
+    string_atom_t name_atom = STRING_ATOM_INVALID;
 
     IF_ARG_NULL_GOTO_CLEANUP(texture_manager_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_texture_id_get", "texture_manager_")
     IF_ARG_FALSE_GOTO_CLEANUP(texture_manager_->max_texture_count > 0, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_texture_id_get", "texture_manager_->max_texture_count")
@@ -420,33 +541,29 @@ texture_system_result_t texture_manager_texture_id_get(const char* name_, const
     IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->gpu_resources, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_texture_id_get", "texture_manager_->gpu_resources")
     IF_ARG_NULL_GOTO_CLEANUP(name_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_texture_id_get", "name_")
     IF_ARG_NULL_GOTO_CLEANUP(out_texture_id_, ret, TEXTURE_SYSTEM_INVALID_ARGUMENT, tex_sys_rslt_to_str(TEXTURE_SYSTEM_INVALID_ARGUMENT), "texture_manager_texture_id_get", "out_texture_id_")
+    IF_ARG_NULL_GOTO_CLEANUP(texture_manager_->name_index, ret, TEXTURE_SYSTEM_BAD_OPERATION, tex_sys_rslt_to_str(TEXTURE_SYSTEM_BAD_OPERATION), "texture_manager_texture_id_get", "texture_manager_->name_index")
 
-    for(int16_t i = 0; i != texture_manager_->max_texture_count; ++i) {
-        if(NULL == texture_manager_->cpu_resources[i] && NULL != texture_manager_->gpu_resources[i]) {
-            ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
-            ERROR_MESSAGE("texture_manager_texture_id_get(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
-            goto cleanup;
-        } else if(NULL != texture_manager_->cpu_resources[i] && NULL == texture_manager_->gpu_resources[i]) {
-            ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
-            ERROR_MESSAGE("texture_manager_texture_id_get(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
-            goto cleanup;
-        } else if(NULL != texture_manager_->cpu_resources[i]) {
-            const char* tmp_texture_name = texture_name_get(texture_manager_->cpu_resources[i]);
-            if(NULL == tmp_texture_name) {
-                ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
-                ERROR_MESSAGE("texture_manager_texture_id_get(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
-                goto cleanup;
-            } else if(choco_string_equal(name_, tmp_texture_name)) {
-                ret_id = i;
-                found = true;
-                break;
-            }
-        }
+    // 名称をアトムに変換し、名称インデックスからテクスチャIDを検索する
+    // NOTE: テクスチャの存在確認に使用することも考慮し、未登録の場合はワーニング、エラーは出さない
+    name_atom = string_intern_find(name_);
+    if(STRING_ATOM_INVALID == name_atom) {
+        ret = TEXTURE_SYSTEM_BAD_OPERATION;
+        goto cleanup;
     }
-    if(!found) {
-        // NOTE: カメラの存在確認に使用することも考慮し、ワーニング、エラーは出さない
+    ret_hash_map = hash_map_find(&name_atom, texture_manager_->name_index, &found_id);
+    if(HASH_MAP_KEY_NOT_FOUND == ret_hash_map) {
         ret = TEXTURE_SYSTEM_BAD_OPERATION;
         goto cleanup;
+    } else if(HASH_MAP_SUCCESS != ret_hash_map) {
+        ret = tex_sys_rslt_convert_hash_map(ret_hash_map);
+        ERROR_MESSAGE("texture_manager_texture_id_get(%s) - Failed to search name index.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
+    }
+    ret_id = *(const int16_t*)found_id;
+    if(ret_id < 0 || ret_id >= texture_manager_->max_texture_count || NULL == texture_manager_->cpu_resources[ret_id] || NULL == texture_manager_->gpu_resources[ret_id] || name_atom != texture_name_atom_get(texture_manager_->cpu_resources[ret_id])) {
+        ret = TEXTURE_SYSTEM_DATA_CORRUPTED;
+        ERROR_MESSAGE("texture_manager_texture_id_get(%s) - Texture manager data corrupted.", tex_sys_rslt_to_str(ret));
+        goto cleanup;
     }
 
     *out_texture_id_ = ret_id;
@@ -642,6 +759,64 @@ static texture_system_result_t tex_sys_rslt_convert_resource(resource_result_t r
     }
 }
 
+static texture_system_result_t tex_sys_rslt_convert_hash_map(hash_map_result_t rslt_) {
+    switch(rslt_) {
+    case HASH_MAP_SUCCESS:
+        return TEXTURE_SYSTEM_SUCCESS;
+    case HASH_MAP_INVALID_ARGUMENT:
+        return TEXTURE_SYSTEM_INVALID_ARGUMENT;
+    case HASH_MAP_NO_MEMORY:
+        return TEXTURE_SYSTEM_NO_MEMORY;
+    case HASH_MAP_RUNTIME_ERROR:
+        return TEXTURE_SYSTEM_RUNTIME_ERROR;
+    case HASH_MAP_LIMIT_EXCEEDED:
+        return TEXTURE_SYSTEM_LIMIT_EXCEEDED;
+    case HASH_MAP_BAD_OPERATION:
+        return TEXTURE_SYSTEM_BAD_OPERATION;
+    case HASH_MAP_DATA_CORRUPTED:
+        return TEXTURE_SYSTEM_DATA_CORRUPTED;
+    case HASH_MAP_OVERFLOW:
+        return TEXTURE_SYSTEM_OVERFLOW;
+    case HASH_MAP_KEY_NOT_FOUND:
+        return TEXTURE_SYSTEM_BAD_OPERATION;
+    case HASH_MAP_KEY_EXISTS:
+        return TEXTURE_SYSTEM_BAD_OPERATION;
+    case HASH_MAP_UNDEFINED_ERROR:
+        return TEXTURE_SYSTEM_UNDEFINED_ERROR;
+    default:
+        return TEXTURE_SYSTEM_UNDEFINED_ERROR;
+    }
+}
+
+static texture_system_result_t tex_sys_rslt_convert_sparse_set(sparse_set_result_t rslt_) {
+    switch(rslt_) {
+    case SPARSE_SET_SUCCESS:
+        return TEXTURE_SYSTEM_SUCCESS;
+    case SPARSE_SET_INVALID_ARGUMENT:
+        return TEXTURE_SYSTEM_INVALID_ARGUMENT;
+    case SPARSE_SET_NO_MEMORY:
+        return TEXTURE_SYSTEM_NO_MEMORY;
+    case SPARSE_SET_RUNTIME_ERROR:
+        return TEXTURE_SYSTEM_RUNTIME_ERROR;
+    case SPARSE_SET_LIMIT_EXCEEDED:
+        return TEXTURE_SYSTEM_LIMIT_EXCEEDED;
+    case SPARSE_SET_BAD_OPERATION:
+        return TEXTURE_SYSTEM_BAD_OPERATION;
+    case SPARSE_SET_DATA_CORRUPTED:
+        return TEXTURE_SYSTEM_DATA_CORRUPTED;
+    case SPARSE_SET_OVERFLOW:
+        return TEXTURE_SYSTEM_OVERFLOW;
+    case SPARSE_SET_ID_NOT_FOUND:
+        return TEXTURE_SYSTEM_BAD_OPERATION;
+    case SPARSE_SET_ID_EXISTS:
+        return TEXTURE_SYSTEM_BAD_OPERATION;
+    case SPARSE_SET_UNDEFINED_ERROR:
+        return TEXTURE_SYSTEM_UNDEFINED_ERROR;
+    default:
+        return TEXTURE_SYSTEM_UNDEFINED_ERROR;
+    }
+}
+
 #ifdef TEST_BUILD
 void NO_COVERAGE test_texture_manager_initialize_config_set(const test_call_control_t* config_) {
     if(NULL == config_) {
@@ -717,6 +892,7 @@ void NO_COVERAGE test_texture_manager_config_reset(void) {
 }
 
 void NO_COVERAGE test_texture_manager(void) {
+    test_texture_manager_preinit();
     test_texture_manager_initialize();
     test_texture_manager_deinitialize();
     test_texture_manager_register();
@@ -729,9 +905,99 @@ void NO_COVERAGE test_texture_manager(void) {
     test_tex_sys_rslt_convert_linear_alloc();
     test_tex_sys_rslt_convert_renderer();
     test_tex_sys_rslt_convert_resource();
+    test_tex_sys_rslt_convert_hash_map();
+    test_tex_sys_rslt_convert_sparse_set();
+}
+
+/**
+ * @brief テスト用に手動で構築したテクスチャ管理構造体に、静的領域のリニアアロケータから確保した名称インデックスと登録中IDの集合を付与する
+ *
+ * @note cpu_resources, gpu_resourcesの両方が設定済みのスロットのテクスチャは名称インデックスと登録中IDの集合に登録される(ダミーポインタを格納したスロットは両方が設定されていないこと)
+ *
+ * @param[in,out] manager_ 付与対象テクスチャ管理構造体(max_texture_count, cpu_resources, gpu_resourcesは設定済みであること)
+ */
+static void NO_COVERAGE test_name_index_attach(texture_manager_t* manager_) {
+    static max_align_t s_allocator_storage[8];
+    static max_align_t s_pool_storage[64];
+    linear_alloc_t* allocator = (linear_alloc_t*)s_allocator_storage;
+    size_t allocator_memory_requirement = 0;
+    size_t allocator_align_requirement = 0;
+    size_t pool_requirement = 0;
+
+    linear_allocator_preinit(&allocator_memory_requirement, &allocator_align_requirement);
+    assert(allocator_memory_requirement <= sizeof(s_allocator_storage));
+    assert(HASH_MAP_SUCCESS == hash_map_preinit((size_t)manager_->max_texture_count, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), &pool_requirement));
+    assert(SPARSE_SET_SUCCESS == sparse_set_preinit((size_t)manager_->max_texture_count, &pool_requirement));
+    assert(pool_requirement <= sizeof(s_pool_storage));
+    assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(allocator, sizeof(s_pool_storage), s_pool_storage));
+
+    manager_->name_index = NULL;
+    assert(HASH_MAP_SUCCESS == hash_map_initialize((size_t)manager_->max_texture_count, sizeof(string_atom_t), alignof(string_atom_t), sizeof(int16_t), alignof(int16_t), allocator, &manager_->name_index));
+    manager_->live_ids = NULL;
+    assert(SPARSE_SET_SUCCESS == sparse_set_initialize((size_t)manager_->max_texture_count, allocator, &manager_->live_ids));
+    for(int16_t i = 0; i != manager_->max_texture_count; ++i) {
+        if(NULL != manager_->cpu_resources[i] && NULL != manager_->gpu_resources[i]) {
+            const string_atom_t atom = texture_name_atom_get(manager_->cpu_resources[i]);
+            assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &i, manager_->name_index));
+            assert(SPARSE_SET_SUCCESS == sparse_set_insert((uint32_t)i, manager_->live_ids));
+        }
+    }
+}
+
+/**
+ * @brief test_name_index_attachで付与した名称インデックスと登録中IDの集合を破棄する
+ *
+ * @param[in,out] manager_ 破棄対象テクスチャ管理構造体
+ */
+static void NO_COVERAGE test_name_index_detach(texture_manager_t* manager_) {
+    hash_map_destroy(&manager_->name_index);
+    sparse_set_destroy(&manager_->live_ids);
 }
 
 // Generated by ChatGPT
+static void NO_COVERAGE test_texture_manager_preinit(void) {
+    {
+        // 引数異常 -> TEXTURE_SYSTEM_INVALID_ARGUMENT
+        size_t pool_size = 0U;
+        assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == texture_manager_preinit(3, NULL));
+        assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == texture_manager_preinit(0, &pool_size));
+        assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == texture_manager_preinit(-1, &pool_size));
+        assert(0U == pool_size);
+    }
+    {
+        // 正常系: 算出した容量でtexture_manager_initializeが過不足なく成功すること
+        linear_alloc_t* allocator = NULL;
+        void* allocator_pool = NULL;
+        size_t allocator_memory_requirement = 0U;
+        size_t allocator_align_requirement = 0U;
+        size_t allocator_pool_size = 0U;
+        size_t marker = 0U;
+        texture_manager_t* manager = NULL;
+
+        test_texture_manager_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+
+        assert(TEXTURE_SYSTEM_SUCCESS == texture_manager_preinit(3, &allocator_pool_size));
+
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+        linear_allocator_preinit(&allocator_memory_requirement, &allocator_align_requirement);
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(allocator_memory_requirement, MEMORY_TAG_SYSTEM, (void**)&allocator));
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_allocate(allocator_pool_size, MEMORY_TAG_SYSTEM, &allocator_pool));
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_init(allocator, allocator_pool_size, allocator_pool));
+
+        assert(TEXTURE_SYSTEM_SUCCESS == texture_manager_initialize(3, allocator, &manager));
+        assert(NULL != manager);
+        assert(LINEAR_ALLOC_SUCCESS == linear_allocator_marker_get(allocator, &marker));
+        assert(allocator_pool_size == marker);
+
+        memory_system_free(allocator_pool, allocator_pool_size, MEMORY_TAG_SYSTEM);
+        memory_system_free(allocator, allocator_memory_requirement, MEMORY_TAG_SYSTEM);
+        memory_system_destroy();
+    }
+}
+
 static void NO_COVERAGE test_texture_manager_initialize(void) {
     {
         // texture_manager_initialize() 冒頭で強制的に TEXTURE_SYSTEM_RUNTIME_ERROR を返させる
@@ -1049,7 +1315,73 @@ static void NO_COVERAGE test_texture_manager_initialize(void) {
         test_choco_memory_config_reset();
     }
     {
-        // 正常系: manager / cpu_resources / gpu_resources を確保し、全スロットをNULL初期化する
+        // 4回目の linear_allocator_allocate() が失敗
+        // name_index の確保失敗 -> TEXTURE_SYSTEM_NO_MEMORY
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
+        linear_alloc_t* allocator = NULL;
+        void* allocator_pool = NULL;
+        size_t allocator_memory_requirement = 0U;
+        size_t allocator_align_requirement = 0U;
+        size_t allocator_pool_size = 4096U;
+        texture_manager_t* manager = NULL;
+        test_call_control_t config = {0};
+
+        test_texture_manager_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+
+        ret_memory = memory_system_create();
+        assert(MEMORY_SYSTEM_SUCCESS == ret_memory);
+
+        linear_allocator_preinit(&allocator_memory_requirement, &allocator_align_requirement);
+
+        ret_memory = memory_system_allocate(
+            allocator_memory_requirement,
+            MEMORY_TAG_SYSTEM,
+            (void**)&allocator
+        );
+        assert(MEMORY_SYSTEM_SUCCESS == ret_memory);
+        assert(NULL != allocator);
+
+        ret_memory = memory_system_allocate(
+            allocator_pool_size,
+            MEMORY_TAG_SYSTEM,
+            &allocator_pool
+        );
+        assert(MEMORY_SYSTEM_SUCCESS == ret_memory);
+        assert(NULL != allocator_pool);
+
+        ret_linear = linear_allocator_init(
+            allocator,
+            allocator_pool_size,
+            allocator_pool
+        );
+        assert(LINEAR_ALLOC_SUCCESS == ret_linear);
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 4U;
+        config.forced_result = (int)LINEAR_ALLOC_NO_MEMORY;
+        test_linear_allocator_allocate_config_set(&config);
+
+        ret = texture_manager_initialize(
+            2,
+            allocator,
+            &manager
+        );
+
+        assert(TEXTURE_SYSTEM_NO_MEMORY == ret);
+        assert(NULL == manager);
+
+        memory_system_destroy();
+        test_texture_manager_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+    }
+    {
+        // 正常系: manager / cpu_resources / gpu_resources / name_index を確保し、全スロットをNULL初期化する
         texture_system_result_t ret = TEXTURE_SYSTEM_INVALID_ARGUMENT;
         memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
         linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
@@ -1104,6 +1436,8 @@ static void NO_COVERAGE test_texture_manager_initialize(void) {
         assert(3 == manager->max_texture_count);
         assert(NULL != manager->cpu_resources);
         assert(NULL != manager->gpu_resources);
+        assert(NULL != manager->name_index);
+        assert(0U == hash_map_count(manager->name_index));
 
         assert(NULL == manager->cpu_resources[0]);
         assert(NULL == manager->cpu_resources[1]);
@@ -1217,6 +1551,28 @@ static void NO_COVERAGE test_texture_manager_deinitialize(void) {
 
         test_texture_manager_config_reset();
     }
+    {
+        // texture_manager_->live_ids == NULL -> no-op
+        renderer_backend_context_t* backend_context =
+            (renderer_backend_context_t*)(uintptr_t)0x1U;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+
+        test_texture_manager_config_reset();
+
+        texture_manager_deinitialize(backend_context, &manager);
+
+        assert(2 == manager.max_texture_count);
+        assert(cpu_resources == manager.cpu_resources);
+        assert(gpu_resources == manager.gpu_resources);
+
+        test_texture_manager_config_reset();
+    }
     {
         // 正常系: 空のmanagerを未初期化状態へ戻す
         // NOTE: renderer_backend_context_t は opaque なので renderer_backend_initialize() で生成する
@@ -1269,8 +1625,11 @@ static void NO_COVERAGE test_texture_manager_deinitialize(void) {
         manager.max_texture_count = 3;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         texture_manager_deinitialize(backend_context, &manager);
+        assert(0U == sparse_set_count(manager.live_ids));
+        test_name_index_detach(&manager);
 
         assert(0 == manager.max_texture_count);
         assert(NULL == manager.cpu_resources);
@@ -1353,8 +1712,13 @@ static void NO_COVERAGE test_texture_manager_deinitialize(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+        // GPU resourceがNULLのスロットはtest_name_index_attachで登録されないため手動で登録中にする
+        assert(SPARSE_SET_SUCCESS == sparse_set_insert(0U, manager.live_ids));
 
         texture_manager_deinitialize(backend_context, &manager);
+        assert(0U == sparse_set_count(manager.live_ids));
+        test_name_index_detach(&manager);
 
         assert(0 == manager.max_texture_count);
         assert(NULL == manager.cpu_resources);
@@ -1780,6 +2144,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_register(
             backend_context,
@@ -1794,6 +2159,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert((renderer_backend_texture_t*)(uintptr_t)0x1U == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -1830,6 +2196,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_register(
             backend_context,
@@ -1844,6 +2211,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert((texture_t*)(uintptr_t)0x1U == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -1884,6 +2252,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_register(
             backend_context,
@@ -1901,6 +2270,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         texture_destroy(&cpu_resources[0]);
         assert(NULL == cpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -1946,6 +2316,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_register(
             backend_context,
@@ -1963,6 +2334,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == cpu_resources[1]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -1997,6 +2369,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2016,6 +2389,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -2050,6 +2424,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2069,6 +2444,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -2103,6 +2479,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2127,6 +2504,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -2161,6 +2539,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2185,6 +2564,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -2219,6 +2599,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2243,6 +2624,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -2278,6 +2660,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2302,6 +2685,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
@@ -2336,6 +2720,7 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -2365,14 +2750,16 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         assert(NULL == cpu_resources[0]);
         assert(NULL == gpu_resources[0]);
 
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
     {
-        // gpu_unit_num_ < 0 -> TEXTURE_SYSTEM_INVALID_ARGUMENT
+        // hash_map_insert() が HASH_MAP_LIMIT_EXCEEDED を返す -> TEXTURE_SYSTEM_LIMIT_EXCEEDED(生成したリソースは破棄される)
         texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
         memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
         linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
         renderer_result_t ret_renderer = RENDERER_UNDEFINED_ERROR;
+        test_call_control_t config = {0};
 
         renderer_backend_context_t* backend_context = NULL;
         linear_alloc_t* allocator = NULL;
@@ -2398,46 +2785,286 @@ static void NO_COVERAGE test_texture_manager_register(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RENDERER_SUCCESS;
+        test_renderer_backend_texture_create_config_set(&config);
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RENDERER_SUCCESS;
+        test_renderer_backend_texture_pixel_upload_config_set(&config);
+
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)RESOURCE_SUCCESS;
+        test_texture_pixel_unload_config_set(&config);
+
+        test_hash_map_config_reset();
+        test_call_control_reset(&config);
+        config.fail_on_call = 1U;
+        config.forced_result = (int)HASH_MAP_LIMIT_EXCEEDED;
+        test_hash_map_insert_config_set(&config);
 
         ret = texture_manager_register(
             backend_context,
-            -1,
+            0,
             "test_texture_red",
             &manager,
             &texture_id
         );
 
-        assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == ret);
+        assert(TEXTURE_SYSTEM_LIMIT_EXCEEDED == ret);
         assert(123 == texture_id);
-
         assert(NULL == cpu_resources[0]);
-        assert(NULL == cpu_resources[1]);
         assert(NULL == gpu_resources[0]);
-        assert(NULL == gpu_resources[1]);
-
-        assert(1U == s_test_config_texture_manager_register.call_count);
+        assert(0U == hash_map_count(manager.name_index));
+        assert(0U == sparse_set_count(manager.live_ids));
 
+        test_hash_map_config_reset();
+        test_name_index_detach(&manager);
         TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
     }
-
-#undef TEST_TEXTURE_MANAGER_SETUP_BACKEND_CONTEXT
-#undef TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT
-}
-
-// Generated by ChatGPT
-static void NO_COVERAGE test_texture_manager_unregister(void) {
-    // NOTE: 現状ではrenderer_backend_texture_destroyをNo-opにできないため、成功経路を踏めない, 成功経路は実際の実行で確認することにする
     {
-        // texture_manager_unregister() 冒頭で強制的に TEXTURE_SYSTEM_RUNTIME_ERROR を返させる
+        // gpu_unit_num_ < 0 -> TEXTURE_SYSTEM_INVALID_ARGUMENT
         texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
-        renderer_backend_context_t* backend_context =
-            (renderer_backend_context_t*)(uintptr_t)0x1U;
-        texture_manager_t manager = {0};
-        texture_t* cpu_resources[2] = {NULL};
-        renderer_backend_texture_t* gpu_resources[2] = {NULL};
-        test_call_control_t config = {0};
-
-        manager.max_texture_count = 2;
+        memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
+        renderer_result_t ret_renderer = RENDERER_UNDEFINED_ERROR;
+
+        renderer_backend_context_t* backend_context = NULL;
+        linear_alloc_t* allocator = NULL;
+        void* allocator_pool = NULL;
+        size_t allocator_memory_requirement = 0U;
+        size_t allocator_align_requirement = 0U;
+        size_t allocator_pool_size = 4096U;
+
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+
+        test_texture_manager_config_reset();
+        test_texture_config_reset();
+        test_renderer_backend_context_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+
+        TEST_TEXTURE_MANAGER_SETUP_BACKEND_CONTEXT();
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+
+        ret = texture_manager_register(
+            backend_context,
+            -1,
+            "test_texture_red",
+            &manager,
+            &texture_id
+        );
+
+        assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == ret);
+        assert(123 == texture_id);
+
+        assert(NULL == cpu_resources[0]);
+        assert(NULL == cpu_resources[1]);
+        assert(NULL == gpu_resources[0]);
+        assert(NULL == gpu_resources[1]);
+
+        assert(1U == s_test_config_texture_manager_register.call_count);
+
+        TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
+    }
+    {
+        // texture_manager_->name_index == NULL -> TEXTURE_SYSTEM_BAD_OPERATION
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
+        renderer_result_t ret_renderer = RENDERER_UNDEFINED_ERROR;
+
+        renderer_backend_context_t* backend_context = NULL;
+        linear_alloc_t* allocator = NULL;
+        void* allocator_pool = NULL;
+        size_t allocator_memory_requirement = 0U;
+        size_t allocator_align_requirement = 0U;
+        size_t allocator_pool_size = 4096U;
+
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+
+        test_texture_manager_config_reset();
+        test_texture_config_reset();
+        test_renderer_backend_context_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+
+        TEST_TEXTURE_MANAGER_SETUP_BACKEND_CONTEXT();
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        manager.name_index = NULL;
+
+        ret = texture_manager_register(
+            backend_context,
+            0,
+            "test_texture_red",
+            &manager,
+            &texture_id
+        );
+
+        assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
+        assert(123 == texture_id);
+
+        assert(NULL == cpu_resources[0]);
+        assert(NULL == cpu_resources[1]);
+        assert(NULL == gpu_resources[0]);
+        assert(NULL == gpu_resources[1]);
+
+        assert(1U == s_test_config_texture_manager_register.call_count);
+
+        TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
+    }
+
+    {
+        // texture_manager_->live_ids == NULL -> TEXTURE_SYSTEM_BAD_OPERATION
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
+        renderer_result_t ret_renderer = RENDERER_UNDEFINED_ERROR;
+
+        renderer_backend_context_t* backend_context = NULL;
+        linear_alloc_t* allocator = NULL;
+        void* allocator_pool = NULL;
+        size_t allocator_memory_requirement = 0U;
+        size_t allocator_align_requirement = 0U;
+        size_t allocator_pool_size = 4096U;
+
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+
+        test_texture_manager_config_reset();
+        test_texture_config_reset();
+        test_renderer_backend_context_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+
+        TEST_TEXTURE_MANAGER_SETUP_BACKEND_CONTEXT();
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+        sparse_set_destroy(&manager.live_ids);
+
+        ret = texture_manager_register(
+            backend_context,
+            0,
+            "test_texture_red",
+            &manager,
+            &texture_id
+        );
+
+        assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
+        assert(123 == texture_id);
+
+        assert(NULL == cpu_resources[0]);
+        assert(NULL == cpu_resources[1]);
+        assert(NULL == gpu_resources[0]);
+        assert(NULL == gpu_resources[1]);
+
+        test_name_index_detach(&manager);
+        TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
+    }
+    {
+        // sparse_set_acquire() の失敗が伝播し、リソースは生成されない
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        memory_system_result_t ret_memory = MEMORY_SYSTEM_INVALID_ARGUMENT;
+        linear_allocator_result_t ret_linear = LINEAR_ALLOC_INVALID_ARGUMENT;
+        renderer_result_t ret_renderer = RENDERER_UNDEFINED_ERROR;
+        test_call_control_t config = {0};
+
+        renderer_backend_context_t* backend_context = NULL;
+        linear_alloc_t* allocator = NULL;
+        void* allocator_pool = NULL;
+        size_t allocator_memory_requirement = 0U;
+        size_t allocator_align_requirement = 0U;
+        size_t allocator_pool_size = 4096U;
+
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+
+        test_texture_manager_config_reset();
+        test_texture_config_reset();
+        test_renderer_backend_context_config_reset();
+        test_linear_allocator_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+
+        TEST_TEXTURE_MANAGER_SETUP_BACKEND_CONTEXT();
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+
+        test_sparse_set_config_reset();
+        config.fail_on_call = 1U;
+        config.forced_result = (int)SPARSE_SET_DATA_CORRUPTED;
+        test_sparse_set_acquire_config_set(&config);
+
+        ret = texture_manager_register(
+            backend_context,
+            0,
+            "test_texture_red",
+            &manager,
+            &texture_id
+        );
+
+        assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
+        assert(123 == texture_id);
+
+        assert(NULL == cpu_resources[0]);
+        assert(NULL == cpu_resources[1]);
+        assert(NULL == gpu_resources[0]);
+        assert(NULL == gpu_resources[1]);
+        assert(0U == sparse_set_count(manager.live_ids));
+
+        test_sparse_set_config_reset();
+        test_name_index_detach(&manager);
+        TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT();
+    }
+
+#undef TEST_TEXTURE_MANAGER_SETUP_BACKEND_CONTEXT
+#undef TEST_TEXTURE_MANAGER_TEARDOWN_BACKEND_CONTEXT
+}
+
+// Generated by ChatGPT
+static void NO_COVERAGE test_texture_manager_unregister(void) {
+    // NOTE: 現状ではrenderer_backend_texture_destroyをNo-opにできないため、成功経路を踏めない, 成功経路は実際の実行で確認することにする
+    {
+        // texture_manager_unregister() 冒頭で強制的に TEXTURE_SYSTEM_RUNTIME_ERROR を返させる
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        renderer_backend_context_t* backend_context =
+            (renderer_backend_context_t*)(uintptr_t)0x1U;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        test_call_control_t config = {0};
+
+        manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
 
@@ -2630,6 +3257,67 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
 
         test_texture_manager_config_reset();
     }
+    {
+        // texture_manager_->live_ids == NULL -> TEXTURE_SYSTEM_BAD_OPERATION
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        renderer_backend_context_t* backend_context =
+            (renderer_backend_context_t*)(uintptr_t)0x1U;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+        sparse_set_destroy(&manager.live_ids);
+
+        test_texture_manager_config_reset();
+
+        ret = texture_manager_unregister(
+            backend_context,
+            0,
+            &manager
+        );
+
+        assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
+        assert(1U == s_test_config_texture_manager_unregister.call_count);
+
+        test_name_index_detach(&manager);
+        test_texture_manager_config_reset();
+    }
+    {
+        // 登録中IDの集合に含まれないスロット -> TEXTURE_SYSTEM_DATA_CORRUPTED(リソースは破棄しない)
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        renderer_backend_context_t* backend_context =
+            (renderer_backend_context_t*)(uintptr_t)0x1U;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+        cpu_resources[0] = (texture_t*)(uintptr_t)0x1U;
+        gpu_resources[0] = (renderer_backend_texture_t*)(uintptr_t)0x2U;
+
+        test_texture_manager_config_reset();
+
+        ret = texture_manager_unregister(
+            backend_context,
+            0,
+            &manager
+        );
+
+        assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
+        assert((texture_t*)(uintptr_t)0x1U == cpu_resources[0]);
+        assert((renderer_backend_texture_t*)(uintptr_t)0x2U == gpu_resources[0]);
+        assert(1U == s_test_config_texture_manager_unregister.call_count);
+
+        test_name_index_detach(&manager);
+        test_texture_manager_config_reset();
+    }
     {
         // cpu_resources[texture_id_] == NULL && gpu_resources[texture_id_] != NULL
         // -> TEXTURE_SYSTEM_DATA_CORRUPTED
@@ -2646,6 +3334,7 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_texture_manager_config_reset();
 
@@ -2660,6 +3349,8 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
         assert((renderer_backend_texture_t*)(uintptr_t)0x1U == gpu_resources[0]);
         assert(1U == s_test_config_texture_manager_unregister.call_count);
 
+        test_name_index_detach(&manager);
+
         test_texture_manager_config_reset();
     }
     {
@@ -2680,6 +3371,7 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_texture_manager_config_reset();
 
@@ -2694,6 +3386,8 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
         assert(NULL == gpu_resources[0]);
         assert(1U == s_test_config_texture_manager_unregister.call_count);
 
+        test_name_index_detach(&manager);
+
         test_texture_manager_config_reset();
     }
     {
@@ -2711,6 +3405,7 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_texture_manager_config_reset();
 
@@ -2725,8 +3420,80 @@ static void NO_COVERAGE test_texture_manager_unregister(void) {
         assert(NULL == gpu_resources[0]);
         assert(1U == s_test_config_texture_manager_unregister.call_count);
 
+        test_name_index_detach(&manager);
+
+        test_texture_manager_config_reset();
+    }
+    {
+        // texture_manager_->name_index == NULL -> TEXTURE_SYSTEM_BAD_OPERATION
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        renderer_backend_context_t* backend_context =
+            (renderer_backend_context_t*)(uintptr_t)0x1U;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        manager.name_index = NULL;
+
+        test_texture_manager_config_reset();
+
+        ret = texture_manager_unregister(
+            backend_context,
+            0,
+            &manager
+        );
+
+        assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
+        assert(1U == s_test_config_texture_manager_unregister.call_count);
+
         test_texture_manager_config_reset();
     }
+    {
+        // 登録済みtextureの名称が名称インデックスに存在しない -> TEXTURE_SYSTEM_DATA_CORRUPTED
+        // NOTE: この分岐では texture_destroy() / renderer_backend_texture_destroy() に到達しないため、
+        // gpu resource はダミーポインタでよい
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        renderer_backend_context_t* backend_context =
+            (renderer_backend_context_t*)(uintptr_t)0x1U;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+
+        test_texture_manager_config_reset();
+        test_texture_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+
+        // 名称インデックスの付与後にスロットを設定し、名称インデックスには登録しない
+        assert(RESOURCE_SUCCESS == texture_create("test_texture_red", &cpu_resources[0]));
+        gpu_resources[0] = (renderer_backend_texture_t*)(uintptr_t)0x1U;
+
+        ret = texture_manager_unregister(
+            backend_context,
+            0,
+            &manager
+        );
+
+        assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
+        assert(NULL != cpu_resources[0]);
+        assert((renderer_backend_texture_t*)(uintptr_t)0x1U == gpu_resources[0]);
+        assert(1U == s_test_config_texture_manager_unregister.call_count);
+
+        texture_destroy(&cpu_resources[0]);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+        test_texture_manager_config_reset();
+        test_texture_config_reset();
+    }
 }
 
 // Generated by ChatGPT
@@ -2921,6 +3688,7 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_texture_manager_config_reset();
 
@@ -2935,16 +3703,26 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         assert(1U == s_test_config_texture_manager_texture_id_get.call_count);
         assert(0U == s_test_config_texture_manager_unregister.call_count);
 
+        test_name_index_detach(&manager);
+
         test_texture_manager_config_reset();
     }
     {
         // texture_manager_texture_id_get() が TEXTURE_SYSTEM_DATA_CORRUPTED を返す -> そのまま伝播
+        // 名称インデックスが、cpu_resources[i] == NULL && gpu_resources[i] != NULL のスロットを指す
         texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
         renderer_backend_context_t* backend_context =
             (renderer_backend_context_t*)(uintptr_t)0x1U;
         texture_manager_t manager = {0};
         texture_t* cpu_resources[2] = {NULL};
         renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        string_atom_t atom = STRING_ATOM_INVALID;
+        const int16_t stale_id = 0;
+
+        test_texture_manager_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
 
         cpu_resources[0] = NULL;
         gpu_resources[0] = (renderer_backend_texture_t*)(uintptr_t)0x1U;
@@ -2952,8 +3730,10 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
-        test_texture_manager_config_reset();
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("test_texture_red", &atom));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &stale_id, manager.name_index));
 
         ret = texture_manager_unregister_by_name(
             backend_context,
@@ -2966,6 +3746,9 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         assert(1U == s_test_config_texture_manager_texture_id_get.call_count);
         assert(0U == s_test_config_texture_manager_unregister.call_count);
 
+        string_intern_release(atom);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
         test_texture_manager_config_reset();
     }
     {
@@ -3034,6 +3817,7 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -3056,6 +3840,7 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         texture_destroy(&cpu_resources[0]);
         assert(NULL == cpu_resources[0]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -3092,6 +3877,7 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         manager.max_texture_count = 3;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -3114,6 +3900,7 @@ static void NO_COVERAGE test_texture_manager_unregister_by_name(void) {
         texture_destroy(&cpu_resources[2]);
         assert(NULL == cpu_resources[2]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -3266,37 +4053,78 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         test_texture_manager_config_reset();
     }
     {
-        // cpu_resources[i] == NULL && gpu_resources[i] != NULL -> TEXTURE_SYSTEM_DATA_CORRUPTED
+        // texture_manager_->name_index == NULL -> TEXTURE_SYSTEM_BAD_OPERATION
         texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
         texture_manager_t manager = {0};
         texture_t* cpu_resources[2] = {NULL};
         renderer_backend_texture_t* gpu_resources[2] = {NULL};
         int16_t texture_id = 123;
 
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        manager.name_index = NULL;
+
+        test_texture_manager_config_reset();
+
+        ret = texture_manager_texture_id_get("test_texture_red", &manager, &texture_id);
+
+        assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
+        assert(123 == texture_id);
+
+        test_texture_manager_config_reset();
+    }
+    {
+        // 名称インデックスが cpu_resources[i] == NULL && gpu_resources[i] != NULL のスロットを指す -> TEXTURE_SYSTEM_DATA_CORRUPTED
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+        string_atom_t atom = STRING_ATOM_INVALID;
+        const int16_t stale_id = 0;
+
+        test_texture_manager_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
         cpu_resources[0] = NULL;
         gpu_resources[0] = (renderer_backend_texture_t*)(uintptr_t)0x1U;
 
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
-        test_texture_manager_config_reset();
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("test_texture_red", &atom));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &stale_id, manager.name_index));
 
         ret = texture_manager_texture_id_get("test_texture_red", &manager, &texture_id);
 
         assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
         assert(123 == texture_id);
 
+        string_intern_release(atom);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
         test_texture_manager_config_reset();
     }
     {
-        // cpu_resources[i] != NULL && gpu_resources[i] == NULL -> TEXTURE_SYSTEM_DATA_CORRUPTED
-        // NOTE: この分岐では texture_name_get() に到達しないため、ダミーポインタでよい
+        // 名称インデックスが cpu_resources[i] != NULL && gpu_resources[i] == NULL のスロットを指す -> TEXTURE_SYSTEM_DATA_CORRUPTED
+        // NOTE: この分岐では texture_name_atom_get() に到達しないため、ダミーポインタでよい
         texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
         texture_manager_t manager = {0};
         texture_t* cpu_resources[2] = {NULL};
         renderer_backend_texture_t* gpu_resources[2] = {NULL};
         int16_t texture_id = 123;
+        string_atom_t atom = STRING_ATOM_INVALID;
+        const int16_t stale_id = 0;
+
+        test_texture_manager_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
 
         cpu_resources[0] = (texture_t*)(uintptr_t)0x1U;
         gpu_resources[0] = NULL;
@@ -3304,14 +4132,89 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("test_texture_red", &atom));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &stale_id, manager.name_index));
 
+        ret = texture_manager_texture_id_get("test_texture_red", &manager, &texture_id);
+
+        assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
+        assert(123 == texture_id);
+
+        string_intern_release(atom);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
         test_texture_manager_config_reset();
+    }
+    {
+        // 名称インデックスが範囲外のIDを保持している -> TEXTURE_SYSTEM_DATA_CORRUPTED
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+        string_atom_t atom = STRING_ATOM_INVALID;
+        const int16_t stale_id = 2;
+
+        test_texture_manager_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("test_texture_red", &atom));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &stale_id, manager.name_index));
+
+        ret = texture_manager_texture_id_get("test_texture_red", &manager, &texture_id);
+
+        assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
+        assert(123 == texture_id);
+
+        string_intern_release(atom);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
+        test_texture_manager_config_reset();
+    }
+    {
+        // 名称インデックスが指すスロットのtexture名が一致しない -> TEXTURE_SYSTEM_DATA_CORRUPTED
+        texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
+        texture_manager_t manager = {0};
+        texture_t* cpu_resources[2] = {NULL};
+        renderer_backend_texture_t* gpu_resources[2] = {NULL};
+        int16_t texture_id = 123;
+        string_atom_t atom = STRING_ATOM_INVALID;
+        const int16_t stale_id = 1;
+
+        test_texture_manager_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
+
+        assert(RESOURCE_SUCCESS == texture_create("test_texture_blue", &cpu_resources[1]));
+        gpu_resources[1] = (renderer_backend_texture_t*)(uintptr_t)0x1U;
+
+        manager.max_texture_count = 2;
+        manager.cpu_resources = cpu_resources;
+        manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
+
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("test_texture_red", &atom));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &stale_id, manager.name_index));
 
         ret = texture_manager_texture_id_get("test_texture_red", &manager, &texture_id);
 
         assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
         assert(123 == texture_id);
 
+        texture_destroy(&cpu_resources[1]);
+        string_intern_release(atom);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
         test_texture_manager_config_reset();
     }
     {
@@ -3325,6 +4228,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_texture_manager_config_reset();
 
@@ -3333,6 +4237,8 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
         assert(123 == texture_id);
 
+        test_name_index_detach(&manager);
+
         test_texture_manager_config_reset();
     }
     {
@@ -3362,6 +4268,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_texture_id_get("test_texture_green", &manager, &texture_id);
 
@@ -3371,6 +4278,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         texture_destroy(&cpu_resources[0]);
         assert(NULL == cpu_resources[0]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -3403,6 +4311,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         manager.max_texture_count = 3;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_texture_id_get("test_texture_red", &manager, &texture_id);
 
@@ -3412,6 +4321,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         texture_destroy(&cpu_resources[0]);
         assert(NULL == cpu_resources[0]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -3444,6 +4354,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         manager.max_texture_count = 3;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_texture_id_get("test_texture_blue", &manager, &texture_id);
 
@@ -3453,6 +4364,7 @@ static void NO_COVERAGE test_texture_manager_texture_id_get(void) {
         texture_destroy(&cpu_resources[2]);
         assert(NULL == cpu_resources[2]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -3999,6 +4911,7 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_texture_manager_config_reset();
 
@@ -4011,17 +4924,27 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         assert(TEXTURE_SYSTEM_BAD_OPERATION == ret);
         assert((renderer_backend_texture_t*)(uintptr_t)0x1234U == out_gpu_resource);
 
+        test_name_index_detach(&manager);
+
         test_texture_manager_config_reset();
     }
     {
         // texture_manager_texture_id_get() が TEXTURE_SYSTEM_DATA_CORRUPTED を返す
         // -> そのまま伝播
+        // 名称インデックスが、cpu_resources[i] == NULL && gpu_resources[i] != NULL のスロットを指す
         texture_system_result_t ret = TEXTURE_SYSTEM_SUCCESS;
         texture_manager_t manager = {0};
         texture_t* cpu_resources[2] = {NULL};
         renderer_backend_texture_t* gpu_resources[2] = {NULL};
         renderer_backend_texture_t* out_gpu_resource =
             (renderer_backend_texture_t*)(uintptr_t)0x1234U;
+        string_atom_t atom = STRING_ATOM_INVALID;
+        const int16_t stale_id = 0;
+
+        test_texture_manager_config_reset();
+        test_choco_memory_config_reset();
+        memory_system_destroy();
+        assert(MEMORY_SYSTEM_SUCCESS == memory_system_create());
 
         cpu_resources[0] = NULL;
         gpu_resources[0] = (renderer_backend_texture_t*)(uintptr_t)0x1U;
@@ -4029,8 +4952,10 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
-        test_texture_manager_config_reset();
+        assert(CHOCO_STRING_SUCCESS == string_intern_acquire("test_texture_red", &atom));
+        assert(HASH_MAP_SUCCESS == hash_map_insert(&atom, &stale_id, manager.name_index));
 
         ret = texture_manager_gpu_resource_get_by_name(
             "test_texture_red",
@@ -4041,6 +4966,9 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         assert(TEXTURE_SYSTEM_DATA_CORRUPTED == ret);
         assert((renderer_backend_texture_t*)(uintptr_t)0x1234U == out_gpu_resource);
 
+        string_intern_release(atom);
+        test_name_index_detach(&manager);
+        memory_system_destroy();
         test_texture_manager_config_reset();
     }
     {
@@ -4107,6 +5035,7 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         manager.max_texture_count = 2;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         test_call_control_reset(&config);
         config.fail_on_call = 1U;
@@ -4125,6 +5054,7 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         texture_destroy(&cpu_resources[0]);
         assert(NULL == cpu_resources[0]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -4158,6 +5088,7 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         manager.max_texture_count = 3;
         manager.cpu_resources = cpu_resources;
         manager.gpu_resources = gpu_resources;
+        test_name_index_attach(&manager);
 
         ret = texture_manager_gpu_resource_get_by_name(
             "test_texture_blue",
@@ -4171,6 +5102,7 @@ static void NO_COVERAGE test_texture_manager_gpu_resource_get_by_name(void) {
         texture_destroy(&cpu_resources[2]);
         assert(NULL == cpu_resources[2]);
 
+        test_name_index_detach(&manager);
         memory_system_destroy();
         test_texture_manager_config_reset();
         test_texture_config_reset();
@@ -4240,4 +5172,36 @@ static void NO_COVERAGE test_tex_sys_rslt_convert_resource(void) {
 
     assert(TEXTURE_SYSTEM_UNDEFINED_ERROR == tex_sys_rslt_convert_resource((resource_result_t)99999));
 }
+
+static void NO_COVERAGE test_tex_sys_rslt_convert_hash_map(void) {
+    assert(TEXTURE_SYSTEM_SUCCESS == tex_sys_rslt_convert_hash_map(HASH_MAP_SUCCESS));
+    assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == tex_sys_rslt_convert_hash_map(HASH_MAP_INVALID_ARGUMENT));
+    assert(TEXTURE_SYSTEM_NO_MEMORY == tex_sys_rslt_convert_hash_map(HASH_MAP_NO_MEMORY));
+    assert(TEXTURE_SYSTEM_RUNTIME_ERROR == tex_sys_rslt_convert_hash_map(HASH_MAP_RUNTIME_ERROR));
+    assert(TEXTURE_SYSTEM_LIMIT_EXCEEDED == tex_sys_rslt_convert_hash_map(HASH_MAP_LIMIT_EXCEEDED));
+    assert(TEXTURE_SYSTEM_BAD_OPERATION == tex_sys_rslt_convert_hash_map(HASH_MAP_BAD_OPERATION));
+    assert(TEXTURE_SYSTEM_DATA_CORRUPTED == tex_sys_rslt_convert_hash_map(HASH_MAP_DATA_CORRUPTED));
+    assert(TEXTURE_SYSTEM_OVERFLOW == tex_sys_rslt_convert_hash_map(HASH_MAP_OVERFLOW));
+    assert(TEXTURE_SYSTEM_BAD_OPERATION == tex_sys_rslt_convert_hash_map(HASH_MAP_KEY_NOT_FOUND));
+    assert(TEXTURE_SYSTEM_BAD_OPERATION == tex_sys_rslt_convert_hash_map(HASH_MAP_KEY_EXISTS));
+    assert(TEXTURE_SYSTEM_UNDEFINED_ERROR == tex_sys_rslt_convert_hash_map(HASH_MAP_UNDEFINED_ERROR));
+
+    assert(TEXTURE_SYSTEM_UNDEFINED_ERROR == tex_sys_rslt_convert_hash_map((hash_map_result_t)99999));
+}
+
+static void NO_COVERAGE test_tex_sys_rslt_convert_sparse_set(void) {
+    assert(TEXTURE_SYSTEM_SUCCESS == tex_sys_rslt_convert_sparse_set(SPARSE_SET_SUCCESS));
+    assert(TEXTURE_SYSTEM_INVALID_ARGUMENT == tex_sys_rslt_convert_sparse_set(SPARSE_SET_INVALID_ARGUMENT));
+    assert(TEXTURE_SYSTEM_NO_MEMORY == tex_sys_rslt_convert_sparse_set(SPARSE_SET_NO_MEMORY));
+    assert(TEXTURE_SYSTEM_RUNTIME_ERROR == tex_sys_rslt_convert_sparse_set(SPARSE_SET_RUNTIME_ERROR));
+    assert(TEXTURE_SYSTEM_LIMIT_EXCEEDED == tex_sys_rslt_convert_sparse_set(SPARSE_SET_LIMIT_EXCEEDED));
+    assert(TEXTURE_SYSTEM_BAD_OPERATION == tex_sys_rslt_convert_sparse_set(SPARSE_SET_BAD_OPERATION));
+    assert(TEXTURE_SYSTEM_DATA_CORRUPTED == tex_sys_rslt_convert_sparse_set(SPARSE_SET_DATA_CORRUPTED));
+    assert(TEXTURE_SYSTEM_OVERFLOW == tex_sys_rslt_convert_sparse_set(SPARSE_SET_OVERFLOW));
+    assert(TEXTURE_SYSTEM_BAD_OPERATION == tex_sys_rslt_convert_sparse_set(SPARSE_SET_ID_NOT_FOUND));
+    assert(TEXTURE_SYSTEM_BAD_OPERATION == tex_sys_rslt_convert_sparse_set(SPARSE_SET_ID_EXISTS));
+    assert(TEXTURE_SYSTEM_UNDEFINED_ERROR == tex_sys_rslt_convert_sparse_set(SPARSE_SET_UNDEFINED_ERROR));
+
+    assert(TEXTURE_SYSTEM_UNDEFINED_ERROR == tex_sys_rslt_convert_sparse_set((sparse_set_result_t)99999));
+}
 #endif
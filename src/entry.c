@@ -31,13 +31,24 @@
 
 // test: engine/core
 #include "engine/core/memory/test_linear_allocator.h"
+#include "engine/core/memory/test_freelist_allocator.h"
+#include "engine/core/memory/test_slab_allocator.h"
+#include "engine/core/memory/test_frame_allocator.h"
+#include "engine/core/memory/test_virtual_arena.h"
 #include "engine/core/memory/test_choco_memory.h"
 #include "engine/core/filesystem/test_filesystem.h"
 #include "engine/core/buffer_utils/test_buffer_utils.h"
 
 // test: engine/containers
 #include "engine/containers/test_choco_string.h"
+#include "engine/containers/test_string_intern.h"
 #include "engine/containers/test_ring_queue.h"
+#include "engine/containers/test_handle_pool.h"
+#include "engine/containers/test_hash_map.h"
+#include "engine/containers/test_darray.h"
+#include "engine/containers/test_sparse_set.h"
+#include "engine/containers/test_spsc_ring_queue.h"
+#include "engine/containers/test_mpmc_ring_queue.h"
 
 // test: engine/io_utils
 #include "engine/io_utils/fs_utils/test_fs_utils.h"
@@ -110,13 +121,24 @@ int main(int argc_, char** argv_) {
 
         // engine/core
         test_linear_allocator();
+        test_freelist_allocator();
+        test_slab_allocator();
+        test_frame_allocator();
+        test_virtual_arena();
         test_choco_memory();
         test_filesystem();
         test_buffer_utils();
 
         // engine/containers
         test_choco_string();
+        test_string_intern();
         test_ring_queue();
+        test_handle_pool();
+        test_hash_map();
+        test_darray();
+        test_sparse_set();
+        test_spsc_ring_queue();
+        test_mpmc_ring_queue();
 
         // engine/io_utils
         test_fs_utils();
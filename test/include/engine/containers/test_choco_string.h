@@ -76,6 +76,51 @@ void test_choco_string_concat_config_set(const test_call_control_t* config_);
  */
 void test_choco_string_concat_from_c_string_config_set(const test_call_control_t* config_);
 
+/**
+ * @brief choco_string_copy_from_view()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Choco String内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_choco_string_copy_from_view_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief choco_string_concat_from_view()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Choco String内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_choco_string_concat_from_view_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief choco_string_append_format()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Choco String内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_choco_string_append_format_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief choco_string_reserve()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Choco String内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_choco_string_reserve_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief choco_string_shrink_to_fit()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Choco String内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_choco_string_shrink_to_fit_config_set(const test_call_control_t* config_);
+
 /**
  * @brief choco_string_length()APIに対して失敗注入設定を行う
  *
@@ -0,0 +1,68 @@
+/**
+ * @file test_darray.h
+ * @author chocolate-pie24
+ * @brief Dynamic Arrayモジュールテスト用API定義
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_TEST_ENGINE_CONTAINERS_TEST_DARRAY_H
+#define GLCE_TEST_ENGINE_CONTAINERS_TEST_DARRAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TEST_BUILD
+#include "test_controller.h"
+
+/**
+ * @brief darray_create()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Dynamic Array内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_darray_create_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief darray_push()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Dynamic Array内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_darray_push_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief darray_append()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Dynamic Array内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_darray_append_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief Dynamic Arrayが内部で管理するテスト設定値を全て初期化し、テスト用の出力強制制御をなくす
+ *
+ */
+void test_darray_config_reset(void);
+
+/**
+ * @brief Dynamic ArrayモジュールAPIのテストを行う
+ *
+ */
+void test_darray(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file test_handle_pool.h
+ * @author chocolate-pie24
+ * @brief Handle Poolモジュールテスト用API定義
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_TEST_ENGINE_CONTAINERS_TEST_HANDLE_POOL_H
+#define GLCE_TEST_ENGINE_CONTAINERS_TEST_HANDLE_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TEST_BUILD
+#include "test_controller.h"
+
+/**
+ * @brief handle_pool_create()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Handle Pool内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_handle_pool_create_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief handle_pool_register()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Handle Pool内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_handle_pool_register_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief Handle Poolが内部で管理するテスト設定値を全て初期化し、テスト用の出力強制制御をなくす
+ *
+ */
+void test_handle_pool_config_reset(void);
+
+/**
+ * @brief Handle PoolモジュールAPIのテストを行う
+ *
+ */
+void test_handle_pool(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file test_hash_map.h
+ * @author chocolate-pie24
+ * @brief Hash Mapモジュールテスト用API定義
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_TEST_ENGINE_CONTAINERS_TEST_HASH_MAP_H
+#define GLCE_TEST_ENGINE_CONTAINERS_TEST_HASH_MAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TEST_BUILD
+#include "test_controller.h"
+
+/**
+ * @brief hash_map_create()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Hash Map内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_hash_map_create_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief hash_map_initialize()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Hash Map内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_hash_map_initialize_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief hash_map_insert()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Hash Map内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_hash_map_insert_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief Hash Mapが内部で管理するテスト設定値を全て初期化し、テスト用の出力強制制御をなくす
+ *
+ */
+void test_hash_map_config_reset(void);
+
+/**
+ * @brief Hash MapモジュールAPIのテストを行う
+ *
+ */
+void test_hash_map(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
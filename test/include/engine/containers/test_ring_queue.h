@@ -49,6 +49,114 @@ void test_ring_queue_push_config_set(const test_call_control_t* config_);
  */
 void test_ring_queue_pop_config_set(const test_call_control_t* config_);
 
+/**
+ * @brief ring_queue_create_pow2()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_create_pow2_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_push_unchecked()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_push_unchecked_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_pop_unchecked()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_pop_unchecked_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_push_n()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_push_n_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_pop_n()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_pop_n_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_reserve()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_reserve_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_commit()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_commit_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_peek()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_peek_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_release()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_release_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_set_overflow_policy()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_set_overflow_policy_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_stats_get()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_stats_get_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief ring_queue_stats_reset()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Ring Queue内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_ring_queue_stats_reset_config_set(const test_call_control_t* config_);
+
 /**
  * @brief ring_queue_empty()APIに対して失敗注入設定を行う
  *
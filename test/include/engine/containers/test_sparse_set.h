@@ -0,0 +1,68 @@
+/**
+ * @file test_sparse_set.h
+ * @author chocolate-pie24
+ * @brief Sparse Setモジュールテスト用API定義
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_TEST_ENGINE_CONTAINERS_TEST_SPARSE_SET_H
+#define GLCE_TEST_ENGINE_CONTAINERS_TEST_SPARSE_SET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TEST_BUILD
+#include "test_controller.h"
+
+/**
+ * @brief sparse_set_create()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Sparse Set内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_sparse_set_create_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief sparse_set_initialize()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Sparse Set内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_sparse_set_initialize_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief sparse_set_acquire()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Sparse Set内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_sparse_set_acquire_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief Sparse Setが内部で管理するテスト設定値を全て初期化し、テスト用の出力強制制御をなくす
+ *
+ */
+void test_sparse_set_config_reset(void);
+
+/**
+ * @brief Sparse SetモジュールAPIのテストを行う
+ *
+ */
+void test_sparse_set(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
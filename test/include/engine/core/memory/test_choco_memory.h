@@ -40,6 +40,33 @@ void test_memory_system_create_config_set(const test_call_control_t* config_);
  */
 void test_memory_system_allocate_config_set(const test_call_control_t* config_);
 
+/**
+ * @brief memory_system_allocate_aligned()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、メモリーシステム内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_memory_system_allocate_aligned_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief memory_system_reallocate()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、メモリーシステム内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_memory_system_reallocate_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief memory_system_reallocate_aligned()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、メモリーシステム内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_memory_system_reallocate_aligned_config_set(const test_call_control_t* config_);
+
 /**
  * @brief メモリーシステムが内部で管理するテスト設定値を全て初期化し、テスト用の出力強制制御をなくす
  *
@@ -0,0 +1,50 @@
+/**
+ * @file test_frame_allocator.h
+ * @author chocolate-pie24
+ * @brief Frame Allocatorモジュールテスト用API定義
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_TEST_ENGINE_CORE_MEMORY_TEST_FRAME_ALLOCATOR_H
+#define GLCE_TEST_ENGINE_CORE_MEMORY_TEST_FRAME_ALLOCATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TEST_BUILD
+#include "test_controller.h"
+
+/**
+ * @brief frame_allocator_initialize()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Frame Allocator内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_frame_allocator_initialize_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief Frame Allocatorモジュールのテスト設定値を全て初期化し、テスト専用出力をなくす
+ *
+ */
+void test_frame_allocator_config_reset(void);
+
+/**
+ * @brief Frame AllocatorモジュールAPIのテストを行う
+ *
+ */
+void test_frame_allocator(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
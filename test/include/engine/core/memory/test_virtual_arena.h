@@ -0,0 +1,59 @@
+/**
+ * @file test_virtual_arena.h
+ * @author chocolate-pie24
+ * @brief Virtual Arenaモジュールテスト用API定義
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 chocolate-pie24
+ *
+ * @par License
+ * MIT License. See LICENSE file in the project root for full license text.
+ *
+ */
+#ifndef GLCE_TEST_ENGINE_CORE_MEMORY_TEST_VIRTUAL_ARENA_H
+#define GLCE_TEST_ENGINE_CORE_MEMORY_TEST_VIRTUAL_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TEST_BUILD
+#include "test_controller.h"
+
+/**
+ * @brief virtual_arena_init()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Virtual Arena内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_virtual_arena_init_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief virtual_arena_commit()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、Virtual Arena内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_virtual_arena_commit_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief Virtual Arenaモジュールのテスト設定値を全て初期化し、テスト専用出力をなくす
+ *
+ */
+void test_virtual_arena_config_reset(void);
+
+/**
+ * @brief Virtual ArenaモジュールAPIのテストを行う
+ *
+ */
+void test_virtual_arena(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -51,6 +51,24 @@ void test_camera_rslt_convert_choco_string_config_set(const test_call_control_t*
  */
 void test_camera_rslt_convert_linear_alloc_config_set(const test_call_control_t* config_);
 
+ /**
+ * @brief camera_rslt_convert_hash_map()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、camera_err_utils内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_camera_rslt_convert_hash_map_config_set(const test_call_control_t* config_);
+
+/**
+ * @brief camera_rslt_convert_sparse_set()APIに対して失敗注入設定を行う
+ *
+ * @note API呼び出し回数についてはコピーされず、camera_err_utils内で管理している値が保持される
+ *
+ * @param[in] config_ テスト設定値構造体インスタンスへのポインタ
+ */
+void test_camera_rslt_convert_sparse_set_config_set(const test_call_control_t* config_);
+
 /**
  * @brief camera_err_utilsが内部で管理するテスト設定値を全て初期化し、テスト用の出力強制制御をなくす
  *